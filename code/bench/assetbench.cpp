@@ -0,0 +1,1067 @@
+/*
+ *  assetbench
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+// Benchmarks for the asset paths: image decode, OBJ parsing and model
+// loading, and fetching over http from a loopback server.
+
+#include "bench.h"
+
+#include "r3/buffer.h"
+#include "r3/filesystem.h"
+#include "r3/glstate.h"
+#include "r3/http.h"
+#include "r3/image.h"
+#include "r3/memory.h"
+#include "r3/meshopt.h"
+#include "r3/meshquant.h"
+#include "r3/model.h"
+#include "r3/modelobj.h"
+#include "r3/nullgl.h"
+#include "r3/output.h"
+#include "r3/socket.h"
+#include "r3/thread.h"
+#include "r3/var.h"
+#include "r3/varying.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace r3;
+
+namespace r3 {
+	extern VarString f_basePath;
+}
+extern VarBool mem_budgetFail;
+
+namespace {
+	
+	bool WriteFile( const string & filename, const void * data, int size ) {
+		File * f = FileOpenForWrite( filename );
+		if( f == NULL ) {
+			return false;
+		}
+		int wrote = f->Write( data, 1, size );
+		delete f;
+		return wrote == size;
+	}
+	
+	// ReadImageFile decodes, flips to bottom up and adds alpha to an RGB png
+	void ImageDecode( BenchState & b ) {
+		const int size = 512;
+		Image< uchar > src;
+		src.SetSize( size, size, 3 );
+		uint seed = 3;
+		for( int j = 0; j < size; j++ ) {
+			for( int i = 0; i < size; i++ ) {
+				// smooth gradients with some noise, so the png is not trivially small
+				uint n = BenchRandom( seed ) & 15;
+				src( i, j, 0 ) = uchar( i / 2 + n );
+				src( i, j, 1 ) = uchar( j / 2 + n );
+				src( i, j, 2 ) = uchar( ( i + j ) / 4 );
+			}
+		}
+		WriteImageFile( "benchimage.png", &src );
+		Image< uchar > * img = NULL;
+		while( b.Loop() ) {
+			delete img;
+			img = ReadImageFile( "benchimage.png", 4 );
+		}
+		if( img == NULL || img->Width() != size || img->Height() != size ) {
+			b.Fail( "benchimage.png did not decode" );
+		} else if( memcmp( &(*img)( 0, 0, 0 ), &src( 0, size - 1, 0 ), 3 ) || memcmp( &(*img)( 0, size - 1, 0 ), &src( 0, 0, 0 ), 3 ) ) {
+			b.Fail( "benchimage.png was not flipped" );
+		}
+		delete img;
+		b.SetBytes( size * size * 4 );
+		
+		// over budget with mem_budgetFail set, a resize fails and leaves
+		// mem_image as it was, even after the image is gone
+		int64 live = mem_image.Live();
+		int savedBudget = mem_image.GetVal();
+		bool savedFail = mem_budgetFail.GetVal();
+		mem_image.SetVal( int( live / 1024 ) + 1 );
+		mem_budgetFail.SetVal( true );
+		Image< uchar > * big = new Image< uchar >();
+		bool resized = big->SetSize( size, size, 4 );
+		delete big;
+		mem_image.SetVal( savedBudget );
+		mem_budgetFail.SetVal( savedFail );
+		if( resized || mem_image.Live() != live ) {
+			b.Fail( "an image over budget %s, mem_image went from %lld to %lld bytes", resized ? "was allocated" : "was refused", live, mem_image.Live() );
+		}
+	}
+	Benchmark ImageDecodeBench( "image/decode", ImageDecode );
+	
+	// OBJ text for a grid of n by n quads with positions, texcoords and normals
+	string GridObj( int n ) {
+		string obj = "# r3bench grid\n";
+		char buf[256];
+		for( int j = 0; j <= n; j++ ) {
+			for( int i = 0; i <= n; i++ ) {
+				r3Sprintf( buf, "v %f %f %f\nvt %f %f\nvn 0 0 1\n", i * 0.1f, j * 0.1f, 0.01f * ( ( i * j ) % 7 ), float( i ) / n, float( j ) / n );
+				obj += buf;
+			}
+		}
+		for( int j = 0; j < n; j++ ) {
+			for( int i = 0; i < n; i++ ) {
+				int a = j * ( n + 1 ) + i + 1;
+				int c = a + n + 1;
+				r3Sprintf( buf, "f %d/%d/%d %d/%d/%d %d/%d/%d %d/%d/%d\n", a, a, a, a + 1, a + 1, a + 1, c + 1, c + 1, c + 1, c, c, c );
+				obj += buf;
+			}
+		}
+		return obj;
+	}
+	
+	// Parses a grid n quads on a side, and checks the counts and that the
+	// vertex for the second corner of the first face came out right.  The
+	// text is made once and kept in obj, since trials share the file.
+	void ObjParseGrid( BenchState & b, int n, const char * filename, string & obj ) {
+		if( obj.size() == 0 ) {
+			obj = GridObj( n );
+			if( WriteFile( filename, obj.c_str(), (int)obj.size() ) == false ) {
+				obj.clear();
+				b.Fail( "unable to write %s", filename );
+				return;
+			}
+		}
+		ObjMesh mesh;
+		while( b.Loop() ) {
+			mesh = ObjMesh();
+			if( ReadObjFile( filename, mesh ) == false ) {
+				b.Fail( "unable to parse %s", filename );
+			}
+		}
+		int verts = ( n + 1 ) * ( n + 1 );
+		uint maxIndex = 0;
+		for( int i = 0; i < (int)mesh.indices.size(); i++ ) {
+			maxIndex = max( maxIndex, mesh.indices[ i ] );
+		}
+		if( mesh.vertices.size() != size_t( verts * 8 ) || mesh.indices.size() != size_t( n * n * 6 ) ) {
+			b.Fail( "%s has %d floats and %d indices", filename, (int)mesh.vertices.size(), (int)mesh.indices.size() );
+		} else if( maxIndex != uint( verts - 1 ) ) {
+			b.Fail( "%s has %d vertexes, but the largest index is %u", filename, verts, maxIndex );
+		} else {
+			// position, normal, texcoord
+			const float expect[] = { 0.1f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f / n, 0.0f };
+			for( int i = 0; i < 8; i++ ) {
+				if( fabs( mesh.vertices[ 8 + i ] - expect[ i ] ) > 1e-6f ) {
+					b.Fail( "%s vertex 1 component %d is %f, expected %f", filename, i, mesh.vertices[ 8 + i ], expect[ i ] );
+					break;
+				}
+			}
+		}
+		b.SetBytes( obj.size() );
+		b.SetCounter( "triangles", double( n ) * n * 2 );
+	}
+	
+	void ObjParse( BenchState & b ) {
+		static string obj;
+		ObjParseGrid( b, 100, "benchgrid.obj", obj );
+	}
+	Benchmark ObjParseBench( "obj/parse", ObjParse );
+	
+	// two million triangles, about 150MB of text
+	const int LargeGridSize = 1024;
+	string largeGridObj;
+	
+	void ObjParseLarge( BenchState & b ) {
+		ObjParseGrid( b, LargeGridSize, "benchgrid_large.obj", largeGridObj );
+	}
+	Benchmark ObjParseLargeBench( "obj/parse_large", ObjParseLarge );
+	
+	// Scaling of the chunked parser with obj_parseThreads.  Every thread
+	// count must give exactly what one thread does.
+	void ObjParseThreads( BenchState & b, const char * threads ) {
+		if( largeGridObj.size() == 0 ) {
+			largeGridObj = GridObj( LargeGridSize );
+		}
+		const char * text = largeGridObj.c_str();
+		int size = (int)largeGridObj.size();
+		Var * var = FindVar( "obj_parseThreads" );
+		string saved = var->Get();
+		static ObjMesh serial;
+		if( serial.indices.size() == 0 ) {
+			var->Set( "1" );
+			ParseObj( text, size, serial );
+		}
+		var->Set( threads );
+		ObjMesh mesh;
+		while( b.Loop() ) {
+			mesh = ObjMesh();
+			if( ParseObj( text, size, mesh ) == false ) {
+				b.Fail( "unable to parse the large grid" );
+			}
+		}
+		var->Set( saved.c_str() );
+		if( mesh.varying != serial.varying || mesh.vertices.size() != serial.vertices.size() || mesh.indices != serial.indices ||
+		    memcmp( &mesh.vertices[0], &serial.vertices[0], mesh.vertices.size() * sizeof( float ) ) != 0 ) {
+			b.Fail( "%s threads parsed the grid differently than one", threads );
+		}
+		b.SetBytes( size );
+	}
+	void ObjParseThreads1( BenchState & b ) {
+		ObjParseThreads( b, "1" );
+	}
+	void ObjParseThreads2( BenchState & b ) {
+		ObjParseThreads( b, "2" );
+	}
+	void ObjParseThreads4( BenchState & b ) {
+		ObjParseThreads( b, "4" );
+	}
+	void ObjParseThreads8( BenchState & b ) {
+		ObjParseThreads( b, "8" );
+	}
+	void ObjParseThreads16( BenchState & b ) {
+		ObjParseThreads( b, "16" );
+	}
+	Benchmark ObjParseThreads1Bench( "obj/parse_threads_1", ObjParseThreads1 );
+	Benchmark ObjParseThreads2Bench( "obj/parse_threads_2", ObjParseThreads2 );
+	Benchmark ObjParseThreads4Bench( "obj/parse_threads_4", ObjParseThreads4 );
+	Benchmark ObjParseThreads8Bench( "obj/parse_threads_8", ObjParseThreads8 );
+	Benchmark ObjParseThreads16Bench( "obj/parse_threads_16", ObjParseThreads16 );
+	
+	// The GL side models need, on the null backend, for one trial.
+	struct ModelScope {
+		ModelScope() {
+			SetOutputFunction( BenchNullOutput );
+			InitNullGL();
+			InitGLState();
+			InitBuffer();
+			InitModel();
+		}
+		~ModelScope() {
+			ShutdownModel();
+			ShutdownBuffer();
+			ShutdownGLState();
+			ShutdownNullGL();
+			SetOutputFunction( BenchStderrOutput );
+		}
+	};
+	
+	const char * ModelGridFile = "benchgrid_model.obj";
+	
+	bool WriteModelGrid( BenchState & b ) {
+		static bool written = false;
+		if( written == false ) {
+			if( largeGridObj.size() == 0 ) {
+				largeGridObj = GridObj( LargeGridSize );
+			}
+			written = WriteFile( ModelGridFile, largeGridObj.c_str(), (int)largeGridObj.size() );
+			if( written == false ) {
+				b.Fail( "unable to write %s", ModelGridFile );
+			}
+		}
+		return written;
+	}
+	
+	// CreateModelFromObjFile on the large grid, parsing every time or from
+	// the binary copy the first load leaves in the cache.  Either way the
+	// model must have the grid's indexes, attributes and bounds.
+	void ObjModelLoad( BenchState & b, const char * meshCache ) {
+		if( WriteModelGrid( b ) == false ) {
+			return;
+		}
+		ModelScope scope;
+		Var * var = FindVar( "obj_meshCache" );
+		string saved = var->Get();
+		var->Set( meshCache );
+		// just the parse, lod building has its own benchmark
+		Var * lodsVar = FindVar( "obj_lods" );
+		string savedLods = lodsVar->Get();
+		lodsVar->Set( "1" );
+		delete CreateModelFromObjFile( ModelGridFile );
+		int numIndexes = 0;
+		GLenum indexType = 0;
+		int numAttributes = 0;
+		BufferShadowEnum shadow = BufferShadow_Keep;
+		Bounds3f bounds;
+		while( b.Loop() ) {
+			Model * m = CreateModelFromObjFile( ModelGridFile );
+			if( m == NULL ) {
+				b.Fail( "unable to load %s", ModelGridFile );
+				continue;
+			}
+			numIndexes = m->GetNumVertexes();
+			indexType = m->GetIndexType();
+			numAttributes = (int)m->GetAttributeArrays().size();
+			shadow = m->GetVertexBuffer().GetShadow();
+			bounds = m->GetBounds();
+			delete m;
+		}
+		var->Set( saved.c_str() );
+		lodsVar->Set( savedLods.c_str() );
+		int n = LargeGridSize;
+		Vec3f bmax( n * 0.1f, n * 0.1f, 0.06f );
+		if( numIndexes != n * n * 6 || indexType != GL_UNSIGNED_INT || numAttributes != 3 ) {
+			b.Fail( "%s loaded with %d indexes of type 0x%x and %d attributes", ModelGridFile, numIndexes, indexType, numAttributes );
+		} else if( ( bounds.Min() - Vec3f() ).Length() > 1e-4f || ( bounds.Max() - bmax ).Length() > 1e-4f ) {
+			b.Fail( "%s bounds are ( %f %f %f ) to ( %f %f %f )", ModelGridFile, bounds.Min().x, bounds.Min().y, bounds.Min().z, bounds.Max().x, bounds.Max().y, bounds.Max().z );
+		} else if( ( shadow == BufferShadow_File ) != ( strcmp( meshCache, "1" ) == 0 ) ) {
+			b.Fail( "%s %s from the mesh cache", ModelGridFile, shadow == BufferShadow_File ? "loaded" : "did not load" );
+		}
+		b.SetBytes( largeGridObj.size() );
+	}
+	void ObjModelParse( BenchState & b ) {
+		ObjModelLoad( b, "0" );
+	}
+	void ObjModelCached( BenchState & b ) {
+		ObjModelLoad( b, "1" );
+	}
+	Benchmark ObjModelParseBench( "obj/model_parse", ObjModelParse );
+	Benchmark ObjModelCachedBench( "obj/model_cached", ObjModelCached );
+	
+	// A cached load of an OBJ that was put in the base path by hand rather
+	// than written through the cache, so the manifest has no md5 for it.
+	// The cache key must come from the file's size and time, not from
+	// reading it, and an edit must still be noticed.
+	const char * BaseGridFile = "benchgrid_base.obj";
+	
+	bool WriteBaseFile( const string & filename, const string & text ) {
+		string path = f_basePath.GetVal() + filename;
+		FILE * fp = fopen( path.c_str(), "wb" );
+		if( fp == NULL ) {
+			return false;
+		}
+		size_t wrote = fwrite( text.c_str(), 1, text.size(), fp );
+		fclose( fp );
+		return wrote == text.size();
+	}
+	
+	void ObjModelCachedBase( BenchState & b ) {
+		const int n = 200;
+		string grid = GridObj( n );
+		if( WriteBaseFile( BaseGridFile, grid ) == false ) {
+			b.Fail( "unable to write %s", BaseGridFile );
+			return;
+		}
+		ModelScope scope;
+		Var * var = FindVar( "obj_meshCache" );
+		string saved = var->Get();
+		var->Set( "1" );
+		Var * lodsVar = FindVar( "obj_lods" );
+		string savedLods = lodsVar->Get();
+		lodsVar->Set( "1" );
+		delete CreateModelFromObjFile( BaseGridFile );
+		int numIndexes = 0;
+		BufferShadowEnum shadow = BufferShadow_Keep;
+		while( b.Loop() ) {
+			Model * m = CreateModelFromObjFile( BaseGridFile );
+			if( m == NULL ) {
+				b.Fail( "unable to load %s", BaseGridFile );
+				continue;
+			}
+			numIndexes = m->GetNumVertexes();
+			shadow = m->GetVertexBuffer().GetShadow();
+			delete m;
+		}
+		b.SetBytes( grid.size() );
+		if( numIndexes != n * n * 6 || shadow != BufferShadow_File ) {
+			b.Fail( "%s loaded with %d indexes, %s the mesh cache", BaseGridFile, numIndexes, shadow == BufferShadow_File ? "from" : "not from" );
+		} else if( WriteBaseFile( BaseGridFile, GridObj( n / 2 ) ) == false ) {
+			b.Fail( "unable to rewrite %s", BaseGridFile );
+		} else {
+			Model * m = CreateModelFromObjFile( BaseGridFile );
+			if( m == NULL || m->GetNumVertexes() != n * n * 6 / 4 ) {
+				b.Fail( "%s was not reparsed after an edit", BaseGridFile );
+			}
+			delete m;
+		}
+		var->Set( saved.c_str() );
+		lodsVar->Set( savedLods.c_str() );
+	}
+	Benchmark ObjModelCachedBaseBench( "obj/model_cached_base", ObjModelCachedBase );
+	
+	// An uncached load of a small model with logging turned all the way up
+	// or down to warnings, to show what Output costs an asset load.  Verbose
+	// calls are compiled out of NDEBUG builds, so there "verbose" only adds
+	// the info messages; the lines counter says how many were formatted.
+	const char * OutputGridFile = "benchgrid_output.obj";
+	string outputGridObj;
+	int outputLines;
+	void CountOutput( const char * msg ) {
+		outputLines++;
+	}
+	
+	void ObjModelOutput( BenchState & b, OutputLevelEnum level ) {
+		if( outputGridObj.size() == 0 ) {
+			outputGridObj = GridObj( 100 );
+			if( WriteFile( OutputGridFile, outputGridObj.c_str(), (int)outputGridObj.size() ) == false ) {
+				outputGridObj.clear();
+				b.Fail( "unable to write %s", OutputGridFile );
+				return;
+			}
+		}
+		ModelScope scope;
+		SetOutputFunction( CountOutput );
+		Var * var = FindVar( "obj_meshCache" );
+		string saved = var->Get();
+		var->Set( "0" );
+		Var * lodsVar = FindVar( "obj_lods" );
+		string savedLods = lodsVar->Get();
+		lodsVar->Set( "1" );
+		int savedLevel = out_level.GetVal();
+		out_level.SetVal( level );
+		outputLines = 0;
+		int64 loads = 0;
+		while( b.Loop() ) {
+			Model * m = CreateModelFromObjFile( OutputGridFile );
+			if( m == NULL ) {
+				b.Fail( "unable to load %s", OutputGridFile );
+			}
+			delete m;
+			loads++;
+		}
+		out_level.SetVal( savedLevel );
+		var->Set( saved.c_str() );
+		lodsVar->Set( savedLods.c_str() );
+		b.SetCounter( "lines", loads ? double( outputLines ) / loads : 0.0 );
+		b.SetBytes( outputGridObj.size() );
+	}
+	void ObjModelOutputQuiet( BenchState & b ) {
+		ObjModelOutput( b, Output_Warning );
+	}
+	void ObjModelOutputVerbose( BenchState & b ) {
+		ObjModelOutput( b, Output_Verbose );
+	}
+	Benchmark ObjModelOutputQuietBench( "obj/model_output_quiet", ObjModelOutputQuiet );
+	Benchmark ObjModelOutputVerboseBench( "obj/model_output_verbose", ObjModelOutputVerbose );
+	
+	bool SameLods( const vector< MeshLod > & a, const vector< MeshLod > & b ) {
+		if( a.size() != b.size() ) {
+			return false;
+		}
+		for( int i = 0; i < (int)a.size(); i++ ) {
+			if( a[ i ].firstIndex != b[ i ].firstIndex || a[ i ].numIndexes != b[ i ].numIndexes || a[ i ].error != b[ i ].error ) {
+				return false;
+			}
+		}
+		return true;
+	}
+	
+	// Editing an OBJ must make the next load parse it again, and the one
+	// after that use the new binary copy, levels of detail and all.
+	void ObjModelCacheStale( BenchState & b ) {
+		ModelScope scope;
+		const char * filename = "benchgrid_stale.obj";
+		string grids[2] = { GridObj( 8 ), GridObj( 9 ) };
+		while( b.Loop() ) {
+			for( int i = 0; i < 2; i++ ) {
+				int n = 8 + i;
+				WriteFile( filename, grids[ i ].c_str(), (int)grids[ i ].size() );
+				vector< MeshLod > lods;
+				for( int j = 0; j < 2; j++ ) {
+					Model * m = CreateModelFromObjFile( filename );
+					bool cached = m && m->GetVertexBuffer().GetShadow() == BufferShadow_File;
+					if( m == NULL || m->GetNumVertexes() != n * n * 6 || cached != ( j == 1 ) ) {
+						b.Fail( "load %d of the %d by %d grid gave %d indexes, %s the mesh cache", j, n, n, m ? m->GetNumVertexes() : 0, cached ? "from" : "not from" );
+					} else if( j == 0 ) {
+						lods = m->GetLods();
+						if( lods.size() < 2 ) {
+							b.Fail( "the %d by %d grid has %d levels of detail", n, n, (int)lods.size() );
+						}
+					} else if( SameLods( lods, m->GetLods() ) == false ) {
+						b.Fail( "the %d by %d grid's levels of detail changed in the mesh cache", n, n );
+					}
+					delete m;
+				}
+			}
+		}
+	}
+	Benchmark ObjModelCacheStaleBench( "obj/model_cache_stale", ObjModelCacheStale );
+	
+	// Importing with obj_quantize, parsed and then from the mesh cache.
+	// Both must have 12 byte vertexes with the packed attribute types,
+	// and the same scaling back to the grid's bounds.
+	void ObjModelQuantized( BenchState & b ) {
+		ModelScope scope;
+		const char * filename = "benchgrid_quantized.obj";
+		const int n = 64;
+		string grid = GridObj( n );
+		WriteFile( filename, grid.c_str(), (int)grid.size() );
+		Var * var = FindVar( "obj_quantize" );
+		string saved = var->Get();
+		var->Set( "1" );
+		int numVertexes = ( n + 1 ) * ( n + 1 );
+		while( b.Loop() ) {
+			Dequantize dq[2];
+			for( int j = 0; j < 2; j++ ) {
+				Model * m = CreateModelFromObjFile( filename );
+				if( m == NULL ) {
+					b.Fail( "unable to load %s", filename );
+					continue;
+				}
+				const vector< AttributeArray > & attr = m->GetAttributeArrays();
+				GLenum types[] = { GL_UNSIGNED_SHORT, GL_BYTE, GL_HALF_FLOAT };
+				bool ok = attr.size() == 3 && m->GetVertexBuffer().GetSize() == numVertexes * 12;
+				for( int i = 0; ok && i < 3; i++ ) {
+					ok = attr[ i ].type == types[ i ] && attr[ i ].stride == 12;
+				}
+				if( ok == false ) {
+					b.Fail( "load %d of %s has the wrong attributes or vertex size", j, filename );
+				}
+				dq[ j ] = m->GetDequantize();
+				delete m;
+			}
+			Vec3f extent( n * 0.1f, n * 0.1f, 0.06f );
+			if( ( dq[0].positionScale - extent ).Length() > 1e-4f || dq[0].positionOffset.Length() > 1e-4f ) {
+				b.Fail( "positions scale by ( %f %f %f )", dq[0].positionScale.x, dq[0].positionScale.y, dq[0].positionScale.z );
+			} else if( dq[1].positionScale != dq[0].positionScale || dq[1].positionOffset != dq[0].positionOffset ) {
+				b.Fail( "the mesh cache changed the dequantize transform" );
+			}
+		}
+		var->Set( saved.c_str() );
+	}
+	Benchmark ObjModelQuantizedBench( "obj/model_quantized", ObjModelQuantized );
+	
+	// Torus of n by n / 2 quads with its triangles shuffled, the way some
+	// exporters leave them.  Texcoord s holds each vertex's first index.
+	void ShuffledTorus( int n, ObjMesh & mesh ) {
+		int m = n / 2;
+		mesh = ObjMesh();
+		mesh.varying = Varying_PositionBit | Varying_TexCoord0Bit;
+		for( int j = 0; j < m; j++ ) {
+			for( int i = 0; i < n; i++ ) {
+				float u = 2.0f * R3_PI * i / n;
+				float v = 2.0f * R3_PI * j / m;
+				float r = 1.0f + 0.3f * cosf( v );
+				float vert[] = { r * cosf( u ), r * sinf( u ), 0.3f * sinf( v ), float( j * n + i ), 0.0f };
+				mesh.vertices.insert( mesh.vertices.end(), vert, vert + 5 );
+			}
+		}
+		vector< uint > tris;
+		for( int j = 0; j < m; j++ ) {
+			for( int i = 0; i < n; i++ ) {
+				uint a = j * n + i;
+				uint b = j * n + ( i + 1 ) % n;
+				uint c = ( ( j + 1 ) % m ) * n + ( i + 1 ) % n;
+				uint d = ( ( j + 1 ) % m ) * n + i;
+				uint quad[] = { a, b, c, a, c, d };
+				mesh.indices.insert( mesh.indices.end(), quad, quad + 6 );
+			}
+		}
+		uint seed = 7;
+		int numTris = (int)mesh.indices.size() / 3;
+		for( int t = numTris - 1; t > 0; t-- ) {
+			int o = BenchRandom( seed ) % ( t + 1 );
+			for( int k = 0; k < 3; k++ ) {
+				swap( mesh.indices[ t * 3 + k ], mesh.indices[ o * 3 + k ] );
+			}
+		}
+	}
+	
+	// The mesh's triangles by original vertex, each rotated to start at its
+	// smallest, and sorted, so reorderings that keep every triangle and its
+	// winding compare equal.
+	vector< uint > TorusTriangles( const ObjMesh & mesh ) {
+		vector< uint > tris( mesh.indices.size() );
+		vector< uint > sorted;
+		for( int t = 0; t < (int)tris.size(); t += 3 ) {
+			uint id[3];
+			for( int k = 0; k < 3; k++ ) {
+				id[ k ] = uint( mesh.vertices[ mesh.indices[ t + k ] * 5 + 3 ] );
+			}
+			int r = id[1] < id[0] ? ( id[2] < id[1] ? 2 : 1 ) : ( id[2] < id[0] ? 2 : 0 );
+			for( int k = 0; k < 3; k++ ) {
+				tris[ t + k ] = id[ ( r + k ) % 3 ];
+			}
+		}
+		// sort whole triangles, as 3 index keys
+		vector< pair< pair< uint, uint >, uint > > keys( tris.size() / 3 );
+		for( int t = 0; t < (int)keys.size(); t++ ) {
+			keys[ t ] = make_pair( make_pair( tris[ t * 3 ], tris[ t * 3 + 1 ] ), tris[ t * 3 + 2 ] );
+		}
+		sort( keys.begin(), keys.end() );
+		for( int t = 0; t < (int)keys.size(); t++ ) {
+			sorted.push_back( keys[ t ].first.first );
+			sorted.push_back( keys[ t ].first.second );
+			sorted.push_back( keys[ t ].second );
+		}
+		return sorted;
+	}
+	
+	// The import time reordering on a shuffled torus, with the simulated
+	// vertex cache before and after.  Every triangle must survive, and
+	// vertexes must be numbered in the order the indexes first use them.
+	void MeshOptimize( BenchState & b, bool overdraw ) {
+		ObjMesh src;
+		ShuffledTorus( 256, src );
+		ObjMesh mesh;
+		VertexCacheStats before, after;
+		while( b.Loop() ) {
+			mesh = src;
+			OptimizeObjMesh( mesh, overdraw, &before, &after );
+		}
+		uint next = 0;
+		for( int i = 0; i < (int)mesh.indices.size() && next != ~0u; i++ ) {
+			next = mesh.indices[ i ] < next ? next : mesh.indices[ i ] == next ? next + 1 : ~0u;
+		}
+		if( next == ~0u ) {
+			b.Fail( "vertexes are not in first use order" );
+		} else if( TorusTriangles( mesh ) != TorusTriangles( src ) ) {
+			b.Fail( "the reordered torus has different triangles" );
+		} else if( after.acmr >= before.acmr ) {
+			b.Fail( "acmr went from %f to %f", before.acmr, after.acmr );
+		}
+		b.SetItems( src.indices.size() / 3 );
+		b.SetCounter( "acmr_before", before.acmr );
+		b.SetCounter( "acmr_after", after.acmr );
+		b.SetCounter( "atvr_before", before.atvr );
+		b.SetCounter( "atvr_after", after.atvr );
+	}
+	void MeshOptimizeVertexCache( BenchState & b ) {
+		MeshOptimize( b, false );
+	}
+	void MeshOptimizeOverdraw( BenchState & b ) {
+		MeshOptimize( b, true );
+	}
+	Benchmark MeshOptimizeVertexCacheBench( "mesh/optimize", MeshOptimizeVertexCache );
+	Benchmark MeshOptimizeOverdrawBench( "mesh/optimize_overdraw", MeshOptimizeOverdraw );
+	
+	// Textured torus of n by n / 2 quads, with the usual seams where the
+	// texture wraps: the last column and row of vertexes share positions
+	// with the first, but not texcoords.
+	void SeamTorus( int n, ObjMesh & mesh ) {
+		int m = n / 2;
+		mesh = ObjMesh();
+		mesh.varying = Varying_PositionBit | Varying_TexCoord0Bit;
+		for( int j = 0; j <= m; j++ ) {
+			for( int i = 0; i <= n; i++ ) {
+				float u = 2.0f * R3_PI * ( i % n ) / n;
+				float v = 2.0f * R3_PI * ( j % m ) / m;
+				float r = 1.0f + 0.3f * cosf( v );
+				float vert[] = { r * cosf( u ), r * sinf( u ), 0.3f * sinf( v ), float( i ) / n, float( j ) / m };
+				mesh.vertices.insert( mesh.vertices.end(), vert, vert + 5 );
+			}
+		}
+		for( int j = 0; j < m; j++ ) {
+			for( int i = 0; i < n; i++ ) {
+				uint a = j * ( n + 1 ) + i;
+				uint d = a + n + 1;
+				uint quad[] = { a, a + 1, d + 1, a, d + 1, d };
+				mesh.indices.insert( mesh.indices.end(), quad, quad + 6 );
+			}
+		}
+	}
+	
+	// Four levels of detail, half the triangles each, for a seamed torus
+	// on threads threads.  Every level must meet its budget with growing
+	// error, keep every seam vertex, and match what one thread builds,
+	// and SelectLod must get coarser as the torus gets smaller on screen.
+	// A flat grid of n by n quads with its vertexes pushed about within
+	// the plane, so every collapse inside costs nothing, those along the
+	// ragged border cost something, and many turn a triangle over.
+	void JitteredFlatGrid( int n, vector< float > & positions, vector< uint > & indexes ) {
+		positions.clear();
+		indexes.clear();
+		uint seed = 7919;
+		for( int j = 0; j <= n; j++ ) {
+			for( int i = 0; i <= n; i++ ) {
+				positions.push_back( i + ( ( BenchRandom( seed ) % 1000 ) / 1000.0f - 0.5f ) * 0.4f );
+				positions.push_back( j + ( ( BenchRandom( seed ) % 1000 ) / 1000.0f - 0.5f ) * 0.4f );
+				positions.push_back( 0.0f );
+			}
+		}
+		for( int j = 0; j < n; j++ ) {
+			for( int i = 0; i < n; i++ ) {
+				uint a = j * ( n + 1 ) + i;
+				uint quad[] = { a, a + 1, a + n + 2, a, a + n + 2, a + n + 1 };
+				indexes.insert( indexes.end(), quad, quad + 6 );
+			}
+		}
+	}
+	
+	// Closed torus of n by n / 2 quads with no seams and a randomly
+	// bumpy tube.
+	void BumpyTorus( int n, vector< float > & positions, vector< uint > & indexes ) {
+		int m = n / 2;
+		positions.clear();
+		indexes.clear();
+		uint seed = 104729;
+		for( int j = 0; j < m; j++ ) {
+			for( int i = 0; i < n; i++ ) {
+				float u = 2.0f * R3_PI * i / n;
+				float v = 2.0f * R3_PI * j / m;
+				float tube = 0.4f + ( BenchRandom( seed ) % 1000 ) / 10000.0f;
+				float r = 1.0f + tube * cosf( v );
+				positions.push_back( r * cosf( u ) );
+				positions.push_back( r * sinf( u ) );
+				positions.push_back( tube * sinf( v ) );
+			}
+		}
+		for( int j = 0; j < m; j++ ) {
+			for( int i = 0; i < n; i++ ) {
+				uint a = j * n + i;
+				uint b = j * n + ( i + 1 ) % n;
+				uint c = ( ( j + 1 ) % m ) * n + ( i + 1 ) % n;
+				uint d = ( ( j + 1 ) % m ) * n + i;
+				uint quad[] = { a, b, c, a, c, d };
+				indexes.insert( indexes.end(), quad, quad + 6 );
+			}
+		}
+	}
+	
+	// Edges not used exactly once each way, so a closed mesh has none.
+	int NonManifoldEdges( const uint * indexes, int numIndexes ) {
+		vector< pair< uint, uint > > edges;
+		for( int i = 0; i < numIndexes; i++ ) {
+			edges.push_back( make_pair( indexes[ i ], indexes[ i - i % 3 + ( i + 1 ) % 3 ] ) );
+		}
+		sort( edges.begin(), edges.end() );
+		int bad = 0;
+		for( int i = 0; i < (int)edges.size(); i++ ) {
+			pair< uint, uint > e = edges[ i ];
+			bool twice = i > 0 && edges[ i - 1 ] == e;
+			pair< uint, uint > back( e.second, e.first );
+			int across = int( upper_bound( edges.begin(), edges.end(), back ) - lower_bound( edges.begin(), edges.end(), back ) );
+			bad += twice || across != 1;
+		}
+		return bad;
+	}
+	
+	void MeshLodChain( BenchState & b, int threads ) {
+		const int n = 256;
+		const int numLods = 4;
+		ObjMesh src;
+		SeamTorus( n, src );
+		ObjMesh serial = src;
+		BuildObjLods( serial, numLods, 0.5f, 1 );
+		ObjMesh mesh;
+		while( b.Loop() ) {
+			mesh = src;
+			BuildObjLods( mesh, numLods, 0.5f, threads );
+		}
+		b.SetItems( src.indices.size() / 3 );
+		
+		// Where the cheap collapses are free and all turn something over,
+		// the passes must look past them and finish.
+		vector< float > flat;
+		vector< uint > flatIndexes;
+		JitteredFlatGrid( 17, flat, flatIndexes );
+		const int flatTarget = 96;
+		int flatCount = SimplifyMesh( &flatIndexes[0], (int)flatIndexes.size(), &flat[0], 3 * sizeof( float ), (int)flat.size() / 3, flatTarget );
+		if( flatCount > flatTarget ) {
+			b.Fail( "the flat grid stopped at %d indexes, over its %d", flatCount, flatTarget );
+		}
+		
+		// A closed surface taken down to a handful of triangles must stay
+		// closed, every edge between exactly two of them.
+		vector< float > ring;
+		vector< uint > ringIndexes;
+		BumpyTorus( 16, ring, ringIndexes );
+		for( int target = 6; target <= 120; target += 6 ) {
+			vector< uint > ix = ringIndexes;
+			int count = SimplifyMesh( &ix[0], (int)ix.size(), &ring[0], 3 * sizeof( float ), (int)ring.size() / 3, target );
+			if( int bad = NonManifoldEdges( &ix[0], count ) ) {
+				b.Fail( "the torus simplified to %d indexes has %d edges not between two triangles", count, bad );
+				break;
+			}
+		}
+		
+		if( mesh.lods.size() != numLods ) {
+			b.Fail( "built %d of %d levels of detail", (int)mesh.lods.size(), numLods );
+			return;
+		}
+		if( mesh.indices != serial.indices || SameLods( mesh.lods, serial.lods ) == false ) {
+			b.Fail( "%d threads built different levels than 1 thread", threads );
+		}
+		int m = n / 2;
+		int target = (int)src.indices.size() / 3;
+		for( int l = 1; l < numLods; l++ ) {
+			const MeshLod & lod = mesh.lods[ l ];
+			target /= 2;
+			if( lod.numIndexes / 3 > target ) {
+				b.Fail( "level %d has %d triangles, over its %d", l, lod.numIndexes / 3, target );
+			} else if( lod.error < mesh.lods[ l - 1 ].error ) {
+				b.Fail( "level %d error %f is under level %d's %f", l, lod.error, l - 1, mesh.lods[ l - 1 ].error );
+			}
+			vector< bool > used( src.vertices.size() / 5, false );
+			for( int i = 0; i < lod.numIndexes; i++ ) {
+				used[ mesh.indices[ lod.firstIndex + i ] ] = true;
+			}
+			// both ends of every row, and all of the first and last rows
+			vector< int > seams;
+			for( int j = 0; j <= m; j++ ) {
+				seams.push_back( j * ( n + 1 ) );
+				seams.push_back( j * ( n + 1 ) + n );
+			}
+			for( int i = 0; i <= n; i++ ) {
+				seams.push_back( i );
+				seams.push_back( m * ( n + 1 ) + i );
+			}
+			for( int i = 0; i < (int)seams.size(); i++ ) {
+				if( used[ seams[ i ] ] == false ) {
+					b.Fail( "level %d lost seam vertex %d", l, seams[ i ] );
+					break;
+				}
+			}
+			char name[32];
+			r3Sprintf( name, "lod%d_tris", l );
+			b.SetCounter( name, lod.numIndexes / 3 );
+			r3Sprintf( name, "lod%d_error", l );
+			b.SetCounter( name, lod.error );
+		}
+		
+		ModelScope scope;
+		Model * model = new Model( "benchlod" );
+		Bounds3f bounds;
+		for( int i = 0; i < (int)src.vertices.size(); i += 5 ) {
+			bounds.Add( Vec3f( &src.vertices[ i ] ) );
+		}
+		model->SetBounds( bounds );
+		model->SetLods( mesh.lods );
+		int last = 0;
+		for( float distance = 1.0f; distance < 1e5f; distance *= 2.0f ) {
+			int l = model->SelectLod( ProjectedSize( bounds, distance, 60.0f, 1080.0f ) );
+			if( l < last ) {
+				b.Fail( "SelectLod went from %d to %d at distance %f", last, l, distance );
+			}
+			last = l;
+		}
+		// no level but the full one is exact
+		if( model->SelectLod( ProjectedSize( bounds, 1.0f, 60.0f, 1080.0f ), 0.0f ) != 0 || last != numLods - 1 ) {
+			b.Fail( "SelectLod never picked the %s level", last != numLods - 1 ? "coarsest" : "full" );
+		}
+		delete model;
+	}
+	void MeshLodChain1( BenchState & b ) {
+		MeshLodChain( b, 1 );
+	}
+	void MeshLodChain4( BenchState & b ) {
+		MeshLodChain( b, 4 );
+	}
+	Benchmark MeshLodChain1Bench( "mesh/lod_chain_1", MeshLodChain1 );
+	Benchmark MeshLodChain4Bench( "mesh/lod_chain_4", MeshLodChain4 );
+	
+	// Torus vertexes with positions, normals, and texcoords that tile
+	// the texture four times around.
+	void NormalTorus( int n, ObjMesh & mesh ) {
+		int m = n / 2;
+		mesh = ObjMesh();
+		mesh.varying = Varying_PositionBit | Varying_NormalBit | Varying_TexCoord0Bit;
+		for( int j = 0; j <= m; j++ ) {
+			for( int i = 0; i <= n; i++ ) {
+				float u = 2.0f * R3_PI * i / n;
+				float v = 2.0f * R3_PI * j / m;
+				float r = 1.0f + 0.3f * cosf( v );
+				float vert[] = { r * cosf( u ), r * sinf( u ), 0.3f * sinf( v ),
+				                 cosf( v ) * cosf( u ), cosf( v ) * sinf( u ), sinf( v ),
+				                 4.0f * i / n, 2.0f * j / m };
+				mesh.vertices.insert( mesh.vertices.end(), vert, vert + 8 );
+			}
+		}
+	}
+	
+	// Packing a torus's vertexes.  Every half must survive the trip
+	// through float, and the torus must come back with positions within
+	// half a step of the bounds' 16 bit grid, normals within 1.5 degrees,
+	// and texcoords within half a step of theirs.
+	void MeshQuantize( BenchState & b, QuantizeTexCoordEnum texCoords ) {
+		for( uint h = 0; h < 0x10000; h++ ) {
+			bool nan = ( h & 0x7c00 ) == 0x7c00 && ( h & 0x3ff );
+			if( nan == false && FloatToHalf( HalfToFloat( ushort( h ) ) ) != h ) {
+				b.Fail( "half 0x%04x came back as 0x%04x", h, FloatToHalf( HalfToFloat( ushort( h ) ) ) );
+				return;
+			}
+		}
+		ObjMesh mesh;
+		NormalTorus( 256, mesh );
+		int numVertexes = (int)mesh.vertices.size() / 8;
+		QuantizedLayout layout = GetQuantizedLayout( mesh.varying, texCoords );
+		vector< uchar > packed;
+		Dequantize dq;
+		while( b.Loop() ) {
+			QuantizeVertexes( &mesh.vertices[0], mesh.varying, numVertexes, layout, packed, dq );
+		}
+		b.SetItems( numVertexes );
+		b.SetBytes( mesh.vertices.size() * sizeof( float ) );
+		b.SetCounter( "bytes_per_vertex_float", 8 * sizeof( float ) );
+		b.SetCounter( "bytes_per_vertex", layout.stride );
+		
+		vector< float > back( mesh.vertices.size() );
+		DequantizeVertexes( &packed[0], mesh.varying, numVertexes, layout, dq, &back[0] );
+		float positionError = 0, normalDegrees = 0, texCoordError = 0;
+		for( int i = 0; i < numVertexes; i++ ) {
+			const float * v = &mesh.vertices[ i * 8 ];
+			const float * w = &back[ i * 8 ];
+			for( int k = 0; k < 3; k++ ) {
+				positionError = max( positionError, fabsf( v[ k ] - w[ k ] ) / dq.positionScale[ k ] );
+			}
+			float dot = v[3] * w[3] + v[4] * w[4] + v[5] * w[5];
+			normalDegrees = max( normalDegrees, ToDegrees( acosf( min( dot, 1.0f ) ) ) );
+			for( int k = 0; k < 2; k++ ) {
+				float step = texCoords == QuantizeTexCoord_Unorm16 ? dq.texCoordScale[ k ] : fabsf( v[ 6 + k ] ) / 1024.0f;
+				texCoordError = max( texCoordError, step > 0 ? fabsf( v[ 6 + k ] - w[ 6 + k ] ) / step : 0.0f );
+			}
+		}
+		// as fractions of a step
+		positionError *= 65535.0f;
+		if( texCoords == QuantizeTexCoord_Unorm16 ) {
+			texCoordError *= 65535.0f;
+		}
+		if( positionError > 0.51f || normalDegrees > 1.5f || texCoordError > 0.51f ) {
+			b.Fail( "errors of %f position steps, %f degrees of normal and %f texcoord steps", positionError, normalDegrees, texCoordError );
+		}
+		b.SetCounter( "position_error_steps", positionError );
+		b.SetCounter( "normal_error_degrees", normalDegrees );
+		b.SetCounter( "texcoord_error_steps", texCoordError );
+	}
+	void MeshQuantizeHalf( BenchState & b ) {
+		MeshQuantize( b, QuantizeTexCoord_Half );
+	}
+	void MeshQuantizeUnorm16( BenchState & b ) {
+		MeshQuantize( b, QuantizeTexCoord_Unorm16 );
+	}
+	Benchmark MeshQuantizeHalfBench( "mesh/quantize_half", MeshQuantizeHalf );
+	Benchmark MeshQuantizeUnorm16Bench( "mesh/quantize_unorm16", MeshQuantizeUnorm16 );
+	
+	// The software path back to floats, which must give the same
+	// vertexes every time.
+	void MeshDequantize( BenchState & b, QuantizeTexCoordEnum texCoords ) {
+		ObjMesh mesh;
+		NormalTorus( 256, mesh );
+		int numVertexes = (int)mesh.vertices.size() / 8;
+		QuantizedLayout layout = GetQuantizedLayout( mesh.varying, texCoords );
+		vector< uchar > packed;
+		Dequantize dq;
+		QuantizeVertexes( &mesh.vertices[0], mesh.varying, numVertexes, layout, packed, dq );
+		vector< float > first( mesh.vertices.size() );
+		DequantizeVertexes( &packed[0], mesh.varying, numVertexes, layout, dq, &first[0] );
+		vector< float > back( mesh.vertices.size() );
+		while( b.Loop() ) {
+			DequantizeVertexes( &packed[0], mesh.varying, numVertexes, layout, dq, &back[0] );
+		}
+		if( back != first ) {
+			b.Fail( "dequantizing twice gave different vertexes" );
+		}
+		b.SetItems( numVertexes );
+		b.SetBytes( packed.size() );
+	}
+	void MeshDequantizeHalf( BenchState & b ) {
+		MeshDequantize( b, QuantizeTexCoord_Half );
+	}
+	void MeshDequantizeUnorm16( BenchState & b ) {
+		MeshDequantize( b, QuantizeTexCoord_Unorm16 );
+	}
+	Benchmark MeshDequantizeHalfBench( "mesh/dequantize_half", MeshDequantizeHalf );
+	Benchmark MeshDequantizeUnorm16Bench( "mesh/dequantize_unorm16", MeshDequantizeUnorm16 );
+	
+	const int HttpBodySize = 64 * 1024;
+	
+	// Minimal http server that answers every request with the same body.
+	struct LoopbackServer : public Thread {
+		LoopbackServer() : Thread( "BenchHttp" ), port( 0 ) {}
+		Listener listener;
+		int port;
+		string response;
+		
+		bool Listen() {
+			for( int p = 28080; p < 28180; p++ ) {
+				if( listener.Listen( p ) ) {
+					port = p;
+					break;
+				}
+			}
+			if( port == 0 ) {
+				return false;
+			}
+			string body( HttpBodySize, ' ' );
+			for( int i = 0; i < HttpBodySize; i++ ) {
+				body[ i ] = char( 'a' + i % 26 );
+			}
+			char header[256];
+			r3Sprintf( header, "HTTP/1.1 200 OK\r\nContent-Type: application/octet-stream\r\nContent-Length: %d\r\nConnection: close\r\n\r\n", HttpBodySize );
+			response = header + body;
+			Start();
+			return true;
+		}
+		
+		virtual void Run() {
+			for( ;; ) {
+				Socket s = listener.Accept();
+				if( s.Invalid() ) {
+					continue;
+				}
+				string request;
+				char buf[1024];
+				while( request.find( "\r\n\r\n" ) == string::npos ) {
+					int r = s.ReadPartial( buf, sizeof( buf ) );
+					if( r < 0 ) {
+						break;
+					}
+					request.append( buf, r );
+				}
+				s.Write( response.c_str(), (uint)response.size() );
+				s.Close();
+			}
+		}
+	};
+	LoopbackServer server;
+	
+	void HttpLoopback( BenchState & b ) {
+		if( server.port == 0 && server.Listen() == false ) {
+			b.Fail( "unable to listen for loopback http" );
+			return;
+		}
+		char url[64];
+		r3Sprintf( url, "http://127.0.0.1:%d/bench.bin", server.port );
+		vector< uchar > data;
+		while( b.Loop() ) {
+			if( UrlReadToMemory( url, data ) == false ) {
+				b.Fail( "unable to fetch %s", url );
+			}
+		}
+		if( (int)data.size() != HttpBodySize || data[ 27 ] != 'b' ) {
+			b.Fail( "fetched %d bytes, expected %d", (int)data.size(), HttpBodySize );
+		}
+		b.SetBytes( HttpBodySize );
+	}
+	Benchmark HttpLoopbackBench( "http/loopback", HttpLoopback );
+	
+}
@@ -0,0 +1,394 @@
+/*
+ *  bench
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+// Runs the registered benchmarks and writes their results as JSON, so runs
+// of different revisions on the same machine can be compared.
+//   r3bench [-list] [-filter <substring>] [-mintime <seconds>] [-repeat <n>] [-out <file.json>] [-set <var> <value>]
+
+#include "bench.h"
+
+#include "r3/command.h"
+#include "r3/filesystem.h"
+#include "r3/output.h"
+#include "r3/time.h"
+#include "r3/timer.h"
+#include "r3/ujson.h"
+#include "r3/var.h"
+
+#include <ftw.h>
+#include <sys/stat.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#ifndef R3_BENCH_REVISION
+# define R3_BENCH_REVISION "unknown"
+#endif
+
+using namespace std;
+using namespace r3;
+
+namespace r3 {
+	extern VarString f_basePath;
+	extern VarString f_cachePath;
+}
+
+namespace {
+	
+	// We have to do this to have static initialization of benchmarks work.
+	struct Benchmarks {
+		vector< Benchmark * > list;
+	};
+	Benchmarks * benchmarks = NULL;
+	
+	void InitBenchmarks() {
+		if( benchmarks == NULL ) {
+			benchmarks = new Benchmarks;
+		}
+	}
+	
+	string scratchPath;
+	string basePath;
+	
+	struct BenchResult {
+		string name;
+		int64 iterations;
+		vector< double > nsPerOp;
+		int64 bytes;
+		int64 items;
+		map< string, double > counters;
+		string error;
+		string skipped;
+	};
+	
+	// Runs the benchmark once for the given number of iterations.
+	bool RunTrial( Benchmark * bm, int64 iterations, BenchResult & res, double & seconds ) {
+		BenchState b( iterations );
+		bm->func( b );
+		res.bytes = b.bytes;
+		res.items = b.items;
+		res.counters = b.counters;
+		if( b.error.size() ) {
+			res.error = b.error;
+			return false;
+		}
+		if( b.skipped.size() ) {
+			res.skipped = b.skipped;
+			return false;
+		}
+		seconds = b.ElapsedNanoseconds() * 1e-9;
+		res.nsPerOp.push_back( double( b.ElapsedNanoseconds() ) / iterations );
+		return true;
+	}
+	
+	// Grows the iteration count until a trial takes minTime, then runs the
+	// measured trials at that count.
+	void RunBenchmark( Benchmark * bm, double minTime, int repeat, BenchResult & res ) {
+		res.name = bm->name;
+		int64 n = 1;
+		double seconds = 0.0;
+		while( true ) {
+			if( RunTrial( bm, n, res, seconds ) == false ) {
+				return;
+			}
+			if( seconds >= minTime || n >= ( int64( 1 ) << 40 ) ) {
+				break;
+			}
+			double scale = seconds > 0.0 ? 1.4 * minTime / seconds : 10.0;
+			scale = max( 2.0, min( 10.0, scale ) );
+			n = int64( n * scale );
+		}
+		res.iterations = n;
+		res.nsPerOp.clear();
+		for( int i = 0; i < repeat; i++ ) {
+			if( RunTrial( bm, n, res, seconds ) == false ) {
+				return;
+			}
+		}
+	}
+	
+	void AddNumber( ujson::Json * obj, const char * key, double val ) {
+		obj->Add( key, new ujson::Json( val ) );
+	}
+	
+	ujson::Json * ResultToJson( const BenchResult & res ) {
+		ujson::Json * j = new ujson::Json( ujson::Type_Object );
+		j->Add( "name", new ujson::Json( res.name ) );
+		j->Add( "ok", new ujson::Json( res.error.size() == 0 ) );
+		if( res.error.size() ) {
+			j->Add( "error", new ujson::Json( res.error ) );
+			return j;
+		}
+		if( res.skipped.size() ) {
+			j->Add( "skipped", new ujson::Json( res.skipped ) );
+			return j;
+		}
+		vector< double > t = res.nsPerOp;
+		sort( t.begin(), t.end() );
+		double median = t[ t.size() / 2 ];
+		AddNumber( j, "iterations", double( res.iterations ) );
+		AddNumber( j, "trials", double( t.size() ) );
+		ujson::Json * ns = new ujson::Json( ujson::Type_Object );
+		AddNumber( ns, "median", median );
+		AddNumber( ns, "min", t.front() );
+		AddNumber( ns, "max", t.back() );
+		j->Add( "nsPerOp", ns );
+		if( res.bytes ) {
+			AddNumber( j, "bytesPerSecond", res.bytes * 1e9 / median );
+		}
+		if( res.items ) {
+			AddNumber( j, "itemsPerSecond", res.items * 1e9 / median );
+		}
+		if( res.counters.size() ) {
+			ujson::Json * c = new ujson::Json( ujson::Type_Object );
+			for( map< string, double >::const_iterator it = res.counters.begin(); it != res.counters.end(); ++it ) {
+				AddNumber( c, it->first.c_str(), it->second );
+			}
+			j->Add( "counters", c );
+		}
+		return j;
+	}
+	
+	void PrintResult( const BenchResult & res ) {
+		if( res.error.size() ) {
+			Output( "%-32s FAILED: %s", res.name.c_str(), res.error.c_str() );
+			return;
+		}
+		if( res.skipped.size() ) {
+			Output( "%-32s skipped: %s", res.name.c_str(), res.skipped.c_str() );
+			return;
+		}
+		vector< double > t = res.nsPerOp;
+		sort( t.begin(), t.end() );
+		double median = t[ t.size() / 2 ];
+		char rate[64] = "";
+		if( res.bytes ) {
+			r3Sprintf( rate, "%10.1f MB/s", res.bytes * 1e3 / median );
+		} else if( res.items ) {
+			r3Sprintf( rate, "%10.3f M/s", res.items * 1e3 / median );
+		}
+		Output( "%-32s %14.1f ns/op %s", res.name.c_str(), median, rate );
+	}
+	
+	int RemoveEntry( const char * path, const struct stat * sb, int flag, struct FTW * ftw ) {
+		return remove( path );
+	}
+	
+	bool MakeScratch() {
+		char tmpl[] = "/tmp/r3bench.XXXXXX";
+		if( mkdtemp( tmpl ) == NULL ) {
+			return false;
+		}
+		scratchPath = tmpl;
+		basePath = scratchPath + "/base/";
+		string cachePath = scratchPath + "/cache/";
+		if( mkdir( basePath.c_str(), 0755 ) != 0 ) {
+			return false;
+		}
+		f_basePath.SetVal( basePath );
+		f_cachePath.SetVal( cachePath );
+		return true;
+	}
+	
+}
+
+namespace r3 {
+	
+	BenchState::BenchState( int64 iters )
+	: iterations( iters ), done( 0 ), begin( 0 ), end( 0 ), bytes( 0 ), items( 0 ) {
+	}
+	
+	bool BenchState::Loop() {
+		if( done == 0 ) {
+			StartTimer();
+		}
+		if( done < iterations && error.size() == 0 && skipped.size() == 0 ) {
+			done++;
+			return true;
+		}
+		StopTimer();
+		return false;
+	}
+	
+	void BenchState::StartTimer() {
+		begin = GetMonotonicNanoseconds();
+	}
+	
+	void BenchState::StopTimer() {
+		end = GetMonotonicNanoseconds();
+	}
+	
+	void BenchState::Fail( const char * fmt, ... ) {
+		char str[1024];
+		va_list args;
+		va_start( args, fmt );
+		vsnprintf( str, sizeof( str ), fmt, args );
+		va_end( args );
+		if( error.size() == 0 ) {
+			error = str;
+		}
+	}
+	
+	void BenchState::Skip( const char * fmt, ... ) {
+		char str[1024];
+		va_list args;
+		va_start( args, fmt );
+		vsnprintf( str, sizeof( str ), fmt, args );
+		va_end( args );
+		skipped = str;
+	}
+	
+	Benchmark::Benchmark( const char * benchName, void (*benchFunc)( BenchState & b ) )
+	: name( benchName ), func( benchFunc ) {
+		InitBenchmarks();
+		benchmarks->list.push_back( this );
+	}
+	
+	void BenchNullOutput( const char * msg ) {
+	}
+	
+	void BenchStderrOutput( const char * msg ) {
+		fprintf( stderr, "%s\n", msg );
+	}
+	
+}
+
+int main( int argc, char **argv ) {
+	const char * filter = "";
+	const char * outFile = NULL;
+	double minTime = 0.1;
+	int repeat = 5;
+	bool list = false;
+	vector< string > sets;
+	for( int i = 1; i < argc; i++ ) {
+		if( strcmp( argv[ i ], "-list" ) == 0 ) {
+			list = true;
+		} else if( strcmp( argv[ i ], "-filter" ) == 0 && i + 1 < argc ) {
+			filter = argv[ ++i ];
+		} else if( strcmp( argv[ i ], "-out" ) == 0 && i + 1 < argc ) {
+			outFile = argv[ ++i ];
+		} else if( strcmp( argv[ i ], "-mintime" ) == 0 && i + 1 < argc ) {
+			minTime = atof( argv[ ++i ] );
+		} else if( strcmp( argv[ i ], "-repeat" ) == 0 && i + 1 < argc ) {
+			repeat = max( 1, atoi( argv[ ++i ] ) );
+		} else if( strcmp( argv[ i ], "-set" ) == 0 && i + 2 < argc ) {
+			sets.push_back( string( "set " ) + argv[ i + 1 ] + " \"" + argv[ i + 2 ] + "\"" );
+			i += 2;
+		} else {
+			fprintf( stderr, "usage: %s [-list] [-filter <substring>] [-mintime <seconds>] [-repeat <n>] [-out <file.json>] [-set <var> <value>]\n", argv[ 0 ] );
+			return 1;
+		}
+	}
+	InitBenchmarks();
+	if( list ) {
+		for( int i = 0; i < (int)benchmarks->list.size(); i++ ) {
+			printf( "%s\n", benchmarks->list[ i ]->name );
+		}
+		return 0;
+	}
+	
+	if( MakeScratch() == false ) {
+		fprintf( stderr, "unable to create a scratch directory\n" );
+		return 1;
+	}
+	InitTimer();
+	InitFilesystem();
+	for( int i = 0; i < (int)sets.size(); i++ ) {
+		ExecuteCommand( sets[ i ].c_str() );
+	}
+	
+	vector< BenchResult > results;
+	int failed = 0;
+	for( int i = 0; i < (int)benchmarks->list.size(); i++ ) {
+		Benchmark * bm = benchmarks->list[ i ];
+		if( strstr( bm->name, filter ) == NULL ) {
+			continue;
+		}
+		results.push_back( BenchResult() );
+		RunBenchmark( bm, minTime, repeat, results.back() );
+		PrintResult( results.back() );
+		failed += results.back().error.size() ? 1 : 0;
+	}
+	
+	ShutdownFilesystem();
+	ShutdownTimer();
+	FlushOutput();
+	nftw( scratchPath.c_str(), RemoveEntry, 16, FTW_DEPTH | FTW_PHYS );
+	
+	ujson::Json * root = new ujson::Json( ujson::Type_Object );
+	root->Add( "suite", new ujson::Json( "r3bench" ) );
+	AddNumber( root, "format", 1 );
+	root->Add( "revision", new ujson::Json( R3_BENCH_REVISION ) );
+#ifdef __VERSION__
+	root->Add( "compiler", new ujson::Json( __VERSION__ ) );
+#endif
+	AddNumber( root, "cpus", double( sysconf( _SC_NPROCESSORS_ONLN ) ) );
+	AddNumber( root, "timestamp", double( time( NULL ) ) );
+	AddNumber( root, "minTime", minTime );
+	AddNumber( root, "repeat", repeat );
+	ujson::Json * arr = new ujson::Json( ujson::Type_Array );
+	for( int i = 0; i < (int)results.size(); i++ ) {
+		arr->Add( "", ResultToJson( results[ i ] ) );
+	}
+	root->Add( "benchmarks", arr );
+	string str;
+	ujson::Encode( root, true, str );
+	ujson::Delete( root );
+	FILE * fp = outFile ? fopen( outFile, "w" ) : stdout;
+	if( fp == NULL ) {
+		fprintf( stderr, "unable to open %s\n", outFile );
+		return 1;
+	}
+	fprintf( fp, "%s\n", str.c_str() );
+	if( outFile ) {
+		fclose( fp );
+	}
+	return failed ? 1 : 0;
+}
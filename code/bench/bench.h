@@ -0,0 +1,125 @@
+/*
+ *  bench
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#ifndef __R3_BENCH_H__
+#define __R3_BENCH_H__
+
+#include "r3/common.h"
+
+#include <map>
+#include <string>
+
+// Benchmarks register themselves like commands do, and the harness in
+// bench.cpp runs them and writes the results as JSON.  A benchmark function
+// does its setup, then runs the measured work inside while( b.Loop() ).
+// Only the loop is timed, and the harness picks the iteration count.
+
+namespace r3 {
+	
+	class BenchState {
+		int64 iterations;
+		int64 done;
+		uint64 begin;
+		uint64 end;
+	public:
+		BenchState( int64 iters );
+		
+		bool Loop();
+		int64 Iterations() const { return iterations; }
+		// For work that does not fit Loop(), such as spreading Iterations()
+		// items over several threads, time it by hand instead.
+		void StartTimer();
+		void StopTimer();
+		uint64 ElapsedNanoseconds() const { return end - begin; }
+		
+		// per iteration work, reported as throughput
+		void SetBytes( int64 bytesPerIteration ) { bytes = bytesPerIteration; }
+		void SetItems( int64 itemsPerIteration ) { items = itemsPerIteration; }
+		// extra named results, reported from the last trial
+		void SetCounter( const char * name, double value ) { counters[ name ] = value; }
+		// marks the benchmark as failed, for exactness checks
+		void Fail( const char * fmt, ... );
+		// for benchmarks that need something the machine does not have,
+		// call before Loop()
+		void Skip( const char * fmt, ... );
+		
+		int64 bytes;
+		int64 items;
+		std::map< std::string, double > counters;
+		std::string error;
+		std::string skipped;
+	};
+	
+	class Benchmark {
+	public:
+		Benchmark( const char * benchName, void (*benchFunc)( BenchState & b ) );
+		const char * name;
+		void (*func)( BenchState & b );
+	};
+	
+	// keeps the compiler from discarding a result
+#if _MSC_VER
+	template< typename T > inline void BenchKeep( const T & val ) {
+		static const void * volatile sink;
+		sink = &val;
+	}
+#else
+	template< typename T > inline void BenchKeep( const T & val ) {
+		asm volatile( "" : : "r"( &val ) : "memory" );
+	}
+#endif
+	
+	// deterministic pseudo random numbers, so every run sees the same data
+	inline uint BenchRandom( uint & state ) {
+		state = state * 1664525u + 1013904223u;
+		return state >> 8;
+	}
+	
+	// Output function that drops everything, for benchmarks that would
+	// otherwise spam stderr.  BenchStderrOutput restores the usual behavior.
+	void BenchNullOutput( const char * msg );
+	void BenchStderrOutput( const char * msg );
+	
+}
+
+#endif // __R3_BENCH_H__
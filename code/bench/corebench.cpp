@@ -0,0 +1,332 @@
+/*
+ *  corebench
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+// Benchmarks for the small core services: atoms, vars and commands, the
+// tokenizer, JSON, zlib, base64, MD5 and Output filtering.
+
+#include "bench.h"
+
+#include "r3/atom.h"
+#include "r3/command.h"
+#include "r3/md5.h"
+#include "r3/output.h"
+#include "r3/parse.h"
+#include "r3/ubase64.h"
+#include "r3/ujson.h"
+#include "r3/uzlib.h"
+#include "r3/var.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace r3;
+
+VarInteger bench_value( "bench_value", "Scratch var for the var benchmarks.", 0, 0 );
+OutputCategory out_bench( "bench", "Output level for the Output filtering benchmarks, -1 to use out_level." );
+
+namespace {
+	
+	const int NumAtoms = 1024;
+	
+	void AtomNames( vector< string > & names ) {
+		names.resize( NumAtoms );
+		for( int i = 0; i < NumAtoms; i++ ) {
+			char buf[64];
+			r3Sprintf( buf, "bench_atom_%d", i );
+			names[ i ] = buf;
+		}
+	}
+	
+	// Atom( str ) on strings already in the table
+	void AtomIntern( BenchState & b ) {
+		vector< string > names;
+		AtomNames( names );
+		for( int i = 0; i < NumAtoms; i++ ) {
+			Atom a( names[ i ].c_str() );
+		}
+		int i = 0;
+		while( b.Loop() ) {
+			Atom a( names[ i ].c_str() );
+			BenchKeep( a );
+			i = ( i + 1 ) & ( NumAtoms - 1 );
+		}
+		b.SetItems( 1 );
+	}
+	Benchmark AtomInternBench( "atom/intern", AtomIntern );
+	
+	void AtomFind( BenchState & b ) {
+		vector< string > names;
+		AtomNames( names );
+		for( int i = 0; i < NumAtoms; i++ ) {
+			Atom a( names[ i ].c_str() );
+		}
+		int i = 0;
+		while( b.Loop() ) {
+			Atom a = FindAtom( names[ i ].c_str() );
+			BenchKeep( a );
+			i = ( i + 1 ) & ( NumAtoms - 1 );
+		}
+		b.SetItems( 1 );
+	}
+	Benchmark AtomFindBench( "atom/find", AtomFind );
+	
+	void VarFind( BenchState & b ) {
+		while( b.Loop() ) {
+			Var * v = FindVar( "bench_value" );
+			BenchKeep( v );
+		}
+		b.SetItems( 1 );
+	}
+	Benchmark VarFindBench( "var/find", VarFind );
+	
+	// "bench_value 7" goes through the command lookup, the var lookup and set
+	void VarSetCommand( BenchState & b ) {
+		SetOutputFunction( BenchNullOutput );
+		while( b.Loop() ) {
+			ExecuteCommand( "bench_value 7" );
+		}
+		SetOutputFunction( BenchStderrOutput );
+		if( bench_value.GetVal() != 7 ) {
+			b.Fail( "bench_value is %d, not 7", bench_value.GetVal() );
+		}
+		b.SetItems( 1 );
+	}
+	Benchmark VarSetCommandBench( "var/setcommand", VarSetCommand );
+	
+	int nopCalls;
+	void BenchNop( const vector< Token > & tokens ) {
+		nopCalls += (int)tokens.size();
+	}
+	CommandFunc BenchNopCmd( "benchnop", "does nothing, for the command dispatch benchmark", BenchNop );
+	
+	void CommandDispatch( BenchState & b ) {
+		nopCalls = 0;
+		while( b.Loop() ) {
+			ExecuteCommand( "benchnop 1 two 3.5" );
+		}
+		if( nopCalls != 4 * b.Iterations() ) {
+			b.Fail( "benchnop saw %d tokens, expected %lld", nopCalls, 4 * b.Iterations() );
+		}
+		b.SetItems( 1 );
+	}
+	Benchmark CommandDispatchBench( "command/dispatch", CommandDispatch );
+	
+	void Tokenize( BenchState & b ) {
+		const char * line = "f 1021/1022/1023 1024/1025/1026 1027/1028/1029 bind ctrl+q \"quit now\" -3.25e2";
+		while( b.Loop() ) {
+			vector< Token > tokens = TokenizeString( line );
+			BenchKeep( tokens );
+		}
+		b.SetBytes( strlen( line ) );
+	}
+	Benchmark TokenizeBench( "parse/tokenize", Tokenize );
+	
+	// something shaped like the cache manifest
+	string ManifestJson( int entries ) {
+		string s = "{";
+		for( int i = 0; i < entries; i++ ) {
+			char buf[512];
+			r3Sprintf( buf, "%s\n  \"textures/tile_%d.png\": { \"url\": \"http://example.com/data/textures/tile_%d.png\", "
+			          "\"md5\": \"0123456789abcdef0123456789abcdef\", \"etag\": \"%08x\", \"lastTry\": %d }",
+			          i ? "," : "", i, i, i * 2654435761u, 1360000000 + i );
+			s += buf;
+		}
+		s += "\n}\n";
+		return s;
+	}
+	
+	void JsonDecode( BenchState & b ) {
+		string s = ManifestJson( 1000 );
+		while( b.Loop() ) {
+			ujson::Json * j = ujson::Decode( s.c_str(), (int)s.size() );
+			if( j == NULL || j->Size() != 1000 ) {
+				b.Fail( "decoded %d entries, expected 1000", j ? (int)j->Size() : -1 );
+			}
+			ujson::Delete( j );
+		}
+		b.SetBytes( s.size() );
+	}
+	Benchmark JsonDecodeBench( "json/decode", JsonDecode );
+	
+	void JsonEncode( BenchState & b ) {
+		string s = ManifestJson( 1000 );
+		ujson::Json * j = ujson::Decode( s.c_str(), (int)s.size() );
+		string out;
+		while( b.Loop() ) {
+			ujson::Encode( j, true, out );
+		}
+		ujson::Delete( j );
+		b.SetBytes( out.size() );
+	}
+	Benchmark JsonEncodeBench( "json/encode", JsonEncode );
+	
+	// text-like data, so compression ratios are realistic
+	void TextData( vector< char > & data, int size ) {
+		static const char * words[] = { "star", "map", "the", "of", "constellation", "orion", "magnitude", "satellite",
+			"texture", "0.125", "1024", "and", "ra", "dec", "\n", "  ", "{", "}", "\"name\":", "sky" };
+		uint seed = 1;
+		data.clear();
+		while( (int)data.size() < size ) {
+			const char * w = words[ BenchRandom( seed ) % ARRAY_ELEMENTS( words ) ];
+			data.insert( data.end(), w, w + strlen( w ) );
+			data.push_back( ' ' );
+		}
+		data.resize( size );
+	}
+	
+	const int ZlibSize = 1 << 20;
+	
+	void ZlibDeflate( BenchState & b ) {
+		vector< char > data, z;
+		TextData( data, ZlibSize );
+		while( b.Loop() ) {
+			Deflate( z, &data[0], (int)data.size(), 5 );
+		}
+		b.SetBytes( data.size() );
+		b.SetCounter( "ratio", double( data.size() ) / z.size() );
+	}
+	Benchmark ZlibDeflateBench( "zlib/deflate", ZlibDeflate );
+	
+	void ZlibInflate( BenchState & b ) {
+		vector< char > data, z, out;
+		TextData( data, ZlibSize );
+		Deflate( z, &data[0], (int)data.size(), 5 );
+		while( b.Loop() ) {
+			Inflate( out, &z[0], (int)z.size() );
+		}
+		if( out != data ) {
+			b.Fail( "inflate did not round trip" );
+		}
+		b.SetBytes( data.size() );
+	}
+	Benchmark ZlibInflateBench( "zlib/inflate", ZlibInflate );
+	
+	void RandomBytes( vector< byte > & data, int size ) {
+		uint seed = 7;
+		data.resize( size );
+		for( int i = 0; i < size; i++ ) {
+			data[ i ] = byte( BenchRandom( seed ) );
+		}
+	}
+	
+	void Base64Encode( BenchState & b ) {
+		vector< byte > data, enc;
+		RandomBytes( data, 1 << 20 );
+		while( b.Loop() ) {
+			enc.clear();
+			ubase64::Encode( enc, data );
+		}
+		b.SetBytes( data.size() );
+	}
+	Benchmark Base64EncodeBench( "base64/encode", Base64Encode );
+	
+	void Base64Decode( BenchState & b ) {
+		vector< byte > data, enc, dec;
+		RandomBytes( data, 1 << 20 );
+		ubase64::Encode( enc, data );
+		while( b.Loop() ) {
+			dec.clear();
+			ubase64::Decode( dec, enc );
+		}
+		if( dec != data ) {
+			b.Fail( "base64 did not round trip" );
+		}
+		b.SetBytes( data.size() );
+	}
+	Benchmark Base64DecodeBench( "base64/decode", Base64Decode );
+	
+	void Md5( BenchState & b ) {
+		vector< byte > data;
+		RandomBytes( data, 1 << 20 );
+		unsigned char digest[16];
+		while( b.Loop() ) {
+			MD5Context ctx;
+			MD5Init( &ctx );
+			MD5Update( &ctx, &data[0], (unsigned)data.size() );
+			MD5Final( digest, &ctx );
+			BenchKeep( digest );
+		}
+		// known answer, so a broken build does not report a fast hash
+		static const unsigned char abc[16] = { 0x90, 0x01, 0x50, 0x98, 0x3c, 0xd2, 0x4f, 0xb0, 0xd6, 0x96, 0x3f, 0x7d, 0x28, 0xe1, 0x7f, 0x72 };
+		MD5Context ctx;
+		MD5Init( &ctx );
+		MD5Update( &ctx, "abc", 3 );
+		MD5Final( digest, &ctx );
+		if( memcmp( digest, abc, 16 ) ) {
+			b.Fail( "md5( \"abc\" ) is wrong" );
+		}
+		b.SetBytes( data.size() );
+	}
+	Benchmark Md5Bench( "md5/1mb", Md5 );
+	
+	// cost of a log line whose category is turned down
+	void OutputFiltered( BenchState & b ) {
+		out_bench.SetVal( Output_Warning );
+		int i = 0;
+		while( b.Loop() ) {
+			R3_OUTPUT_INFO( out_bench, "loaded %s in %d ms", "textures/tile.png", i++ );
+		}
+		out_bench.SetVal( -1 );
+		b.SetItems( 1 );
+	}
+	Benchmark OutputFilteredBench( "output/filtered", OutputFiltered );
+	
+	// cost of a log line that is formatted, written to a null sink
+	void OutputEmitted( BenchState & b ) {
+		out_bench.SetVal( Output_Info );
+		SetOutputFunction( BenchNullOutput );
+		int i = 0;
+		while( b.Loop() ) {
+			R3_OUTPUT_INFO( out_bench, "loaded %s in %d ms", "textures/tile.png", i++ );
+		}
+		SetOutputFunction( BenchStderrOutput );
+		out_bench.SetVal( -1 );
+		b.SetItems( 1 );
+	}
+	Benchmark OutputEmittedBench( "output/emitted", OutputEmitted );
+	
+}
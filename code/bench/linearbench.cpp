@@ -0,0 +1,526 @@
+/*
+ *  linearbench
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#include "bench.h"
+
+#include "r3/batch.h"
+#include "r3/bounds.h"
+#include "r3/linear.h"
+
+#include <math.h>
+#include <string.h>
+
+#include <vector>
+
+using namespace std;
+using namespace r3;
+
+namespace {
+	
+	// Float arithmetic in a type linear.h has no SIMD code for, so
+	// Matrix4< ScalarFloat > runs the generic templates.  It is the
+	// scalar reference, and the baseline for the timings.
+	struct ScalarFloat {
+		ScalarFloat() : f( 0 ) {}
+		ScalarFloat( int i ) : f( float( i ) ) {}
+		ScalarFloat( float f_ ) : f( f_ ) {}
+		ScalarFloat( double d ) : f( float( d ) ) {}
+		ScalarFloat & operator += ( ScalarFloat b ) { f += b.f; return *this; }
+		ScalarFloat & operator -= ( ScalarFloat b ) { f -= b.f; return *this; }
+		ScalarFloat & operator *= ( ScalarFloat b ) { f *= b.f; return *this; }
+		ScalarFloat & operator /= ( ScalarFloat b ) { f /= b.f; return *this; }
+		float f;
+	};
+	
+	inline ScalarFloat operator + ( ScalarFloat a, ScalarFloat b ) { return ScalarFloat( a.f + b.f ); }
+	inline ScalarFloat operator - ( ScalarFloat a, ScalarFloat b ) { return ScalarFloat( a.f - b.f ); }
+	inline ScalarFloat operator * ( ScalarFloat a, ScalarFloat b ) { return ScalarFloat( a.f * b.f ); }
+	inline ScalarFloat operator / ( ScalarFloat a, ScalarFloat b ) { return ScalarFloat( a.f / b.f ); }
+	inline ScalarFloat operator - ( ScalarFloat a ) { return ScalarFloat( -a.f ); }
+	inline bool operator == ( ScalarFloat a, ScalarFloat b ) { return a.f == b.f; }
+	inline bool operator != ( ScalarFloat a, ScalarFloat b ) { return a.f != b.f; }
+	inline bool operator < ( ScalarFloat a, ScalarFloat b ) { return a.f < b.f; }
+	inline bool operator > ( ScalarFloat a, ScalarFloat b ) { return a.f > b.f; }
+	inline ScalarFloat fabs( ScalarFloat a ) { return ScalarFloat( fabsf( a.f ) ); }
+	
+	// fabs here would take ScalarFloat
+	double Abs( double d ) {
+		return d < 0 ? -d : d;
+	}
+	
+	typedef Matrix4< ScalarFloat > Matrix4s;
+	typedef Vec3< ScalarFloat > Vec3s;
+	typedef Vec4< ScalarFloat > Vec4s;
+	typedef Matrix4< double > Matrix4d;
+	
+	Matrix4s ToScalar( const Matrix4f & m ) {
+		Matrix4s s;
+		for( int i = 0; i < 16; i++ ) {
+			s.m[ i ] = m.m[ i ];
+		}
+		return s;
+	}
+	
+	float RandomFloat( uint & seed ) {
+		return ( BenchRandom( seed ) & 0xffff ) / 32767.5f - 1.0f;
+	}
+	
+	// Mostly well conditioned: random, with the diagonal pushed out.
+	Matrix4f RandomMatrix( uint & seed ) {
+		Matrix4f m;
+		for( int i = 0; i < 16; i++ ) {
+			m.m[ i ] = RandomFloat( seed );
+		}
+		for( int i = 0; i < 4; i++ ) {
+			m( i, i ) += 3.0f;
+		}
+		return m;
+	}
+	
+	// The kind cameras and trackballs make: rotate, scale, translate,
+	// and now and then a perspective projection.
+	Matrix4f RandomTransform( uint & seed ) {
+		Vec3f axis( RandomFloat( seed ), RandomFloat( seed ), RandomFloat( seed ) + 2.0f );
+		axis.Normalize();
+		Matrix4f m = ToMatrix4( Rotationf( axis, RandomFloat( seed ) * R3_PI ).GetMatrix3() );
+		m = Matrix4f::Translate( Vec3f( RandomFloat( seed ), RandomFloat( seed ), RandomFloat( seed ) ) * 10.0f ) * m;
+		m = m * Matrix4f::Scale( 1.5f + RandomFloat( seed ) );
+		if( BenchRandom( seed ) & 1 ) {
+			m = Perspective( 60.0f, 1.5f, 0.1f, 100.0f ) * m;
+		}
+		return m;
+	}
+	
+	const int NumMatrixes = 1024;
+	
+	template< typename T > void RandomMatrixes( vector< Matrix4< T > > & ms ) {
+		uint seed = 17;
+		ms.resize( NumMatrixes );
+		for( int i = 0; i < NumMatrixes; i++ ) {
+			Matrix4f m = i & 1 ? RandomTransform( seed ) : RandomMatrix( seed );
+			for( int k = 0; k < 16; k++ ) {
+				ms[ i ].m[ k ] = m.m[ k ];
+			}
+		}
+	}
+	
+	// equal, though a zero may have either sign
+	bool Same( const float * a, const ScalarFloat * b, int n ) {
+		for( int i = 0; i < n; i++ ) {
+			if( a[ i ] != b[ i ].f ) {
+				return false;
+			}
+		}
+		return true;
+	}
+	
+	// Every Matrix4f kernel against the generic templates, on random
+	// matrixes and transforms.  Products, transposes and vector transforms
+	// must match exactly, and inverses to rounding.  Singular matrixes
+	// invert to the identity, which elimination only manages when it
+	// comes out exactly singular.
+	void LinearExact( BenchState & b ) {
+		vector< Matrix4f > ms;
+		RandomMatrixes( ms );
+		uint seed = 5;
+		float inverseError = 0, inverseGenericError = 0;
+		while( b.Loop() ) {
+			for( int i = 0; i + 1 < NumMatrixes; i++ ) {
+				const Matrix4f & m = ms[ i ];
+				const Matrix4f & n = ms[ i + 1 ];
+				Matrix4s sm = ToScalar( m ), sn = ToScalar( n );
+				Matrix4f r = m;
+				Matrix4s sr = sm;
+				if( Same( ( m * n ).m, ( sm * sn ).m, 16 ) == false ||
+				    Same( r.MultLeft( n ).m, sr.MultLeft( sn ).m, 16 ) == false ||
+				    Same( m.Transpose().m, sm.Transpose().m, 16 ) == false ) {
+					b.Fail( "matrix %d products or transpose differ", i );
+					return;
+				}
+				
+				Vec3f p( RandomFloat( seed ), RandomFloat( seed ), RandomFloat( seed ) ), q;
+				Vec3s ps( p.x, p.y, p.z ), qs;
+				Vec4f p4( p.x, p.y, p.z, RandomFloat( seed ) ), q4;
+				Vec4s p4s( p4.x, p4.y, p4.z, p4.w ), q4s;
+				m.MultMatrixVec( p, q );
+				sm.MultMatrixVec( ps, qs );
+				bool same = Same( q.Ptr(), qs.Ptr(), 3 );
+				m.MultVecMatrix( p, q );
+				sm.MultVecMatrix( ps, qs );
+				same = same && Same( q.Ptr(), qs.Ptr(), 3 );
+				m.MultMatrixDir( p, q );
+				sm.MultMatrixDir( ps, qs );
+				same = same && Same( q.Ptr(), qs.Ptr(), 3 );
+				m.MultDirMatrix( p, q );
+				sm.MultDirMatrix( ps, qs );
+				same = same && Same( q.Ptr(), qs.Ptr(), 3 );
+				m.MultMatrixVec( p4, q4 );
+				sm.MultMatrixVec( p4s, q4s );
+				same = same && Same( q4.Ptr(), q4s.Ptr(), 4 );
+				m.MultVecMatrix( p4, q4 );
+				sm.MultVecMatrix( p4s, q4s );
+				same = same && Same( q4.Ptr(), q4s.Ptr(), 4 );
+				if( same == false ) {
+					b.Fail( "matrix %d vector transforms differ", i );
+					return;
+				}
+				
+				// both against double, relative to the largest element
+				Matrix4d md;
+				for( int k = 0; k < 16; k++ ) {
+					md.m[ k ] = m.m[ k ];
+				}
+				Matrix4d invd = md.Inverse();
+				Matrix4f inv = m.Inverse();
+				Matrix4s invs = sm.Inverse();
+				double largest = 0, error = 0, genericError = 0;
+				for( int k = 0; k < 16; k++ ) {
+					largest = max( largest, Abs( invd.m[ k ] ) );
+					error = max( error, Abs( inv.m[ k ] - invd.m[ k ] ) );
+					genericError = max( genericError, Abs( invs.m[ k ].f - invd.m[ k ] ) );
+				}
+				inverseError = max( inverseError, float( error / largest ) );
+				inverseGenericError = max( inverseGenericError, float( genericError / largest ) );
+			}
+			Matrix4f zero;
+			zero.SetValue( 0.0f );
+			if( zero.Inverse() != Matrix4f() || ToScalar( zero ).Inverse() != Matrix4s() ) {
+				b.Fail( "the zero matrix did not invert to the identity" );
+			}
+#if R3_SIMD
+			Matrix4f singular = ms[0];
+			singular.SetColumn( 1, singular.GetColumn( 0 ) );
+			if( singular.Inverse() != Matrix4f() ) {
+				b.Fail( "a singular matrix did not invert to the identity" );
+			}
+#endif
+		}
+		// no worse than elimination
+		if( inverseError > 2.0f * inverseGenericError + 1e-6f ) {
+			b.Fail( "inverses are off by up to %g, against %g for the generic ones", inverseError, inverseGenericError );
+		}
+		b.SetCounter( "inverse_error", inverseError );
+		b.SetCounter( "inverse_generic_error", inverseGenericError );
+		b.SetItems( NumMatrixes - 1 );
+	}
+	Benchmark LinearExactBench( "linear/exact", LinearExact );
+	
+	template< typename T > void LinearMult( BenchState & b ) {
+		vector< Matrix4< T > > ms, rs( NumMatrixes );
+		RandomMatrixes( ms );
+		while( b.Loop() ) {
+			for( int i = 0; i + 1 < NumMatrixes; i++ ) {
+				rs[ i ] = ms[ i ] * ms[ i + 1 ];
+			}
+			BenchKeep( rs[0] );
+		}
+		b.SetItems( NumMatrixes - 1 );
+	}
+	Benchmark LinearMultBench( "linear/mult", LinearMult< float > );
+	Benchmark LinearMultGenericBench( "linear/mult_generic", LinearMult< ScalarFloat > );
+	
+	template< typename T > void LinearInverse( BenchState & b ) {
+		vector< Matrix4< T > > ms, rs( NumMatrixes );
+		RandomMatrixes( ms );
+		while( b.Loop() ) {
+			for( int i = 0; i < NumMatrixes; i++ ) {
+				rs[ i ] = ms[ i ].Inverse();
+			}
+			BenchKeep( rs[0] );
+		}
+		b.SetItems( NumMatrixes );
+	}
+	Benchmark LinearInverseBench( "linear/inverse", LinearInverse< float > );
+	Benchmark LinearInverseGenericBench( "linear/inverse_generic", LinearInverse< ScalarFloat > );
+	
+	template< typename T > void LinearTranspose( BenchState & b ) {
+		vector< Matrix4< T > > ms, rs( NumMatrixes );
+		RandomMatrixes( ms );
+		while( b.Loop() ) {
+			for( int i = 0; i < NumMatrixes; i++ ) {
+				rs[ i ] = ms[ i ].Transpose();
+			}
+			BenchKeep( rs[0] );
+		}
+		b.SetItems( NumMatrixes );
+	}
+	Benchmark LinearTransposeBench( "linear/transpose", LinearTranspose< float > );
+	Benchmark LinearTransposeGenericBench( "linear/transpose_generic", LinearTranspose< ScalarFloat > );
+	
+	const int NumPoints = 4096;
+	
+	// MultMatrixVec on points, with the divide by w.
+	template< typename T > void LinearTransformPoint( BenchState & b ) {
+		vector< Matrix4< T > > ms;
+		RandomMatrixes( ms );
+		vector< Vec3< T > > ps( NumPoints ), rs( NumPoints );
+		uint seed = 3;
+		for( int i = 0; i < NumPoints; i++ ) {
+			ps[ i ] = Vec3< T >( RandomFloat( seed ), RandomFloat( seed ), RandomFloat( seed ) );
+		}
+		const Matrix4< T > & m = ms[1];
+		while( b.Loop() ) {
+			for( int i = 0; i < NumPoints; i++ ) {
+				m.MultMatrixVec( ps[ i ], rs[ i ] );
+			}
+			BenchKeep( rs[0] );
+		}
+		b.SetItems( NumPoints );
+	}
+	Benchmark LinearTransformPointBench( "linear/transform_point", LinearTransformPoint< float > );
+	Benchmark LinearTransformPointGenericBench( "linear/transform_point_generic", LinearTransformPoint< ScalarFloat > );
+	
+	template< typename T > void LinearTransformVec4( BenchState & b ) {
+		vector< Matrix4< T > > ms;
+		RandomMatrixes( ms );
+		vector< Vec4< T > > ps( NumPoints ), rs( NumPoints );
+		uint seed = 3;
+		for( int i = 0; i < NumPoints; i++ ) {
+			ps[ i ] = Vec4< T >( RandomFloat( seed ), RandomFloat( seed ), RandomFloat( seed ), 1.0f );
+		}
+		const Matrix4< T > & m = ms[1];
+		while( b.Loop() ) {
+			for( int i = 0; i < NumPoints; i++ ) {
+				m.MultMatrixVec( ps[ i ], rs[ i ] );
+			}
+			BenchKeep( rs[0] );
+		}
+		b.SetItems( NumPoints );
+	}
+	Benchmark LinearTransformVec4Bench( "linear/transform_vec4", LinearTransformVec4< float > );
+	Benchmark LinearTransformVec4GenericBench( "linear/transform_vec4_generic", LinearTransformVec4< ScalarFloat > );
+	
+	
+	// SoA points in a 20 unit cube around the origin, an odd number so
+	// the kernels' scalar tails run too.
+	const int NumBatchPoints = 256 * 1024 + 3;
+	
+	struct BatchPoints {
+		BatchPoints( int n ) : x( n ), y( n ), z( n ), ox( n ), oy( n ), oz( n ), ow( n ), codes( n ) {
+			uint seed = 11;
+			for( int i = 0; i < n; i++ ) {
+				x[ i ] = RandomFloat( seed ) * 10.0f;
+				y[ i ] = RandomFloat( seed ) * 10.0f;
+				z[ i ] = RandomFloat( seed ) * 10.0f;
+			}
+		}
+		Vec3Array Src() { return Vec3Array( &x[0], &y[0], &z[0] ); }
+		Vec3Array Dst() { return Vec3Array( &ox[0], &oy[0], &oz[0] ); }
+		Vec4Array Clip() { return Vec4Array( &ox[0], &oy[0], &oz[0], &ow[0] ); }
+		vector< float > x, y, z;
+		vector< float > ox, oy, oz, ow;
+		vector< uchar > codes;
+	};
+	
+	// A camera ten units back from the cube, looking at it.
+	Matrix4f BatchCamera() {
+		return Perspective( 60.0f, 1.5f, 0.1f, 100.0f ) * Matrix4f::Translate( Vec3f( 0.0f, 0.0f, -10.0f ) );
+	}
+	
+	// TransformPoints on threads threads, which must match MultMatrixVec.
+	void BatchTransformPoints( BenchState & b, int threads ) {
+		BatchPoints p( NumBatchPoints );
+		Matrix4f m = BatchCamera();
+		while( b.Loop() ) {
+			TransformPoints( m, p.Src(), p.Dst(), NumBatchPoints, threads );
+		}
+		for( int i = 0; i < NumBatchPoints; i++ ) {
+			Vec3f q = m * Vec3f( p.x[ i ], p.y[ i ], p.z[ i ] );
+			if( q.x != p.ox[ i ] || q.y != p.oy[ i ] || q.z != p.oz[ i ] ) {
+				b.Fail( "point %d differs from MultMatrixVec", i );
+				break;
+			}
+		}
+		b.SetItems( NumBatchPoints );
+	}
+	void BatchTransformPoints1( BenchState & b ) {
+		BatchTransformPoints( b, 1 );
+	}
+	void BatchTransformPoints4( BenchState & b ) {
+		BatchTransformPoints( b, 4 );
+	}
+	Benchmark BatchTransformPoints1Bench( "batch/transform_points_1", BatchTransformPoints1 );
+	Benchmark BatchTransformPoints4Bench( "batch/transform_points_4", BatchTransformPoints4 );
+	
+	// The same points one MultMatrixVec at a time, as Vec3fs.
+	void BatchTransformPointsAos( BenchState & b ) {
+		BatchPoints p( NumBatchPoints );
+		vector< Vec3f > src( NumBatchPoints ), dst( NumBatchPoints );
+		for( int i = 0; i < NumBatchPoints; i++ ) {
+			src[ i ] = Vec3f( p.x[ i ], p.y[ i ], p.z[ i ] );
+		}
+		Matrix4f m = BatchCamera();
+		while( b.Loop() ) {
+			for( int i = 0; i < NumBatchPoints; i++ ) {
+				m.MultMatrixVec( src[ i ], dst[ i ] );
+			}
+			BenchKeep( dst[0] );
+		}
+		b.SetItems( NumBatchPoints );
+	}
+	Benchmark BatchTransformPointsAosBench( "batch/transform_points_aos", BatchTransformPointsAos );
+	
+	void BatchTransformDirections( BenchState & b ) {
+		BatchPoints p( NumBatchPoints );
+		Matrix4f m = BatchCamera();
+		while( b.Loop() ) {
+			TransformDirections( m, p.Src(), p.Dst(), NumBatchPoints );
+		}
+		for( int i = 0; i < NumBatchPoints; i++ ) {
+			Vec3f q;
+			m.MultMatrixDir( Vec3f( p.x[ i ], p.y[ i ], p.z[ i ] ), q );
+			if( q.x != p.ox[ i ] || q.y != p.oy[ i ] || q.z != p.oz[ i ] ) {
+				b.Fail( "direction %d differs from MultMatrixDir", i );
+				break;
+			}
+		}
+		b.SetItems( NumBatchPoints );
+	}
+	Benchmark BatchTransformDirectionsBench( "batch/transform_directions", BatchTransformDirections );
+	
+	void BatchProject( BenchState & b ) {
+		BatchPoints p( NumBatchPoints );
+		Matrix4f m = BatchCamera();
+		while( b.Loop() ) {
+			ProjectPoints( m, p.Src(), p.Clip(), NumBatchPoints );
+		}
+		for( int i = 0; i < NumBatchPoints; i++ ) {
+			Vec4f q = m * Vec4f( p.x[ i ], p.y[ i ], p.z[ i ], 1.0f );
+			if( q.x != p.ox[ i ] || q.y != p.oy[ i ] || q.z != p.oz[ i ] || q.w != p.ow[ i ] ) {
+				b.Fail( "point %d's clip coordinates differ from MultMatrixVec", i );
+				break;
+			}
+		}
+		b.SetItems( NumBatchPoints );
+	}
+	Benchmark BatchProjectBench( "batch/project", BatchProject );
+	
+	// Outcodes of the cube's points, checked one at a time against clip
+	// coordinates from MultMatrixVec, along with the count inside.
+	void BatchOutcodes( BenchState & b, int threads ) {
+		BatchPoints p( NumBatchPoints );
+		Matrix4f m = BatchCamera();
+		int inside = 0;
+		while( b.Loop() ) {
+			inside = FrustumOutcodes( m, p.Src(), &p.codes[0], NumBatchPoints, threads );
+		}
+		int expectedInside = 0;
+		for( int i = 0; i < NumBatchPoints; i++ ) {
+			Vec4f q = m * Vec4f( p.x[ i ], p.y[ i ], p.z[ i ], 1.0f );
+			int c = ( q.x < -q.w ? Outcode_Left : 0 ) | ( q.x > q.w ? Outcode_Right : 0 ) |
+			        ( q.y < -q.w ? Outcode_Bottom : 0 ) | ( q.y > q.w ? Outcode_Top : 0 ) |
+			        ( q.z < -q.w ? Outcode_Near : 0 ) | ( q.z > q.w ? Outcode_Far : 0 );
+			expectedInside += c == 0;
+			if( c != p.codes[ i ] ) {
+				b.Fail( "point %d has outcode 0x%x, not 0x%x", i, p.codes[ i ], c );
+				break;
+			}
+		}
+		if( inside != expectedInside || inside == 0 || inside == NumBatchPoints ) {
+			b.Fail( "%d points inside, not %d", inside, expectedInside );
+		}
+		b.SetItems( NumBatchPoints );
+		b.SetCounter( "inside", inside );
+	}
+	void BatchOutcodes1( BenchState & b ) {
+		BatchOutcodes( b, 1 );
+	}
+	void BatchOutcodes4( BenchState & b ) {
+		BatchOutcodes( b, 4 );
+	}
+	Benchmark BatchOutcodes1Bench( "batch/outcodes_1", BatchOutcodes1 );
+	Benchmark BatchOutcodes4Bench( "batch/outcodes_4", BatchOutcodes4 );
+	
+	// Boxes around the cube's points, through a rotation, scale and
+	// translation.  Each result must hold the box's transformed corners,
+	// and touch them to rounding.
+	void BatchBounds( BenchState & b, int threads ) {
+		BatchPoints p( NumBatchPoints );
+		vector< float > ex( NumBatchPoints ), ey( NumBatchPoints ), ez( NumBatchPoints );
+		for( int i = 0; i < NumBatchPoints; i++ ) {
+			ex[ i ] = p.x[ i ] + 1.0f + ( i & 3 );
+			ey[ i ] = p.y[ i ] + 0.5f;
+			ez[ i ] = p.z[ i ] + 2.0f;
+		}
+		Bounds3Array src, dst;
+		src.bmin = p.Src();
+		src.bmax = Vec3Array( &ex[0], &ey[0], &ez[0] );
+		vector< float > dx( NumBatchPoints ), dy( NumBatchPoints ), dz( NumBatchPoints );
+		dst.bmin = p.Dst();
+		dst.bmax = Vec3Array( &dx[0], &dy[0], &dz[0] );
+		uint seed = 23;
+		Matrix4f m;
+		do {
+			m = RandomTransform( seed );
+		} while( m( 3, 0 ) != 0.0f || m( 3, 1 ) != 0.0f || m( 3, 2 ) != 0.0f );
+		while( b.Loop() ) {
+			TransformBounds( m, src, dst, NumBatchPoints, threads );
+		}
+		for( int i = 0; i < NumBatchPoints; i++ ) {
+			Bounds3f corners;
+			for( int c = 0; c < 8; c++ ) {
+				Vec3f v( c & 1 ? ex[ i ] : p.x[ i ], c & 2 ? ey[ i ] : p.y[ i ], c & 4 ? ez[ i ] : p.z[ i ] );
+				corners.Add( m * v );
+			}
+			Vec3f lo( p.ox[ i ], p.oy[ i ], p.oz[ i ] ), hi( dx[ i ], dy[ i ], dz[ i ] );
+			float slop = 1e-4f * ( 1.0f + ( corners.Max() - corners.Min() ).Length() + corners.Max().Length() );
+			for( int k = 0; k < 3; k++ ) {
+				if( fabsf( lo[ k ] - corners.Min()[ k ] ) > slop || fabsf( hi[ k ] - corners.Max()[ k ] ) > slop ) {
+					b.Fail( "box %d's bounds are off on axis %d", i, k );
+					i = NumBatchPoints;
+					break;
+				}
+			}
+		}
+		b.SetItems( NumBatchPoints );
+	}
+	void BatchBounds1( BenchState & b ) {
+		BatchBounds( b, 1 );
+	}
+	void BatchBounds4( BenchState & b ) {
+		BatchBounds( b, 4 );
+	}
+	Benchmark BatchBounds1Bench( "batch/bounds_1", BatchBounds1 );
+	Benchmark BatchBounds4Bench( "batch/bounds_4", BatchBounds4 );
+	
+}
@@ -0,0 +1,742 @@
+/*
+ *  renderbench
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+// Benchmarks for the CPU side of rendering: draw submission, buffer and
+// texture uploads and font printing, on the null GL backend.  The null
+// backend's counts are reported per operation, so changes in how many GL
+// calls or state changes a path makes show up next to its timing.
+
+#include "bench.h"
+
+#include "r3/buffer.h"
+#include "r3/draw.h"
+#include "r3/filesystem.h"
+#include "r3/font.h"
+#include "r3/frametime.h"
+#include "r3/gl.h"
+#include "r3/glstate.h"
+#include "r3/init.h"
+#include "r3/model.h"
+#include "r3/nullgl.h"
+#include "r3/output.h"
+#include "r3/shader.h"
+#include "r3/texture.h"
+#include "r3/var.h"
+
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace r3;
+
+VarString bench_font( "bench_font", "TTF file for the font benchmarks, common system fonts are tried when empty.", 0, "" );
+
+namespace {
+	
+	// Brings up the GL side of r3 on the null backend for one trial, with
+	// the init and shutdown chatter dropped.
+	struct NullGLScope {
+		NullGLScope() {
+			SetOutputFunction( BenchNullOutput );
+			InitNullGL();
+			InitGLState();
+			InitBuffer();
+			InitDraw();
+			InitModel();
+			InitShader();
+			InitTexture();
+			InitFont();
+		}
+		~NullGLScope() {
+			ShutdownFont();
+			ShutdownModel();
+			ShutdownTexture();
+			ShutdownShader();
+			ShutdownDraw();
+			ShutdownBuffer();
+			ShutdownGLState();
+			ShutdownNullGL();
+			SetOutputFunction( BenchStderrOutput );
+		}
+	};
+	
+	// null backend counts since an earlier GetNullGLStats
+	NullGLStats Since( const NullGLStats & before ) {
+		NullGLStats s = GetNullGLStats();
+		s.calls -= before.calls;
+		s.draws -= before.draws;
+		s.vertices -= before.vertices;
+		s.bytesUploaded -= before.bytesUploaded;
+		s.textureBytesUploaded -= before.textureBytesUploaded;
+		s.stateChanges -= before.stateChanges;
+		s.redundantStateChanges -= before.redundantStateChanges;
+		s.objectsCreated -= before.objectsCreated;
+		s.fenceWaits -= before.fenceWaits;
+		s.badDraws -= before.badDraws;
+		s.badUploads -= before.badUploads;
+		return s;
+	}
+	
+	void SetGLCounters( BenchState & b, const NullGLStats & s, int64 ops ) {
+		b.SetCounter( "glCalls", double( s.calls ) / ops );
+		b.SetCounter( "stateChanges", double( s.stateChanges ) / ops );
+		b.SetCounter( "redundantStateChanges", double( s.redundantStateChanges ) / ops );
+		b.SetCounter( "bytesUploaded", double( s.bytesUploaded ) / ops );
+	}
+	
+	// an n by n grid of position and texcoord vertexes, and its triangles
+	void GridVertexes( int n, vector< float > & v ) {
+		v.clear();
+		for( int j = 0; j <= n; j++ ) {
+			for( int i = 0; i <= n; i++ ) {
+				v.push_back( float( i ) );
+				v.push_back( float( j ) );
+				v.push_back( 0.0f );
+				v.push_back( float( i ) / n );
+				v.push_back( float( j ) / n );
+			}
+		}
+	}
+	void GridIndexes( int n, vector< uint > & idx ) {
+		idx.clear();
+		for( int j = 0; j < n; j++ ) {
+			for( int i = 0; i < n; i++ ) {
+				uint a = j * ( n + 1 ) + i;
+				uint c = a + n + 1;
+				idx.push_back( a );
+				idx.push_back( a + 1 );
+				idx.push_back( c + 1 );
+				idx.push_back( a );
+				idx.push_back( c + 1 );
+				idx.push_back( c );
+			}
+		}
+	}
+	
+	// indexed grid with position and texcoord in generic attributes 0 and 8,
+	// in buffers of its own or in the shared arenas
+	Model * CreateGridModel( const string & name, int n, bool arena = false, BufferAllocListener * refill = NULL ) {
+		vector< float > v;
+		GridVertexes( n, v );
+		vector< uint > idx;
+		GridIndexes( n, idx );
+		Model * m = new Model( name );
+		if( arena ) {
+			m->SetArenaGeometry( &v[0], (int)( v.size() * sizeof( float ) ), 20, &idx[0], (int)idx.size(), refill );
+		} else {
+			m->GetVertexBuffer().SetData( (int)( v.size() * sizeof( float ) ), &v[0] );
+			m->SetIndexes( &idx[0], (int)idx.size() );
+		}
+		m->SetPrimitive( GL_TRIANGLES );
+		m->AddAttributeArray( AttributeArray( 0, 3, GL_FLOAT, GL_FALSE, 20, 0 ) );
+		m->AddAttributeArray( AttributeArray( 8, 2, GL_FLOAT, GL_FALSE, 20, 12 ) );
+		return m;
+	}
+	
+	// startup cost of the GL entry points; they resolve lazily on first call
+	void GLEntryInit( BenchState & b ) {
+		NullGLScope gl;
+		while( b.Loop() ) {
+			InitGLEntry();
+		}
+		b.SetItems( 1 );
+	}
+	Benchmark GLEntryInitBench( "render/glentry_init", GLEntryInit );
+	
+	void ModelDraw( BenchState & b ) {
+		NullGLScope gl;
+		Model * m = CreateGridModel( "benchgrid", 16 );
+		NullGLStats before = GetNullGLStats();
+		while( b.Loop() ) {
+			m->Draw();
+		}
+		NullGLStats s = Since( before );
+		if( s.draws != b.Iterations() ) {
+			b.Fail( "%lld draws for %lld Model::Draw calls", s.draws, b.Iterations() );
+		}
+		if( r_stateCache.GetVal() && s.redundantStateChanges != 0 ) {
+			b.Fail( "%lld redundant state changes got past the state cache", s.redundantStateChanges );
+		}
+		SetGLCounters( b, s, b.Iterations() );
+		b.SetItems( 1 );
+	}
+	Benchmark ModelDrawBench( "render/model_draw", ModelDraw );
+	
+	// Grids past 64K vertexes need 32 bit indexes, in buffers of their own
+	// and in the arena.  A wrong count or type reads past the index buffer.
+	void ModelDrawLarge( BenchState & b ) {
+		NullGLScope gl;
+		const int n = 300;
+		Model * own = CreateGridModel( "benchlarge", n );
+		Model * arena = CreateGridModel( "benchlarge_arena", n, true );
+		NullGLStats before = GetNullGLStats();
+		while( b.Loop() ) {
+			own->Draw();
+			arena->Draw();
+		}
+		NullGLStats s = Since( before );
+		if( own->GetIndexType() != GL_UNSIGNED_INT || arena->GetIndexType() != GL_UNSIGNED_INT ) {
+			b.Fail( "%d vertexes were given 16 bit indexes", ( n + 1 ) * ( n + 1 ) );
+		}
+		if( s.vertices != b.Iterations() * 2 * n * n * 6 || s.badDraws != 0 ) {
+			b.Fail( "%lld indexes drawn, %lld draws past the end", s.vertices, s.badDraws );
+		}
+		SetGLCounters( b, s, b.Iterations() );
+		b.SetItems( 2 );
+	}
+	Benchmark ModelDrawLargeBench( "render/model_draw_large", ModelDrawLarge );
+	
+	// A coarser level of detail, here the second half of the indexes, must
+	// be what gets drawn from buffers of its own and from the arena alike.
+	void ModelDrawLod( BenchState & b ) {
+		NullGLScope gl;
+		const int n = 16;
+		const int numIndexes = n * n * 6;
+		vector< MeshLod > lods;
+		lods.push_back( MeshLod( 0, numIndexes, 0.0f ) );
+		lods.push_back( MeshLod( numIndexes / 2, numIndexes / 2, 1.0f ) );
+		Model * own = CreateGridModel( "benchlod", n );
+		Model * arena = CreateGridModel( "benchlod_arena", n, true );
+		own->SetLods( lods );
+		arena->SetLods( lods );
+		own->SetLod( 1 );
+		arena->SetLod( 1 );
+		NullGLStats before = GetNullGLStats();
+		while( b.Loop() ) {
+			own->Draw();
+			arena->Draw();
+		}
+		NullGLStats s = Since( before );
+		if( own->GetNumVertexes() != numIndexes / 2 || arena->GetNumVertexes() != numIndexes / 2 ) {
+			b.Fail( "level 1 has %d indexes in its own buffer and %d in the arena, not %d", own->GetNumVertexes(), arena->GetNumVertexes(), numIndexes / 2 );
+		} else if( s.vertices != b.Iterations() * numIndexes || s.badDraws != 0 ) {
+			b.Fail( "%lld indexes drawn, %lld draws past the end", s.vertices, s.badDraws );
+		}
+		delete own;
+		delete arena;
+		SetGLCounters( b, s, b.Iterations() );
+		b.SetItems( 2 );
+	}
+	Benchmark ModelDrawLodBench( "render/model_draw_lod", ModelDrawLod );
+	
+	// non-indexed quads past the 16 bit quad indexes
+	void QuadsLarge( BenchState & b ) {
+		NullGLScope gl;
+		const int numVerts = 100000;
+		vector< float > v( numVerts * 3, 1.0f );
+		Model * m = new Model( "benchquads" );
+		m->GetVertexBuffer().SetData( (int)( v.size() * sizeof( float ) ), &v[0] );
+		m->SetPrimitive( GL_QUADS );
+		m->SetNumVertexes( numVerts );
+		m->AddAttributeArray( AttributeArray( 0, 3, GL_FLOAT, GL_FALSE, 12, 0 ) );
+		NullGLStats before = GetNullGLStats();
+		while( b.Loop() ) {
+			m->Draw();
+		}
+		NullGLStats s = Since( before );
+		if( s.vertices != b.Iterations() * numVerts * 3 / 2 || s.badDraws != 0 ) {
+			b.Fail( "%lld indexes drawn, %lld draws past the end", s.vertices, s.badDraws );
+		}
+		SetGLCounters( b, s, b.Iterations() );
+		b.SetItems( 1 );
+	}
+	Benchmark QuadsLargeBench( "render/quads_large", QuadsLarge );
+	
+	// Many small static models drawn back to back.  In the arena they share
+	// buffers, so switching models costs pointer updates instead of binds.
+	void ModelSwitch( BenchState & b, bool arena ) {
+		NullGLScope gl;
+		const int numModels = 64;
+		vector< Model * > models;
+		char name[32];
+		for( int i = 0; i < numModels; i++ ) {
+			r3Sprintf( name, "benchmodel%d", i );
+			models.push_back( CreateGridModel( name, 4 + ( i & 7 ), arena ) );
+		}
+		NullGLStats before = GetNullGLStats();
+		while( b.Loop() ) {
+			for( int i = 0; i < numModels; i++ ) {
+				models[ i ]->Draw();
+			}
+		}
+		NullGLStats s = Since( before );
+		if( s.draws != b.Iterations() * numModels ) {
+			b.Fail( "%lld draws for %lld Model::Draw calls", s.draws, b.Iterations() * numModels );
+		}
+		if( s.badDraws != 0 ) {
+			b.Fail( "%lld draws read past the end of their indexes", s.badDraws );
+		}
+		for( int i = 0; i < numModels; i++ ) {
+			delete models[ i ];
+		}
+		SetGLCounters( b, s, b.Iterations() );
+		b.SetItems( numModels );
+	}
+	void ModelSwitchOwn( BenchState & b ) {
+		ModelSwitch( b, false );
+	}
+	void ModelSwitchArena( BenchState & b ) {
+		ModelSwitch( b, true );
+	}
+	Benchmark ModelSwitchOwnBench( "render/model_switch", ModelSwitchOwn );
+	Benchmark ModelSwitchArenaBench( "render/model_switch_arena", ModelSwitchArena );
+	
+	// per-frame dynamic geometry streamed through the ring, which should
+	// only wait on fences once the ring has wrapped
+	void StreamWrite( BenchState & b ) {
+		NullGLScope gl;
+		const int ringSize = 256 * 1024;
+		const int chunk = 4 * 1024;
+		const int chunksPerFrame = 16;
+		StreamBuffer sb( "benchsb", GL_ARRAY_BUFFER, ringSize );
+		vector< uchar > data( chunk, 7 );
+		NullGLStats before = GetNullGLStats();
+		while( b.Loop() ) {
+			for( int i = 0; i < chunksPerFrame; i++ ) {
+				sb.Write( &data[0], chunk, 16 );
+			}
+			EndBufferFrame();
+		}
+		NullGLStats s = Since( before );
+		int64 frames = b.Iterations();
+		int64 framesPerRing = ringSize / ( chunk * chunksPerFrame );
+		if( s.fenceWaits > frames ) {
+			b.Fail( "%lld fence waits in %lld frames", s.fenceWaits, frames );
+		}
+		if( frames > framesPerRing && s.fenceWaits == 0 ) {
+			b.Fail( "ring wrapped without waiting on a fence" );
+		}
+		SetGLCounters( b, s, frames );
+		b.SetCounter( "fenceWaits", double( s.fenceWaits ) / frames );
+		b.SetBytes( chunk * chunksPerFrame );
+	}
+	Benchmark StreamWriteBench( "render/stream_write", StreamWrite );
+	
+	// dynamic geometry rewritten every frame
+	void BufferSetSubdata( BenchState & b ) {
+		NullGLScope gl;
+		const int size = 64 * 1024;
+		const int chunk = 4 * 1024;
+		VertexBuffer vb( "benchvb" );
+		vector< uchar > data( size, 7 );
+		vb.SetData( size, &data[0] );
+		NullGLStats before = GetNullGLStats();
+		int offset = 0;
+		while( b.Loop() ) {
+			vb.SetSubdata( offset, chunk, &data[ offset ] );
+			vb.Bind(); // as a draw would
+			offset = ( offset + chunk ) % size;
+		}
+		SetGLCounters( b, Since( before ), b.Iterations() );
+		b.SetBytes( chunk );
+	}
+	Benchmark BufferSetSubdataBench( "render/buffer_setsubdata", BufferSetSubdata );
+	
+	// Many small updates to one buffer between draws, like per-object
+	// constants.  The updates are interleaved and a few overlap, so with
+	// r_bufferDeferUploads they should merge into a few uploads.
+	void BufferScattered( BenchState & b ) {
+		NullGLScope gl;
+		const int size = 64 * 1024;
+		const int piece = 64;
+		const int numPieces = 128;
+		VertexBuffer vb( "benchvb" );
+		vector< uchar > data( size, 7 );
+		vb.SetData( size, &data[0] );
+		vb.Bind();
+		NullGLStats before = GetNullGLStats();
+		while( b.Loop() ) {
+			for( int i = 0; i < numPieces; i++ ) {
+				// odd pieces first, then even ones, then a few again
+				int slot = ( i * 2 + ( i >= numPieces / 2 ? 0 : 1 ) ) % numPieces;
+				vb.SetSubdata( slot * 2 * piece, piece, &data[0] );
+			}
+			for( int i = 0; i < numPieces; i += 16 ) {
+				vb.SetSubdata( i * 2 * piece + piece / 2, piece, &data[0] );
+			}
+			vb.Bind();
+		}
+		NullGLStats s = Since( before );
+		SetGLCounters( b, s, b.Iterations() );
+		b.SetItems( numPieces + numPieces / 16 );
+	}
+	Benchmark BufferScatteredBench( "render/buffer_scattered", BufferScattered );
+	
+	// Refills a dropped grid buffer from its description, the way a loader
+	// that can rebuild its geometry would.  For a model in the arenas, it
+	// rewrites whichever of the model's ranges lives in the block.
+	struct GridRefill : public BufferAllocListener {
+		GridRefill() : n( 0 ), arenaModel( NULL ), calls( 0 ) {}
+		int n;
+		Model * arenaModel;
+		int64 calls;
+		vector< float > v;
+		vector< uint > idx;
+		void OnBufferAlloc( Buffer * buf ) {
+			calls++;
+			GridVertexes( n, v );
+			if( arenaModel ) {
+				GridIndexes( n, idx );
+				arenaModel->RestoreArenaGeometry( buf, &v[0], &idx[0] );
+			} else {
+				buf->SetSubdata( 0, (int)( v.size() * sizeof( float ) ), &v[0] );
+			}
+		}
+	};
+	
+	// Restoring a model set after the GL objects were lost.  Reports the
+	// shadow copy memory the set holds, which is what dropping saves.  The
+	// arenas never keep a copy, so every byte comes back from the refills.
+	void BufferRestore( BenchState & b, BufferShadowEnum shadow, bool arena ) {
+		NullGLScope gl;
+		const int numModels = 256;
+		const int n = 32;
+		int64 shadowBefore = mem_buffer.Live();
+		vector< Model * > models;
+		vector< GridRefill > refill( numModels );
+		char name[32];
+		for( int i = 0; i < numModels; i++ ) {
+			r3Sprintf( name, "benchmodel%d", i );
+			refill[ i ].n = n;
+			Model * m = CreateGridModel( name, n, arena, arena ? &refill[ i ] : NULL );
+			if( arena ) {
+				refill[ i ].arenaModel = m;
+			} else if( shadow == BufferShadow_Drop ) {
+				m->GetVertexBuffer().SetShadow( shadow );
+				m->GetVertexBuffer().SetAllocListener( &refill[ i ] );
+			}
+			models.push_back( m );
+		}
+		int64 shadowBytes = mem_buffer.Live() - shadowBefore;
+		NullGLStats before = GetNullGLStats();
+		while( b.Loop() ) {
+			DeallocBuffer();
+			AllocBuffer();
+		}
+		NullGLStats s = Since( before );
+		for( int i = 0; i < numModels; i++ ) {
+			delete models[ i ];
+		}
+		if( arena ) {
+			// one call for the vertex block and one for the index block
+			int64 calls = 0;
+			for( int i = 0; i < numModels; i++ ) {
+				calls += refill[ i ].calls;
+			}
+			if( shadowBytes != 0 ) {
+				b.Fail( "the arenas hold %lld bytes of shadow copies", shadowBytes );
+			} else if( calls != b.Iterations() * numModels * 2 ) {
+				b.Fail( "%lld refills for %lld restores of %d models", calls, b.Iterations(), numModels );
+			}
+		}
+		SetGLCounters( b, s, b.Iterations() );
+		b.SetCounter( "shadowKB", double( shadowBytes ) / 1024 );
+		b.SetItems( numModels );
+	}
+	void BufferRestoreKeep( BenchState & b ) {
+		BufferRestore( b, BufferShadow_Keep, false );
+	}
+	void BufferRestoreDrop( BenchState & b ) {
+		BufferRestore( b, BufferShadow_Drop, false );
+	}
+	void BufferRestoreArena( BenchState & b ) {
+		BufferRestore( b, BufferShadow_Drop, true );
+	}
+	Benchmark BufferRestoreKeepBench( "render/buffer_restore_keep", BufferRestoreKeep );
+	Benchmark BufferRestoreDropBench( "render/buffer_restore_drop", BufferRestoreDrop );
+	Benchmark BufferRestoreArenaBench( "render/buffer_restore_arena", BufferRestoreArena );
+	
+	// respecifying the whole buffer, which also reallocates the shadow copy
+	void BufferSetData( BenchState & b ) {
+		NullGLScope gl;
+		const int size = 64 * 1024;
+		VertexBuffer vb( "benchvb" );
+		vector< uchar > data( size, 7 );
+		NullGLStats before = GetNullGLStats();
+		int i = 0;
+		while( b.Loop() ) {
+			// alternate sizes so the shadow copy really resizes
+			vb.SetData( size - ( i++ & 1 ) * 1024, &data[0] );
+		}
+		SetGLCounters( b, Since( before ), b.Iterations() );
+		b.SetBytes( size - 512 );
+	}
+	Benchmark BufferSetDataBench( "render/buffer_setdata", BufferSetData );
+	
+	void TextureSubImage( BenchState & b ) {
+		NullGLScope gl;
+		const int size = 256;
+		const int tile = 64;
+		Texture2D * tex = Texture2D::Create( "benchtex", TextureFormat_RGBA, size, size );
+		vector< uchar > pixels( tile * tile * 4, 200 );
+		NullGLStats before = GetNullGLStats();
+		int i = 0;
+		while( b.Loop() ) {
+			int x = ( i & 3 ) * tile;
+			int y = ( ( i >> 2 ) & 3 ) * tile;
+			tex->SetSubImage( 0, x, y, tile, tile, &pixels[0] );
+			i++;
+		}
+		SetGLCounters( b, Since( before ), b.Iterations() );
+		b.SetBytes( tile * tile * 4 );
+	}
+	Benchmark TextureSubImageBench( "render/texture_subimage", TextureSubImage );
+	
+	// Puts a TTF file in the scratch directory as benchfont.ttf, false when
+	// there is none to be had.
+	bool FindBenchFont( string & found ) {
+		const char * candidates[] = {
+			"/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+			"/usr/share/fonts/TTF/DejaVuSans.ttf",
+			"/usr/share/fonts/dejavu/DejaVuSans.ttf",
+			"/usr/share/fonts/truetype/liberation/LiberationSans-Regular.ttf",
+			"/Library/Fonts/Arial.ttf"
+		};
+		vector< string > paths;
+		if( bench_font.GetVal().size() ) {
+			paths.push_back( bench_font.GetVal() );
+		}
+		for( int i = 0; i < (int)ARRAY_ELEMENTS( candidates ); i++ ) {
+			paths.push_back( candidates[ i ] );
+		}
+		for( int i = 0; i < (int)paths.size(); i++ ) {
+			FILE * fp = fopen( paths[ i ].c_str(), "rb" );
+			if( fp == NULL ) {
+				continue;
+			}
+			vector< uchar > ttf;
+			uchar buf[ 4096 ];
+			size_t n;
+			while( ( n = fread( buf, 1, sizeof( buf ), fp ) ) > 0 ) {
+				ttf.insert( ttf.end(), buf, buf + n );
+			}
+			fclose( fp );
+			File * f = FileOpenForWrite( "benchfont.ttf" );
+			if( f == NULL || ttf.size() == 0 ) {
+				delete f;
+				return false;
+			}
+			f->Write( &ttf[0], 1, (int)ttf.size() );
+			delete f;
+			found = paths[ i ];
+			return true;
+		}
+		return false;
+	}
+	
+	Font * CreateBenchFont( BenchState & b ) {
+		static string found;
+		if( found.size() == 0 && FindBenchFont( found ) == false ) {
+			b.Skip( "no TTF font found, set bench_font" );
+			return NULL;
+		}
+		return CreateStbFont( "benchfont.ttf", "", 12.0f );
+	}
+	
+	// glyphs all cached, so this is quad submission and string handling
+	void FontPrint( BenchState & b ) {
+		NullGLScope gl;
+		Font * font = CreateBenchFont( b );
+		if( font == NULL ) {
+			return;
+		}
+		const string text = "The quick brown fox jumps over the lazy dog";
+		font->Print( text, 0, 0 );
+		NullGLStats before = GetNullGLStats();
+		while( b.Loop() ) {
+			font->Print( text, 10, 20 );
+		}
+		NullGLStats s = Since( before );
+		if( s.textureBytesUploaded != 0 ) {
+			b.Fail( "%lld glyph bytes uploaded with a warm cache", s.textureBytesUploaded );
+		}
+		SetGLCounters( b, s, b.Iterations() );
+		b.SetItems( (int64)text.size() );
+	}
+	Benchmark FontPrintBench( "render/font_print", FontPrint );
+	
+	// cycles through more glyphs than the cache holds, so every character
+	// rasterizes and uploads a glyph
+	void FontGlyphMiss( BenchState & b ) {
+		NullGLScope gl;
+		Font * font = CreateBenchFont( b );
+		if( font == NULL ) {
+			return;
+		}
+		const int first = 0x21;
+		const int count = 0x7e - first + 1 + 0xff - 0xa1 + 1;
+		NullGLStats before = GetNullGLStats();
+		int c = 0;
+		char text[ 8 ];
+		while( b.Loop() ) {
+			int cp = first + c;
+			if( cp > 0x7e ) {
+				cp += 0xa1 - 0x7f;
+			}
+			r3Sprintf( text, "\\u%04x", cp );
+			font->Print( text, 0, 0 );
+			c = ( c + 1 ) % count;
+		}
+		SetGLCounters( b, Since( before ), b.Iterations() );
+		b.SetItems( 1 );
+	}
+	Benchmark FontGlyphMissBench( "render/font_glyphmiss", FontGlyphMiss );
+	
+	// sprites sharing a texture and state, so they should go out as one draw
+	void SpriteBatch( BenchState & b ) {
+		NullGLScope gl;
+		const int numSprites = 256;
+		Texture2D * tex = Texture2D::Create( "benchsprite", TextureFormat_RGBA, 64, 64 );
+		vector< uchar > pixels( 64 * 64 * 4, 255 );
+		tex->SetImage( 0, &pixels[0] );
+		NullGLStats before = GetNullGLStats();
+		while( b.Loop() ) {
+			tex->Bind( 0 );
+			tex->Enable( 0 );
+			for( int i = 0; i < numSprites; i++ ) {
+				float x = float( ( i & 15 ) * 70 );
+				float y = float( ( i >> 4 ) * 70 );
+				DrawSprite( x, y, x + 64, y + 64 );
+			}
+			tex->Disable( 0 );
+		}
+		NullGLStats s = Since( before );
+		if( s.draws != b.Iterations() ) {
+			b.Fail( "%lld draws for %lld batches of sprites", s.draws, b.Iterations() );
+		}
+		SetGLCounters( b, s, b.Iterations() );
+		b.SetCounter( "draws", double( s.draws ) / b.Iterations() );
+		b.SetItems( numSprites );
+	}
+	Benchmark SpriteBatchBench( "render/sprite_batch", SpriteBatch );
+	
+	// Creating a buffer binds it, which flushes the quads queued before it.
+	// The flush binds the quad stream, and the outer bind must still reach
+	// GL afterwards, or the next batch is written into the new buffer.
+	void QuadsBufferBind( BenchState & b ) {
+		NullGLScope gl;
+		const float small[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		NullGLStats before = GetNullGLStats();
+		while( b.Loop() ) {
+			DrawQuad( 0, 0, 16, 16 );
+			VertexBuffer * vb = new VertexBuffer( "benchsmall_vb" );
+			vb->SetData( sizeof( small ), small );
+			DrawQuad( 16, 0, 32, 16 );
+			FlushQuads();
+			delete vb;
+		}
+		NullGLStats s = Since( before );
+		if( s.draws != b.Iterations() * 2 ) {
+			b.Fail( "%lld draws for %lld pairs of quads", s.draws, b.Iterations() );
+		}
+		if( s.badUploads != 0 ) {
+			b.Fail( "%lld quad batches were written past the end of the bound buffer", s.badUploads );
+		}
+		SetGLCounters( b, s, b.Iterations() );
+		b.SetItems( 1 );
+	}
+	Benchmark QuadsBufferBindBench( "render/quads_buffer_bind", QuadsBufferBind );
+	
+	// A frame's worth of submission: models, textured sprites and a few
+	// lines of text, ended with r3::EndFrame so the counts are per frame.
+	void Frame( BenchState & b ) {
+		NullGLScope gl;
+		const int numModels = 64;
+		const int numSprites = 32;
+		vector< Model * > models;
+		char name[32];
+		for( int i = 0; i < numModels; i++ ) {
+			r3Sprintf( name, "benchmodel%d", i );
+			models.push_back( CreateGridModel( name, 4 + ( i & 7 ) ) );
+		}
+		Texture2D * tex = Texture2D::Create( "benchsprite", TextureFormat_RGBA, 64, 64 );
+		vector< uchar > pixels( 64 * 64 * 4, 255 );
+		tex->SetImage( 0, &pixels[0] );
+		string found;
+		Font * font = NULL;
+		if( FindBenchFont( found ) ) {
+			font = CreateStbFont( "benchfont.ttf", "", 12.0f );
+		}
+		NullGLEndFrame();
+		while( b.Loop() ) {
+			for( int i = 0; i < numModels; i++ ) {
+				models[ i ]->Draw();
+			}
+			tex->Bind( 0 );
+			tex->Enable( 0 );
+			for( int i = 0; i < numSprites; i++ ) {
+				float x = float( ( i & 7 ) * 70 );
+				float y = float( ( i >> 3 ) * 70 );
+				DrawSprite( x, y, x + 64, y + 64 );
+			}
+			tex->Disable( 0 );
+			if( font ) {
+				font->Print( "frame 1234  fps 60.0", 10, 10 );
+				font->Print( "models 64  sprites 32", 10, 30 );
+			}
+			EndFrame();
+		}
+		NullGLStats s = GetNullGLFrameStats();
+		// the sprites share a texture, so they are one batch
+		int64 draws = numModels + 1 + ( font ? 2 : 0 );
+		if( s.draws != draws ) {
+			b.Fail( "%lld draws in a frame, expected %lld", s.draws, draws );
+		}
+		if( r_stateCache.GetVal() && s.redundantStateChanges != 0 ) {
+			b.Fail( "%lld redundant state changes got past the state cache", s.redundantStateChanges );
+		}
+		// EndFrame times the frames too
+		FrameTimeStats ft = GetFrameTimeStats();
+		if( b.Iterations() > 1 && ft.frames == 0 ) {
+			b.Fail( "%lld frames ended but none were timed", b.Iterations() );
+		}
+		SetGLCounters( b, s, 1 );
+		b.SetCounter( "draws", double( s.draws ) );
+		b.SetCounter( "frame_p99_ms", ft.p99 );
+		b.SetItems( 1 );
+	}
+	Benchmark FrameBench( "render/frame", Frame );
+	
+}
@@ -0,0 +1,243 @@
+/*
+ *  threadbench
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+// Multi-threaded benchmarks.  The queue benchmarks double as the exactness
+// check for r3/queue.h: every value pushed must be popped exactly once.
+
+#include "bench.h"
+
+#include "r3/atomic.h"
+#include "r3/queue.h"
+#include "r3/thread.h"
+#include "r3/time.h"
+
+using namespace std;
+using namespace r3;
+
+namespace {
+	
+	const int MaxWorkers = 8;
+	
+	// Workers stay around between trials, so trials do not pay for thread
+	// creation.
+	struct BenchWorker : public Thread {
+		BenchWorker() : Thread( "BenchWorker" ), done( NULL ), job( NULL ), index( 0 ) {}
+		Semaphore start;
+		Semaphore * done;
+		void (*job)( int index );
+		int index;
+		virtual void Run() {
+			for( ;; ) {
+				start.Wait();
+				job( index );
+				done->Post();
+			}
+		}
+	};
+	BenchWorker workers[ MaxWorkers ];
+	Semaphore workersDone;
+	
+	void RunWorkers( int count, void (*job)( int index ) ) {
+		for( int i = 0; i < count; i++ ) {
+			workers[ i ].job = job;
+			workers[ i ].index = i;
+			workers[ i ].done = &workersDone;
+			workers[ i ].Start();
+			workers[ i ].start.Post();
+		}
+		for( int i = 0; i < count; i++ ) {
+			workersDone.Wait();
+		}
+	}
+	
+	template< typename Q, typename T > void PushItem( Q & q, const T & val ) {
+		while( q.TryPush( val ) == false ) {
+			ThreadYield();
+		}
+	}
+	template< typename T, typename Q > void PushItem( BlockingQueue< T, Q > & q, const T & val ) {
+		q.Push( val );
+	}
+	template< typename Q, typename T > void PopItem( Q & q, T & val ) {
+		while( q.TryPop( val ) == false ) {
+			ThreadYield();
+		}
+	}
+	template< typename T, typename Q > void PopItem( BlockingQueue< T, Q > & q, T & val ) {
+		q.Pop( val );
+	}
+	
+	// Producers push 1..total between them, consumers claim items until all
+	// are taken, and the sums of squares must match.
+	template< typename Q > struct QueueTest {
+		static Q * queue;
+		static int producers;
+		static int64 total;
+		static Atomic< int64 > claimed;
+		static Atomic< int64 > popped;
+		static Atomic< uint64 > sum;
+		static Atomic< uint64 > sumSquares;
+		
+		static void Job( int index ) {
+			if( index < producers ) {
+				for( int64 v = index + 1; v <= total; v += producers ) {
+					PushItem( *queue, uint64( v ) );
+				}
+			} else {
+				uint64 s = 0, s2 = 0, n = 0;
+				while( claimed.Incr() <= total ) {
+					uint64 v;
+					PopItem( *queue, v );
+					s += v;
+					s2 += v * v;
+					n++;
+				}
+				sum.Add( s );
+				sumSquares.Add( s2 );
+				popped.Add( n );
+			}
+		}
+		
+		static void Run( BenchState & b, int numProducers, int numConsumers, int capacity ) {
+			Q q( capacity );
+			queue = &q;
+			producers = numProducers;
+			total = b.Iterations();
+			claimed.Set( 0 );
+			popped.Set( 0 );
+			sum.Set( 0 );
+			sumSquares.Set( 0 );
+			b.StartTimer();
+			RunWorkers( numProducers + numConsumers, Job );
+			b.StopTimer();
+			// summed rather than closed form, which would overflow before the divide
+			uint64 expect = 0, expectSquares = 0;
+			for( uint64 v = 1; v <= uint64( total ); v++ ) {
+				expect += v;
+				expectSquares += v * v;
+			}
+			if( popped.Get() != total || sum.Get() != expect || sumSquares.Get() != expectSquares ) {
+				b.Fail( "popped %lld of %lld items, sum %llu expected %llu", popped.Get(), total, sum.Get(), expect );
+			}
+			b.SetItems( 1 );
+		}
+	};
+	template< typename Q > Q * QueueTest< Q >::queue;
+	template< typename Q > int QueueTest< Q >::producers;
+	template< typename Q > int64 QueueTest< Q >::total;
+	template< typename Q > Atomic< int64 > QueueTest< Q >::claimed;
+	template< typename Q > Atomic< int64 > QueueTest< Q >::popped;
+	template< typename Q > Atomic< uint64 > QueueTest< Q >::sum;
+	template< typename Q > Atomic< uint64 > QueueTest< Q >::sumSquares;
+	
+	void QueueSpsc( BenchState & b ) {
+		QueueTest< SpscQueue< uint64 > >::Run( b, 1, 1, 1024 );
+	}
+	Benchmark QueueSpscBench( "queue/spsc", QueueSpsc );
+	
+	void QueueMpmc( BenchState & b ) {
+		QueueTest< LockFreeQueue< uint64 > >::Run( b, 4, 4, 1024 );
+	}
+	Benchmark QueueMpmcBench( "queue/mpmc", QueueMpmc );
+	
+	void QueueBlocking( BenchState & b ) {
+		QueueTest< BlockingQueue< uint64 > >::Run( b, 4, 4, 1024 );
+	}
+	Benchmark QueueBlockingBench( "queue/blocking", QueueBlocking );
+	
+	// With only two cells the queues are full or empty nearly all the time,
+	// and the positions wrap every other item, which is where sequence
+	// number mistakes show up.
+	void QueueSpscTight( BenchState & b ) {
+		QueueTest< SpscQueue< uint64 > >::Run( b, 1, 1, 2 );
+	}
+	Benchmark QueueSpscTightBench( "queue/spsc_tight", QueueSpscTight );
+	
+	void QueueMpmcTight( BenchState & b ) {
+		QueueTest< LockFreeQueue< uint64 > >::Run( b, 4, 4, 2 );
+	}
+	Benchmark QueueMpmcTightBench( "queue/mpmc_tight", QueueMpmcTight );
+	
+	void QueueBlockingTight( BenchState & b ) {
+		QueueTest< BlockingQueue< uint64 > >::Run( b, 4, 4, 2 );
+	}
+	Benchmark QueueBlockingTightBench( "queue/blocking_tight", QueueBlockingTight );
+	
+	// Every Post must be matched by exactly one Wait, with none left over
+	// and none lost, however the posts and waits interleave.
+	Semaphore semaphoreTest;
+	int64 semaphorePosts;
+	
+	void SemaphoreJob( int index ) {
+		for( int64 i = index; i < semaphorePosts; i += MaxWorkers ) {
+			semaphoreTest.Post();
+		}
+	}
+	
+	void SemaphoreCount( BenchState & b ) {
+		semaphorePosts = b.Iterations();
+		b.StartTimer();
+		RunWorkers( MaxWorkers, SemaphoreJob );
+		int64 waited = 0;
+		while( waited < semaphorePosts && semaphoreTest.TimedWait( 1.0 ) ) {
+			waited++;
+		}
+		b.StopTimer();
+		if( waited != semaphorePosts ) {
+			b.Fail( "waited %lld of %lld posts", waited, semaphorePosts );
+		}
+		if( semaphoreTest.TryWait() ) {
+			b.Fail( "semaphore has a count left after %lld posts", semaphorePosts );
+		}
+		// with nothing posted, a timed wait gives up after about its timeout
+		double waitStart = GetMonotonicSeconds();
+		bool acquired = semaphoreTest.TimedWait( 0.01 );
+		double waitTime = GetMonotonicSeconds() - waitStart;
+		if( acquired || waitTime < 0.009 || waitTime > 1.0 ) {
+			b.Fail( "a 10ms timed wait on an empty semaphore %s after %.1fms", acquired ? "succeeded" : "timed out", waitTime * 1000.0 );
+		}
+		b.SetItems( 1 );
+	}
+	Benchmark SemaphoreCountBench( "queue/semaphore", SemaphoreCount );
+	
+}
@@ -6,7 +6,10 @@
 #include "r3/gl.h"
 #include "r3/GL/entry.h"
 
-#if _WIN32
+#if R3_NULL_GL
+# include "r3/nullgl.h"
+# define r3GetProcAddress( proc ) NullGLGetProcAddress( proc )
+#elif _WIN32
 # define r3GetProcAddress wglGetProcAddress
 #elif __linux__
 # include <GL/glx.h>
@@ -14,3462 +17,347 @@
 #endif
 
 namespace r3 {
-    PFNGLACTIVEPROGRAMEXTPROC glActiveProgramEXT;
-    PFNGLACTIVESTENCILFACEEXTPROC glActiveStencilFaceEXT;
-    PFNGLACTIVETEXTUREPROC glActiveTexture;
-    PFNGLACTIVETEXTUREARBPROC glActiveTextureARB;
-    PFNGLACTIVEVARYINGNVPROC glActiveVaryingNV;
-    PFNGLALPHAFRAGMENTOP1ATIPROC glAlphaFragmentOp1ATI;
-    PFNGLALPHAFRAGMENTOP2ATIPROC glAlphaFragmentOp2ATI;
-    PFNGLALPHAFRAGMENTOP3ATIPROC glAlphaFragmentOp3ATI;
-    PFNGLAPPLYTEXTUREEXTPROC glApplyTextureEXT;
-    PFNGLAREPROGRAMSRESIDENTNVPROC glAreProgramsResidentNV;
-    PFNGLARETEXTURESRESIDENTEXTPROC glAreTexturesResidentEXT;
-    PFNGLARRAYELEMENTEXTPROC glArrayElementEXT;
-    PFNGLARRAYOBJECTATIPROC glArrayObjectATI;
-    PFNGLASYNCMARKERSGIXPROC glAsyncMarkerSGIX;
-    PFNGLATTACHOBJECTARBPROC glAttachObjectARB;
-    PFNGLATTACHSHADERPROC glAttachShader;
-    PFNGLBEGINCONDITIONALRENDERPROC glBeginConditionalRender;
-    PFNGLBEGINCONDITIONALRENDERNVPROC glBeginConditionalRenderNV;
-    PFNGLBEGINFRAGMENTSHADERATIPROC glBeginFragmentShaderATI;
-    PFNGLBEGINOCCLUSIONQUERYNVPROC glBeginOcclusionQueryNV;
-    PFNGLBEGINPERFMONITORAMDPROC glBeginPerfMonitorAMD;
-    PFNGLBEGINQUERYPROC glBeginQuery;
-    PFNGLBEGINQUERYARBPROC glBeginQueryARB;
-    PFNGLBEGINQUERYINDEXEDPROC glBeginQueryIndexed;
-    PFNGLBEGINTRANSFORMFEEDBACKPROC glBeginTransformFeedback;
-    PFNGLBEGINTRANSFORMFEEDBACKEXTPROC glBeginTransformFeedbackEXT;
-    PFNGLBEGINTRANSFORMFEEDBACKNVPROC glBeginTransformFeedbackNV;
-    PFNGLBEGINVERTEXSHADEREXTPROC glBeginVertexShaderEXT;
-    PFNGLBEGINVIDEOCAPTURENVPROC glBeginVideoCaptureNV;
-    PFNGLBINDATTRIBLOCATIONPROC glBindAttribLocation;
-    PFNGLBINDATTRIBLOCATIONARBPROC glBindAttribLocationARB;
-    PFNGLBINDBUFFERPROC glBindBuffer;
-    PFNGLBINDBUFFERARBPROC glBindBufferARB;
-    PFNGLBINDBUFFERBASEPROC glBindBufferBase;
-    PFNGLBINDBUFFERBASEEXTPROC glBindBufferBaseEXT;
-    PFNGLBINDBUFFERBASENVPROC glBindBufferBaseNV;
-    PFNGLBINDBUFFEROFFSETEXTPROC glBindBufferOffsetEXT;
-    PFNGLBINDBUFFEROFFSETNVPROC glBindBufferOffsetNV;
-    PFNGLBINDBUFFERRANGEPROC glBindBufferRange;
-    PFNGLBINDBUFFERRANGEEXTPROC glBindBufferRangeEXT;
-    PFNGLBINDBUFFERRANGENVPROC glBindBufferRangeNV;
-    PFNGLBINDFRAGDATALOCATIONPROC glBindFragDataLocation;
-    PFNGLBINDFRAGDATALOCATIONEXTPROC glBindFragDataLocationEXT;
-    PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glBindFragDataLocationIndexed;
-    PFNGLBINDFRAGMENTSHADERATIPROC glBindFragmentShaderATI;
-    PFNGLBINDFRAMEBUFFERPROC glBindFramebuffer;
-    PFNGLBINDFRAMEBUFFEREXTPROC glBindFramebufferEXT;
-    PFNGLBINDLIGHTPARAMETEREXTPROC glBindLightParameterEXT;
-    PFNGLBINDMATERIALPARAMETEREXTPROC glBindMaterialParameterEXT;
-    PFNGLBINDMULTITEXTUREEXTPROC glBindMultiTextureEXT;
-    PFNGLBINDPARAMETEREXTPROC glBindParameterEXT;
-    PFNGLBINDPROGRAMARBPROC glBindProgramARB;
-    PFNGLBINDPROGRAMNVPROC glBindProgramNV;
-    PFNGLBINDRENDERBUFFERPROC glBindRenderbuffer;
-    PFNGLBINDRENDERBUFFEREXTPROC glBindRenderbufferEXT;
-    PFNGLBINDSAMPLERPROC glBindSampler;
-    PFNGLBINDTEXGENPARAMETEREXTPROC glBindTexGenParameterEXT;
-    PFNGLBINDTEXTUREEXTPROC glBindTextureEXT;
-    PFNGLBINDTEXTUREUNITPARAMETEREXTPROC glBindTextureUnitParameterEXT;
-    PFNGLBINDTRANSFORMFEEDBACKPROC glBindTransformFeedback;
-    PFNGLBINDTRANSFORMFEEDBACKNVPROC glBindTransformFeedbackNV;
-    PFNGLBINDVERTEXARRAYPROC glBindVertexArray;
-    PFNGLBINDVERTEXARRAYAPPLEPROC glBindVertexArrayAPPLE;
-    PFNGLBINDVERTEXSHADEREXTPROC glBindVertexShaderEXT;
-    PFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC glBindVideoCaptureStreamBufferNV;
-    PFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC glBindVideoCaptureStreamTextureNV;
-    PFNGLBINORMAL3BEXTPROC glBinormal3bEXT;
-    PFNGLBINORMAL3BVEXTPROC glBinormal3bvEXT;
-    PFNGLBINORMAL3DEXTPROC glBinormal3dEXT;
-    PFNGLBINORMAL3DVEXTPROC glBinormal3dvEXT;
-    PFNGLBINORMAL3FEXTPROC glBinormal3fEXT;
-    PFNGLBINORMAL3FVEXTPROC glBinormal3fvEXT;
-    PFNGLBINORMAL3IEXTPROC glBinormal3iEXT;
-    PFNGLBINORMAL3IVEXTPROC glBinormal3ivEXT;
-    PFNGLBINORMAL3SEXTPROC glBinormal3sEXT;
-    PFNGLBINORMAL3SVEXTPROC glBinormal3svEXT;
-    PFNGLBINORMALPOINTEREXTPROC glBinormalPointerEXT;
-    PFNGLBLENDCOLORPROC glBlendColor;
-    PFNGLBLENDCOLOREXTPROC glBlendColorEXT;
-    PFNGLBLENDEQUATIONPROC glBlendEquation;
-    PFNGLBLENDEQUATIONEXTPROC glBlendEquationEXT;
-    PFNGLBLENDEQUATIONINDEXEDAMDPROC glBlendEquationIndexedAMD;
-    PFNGLBLENDEQUATIONSEPARATEPROC glBlendEquationSeparate;
-    PFNGLBLENDEQUATIONSEPARATEEXTPROC glBlendEquationSeparateEXT;
-    PFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC glBlendEquationSeparateIndexedAMD;
-    PFNGLBLENDEQUATIONSEPARATEIPROC glBlendEquationSeparatei;
-    PFNGLBLENDEQUATIONIPROC glBlendEquationi;
-    PFNGLBLENDFUNCINDEXEDAMDPROC glBlendFuncIndexedAMD;
-    PFNGLBLENDFUNCSEPARATEPROC glBlendFuncSeparate;
-    PFNGLBLENDFUNCSEPARATEEXTPROC glBlendFuncSeparateEXT;
-    PFNGLBLENDFUNCSEPARATEINGRPROC glBlendFuncSeparateINGR;
-    PFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC glBlendFuncSeparateIndexedAMD;
-    PFNGLBLENDFUNCSEPARATEIPROC glBlendFuncSeparatei;
-    PFNGLBLENDFUNCIPROC glBlendFunci;
-    PFNGLBLITFRAMEBUFFERPROC glBlitFramebuffer;
-    PFNGLBLITFRAMEBUFFEREXTPROC glBlitFramebufferEXT;
-    PFNGLBUFFERADDRESSRANGENVPROC glBufferAddressRangeNV;
-    PFNGLBUFFERDATAPROC glBufferData;
-    PFNGLBUFFERDATAARBPROC glBufferDataARB;
-    PFNGLBUFFERPARAMETERIAPPLEPROC glBufferParameteriAPPLE;
-    PFNGLBUFFERSUBDATAPROC glBufferSubData;
-    PFNGLBUFFERSUBDATAARBPROC glBufferSubDataARB;
-    PFNGLCHECKFRAMEBUFFERSTATUSPROC glCheckFramebufferStatus;
-    PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC glCheckFramebufferStatusEXT;
-    PFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC glCheckNamedFramebufferStatusEXT;
-    PFNGLCLAMPCOLORPROC glClampColor;
-    PFNGLCLAMPCOLORARBPROC glClampColorARB;
-    PFNGLCLEARBUFFERFIPROC glClearBufferfi;
-    PFNGLCLEARBUFFERFVPROC glClearBufferfv;
-    PFNGLCLEARBUFFERIVPROC glClearBufferiv;
-    PFNGLCLEARBUFFERUIVPROC glClearBufferuiv;
-    PFNGLCLEARCOLORIIEXTPROC glClearColorIiEXT;
-    PFNGLCLEARCOLORIUIEXTPROC glClearColorIuiEXT;
-    PFNGLCLEARDEPTHDNVPROC glClearDepthdNV;
-    PFNGLCLIENTACTIVETEXTUREPROC glClientActiveTexture;
-    PFNGLCLIENTACTIVETEXTUREARBPROC glClientActiveTextureARB;
-    PFNGLCLIENTACTIVEVERTEXSTREAMATIPROC glClientActiveVertexStreamATI;
-    PFNGLCLIENTATTRIBDEFAULTEXTPROC glClientAttribDefaultEXT;
-    PFNGLCLIENTWAITSYNCPROC glClientWaitSync;
-    PFNGLCOLOR3FVERTEX3FSUNPROC glColor3fVertex3fSUN;
-    PFNGLCOLOR3FVERTEX3FVSUNPROC glColor3fVertex3fvSUN;
-    PFNGLCOLOR3HNVPROC glColor3hNV;
-    PFNGLCOLOR3HVNVPROC glColor3hvNV;
-    PFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC glColor4fNormal3fVertex3fSUN;
-    PFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC glColor4fNormal3fVertex3fvSUN;
-    PFNGLCOLOR4HNVPROC glColor4hNV;
-    PFNGLCOLOR4HVNVPROC glColor4hvNV;
-    PFNGLCOLOR4UBVERTEX2FSUNPROC glColor4ubVertex2fSUN;
-    PFNGLCOLOR4UBVERTEX2FVSUNPROC glColor4ubVertex2fvSUN;
-    PFNGLCOLOR4UBVERTEX3FSUNPROC glColor4ubVertex3fSUN;
-    PFNGLCOLOR4UBVERTEX3FVSUNPROC glColor4ubVertex3fvSUN;
-    PFNGLCOLORFORMATNVPROC glColorFormatNV;
-    PFNGLCOLORFRAGMENTOP1ATIPROC glColorFragmentOp1ATI;
-    PFNGLCOLORFRAGMENTOP2ATIPROC glColorFragmentOp2ATI;
-    PFNGLCOLORFRAGMENTOP3ATIPROC glColorFragmentOp3ATI;
-    PFNGLCOLORMASKINDEXEDEXTPROC glColorMaskIndexedEXT;
-    PFNGLCOLORMASKIPROC glColorMaski;
-    PFNGLCOLORP3UIPROC glColorP3ui;
-    PFNGLCOLORP3UIVPROC glColorP3uiv;
-    PFNGLCOLORP4UIPROC glColorP4ui;
-    PFNGLCOLORP4UIVPROC glColorP4uiv;
-    PFNGLCOLORPOINTEREXTPROC glColorPointerEXT;
-    PFNGLCOLORPOINTERLISTIBMPROC glColorPointerListIBM;
-    PFNGLCOLORPOINTERVINTELPROC glColorPointervINTEL;
-    PFNGLCOLORSUBTABLEPROC glColorSubTable;
-    PFNGLCOLORSUBTABLEEXTPROC glColorSubTableEXT;
-    PFNGLCOLORTABLEPROC glColorTable;
-    PFNGLCOLORTABLEEXTPROC glColorTableEXT;
-    PFNGLCOLORTABLEPARAMETERFVPROC glColorTableParameterfv;
-    PFNGLCOLORTABLEPARAMETERFVSGIPROC glColorTableParameterfvSGI;
-    PFNGLCOLORTABLEPARAMETERIVPROC glColorTableParameteriv;
-    PFNGLCOLORTABLEPARAMETERIVSGIPROC glColorTableParameterivSGI;
-    PFNGLCOLORTABLESGIPROC glColorTableSGI;
-    PFNGLCOMBINERINPUTNVPROC glCombinerInputNV;
-    PFNGLCOMBINEROUTPUTNVPROC glCombinerOutputNV;
-    PFNGLCOMBINERPARAMETERFNVPROC glCombinerParameterfNV;
-    PFNGLCOMBINERPARAMETERFVNVPROC glCombinerParameterfvNV;
-    PFNGLCOMBINERPARAMETERINVPROC glCombinerParameteriNV;
-    PFNGLCOMBINERPARAMETERIVNVPROC glCombinerParameterivNV;
-    PFNGLCOMBINERSTAGEPARAMETERFVNVPROC glCombinerStageParameterfvNV;
-    PFNGLCOMPILESHADERPROC glCompileShader;
-    PFNGLCOMPILESHADERARBPROC glCompileShaderARB;
-    PFNGLCOMPILESHADERINCLUDEARBPROC glCompileShaderIncludeARB;
-    PFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC glCompressedMultiTexImage1DEXT;
-    PFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC glCompressedMultiTexImage2DEXT;
-    PFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC glCompressedMultiTexImage3DEXT;
-    PFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC glCompressedMultiTexSubImage1DEXT;
-    PFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC glCompressedMultiTexSubImage2DEXT;
-    PFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC glCompressedMultiTexSubImage3DEXT;
-    PFNGLCOMPRESSEDTEXIMAGE1DPROC glCompressedTexImage1D;
-    PFNGLCOMPRESSEDTEXIMAGE1DARBPROC glCompressedTexImage1DARB;
-    PFNGLCOMPRESSEDTEXIMAGE2DPROC glCompressedTexImage2D;
-    PFNGLCOMPRESSEDTEXIMAGE2DARBPROC glCompressedTexImage2DARB;
-    PFNGLCOMPRESSEDTEXIMAGE3DPROC glCompressedTexImage3D;
-    PFNGLCOMPRESSEDTEXIMAGE3DARBPROC glCompressedTexImage3DARB;
-    PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glCompressedTexSubImage1D;
-    PFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC glCompressedTexSubImage1DARB;
-    PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glCompressedTexSubImage2D;
-    PFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC glCompressedTexSubImage2DARB;
-    PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glCompressedTexSubImage3D;
-    PFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC glCompressedTexSubImage3DARB;
-    PFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC glCompressedTextureImage1DEXT;
-    PFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC glCompressedTextureImage2DEXT;
-    PFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC glCompressedTextureImage3DEXT;
-    PFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC glCompressedTextureSubImage1DEXT;
-    PFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC glCompressedTextureSubImage2DEXT;
-    PFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC glCompressedTextureSubImage3DEXT;
-    PFNGLCONVOLUTIONFILTER1DPROC glConvolutionFilter1D;
-    PFNGLCONVOLUTIONFILTER1DEXTPROC glConvolutionFilter1DEXT;
-    PFNGLCONVOLUTIONFILTER2DPROC glConvolutionFilter2D;
-    PFNGLCONVOLUTIONFILTER2DEXTPROC glConvolutionFilter2DEXT;
-    PFNGLCONVOLUTIONPARAMETERFPROC glConvolutionParameterf;
-    PFNGLCONVOLUTIONPARAMETERFEXTPROC glConvolutionParameterfEXT;
-    PFNGLCONVOLUTIONPARAMETERFVPROC glConvolutionParameterfv;
-    PFNGLCONVOLUTIONPARAMETERFVEXTPROC glConvolutionParameterfvEXT;
-    PFNGLCONVOLUTIONPARAMETERIPROC glConvolutionParameteri;
-    PFNGLCONVOLUTIONPARAMETERIEXTPROC glConvolutionParameteriEXT;
-    PFNGLCONVOLUTIONPARAMETERIVPROC glConvolutionParameteriv;
-    PFNGLCONVOLUTIONPARAMETERIVEXTPROC glConvolutionParameterivEXT;
-    PFNGLCOPYBUFFERSUBDATAPROC glCopyBufferSubData;
-    PFNGLCOPYCOLORSUBTABLEPROC glCopyColorSubTable;
-    PFNGLCOPYCOLORSUBTABLEEXTPROC glCopyColorSubTableEXT;
-    PFNGLCOPYCOLORTABLEPROC glCopyColorTable;
-    PFNGLCOPYCOLORTABLESGIPROC glCopyColorTableSGI;
-    PFNGLCOPYCONVOLUTIONFILTER1DPROC glCopyConvolutionFilter1D;
-    PFNGLCOPYCONVOLUTIONFILTER1DEXTPROC glCopyConvolutionFilter1DEXT;
-    PFNGLCOPYCONVOLUTIONFILTER2DPROC glCopyConvolutionFilter2D;
-    PFNGLCOPYCONVOLUTIONFILTER2DEXTPROC glCopyConvolutionFilter2DEXT;
-    PFNGLCOPYIMAGESUBDATANVPROC glCopyImageSubDataNV;
-    PFNGLCOPYMULTITEXIMAGE1DEXTPROC glCopyMultiTexImage1DEXT;
-    PFNGLCOPYMULTITEXIMAGE2DEXTPROC glCopyMultiTexImage2DEXT;
-    PFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC glCopyMultiTexSubImage1DEXT;
-    PFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC glCopyMultiTexSubImage2DEXT;
-    PFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC glCopyMultiTexSubImage3DEXT;
-    PFNGLCOPYTEXIMAGE1DEXTPROC glCopyTexImage1DEXT;
-    PFNGLCOPYTEXIMAGE2DEXTPROC glCopyTexImage2DEXT;
-    PFNGLCOPYTEXSUBIMAGE1DEXTPROC glCopyTexSubImage1DEXT;
-    PFNGLCOPYTEXSUBIMAGE2DEXTPROC glCopyTexSubImage2DEXT;
-    PFNGLCOPYTEXSUBIMAGE3DPROC glCopyTexSubImage3D;
-    PFNGLCOPYTEXSUBIMAGE3DEXTPROC glCopyTexSubImage3DEXT;
-    PFNGLCOPYTEXTUREIMAGE1DEXTPROC glCopyTextureImage1DEXT;
-    PFNGLCOPYTEXTUREIMAGE2DEXTPROC glCopyTextureImage2DEXT;
-    PFNGLCOPYTEXTURESUBIMAGE1DEXTPROC glCopyTextureSubImage1DEXT;
-    PFNGLCOPYTEXTURESUBIMAGE2DEXTPROC glCopyTextureSubImage2DEXT;
-    PFNGLCOPYTEXTURESUBIMAGE3DEXTPROC glCopyTextureSubImage3DEXT;
-    PFNGLCREATEPROGRAMPROC glCreateProgram;
-    PFNGLCREATEPROGRAMOBJECTARBPROC glCreateProgramObjectARB;
-    PFNGLCREATESHADERPROC glCreateShader;
-    PFNGLCREATESHADEROBJECTARBPROC glCreateShaderObjectARB;
-    PFNGLCREATESHADERPROGRAMEXTPROC glCreateShaderProgramEXT;
-    PFNGLCULLPARAMETERDVEXTPROC glCullParameterdvEXT;
-    PFNGLCULLPARAMETERFVEXTPROC glCullParameterfvEXT;
-    PFNGLCURRENTPALETTEMATRIXARBPROC glCurrentPaletteMatrixARB;
-    PFNGLDEFORMSGIXPROC glDeformSGIX;
-    PFNGLDEFORMATIONMAP3DSGIXPROC glDeformationMap3dSGIX;
-    PFNGLDEFORMATIONMAP3FSGIXPROC glDeformationMap3fSGIX;
-    PFNGLDELETEASYNCMARKERSSGIXPROC glDeleteAsyncMarkersSGIX;
-    PFNGLDELETEBUFFERSPROC glDeleteBuffers;
-    PFNGLDELETEBUFFERSARBPROC glDeleteBuffersARB;
-    PFNGLDELETEFENCESAPPLEPROC glDeleteFencesAPPLE;
-    PFNGLDELETEFENCESNVPROC glDeleteFencesNV;
-    PFNGLDELETEFRAGMENTSHADERATIPROC glDeleteFragmentShaderATI;
-    PFNGLDELETEFRAMEBUFFERSPROC glDeleteFramebuffers;
-    PFNGLDELETEFRAMEBUFFERSEXTPROC glDeleteFramebuffersEXT;
-    PFNGLDELETENAMEDSTRINGARBPROC glDeleteNamedStringARB;
-    PFNGLDELETEOBJECTARBPROC glDeleteObjectARB;
-    PFNGLDELETEOCCLUSIONQUERIESNVPROC glDeleteOcclusionQueriesNV;
-    PFNGLDELETEPERFMONITORSAMDPROC glDeletePerfMonitorsAMD;
-    PFNGLDELETEPROGRAMPROC glDeleteProgram;
-    PFNGLDELETEPROGRAMSARBPROC glDeleteProgramsARB;
-    PFNGLDELETEPROGRAMSNVPROC glDeleteProgramsNV;
-    PFNGLDELETEQUERIESPROC glDeleteQueries;
-    PFNGLDELETEQUERIESARBPROC glDeleteQueriesARB;
-    PFNGLDELETERENDERBUFFERSPROC glDeleteRenderbuffers;
-    PFNGLDELETERENDERBUFFERSEXTPROC glDeleteRenderbuffersEXT;
-    PFNGLDELETESAMPLERSPROC glDeleteSamplers;
-    PFNGLDELETESHADERPROC glDeleteShader;
-    PFNGLDELETESYNCPROC glDeleteSync;
-    PFNGLDELETETEXTURESEXTPROC glDeleteTexturesEXT;
-    PFNGLDELETETRANSFORMFEEDBACKSPROC glDeleteTransformFeedbacks;
-    PFNGLDELETETRANSFORMFEEDBACKSNVPROC glDeleteTransformFeedbacksNV;
-    PFNGLDELETEVERTEXARRAYSPROC glDeleteVertexArrays;
-    PFNGLDELETEVERTEXARRAYSAPPLEPROC glDeleteVertexArraysAPPLE;
-    PFNGLDELETEVERTEXSHADEREXTPROC glDeleteVertexShaderEXT;
-    PFNGLDEPTHBOUNDSEXTPROC glDepthBoundsEXT;
-    PFNGLDEPTHBOUNDSDNVPROC glDepthBoundsdNV;
-    PFNGLDEPTHRANGEDNVPROC glDepthRangedNV;
-    PFNGLDETACHOBJECTARBPROC glDetachObjectARB;
-    PFNGLDETACHSHADERPROC glDetachShader;
-    PFNGLDETAILTEXFUNCSGISPROC glDetailTexFuncSGIS;
-    PFNGLDISABLECLIENTSTATEINDEXEDEXTPROC glDisableClientStateIndexedEXT;
-    PFNGLDISABLEINDEXEDEXTPROC glDisableIndexedEXT;
-    PFNGLDISABLEVARIANTCLIENTSTATEEXTPROC glDisableVariantClientStateEXT;
-    PFNGLDISABLEVERTEXATTRIBAPPLEPROC glDisableVertexAttribAPPLE;
-    PFNGLDISABLEVERTEXATTRIBARRAYPROC glDisableVertexAttribArray;
-    PFNGLDISABLEVERTEXATTRIBARRAYARBPROC glDisableVertexAttribArrayARB;
-    PFNGLDISABLEIPROC glDisablei;
-    PFNGLDRAWARRAYSEXTPROC glDrawArraysEXT;
-    PFNGLDRAWARRAYSINDIRECTPROC glDrawArraysIndirect;
-    PFNGLDRAWARRAYSINSTANCEDPROC glDrawArraysInstanced;
-    PFNGLDRAWARRAYSINSTANCEDARBPROC glDrawArraysInstancedARB;
-    PFNGLDRAWARRAYSINSTANCEDEXTPROC glDrawArraysInstancedEXT;
-    PFNGLDRAWBUFFERSPROC glDrawBuffers;
-    PFNGLDRAWBUFFERSARBPROC glDrawBuffersARB;
-    PFNGLDRAWBUFFERSATIPROC glDrawBuffersATI;
-    PFNGLDRAWELEMENTARRAYAPPLEPROC glDrawElementArrayAPPLE;
-    PFNGLDRAWELEMENTARRAYATIPROC glDrawElementArrayATI;
-    PFNGLDRAWELEMENTSBASEVERTEXPROC glDrawElementsBaseVertex;
-    PFNGLDRAWELEMENTSINDIRECTPROC glDrawElementsIndirect;
-    PFNGLDRAWELEMENTSINSTANCEDPROC glDrawElementsInstanced;
-    PFNGLDRAWELEMENTSINSTANCEDARBPROC glDrawElementsInstancedARB;
-    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glDrawElementsInstancedBaseVertex;
-    PFNGLDRAWELEMENTSINSTANCEDEXTPROC glDrawElementsInstancedEXT;
-    PFNGLDRAWMESHARRAYSSUNPROC glDrawMeshArraysSUN;
-    PFNGLDRAWRANGEELEMENTARRAYAPPLEPROC glDrawRangeElementArrayAPPLE;
-    PFNGLDRAWRANGEELEMENTARRAYATIPROC glDrawRangeElementArrayATI;
-    PFNGLDRAWRANGEELEMENTSPROC glDrawRangeElements;
-    PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glDrawRangeElementsBaseVertex;
-    PFNGLDRAWRANGEELEMENTSEXTPROC glDrawRangeElementsEXT;
-    PFNGLDRAWTRANSFORMFEEDBACKPROC glDrawTransformFeedback;
-    PFNGLDRAWTRANSFORMFEEDBACKNVPROC glDrawTransformFeedbackNV;
-    PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glDrawTransformFeedbackStream;
-    PFNGLEDGEFLAGFORMATNVPROC glEdgeFlagFormatNV;
-    PFNGLEDGEFLAGPOINTEREXTPROC glEdgeFlagPointerEXT;
-    PFNGLEDGEFLAGPOINTERLISTIBMPROC glEdgeFlagPointerListIBM;
-    PFNGLELEMENTPOINTERAPPLEPROC glElementPointerAPPLE;
-    PFNGLELEMENTPOINTERATIPROC glElementPointerATI;
-    PFNGLENABLECLIENTSTATEINDEXEDEXTPROC glEnableClientStateIndexedEXT;
-    PFNGLENABLEINDEXEDEXTPROC glEnableIndexedEXT;
-    PFNGLENABLEVARIANTCLIENTSTATEEXTPROC glEnableVariantClientStateEXT;
-    PFNGLENABLEVERTEXATTRIBAPPLEPROC glEnableVertexAttribAPPLE;
-    PFNGLENABLEVERTEXATTRIBARRAYPROC glEnableVertexAttribArray;
-    PFNGLENABLEVERTEXATTRIBARRAYARBPROC glEnableVertexAttribArrayARB;
-    PFNGLENABLEIPROC glEnablei;
-    PFNGLENDCONDITIONALRENDERPROC glEndConditionalRender;
-    PFNGLENDCONDITIONALRENDERNVPROC glEndConditionalRenderNV;
-    PFNGLENDFRAGMENTSHADERATIPROC glEndFragmentShaderATI;
-    PFNGLENDOCCLUSIONQUERYNVPROC glEndOcclusionQueryNV;
-    PFNGLENDPERFMONITORAMDPROC glEndPerfMonitorAMD;
-    PFNGLENDQUERYPROC glEndQuery;
-    PFNGLENDQUERYARBPROC glEndQueryARB;
-    PFNGLENDQUERYINDEXEDPROC glEndQueryIndexed;
-    PFNGLENDTRANSFORMFEEDBACKPROC glEndTransformFeedback;
-    PFNGLENDTRANSFORMFEEDBACKEXTPROC glEndTransformFeedbackEXT;
-    PFNGLENDTRANSFORMFEEDBACKNVPROC glEndTransformFeedbackNV;
-    PFNGLENDVERTEXSHADEREXTPROC glEndVertexShaderEXT;
-    PFNGLENDVIDEOCAPTURENVPROC glEndVideoCaptureNV;
-    PFNGLEVALMAPSNVPROC glEvalMapsNV;
-    PFNGLEXECUTEPROGRAMNVPROC glExecuteProgramNV;
-    PFNGLEXTRACTCOMPONENTEXTPROC glExtractComponentEXT;
-    PFNGLFENCESYNCPROC glFenceSync;
-    PFNGLFINALCOMBINERINPUTNVPROC glFinalCombinerInputNV;
-    PFNGLFINISHASYNCSGIXPROC glFinishAsyncSGIX;
-    PFNGLFINISHFENCEAPPLEPROC glFinishFenceAPPLE;
-    PFNGLFINISHFENCENVPROC glFinishFenceNV;
-    PFNGLFINISHOBJECTAPPLEPROC glFinishObjectAPPLE;
-    PFNGLFINISHTEXTURESUNXPROC glFinishTextureSUNX;
-    PFNGLFLUSHMAPPEDBUFFERRANGEPROC glFlushMappedBufferRange;
-    PFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC glFlushMappedBufferRangeAPPLE;
-    PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC glFlushMappedNamedBufferRangeEXT;
-    PFNGLFLUSHPIXELDATARANGENVPROC glFlushPixelDataRangeNV;
-    PFNGLFLUSHRASTERSGIXPROC glFlushRasterSGIX;
-    PFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC glFlushVertexArrayRangeAPPLE;
-    PFNGLFLUSHVERTEXARRAYRANGENVPROC glFlushVertexArrayRangeNV;
-    PFNGLFOGCOORDFORMATNVPROC glFogCoordFormatNV;
-    PFNGLFOGCOORDPOINTERPROC glFogCoordPointer;
-    PFNGLFOGCOORDPOINTEREXTPROC glFogCoordPointerEXT;
-    PFNGLFOGCOORDPOINTERLISTIBMPROC glFogCoordPointerListIBM;
-    PFNGLFOGCOORDDPROC glFogCoordd;
-    PFNGLFOGCOORDDEXTPROC glFogCoorddEXT;
-    PFNGLFOGCOORDDVPROC glFogCoorddv;
-    PFNGLFOGCOORDDVEXTPROC glFogCoorddvEXT;
-    PFNGLFOGCOORDFPROC glFogCoordf;
-    PFNGLFOGCOORDFEXTPROC glFogCoordfEXT;
-    PFNGLFOGCOORDFVPROC glFogCoordfv;
-    PFNGLFOGCOORDFVEXTPROC glFogCoordfvEXT;
-    PFNGLFOGCOORDHNVPROC glFogCoordhNV;
-    PFNGLFOGCOORDHVNVPROC glFogCoordhvNV;
-    PFNGLFOGFUNCSGISPROC glFogFuncSGIS;
-    PFNGLFRAGMENTCOLORMATERIALSGIXPROC glFragmentColorMaterialSGIX;
-    PFNGLFRAGMENTLIGHTMODELFSGIXPROC glFragmentLightModelfSGIX;
-    PFNGLFRAGMENTLIGHTMODELFVSGIXPROC glFragmentLightModelfvSGIX;
-    PFNGLFRAGMENTLIGHTMODELISGIXPROC glFragmentLightModeliSGIX;
-    PFNGLFRAGMENTLIGHTMODELIVSGIXPROC glFragmentLightModelivSGIX;
-    PFNGLFRAGMENTLIGHTFSGIXPROC glFragmentLightfSGIX;
-    PFNGLFRAGMENTLIGHTFVSGIXPROC glFragmentLightfvSGIX;
-    PFNGLFRAGMENTLIGHTISGIXPROC glFragmentLightiSGIX;
-    PFNGLFRAGMENTLIGHTIVSGIXPROC glFragmentLightivSGIX;
-    PFNGLFRAGMENTMATERIALFSGIXPROC glFragmentMaterialfSGIX;
-    PFNGLFRAGMENTMATERIALFVSGIXPROC glFragmentMaterialfvSGIX;
-    PFNGLFRAGMENTMATERIALISGIXPROC glFragmentMaterialiSGIX;
-    PFNGLFRAGMENTMATERIALIVSGIXPROC glFragmentMaterialivSGIX;
-    PFNGLFRAMETERMINATORGREMEDYPROC glFrameTerminatorGREMEDY;
-    PFNGLFRAMEZOOMSGIXPROC glFrameZoomSGIX;
-    PFNGLFRAMEBUFFERDRAWBUFFEREXTPROC glFramebufferDrawBufferEXT;
-    PFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC glFramebufferDrawBuffersEXT;
-    PFNGLFRAMEBUFFERREADBUFFEREXTPROC glFramebufferReadBufferEXT;
-    PFNGLFRAMEBUFFERRENDERBUFFERPROC glFramebufferRenderbuffer;
-    PFNGLFRAMEBUFFERRENDERBUFFEREXTPROC glFramebufferRenderbufferEXT;
-    PFNGLFRAMEBUFFERTEXTUREPROC glFramebufferTexture;
-    PFNGLFRAMEBUFFERTEXTURE1DPROC glFramebufferTexture1D;
-    PFNGLFRAMEBUFFERTEXTURE1DEXTPROC glFramebufferTexture1DEXT;
-    PFNGLFRAMEBUFFERTEXTURE2DPROC glFramebufferTexture2D;
-    PFNGLFRAMEBUFFERTEXTURE2DEXTPROC glFramebufferTexture2DEXT;
-    PFNGLFRAMEBUFFERTEXTURE3DPROC glFramebufferTexture3D;
-    PFNGLFRAMEBUFFERTEXTURE3DEXTPROC glFramebufferTexture3DEXT;
-    PFNGLFRAMEBUFFERTEXTUREARBPROC glFramebufferTextureARB;
-    PFNGLFRAMEBUFFERTEXTUREEXTPROC glFramebufferTextureEXT;
-    PFNGLFRAMEBUFFERTEXTUREFACEARBPROC glFramebufferTextureFaceARB;
-    PFNGLFRAMEBUFFERTEXTUREFACEEXTPROC glFramebufferTextureFaceEXT;
-    PFNGLFRAMEBUFFERTEXTURELAYERPROC glFramebufferTextureLayer;
-    PFNGLFRAMEBUFFERTEXTURELAYERARBPROC glFramebufferTextureLayerARB;
-    PFNGLFRAMEBUFFERTEXTURELAYEREXTPROC glFramebufferTextureLayerEXT;
-    PFNGLFREEOBJECTBUFFERATIPROC glFreeObjectBufferATI;
-    PFNGLGENASYNCMARKERSSGIXPROC glGenAsyncMarkersSGIX;
-    PFNGLGENBUFFERSPROC glGenBuffers;
-    PFNGLGENBUFFERSARBPROC glGenBuffersARB;
-    PFNGLGENFENCESAPPLEPROC glGenFencesAPPLE;
-    PFNGLGENFENCESNVPROC glGenFencesNV;
-    PFNGLGENFRAGMENTSHADERSATIPROC glGenFragmentShadersATI;
-    PFNGLGENFRAMEBUFFERSPROC glGenFramebuffers;
-    PFNGLGENFRAMEBUFFERSEXTPROC glGenFramebuffersEXT;
-    PFNGLGENOCCLUSIONQUERIESNVPROC glGenOcclusionQueriesNV;
-    PFNGLGENPERFMONITORSAMDPROC glGenPerfMonitorsAMD;
-    PFNGLGENPROGRAMSARBPROC glGenProgramsARB;
-    PFNGLGENPROGRAMSNVPROC glGenProgramsNV;
-    PFNGLGENQUERIESPROC glGenQueries;
-    PFNGLGENQUERIESARBPROC glGenQueriesARB;
-    PFNGLGENRENDERBUFFERSPROC glGenRenderbuffers;
-    PFNGLGENRENDERBUFFERSEXTPROC glGenRenderbuffersEXT;
-    PFNGLGENSAMPLERSPROC glGenSamplers;
-    PFNGLGENSYMBOLSEXTPROC glGenSymbolsEXT;
-    PFNGLGENTEXTURESEXTPROC glGenTexturesEXT;
-    PFNGLGENTRANSFORMFEEDBACKSPROC glGenTransformFeedbacks;
-    PFNGLGENTRANSFORMFEEDBACKSNVPROC glGenTransformFeedbacksNV;
-    PFNGLGENVERTEXARRAYSPROC glGenVertexArrays;
-    PFNGLGENVERTEXARRAYSAPPLEPROC glGenVertexArraysAPPLE;
-    PFNGLGENVERTEXSHADERSEXTPROC glGenVertexShadersEXT;
-    PFNGLGENERATEMIPMAPPROC glGenerateMipmap;
-    PFNGLGENERATEMIPMAPEXTPROC glGenerateMipmapEXT;
-    PFNGLGENERATEMULTITEXMIPMAPEXTPROC glGenerateMultiTexMipmapEXT;
-    PFNGLGENERATETEXTUREMIPMAPEXTPROC glGenerateTextureMipmapEXT;
-    PFNGLGETACTIVEATTRIBPROC glGetActiveAttrib;
-    PFNGLGETACTIVEATTRIBARBPROC glGetActiveAttribARB;
-    PFNGLGETACTIVESUBROUTINENAMEPROC glGetActiveSubroutineName;
-    PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glGetActiveSubroutineUniformName;
-    PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glGetActiveSubroutineUniformiv;
-    PFNGLGETACTIVEUNIFORMPROC glGetActiveUniform;
-    PFNGLGETACTIVEUNIFORMARBPROC glGetActiveUniformARB;
-    PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glGetActiveUniformBlockName;
-    PFNGLGETACTIVEUNIFORMBLOCKIVPROC glGetActiveUniformBlockiv;
-    PFNGLGETACTIVEUNIFORMNAMEPROC glGetActiveUniformName;
-    PFNGLGETACTIVEUNIFORMSIVPROC glGetActiveUniformsiv;
-    PFNGLGETACTIVEVARYINGNVPROC glGetActiveVaryingNV;
-    PFNGLGETARRAYOBJECTFVATIPROC glGetArrayObjectfvATI;
-    PFNGLGETARRAYOBJECTIVATIPROC glGetArrayObjectivATI;
-    PFNGLGETATTACHEDOBJECTSARBPROC glGetAttachedObjectsARB;
-    PFNGLGETATTACHEDSHADERSPROC glGetAttachedShaders;
-    PFNGLGETATTRIBLOCATIONPROC glGetAttribLocation;
-    PFNGLGETATTRIBLOCATIONARBPROC glGetAttribLocationARB;
-    PFNGLGETBOOLEANINDEXEDVEXTPROC glGetBooleanIndexedvEXT;
-    PFNGLGETBUFFERPARAMETERI64VPROC glGetBufferParameteri64v;
-    PFNGLGETBUFFERPARAMETERIVPROC glGetBufferParameteriv;
-    PFNGLGETBUFFERPARAMETERIVARBPROC glGetBufferParameterivARB;
-    PFNGLGETBUFFERPARAMETERUI64VNVPROC glGetBufferParameterui64vNV;
-    PFNGLGETBUFFERPOINTERVPROC glGetBufferPointerv;
-    PFNGLGETBUFFERPOINTERVARBPROC glGetBufferPointervARB;
-    PFNGLGETBUFFERSUBDATAPROC glGetBufferSubData;
-    PFNGLGETBUFFERSUBDATAARBPROC glGetBufferSubDataARB;
-    PFNGLGETCOLORTABLEPROC glGetColorTable;
-    PFNGLGETCOLORTABLEEXTPROC glGetColorTableEXT;
-    PFNGLGETCOLORTABLEPARAMETERFVPROC glGetColorTableParameterfv;
-    PFNGLGETCOLORTABLEPARAMETERFVEXTPROC glGetColorTableParameterfvEXT;
-    PFNGLGETCOLORTABLEPARAMETERFVSGIPROC glGetColorTableParameterfvSGI;
-    PFNGLGETCOLORTABLEPARAMETERIVPROC glGetColorTableParameteriv;
-    PFNGLGETCOLORTABLEPARAMETERIVEXTPROC glGetColorTableParameterivEXT;
-    PFNGLGETCOLORTABLEPARAMETERIVSGIPROC glGetColorTableParameterivSGI;
-    PFNGLGETCOLORTABLESGIPROC glGetColorTableSGI;
-    PFNGLGETCOMBINERINPUTPARAMETERFVNVPROC glGetCombinerInputParameterfvNV;
-    PFNGLGETCOMBINERINPUTPARAMETERIVNVPROC glGetCombinerInputParameterivNV;
-    PFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC glGetCombinerOutputParameterfvNV;
-    PFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC glGetCombinerOutputParameterivNV;
-    PFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC glGetCombinerStageParameterfvNV;
-    PFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC glGetCompressedMultiTexImageEXT;
-    PFNGLGETCOMPRESSEDTEXIMAGEPROC glGetCompressedTexImage;
-    PFNGLGETCOMPRESSEDTEXIMAGEARBPROC glGetCompressedTexImageARB;
-    PFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC glGetCompressedTextureImageEXT;
-    PFNGLGETCONVOLUTIONFILTERPROC glGetConvolutionFilter;
-    PFNGLGETCONVOLUTIONFILTEREXTPROC glGetConvolutionFilterEXT;
-    PFNGLGETCONVOLUTIONPARAMETERFVPROC glGetConvolutionParameterfv;
-    PFNGLGETCONVOLUTIONPARAMETERFVEXTPROC glGetConvolutionParameterfvEXT;
-    PFNGLGETCONVOLUTIONPARAMETERIVPROC glGetConvolutionParameteriv;
-    PFNGLGETCONVOLUTIONPARAMETERIVEXTPROC glGetConvolutionParameterivEXT;
-    PFNGLGETDETAILTEXFUNCSGISPROC glGetDetailTexFuncSGIS;
-    PFNGLGETDOUBLEINDEXEDVEXTPROC glGetDoubleIndexedvEXT;
-    PFNGLGETFENCEIVNVPROC glGetFenceivNV;
-    PFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC glGetFinalCombinerInputParameterfvNV;
-    PFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC glGetFinalCombinerInputParameterivNV;
-    PFNGLGETFLOATINDEXEDVEXTPROC glGetFloatIndexedvEXT;
-    PFNGLGETFOGFUNCSGISPROC glGetFogFuncSGIS;
-    PFNGLGETFRAGDATAINDEXPROC glGetFragDataIndex;
-    PFNGLGETFRAGDATALOCATIONPROC glGetFragDataLocation;
-    PFNGLGETFRAGDATALOCATIONEXTPROC glGetFragDataLocationEXT;
-    PFNGLGETFRAGMENTLIGHTFVSGIXPROC glGetFragmentLightfvSGIX;
-    PFNGLGETFRAGMENTLIGHTIVSGIXPROC glGetFragmentLightivSGIX;
-    PFNGLGETFRAGMENTMATERIALFVSGIXPROC glGetFragmentMaterialfvSGIX;
-    PFNGLGETFRAGMENTMATERIALIVSGIXPROC glGetFragmentMaterialivSGIX;
-    PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glGetFramebufferAttachmentParameteriv;
-    PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC glGetFramebufferAttachmentParameterivEXT;
-    PFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC glGetFramebufferParameterivEXT;
-    PFNGLGETHANDLEARBPROC glGetHandleARB;
-    PFNGLGETHISTOGRAMPROC glGetHistogram;
-    PFNGLGETHISTOGRAMEXTPROC glGetHistogramEXT;
-    PFNGLGETHISTOGRAMPARAMETERFVPROC glGetHistogramParameterfv;
-    PFNGLGETHISTOGRAMPARAMETERFVEXTPROC glGetHistogramParameterfvEXT;
-    PFNGLGETHISTOGRAMPARAMETERIVPROC glGetHistogramParameteriv;
-    PFNGLGETHISTOGRAMPARAMETERIVEXTPROC glGetHistogramParameterivEXT;
-    PFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC glGetImageTransformParameterfvHP;
-    PFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC glGetImageTransformParameterivHP;
-    PFNGLGETINFOLOGARBPROC glGetInfoLogARB;
-    PFNGLGETINSTRUMENTSSGIXPROC glGetInstrumentsSGIX;
-    PFNGLGETINTEGER64VPROC glGetInteger64v;
-    PFNGLGETINTEGERINDEXEDVEXTPROC glGetIntegerIndexedvEXT;
-    PFNGLGETINTEGERUI64VNVPROC glGetIntegerui64vNV;
-    PFNGLGETINVARIANTBOOLEANVEXTPROC glGetInvariantBooleanvEXT;
-    PFNGLGETINVARIANTFLOATVEXTPROC glGetInvariantFloatvEXT;
-    PFNGLGETINVARIANTINTEGERVEXTPROC glGetInvariantIntegervEXT;
-    PFNGLGETLISTPARAMETERFVSGIXPROC glGetListParameterfvSGIX;
-    PFNGLGETLISTPARAMETERIVSGIXPROC glGetListParameterivSGIX;
-    PFNGLGETLOCALCONSTANTBOOLEANVEXTPROC glGetLocalConstantBooleanvEXT;
-    PFNGLGETLOCALCONSTANTFLOATVEXTPROC glGetLocalConstantFloatvEXT;
-    PFNGLGETLOCALCONSTANTINTEGERVEXTPROC glGetLocalConstantIntegervEXT;
-    PFNGLGETMAPATTRIBPARAMETERFVNVPROC glGetMapAttribParameterfvNV;
-    PFNGLGETMAPATTRIBPARAMETERIVNVPROC glGetMapAttribParameterivNV;
-    PFNGLGETMAPCONTROLPOINTSNVPROC glGetMapControlPointsNV;
-    PFNGLGETMAPPARAMETERFVNVPROC glGetMapParameterfvNV;
-    PFNGLGETMAPPARAMETERIVNVPROC glGetMapParameterivNV;
-    PFNGLGETMINMAXPROC glGetMinmax;
-    PFNGLGETMINMAXEXTPROC glGetMinmaxEXT;
-    PFNGLGETMINMAXPARAMETERFVPROC glGetMinmaxParameterfv;
-    PFNGLGETMINMAXPARAMETERFVEXTPROC glGetMinmaxParameterfvEXT;
-    PFNGLGETMINMAXPARAMETERIVPROC glGetMinmaxParameteriv;
-    PFNGLGETMINMAXPARAMETERIVEXTPROC glGetMinmaxParameterivEXT;
-    PFNGLGETMULTITEXENVFVEXTPROC glGetMultiTexEnvfvEXT;
-    PFNGLGETMULTITEXENVIVEXTPROC glGetMultiTexEnvivEXT;
-    PFNGLGETMULTITEXGENDVEXTPROC glGetMultiTexGendvEXT;
-    PFNGLGETMULTITEXGENFVEXTPROC glGetMultiTexGenfvEXT;
-    PFNGLGETMULTITEXGENIVEXTPROC glGetMultiTexGenivEXT;
-    PFNGLGETMULTITEXIMAGEEXTPROC glGetMultiTexImageEXT;
-    PFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC glGetMultiTexLevelParameterfvEXT;
-    PFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC glGetMultiTexLevelParameterivEXT;
-    PFNGLGETMULTITEXPARAMETERIIVEXTPROC glGetMultiTexParameterIivEXT;
-    PFNGLGETMULTITEXPARAMETERIUIVEXTPROC glGetMultiTexParameterIuivEXT;
-    PFNGLGETMULTITEXPARAMETERFVEXTPROC glGetMultiTexParameterfvEXT;
-    PFNGLGETMULTITEXPARAMETERIVEXTPROC glGetMultiTexParameterivEXT;
-    PFNGLGETMULTISAMPLEFVPROC glGetMultisamplefv;
-    PFNGLGETMULTISAMPLEFVNVPROC glGetMultisamplefvNV;
-    PFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC glGetNamedBufferParameterivEXT;
-    PFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC glGetNamedBufferParameterui64vNV;
-    PFNGLGETNAMEDBUFFERPOINTERVEXTPROC glGetNamedBufferPointervEXT;
-    PFNGLGETNAMEDBUFFERSUBDATAEXTPROC glGetNamedBufferSubDataEXT;
-    PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC glGetNamedFramebufferAttachmentParameterivEXT;
-    PFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC glGetNamedProgramLocalParameterIivEXT;
-    PFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC glGetNamedProgramLocalParameterIuivEXT;
-    PFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC glGetNamedProgramLocalParameterdvEXT;
-    PFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC glGetNamedProgramLocalParameterfvEXT;
-    PFNGLGETNAMEDPROGRAMSTRINGEXTPROC glGetNamedProgramStringEXT;
-    PFNGLGETNAMEDPROGRAMIVEXTPROC glGetNamedProgramivEXT;
-    PFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC glGetNamedRenderbufferParameterivEXT;
-    PFNGLGETNAMEDSTRINGARBPROC glGetNamedStringARB;
-    PFNGLGETNAMEDSTRINGIVARBPROC glGetNamedStringivARB;
-    PFNGLGETOBJECTBUFFERFVATIPROC glGetObjectBufferfvATI;
-    PFNGLGETOBJECTBUFFERIVATIPROC glGetObjectBufferivATI;
-    PFNGLGETOBJECTPARAMETERFVARBPROC glGetObjectParameterfvARB;
-    PFNGLGETOBJECTPARAMETERIVAPPLEPROC glGetObjectParameterivAPPLE;
-    PFNGLGETOBJECTPARAMETERIVARBPROC glGetObjectParameterivARB;
-    PFNGLGETOCCLUSIONQUERYIVNVPROC glGetOcclusionQueryivNV;
-    PFNGLGETOCCLUSIONQUERYUIVNVPROC glGetOcclusionQueryuivNV;
-    PFNGLGETPERFMONITORCOUNTERDATAAMDPROC glGetPerfMonitorCounterDataAMD;
-    PFNGLGETPERFMONITORCOUNTERINFOAMDPROC glGetPerfMonitorCounterInfoAMD;
-    PFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC glGetPerfMonitorCounterStringAMD;
-    PFNGLGETPERFMONITORCOUNTERSAMDPROC glGetPerfMonitorCountersAMD;
-    PFNGLGETPERFMONITORGROUPSTRINGAMDPROC glGetPerfMonitorGroupStringAMD;
-    PFNGLGETPERFMONITORGROUPSAMDPROC glGetPerfMonitorGroupsAMD;
-    PFNGLGETPIXELTEXGENPARAMETERFVSGISPROC glGetPixelTexGenParameterfvSGIS;
-    PFNGLGETPIXELTEXGENPARAMETERIVSGISPROC glGetPixelTexGenParameterivSGIS;
-    PFNGLGETPOINTERINDEXEDVEXTPROC glGetPointerIndexedvEXT;
-    PFNGLGETPOINTERVEXTPROC glGetPointervEXT;
-    PFNGLGETPROGRAMENVPARAMETERIIVNVPROC glGetProgramEnvParameterIivNV;
-    PFNGLGETPROGRAMENVPARAMETERIUIVNVPROC glGetProgramEnvParameterIuivNV;
-    PFNGLGETPROGRAMENVPARAMETERDVARBPROC glGetProgramEnvParameterdvARB;
-    PFNGLGETPROGRAMENVPARAMETERFVARBPROC glGetProgramEnvParameterfvARB;
-    PFNGLGETPROGRAMINFOLOGPROC glGetProgramInfoLog;
-    PFNGLGETPROGRAMLOCALPARAMETERIIVNVPROC glGetProgramLocalParameterIivNV;
-    PFNGLGETPROGRAMLOCALPARAMETERIUIVNVPROC glGetProgramLocalParameterIuivNV;
-    PFNGLGETPROGRAMLOCALPARAMETERDVARBPROC glGetProgramLocalParameterdvARB;
-    PFNGLGETPROGRAMLOCALPARAMETERFVARBPROC glGetProgramLocalParameterfvARB;
-    PFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC glGetProgramNamedParameterdvNV;
-    PFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC glGetProgramNamedParameterfvNV;
-    PFNGLGETPROGRAMPARAMETERDVNVPROC glGetProgramParameterdvNV;
-    PFNGLGETPROGRAMPARAMETERFVNVPROC glGetProgramParameterfvNV;
-    PFNGLGETPROGRAMSTAGEIVPROC glGetProgramStageiv;
-    PFNGLGETPROGRAMSTRINGARBPROC glGetProgramStringARB;
-    PFNGLGETPROGRAMSTRINGNVPROC glGetProgramStringNV;
-    PFNGLGETPROGRAMIVPROC glGetProgramiv;
-    PFNGLGETPROGRAMIVARBPROC glGetProgramivARB;
-    PFNGLGETPROGRAMIVNVPROC glGetProgramivNV;
-    PFNGLGETQUERYINDEXEDIVPROC glGetQueryIndexediv;
-    PFNGLGETQUERYOBJECTI64VPROC glGetQueryObjecti64v;
-    PFNGLGETQUERYOBJECTI64VEXTPROC glGetQueryObjecti64vEXT;
-    PFNGLGETQUERYOBJECTIVPROC glGetQueryObjectiv;
-    PFNGLGETQUERYOBJECTIVARBPROC glGetQueryObjectivARB;
-    PFNGLGETQUERYOBJECTUI64VPROC glGetQueryObjectui64v;
-    PFNGLGETQUERYOBJECTUI64VEXTPROC glGetQueryObjectui64vEXT;
-    PFNGLGETQUERYOBJECTUIVPROC glGetQueryObjectuiv;
-    PFNGLGETQUERYOBJECTUIVARBPROC glGetQueryObjectuivARB;
-    PFNGLGETQUERYIVPROC glGetQueryiv;
-    PFNGLGETQUERYIVARBPROC glGetQueryivARB;
-    PFNGLGETRENDERBUFFERPARAMETERIVPROC glGetRenderbufferParameteriv;
-    PFNGLGETRENDERBUFFERPARAMETERIVEXTPROC glGetRenderbufferParameterivEXT;
-    PFNGLGETSAMPLERPARAMETERIFVPROC glGetSamplerParameterIfv;
-    PFNGLGETSAMPLERPARAMETERIIVPROC glGetSamplerParameterIiv;
-    PFNGLGETSAMPLERPARAMETERFVPROC glGetSamplerParameterfv;
-    PFNGLGETSAMPLERPARAMETERIVPROC glGetSamplerParameteriv;
-    PFNGLGETSEPARABLEFILTERPROC glGetSeparableFilter;
-    PFNGLGETSEPARABLEFILTEREXTPROC glGetSeparableFilterEXT;
-    PFNGLGETSHADERINFOLOGPROC glGetShaderInfoLog;
-    PFNGLGETSHADERSOURCEPROC glGetShaderSource;
-    PFNGLGETSHADERSOURCEARBPROC glGetShaderSourceARB;
-    PFNGLGETSHADERIVPROC glGetShaderiv;
-    PFNGLGETSHARPENTEXFUNCSGISPROC glGetSharpenTexFuncSGIS;
-    PFNGLGETSTRINGIPROC glGetStringi;
-    PFNGLGETSUBROUTINEINDEXPROC glGetSubroutineIndex;
-    PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glGetSubroutineUniformLocation;
-    PFNGLGETSYNCIVPROC glGetSynciv;
-    PFNGLGETTEXBUMPPARAMETERFVATIPROC glGetTexBumpParameterfvATI;
-    PFNGLGETTEXBUMPPARAMETERIVATIPROC glGetTexBumpParameterivATI;
-    PFNGLGETTEXFILTERFUNCSGISPROC glGetTexFilterFuncSGIS;
-    PFNGLGETTEXPARAMETERIIVPROC glGetTexParameterIiv;
-    PFNGLGETTEXPARAMETERIIVEXTPROC glGetTexParameterIivEXT;
-    PFNGLGETTEXPARAMETERIUIVPROC glGetTexParameterIuiv;
-    PFNGLGETTEXPARAMETERIUIVEXTPROC glGetTexParameterIuivEXT;
-    PFNGLGETTEXPARAMETERPOINTERVAPPLEPROC glGetTexParameterPointervAPPLE;
-    PFNGLGETTEXTUREIMAGEEXTPROC glGetTextureImageEXT;
-    PFNGLGETTEXTURELEVELPARAMETERFVEXTPROC glGetTextureLevelParameterfvEXT;
-    PFNGLGETTEXTURELEVELPARAMETERIVEXTPROC glGetTextureLevelParameterivEXT;
-    PFNGLGETTEXTUREPARAMETERIIVEXTPROC glGetTextureParameterIivEXT;
-    PFNGLGETTEXTUREPARAMETERIUIVEXTPROC glGetTextureParameterIuivEXT;
-    PFNGLGETTEXTUREPARAMETERFVEXTPROC glGetTextureParameterfvEXT;
-    PFNGLGETTEXTUREPARAMETERIVEXTPROC glGetTextureParameterivEXT;
-    PFNGLGETTRACKMATRIXIVNVPROC glGetTrackMatrixivNV;
-    PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glGetTransformFeedbackVarying;
-    PFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC glGetTransformFeedbackVaryingEXT;
-    PFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC glGetTransformFeedbackVaryingNV;
-    PFNGLGETUNIFORMBLOCKINDEXPROC glGetUniformBlockIndex;
-    PFNGLGETUNIFORMBUFFERSIZEEXTPROC glGetUniformBufferSizeEXT;
-    PFNGLGETUNIFORMINDICESPROC glGetUniformIndices;
-    PFNGLGETUNIFORMLOCATIONPROC glGetUniformLocation;
-    PFNGLGETUNIFORMLOCATIONARBPROC glGetUniformLocationARB;
-    PFNGLGETUNIFORMOFFSETEXTPROC glGetUniformOffsetEXT;
-    PFNGLGETUNIFORMSUBROUTINEUIVPROC glGetUniformSubroutineuiv;
-    PFNGLGETUNIFORMDVPROC glGetUniformdv;
-    PFNGLGETUNIFORMFVPROC glGetUniformfv;
-    PFNGLGETUNIFORMFVARBPROC glGetUniformfvARB;
-    PFNGLGETUNIFORMIVPROC glGetUniformiv;
-    PFNGLGETUNIFORMIVARBPROC glGetUniformivARB;
-    PFNGLGETUNIFORMUI64VNVPROC glGetUniformui64vNV;
-    PFNGLGETUNIFORMUIVPROC glGetUniformuiv;
-    PFNGLGETUNIFORMUIVEXTPROC glGetUniformuivEXT;
-    PFNGLGETVARIANTARRAYOBJECTFVATIPROC glGetVariantArrayObjectfvATI;
-    PFNGLGETVARIANTARRAYOBJECTIVATIPROC glGetVariantArrayObjectivATI;
-    PFNGLGETVARIANTBOOLEANVEXTPROC glGetVariantBooleanvEXT;
-    PFNGLGETVARIANTFLOATVEXTPROC glGetVariantFloatvEXT;
-    PFNGLGETVARIANTINTEGERVEXTPROC glGetVariantIntegervEXT;
-    PFNGLGETVARIANTPOINTERVEXTPROC glGetVariantPointervEXT;
-    PFNGLGETVARYINGLOCATIONNVPROC glGetVaryingLocationNV;
-    PFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC glGetVertexAttribArrayObjectfvATI;
-    PFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC glGetVertexAttribArrayObjectivATI;
-    PFNGLGETVERTEXATTRIBIIVPROC glGetVertexAttribIiv;
-    PFNGLGETVERTEXATTRIBIIVEXTPROC glGetVertexAttribIivEXT;
-    PFNGLGETVERTEXATTRIBIUIVPROC glGetVertexAttribIuiv;
-    PFNGLGETVERTEXATTRIBIUIVEXTPROC glGetVertexAttribIuivEXT;
-    PFNGLGETVERTEXATTRIBPOINTERVPROC glGetVertexAttribPointerv;
-    PFNGLGETVERTEXATTRIBPOINTERVARBPROC glGetVertexAttribPointervARB;
-    PFNGLGETVERTEXATTRIBPOINTERVNVPROC glGetVertexAttribPointervNV;
-    PFNGLGETVERTEXATTRIBDVPROC glGetVertexAttribdv;
-    PFNGLGETVERTEXATTRIBDVARBPROC glGetVertexAttribdvARB;
-    PFNGLGETVERTEXATTRIBDVNVPROC glGetVertexAttribdvNV;
-    PFNGLGETVERTEXATTRIBFVPROC glGetVertexAttribfv;
-    PFNGLGETVERTEXATTRIBFVARBPROC glGetVertexAttribfvARB;
-    PFNGLGETVERTEXATTRIBFVNVPROC glGetVertexAttribfvNV;
-    PFNGLGETVERTEXATTRIBIVPROC glGetVertexAttribiv;
-    PFNGLGETVERTEXATTRIBIVARBPROC glGetVertexAttribivARB;
-    PFNGLGETVERTEXATTRIBIVNVPROC glGetVertexAttribivNV;
-    PFNGLGETVIDEOCAPTURESTREAMDVNVPROC glGetVideoCaptureStreamdvNV;
-    PFNGLGETVIDEOCAPTURESTREAMFVNVPROC glGetVideoCaptureStreamfvNV;
-    PFNGLGETVIDEOCAPTURESTREAMIVNVPROC glGetVideoCaptureStreamivNV;
-    PFNGLGETVIDEOCAPTUREIVNVPROC glGetVideoCaptureivNV;
-    PFNGLGETVIDEOI64VNVPROC glGetVideoi64vNV;
-    PFNGLGETVIDEOIVNVPROC glGetVideoivNV;
-    PFNGLGETVIDEOUI64VNVPROC glGetVideoui64vNV;
-    PFNGLGETVIDEOUIVNVPROC glGetVideouivNV;
-    PFNGLGLOBALALPHAFACTORBSUNPROC glGlobalAlphaFactorbSUN;
-    PFNGLGLOBALALPHAFACTORDSUNPROC glGlobalAlphaFactordSUN;
-    PFNGLGLOBALALPHAFACTORFSUNPROC glGlobalAlphaFactorfSUN;
-    PFNGLGLOBALALPHAFACTORISUNPROC glGlobalAlphaFactoriSUN;
-    PFNGLGLOBALALPHAFACTORSSUNPROC glGlobalAlphaFactorsSUN;
-    PFNGLGLOBALALPHAFACTORUBSUNPROC glGlobalAlphaFactorubSUN;
-    PFNGLGLOBALALPHAFACTORUISUNPROC glGlobalAlphaFactoruiSUN;
-    PFNGLGLOBALALPHAFACTORUSSUNPROC glGlobalAlphaFactorusSUN;
-    PFNGLHINTPGIPROC glHintPGI;
-    PFNGLHISTOGRAMPROC glHistogram;
-    PFNGLHISTOGRAMEXTPROC glHistogramEXT;
-    PFNGLIGLOOINTERFACESGIXPROC glIglooInterfaceSGIX;
-    PFNGLIMAGETRANSFORMPARAMETERFHPPROC glImageTransformParameterfHP;
-    PFNGLIMAGETRANSFORMPARAMETERFVHPPROC glImageTransformParameterfvHP;
-    PFNGLIMAGETRANSFORMPARAMETERIHPPROC glImageTransformParameteriHP;
-    PFNGLIMAGETRANSFORMPARAMETERIVHPPROC glImageTransformParameterivHP;
-    PFNGLINDEXFORMATNVPROC glIndexFormatNV;
-    PFNGLINDEXFUNCEXTPROC glIndexFuncEXT;
-    PFNGLINDEXMATERIALEXTPROC glIndexMaterialEXT;
-    PFNGLINDEXPOINTEREXTPROC glIndexPointerEXT;
-    PFNGLINDEXPOINTERLISTIBMPROC glIndexPointerListIBM;
-    PFNGLINSERTCOMPONENTEXTPROC glInsertComponentEXT;
-    PFNGLINSTRUMENTSBUFFERSGIXPROC glInstrumentsBufferSGIX;
-    PFNGLISASYNCMARKERSGIXPROC glIsAsyncMarkerSGIX;
-    PFNGLISBUFFERPROC glIsBuffer;
-    PFNGLISBUFFERARBPROC glIsBufferARB;
-    PFNGLISBUFFERRESIDENTNVPROC glIsBufferResidentNV;
-    PFNGLISENABLEDINDEXEDEXTPROC glIsEnabledIndexedEXT;
-    PFNGLISENABLEDIPROC glIsEnabledi;
-    PFNGLISFENCEAPPLEPROC glIsFenceAPPLE;
-    PFNGLISFENCENVPROC glIsFenceNV;
-    PFNGLISFRAMEBUFFERPROC glIsFramebuffer;
-    PFNGLISFRAMEBUFFEREXTPROC glIsFramebufferEXT;
-    PFNGLISNAMEDBUFFERRESIDENTNVPROC glIsNamedBufferResidentNV;
-    PFNGLISNAMEDSTRINGARBPROC glIsNamedStringARB;
-    PFNGLISOBJECTBUFFERATIPROC glIsObjectBufferATI;
-    PFNGLISOCCLUSIONQUERYNVPROC glIsOcclusionQueryNV;
-    PFNGLISPROGRAMPROC glIsProgram;
-    PFNGLISPROGRAMARBPROC glIsProgramARB;
-    PFNGLISPROGRAMNVPROC glIsProgramNV;
-    PFNGLISQUERYPROC glIsQuery;
-    PFNGLISQUERYARBPROC glIsQueryARB;
-    PFNGLISRENDERBUFFERPROC glIsRenderbuffer;
-    PFNGLISRENDERBUFFEREXTPROC glIsRenderbufferEXT;
-    PFNGLISSAMPLERPROC glIsSampler;
-    PFNGLISSHADERPROC glIsShader;
-    PFNGLISSYNCPROC glIsSync;
-    PFNGLISTEXTUREEXTPROC glIsTextureEXT;
-    PFNGLISTRANSFORMFEEDBACKPROC glIsTransformFeedback;
-    PFNGLISTRANSFORMFEEDBACKNVPROC glIsTransformFeedbackNV;
-    PFNGLISVARIANTENABLEDEXTPROC glIsVariantEnabledEXT;
-    PFNGLISVERTEXARRAYPROC glIsVertexArray;
-    PFNGLISVERTEXARRAYAPPLEPROC glIsVertexArrayAPPLE;
-    PFNGLISVERTEXATTRIBENABLEDAPPLEPROC glIsVertexAttribEnabledAPPLE;
-    PFNGLLIGHTENVISGIXPROC glLightEnviSGIX;
-    PFNGLLINKPROGRAMPROC glLinkProgram;
-    PFNGLLINKPROGRAMARBPROC glLinkProgramARB;
-    PFNGLLISTPARAMETERFSGIXPROC glListParameterfSGIX;
-    PFNGLLISTPARAMETERFVSGIXPROC glListParameterfvSGIX;
-    PFNGLLISTPARAMETERISGIXPROC glListParameteriSGIX;
-    PFNGLLISTPARAMETERIVSGIXPROC glListParameterivSGIX;
-    PFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC glLoadIdentityDeformationMapSGIX;
-    PFNGLLOADPROGRAMNVPROC glLoadProgramNV;
-    PFNGLLOADTRANSPOSEMATRIXDPROC glLoadTransposeMatrixd;
-    PFNGLLOADTRANSPOSEMATRIXDARBPROC glLoadTransposeMatrixdARB;
-    PFNGLLOADTRANSPOSEMATRIXFPROC glLoadTransposeMatrixf;
-    PFNGLLOADTRANSPOSEMATRIXFARBPROC glLoadTransposeMatrixfARB;
-    PFNGLLOCKARRAYSEXTPROC glLockArraysEXT;
-    PFNGLMAKEBUFFERNONRESIDENTNVPROC glMakeBufferNonResidentNV;
-    PFNGLMAKEBUFFERRESIDENTNVPROC glMakeBufferResidentNV;
-    PFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC glMakeNamedBufferNonResidentNV;
-    PFNGLMAKENAMEDBUFFERRESIDENTNVPROC glMakeNamedBufferResidentNV;
-    PFNGLMAPBUFFERPROC glMapBuffer;
-    PFNGLMAPBUFFERARBPROC glMapBufferARB;
-    PFNGLMAPBUFFERRANGEPROC glMapBufferRange;
-    PFNGLMAPCONTROLPOINTSNVPROC glMapControlPointsNV;
-    PFNGLMAPNAMEDBUFFEREXTPROC glMapNamedBufferEXT;
-    PFNGLMAPNAMEDBUFFERRANGEEXTPROC glMapNamedBufferRangeEXT;
-    PFNGLMAPOBJECTBUFFERATIPROC glMapObjectBufferATI;
-    PFNGLMAPPARAMETERFVNVPROC glMapParameterfvNV;
-    PFNGLMAPPARAMETERIVNVPROC glMapParameterivNV;
-    PFNGLMAPVERTEXATTRIB1DAPPLEPROC glMapVertexAttrib1dAPPLE;
-    PFNGLMAPVERTEXATTRIB1FAPPLEPROC glMapVertexAttrib1fAPPLE;
-    PFNGLMAPVERTEXATTRIB2DAPPLEPROC glMapVertexAttrib2dAPPLE;
-    PFNGLMAPVERTEXATTRIB2FAPPLEPROC glMapVertexAttrib2fAPPLE;
-    PFNGLMATRIXFRUSTUMEXTPROC glMatrixFrustumEXT;
-    PFNGLMATRIXINDEXPOINTERARBPROC glMatrixIndexPointerARB;
-    PFNGLMATRIXINDEXUBVARBPROC glMatrixIndexubvARB;
-    PFNGLMATRIXINDEXUIVARBPROC glMatrixIndexuivARB;
-    PFNGLMATRIXINDEXUSVARBPROC glMatrixIndexusvARB;
-    PFNGLMATRIXLOADIDENTITYEXTPROC glMatrixLoadIdentityEXT;
-    PFNGLMATRIXLOADTRANSPOSEDEXTPROC glMatrixLoadTransposedEXT;
-    PFNGLMATRIXLOADTRANSPOSEFEXTPROC glMatrixLoadTransposefEXT;
-    PFNGLMATRIXLOADDEXTPROC glMatrixLoaddEXT;
-    PFNGLMATRIXLOADFEXTPROC glMatrixLoadfEXT;
-    PFNGLMATRIXMULTTRANSPOSEDEXTPROC glMatrixMultTransposedEXT;
-    PFNGLMATRIXMULTTRANSPOSEFEXTPROC glMatrixMultTransposefEXT;
-    PFNGLMATRIXMULTDEXTPROC glMatrixMultdEXT;
-    PFNGLMATRIXMULTFEXTPROC glMatrixMultfEXT;
-    PFNGLMATRIXORTHOEXTPROC glMatrixOrthoEXT;
-    PFNGLMATRIXPOPEXTPROC glMatrixPopEXT;
-    PFNGLMATRIXPUSHEXTPROC glMatrixPushEXT;
-    PFNGLMATRIXROTATEDEXTPROC glMatrixRotatedEXT;
-    PFNGLMATRIXROTATEFEXTPROC glMatrixRotatefEXT;
-    PFNGLMATRIXSCALEDEXTPROC glMatrixScaledEXT;
-    PFNGLMATRIXSCALEFEXTPROC glMatrixScalefEXT;
-    PFNGLMATRIXTRANSLATEDEXTPROC glMatrixTranslatedEXT;
-    PFNGLMATRIXTRANSLATEFEXTPROC glMatrixTranslatefEXT;
-    PFNGLMINSAMPLESHADINGPROC glMinSampleShading;
-    PFNGLMINMAXPROC glMinmax;
-    PFNGLMINMAXEXTPROC glMinmaxEXT;
-    PFNGLMULTTRANSPOSEMATRIXDPROC glMultTransposeMatrixd;
-    PFNGLMULTTRANSPOSEMATRIXDARBPROC glMultTransposeMatrixdARB;
-    PFNGLMULTTRANSPOSEMATRIXFPROC glMultTransposeMatrixf;
-    PFNGLMULTTRANSPOSEMATRIXFARBPROC glMultTransposeMatrixfARB;
-    PFNGLMULTIDRAWARRAYSPROC glMultiDrawArrays;
-    PFNGLMULTIDRAWARRAYSEXTPROC glMultiDrawArraysEXT;
-    PFNGLMULTIDRAWELEMENTARRAYAPPLEPROC glMultiDrawElementArrayAPPLE;
-    PFNGLMULTIDRAWELEMENTSPROC glMultiDrawElements;
-    PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glMultiDrawElementsBaseVertex;
-    PFNGLMULTIDRAWELEMENTSEXTPROC glMultiDrawElementsEXT;
-    PFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC glMultiDrawRangeElementArrayAPPLE;
-    PFNGLMULTIMODEDRAWARRAYSIBMPROC glMultiModeDrawArraysIBM;
-    PFNGLMULTIMODEDRAWELEMENTSIBMPROC glMultiModeDrawElementsIBM;
-    PFNGLMULTITEXBUFFEREXTPROC glMultiTexBufferEXT;
-    PFNGLMULTITEXCOORD1DPROC glMultiTexCoord1d;
-    PFNGLMULTITEXCOORD1DARBPROC glMultiTexCoord1dARB;
-    PFNGLMULTITEXCOORD1DVPROC glMultiTexCoord1dv;
-    PFNGLMULTITEXCOORD1DVARBPROC glMultiTexCoord1dvARB;
-    PFNGLMULTITEXCOORD1FPROC glMultiTexCoord1f;
-    PFNGLMULTITEXCOORD1FARBPROC glMultiTexCoord1fARB;
-    PFNGLMULTITEXCOORD1FVPROC glMultiTexCoord1fv;
-    PFNGLMULTITEXCOORD1FVARBPROC glMultiTexCoord1fvARB;
-    PFNGLMULTITEXCOORD1HNVPROC glMultiTexCoord1hNV;
-    PFNGLMULTITEXCOORD1HVNVPROC glMultiTexCoord1hvNV;
-    PFNGLMULTITEXCOORD1IPROC glMultiTexCoord1i;
-    PFNGLMULTITEXCOORD1IARBPROC glMultiTexCoord1iARB;
-    PFNGLMULTITEXCOORD1IVPROC glMultiTexCoord1iv;
-    PFNGLMULTITEXCOORD1IVARBPROC glMultiTexCoord1ivARB;
-    PFNGLMULTITEXCOORD1SPROC glMultiTexCoord1s;
-    PFNGLMULTITEXCOORD1SARBPROC glMultiTexCoord1sARB;
-    PFNGLMULTITEXCOORD1SVPROC glMultiTexCoord1sv;
-    PFNGLMULTITEXCOORD1SVARBPROC glMultiTexCoord1svARB;
-    PFNGLMULTITEXCOORD2DPROC glMultiTexCoord2d;
-    PFNGLMULTITEXCOORD2DARBPROC glMultiTexCoord2dARB;
-    PFNGLMULTITEXCOORD2DVPROC glMultiTexCoord2dv;
-    PFNGLMULTITEXCOORD2DVARBPROC glMultiTexCoord2dvARB;
-    PFNGLMULTITEXCOORD2FPROC glMultiTexCoord2f;
-    PFNGLMULTITEXCOORD2FARBPROC glMultiTexCoord2fARB;
-    PFNGLMULTITEXCOORD2FVPROC glMultiTexCoord2fv;
-    PFNGLMULTITEXCOORD2FVARBPROC glMultiTexCoord2fvARB;
-    PFNGLMULTITEXCOORD2HNVPROC glMultiTexCoord2hNV;
-    PFNGLMULTITEXCOORD2HVNVPROC glMultiTexCoord2hvNV;
-    PFNGLMULTITEXCOORD2IPROC glMultiTexCoord2i;
-    PFNGLMULTITEXCOORD2IARBPROC glMultiTexCoord2iARB;
-    PFNGLMULTITEXCOORD2IVPROC glMultiTexCoord2iv;
-    PFNGLMULTITEXCOORD2IVARBPROC glMultiTexCoord2ivARB;
-    PFNGLMULTITEXCOORD2SPROC glMultiTexCoord2s;
-    PFNGLMULTITEXCOORD2SARBPROC glMultiTexCoord2sARB;
-    PFNGLMULTITEXCOORD2SVPROC glMultiTexCoord2sv;
-    PFNGLMULTITEXCOORD2SVARBPROC glMultiTexCoord2svARB;
-    PFNGLMULTITEXCOORD3DPROC glMultiTexCoord3d;
-    PFNGLMULTITEXCOORD3DARBPROC glMultiTexCoord3dARB;
-    PFNGLMULTITEXCOORD3DVPROC glMultiTexCoord3dv;
-    PFNGLMULTITEXCOORD3DVARBPROC glMultiTexCoord3dvARB;
-    PFNGLMULTITEXCOORD3FPROC glMultiTexCoord3f;
-    PFNGLMULTITEXCOORD3FARBPROC glMultiTexCoord3fARB;
-    PFNGLMULTITEXCOORD3FVPROC glMultiTexCoord3fv;
-    PFNGLMULTITEXCOORD3FVARBPROC glMultiTexCoord3fvARB;
-    PFNGLMULTITEXCOORD3HNVPROC glMultiTexCoord3hNV;
-    PFNGLMULTITEXCOORD3HVNVPROC glMultiTexCoord3hvNV;
-    PFNGLMULTITEXCOORD3IPROC glMultiTexCoord3i;
-    PFNGLMULTITEXCOORD3IARBPROC glMultiTexCoord3iARB;
-    PFNGLMULTITEXCOORD3IVPROC glMultiTexCoord3iv;
-    PFNGLMULTITEXCOORD3IVARBPROC glMultiTexCoord3ivARB;
-    PFNGLMULTITEXCOORD3SPROC glMultiTexCoord3s;
-    PFNGLMULTITEXCOORD3SARBPROC glMultiTexCoord3sARB;
-    PFNGLMULTITEXCOORD3SVPROC glMultiTexCoord3sv;
-    PFNGLMULTITEXCOORD3SVARBPROC glMultiTexCoord3svARB;
-    PFNGLMULTITEXCOORD4DPROC glMultiTexCoord4d;
-    PFNGLMULTITEXCOORD4DARBPROC glMultiTexCoord4dARB;
-    PFNGLMULTITEXCOORD4DVPROC glMultiTexCoord4dv;
-    PFNGLMULTITEXCOORD4DVARBPROC glMultiTexCoord4dvARB;
-    PFNGLMULTITEXCOORD4FPROC glMultiTexCoord4f;
-    PFNGLMULTITEXCOORD4FARBPROC glMultiTexCoord4fARB;
-    PFNGLMULTITEXCOORD4FVPROC glMultiTexCoord4fv;
-    PFNGLMULTITEXCOORD4FVARBPROC glMultiTexCoord4fvARB;
-    PFNGLMULTITEXCOORD4HNVPROC glMultiTexCoord4hNV;
-    PFNGLMULTITEXCOORD4HVNVPROC glMultiTexCoord4hvNV;
-    PFNGLMULTITEXCOORD4IPROC glMultiTexCoord4i;
-    PFNGLMULTITEXCOORD4IARBPROC glMultiTexCoord4iARB;
-    PFNGLMULTITEXCOORD4IVPROC glMultiTexCoord4iv;
-    PFNGLMULTITEXCOORD4IVARBPROC glMultiTexCoord4ivARB;
-    PFNGLMULTITEXCOORD4SPROC glMultiTexCoord4s;
-    PFNGLMULTITEXCOORD4SARBPROC glMultiTexCoord4sARB;
-    PFNGLMULTITEXCOORD4SVPROC glMultiTexCoord4sv;
-    PFNGLMULTITEXCOORD4SVARBPROC glMultiTexCoord4svARB;
-    PFNGLMULTITEXCOORDP1UIPROC glMultiTexCoordP1ui;
-    PFNGLMULTITEXCOORDP1UIVPROC glMultiTexCoordP1uiv;
-    PFNGLMULTITEXCOORDP2UIPROC glMultiTexCoordP2ui;
-    PFNGLMULTITEXCOORDP2UIVPROC glMultiTexCoordP2uiv;
-    PFNGLMULTITEXCOORDP3UIPROC glMultiTexCoordP3ui;
-    PFNGLMULTITEXCOORDP3UIVPROC glMultiTexCoordP3uiv;
-    PFNGLMULTITEXCOORDP4UIPROC glMultiTexCoordP4ui;
-    PFNGLMULTITEXCOORDP4UIVPROC glMultiTexCoordP4uiv;
-    PFNGLMULTITEXCOORDPOINTEREXTPROC glMultiTexCoordPointerEXT;
-    PFNGLMULTITEXENVFEXTPROC glMultiTexEnvfEXT;
-    PFNGLMULTITEXENVFVEXTPROC glMultiTexEnvfvEXT;
-    PFNGLMULTITEXENVIEXTPROC glMultiTexEnviEXT;
-    PFNGLMULTITEXENVIVEXTPROC glMultiTexEnvivEXT;
-    PFNGLMULTITEXGENDEXTPROC glMultiTexGendEXT;
-    PFNGLMULTITEXGENDVEXTPROC glMultiTexGendvEXT;
-    PFNGLMULTITEXGENFEXTPROC glMultiTexGenfEXT;
-    PFNGLMULTITEXGENFVEXTPROC glMultiTexGenfvEXT;
-    PFNGLMULTITEXGENIEXTPROC glMultiTexGeniEXT;
-    PFNGLMULTITEXGENIVEXTPROC glMultiTexGenivEXT;
-    PFNGLMULTITEXIMAGE1DEXTPROC glMultiTexImage1DEXT;
-    PFNGLMULTITEXIMAGE2DEXTPROC glMultiTexImage2DEXT;
-    PFNGLMULTITEXIMAGE3DEXTPROC glMultiTexImage3DEXT;
-    PFNGLMULTITEXPARAMETERIIVEXTPROC glMultiTexParameterIivEXT;
-    PFNGLMULTITEXPARAMETERIUIVEXTPROC glMultiTexParameterIuivEXT;
-    PFNGLMULTITEXPARAMETERFEXTPROC glMultiTexParameterfEXT;
-    PFNGLMULTITEXPARAMETERFVEXTPROC glMultiTexParameterfvEXT;
-    PFNGLMULTITEXPARAMETERIEXTPROC glMultiTexParameteriEXT;
-    PFNGLMULTITEXPARAMETERIVEXTPROC glMultiTexParameterivEXT;
-    PFNGLMULTITEXRENDERBUFFEREXTPROC glMultiTexRenderbufferEXT;
-    PFNGLMULTITEXSUBIMAGE1DEXTPROC glMultiTexSubImage1DEXT;
-    PFNGLMULTITEXSUBIMAGE2DEXTPROC glMultiTexSubImage2DEXT;
-    PFNGLMULTITEXSUBIMAGE3DEXTPROC glMultiTexSubImage3DEXT;
-    PFNGLNAMEDBUFFERDATAEXTPROC glNamedBufferDataEXT;
-    PFNGLNAMEDBUFFERSUBDATAEXTPROC glNamedBufferSubDataEXT;
-    PFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC glNamedCopyBufferSubDataEXT;
-    PFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC glNamedFramebufferRenderbufferEXT;
-    PFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC glNamedFramebufferTexture1DEXT;
-    PFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC glNamedFramebufferTexture2DEXT;
-    PFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC glNamedFramebufferTexture3DEXT;
-    PFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC glNamedFramebufferTextureEXT;
-    PFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC glNamedFramebufferTextureFaceEXT;
-    PFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC glNamedFramebufferTextureLayerEXT;
-    PFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC glNamedProgramLocalParameter4dEXT;
-    PFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC glNamedProgramLocalParameter4dvEXT;
-    PFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC glNamedProgramLocalParameter4fEXT;
-    PFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC glNamedProgramLocalParameter4fvEXT;
-    PFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC glNamedProgramLocalParameterI4iEXT;
-    PFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC glNamedProgramLocalParameterI4ivEXT;
-    PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC glNamedProgramLocalParameterI4uiEXT;
-    PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC glNamedProgramLocalParameterI4uivEXT;
-    PFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC glNamedProgramLocalParameters4fvEXT;
-    PFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC glNamedProgramLocalParametersI4ivEXT;
-    PFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC glNamedProgramLocalParametersI4uivEXT;
-    PFNGLNAMEDPROGRAMSTRINGEXTPROC glNamedProgramStringEXT;
-    PFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC glNamedRenderbufferStorageEXT;
-    PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC glNamedRenderbufferStorageMultisampleCoverageEXT;
-    PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC glNamedRenderbufferStorageMultisampleEXT;
-    PFNGLNAMEDSTRINGARBPROC glNamedStringARB;
-    PFNGLNEWOBJECTBUFFERATIPROC glNewObjectBufferATI;
-    PFNGLNORMAL3FVERTEX3FSUNPROC glNormal3fVertex3fSUN;
-    PFNGLNORMAL3FVERTEX3FVSUNPROC glNormal3fVertex3fvSUN;
-    PFNGLNORMAL3HNVPROC glNormal3hNV;
-    PFNGLNORMAL3HVNVPROC glNormal3hvNV;
-    PFNGLNORMALFORMATNVPROC glNormalFormatNV;
-    PFNGLNORMALP3UIPROC glNormalP3ui;
-    PFNGLNORMALP3UIVPROC glNormalP3uiv;
-    PFNGLNORMALPOINTEREXTPROC glNormalPointerEXT;
-    PFNGLNORMALPOINTERLISTIBMPROC glNormalPointerListIBM;
-    PFNGLNORMALPOINTERVINTELPROC glNormalPointervINTEL;
-    PFNGLNORMALSTREAM3BATIPROC glNormalStream3bATI;
-    PFNGLNORMALSTREAM3BVATIPROC glNormalStream3bvATI;
-    PFNGLNORMALSTREAM3DATIPROC glNormalStream3dATI;
-    PFNGLNORMALSTREAM3DVATIPROC glNormalStream3dvATI;
-    PFNGLNORMALSTREAM3FATIPROC glNormalStream3fATI;
-    PFNGLNORMALSTREAM3FVATIPROC glNormalStream3fvATI;
-    PFNGLNORMALSTREAM3IATIPROC glNormalStream3iATI;
-    PFNGLNORMALSTREAM3IVATIPROC glNormalStream3ivATI;
-    PFNGLNORMALSTREAM3SATIPROC glNormalStream3sATI;
-    PFNGLNORMALSTREAM3SVATIPROC glNormalStream3svATI;
-    PFNGLOBJECTPURGEABLEAPPLEPROC glObjectPurgeableAPPLE;
-    PFNGLOBJECTUNPURGEABLEAPPLEPROC glObjectUnpurgeableAPPLE;
-    PFNGLPNTRIANGLESFATIPROC glPNTrianglesfATI;
-    PFNGLPNTRIANGLESIATIPROC glPNTrianglesiATI;
-    PFNGLPASSTEXCOORDATIPROC glPassTexCoordATI;
-    PFNGLPATCHPARAMETERFVPROC glPatchParameterfv;
-    PFNGLPATCHPARAMETERIPROC glPatchParameteri;
-    PFNGLPAUSETRANSFORMFEEDBACKPROC glPauseTransformFeedback;
-    PFNGLPAUSETRANSFORMFEEDBACKNVPROC glPauseTransformFeedbackNV;
-    PFNGLPIXELDATARANGENVPROC glPixelDataRangeNV;
-    PFNGLPIXELTEXGENPARAMETERFSGISPROC glPixelTexGenParameterfSGIS;
-    PFNGLPIXELTEXGENPARAMETERFVSGISPROC glPixelTexGenParameterfvSGIS;
-    PFNGLPIXELTEXGENPARAMETERISGISPROC glPixelTexGenParameteriSGIS;
-    PFNGLPIXELTEXGENPARAMETERIVSGISPROC glPixelTexGenParameterivSGIS;
-    PFNGLPIXELTEXGENSGIXPROC glPixelTexGenSGIX;
-    PFNGLPIXELTRANSFORMPARAMETERFEXTPROC glPixelTransformParameterfEXT;
-    PFNGLPIXELTRANSFORMPARAMETERFVEXTPROC glPixelTransformParameterfvEXT;
-    PFNGLPIXELTRANSFORMPARAMETERIEXTPROC glPixelTransformParameteriEXT;
-    PFNGLPIXELTRANSFORMPARAMETERIVEXTPROC glPixelTransformParameterivEXT;
-    PFNGLPOINTPARAMETERFPROC glPointParameterf;
-    PFNGLPOINTPARAMETERFARBPROC glPointParameterfARB;
-    PFNGLPOINTPARAMETERFEXTPROC glPointParameterfEXT;
-    PFNGLPOINTPARAMETERFSGISPROC glPointParameterfSGIS;
-    PFNGLPOINTPARAMETERFVPROC glPointParameterfv;
-    PFNGLPOINTPARAMETERFVARBPROC glPointParameterfvARB;
-    PFNGLPOINTPARAMETERFVEXTPROC glPointParameterfvEXT;
-    PFNGLPOINTPARAMETERFVSGISPROC glPointParameterfvSGIS;
-    PFNGLPOINTPARAMETERIPROC glPointParameteri;
-    PFNGLPOINTPARAMETERINVPROC glPointParameteriNV;
-    PFNGLPOINTPARAMETERIVPROC glPointParameteriv;
-    PFNGLPOINTPARAMETERIVNVPROC glPointParameterivNV;
-    PFNGLPOLLASYNCSGIXPROC glPollAsyncSGIX;
-    PFNGLPOLLINSTRUMENTSSGIXPROC glPollInstrumentsSGIX;
-    PFNGLPOLYGONOFFSETEXTPROC glPolygonOffsetEXT;
-    PFNGLPRESENTFRAMEDUALFILLNVPROC glPresentFrameDualFillNV;
-    PFNGLPRESENTFRAMEKEYEDNVPROC glPresentFrameKeyedNV;
-    PFNGLPRIMITIVERESTARTINDEXPROC glPrimitiveRestartIndex;
-    PFNGLPRIMITIVERESTARTINDEXNVPROC glPrimitiveRestartIndexNV;
-    PFNGLPRIMITIVERESTARTNVPROC glPrimitiveRestartNV;
-    PFNGLPRIORITIZETEXTURESEXTPROC glPrioritizeTexturesEXT;
-    PFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC glProgramBufferParametersIivNV;
-    PFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC glProgramBufferParametersIuivNV;
-    PFNGLPROGRAMBUFFERPARAMETERSFVNVPROC glProgramBufferParametersfvNV;
-    PFNGLPROGRAMENVPARAMETER4DARBPROC glProgramEnvParameter4dARB;
-    PFNGLPROGRAMENVPARAMETER4DVARBPROC glProgramEnvParameter4dvARB;
-    PFNGLPROGRAMENVPARAMETER4FARBPROC glProgramEnvParameter4fARB;
-    PFNGLPROGRAMENVPARAMETER4FVARBPROC glProgramEnvParameter4fvARB;
-    PFNGLPROGRAMENVPARAMETERI4INVPROC glProgramEnvParameterI4iNV;
-    PFNGLPROGRAMENVPARAMETERI4IVNVPROC glProgramEnvParameterI4ivNV;
-    PFNGLPROGRAMENVPARAMETERI4UINVPROC glProgramEnvParameterI4uiNV;
-    PFNGLPROGRAMENVPARAMETERI4UIVNVPROC glProgramEnvParameterI4uivNV;
-    PFNGLPROGRAMENVPARAMETERS4FVEXTPROC glProgramEnvParameters4fvEXT;
-    PFNGLPROGRAMENVPARAMETERSI4IVNVPROC glProgramEnvParametersI4ivNV;
-    PFNGLPROGRAMENVPARAMETERSI4UIVNVPROC glProgramEnvParametersI4uivNV;
-    PFNGLPROGRAMLOCALPARAMETER4DARBPROC glProgramLocalParameter4dARB;
-    PFNGLPROGRAMLOCALPARAMETER4DVARBPROC glProgramLocalParameter4dvARB;
-    PFNGLPROGRAMLOCALPARAMETER4FARBPROC glProgramLocalParameter4fARB;
-    PFNGLPROGRAMLOCALPARAMETER4FVARBPROC glProgramLocalParameter4fvARB;
-    PFNGLPROGRAMLOCALPARAMETERI4INVPROC glProgramLocalParameterI4iNV;
-    PFNGLPROGRAMLOCALPARAMETERI4IVNVPROC glProgramLocalParameterI4ivNV;
-    PFNGLPROGRAMLOCALPARAMETERI4UINVPROC glProgramLocalParameterI4uiNV;
-    PFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC glProgramLocalParameterI4uivNV;
-    PFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC glProgramLocalParameters4fvEXT;
-    PFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC glProgramLocalParametersI4ivNV;
-    PFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC glProgramLocalParametersI4uivNV;
-    PFNGLPROGRAMNAMEDPARAMETER4DNVPROC glProgramNamedParameter4dNV;
-    PFNGLPROGRAMNAMEDPARAMETER4DVNVPROC glProgramNamedParameter4dvNV;
-    PFNGLPROGRAMNAMEDPARAMETER4FNVPROC glProgramNamedParameter4fNV;
-    PFNGLPROGRAMNAMEDPARAMETER4FVNVPROC glProgramNamedParameter4fvNV;
-    PFNGLPROGRAMPARAMETER4DNVPROC glProgramParameter4dNV;
-    PFNGLPROGRAMPARAMETER4DVNVPROC glProgramParameter4dvNV;
-    PFNGLPROGRAMPARAMETER4FNVPROC glProgramParameter4fNV;
-    PFNGLPROGRAMPARAMETER4FVNVPROC glProgramParameter4fvNV;
-    PFNGLPROGRAMPARAMETERIPROC glProgramParameteri;
-    PFNGLPROGRAMPARAMETERIARBPROC glProgramParameteriARB;
-    PFNGLPROGRAMPARAMETERIEXTPROC glProgramParameteriEXT;
-    PFNGLPROGRAMPARAMETERS4DVNVPROC glProgramParameters4dvNV;
-    PFNGLPROGRAMPARAMETERS4FVNVPROC glProgramParameters4fvNV;
-    PFNGLPROGRAMSTRINGARBPROC glProgramStringARB;
-    PFNGLPROGRAMUNIFORM1DEXTPROC glProgramUniform1dEXT;
-    PFNGLPROGRAMUNIFORM1DVEXTPROC glProgramUniform1dvEXT;
-    PFNGLPROGRAMUNIFORM1FEXTPROC glProgramUniform1fEXT;
-    PFNGLPROGRAMUNIFORM1FVEXTPROC glProgramUniform1fvEXT;
-    PFNGLPROGRAMUNIFORM1IEXTPROC glProgramUniform1iEXT;
-    PFNGLPROGRAMUNIFORM1IVEXTPROC glProgramUniform1ivEXT;
-    PFNGLPROGRAMUNIFORM1UIEXTPROC glProgramUniform1uiEXT;
-    PFNGLPROGRAMUNIFORM1UIVEXTPROC glProgramUniform1uivEXT;
-    PFNGLPROGRAMUNIFORM2DEXTPROC glProgramUniform2dEXT;
-    PFNGLPROGRAMUNIFORM2DVEXTPROC glProgramUniform2dvEXT;
-    PFNGLPROGRAMUNIFORM2FEXTPROC glProgramUniform2fEXT;
-    PFNGLPROGRAMUNIFORM2FVEXTPROC glProgramUniform2fvEXT;
-    PFNGLPROGRAMUNIFORM2IEXTPROC glProgramUniform2iEXT;
-    PFNGLPROGRAMUNIFORM2IVEXTPROC glProgramUniform2ivEXT;
-    PFNGLPROGRAMUNIFORM2UIEXTPROC glProgramUniform2uiEXT;
-    PFNGLPROGRAMUNIFORM2UIVEXTPROC glProgramUniform2uivEXT;
-    PFNGLPROGRAMUNIFORM3DEXTPROC glProgramUniform3dEXT;
-    PFNGLPROGRAMUNIFORM3DVEXTPROC glProgramUniform3dvEXT;
-    PFNGLPROGRAMUNIFORM3FEXTPROC glProgramUniform3fEXT;
-    PFNGLPROGRAMUNIFORM3FVEXTPROC glProgramUniform3fvEXT;
-    PFNGLPROGRAMUNIFORM3IEXTPROC glProgramUniform3iEXT;
-    PFNGLPROGRAMUNIFORM3IVEXTPROC glProgramUniform3ivEXT;
-    PFNGLPROGRAMUNIFORM3UIEXTPROC glProgramUniform3uiEXT;
-    PFNGLPROGRAMUNIFORM3UIVEXTPROC glProgramUniform3uivEXT;
-    PFNGLPROGRAMUNIFORM4DEXTPROC glProgramUniform4dEXT;
-    PFNGLPROGRAMUNIFORM4DVEXTPROC glProgramUniform4dvEXT;
-    PFNGLPROGRAMUNIFORM4FEXTPROC glProgramUniform4fEXT;
-    PFNGLPROGRAMUNIFORM4FVEXTPROC glProgramUniform4fvEXT;
-    PFNGLPROGRAMUNIFORM4IEXTPROC glProgramUniform4iEXT;
-    PFNGLPROGRAMUNIFORM4IVEXTPROC glProgramUniform4ivEXT;
-    PFNGLPROGRAMUNIFORM4UIEXTPROC glProgramUniform4uiEXT;
-    PFNGLPROGRAMUNIFORM4UIVEXTPROC glProgramUniform4uivEXT;
-    PFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC glProgramUniformMatrix2dvEXT;
-    PFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC glProgramUniformMatrix2fvEXT;
-    PFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC glProgramUniformMatrix2x3dvEXT;
-    PFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC glProgramUniformMatrix2x3fvEXT;
-    PFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC glProgramUniformMatrix2x4dvEXT;
-    PFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC glProgramUniformMatrix2x4fvEXT;
-    PFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC glProgramUniformMatrix3dvEXT;
-    PFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC glProgramUniformMatrix3fvEXT;
-    PFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC glProgramUniformMatrix3x2dvEXT;
-    PFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC glProgramUniformMatrix3x2fvEXT;
-    PFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC glProgramUniformMatrix3x4dvEXT;
-    PFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC glProgramUniformMatrix3x4fvEXT;
-    PFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC glProgramUniformMatrix4dvEXT;
-    PFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC glProgramUniformMatrix4fvEXT;
-    PFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC glProgramUniformMatrix4x2dvEXT;
-    PFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC glProgramUniformMatrix4x2fvEXT;
-    PFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC glProgramUniformMatrix4x3dvEXT;
-    PFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC glProgramUniformMatrix4x3fvEXT;
-    PFNGLPROGRAMUNIFORMUI64NVPROC glProgramUniformui64NV;
-    PFNGLPROGRAMUNIFORMUI64VNVPROC glProgramUniformui64vNV;
-    PFNGLPROGRAMVERTEXLIMITNVPROC glProgramVertexLimitNV;
-    PFNGLPROVOKINGVERTEXPROC glProvokingVertex;
-    PFNGLPROVOKINGVERTEXEXTPROC glProvokingVertexEXT;
-    PFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC glPushClientAttribDefaultEXT;
-    PFNGLQUERYCOUNTERPROC glQueryCounter;
-    PFNGLREADINSTRUMENTSSGIXPROC glReadInstrumentsSGIX;
-    PFNGLREFERENCEPLANESGIXPROC glReferencePlaneSGIX;
-    PFNGLRENDERBUFFERSTORAGEPROC glRenderbufferStorage;
-    PFNGLRENDERBUFFERSTORAGEEXTPROC glRenderbufferStorageEXT;
-    PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glRenderbufferStorageMultisample;
-    PFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC glRenderbufferStorageMultisampleCoverageNV;
-    PFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC glRenderbufferStorageMultisampleEXT;
-    PFNGLREPLACEMENTCODEPOINTERSUNPROC glReplacementCodePointerSUN;
-    PFNGLREPLACEMENTCODEUBSUNPROC glReplacementCodeubSUN;
-    PFNGLREPLACEMENTCODEUBVSUNPROC glReplacementCodeubvSUN;
-    PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC glReplacementCodeuiColor3fVertex3fSUN;
-    PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC glReplacementCodeuiColor3fVertex3fvSUN;
-    PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC glReplacementCodeuiColor4fNormal3fVertex3fSUN;
-    PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC glReplacementCodeuiColor4fNormal3fVertex3fvSUN;
-    PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC glReplacementCodeuiColor4ubVertex3fSUN;
-    PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC glReplacementCodeuiColor4ubVertex3fvSUN;
-    PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC glReplacementCodeuiNormal3fVertex3fSUN;
-    PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC glReplacementCodeuiNormal3fVertex3fvSUN;
-    PFNGLREPLACEMENTCODEUISUNPROC glReplacementCodeuiSUN;
-    PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN;
-    PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN;
-    PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN;
-    PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN;
-    PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC glReplacementCodeuiTexCoord2fVertex3fSUN;
-    PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC glReplacementCodeuiTexCoord2fVertex3fvSUN;
-    PFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC glReplacementCodeuiVertex3fSUN;
-    PFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC glReplacementCodeuiVertex3fvSUN;
-    PFNGLREPLACEMENTCODEUIVSUNPROC glReplacementCodeuivSUN;
-    PFNGLREPLACEMENTCODEUSSUNPROC glReplacementCodeusSUN;
-    PFNGLREPLACEMENTCODEUSVSUNPROC glReplacementCodeusvSUN;
-    PFNGLREQUESTRESIDENTPROGRAMSNVPROC glRequestResidentProgramsNV;
-    PFNGLRESETHISTOGRAMPROC glResetHistogram;
-    PFNGLRESETHISTOGRAMEXTPROC glResetHistogramEXT;
-    PFNGLRESETMINMAXPROC glResetMinmax;
-    PFNGLRESETMINMAXEXTPROC glResetMinmaxEXT;
-    PFNGLRESIZEBUFFERSMESAPROC glResizeBuffersMESA;
-    PFNGLRESUMETRANSFORMFEEDBACKPROC glResumeTransformFeedback;
-    PFNGLRESUMETRANSFORMFEEDBACKNVPROC glResumeTransformFeedbackNV;
-    PFNGLSAMPLECOVERAGEPROC glSampleCoverage;
-    PFNGLSAMPLECOVERAGEARBPROC glSampleCoverageARB;
-    PFNGLSAMPLEMAPATIPROC glSampleMapATI;
-    PFNGLSAMPLEMASKEXTPROC glSampleMaskEXT;
-    PFNGLSAMPLEMASKINDEXEDNVPROC glSampleMaskIndexedNV;
-    PFNGLSAMPLEMASKSGISPROC glSampleMaskSGIS;
-    PFNGLSAMPLEMASKIPROC glSampleMaski;
-    PFNGLSAMPLEPATTERNEXTPROC glSamplePatternEXT;
-    PFNGLSAMPLEPATTERNSGISPROC glSamplePatternSGIS;
-    PFNGLSAMPLERPARAMETERIIVPROC glSamplerParameterIiv;
-    PFNGLSAMPLERPARAMETERIUIVPROC glSamplerParameterIuiv;
-    PFNGLSAMPLERPARAMETERFPROC glSamplerParameterf;
-    PFNGLSAMPLERPARAMETERFVPROC glSamplerParameterfv;
-    PFNGLSAMPLERPARAMETERIPROC glSamplerParameteri;
-    PFNGLSAMPLERPARAMETERIVPROC glSamplerParameteriv;
-    PFNGLSECONDARYCOLOR3BPROC glSecondaryColor3b;
-    PFNGLSECONDARYCOLOR3BEXTPROC glSecondaryColor3bEXT;
-    PFNGLSECONDARYCOLOR3BVPROC glSecondaryColor3bv;
-    PFNGLSECONDARYCOLOR3BVEXTPROC glSecondaryColor3bvEXT;
-    PFNGLSECONDARYCOLOR3DPROC glSecondaryColor3d;
-    PFNGLSECONDARYCOLOR3DEXTPROC glSecondaryColor3dEXT;
-    PFNGLSECONDARYCOLOR3DVPROC glSecondaryColor3dv;
-    PFNGLSECONDARYCOLOR3DVEXTPROC glSecondaryColor3dvEXT;
-    PFNGLSECONDARYCOLOR3FPROC glSecondaryColor3f;
-    PFNGLSECONDARYCOLOR3FEXTPROC glSecondaryColor3fEXT;
-    PFNGLSECONDARYCOLOR3FVPROC glSecondaryColor3fv;
-    PFNGLSECONDARYCOLOR3FVEXTPROC glSecondaryColor3fvEXT;
-    PFNGLSECONDARYCOLOR3HNVPROC glSecondaryColor3hNV;
-    PFNGLSECONDARYCOLOR3HVNVPROC glSecondaryColor3hvNV;
-    PFNGLSECONDARYCOLOR3IPROC glSecondaryColor3i;
-    PFNGLSECONDARYCOLOR3IEXTPROC glSecondaryColor3iEXT;
-    PFNGLSECONDARYCOLOR3IVPROC glSecondaryColor3iv;
-    PFNGLSECONDARYCOLOR3IVEXTPROC glSecondaryColor3ivEXT;
-    PFNGLSECONDARYCOLOR3SPROC glSecondaryColor3s;
-    PFNGLSECONDARYCOLOR3SEXTPROC glSecondaryColor3sEXT;
-    PFNGLSECONDARYCOLOR3SVPROC glSecondaryColor3sv;
-    PFNGLSECONDARYCOLOR3SVEXTPROC glSecondaryColor3svEXT;
-    PFNGLSECONDARYCOLOR3UBPROC glSecondaryColor3ub;
-    PFNGLSECONDARYCOLOR3UBEXTPROC glSecondaryColor3ubEXT;
-    PFNGLSECONDARYCOLOR3UBVPROC glSecondaryColor3ubv;
-    PFNGLSECONDARYCOLOR3UBVEXTPROC glSecondaryColor3ubvEXT;
-    PFNGLSECONDARYCOLOR3UIPROC glSecondaryColor3ui;
-    PFNGLSECONDARYCOLOR3UIEXTPROC glSecondaryColor3uiEXT;
-    PFNGLSECONDARYCOLOR3UIVPROC glSecondaryColor3uiv;
-    PFNGLSECONDARYCOLOR3UIVEXTPROC glSecondaryColor3uivEXT;
-    PFNGLSECONDARYCOLOR3USPROC glSecondaryColor3us;
-    PFNGLSECONDARYCOLOR3USEXTPROC glSecondaryColor3usEXT;
-    PFNGLSECONDARYCOLOR3USVPROC glSecondaryColor3usv;
-    PFNGLSECONDARYCOLOR3USVEXTPROC glSecondaryColor3usvEXT;
-    PFNGLSECONDARYCOLORFORMATNVPROC glSecondaryColorFormatNV;
-    PFNGLSECONDARYCOLORP3UIPROC glSecondaryColorP3ui;
-    PFNGLSECONDARYCOLORP3UIVPROC glSecondaryColorP3uiv;
-    PFNGLSECONDARYCOLORPOINTERPROC glSecondaryColorPointer;
-    PFNGLSECONDARYCOLORPOINTEREXTPROC glSecondaryColorPointerEXT;
-    PFNGLSECONDARYCOLORPOINTERLISTIBMPROC glSecondaryColorPointerListIBM;
-    PFNGLSELECTPERFMONITORCOUNTERSAMDPROC glSelectPerfMonitorCountersAMD;
-    PFNGLSEPARABLEFILTER2DPROC glSeparableFilter2D;
-    PFNGLSEPARABLEFILTER2DEXTPROC glSeparableFilter2DEXT;
-    PFNGLSETFENCEAPPLEPROC glSetFenceAPPLE;
-    PFNGLSETFENCENVPROC glSetFenceNV;
-    PFNGLSETFRAGMENTSHADERCONSTANTATIPROC glSetFragmentShaderConstantATI;
-    PFNGLSETINVARIANTEXTPROC glSetInvariantEXT;
-    PFNGLSETLOCALCONSTANTEXTPROC glSetLocalConstantEXT;
-    PFNGLSHADEROP1EXTPROC glShaderOp1EXT;
-    PFNGLSHADEROP2EXTPROC glShaderOp2EXT;
-    PFNGLSHADEROP3EXTPROC glShaderOp3EXT;
-    PFNGLSHADERSOURCEPROC glShaderSource;
-    PFNGLSHADERSOURCEARBPROC glShaderSourceARB;
-    PFNGLSHARPENTEXFUNCSGISPROC glSharpenTexFuncSGIS;
-    PFNGLSPRITEPARAMETERFSGIXPROC glSpriteParameterfSGIX;
-    PFNGLSPRITEPARAMETERFVSGIXPROC glSpriteParameterfvSGIX;
-    PFNGLSPRITEPARAMETERISGIXPROC glSpriteParameteriSGIX;
-    PFNGLSPRITEPARAMETERIVSGIXPROC glSpriteParameterivSGIX;
-    PFNGLSTARTINSTRUMENTSSGIXPROC glStartInstrumentsSGIX;
-    PFNGLSTENCILCLEARTAGEXTPROC glStencilClearTagEXT;
-    PFNGLSTENCILFUNCSEPARATEPROC glStencilFuncSeparate;
-    PFNGLSTENCILFUNCSEPARATEATIPROC glStencilFuncSeparateATI;
-    PFNGLSTENCILMASKSEPARATEPROC glStencilMaskSeparate;
-    PFNGLSTENCILOPSEPARATEPROC glStencilOpSeparate;
-    PFNGLSTENCILOPSEPARATEATIPROC glStencilOpSeparateATI;
-    PFNGLSTOPINSTRUMENTSSGIXPROC glStopInstrumentsSGIX;
-    PFNGLSTRINGMARKERGREMEDYPROC glStringMarkerGREMEDY;
-    PFNGLSWIZZLEEXTPROC glSwizzleEXT;
-    PFNGLTAGSAMPLEBUFFERSGIXPROC glTagSampleBufferSGIX;
-    PFNGLTANGENT3BEXTPROC glTangent3bEXT;
-    PFNGLTANGENT3BVEXTPROC glTangent3bvEXT;
-    PFNGLTANGENT3DEXTPROC glTangent3dEXT;
-    PFNGLTANGENT3DVEXTPROC glTangent3dvEXT;
-    PFNGLTANGENT3FEXTPROC glTangent3fEXT;
-    PFNGLTANGENT3FVEXTPROC glTangent3fvEXT;
-    PFNGLTANGENT3IEXTPROC glTangent3iEXT;
-    PFNGLTANGENT3IVEXTPROC glTangent3ivEXT;
-    PFNGLTANGENT3SEXTPROC glTangent3sEXT;
-    PFNGLTANGENT3SVEXTPROC glTangent3svEXT;
-    PFNGLTANGENTPOINTEREXTPROC glTangentPointerEXT;
-    PFNGLTBUFFERMASK3DFXPROC glTbufferMask3DFX;
-    PFNGLTESSELLATIONFACTORAMDPROC glTessellationFactorAMD;
-    PFNGLTESSELLATIONMODEAMDPROC glTessellationModeAMD;
-    PFNGLTESTFENCEAPPLEPROC glTestFenceAPPLE;
-    PFNGLTESTFENCENVPROC glTestFenceNV;
-    PFNGLTESTOBJECTAPPLEPROC glTestObjectAPPLE;
-    PFNGLTEXBUFFERPROC glTexBuffer;
-    PFNGLTEXBUFFERARBPROC glTexBufferARB;
-    PFNGLTEXBUFFEREXTPROC glTexBufferEXT;
-    PFNGLTEXBUMPPARAMETERFVATIPROC glTexBumpParameterfvATI;
-    PFNGLTEXBUMPPARAMETERIVATIPROC glTexBumpParameterivATI;
-    PFNGLTEXCOORD1HNVPROC glTexCoord1hNV;
-    PFNGLTEXCOORD1HVNVPROC glTexCoord1hvNV;
-    PFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC glTexCoord2fColor3fVertex3fSUN;
-    PFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC glTexCoord2fColor3fVertex3fvSUN;
-    PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC glTexCoord2fColor4fNormal3fVertex3fSUN;
-    PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC glTexCoord2fColor4fNormal3fVertex3fvSUN;
-    PFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC glTexCoord2fColor4ubVertex3fSUN;
-    PFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC glTexCoord2fColor4ubVertex3fvSUN;
-    PFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC glTexCoord2fNormal3fVertex3fSUN;
-    PFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC glTexCoord2fNormal3fVertex3fvSUN;
-    PFNGLTEXCOORD2FVERTEX3FSUNPROC glTexCoord2fVertex3fSUN;
-    PFNGLTEXCOORD2FVERTEX3FVSUNPROC glTexCoord2fVertex3fvSUN;
-    PFNGLTEXCOORD2HNVPROC glTexCoord2hNV;
-    PFNGLTEXCOORD2HVNVPROC glTexCoord2hvNV;
-    PFNGLTEXCOORD3HNVPROC glTexCoord3hNV;
-    PFNGLTEXCOORD3HVNVPROC glTexCoord3hvNV;
-    PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC glTexCoord4fColor4fNormal3fVertex4fSUN;
-    PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC glTexCoord4fColor4fNormal3fVertex4fvSUN;
-    PFNGLTEXCOORD4FVERTEX4FSUNPROC glTexCoord4fVertex4fSUN;
-    PFNGLTEXCOORD4FVERTEX4FVSUNPROC glTexCoord4fVertex4fvSUN;
-    PFNGLTEXCOORD4HNVPROC glTexCoord4hNV;
-    PFNGLTEXCOORD4HVNVPROC glTexCoord4hvNV;
-    PFNGLTEXCOORDFORMATNVPROC glTexCoordFormatNV;
-    PFNGLTEXCOORDP1UIPROC glTexCoordP1ui;
-    PFNGLTEXCOORDP1UIVPROC glTexCoordP1uiv;
-    PFNGLTEXCOORDP2UIPROC glTexCoordP2ui;
-    PFNGLTEXCOORDP2UIVPROC glTexCoordP2uiv;
-    PFNGLTEXCOORDP3UIPROC glTexCoordP3ui;
-    PFNGLTEXCOORDP3UIVPROC glTexCoordP3uiv;
-    PFNGLTEXCOORDP4UIPROC glTexCoordP4ui;
-    PFNGLTEXCOORDP4UIVPROC glTexCoordP4uiv;
-    PFNGLTEXCOORDPOINTEREXTPROC glTexCoordPointerEXT;
-    PFNGLTEXCOORDPOINTERLISTIBMPROC glTexCoordPointerListIBM;
-    PFNGLTEXCOORDPOINTERVINTELPROC glTexCoordPointervINTEL;
-    PFNGLTEXFILTERFUNCSGISPROC glTexFilterFuncSGIS;
-    PFNGLTEXIMAGE2DMULTISAMPLEPROC glTexImage2DMultisample;
-    PFNGLTEXIMAGE3DPROC glTexImage3D;
-    PFNGLTEXIMAGE3DEXTPROC glTexImage3DEXT;
-    PFNGLTEXIMAGE3DMULTISAMPLEPROC glTexImage3DMultisample;
-    PFNGLTEXIMAGE4DSGISPROC glTexImage4DSGIS;
-    PFNGLTEXPARAMETERIIVPROC glTexParameterIiv;
-    PFNGLTEXPARAMETERIIVEXTPROC glTexParameterIivEXT;
-    PFNGLTEXPARAMETERIUIVPROC glTexParameterIuiv;
-    PFNGLTEXPARAMETERIUIVEXTPROC glTexParameterIuivEXT;
-    PFNGLTEXRENDERBUFFERNVPROC glTexRenderbufferNV;
-    PFNGLTEXSUBIMAGE1DEXTPROC glTexSubImage1DEXT;
-    PFNGLTEXSUBIMAGE2DEXTPROC glTexSubImage2DEXT;
-    PFNGLTEXSUBIMAGE3DPROC glTexSubImage3D;
-    PFNGLTEXSUBIMAGE3DEXTPROC glTexSubImage3DEXT;
-    PFNGLTEXSUBIMAGE4DSGISPROC glTexSubImage4DSGIS;
-    PFNGLTEXTUREBARRIERNVPROC glTextureBarrierNV;
-    PFNGLTEXTUREBUFFEREXTPROC glTextureBufferEXT;
-    PFNGLTEXTURECOLORMASKSGISPROC glTextureColorMaskSGIS;
-    PFNGLTEXTUREIMAGE1DEXTPROC glTextureImage1DEXT;
-    PFNGLTEXTUREIMAGE2DEXTPROC glTextureImage2DEXT;
-    PFNGLTEXTUREIMAGE3DEXTPROC glTextureImage3DEXT;
-    PFNGLTEXTURELIGHTEXTPROC glTextureLightEXT;
-    PFNGLTEXTUREMATERIALEXTPROC glTextureMaterialEXT;
-    PFNGLTEXTURENORMALEXTPROC glTextureNormalEXT;
-    PFNGLTEXTUREPARAMETERIIVEXTPROC glTextureParameterIivEXT;
-    PFNGLTEXTUREPARAMETERIUIVEXTPROC glTextureParameterIuivEXT;
-    PFNGLTEXTUREPARAMETERFEXTPROC glTextureParameterfEXT;
-    PFNGLTEXTUREPARAMETERFVEXTPROC glTextureParameterfvEXT;
-    PFNGLTEXTUREPARAMETERIEXTPROC glTextureParameteriEXT;
-    PFNGLTEXTUREPARAMETERIVEXTPROC glTextureParameterivEXT;
-    PFNGLTEXTURERANGEAPPLEPROC glTextureRangeAPPLE;
-    PFNGLTEXTURERENDERBUFFEREXTPROC glTextureRenderbufferEXT;
-    PFNGLTEXTURESUBIMAGE1DEXTPROC glTextureSubImage1DEXT;
-    PFNGLTEXTURESUBIMAGE2DEXTPROC glTextureSubImage2DEXT;
-    PFNGLTEXTURESUBIMAGE3DEXTPROC glTextureSubImage3DEXT;
-    PFNGLTRACKMATRIXNVPROC glTrackMatrixNV;
-    PFNGLTRANSFORMFEEDBACKATTRIBSNVPROC glTransformFeedbackAttribsNV;
-    PFNGLTRANSFORMFEEDBACKVARYINGSPROC glTransformFeedbackVaryings;
-    PFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC glTransformFeedbackVaryingsEXT;
-    PFNGLTRANSFORMFEEDBACKVARYINGSNVPROC glTransformFeedbackVaryingsNV;
-    PFNGLUNIFORM1DPROC glUniform1d;
-    PFNGLUNIFORM1DVPROC glUniform1dv;
-    PFNGLUNIFORM1FPROC glUniform1f;
-    PFNGLUNIFORM1FARBPROC glUniform1fARB;
-    PFNGLUNIFORM1FVPROC glUniform1fv;
-    PFNGLUNIFORM1FVARBPROC glUniform1fvARB;
-    PFNGLUNIFORM1IPROC glUniform1i;
-    PFNGLUNIFORM1IARBPROC glUniform1iARB;
-    PFNGLUNIFORM1IVPROC glUniform1iv;
-    PFNGLUNIFORM1IVARBPROC glUniform1ivARB;
-    PFNGLUNIFORM1UIPROC glUniform1ui;
-    PFNGLUNIFORM1UIEXTPROC glUniform1uiEXT;
-    PFNGLUNIFORM1UIVPROC glUniform1uiv;
-    PFNGLUNIFORM1UIVEXTPROC glUniform1uivEXT;
-    PFNGLUNIFORM2DPROC glUniform2d;
-    PFNGLUNIFORM2DVPROC glUniform2dv;
-    PFNGLUNIFORM2FPROC glUniform2f;
-    PFNGLUNIFORM2FARBPROC glUniform2fARB;
-    PFNGLUNIFORM2FVPROC glUniform2fv;
-    PFNGLUNIFORM2FVARBPROC glUniform2fvARB;
-    PFNGLUNIFORM2IPROC glUniform2i;
-    PFNGLUNIFORM2IARBPROC glUniform2iARB;
-    PFNGLUNIFORM2IVPROC glUniform2iv;
-    PFNGLUNIFORM2IVARBPROC glUniform2ivARB;
-    PFNGLUNIFORM2UIPROC glUniform2ui;
-    PFNGLUNIFORM2UIEXTPROC glUniform2uiEXT;
-    PFNGLUNIFORM2UIVPROC glUniform2uiv;
-    PFNGLUNIFORM2UIVEXTPROC glUniform2uivEXT;
-    PFNGLUNIFORM3DPROC glUniform3d;
-    PFNGLUNIFORM3DVPROC glUniform3dv;
-    PFNGLUNIFORM3FPROC glUniform3f;
-    PFNGLUNIFORM3FARBPROC glUniform3fARB;
-    PFNGLUNIFORM3FVPROC glUniform3fv;
-    PFNGLUNIFORM3FVARBPROC glUniform3fvARB;
-    PFNGLUNIFORM3IPROC glUniform3i;
-    PFNGLUNIFORM3IARBPROC glUniform3iARB;
-    PFNGLUNIFORM3IVPROC glUniform3iv;
-    PFNGLUNIFORM3IVARBPROC glUniform3ivARB;
-    PFNGLUNIFORM3UIPROC glUniform3ui;
-    PFNGLUNIFORM3UIEXTPROC glUniform3uiEXT;
-    PFNGLUNIFORM3UIVPROC glUniform3uiv;
-    PFNGLUNIFORM3UIVEXTPROC glUniform3uivEXT;
-    PFNGLUNIFORM4DPROC glUniform4d;
-    PFNGLUNIFORM4DVPROC glUniform4dv;
-    PFNGLUNIFORM4FPROC glUniform4f;
-    PFNGLUNIFORM4FARBPROC glUniform4fARB;
-    PFNGLUNIFORM4FVPROC glUniform4fv;
-    PFNGLUNIFORM4FVARBPROC glUniform4fvARB;
-    PFNGLUNIFORM4IPROC glUniform4i;
-    PFNGLUNIFORM4IARBPROC glUniform4iARB;
-    PFNGLUNIFORM4IVPROC glUniform4iv;
-    PFNGLUNIFORM4IVARBPROC glUniform4ivARB;
-    PFNGLUNIFORM4UIPROC glUniform4ui;
-    PFNGLUNIFORM4UIEXTPROC glUniform4uiEXT;
-    PFNGLUNIFORM4UIVPROC glUniform4uiv;
-    PFNGLUNIFORM4UIVEXTPROC glUniform4uivEXT;
-    PFNGLUNIFORMBLOCKBINDINGPROC glUniformBlockBinding;
-    PFNGLUNIFORMBUFFEREXTPROC glUniformBufferEXT;
-    PFNGLUNIFORMMATRIX2DVPROC glUniformMatrix2dv;
-    PFNGLUNIFORMMATRIX2FVPROC glUniformMatrix2fv;
-    PFNGLUNIFORMMATRIX2FVARBPROC glUniformMatrix2fvARB;
-    PFNGLUNIFORMMATRIX2X3DVPROC glUniformMatrix2x3dv;
-    PFNGLUNIFORMMATRIX2X3FVPROC glUniformMatrix2x3fv;
-    PFNGLUNIFORMMATRIX2X4DVPROC glUniformMatrix2x4dv;
-    PFNGLUNIFORMMATRIX2X4FVPROC glUniformMatrix2x4fv;
-    PFNGLUNIFORMMATRIX3DVPROC glUniformMatrix3dv;
-    PFNGLUNIFORMMATRIX3FVPROC glUniformMatrix3fv;
-    PFNGLUNIFORMMATRIX3FVARBPROC glUniformMatrix3fvARB;
-    PFNGLUNIFORMMATRIX3X2DVPROC glUniformMatrix3x2dv;
-    PFNGLUNIFORMMATRIX3X2FVPROC glUniformMatrix3x2fv;
-    PFNGLUNIFORMMATRIX3X4DVPROC glUniformMatrix3x4dv;
-    PFNGLUNIFORMMATRIX3X4FVPROC glUniformMatrix3x4fv;
-    PFNGLUNIFORMMATRIX4DVPROC glUniformMatrix4dv;
-    PFNGLUNIFORMMATRIX4FVPROC glUniformMatrix4fv;
-    PFNGLUNIFORMMATRIX4FVARBPROC glUniformMatrix4fvARB;
-    PFNGLUNIFORMMATRIX4X2DVPROC glUniformMatrix4x2dv;
-    PFNGLUNIFORMMATRIX4X2FVPROC glUniformMatrix4x2fv;
-    PFNGLUNIFORMMATRIX4X3DVPROC glUniformMatrix4x3dv;
-    PFNGLUNIFORMMATRIX4X3FVPROC glUniformMatrix4x3fv;
-    PFNGLUNIFORMSUBROUTINESUIVPROC glUniformSubroutinesuiv;
-    PFNGLUNIFORMUI64NVPROC glUniformui64NV;
-    PFNGLUNIFORMUI64VNVPROC glUniformui64vNV;
-    PFNGLUNLOCKARRAYSEXTPROC glUnlockArraysEXT;
-    PFNGLUNMAPBUFFERPROC glUnmapBuffer;
-    PFNGLUNMAPBUFFERARBPROC glUnmapBufferARB;
-    PFNGLUNMAPNAMEDBUFFEREXTPROC glUnmapNamedBufferEXT;
-    PFNGLUNMAPOBJECTBUFFERATIPROC glUnmapObjectBufferATI;
-    PFNGLUPDATEOBJECTBUFFERATIPROC glUpdateObjectBufferATI;
-    PFNGLUSEPROGRAMPROC glUseProgram;
-    PFNGLUSEPROGRAMOBJECTARBPROC glUseProgramObjectARB;
-    PFNGLUSESHADERPROGRAMEXTPROC glUseShaderProgramEXT;
-    PFNGLVALIDATEPROGRAMPROC glValidateProgram;
-    PFNGLVALIDATEPROGRAMARBPROC glValidateProgramARB;
-    PFNGLVARIANTARRAYOBJECTATIPROC glVariantArrayObjectATI;
-    PFNGLVARIANTPOINTEREXTPROC glVariantPointerEXT;
-    PFNGLVARIANTBVEXTPROC glVariantbvEXT;
-    PFNGLVARIANTDVEXTPROC glVariantdvEXT;
-    PFNGLVARIANTFVEXTPROC glVariantfvEXT;
-    PFNGLVARIANTIVEXTPROC glVariantivEXT;
-    PFNGLVARIANTSVEXTPROC glVariantsvEXT;
-    PFNGLVARIANTUBVEXTPROC glVariantubvEXT;
-    PFNGLVARIANTUIVEXTPROC glVariantuivEXT;
-    PFNGLVARIANTUSVEXTPROC glVariantusvEXT;
-    PFNGLVERTEX2HNVPROC glVertex2hNV;
-    PFNGLVERTEX2HVNVPROC glVertex2hvNV;
-    PFNGLVERTEX3HNVPROC glVertex3hNV;
-    PFNGLVERTEX3HVNVPROC glVertex3hvNV;
-    PFNGLVERTEX4HNVPROC glVertex4hNV;
-    PFNGLVERTEX4HVNVPROC glVertex4hvNV;
-    PFNGLVERTEXARRAYPARAMETERIAPPLEPROC glVertexArrayParameteriAPPLE;
-    PFNGLVERTEXARRAYRANGEAPPLEPROC glVertexArrayRangeAPPLE;
-    PFNGLVERTEXARRAYRANGENVPROC glVertexArrayRangeNV;
-    PFNGLVERTEXATTRIB1DPROC glVertexAttrib1d;
-    PFNGLVERTEXATTRIB1DARBPROC glVertexAttrib1dARB;
-    PFNGLVERTEXATTRIB1DNVPROC glVertexAttrib1dNV;
-    PFNGLVERTEXATTRIB1DVPROC glVertexAttrib1dv;
-    PFNGLVERTEXATTRIB1DVARBPROC glVertexAttrib1dvARB;
-    PFNGLVERTEXATTRIB1DVNVPROC glVertexAttrib1dvNV;
-    PFNGLVERTEXATTRIB1FPROC glVertexAttrib1f;
-    PFNGLVERTEXATTRIB1FARBPROC glVertexAttrib1fARB;
-    PFNGLVERTEXATTRIB1FNVPROC glVertexAttrib1fNV;
-    PFNGLVERTEXATTRIB1FVPROC glVertexAttrib1fv;
-    PFNGLVERTEXATTRIB1FVARBPROC glVertexAttrib1fvARB;
-    PFNGLVERTEXATTRIB1FVNVPROC glVertexAttrib1fvNV;
-    PFNGLVERTEXATTRIB1HNVPROC glVertexAttrib1hNV;
-    PFNGLVERTEXATTRIB1HVNVPROC glVertexAttrib1hvNV;
-    PFNGLVERTEXATTRIB1SPROC glVertexAttrib1s;
-    PFNGLVERTEXATTRIB1SARBPROC glVertexAttrib1sARB;
-    PFNGLVERTEXATTRIB1SNVPROC glVertexAttrib1sNV;
-    PFNGLVERTEXATTRIB1SVPROC glVertexAttrib1sv;
-    PFNGLVERTEXATTRIB1SVARBPROC glVertexAttrib1svARB;
-    PFNGLVERTEXATTRIB1SVNVPROC glVertexAttrib1svNV;
-    PFNGLVERTEXATTRIB2DPROC glVertexAttrib2d;
-    PFNGLVERTEXATTRIB2DARBPROC glVertexAttrib2dARB;
-    PFNGLVERTEXATTRIB2DNVPROC glVertexAttrib2dNV;
-    PFNGLVERTEXATTRIB2DVPROC glVertexAttrib2dv;
-    PFNGLVERTEXATTRIB2DVARBPROC glVertexAttrib2dvARB;
-    PFNGLVERTEXATTRIB2DVNVPROC glVertexAttrib2dvNV;
-    PFNGLVERTEXATTRIB2FPROC glVertexAttrib2f;
-    PFNGLVERTEXATTRIB2FARBPROC glVertexAttrib2fARB;
-    PFNGLVERTEXATTRIB2FNVPROC glVertexAttrib2fNV;
-    PFNGLVERTEXATTRIB2FVPROC glVertexAttrib2fv;
-    PFNGLVERTEXATTRIB2FVARBPROC glVertexAttrib2fvARB;
-    PFNGLVERTEXATTRIB2FVNVPROC glVertexAttrib2fvNV;
-    PFNGLVERTEXATTRIB2HNVPROC glVertexAttrib2hNV;
-    PFNGLVERTEXATTRIB2HVNVPROC glVertexAttrib2hvNV;
-    PFNGLVERTEXATTRIB2SPROC glVertexAttrib2s;
-    PFNGLVERTEXATTRIB2SARBPROC glVertexAttrib2sARB;
-    PFNGLVERTEXATTRIB2SNVPROC glVertexAttrib2sNV;
-    PFNGLVERTEXATTRIB2SVPROC glVertexAttrib2sv;
-    PFNGLVERTEXATTRIB2SVARBPROC glVertexAttrib2svARB;
-    PFNGLVERTEXATTRIB2SVNVPROC glVertexAttrib2svNV;
-    PFNGLVERTEXATTRIB3DPROC glVertexAttrib3d;
-    PFNGLVERTEXATTRIB3DARBPROC glVertexAttrib3dARB;
-    PFNGLVERTEXATTRIB3DNVPROC glVertexAttrib3dNV;
-    PFNGLVERTEXATTRIB3DVPROC glVertexAttrib3dv;
-    PFNGLVERTEXATTRIB3DVARBPROC glVertexAttrib3dvARB;
-    PFNGLVERTEXATTRIB3DVNVPROC glVertexAttrib3dvNV;
-    PFNGLVERTEXATTRIB3FPROC glVertexAttrib3f;
-    PFNGLVERTEXATTRIB3FARBPROC glVertexAttrib3fARB;
-    PFNGLVERTEXATTRIB3FNVPROC glVertexAttrib3fNV;
-    PFNGLVERTEXATTRIB3FVPROC glVertexAttrib3fv;
-    PFNGLVERTEXATTRIB3FVARBPROC glVertexAttrib3fvARB;
-    PFNGLVERTEXATTRIB3FVNVPROC glVertexAttrib3fvNV;
-    PFNGLVERTEXATTRIB3HNVPROC glVertexAttrib3hNV;
-    PFNGLVERTEXATTRIB3HVNVPROC glVertexAttrib3hvNV;
-    PFNGLVERTEXATTRIB3SPROC glVertexAttrib3s;
-    PFNGLVERTEXATTRIB3SARBPROC glVertexAttrib3sARB;
-    PFNGLVERTEXATTRIB3SNVPROC glVertexAttrib3sNV;
-    PFNGLVERTEXATTRIB3SVPROC glVertexAttrib3sv;
-    PFNGLVERTEXATTRIB3SVARBPROC glVertexAttrib3svARB;
-    PFNGLVERTEXATTRIB3SVNVPROC glVertexAttrib3svNV;
-    PFNGLVERTEXATTRIB4NBVPROC glVertexAttrib4Nbv;
-    PFNGLVERTEXATTRIB4NBVARBPROC glVertexAttrib4NbvARB;
-    PFNGLVERTEXATTRIB4NIVPROC glVertexAttrib4Niv;
-    PFNGLVERTEXATTRIB4NIVARBPROC glVertexAttrib4NivARB;
-    PFNGLVERTEXATTRIB4NSVPROC glVertexAttrib4Nsv;
-    PFNGLVERTEXATTRIB4NSVARBPROC glVertexAttrib4NsvARB;
-    PFNGLVERTEXATTRIB4NUBPROC glVertexAttrib4Nub;
-    PFNGLVERTEXATTRIB4NUBARBPROC glVertexAttrib4NubARB;
-    PFNGLVERTEXATTRIB4NUBVPROC glVertexAttrib4Nubv;
-    PFNGLVERTEXATTRIB4NUBVARBPROC glVertexAttrib4NubvARB;
-    PFNGLVERTEXATTRIB4NUIVPROC glVertexAttrib4Nuiv;
-    PFNGLVERTEXATTRIB4NUIVARBPROC glVertexAttrib4NuivARB;
-    PFNGLVERTEXATTRIB4NUSVPROC glVertexAttrib4Nusv;
-    PFNGLVERTEXATTRIB4NUSVARBPROC glVertexAttrib4NusvARB;
-    PFNGLVERTEXATTRIB4BVPROC glVertexAttrib4bv;
-    PFNGLVERTEXATTRIB4BVARBPROC glVertexAttrib4bvARB;
-    PFNGLVERTEXATTRIB4DPROC glVertexAttrib4d;
-    PFNGLVERTEXATTRIB4DARBPROC glVertexAttrib4dARB;
-    PFNGLVERTEXATTRIB4DNVPROC glVertexAttrib4dNV;
-    PFNGLVERTEXATTRIB4DVPROC glVertexAttrib4dv;
-    PFNGLVERTEXATTRIB4DVARBPROC glVertexAttrib4dvARB;
-    PFNGLVERTEXATTRIB4DVNVPROC glVertexAttrib4dvNV;
-    PFNGLVERTEXATTRIB4FPROC glVertexAttrib4f;
-    PFNGLVERTEXATTRIB4FARBPROC glVertexAttrib4fARB;
-    PFNGLVERTEXATTRIB4FNVPROC glVertexAttrib4fNV;
-    PFNGLVERTEXATTRIB4FVPROC glVertexAttrib4fv;
-    PFNGLVERTEXATTRIB4FVARBPROC glVertexAttrib4fvARB;
-    PFNGLVERTEXATTRIB4FVNVPROC glVertexAttrib4fvNV;
-    PFNGLVERTEXATTRIB4HNVPROC glVertexAttrib4hNV;
-    PFNGLVERTEXATTRIB4HVNVPROC glVertexAttrib4hvNV;
-    PFNGLVERTEXATTRIB4IVPROC glVertexAttrib4iv;
-    PFNGLVERTEXATTRIB4IVARBPROC glVertexAttrib4ivARB;
-    PFNGLVERTEXATTRIB4SPROC glVertexAttrib4s;
-    PFNGLVERTEXATTRIB4SARBPROC glVertexAttrib4sARB;
-    PFNGLVERTEXATTRIB4SNVPROC glVertexAttrib4sNV;
-    PFNGLVERTEXATTRIB4SVPROC glVertexAttrib4sv;
-    PFNGLVERTEXATTRIB4SVARBPROC glVertexAttrib4svARB;
-    PFNGLVERTEXATTRIB4SVNVPROC glVertexAttrib4svNV;
-    PFNGLVERTEXATTRIB4UBNVPROC glVertexAttrib4ubNV;
-    PFNGLVERTEXATTRIB4UBVPROC glVertexAttrib4ubv;
-    PFNGLVERTEXATTRIB4UBVARBPROC glVertexAttrib4ubvARB;
-    PFNGLVERTEXATTRIB4UBVNVPROC glVertexAttrib4ubvNV;
-    PFNGLVERTEXATTRIB4UIVPROC glVertexAttrib4uiv;
-    PFNGLVERTEXATTRIB4UIVARBPROC glVertexAttrib4uivARB;
-    PFNGLVERTEXATTRIB4USVPROC glVertexAttrib4usv;
-    PFNGLVERTEXATTRIB4USVARBPROC glVertexAttrib4usvARB;
-    PFNGLVERTEXATTRIBARRAYOBJECTATIPROC glVertexAttribArrayObjectATI;
-    PFNGLVERTEXATTRIBDIVISORARBPROC glVertexAttribDivisorARB;
-    PFNGLVERTEXATTRIBFORMATNVPROC glVertexAttribFormatNV;
-    PFNGLVERTEXATTRIBI1IPROC glVertexAttribI1i;
-    PFNGLVERTEXATTRIBI1IEXTPROC glVertexAttribI1iEXT;
-    PFNGLVERTEXATTRIBI1IVPROC glVertexAttribI1iv;
-    PFNGLVERTEXATTRIBI1IVEXTPROC glVertexAttribI1ivEXT;
-    PFNGLVERTEXATTRIBI1UIPROC glVertexAttribI1ui;
-    PFNGLVERTEXATTRIBI1UIEXTPROC glVertexAttribI1uiEXT;
-    PFNGLVERTEXATTRIBI1UIVPROC glVertexAttribI1uiv;
-    PFNGLVERTEXATTRIBI1UIVEXTPROC glVertexAttribI1uivEXT;
-    PFNGLVERTEXATTRIBI2IPROC glVertexAttribI2i;
-    PFNGLVERTEXATTRIBI2IEXTPROC glVertexAttribI2iEXT;
-    PFNGLVERTEXATTRIBI2IVPROC glVertexAttribI2iv;
-    PFNGLVERTEXATTRIBI2IVEXTPROC glVertexAttribI2ivEXT;
-    PFNGLVERTEXATTRIBI2UIPROC glVertexAttribI2ui;
-    PFNGLVERTEXATTRIBI2UIEXTPROC glVertexAttribI2uiEXT;
-    PFNGLVERTEXATTRIBI2UIVPROC glVertexAttribI2uiv;
-    PFNGLVERTEXATTRIBI2UIVEXTPROC glVertexAttribI2uivEXT;
-    PFNGLVERTEXATTRIBI3IPROC glVertexAttribI3i;
-    PFNGLVERTEXATTRIBI3IEXTPROC glVertexAttribI3iEXT;
-    PFNGLVERTEXATTRIBI3IVPROC glVertexAttribI3iv;
-    PFNGLVERTEXATTRIBI3IVEXTPROC glVertexAttribI3ivEXT;
-    PFNGLVERTEXATTRIBI3UIPROC glVertexAttribI3ui;
-    PFNGLVERTEXATTRIBI3UIEXTPROC glVertexAttribI3uiEXT;
-    PFNGLVERTEXATTRIBI3UIVPROC glVertexAttribI3uiv;
-    PFNGLVERTEXATTRIBI3UIVEXTPROC glVertexAttribI3uivEXT;
-    PFNGLVERTEXATTRIBI4BVPROC glVertexAttribI4bv;
-    PFNGLVERTEXATTRIBI4BVEXTPROC glVertexAttribI4bvEXT;
-    PFNGLVERTEXATTRIBI4IPROC glVertexAttribI4i;
-    PFNGLVERTEXATTRIBI4IEXTPROC glVertexAttribI4iEXT;
-    PFNGLVERTEXATTRIBI4IVPROC glVertexAttribI4iv;
-    PFNGLVERTEXATTRIBI4IVEXTPROC glVertexAttribI4ivEXT;
-    PFNGLVERTEXATTRIBI4SVPROC glVertexAttribI4sv;
-    PFNGLVERTEXATTRIBI4SVEXTPROC glVertexAttribI4svEXT;
-    PFNGLVERTEXATTRIBI4UBVPROC glVertexAttribI4ubv;
-    PFNGLVERTEXATTRIBI4UBVEXTPROC glVertexAttribI4ubvEXT;
-    PFNGLVERTEXATTRIBI4UIPROC glVertexAttribI4ui;
-    PFNGLVERTEXATTRIBI4UIEXTPROC glVertexAttribI4uiEXT;
-    PFNGLVERTEXATTRIBI4UIVPROC glVertexAttribI4uiv;
-    PFNGLVERTEXATTRIBI4UIVEXTPROC glVertexAttribI4uivEXT;
-    PFNGLVERTEXATTRIBI4USVPROC glVertexAttribI4usv;
-    PFNGLVERTEXATTRIBI4USVEXTPROC glVertexAttribI4usvEXT;
-    PFNGLVERTEXATTRIBIFORMATNVPROC glVertexAttribIFormatNV;
-    PFNGLVERTEXATTRIBIPOINTERPROC glVertexAttribIPointer;
-    PFNGLVERTEXATTRIBIPOINTEREXTPROC glVertexAttribIPointerEXT;
-    PFNGLVERTEXATTRIBP1UIPROC glVertexAttribP1ui;
-    PFNGLVERTEXATTRIBP1UIVPROC glVertexAttribP1uiv;
-    PFNGLVERTEXATTRIBP2UIPROC glVertexAttribP2ui;
-    PFNGLVERTEXATTRIBP2UIVPROC glVertexAttribP2uiv;
-    PFNGLVERTEXATTRIBP3UIPROC glVertexAttribP3ui;
-    PFNGLVERTEXATTRIBP3UIVPROC glVertexAttribP3uiv;
-    PFNGLVERTEXATTRIBP4UIPROC glVertexAttribP4ui;
-    PFNGLVERTEXATTRIBP4UIVPROC glVertexAttribP4uiv;
-    PFNGLVERTEXATTRIBPOINTERPROC glVertexAttribPointer;
-    PFNGLVERTEXATTRIBPOINTERARBPROC glVertexAttribPointerARB;
-    PFNGLVERTEXATTRIBPOINTERNVPROC glVertexAttribPointerNV;
-    PFNGLVERTEXATTRIBS1DVNVPROC glVertexAttribs1dvNV;
-    PFNGLVERTEXATTRIBS1FVNVPROC glVertexAttribs1fvNV;
-    PFNGLVERTEXATTRIBS1HVNVPROC glVertexAttribs1hvNV;
-    PFNGLVERTEXATTRIBS1SVNVPROC glVertexAttribs1svNV;
-    PFNGLVERTEXATTRIBS2DVNVPROC glVertexAttribs2dvNV;
-    PFNGLVERTEXATTRIBS2FVNVPROC glVertexAttribs2fvNV;
-    PFNGLVERTEXATTRIBS2HVNVPROC glVertexAttribs2hvNV;
-    PFNGLVERTEXATTRIBS2SVNVPROC glVertexAttribs2svNV;
-    PFNGLVERTEXATTRIBS3DVNVPROC glVertexAttribs3dvNV;
-    PFNGLVERTEXATTRIBS3FVNVPROC glVertexAttribs3fvNV;
-    PFNGLVERTEXATTRIBS3HVNVPROC glVertexAttribs3hvNV;
-    PFNGLVERTEXATTRIBS3SVNVPROC glVertexAttribs3svNV;
-    PFNGLVERTEXATTRIBS4DVNVPROC glVertexAttribs4dvNV;
-    PFNGLVERTEXATTRIBS4FVNVPROC glVertexAttribs4fvNV;
-    PFNGLVERTEXATTRIBS4HVNVPROC glVertexAttribs4hvNV;
-    PFNGLVERTEXATTRIBS4SVNVPROC glVertexAttribs4svNV;
-    PFNGLVERTEXATTRIBS4UBVNVPROC glVertexAttribs4ubvNV;
-    PFNGLVERTEXBLENDARBPROC glVertexBlendARB;
-    PFNGLVERTEXBLENDENVFATIPROC glVertexBlendEnvfATI;
-    PFNGLVERTEXBLENDENVIATIPROC glVertexBlendEnviATI;
-    PFNGLVERTEXFORMATNVPROC glVertexFormatNV;
-    PFNGLVERTEXP2UIPROC glVertexP2ui;
-    PFNGLVERTEXP2UIVPROC glVertexP2uiv;
-    PFNGLVERTEXP3UIPROC glVertexP3ui;
-    PFNGLVERTEXP3UIVPROC glVertexP3uiv;
-    PFNGLVERTEXP4UIPROC glVertexP4ui;
-    PFNGLVERTEXP4UIVPROC glVertexP4uiv;
-    PFNGLVERTEXPOINTEREXTPROC glVertexPointerEXT;
-    PFNGLVERTEXPOINTERLISTIBMPROC glVertexPointerListIBM;
-    PFNGLVERTEXPOINTERVINTELPROC glVertexPointervINTEL;
-    PFNGLVERTEXSTREAM1DATIPROC glVertexStream1dATI;
-    PFNGLVERTEXSTREAM1DVATIPROC glVertexStream1dvATI;
-    PFNGLVERTEXSTREAM1FATIPROC glVertexStream1fATI;
-    PFNGLVERTEXSTREAM1FVATIPROC glVertexStream1fvATI;
-    PFNGLVERTEXSTREAM1IATIPROC glVertexStream1iATI;
-    PFNGLVERTEXSTREAM1IVATIPROC glVertexStream1ivATI;
-    PFNGLVERTEXSTREAM1SATIPROC glVertexStream1sATI;
-    PFNGLVERTEXSTREAM1SVATIPROC glVertexStream1svATI;
-    PFNGLVERTEXSTREAM2DATIPROC glVertexStream2dATI;
-    PFNGLVERTEXSTREAM2DVATIPROC glVertexStream2dvATI;
-    PFNGLVERTEXSTREAM2FATIPROC glVertexStream2fATI;
-    PFNGLVERTEXSTREAM2FVATIPROC glVertexStream2fvATI;
-    PFNGLVERTEXSTREAM2IATIPROC glVertexStream2iATI;
-    PFNGLVERTEXSTREAM2IVATIPROC glVertexStream2ivATI;
-    PFNGLVERTEXSTREAM2SATIPROC glVertexStream2sATI;
-    PFNGLVERTEXSTREAM2SVATIPROC glVertexStream2svATI;
-    PFNGLVERTEXSTREAM3DATIPROC glVertexStream3dATI;
-    PFNGLVERTEXSTREAM3DVATIPROC glVertexStream3dvATI;
-    PFNGLVERTEXSTREAM3FATIPROC glVertexStream3fATI;
-    PFNGLVERTEXSTREAM3FVATIPROC glVertexStream3fvATI;
-    PFNGLVERTEXSTREAM3IATIPROC glVertexStream3iATI;
-    PFNGLVERTEXSTREAM3IVATIPROC glVertexStream3ivATI;
-    PFNGLVERTEXSTREAM3SATIPROC glVertexStream3sATI;
-    PFNGLVERTEXSTREAM3SVATIPROC glVertexStream3svATI;
-    PFNGLVERTEXSTREAM4DATIPROC glVertexStream4dATI;
-    PFNGLVERTEXSTREAM4DVATIPROC glVertexStream4dvATI;
-    PFNGLVERTEXSTREAM4FATIPROC glVertexStream4fATI;
-    PFNGLVERTEXSTREAM4FVATIPROC glVertexStream4fvATI;
-    PFNGLVERTEXSTREAM4IATIPROC glVertexStream4iATI;
-    PFNGLVERTEXSTREAM4IVATIPROC glVertexStream4ivATI;
-    PFNGLVERTEXSTREAM4SATIPROC glVertexStream4sATI;
-    PFNGLVERTEXSTREAM4SVATIPROC glVertexStream4svATI;
-    PFNGLVERTEXWEIGHTPOINTEREXTPROC glVertexWeightPointerEXT;
-    PFNGLVERTEXWEIGHTFEXTPROC glVertexWeightfEXT;
-    PFNGLVERTEXWEIGHTFVEXTPROC glVertexWeightfvEXT;
-    PFNGLVERTEXWEIGHTHNVPROC glVertexWeighthNV;
-    PFNGLVERTEXWEIGHTHVNVPROC glVertexWeighthvNV;
-    PFNGLVIDEOCAPTURENVPROC glVideoCaptureNV;
-    PFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC glVideoCaptureStreamParameterdvNV;
-    PFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC glVideoCaptureStreamParameterfvNV;
-    PFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC glVideoCaptureStreamParameterivNV;
-    PFNGLWAITSYNCPROC glWaitSync;
-    PFNGLWEIGHTPOINTERARBPROC glWeightPointerARB;
-    PFNGLWEIGHTBVARBPROC glWeightbvARB;
-    PFNGLWEIGHTDVARBPROC glWeightdvARB;
-    PFNGLWEIGHTFVARBPROC glWeightfvARB;
-    PFNGLWEIGHTIVARBPROC glWeightivARB;
-    PFNGLWEIGHTSVARBPROC glWeightsvARB;
-    PFNGLWEIGHTUBVARBPROC glWeightubvARB;
-    PFNGLWEIGHTUIVARBPROC glWeightuivARB;
-    PFNGLWEIGHTUSVARBPROC glWeightusvARB;
-    PFNGLWINDOWPOS2DPROC glWindowPos2d;
-    PFNGLWINDOWPOS2DARBPROC glWindowPos2dARB;
-    PFNGLWINDOWPOS2DMESAPROC glWindowPos2dMESA;
-    PFNGLWINDOWPOS2DVPROC glWindowPos2dv;
-    PFNGLWINDOWPOS2DVARBPROC glWindowPos2dvARB;
-    PFNGLWINDOWPOS2DVMESAPROC glWindowPos2dvMESA;
-    PFNGLWINDOWPOS2FPROC glWindowPos2f;
-    PFNGLWINDOWPOS2FARBPROC glWindowPos2fARB;
-    PFNGLWINDOWPOS2FMESAPROC glWindowPos2fMESA;
-    PFNGLWINDOWPOS2FVPROC glWindowPos2fv;
-    PFNGLWINDOWPOS2FVARBPROC glWindowPos2fvARB;
-    PFNGLWINDOWPOS2FVMESAPROC glWindowPos2fvMESA;
-    PFNGLWINDOWPOS2IPROC glWindowPos2i;
-    PFNGLWINDOWPOS2IARBPROC glWindowPos2iARB;
-    PFNGLWINDOWPOS2IMESAPROC glWindowPos2iMESA;
-    PFNGLWINDOWPOS2IVPROC glWindowPos2iv;
-    PFNGLWINDOWPOS2IVARBPROC glWindowPos2ivARB;
-    PFNGLWINDOWPOS2IVMESAPROC glWindowPos2ivMESA;
-    PFNGLWINDOWPOS2SPROC glWindowPos2s;
-    PFNGLWINDOWPOS2SARBPROC glWindowPos2sARB;
-    PFNGLWINDOWPOS2SMESAPROC glWindowPos2sMESA;
-    PFNGLWINDOWPOS2SVPROC glWindowPos2sv;
-    PFNGLWINDOWPOS2SVARBPROC glWindowPos2svARB;
-    PFNGLWINDOWPOS2SVMESAPROC glWindowPos2svMESA;
-    PFNGLWINDOWPOS3DPROC glWindowPos3d;
-    PFNGLWINDOWPOS3DARBPROC glWindowPos3dARB;
-    PFNGLWINDOWPOS3DMESAPROC glWindowPos3dMESA;
-    PFNGLWINDOWPOS3DVPROC glWindowPos3dv;
-    PFNGLWINDOWPOS3DVARBPROC glWindowPos3dvARB;
-    PFNGLWINDOWPOS3DVMESAPROC glWindowPos3dvMESA;
-    PFNGLWINDOWPOS3FPROC glWindowPos3f;
-    PFNGLWINDOWPOS3FARBPROC glWindowPos3fARB;
-    PFNGLWINDOWPOS3FMESAPROC glWindowPos3fMESA;
-    PFNGLWINDOWPOS3FVPROC glWindowPos3fv;
-    PFNGLWINDOWPOS3FVARBPROC glWindowPos3fvARB;
-    PFNGLWINDOWPOS3FVMESAPROC glWindowPos3fvMESA;
-    PFNGLWINDOWPOS3IPROC glWindowPos3i;
-    PFNGLWINDOWPOS3IARBPROC glWindowPos3iARB;
-    PFNGLWINDOWPOS3IMESAPROC glWindowPos3iMESA;
-    PFNGLWINDOWPOS3IVPROC glWindowPos3iv;
-    PFNGLWINDOWPOS3IVARBPROC glWindowPos3ivARB;
-    PFNGLWINDOWPOS3IVMESAPROC glWindowPos3ivMESA;
-    PFNGLWINDOWPOS3SPROC glWindowPos3s;
-    PFNGLWINDOWPOS3SARBPROC glWindowPos3sARB;
-    PFNGLWINDOWPOS3SMESAPROC glWindowPos3sMESA;
-    PFNGLWINDOWPOS3SVPROC glWindowPos3sv;
-    PFNGLWINDOWPOS3SVARBPROC glWindowPos3svARB;
-    PFNGLWINDOWPOS3SVMESAPROC glWindowPos3svMESA;
-    PFNGLWINDOWPOS4DMESAPROC glWindowPos4dMESA;
-    PFNGLWINDOWPOS4DVMESAPROC glWindowPos4dvMESA;
-    PFNGLWINDOWPOS4FMESAPROC glWindowPos4fMESA;
-    PFNGLWINDOWPOS4FVMESAPROC glWindowPos4fvMESA;
-    PFNGLWINDOWPOS4IMESAPROC glWindowPos4iMESA;
-    PFNGLWINDOWPOS4IVMESAPROC glWindowPos4ivMESA;
-    PFNGLWINDOWPOS4SMESAPROC glWindowPos4sMESA;
-    PFNGLWINDOWPOS4SVMESAPROC glWindowPos4svMESA;
-    PFNGLWRITEMASKEXTPROC glWriteMaskEXT;
+
+    namespace {
+
+        // Resolve on first call, then patch the pointer so later calls go
+        // straight to GL.  Racing first calls resolve to the same address.
+
+        void APIENTRY Lazy_glActiveTexture (GLenum texture) {
+            glActiveTexture = (PFNGLACTIVETEXTUREPROC) r3GetProcAddress( "glActiveTexture" );
+            glActiveTexture( texture );
+        }
+
+        void APIENTRY Lazy_glAttachShader (GLuint program, GLuint shader) {
+            glAttachShader = (PFNGLATTACHSHADERPROC) r3GetProcAddress( "glAttachShader" );
+            glAttachShader( program, shader );
+        }
+
+        void APIENTRY Lazy_glBindBuffer (GLenum target, GLuint buffer) {
+            glBindBuffer = (PFNGLBINDBUFFERPROC) r3GetProcAddress( "glBindBuffer" );
+            glBindBuffer( target, buffer );
+        }
+
+        void APIENTRY Lazy_glBindMultiTextureEXT (GLenum texunit, GLenum target, GLuint texture) {
+            glBindMultiTextureEXT = (PFNGLBINDMULTITEXTUREEXTPROC) r3GetProcAddress( "glBindMultiTextureEXT" );
+            glBindMultiTextureEXT( texunit, target, texture );
+        }
+
+        void APIENTRY Lazy_glBindRenderbuffer (GLenum target, GLuint renderbuffer) {
+            glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC) r3GetProcAddress( "glBindRenderbuffer" );
+            glBindRenderbuffer( target, renderbuffer );
+        }
+
+        void APIENTRY Lazy_glBindRenderbufferEXT (GLenum target, GLuint renderbuffer) {
+            glBindRenderbufferEXT = (PFNGLBINDRENDERBUFFEREXTPROC) r3GetProcAddress( "glBindRenderbufferEXT" );
+            glBindRenderbufferEXT( target, renderbuffer );
+        }
+
+        void APIENTRY Lazy_glBufferData (GLenum target, GLsizeiptr size, const GLvoid *data, GLenum usage) {
+            glBufferData = (PFNGLBUFFERDATAPROC) r3GetProcAddress( "glBufferData" );
+            glBufferData( target, size, data, usage );
+        }
+
+        void APIENTRY Lazy_glBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid *data) {
+            glBufferSubData = (PFNGLBUFFERSUBDATAPROC) r3GetProcAddress( "glBufferSubData" );
+            glBufferSubData( target, offset, size, data );
+        }
+
+        GLenum APIENTRY Lazy_glClientWaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout) {
+            glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC) r3GetProcAddress( "glClientWaitSync" );
+            return glClientWaitSync( sync, flags, timeout );
+        }
+
+        void APIENTRY Lazy_glCompileShader (GLuint shader) {
+            glCompileShader = (PFNGLCOMPILESHADERPROC) r3GetProcAddress( "glCompileShader" );
+            glCompileShader( shader );
+        }
+
+        GLuint APIENTRY Lazy_glCreateProgram (void) {
+            glCreateProgram = (PFNGLCREATEPROGRAMPROC) r3GetProcAddress( "glCreateProgram" );
+            return glCreateProgram(  );
+        }
+
+        GLuint APIENTRY Lazy_glCreateShader (GLenum type) {
+            glCreateShader = (PFNGLCREATESHADERPROC) r3GetProcAddress( "glCreateShader" );
+            return glCreateShader( type );
+        }
+
+        void APIENTRY Lazy_glDeleteBuffers (GLsizei n, const GLuint *buffers) {
+            glDeleteBuffers = (PFNGLDELETEBUFFERSPROC) r3GetProcAddress( "glDeleteBuffers" );
+            glDeleteBuffers( n, buffers );
+        }
+
+        void APIENTRY Lazy_glDeleteProgram (GLuint program) {
+            glDeleteProgram = (PFNGLDELETEPROGRAMPROC) r3GetProcAddress( "glDeleteProgram" );
+            glDeleteProgram( program );
+        }
+
+        void APIENTRY Lazy_glDeleteRenderbuffers (GLsizei n, const GLuint *renderbuffers) {
+            glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC) r3GetProcAddress( "glDeleteRenderbuffers" );
+            glDeleteRenderbuffers( n, renderbuffers );
+        }
+
+        void APIENTRY Lazy_glDeleteRenderbuffersEXT (GLsizei n, const GLuint *renderbuffers) {
+            glDeleteRenderbuffersEXT = (PFNGLDELETERENDERBUFFERSEXTPROC) r3GetProcAddress( "glDeleteRenderbuffersEXT" );
+            glDeleteRenderbuffersEXT( n, renderbuffers );
+        }
+
+        void APIENTRY Lazy_glDeleteShader (GLuint shader) {
+            glDeleteShader = (PFNGLDELETESHADERPROC) r3GetProcAddress( "glDeleteShader" );
+            glDeleteShader( shader );
+        }
+
+        void APIENTRY Lazy_glDeleteSync (GLsync sync) {
+            glDeleteSync = (PFNGLDELETESYNCPROC) r3GetProcAddress( "glDeleteSync" );
+            glDeleteSync( sync );
+        }
+
+        void APIENTRY Lazy_glDisableClientStateIndexedEXT (GLenum array, GLuint index) {
+            glDisableClientStateIndexedEXT = (PFNGLDISABLECLIENTSTATEINDEXEDEXTPROC) r3GetProcAddress( "glDisableClientStateIndexedEXT" );
+            glDisableClientStateIndexedEXT( array, index );
+        }
+
+        void APIENTRY Lazy_glDisableIndexedEXT (GLenum target, GLuint index) {
+            glDisableIndexedEXT = (PFNGLDISABLEINDEXEDEXTPROC) r3GetProcAddress( "glDisableIndexedEXT" );
+            glDisableIndexedEXT( target, index );
+        }
+
+        void APIENTRY Lazy_glDisableVertexAttribArray (GLuint index) {
+            glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC) r3GetProcAddress( "glDisableVertexAttribArray" );
+            glDisableVertexAttribArray( index );
+        }
+
+        void APIENTRY Lazy_glEnableClientStateIndexedEXT (GLenum array, GLuint index) {
+            glEnableClientStateIndexedEXT = (PFNGLENABLECLIENTSTATEINDEXEDEXTPROC) r3GetProcAddress( "glEnableClientStateIndexedEXT" );
+            glEnableClientStateIndexedEXT( array, index );
+        }
+
+        void APIENTRY Lazy_glEnableIndexedEXT (GLenum target, GLuint index) {
+            glEnableIndexedEXT = (PFNGLENABLEINDEXEDEXTPROC) r3GetProcAddress( "glEnableIndexedEXT" );
+            glEnableIndexedEXT( target, index );
+        }
+
+        void APIENTRY Lazy_glEnableVertexAttribArray (GLuint index) {
+            glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC) r3GetProcAddress( "glEnableVertexAttribArray" );
+            glEnableVertexAttribArray( index );
+        }
+
+        GLsync APIENTRY Lazy_glFenceSync (GLenum condition, GLbitfield flags) {
+            glFenceSync = (PFNGLFENCESYNCPROC) r3GetProcAddress( "glFenceSync" );
+            return glFenceSync( condition, flags );
+        }
+
+        void APIENTRY Lazy_glGenBuffers (GLsizei n, GLuint *buffers) {
+            glGenBuffers = (PFNGLGENBUFFERSPROC) r3GetProcAddress( "glGenBuffers" );
+            glGenBuffers( n, buffers );
+        }
+
+        void APIENTRY Lazy_glGenRenderbuffers (GLsizei n, GLuint *renderbuffers) {
+            glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC) r3GetProcAddress( "glGenRenderbuffers" );
+            glGenRenderbuffers( n, renderbuffers );
+        }
+
+        void APIENTRY Lazy_glGenRenderbuffersEXT (GLsizei n, GLuint *renderbuffers) {
+            glGenRenderbuffersEXT = (PFNGLGENRENDERBUFFERSEXTPROC) r3GetProcAddress( "glGenRenderbuffersEXT" );
+            glGenRenderbuffersEXT( n, renderbuffers );
+        }
+
+        void APIENTRY Lazy_glGenerateMipmapEXT (GLenum target) {
+            glGenerateMipmapEXT = (PFNGLGENERATEMIPMAPEXTPROC) r3GetProcAddress( "glGenerateMipmapEXT" );
+            glGenerateMipmapEXT( target );
+        }
+
+        void APIENTRY Lazy_glGetProgramInfoLog (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+            glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC) r3GetProcAddress( "glGetProgramInfoLog" );
+            glGetProgramInfoLog( program, bufSize, length, infoLog );
+        }
+
+        void APIENTRY Lazy_glGetShaderInfoLog (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+            glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC) r3GetProcAddress( "glGetShaderInfoLog" );
+            glGetShaderInfoLog( shader, bufSize, length, infoLog );
+        }
+
+        const GLubyte * APIENTRY Lazy_glGetStringi (GLenum name, GLuint index) {
+            glGetStringi = (PFNGLGETSTRINGIPROC) r3GetProcAddress( "glGetStringi" );
+            return glGetStringi( name, index );
+        }
+
+        GLint APIENTRY Lazy_glGetUniformLocation (GLuint program, const GLchar *name) {
+            glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC) r3GetProcAddress( "glGetUniformLocation" );
+            return glGetUniformLocation( program, name );
+        }
+
+        void APIENTRY Lazy_glLinkProgram (GLuint program) {
+            glLinkProgram = (PFNGLLINKPROGRAMPROC) r3GetProcAddress( "glLinkProgram" );
+            glLinkProgram( program );
+        }
+
+        GLvoid* APIENTRY Lazy_glMapBufferRange (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+            glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC) r3GetProcAddress( "glMapBufferRange" );
+            return glMapBufferRange( target, offset, length, access );
+        }
+
+        void APIENTRY Lazy_glMultiTexCoord2f (GLenum target, GLfloat s, GLfloat t) {
+            glMultiTexCoord2f = (PFNGLMULTITEXCOORD2FPROC) r3GetProcAddress( "glMultiTexCoord2f" );
+            glMultiTexCoord2f( target, s, t );
+        }
+
+        void APIENTRY Lazy_glMultiTexCoordPointerEXT (GLenum texunit, GLint size, GLenum type, GLsizei stride, const GLvoid *pointer) {
+            glMultiTexCoordPointerEXT = (PFNGLMULTITEXCOORDPOINTEREXTPROC) r3GetProcAddress( "glMultiTexCoordPointerEXT" );
+            glMultiTexCoordPointerEXT( texunit, size, type, stride, pointer );
+        }
+
+        void APIENTRY Lazy_glMultiTexEnviEXT (GLenum texunit, GLenum target, GLenum pname, GLint param) {
+            glMultiTexEnviEXT = (PFNGLMULTITEXENVIEXTPROC) r3GetProcAddress( "glMultiTexEnviEXT" );
+            glMultiTexEnviEXT( texunit, target, pname, param );
+        }
+
+        void APIENTRY Lazy_glProgramUniform1iEXT (GLuint program, GLint location, GLint v0) {
+            glProgramUniform1iEXT = (PFNGLPROGRAMUNIFORM1IEXTPROC) r3GetProcAddress( "glProgramUniform1iEXT" );
+            glProgramUniform1iEXT( program, location, v0 );
+        }
+
+        void APIENTRY Lazy_glProgramUniform3fvEXT (GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+            glProgramUniform3fvEXT = (PFNGLPROGRAMUNIFORM3FVEXTPROC) r3GetProcAddress( "glProgramUniform3fvEXT" );
+            glProgramUniform3fvEXT( program, location, count, value );
+        }
+
+        void APIENTRY Lazy_glProgramUniformMatrix4fvEXT (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+            glProgramUniformMatrix4fvEXT = (PFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC) r3GetProcAddress( "glProgramUniformMatrix4fvEXT" );
+            glProgramUniformMatrix4fvEXT( program, location, count, transpose, value );
+        }
+
+        void APIENTRY Lazy_glRenderbufferStorage (GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+            glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC) r3GetProcAddress( "glRenderbufferStorage" );
+            glRenderbufferStorage( target, internalformat, width, height );
+        }
+
+        void APIENTRY Lazy_glRenderbufferStorageEXT (GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+            glRenderbufferStorageEXT = (PFNGLRENDERBUFFERSTORAGEEXTPROC) r3GetProcAddress( "glRenderbufferStorageEXT" );
+            glRenderbufferStorageEXT( target, internalformat, width, height );
+        }
+
+        void APIENTRY Lazy_glShaderSource (GLuint shader, GLsizei count, const GLchar* *string, const GLint *length) {
+            glShaderSource = (PFNGLSHADERSOURCEPROC) r3GetProcAddress( "glShaderSource" );
+            glShaderSource( shader, count, string, length );
+        }
+
+        GLboolean APIENTRY Lazy_glUnmapBuffer (GLenum target) {
+            glUnmapBuffer = (PFNGLUNMAPBUFFERPROC) r3GetProcAddress( "glUnmapBuffer" );
+            return glUnmapBuffer( target );
+        }
+
+        void APIENTRY Lazy_glUseProgram (GLuint program) {
+            glUseProgram = (PFNGLUSEPROGRAMPROC) r3GetProcAddress( "glUseProgram" );
+            glUseProgram( program );
+        }
+
+        void APIENTRY Lazy_glVertexAttribPointer (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid *pointer) {
+            glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC) r3GetProcAddress( "glVertexAttribPointer" );
+            glVertexAttribPointer( index, size, type, normalized, stride, pointer );
+        }
+
+    }
+
+    PFNGLACTIVETEXTUREPROC glActiveTexture = Lazy_glActiveTexture;
+    PFNGLATTACHSHADERPROC glAttachShader = Lazy_glAttachShader;
+    PFNGLBINDBUFFERPROC glBindBuffer = Lazy_glBindBuffer;
+    PFNGLBINDMULTITEXTUREEXTPROC glBindMultiTextureEXT = Lazy_glBindMultiTextureEXT;
+    PFNGLBINDRENDERBUFFERPROC glBindRenderbuffer = Lazy_glBindRenderbuffer;
+    PFNGLBINDRENDERBUFFEREXTPROC glBindRenderbufferEXT = Lazy_glBindRenderbufferEXT;
+    PFNGLBUFFERDATAPROC glBufferData = Lazy_glBufferData;
+    PFNGLBUFFERSUBDATAPROC glBufferSubData = Lazy_glBufferSubData;
+    PFNGLCLIENTWAITSYNCPROC glClientWaitSync = Lazy_glClientWaitSync;
+    PFNGLCOMPILESHADERPROC glCompileShader = Lazy_glCompileShader;
+    PFNGLCREATEPROGRAMPROC glCreateProgram = Lazy_glCreateProgram;
+    PFNGLCREATESHADERPROC glCreateShader = Lazy_glCreateShader;
+    PFNGLDELETEBUFFERSPROC glDeleteBuffers = Lazy_glDeleteBuffers;
+    PFNGLDELETEPROGRAMPROC glDeleteProgram = Lazy_glDeleteProgram;
+    PFNGLDELETERENDERBUFFERSPROC glDeleteRenderbuffers = Lazy_glDeleteRenderbuffers;
+    PFNGLDELETERENDERBUFFERSEXTPROC glDeleteRenderbuffersEXT = Lazy_glDeleteRenderbuffersEXT;
+    PFNGLDELETESHADERPROC glDeleteShader = Lazy_glDeleteShader;
+    PFNGLDELETESYNCPROC glDeleteSync = Lazy_glDeleteSync;
+    PFNGLDISABLECLIENTSTATEINDEXEDEXTPROC glDisableClientStateIndexedEXT = Lazy_glDisableClientStateIndexedEXT;
+    PFNGLDISABLEINDEXEDEXTPROC glDisableIndexedEXT = Lazy_glDisableIndexedEXT;
+    PFNGLDISABLEVERTEXATTRIBARRAYPROC glDisableVertexAttribArray = Lazy_glDisableVertexAttribArray;
+    PFNGLENABLECLIENTSTATEINDEXEDEXTPROC glEnableClientStateIndexedEXT = Lazy_glEnableClientStateIndexedEXT;
+    PFNGLENABLEINDEXEDEXTPROC glEnableIndexedEXT = Lazy_glEnableIndexedEXT;
+    PFNGLENABLEVERTEXATTRIBARRAYPROC glEnableVertexAttribArray = Lazy_glEnableVertexAttribArray;
+    PFNGLFENCESYNCPROC glFenceSync = Lazy_glFenceSync;
+    PFNGLGENBUFFERSPROC glGenBuffers = Lazy_glGenBuffers;
+    PFNGLGENRENDERBUFFERSPROC glGenRenderbuffers = Lazy_glGenRenderbuffers;
+    PFNGLGENRENDERBUFFERSEXTPROC glGenRenderbuffersEXT = Lazy_glGenRenderbuffersEXT;
+    PFNGLGENERATEMIPMAPEXTPROC glGenerateMipmapEXT = Lazy_glGenerateMipmapEXT;
+    PFNGLGETPROGRAMINFOLOGPROC glGetProgramInfoLog = Lazy_glGetProgramInfoLog;
+    PFNGLGETSHADERINFOLOGPROC glGetShaderInfoLog = Lazy_glGetShaderInfoLog;
+    PFNGLGETSTRINGIPROC glGetStringi = Lazy_glGetStringi;
+    PFNGLGETUNIFORMLOCATIONPROC glGetUniformLocation = Lazy_glGetUniformLocation;
+    PFNGLLINKPROGRAMPROC glLinkProgram = Lazy_glLinkProgram;
+    PFNGLMAPBUFFERRANGEPROC glMapBufferRange = Lazy_glMapBufferRange;
+    PFNGLMULTITEXCOORD2FPROC glMultiTexCoord2f = Lazy_glMultiTexCoord2f;
+    PFNGLMULTITEXCOORDPOINTEREXTPROC glMultiTexCoordPointerEXT = Lazy_glMultiTexCoordPointerEXT;
+    PFNGLMULTITEXENVIEXTPROC glMultiTexEnviEXT = Lazy_glMultiTexEnviEXT;
+    PFNGLPROGRAMUNIFORM1IEXTPROC glProgramUniform1iEXT = Lazy_glProgramUniform1iEXT;
+    PFNGLPROGRAMUNIFORM3FVEXTPROC glProgramUniform3fvEXT = Lazy_glProgramUniform3fvEXT;
+    PFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC glProgramUniformMatrix4fvEXT = Lazy_glProgramUniformMatrix4fvEXT;
+    PFNGLRENDERBUFFERSTORAGEPROC glRenderbufferStorage = Lazy_glRenderbufferStorage;
+    PFNGLRENDERBUFFERSTORAGEEXTPROC glRenderbufferStorageEXT = Lazy_glRenderbufferStorageEXT;
+    PFNGLSHADERSOURCEPROC glShaderSource = Lazy_glShaderSource;
+    PFNGLUNMAPBUFFERPROC glUnmapBuffer = Lazy_glUnmapBuffer;
+    PFNGLUSEPROGRAMPROC glUseProgram = Lazy_glUseProgram;
+    PFNGLVERTEXATTRIBPOINTERPROC glVertexAttribPointer = Lazy_glVertexAttribPointer;
 
 
     void InitGLEntry() {
 
-        glActiveProgramEXT = (PFNGLACTIVEPROGRAMEXTPROC) r3GetProcAddress( "glActiveProgramEXT" );
-        glActiveStencilFaceEXT = (PFNGLACTIVESTENCILFACEEXTPROC) r3GetProcAddress( "glActiveStencilFaceEXT" );
-        glActiveTexture = (PFNGLACTIVETEXTUREPROC) r3GetProcAddress( "glActiveTexture" );
-        glActiveTextureARB = (PFNGLACTIVETEXTUREARBPROC) r3GetProcAddress( "glActiveTextureARB" );
-        glActiveVaryingNV = (PFNGLACTIVEVARYINGNVPROC) r3GetProcAddress( "glActiveVaryingNV" );
-        glAlphaFragmentOp1ATI = (PFNGLALPHAFRAGMENTOP1ATIPROC) r3GetProcAddress( "glAlphaFragmentOp1ATI" );
-        glAlphaFragmentOp2ATI = (PFNGLALPHAFRAGMENTOP2ATIPROC) r3GetProcAddress( "glAlphaFragmentOp2ATI" );
-        glAlphaFragmentOp3ATI = (PFNGLALPHAFRAGMENTOP3ATIPROC) r3GetProcAddress( "glAlphaFragmentOp3ATI" );
-        glApplyTextureEXT = (PFNGLAPPLYTEXTUREEXTPROC) r3GetProcAddress( "glApplyTextureEXT" );
-        glAreProgramsResidentNV = (PFNGLAREPROGRAMSRESIDENTNVPROC) r3GetProcAddress( "glAreProgramsResidentNV" );
-        glAreTexturesResidentEXT = (PFNGLARETEXTURESRESIDENTEXTPROC) r3GetProcAddress( "glAreTexturesResidentEXT" );
-        glArrayElementEXT = (PFNGLARRAYELEMENTEXTPROC) r3GetProcAddress( "glArrayElementEXT" );
-        glArrayObjectATI = (PFNGLARRAYOBJECTATIPROC) r3GetProcAddress( "glArrayObjectATI" );
-        glAsyncMarkerSGIX = (PFNGLASYNCMARKERSGIXPROC) r3GetProcAddress( "glAsyncMarkerSGIX" );
-        glAttachObjectARB = (PFNGLATTACHOBJECTARBPROC) r3GetProcAddress( "glAttachObjectARB" );
-        glAttachShader = (PFNGLATTACHSHADERPROC) r3GetProcAddress( "glAttachShader" );
-        glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC) r3GetProcAddress( "glBeginConditionalRender" );
-        glBeginConditionalRenderNV = (PFNGLBEGINCONDITIONALRENDERNVPROC) r3GetProcAddress( "glBeginConditionalRenderNV" );
-        glBeginFragmentShaderATI = (PFNGLBEGINFRAGMENTSHADERATIPROC) r3GetProcAddress( "glBeginFragmentShaderATI" );
-        glBeginOcclusionQueryNV = (PFNGLBEGINOCCLUSIONQUERYNVPROC) r3GetProcAddress( "glBeginOcclusionQueryNV" );
-        glBeginPerfMonitorAMD = (PFNGLBEGINPERFMONITORAMDPROC) r3GetProcAddress( "glBeginPerfMonitorAMD" );
-        glBeginQuery = (PFNGLBEGINQUERYPROC) r3GetProcAddress( "glBeginQuery" );
-        glBeginQueryARB = (PFNGLBEGINQUERYARBPROC) r3GetProcAddress( "glBeginQueryARB" );
-        glBeginQueryIndexed = (PFNGLBEGINQUERYINDEXEDPROC) r3GetProcAddress( "glBeginQueryIndexed" );
-        glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC) r3GetProcAddress( "glBeginTransformFeedback" );
-        glBeginTransformFeedbackEXT = (PFNGLBEGINTRANSFORMFEEDBACKEXTPROC) r3GetProcAddress( "glBeginTransformFeedbackEXT" );
-        glBeginTransformFeedbackNV = (PFNGLBEGINTRANSFORMFEEDBACKNVPROC) r3GetProcAddress( "glBeginTransformFeedbackNV" );
-        glBeginVertexShaderEXT = (PFNGLBEGINVERTEXSHADEREXTPROC) r3GetProcAddress( "glBeginVertexShaderEXT" );
-        glBeginVideoCaptureNV = (PFNGLBEGINVIDEOCAPTURENVPROC) r3GetProcAddress( "glBeginVideoCaptureNV" );
-        glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC) r3GetProcAddress( "glBindAttribLocation" );
-        glBindAttribLocationARB = (PFNGLBINDATTRIBLOCATIONARBPROC) r3GetProcAddress( "glBindAttribLocationARB" );
-        glBindBuffer = (PFNGLBINDBUFFERPROC) r3GetProcAddress( "glBindBuffer" );
-        glBindBufferARB = (PFNGLBINDBUFFERARBPROC) r3GetProcAddress( "glBindBufferARB" );
-        glBindBufferBase = (PFNGLBINDBUFFERBASEPROC) r3GetProcAddress( "glBindBufferBase" );
-        glBindBufferBaseEXT = (PFNGLBINDBUFFERBASEEXTPROC) r3GetProcAddress( "glBindBufferBaseEXT" );
-        glBindBufferBaseNV = (PFNGLBINDBUFFERBASENVPROC) r3GetProcAddress( "glBindBufferBaseNV" );
-        glBindBufferOffsetEXT = (PFNGLBINDBUFFEROFFSETEXTPROC) r3GetProcAddress( "glBindBufferOffsetEXT" );
-        glBindBufferOffsetNV = (PFNGLBINDBUFFEROFFSETNVPROC) r3GetProcAddress( "glBindBufferOffsetNV" );
-        glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC) r3GetProcAddress( "glBindBufferRange" );
-        glBindBufferRangeEXT = (PFNGLBINDBUFFERRANGEEXTPROC) r3GetProcAddress( "glBindBufferRangeEXT" );
-        glBindBufferRangeNV = (PFNGLBINDBUFFERRANGENVPROC) r3GetProcAddress( "glBindBufferRangeNV" );
-        glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC) r3GetProcAddress( "glBindFragDataLocation" );
-        glBindFragDataLocationEXT = (PFNGLBINDFRAGDATALOCATIONEXTPROC) r3GetProcAddress( "glBindFragDataLocationEXT" );
-        glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC) r3GetProcAddress( "glBindFragDataLocationIndexed" );
-        glBindFragmentShaderATI = (PFNGLBINDFRAGMENTSHADERATIPROC) r3GetProcAddress( "glBindFragmentShaderATI" );
-        glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC) r3GetProcAddress( "glBindFramebuffer" );
-        glBindFramebufferEXT = (PFNGLBINDFRAMEBUFFEREXTPROC) r3GetProcAddress( "glBindFramebufferEXT" );
-        glBindLightParameterEXT = (PFNGLBINDLIGHTPARAMETEREXTPROC) r3GetProcAddress( "glBindLightParameterEXT" );
-        glBindMaterialParameterEXT = (PFNGLBINDMATERIALPARAMETEREXTPROC) r3GetProcAddress( "glBindMaterialParameterEXT" );
-        glBindMultiTextureEXT = (PFNGLBINDMULTITEXTUREEXTPROC) r3GetProcAddress( "glBindMultiTextureEXT" );
-        glBindParameterEXT = (PFNGLBINDPARAMETEREXTPROC) r3GetProcAddress( "glBindParameterEXT" );
-        glBindProgramARB = (PFNGLBINDPROGRAMARBPROC) r3GetProcAddress( "glBindProgramARB" );
-        glBindProgramNV = (PFNGLBINDPROGRAMNVPROC) r3GetProcAddress( "glBindProgramNV" );
-        glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC) r3GetProcAddress( "glBindRenderbuffer" );
-        glBindRenderbufferEXT = (PFNGLBINDRENDERBUFFEREXTPROC) r3GetProcAddress( "glBindRenderbufferEXT" );
-        glBindSampler = (PFNGLBINDSAMPLERPROC) r3GetProcAddress( "glBindSampler" );
-        glBindTexGenParameterEXT = (PFNGLBINDTEXGENPARAMETEREXTPROC) r3GetProcAddress( "glBindTexGenParameterEXT" );
-        glBindTextureEXT = (PFNGLBINDTEXTUREEXTPROC) r3GetProcAddress( "glBindTextureEXT" );
-        glBindTextureUnitParameterEXT = (PFNGLBINDTEXTUREUNITPARAMETEREXTPROC) r3GetProcAddress( "glBindTextureUnitParameterEXT" );
-        glBindTransformFeedback = (PFNGLBINDTRANSFORMFEEDBACKPROC) r3GetProcAddress( "glBindTransformFeedback" );
-        glBindTransformFeedbackNV = (PFNGLBINDTRANSFORMFEEDBACKNVPROC) r3GetProcAddress( "glBindTransformFeedbackNV" );
-        glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC) r3GetProcAddress( "glBindVertexArray" );
-        glBindVertexArrayAPPLE = (PFNGLBINDVERTEXARRAYAPPLEPROC) r3GetProcAddress( "glBindVertexArrayAPPLE" );
-        glBindVertexShaderEXT = (PFNGLBINDVERTEXSHADEREXTPROC) r3GetProcAddress( "glBindVertexShaderEXT" );
-        glBindVideoCaptureStreamBufferNV = (PFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC) r3GetProcAddress( "glBindVideoCaptureStreamBufferNV" );
-        glBindVideoCaptureStreamTextureNV = (PFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC) r3GetProcAddress( "glBindVideoCaptureStreamTextureNV" );
-        glBinormal3bEXT = (PFNGLBINORMAL3BEXTPROC) r3GetProcAddress( "glBinormal3bEXT" );
-        glBinormal3bvEXT = (PFNGLBINORMAL3BVEXTPROC) r3GetProcAddress( "glBinormal3bvEXT" );
-        glBinormal3dEXT = (PFNGLBINORMAL3DEXTPROC) r3GetProcAddress( "glBinormal3dEXT" );
-        glBinormal3dvEXT = (PFNGLBINORMAL3DVEXTPROC) r3GetProcAddress( "glBinormal3dvEXT" );
-        glBinormal3fEXT = (PFNGLBINORMAL3FEXTPROC) r3GetProcAddress( "glBinormal3fEXT" );
-        glBinormal3fvEXT = (PFNGLBINORMAL3FVEXTPROC) r3GetProcAddress( "glBinormal3fvEXT" );
-        glBinormal3iEXT = (PFNGLBINORMAL3IEXTPROC) r3GetProcAddress( "glBinormal3iEXT" );
-        glBinormal3ivEXT = (PFNGLBINORMAL3IVEXTPROC) r3GetProcAddress( "glBinormal3ivEXT" );
-        glBinormal3sEXT = (PFNGLBINORMAL3SEXTPROC) r3GetProcAddress( "glBinormal3sEXT" );
-        glBinormal3svEXT = (PFNGLBINORMAL3SVEXTPROC) r3GetProcAddress( "glBinormal3svEXT" );
-        glBinormalPointerEXT = (PFNGLBINORMALPOINTEREXTPROC) r3GetProcAddress( "glBinormalPointerEXT" );
-        glBlendColor = (PFNGLBLENDCOLORPROC) r3GetProcAddress( "glBlendColor" );
-        glBlendColorEXT = (PFNGLBLENDCOLOREXTPROC) r3GetProcAddress( "glBlendColorEXT" );
-        glBlendEquation = (PFNGLBLENDEQUATIONPROC) r3GetProcAddress( "glBlendEquation" );
-        glBlendEquationEXT = (PFNGLBLENDEQUATIONEXTPROC) r3GetProcAddress( "glBlendEquationEXT" );
-        glBlendEquationIndexedAMD = (PFNGLBLENDEQUATIONINDEXEDAMDPROC) r3GetProcAddress( "glBlendEquationIndexedAMD" );
-        glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC) r3GetProcAddress( "glBlendEquationSeparate" );
-        glBlendEquationSeparateEXT = (PFNGLBLENDEQUATIONSEPARATEEXTPROC) r3GetProcAddress( "glBlendEquationSeparateEXT" );
-        glBlendEquationSeparateIndexedAMD = (PFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC) r3GetProcAddress( "glBlendEquationSeparateIndexedAMD" );
-        glBlendEquationSeparatei = (PFNGLBLENDEQUATIONSEPARATEIPROC) r3GetProcAddress( "glBlendEquationSeparatei" );
-        glBlendEquationi = (PFNGLBLENDEQUATIONIPROC) r3GetProcAddress( "glBlendEquationi" );
-        glBlendFuncIndexedAMD = (PFNGLBLENDFUNCINDEXEDAMDPROC) r3GetProcAddress( "glBlendFuncIndexedAMD" );
-        glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC) r3GetProcAddress( "glBlendFuncSeparate" );
-        glBlendFuncSeparateEXT = (PFNGLBLENDFUNCSEPARATEEXTPROC) r3GetProcAddress( "glBlendFuncSeparateEXT" );
-        glBlendFuncSeparateINGR = (PFNGLBLENDFUNCSEPARATEINGRPROC) r3GetProcAddress( "glBlendFuncSeparateINGR" );
-        glBlendFuncSeparateIndexedAMD = (PFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC) r3GetProcAddress( "glBlendFuncSeparateIndexedAMD" );
-        glBlendFuncSeparatei = (PFNGLBLENDFUNCSEPARATEIPROC) r3GetProcAddress( "glBlendFuncSeparatei" );
-        glBlendFunci = (PFNGLBLENDFUNCIPROC) r3GetProcAddress( "glBlendFunci" );
-        glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC) r3GetProcAddress( "glBlitFramebuffer" );
-        glBlitFramebufferEXT = (PFNGLBLITFRAMEBUFFEREXTPROC) r3GetProcAddress( "glBlitFramebufferEXT" );
-        glBufferAddressRangeNV = (PFNGLBUFFERADDRESSRANGENVPROC) r3GetProcAddress( "glBufferAddressRangeNV" );
-        glBufferData = (PFNGLBUFFERDATAPROC) r3GetProcAddress( "glBufferData" );
-        glBufferDataARB = (PFNGLBUFFERDATAARBPROC) r3GetProcAddress( "glBufferDataARB" );
-        glBufferParameteriAPPLE = (PFNGLBUFFERPARAMETERIAPPLEPROC) r3GetProcAddress( "glBufferParameteriAPPLE" );
-        glBufferSubData = (PFNGLBUFFERSUBDATAPROC) r3GetProcAddress( "glBufferSubData" );
-        glBufferSubDataARB = (PFNGLBUFFERSUBDATAARBPROC) r3GetProcAddress( "glBufferSubDataARB" );
-        glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC) r3GetProcAddress( "glCheckFramebufferStatus" );
-        glCheckFramebufferStatusEXT = (PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC) r3GetProcAddress( "glCheckFramebufferStatusEXT" );
-        glCheckNamedFramebufferStatusEXT = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC) r3GetProcAddress( "glCheckNamedFramebufferStatusEXT" );
-        glClampColor = (PFNGLCLAMPCOLORPROC) r3GetProcAddress( "glClampColor" );
-        glClampColorARB = (PFNGLCLAMPCOLORARBPROC) r3GetProcAddress( "glClampColorARB" );
-        glClearBufferfi = (PFNGLCLEARBUFFERFIPROC) r3GetProcAddress( "glClearBufferfi" );
-        glClearBufferfv = (PFNGLCLEARBUFFERFVPROC) r3GetProcAddress( "glClearBufferfv" );
-        glClearBufferiv = (PFNGLCLEARBUFFERIVPROC) r3GetProcAddress( "glClearBufferiv" );
-        glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC) r3GetProcAddress( "glClearBufferuiv" );
-        glClearColorIiEXT = (PFNGLCLEARCOLORIIEXTPROC) r3GetProcAddress( "glClearColorIiEXT" );
-        glClearColorIuiEXT = (PFNGLCLEARCOLORIUIEXTPROC) r3GetProcAddress( "glClearColorIuiEXT" );
-        glClearDepthdNV = (PFNGLCLEARDEPTHDNVPROC) r3GetProcAddress( "glClearDepthdNV" );
-        glClientActiveTexture = (PFNGLCLIENTACTIVETEXTUREPROC) r3GetProcAddress( "glClientActiveTexture" );
-        glClientActiveTextureARB = (PFNGLCLIENTACTIVETEXTUREARBPROC) r3GetProcAddress( "glClientActiveTextureARB" );
-        glClientActiveVertexStreamATI = (PFNGLCLIENTACTIVEVERTEXSTREAMATIPROC) r3GetProcAddress( "glClientActiveVertexStreamATI" );
-        glClientAttribDefaultEXT = (PFNGLCLIENTATTRIBDEFAULTEXTPROC) r3GetProcAddress( "glClientAttribDefaultEXT" );
-        glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC) r3GetProcAddress( "glClientWaitSync" );
-        glColor3fVertex3fSUN = (PFNGLCOLOR3FVERTEX3FSUNPROC) r3GetProcAddress( "glColor3fVertex3fSUN" );
-        glColor3fVertex3fvSUN = (PFNGLCOLOR3FVERTEX3FVSUNPROC) r3GetProcAddress( "glColor3fVertex3fvSUN" );
-        glColor3hNV = (PFNGLCOLOR3HNVPROC) r3GetProcAddress( "glColor3hNV" );
-        glColor3hvNV = (PFNGLCOLOR3HVNVPROC) r3GetProcAddress( "glColor3hvNV" );
-        glColor4fNormal3fVertex3fSUN = (PFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC) r3GetProcAddress( "glColor4fNormal3fVertex3fSUN" );
-        glColor4fNormal3fVertex3fvSUN = (PFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC) r3GetProcAddress( "glColor4fNormal3fVertex3fvSUN" );
-        glColor4hNV = (PFNGLCOLOR4HNVPROC) r3GetProcAddress( "glColor4hNV" );
-        glColor4hvNV = (PFNGLCOLOR4HVNVPROC) r3GetProcAddress( "glColor4hvNV" );
-        glColor4ubVertex2fSUN = (PFNGLCOLOR4UBVERTEX2FSUNPROC) r3GetProcAddress( "glColor4ubVertex2fSUN" );
-        glColor4ubVertex2fvSUN = (PFNGLCOLOR4UBVERTEX2FVSUNPROC) r3GetProcAddress( "glColor4ubVertex2fvSUN" );
-        glColor4ubVertex3fSUN = (PFNGLCOLOR4UBVERTEX3FSUNPROC) r3GetProcAddress( "glColor4ubVertex3fSUN" );
-        glColor4ubVertex3fvSUN = (PFNGLCOLOR4UBVERTEX3FVSUNPROC) r3GetProcAddress( "glColor4ubVertex3fvSUN" );
-        glColorFormatNV = (PFNGLCOLORFORMATNVPROC) r3GetProcAddress( "glColorFormatNV" );
-        glColorFragmentOp1ATI = (PFNGLCOLORFRAGMENTOP1ATIPROC) r3GetProcAddress( "glColorFragmentOp1ATI" );
-        glColorFragmentOp2ATI = (PFNGLCOLORFRAGMENTOP2ATIPROC) r3GetProcAddress( "glColorFragmentOp2ATI" );
-        glColorFragmentOp3ATI = (PFNGLCOLORFRAGMENTOP3ATIPROC) r3GetProcAddress( "glColorFragmentOp3ATI" );
-        glColorMaskIndexedEXT = (PFNGLCOLORMASKINDEXEDEXTPROC) r3GetProcAddress( "glColorMaskIndexedEXT" );
-        glColorMaski = (PFNGLCOLORMASKIPROC) r3GetProcAddress( "glColorMaski" );
-        glColorP3ui = (PFNGLCOLORP3UIPROC) r3GetProcAddress( "glColorP3ui" );
-        glColorP3uiv = (PFNGLCOLORP3UIVPROC) r3GetProcAddress( "glColorP3uiv" );
-        glColorP4ui = (PFNGLCOLORP4UIPROC) r3GetProcAddress( "glColorP4ui" );
-        glColorP4uiv = (PFNGLCOLORP4UIVPROC) r3GetProcAddress( "glColorP4uiv" );
-        glColorPointerEXT = (PFNGLCOLORPOINTEREXTPROC) r3GetProcAddress( "glColorPointerEXT" );
-        glColorPointerListIBM = (PFNGLCOLORPOINTERLISTIBMPROC) r3GetProcAddress( "glColorPointerListIBM" );
-        glColorPointervINTEL = (PFNGLCOLORPOINTERVINTELPROC) r3GetProcAddress( "glColorPointervINTEL" );
-        glColorSubTable = (PFNGLCOLORSUBTABLEPROC) r3GetProcAddress( "glColorSubTable" );
-        glColorSubTableEXT = (PFNGLCOLORSUBTABLEEXTPROC) r3GetProcAddress( "glColorSubTableEXT" );
-        glColorTable = (PFNGLCOLORTABLEPROC) r3GetProcAddress( "glColorTable" );
-        glColorTableEXT = (PFNGLCOLORTABLEEXTPROC) r3GetProcAddress( "glColorTableEXT" );
-        glColorTableParameterfv = (PFNGLCOLORTABLEPARAMETERFVPROC) r3GetProcAddress( "glColorTableParameterfv" );
-        glColorTableParameterfvSGI = (PFNGLCOLORTABLEPARAMETERFVSGIPROC) r3GetProcAddress( "glColorTableParameterfvSGI" );
-        glColorTableParameteriv = (PFNGLCOLORTABLEPARAMETERIVPROC) r3GetProcAddress( "glColorTableParameteriv" );
-        glColorTableParameterivSGI = (PFNGLCOLORTABLEPARAMETERIVSGIPROC) r3GetProcAddress( "glColorTableParameterivSGI" );
-        glColorTableSGI = (PFNGLCOLORTABLESGIPROC) r3GetProcAddress( "glColorTableSGI" );
-        glCombinerInputNV = (PFNGLCOMBINERINPUTNVPROC) r3GetProcAddress( "glCombinerInputNV" );
-        glCombinerOutputNV = (PFNGLCOMBINEROUTPUTNVPROC) r3GetProcAddress( "glCombinerOutputNV" );
-        glCombinerParameterfNV = (PFNGLCOMBINERPARAMETERFNVPROC) r3GetProcAddress( "glCombinerParameterfNV" );
-        glCombinerParameterfvNV = (PFNGLCOMBINERPARAMETERFVNVPROC) r3GetProcAddress( "glCombinerParameterfvNV" );
-        glCombinerParameteriNV = (PFNGLCOMBINERPARAMETERINVPROC) r3GetProcAddress( "glCombinerParameteriNV" );
-        glCombinerParameterivNV = (PFNGLCOMBINERPARAMETERIVNVPROC) r3GetProcAddress( "glCombinerParameterivNV" );
-        glCombinerStageParameterfvNV = (PFNGLCOMBINERSTAGEPARAMETERFVNVPROC) r3GetProcAddress( "glCombinerStageParameterfvNV" );
-        glCompileShader = (PFNGLCOMPILESHADERPROC) r3GetProcAddress( "glCompileShader" );
-        glCompileShaderARB = (PFNGLCOMPILESHADERARBPROC) r3GetProcAddress( "glCompileShaderARB" );
-        glCompileShaderIncludeARB = (PFNGLCOMPILESHADERINCLUDEARBPROC) r3GetProcAddress( "glCompileShaderIncludeARB" );
-        glCompressedMultiTexImage1DEXT = (PFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC) r3GetProcAddress( "glCompressedMultiTexImage1DEXT" );
-        glCompressedMultiTexImage2DEXT = (PFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC) r3GetProcAddress( "glCompressedMultiTexImage2DEXT" );
-        glCompressedMultiTexImage3DEXT = (PFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC) r3GetProcAddress( "glCompressedMultiTexImage3DEXT" );
-        glCompressedMultiTexSubImage1DEXT = (PFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC) r3GetProcAddress( "glCompressedMultiTexSubImage1DEXT" );
-        glCompressedMultiTexSubImage2DEXT = (PFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC) r3GetProcAddress( "glCompressedMultiTexSubImage2DEXT" );
-        glCompressedMultiTexSubImage3DEXT = (PFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC) r3GetProcAddress( "glCompressedMultiTexSubImage3DEXT" );
-        glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC) r3GetProcAddress( "glCompressedTexImage1D" );
-        glCompressedTexImage1DARB = (PFNGLCOMPRESSEDTEXIMAGE1DARBPROC) r3GetProcAddress( "glCompressedTexImage1DARB" );
-        glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC) r3GetProcAddress( "glCompressedTexImage2D" );
-        glCompressedTexImage2DARB = (PFNGLCOMPRESSEDTEXIMAGE2DARBPROC) r3GetProcAddress( "glCompressedTexImage2DARB" );
-        glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC) r3GetProcAddress( "glCompressedTexImage3D" );
-        glCompressedTexImage3DARB = (PFNGLCOMPRESSEDTEXIMAGE3DARBPROC) r3GetProcAddress( "glCompressedTexImage3DARB" );
-        glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC) r3GetProcAddress( "glCompressedTexSubImage1D" );
-        glCompressedTexSubImage1DARB = (PFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC) r3GetProcAddress( "glCompressedTexSubImage1DARB" );
-        glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC) r3GetProcAddress( "glCompressedTexSubImage2D" );
-        glCompressedTexSubImage2DARB = (PFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC) r3GetProcAddress( "glCompressedTexSubImage2DARB" );
-        glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC) r3GetProcAddress( "glCompressedTexSubImage3D" );
-        glCompressedTexSubImage3DARB = (PFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC) r3GetProcAddress( "glCompressedTexSubImage3DARB" );
-        glCompressedTextureImage1DEXT = (PFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC) r3GetProcAddress( "glCompressedTextureImage1DEXT" );
-        glCompressedTextureImage2DEXT = (PFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC) r3GetProcAddress( "glCompressedTextureImage2DEXT" );
-        glCompressedTextureImage3DEXT = (PFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC) r3GetProcAddress( "glCompressedTextureImage3DEXT" );
-        glCompressedTextureSubImage1DEXT = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC) r3GetProcAddress( "glCompressedTextureSubImage1DEXT" );
-        glCompressedTextureSubImage2DEXT = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC) r3GetProcAddress( "glCompressedTextureSubImage2DEXT" );
-        glCompressedTextureSubImage3DEXT = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC) r3GetProcAddress( "glCompressedTextureSubImage3DEXT" );
-        glConvolutionFilter1D = (PFNGLCONVOLUTIONFILTER1DPROC) r3GetProcAddress( "glConvolutionFilter1D" );
-        glConvolutionFilter1DEXT = (PFNGLCONVOLUTIONFILTER1DEXTPROC) r3GetProcAddress( "glConvolutionFilter1DEXT" );
-        glConvolutionFilter2D = (PFNGLCONVOLUTIONFILTER2DPROC) r3GetProcAddress( "glConvolutionFilter2D" );
-        glConvolutionFilter2DEXT = (PFNGLCONVOLUTIONFILTER2DEXTPROC) r3GetProcAddress( "glConvolutionFilter2DEXT" );
-        glConvolutionParameterf = (PFNGLCONVOLUTIONPARAMETERFPROC) r3GetProcAddress( "glConvolutionParameterf" );
-        glConvolutionParameterfEXT = (PFNGLCONVOLUTIONPARAMETERFEXTPROC) r3GetProcAddress( "glConvolutionParameterfEXT" );
-        glConvolutionParameterfv = (PFNGLCONVOLUTIONPARAMETERFVPROC) r3GetProcAddress( "glConvolutionParameterfv" );
-        glConvolutionParameterfvEXT = (PFNGLCONVOLUTIONPARAMETERFVEXTPROC) r3GetProcAddress( "glConvolutionParameterfvEXT" );
-        glConvolutionParameteri = (PFNGLCONVOLUTIONPARAMETERIPROC) r3GetProcAddress( "glConvolutionParameteri" );
-        glConvolutionParameteriEXT = (PFNGLCONVOLUTIONPARAMETERIEXTPROC) r3GetProcAddress( "glConvolutionParameteriEXT" );
-        glConvolutionParameteriv = (PFNGLCONVOLUTIONPARAMETERIVPROC) r3GetProcAddress( "glConvolutionParameteriv" );
-        glConvolutionParameterivEXT = (PFNGLCONVOLUTIONPARAMETERIVEXTPROC) r3GetProcAddress( "glConvolutionParameterivEXT" );
-        glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC) r3GetProcAddress( "glCopyBufferSubData" );
-        glCopyColorSubTable = (PFNGLCOPYCOLORSUBTABLEPROC) r3GetProcAddress( "glCopyColorSubTable" );
-        glCopyColorSubTableEXT = (PFNGLCOPYCOLORSUBTABLEEXTPROC) r3GetProcAddress( "glCopyColorSubTableEXT" );
-        glCopyColorTable = (PFNGLCOPYCOLORTABLEPROC) r3GetProcAddress( "glCopyColorTable" );
-        glCopyColorTableSGI = (PFNGLCOPYCOLORTABLESGIPROC) r3GetProcAddress( "glCopyColorTableSGI" );
-        glCopyConvolutionFilter1D = (PFNGLCOPYCONVOLUTIONFILTER1DPROC) r3GetProcAddress( "glCopyConvolutionFilter1D" );
-        glCopyConvolutionFilter1DEXT = (PFNGLCOPYCONVOLUTIONFILTER1DEXTPROC) r3GetProcAddress( "glCopyConvolutionFilter1DEXT" );
-        glCopyConvolutionFilter2D = (PFNGLCOPYCONVOLUTIONFILTER2DPROC) r3GetProcAddress( "glCopyConvolutionFilter2D" );
-        glCopyConvolutionFilter2DEXT = (PFNGLCOPYCONVOLUTIONFILTER2DEXTPROC) r3GetProcAddress( "glCopyConvolutionFilter2DEXT" );
-        glCopyImageSubDataNV = (PFNGLCOPYIMAGESUBDATANVPROC) r3GetProcAddress( "glCopyImageSubDataNV" );
-        glCopyMultiTexImage1DEXT = (PFNGLCOPYMULTITEXIMAGE1DEXTPROC) r3GetProcAddress( "glCopyMultiTexImage1DEXT" );
-        glCopyMultiTexImage2DEXT = (PFNGLCOPYMULTITEXIMAGE2DEXTPROC) r3GetProcAddress( "glCopyMultiTexImage2DEXT" );
-        glCopyMultiTexSubImage1DEXT = (PFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC) r3GetProcAddress( "glCopyMultiTexSubImage1DEXT" );
-        glCopyMultiTexSubImage2DEXT = (PFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC) r3GetProcAddress( "glCopyMultiTexSubImage2DEXT" );
-        glCopyMultiTexSubImage3DEXT = (PFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC) r3GetProcAddress( "glCopyMultiTexSubImage3DEXT" );
-        glCopyTexImage1DEXT = (PFNGLCOPYTEXIMAGE1DEXTPROC) r3GetProcAddress( "glCopyTexImage1DEXT" );
-        glCopyTexImage2DEXT = (PFNGLCOPYTEXIMAGE2DEXTPROC) r3GetProcAddress( "glCopyTexImage2DEXT" );
-        glCopyTexSubImage1DEXT = (PFNGLCOPYTEXSUBIMAGE1DEXTPROC) r3GetProcAddress( "glCopyTexSubImage1DEXT" );
-        glCopyTexSubImage2DEXT = (PFNGLCOPYTEXSUBIMAGE2DEXTPROC) r3GetProcAddress( "glCopyTexSubImage2DEXT" );
-        glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC) r3GetProcAddress( "glCopyTexSubImage3D" );
-        glCopyTexSubImage3DEXT = (PFNGLCOPYTEXSUBIMAGE3DEXTPROC) r3GetProcAddress( "glCopyTexSubImage3DEXT" );
-        glCopyTextureImage1DEXT = (PFNGLCOPYTEXTUREIMAGE1DEXTPROC) r3GetProcAddress( "glCopyTextureImage1DEXT" );
-        glCopyTextureImage2DEXT = (PFNGLCOPYTEXTUREIMAGE2DEXTPROC) r3GetProcAddress( "glCopyTextureImage2DEXT" );
-        glCopyTextureSubImage1DEXT = (PFNGLCOPYTEXTURESUBIMAGE1DEXTPROC) r3GetProcAddress( "glCopyTextureSubImage1DEXT" );
-        glCopyTextureSubImage2DEXT = (PFNGLCOPYTEXTURESUBIMAGE2DEXTPROC) r3GetProcAddress( "glCopyTextureSubImage2DEXT" );
-        glCopyTextureSubImage3DEXT = (PFNGLCOPYTEXTURESUBIMAGE3DEXTPROC) r3GetProcAddress( "glCopyTextureSubImage3DEXT" );
-        glCreateProgram = (PFNGLCREATEPROGRAMPROC) r3GetProcAddress( "glCreateProgram" );
-        glCreateProgramObjectARB = (PFNGLCREATEPROGRAMOBJECTARBPROC) r3GetProcAddress( "glCreateProgramObjectARB" );
-        glCreateShader = (PFNGLCREATESHADERPROC) r3GetProcAddress( "glCreateShader" );
-        glCreateShaderObjectARB = (PFNGLCREATESHADEROBJECTARBPROC) r3GetProcAddress( "glCreateShaderObjectARB" );
-        glCreateShaderProgramEXT = (PFNGLCREATESHADERPROGRAMEXTPROC) r3GetProcAddress( "glCreateShaderProgramEXT" );
-        glCullParameterdvEXT = (PFNGLCULLPARAMETERDVEXTPROC) r3GetProcAddress( "glCullParameterdvEXT" );
-        glCullParameterfvEXT = (PFNGLCULLPARAMETERFVEXTPROC) r3GetProcAddress( "glCullParameterfvEXT" );
-        glCurrentPaletteMatrixARB = (PFNGLCURRENTPALETTEMATRIXARBPROC) r3GetProcAddress( "glCurrentPaletteMatrixARB" );
-        glDeformSGIX = (PFNGLDEFORMSGIXPROC) r3GetProcAddress( "glDeformSGIX" );
-        glDeformationMap3dSGIX = (PFNGLDEFORMATIONMAP3DSGIXPROC) r3GetProcAddress( "glDeformationMap3dSGIX" );
-        glDeformationMap3fSGIX = (PFNGLDEFORMATIONMAP3FSGIXPROC) r3GetProcAddress( "glDeformationMap3fSGIX" );
-        glDeleteAsyncMarkersSGIX = (PFNGLDELETEASYNCMARKERSSGIXPROC) r3GetProcAddress( "glDeleteAsyncMarkersSGIX" );
-        glDeleteBuffers = (PFNGLDELETEBUFFERSPROC) r3GetProcAddress( "glDeleteBuffers" );
-        glDeleteBuffersARB = (PFNGLDELETEBUFFERSARBPROC) r3GetProcAddress( "glDeleteBuffersARB" );
-        glDeleteFencesAPPLE = (PFNGLDELETEFENCESAPPLEPROC) r3GetProcAddress( "glDeleteFencesAPPLE" );
-        glDeleteFencesNV = (PFNGLDELETEFENCESNVPROC) r3GetProcAddress( "glDeleteFencesNV" );
-        glDeleteFragmentShaderATI = (PFNGLDELETEFRAGMENTSHADERATIPROC) r3GetProcAddress( "glDeleteFragmentShaderATI" );
-        glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC) r3GetProcAddress( "glDeleteFramebuffers" );
-        glDeleteFramebuffersEXT = (PFNGLDELETEFRAMEBUFFERSEXTPROC) r3GetProcAddress( "glDeleteFramebuffersEXT" );
-        glDeleteNamedStringARB = (PFNGLDELETENAMEDSTRINGARBPROC) r3GetProcAddress( "glDeleteNamedStringARB" );
-        glDeleteObjectARB = (PFNGLDELETEOBJECTARBPROC) r3GetProcAddress( "glDeleteObjectARB" );
-        glDeleteOcclusionQueriesNV = (PFNGLDELETEOCCLUSIONQUERIESNVPROC) r3GetProcAddress( "glDeleteOcclusionQueriesNV" );
-        glDeletePerfMonitorsAMD = (PFNGLDELETEPERFMONITORSAMDPROC) r3GetProcAddress( "glDeletePerfMonitorsAMD" );
-        glDeleteProgram = (PFNGLDELETEPROGRAMPROC) r3GetProcAddress( "glDeleteProgram" );
-        glDeleteProgramsARB = (PFNGLDELETEPROGRAMSARBPROC) r3GetProcAddress( "glDeleteProgramsARB" );
-        glDeleteProgramsNV = (PFNGLDELETEPROGRAMSNVPROC) r3GetProcAddress( "glDeleteProgramsNV" );
-        glDeleteQueries = (PFNGLDELETEQUERIESPROC) r3GetProcAddress( "glDeleteQueries" );
-        glDeleteQueriesARB = (PFNGLDELETEQUERIESARBPROC) r3GetProcAddress( "glDeleteQueriesARB" );
-        glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC) r3GetProcAddress( "glDeleteRenderbuffers" );
-        glDeleteRenderbuffersEXT = (PFNGLDELETERENDERBUFFERSEXTPROC) r3GetProcAddress( "glDeleteRenderbuffersEXT" );
-        glDeleteSamplers = (PFNGLDELETESAMPLERSPROC) r3GetProcAddress( "glDeleteSamplers" );
-        glDeleteShader = (PFNGLDELETESHADERPROC) r3GetProcAddress( "glDeleteShader" );
-        glDeleteSync = (PFNGLDELETESYNCPROC) r3GetProcAddress( "glDeleteSync" );
-        glDeleteTexturesEXT = (PFNGLDELETETEXTURESEXTPROC) r3GetProcAddress( "glDeleteTexturesEXT" );
-        glDeleteTransformFeedbacks = (PFNGLDELETETRANSFORMFEEDBACKSPROC) r3GetProcAddress( "glDeleteTransformFeedbacks" );
-        glDeleteTransformFeedbacksNV = (PFNGLDELETETRANSFORMFEEDBACKSNVPROC) r3GetProcAddress( "glDeleteTransformFeedbacksNV" );
-        glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC) r3GetProcAddress( "glDeleteVertexArrays" );
-        glDeleteVertexArraysAPPLE = (PFNGLDELETEVERTEXARRAYSAPPLEPROC) r3GetProcAddress( "glDeleteVertexArraysAPPLE" );
-        glDeleteVertexShaderEXT = (PFNGLDELETEVERTEXSHADEREXTPROC) r3GetProcAddress( "glDeleteVertexShaderEXT" );
-        glDepthBoundsEXT = (PFNGLDEPTHBOUNDSEXTPROC) r3GetProcAddress( "glDepthBoundsEXT" );
-        glDepthBoundsdNV = (PFNGLDEPTHBOUNDSDNVPROC) r3GetProcAddress( "glDepthBoundsdNV" );
-        glDepthRangedNV = (PFNGLDEPTHRANGEDNVPROC) r3GetProcAddress( "glDepthRangedNV" );
-        glDetachObjectARB = (PFNGLDETACHOBJECTARBPROC) r3GetProcAddress( "glDetachObjectARB" );
-        glDetachShader = (PFNGLDETACHSHADERPROC) r3GetProcAddress( "glDetachShader" );
-        glDetailTexFuncSGIS = (PFNGLDETAILTEXFUNCSGISPROC) r3GetProcAddress( "glDetailTexFuncSGIS" );
-        glDisableClientStateIndexedEXT = (PFNGLDISABLECLIENTSTATEINDEXEDEXTPROC) r3GetProcAddress( "glDisableClientStateIndexedEXT" );
-        glDisableIndexedEXT = (PFNGLDISABLEINDEXEDEXTPROC) r3GetProcAddress( "glDisableIndexedEXT" );
-        glDisableVariantClientStateEXT = (PFNGLDISABLEVARIANTCLIENTSTATEEXTPROC) r3GetProcAddress( "glDisableVariantClientStateEXT" );
-        glDisableVertexAttribAPPLE = (PFNGLDISABLEVERTEXATTRIBAPPLEPROC) r3GetProcAddress( "glDisableVertexAttribAPPLE" );
-        glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC) r3GetProcAddress( "glDisableVertexAttribArray" );
-        glDisableVertexAttribArrayARB = (PFNGLDISABLEVERTEXATTRIBARRAYARBPROC) r3GetProcAddress( "glDisableVertexAttribArrayARB" );
-        glDisablei = (PFNGLDISABLEIPROC) r3GetProcAddress( "glDisablei" );
-        glDrawArraysEXT = (PFNGLDRAWARRAYSEXTPROC) r3GetProcAddress( "glDrawArraysEXT" );
-        glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC) r3GetProcAddress( "glDrawArraysIndirect" );
-        glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC) r3GetProcAddress( "glDrawArraysInstanced" );
-        glDrawArraysInstancedARB = (PFNGLDRAWARRAYSINSTANCEDARBPROC) r3GetProcAddress( "glDrawArraysInstancedARB" );
-        glDrawArraysInstancedEXT = (PFNGLDRAWARRAYSINSTANCEDEXTPROC) r3GetProcAddress( "glDrawArraysInstancedEXT" );
-        glDrawBuffers = (PFNGLDRAWBUFFERSPROC) r3GetProcAddress( "glDrawBuffers" );
-        glDrawBuffersARB = (PFNGLDRAWBUFFERSARBPROC) r3GetProcAddress( "glDrawBuffersARB" );
-        glDrawBuffersATI = (PFNGLDRAWBUFFERSATIPROC) r3GetProcAddress( "glDrawBuffersATI" );
-        glDrawElementArrayAPPLE = (PFNGLDRAWELEMENTARRAYAPPLEPROC) r3GetProcAddress( "glDrawElementArrayAPPLE" );
-        glDrawElementArrayATI = (PFNGLDRAWELEMENTARRAYATIPROC) r3GetProcAddress( "glDrawElementArrayATI" );
-        glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC) r3GetProcAddress( "glDrawElementsBaseVertex" );
-        glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC) r3GetProcAddress( "glDrawElementsIndirect" );
-        glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC) r3GetProcAddress( "glDrawElementsInstanced" );
-        glDrawElementsInstancedARB = (PFNGLDRAWELEMENTSINSTANCEDARBPROC) r3GetProcAddress( "glDrawElementsInstancedARB" );
-        glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC) r3GetProcAddress( "glDrawElementsInstancedBaseVertex" );
-        glDrawElementsInstancedEXT = (PFNGLDRAWELEMENTSINSTANCEDEXTPROC) r3GetProcAddress( "glDrawElementsInstancedEXT" );
-        glDrawMeshArraysSUN = (PFNGLDRAWMESHARRAYSSUNPROC) r3GetProcAddress( "glDrawMeshArraysSUN" );
-        glDrawRangeElementArrayAPPLE = (PFNGLDRAWRANGEELEMENTARRAYAPPLEPROC) r3GetProcAddress( "glDrawRangeElementArrayAPPLE" );
-        glDrawRangeElementArrayATI = (PFNGLDRAWRANGEELEMENTARRAYATIPROC) r3GetProcAddress( "glDrawRangeElementArrayATI" );
-        glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC) r3GetProcAddress( "glDrawRangeElements" );
-        glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC) r3GetProcAddress( "glDrawRangeElementsBaseVertex" );
-        glDrawRangeElementsEXT = (PFNGLDRAWRANGEELEMENTSEXTPROC) r3GetProcAddress( "glDrawRangeElementsEXT" );
-        glDrawTransformFeedback = (PFNGLDRAWTRANSFORMFEEDBACKPROC) r3GetProcAddress( "glDrawTransformFeedback" );
-        glDrawTransformFeedbackNV = (PFNGLDRAWTRANSFORMFEEDBACKNVPROC) r3GetProcAddress( "glDrawTransformFeedbackNV" );
-        glDrawTransformFeedbackStream = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC) r3GetProcAddress( "glDrawTransformFeedbackStream" );
-        glEdgeFlagFormatNV = (PFNGLEDGEFLAGFORMATNVPROC) r3GetProcAddress( "glEdgeFlagFormatNV" );
-        glEdgeFlagPointerEXT = (PFNGLEDGEFLAGPOINTEREXTPROC) r3GetProcAddress( "glEdgeFlagPointerEXT" );
-        glEdgeFlagPointerListIBM = (PFNGLEDGEFLAGPOINTERLISTIBMPROC) r3GetProcAddress( "glEdgeFlagPointerListIBM" );
-        glElementPointerAPPLE = (PFNGLELEMENTPOINTERAPPLEPROC) r3GetProcAddress( "glElementPointerAPPLE" );
-        glElementPointerATI = (PFNGLELEMENTPOINTERATIPROC) r3GetProcAddress( "glElementPointerATI" );
-        glEnableClientStateIndexedEXT = (PFNGLENABLECLIENTSTATEINDEXEDEXTPROC) r3GetProcAddress( "glEnableClientStateIndexedEXT" );
-        glEnableIndexedEXT = (PFNGLENABLEINDEXEDEXTPROC) r3GetProcAddress( "glEnableIndexedEXT" );
-        glEnableVariantClientStateEXT = (PFNGLENABLEVARIANTCLIENTSTATEEXTPROC) r3GetProcAddress( "glEnableVariantClientStateEXT" );
-        glEnableVertexAttribAPPLE = (PFNGLENABLEVERTEXATTRIBAPPLEPROC) r3GetProcAddress( "glEnableVertexAttribAPPLE" );
-        glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC) r3GetProcAddress( "glEnableVertexAttribArray" );
-        glEnableVertexAttribArrayARB = (PFNGLENABLEVERTEXATTRIBARRAYARBPROC) r3GetProcAddress( "glEnableVertexAttribArrayARB" );
-        glEnablei = (PFNGLENABLEIPROC) r3GetProcAddress( "glEnablei" );
-        glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC) r3GetProcAddress( "glEndConditionalRender" );
-        glEndConditionalRenderNV = (PFNGLENDCONDITIONALRENDERNVPROC) r3GetProcAddress( "glEndConditionalRenderNV" );
-        glEndFragmentShaderATI = (PFNGLENDFRAGMENTSHADERATIPROC) r3GetProcAddress( "glEndFragmentShaderATI" );
-        glEndOcclusionQueryNV = (PFNGLENDOCCLUSIONQUERYNVPROC) r3GetProcAddress( "glEndOcclusionQueryNV" );
-        glEndPerfMonitorAMD = (PFNGLENDPERFMONITORAMDPROC) r3GetProcAddress( "glEndPerfMonitorAMD" );
-        glEndQuery = (PFNGLENDQUERYPROC) r3GetProcAddress( "glEndQuery" );
-        glEndQueryARB = (PFNGLENDQUERYARBPROC) r3GetProcAddress( "glEndQueryARB" );
-        glEndQueryIndexed = (PFNGLENDQUERYINDEXEDPROC) r3GetProcAddress( "glEndQueryIndexed" );
-        glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC) r3GetProcAddress( "glEndTransformFeedback" );
-        glEndTransformFeedbackEXT = (PFNGLENDTRANSFORMFEEDBACKEXTPROC) r3GetProcAddress( "glEndTransformFeedbackEXT" );
-        glEndTransformFeedbackNV = (PFNGLENDTRANSFORMFEEDBACKNVPROC) r3GetProcAddress( "glEndTransformFeedbackNV" );
-        glEndVertexShaderEXT = (PFNGLENDVERTEXSHADEREXTPROC) r3GetProcAddress( "glEndVertexShaderEXT" );
-        glEndVideoCaptureNV = (PFNGLENDVIDEOCAPTURENVPROC) r3GetProcAddress( "glEndVideoCaptureNV" );
-        glEvalMapsNV = (PFNGLEVALMAPSNVPROC) r3GetProcAddress( "glEvalMapsNV" );
-        glExecuteProgramNV = (PFNGLEXECUTEPROGRAMNVPROC) r3GetProcAddress( "glExecuteProgramNV" );
-        glExtractComponentEXT = (PFNGLEXTRACTCOMPONENTEXTPROC) r3GetProcAddress( "glExtractComponentEXT" );
-        glFenceSync = (PFNGLFENCESYNCPROC) r3GetProcAddress( "glFenceSync" );
-        glFinalCombinerInputNV = (PFNGLFINALCOMBINERINPUTNVPROC) r3GetProcAddress( "glFinalCombinerInputNV" );
-        glFinishAsyncSGIX = (PFNGLFINISHASYNCSGIXPROC) r3GetProcAddress( "glFinishAsyncSGIX" );
-        glFinishFenceAPPLE = (PFNGLFINISHFENCEAPPLEPROC) r3GetProcAddress( "glFinishFenceAPPLE" );
-        glFinishFenceNV = (PFNGLFINISHFENCENVPROC) r3GetProcAddress( "glFinishFenceNV" );
-        glFinishObjectAPPLE = (PFNGLFINISHOBJECTAPPLEPROC) r3GetProcAddress( "glFinishObjectAPPLE" );
-        glFinishTextureSUNX = (PFNGLFINISHTEXTURESUNXPROC) r3GetProcAddress( "glFinishTextureSUNX" );
-        glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC) r3GetProcAddress( "glFlushMappedBufferRange" );
-        glFlushMappedBufferRangeAPPLE = (PFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC) r3GetProcAddress( "glFlushMappedBufferRangeAPPLE" );
-        glFlushMappedNamedBufferRangeEXT = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC) r3GetProcAddress( "glFlushMappedNamedBufferRangeEXT" );
-        glFlushPixelDataRangeNV = (PFNGLFLUSHPIXELDATARANGENVPROC) r3GetProcAddress( "glFlushPixelDataRangeNV" );
-        glFlushRasterSGIX = (PFNGLFLUSHRASTERSGIXPROC) r3GetProcAddress( "glFlushRasterSGIX" );
-        glFlushVertexArrayRangeAPPLE = (PFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC) r3GetProcAddress( "glFlushVertexArrayRangeAPPLE" );
-        glFlushVertexArrayRangeNV = (PFNGLFLUSHVERTEXARRAYRANGENVPROC) r3GetProcAddress( "glFlushVertexArrayRangeNV" );
-        glFogCoordFormatNV = (PFNGLFOGCOORDFORMATNVPROC) r3GetProcAddress( "glFogCoordFormatNV" );
-        glFogCoordPointer = (PFNGLFOGCOORDPOINTERPROC) r3GetProcAddress( "glFogCoordPointer" );
-        glFogCoordPointerEXT = (PFNGLFOGCOORDPOINTEREXTPROC) r3GetProcAddress( "glFogCoordPointerEXT" );
-        glFogCoordPointerListIBM = (PFNGLFOGCOORDPOINTERLISTIBMPROC) r3GetProcAddress( "glFogCoordPointerListIBM" );
-        glFogCoordd = (PFNGLFOGCOORDDPROC) r3GetProcAddress( "glFogCoordd" );
-        glFogCoorddEXT = (PFNGLFOGCOORDDEXTPROC) r3GetProcAddress( "glFogCoorddEXT" );
-        glFogCoorddv = (PFNGLFOGCOORDDVPROC) r3GetProcAddress( "glFogCoorddv" );
-        glFogCoorddvEXT = (PFNGLFOGCOORDDVEXTPROC) r3GetProcAddress( "glFogCoorddvEXT" );
-        glFogCoordf = (PFNGLFOGCOORDFPROC) r3GetProcAddress( "glFogCoordf" );
-        glFogCoordfEXT = (PFNGLFOGCOORDFEXTPROC) r3GetProcAddress( "glFogCoordfEXT" );
-        glFogCoordfv = (PFNGLFOGCOORDFVPROC) r3GetProcAddress( "glFogCoordfv" );
-        glFogCoordfvEXT = (PFNGLFOGCOORDFVEXTPROC) r3GetProcAddress( "glFogCoordfvEXT" );
-        glFogCoordhNV = (PFNGLFOGCOORDHNVPROC) r3GetProcAddress( "glFogCoordhNV" );
-        glFogCoordhvNV = (PFNGLFOGCOORDHVNVPROC) r3GetProcAddress( "glFogCoordhvNV" );
-        glFogFuncSGIS = (PFNGLFOGFUNCSGISPROC) r3GetProcAddress( "glFogFuncSGIS" );
-        glFragmentColorMaterialSGIX = (PFNGLFRAGMENTCOLORMATERIALSGIXPROC) r3GetProcAddress( "glFragmentColorMaterialSGIX" );
-        glFragmentLightModelfSGIX = (PFNGLFRAGMENTLIGHTMODELFSGIXPROC) r3GetProcAddress( "glFragmentLightModelfSGIX" );
-        glFragmentLightModelfvSGIX = (PFNGLFRAGMENTLIGHTMODELFVSGIXPROC) r3GetProcAddress( "glFragmentLightModelfvSGIX" );
-        glFragmentLightModeliSGIX = (PFNGLFRAGMENTLIGHTMODELISGIXPROC) r3GetProcAddress( "glFragmentLightModeliSGIX" );
-        glFragmentLightModelivSGIX = (PFNGLFRAGMENTLIGHTMODELIVSGIXPROC) r3GetProcAddress( "glFragmentLightModelivSGIX" );
-        glFragmentLightfSGIX = (PFNGLFRAGMENTLIGHTFSGIXPROC) r3GetProcAddress( "glFragmentLightfSGIX" );
-        glFragmentLightfvSGIX = (PFNGLFRAGMENTLIGHTFVSGIXPROC) r3GetProcAddress( "glFragmentLightfvSGIX" );
-        glFragmentLightiSGIX = (PFNGLFRAGMENTLIGHTISGIXPROC) r3GetProcAddress( "glFragmentLightiSGIX" );
-        glFragmentLightivSGIX = (PFNGLFRAGMENTLIGHTIVSGIXPROC) r3GetProcAddress( "glFragmentLightivSGIX" );
-        glFragmentMaterialfSGIX = (PFNGLFRAGMENTMATERIALFSGIXPROC) r3GetProcAddress( "glFragmentMaterialfSGIX" );
-        glFragmentMaterialfvSGIX = (PFNGLFRAGMENTMATERIALFVSGIXPROC) r3GetProcAddress( "glFragmentMaterialfvSGIX" );
-        glFragmentMaterialiSGIX = (PFNGLFRAGMENTMATERIALISGIXPROC) r3GetProcAddress( "glFragmentMaterialiSGIX" );
-        glFragmentMaterialivSGIX = (PFNGLFRAGMENTMATERIALIVSGIXPROC) r3GetProcAddress( "glFragmentMaterialivSGIX" );
-        glFrameTerminatorGREMEDY = (PFNGLFRAMETERMINATORGREMEDYPROC) r3GetProcAddress( "glFrameTerminatorGREMEDY" );
-        glFrameZoomSGIX = (PFNGLFRAMEZOOMSGIXPROC) r3GetProcAddress( "glFrameZoomSGIX" );
-        glFramebufferDrawBufferEXT = (PFNGLFRAMEBUFFERDRAWBUFFEREXTPROC) r3GetProcAddress( "glFramebufferDrawBufferEXT" );
-        glFramebufferDrawBuffersEXT = (PFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC) r3GetProcAddress( "glFramebufferDrawBuffersEXT" );
-        glFramebufferReadBufferEXT = (PFNGLFRAMEBUFFERREADBUFFEREXTPROC) r3GetProcAddress( "glFramebufferReadBufferEXT" );
-        glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC) r3GetProcAddress( "glFramebufferRenderbuffer" );
-        glFramebufferRenderbufferEXT = (PFNGLFRAMEBUFFERRENDERBUFFEREXTPROC) r3GetProcAddress( "glFramebufferRenderbufferEXT" );
-        glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC) r3GetProcAddress( "glFramebufferTexture" );
-        glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC) r3GetProcAddress( "glFramebufferTexture1D" );
-        glFramebufferTexture1DEXT = (PFNGLFRAMEBUFFERTEXTURE1DEXTPROC) r3GetProcAddress( "glFramebufferTexture1DEXT" );
-        glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC) r3GetProcAddress( "glFramebufferTexture2D" );
-        glFramebufferTexture2DEXT = (PFNGLFRAMEBUFFERTEXTURE2DEXTPROC) r3GetProcAddress( "glFramebufferTexture2DEXT" );
-        glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC) r3GetProcAddress( "glFramebufferTexture3D" );
-        glFramebufferTexture3DEXT = (PFNGLFRAMEBUFFERTEXTURE3DEXTPROC) r3GetProcAddress( "glFramebufferTexture3DEXT" );
-        glFramebufferTextureARB = (PFNGLFRAMEBUFFERTEXTUREARBPROC) r3GetProcAddress( "glFramebufferTextureARB" );
-        glFramebufferTextureEXT = (PFNGLFRAMEBUFFERTEXTUREEXTPROC) r3GetProcAddress( "glFramebufferTextureEXT" );
-        glFramebufferTextureFaceARB = (PFNGLFRAMEBUFFERTEXTUREFACEARBPROC) r3GetProcAddress( "glFramebufferTextureFaceARB" );
-        glFramebufferTextureFaceEXT = (PFNGLFRAMEBUFFERTEXTUREFACEEXTPROC) r3GetProcAddress( "glFramebufferTextureFaceEXT" );
-        glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC) r3GetProcAddress( "glFramebufferTextureLayer" );
-        glFramebufferTextureLayerARB = (PFNGLFRAMEBUFFERTEXTURELAYERARBPROC) r3GetProcAddress( "glFramebufferTextureLayerARB" );
-        glFramebufferTextureLayerEXT = (PFNGLFRAMEBUFFERTEXTURELAYEREXTPROC) r3GetProcAddress( "glFramebufferTextureLayerEXT" );
-        glFreeObjectBufferATI = (PFNGLFREEOBJECTBUFFERATIPROC) r3GetProcAddress( "glFreeObjectBufferATI" );
-        glGenAsyncMarkersSGIX = (PFNGLGENASYNCMARKERSSGIXPROC) r3GetProcAddress( "glGenAsyncMarkersSGIX" );
-        glGenBuffers = (PFNGLGENBUFFERSPROC) r3GetProcAddress( "glGenBuffers" );
-        glGenBuffersARB = (PFNGLGENBUFFERSARBPROC) r3GetProcAddress( "glGenBuffersARB" );
-        glGenFencesAPPLE = (PFNGLGENFENCESAPPLEPROC) r3GetProcAddress( "glGenFencesAPPLE" );
-        glGenFencesNV = (PFNGLGENFENCESNVPROC) r3GetProcAddress( "glGenFencesNV" );
-        glGenFragmentShadersATI = (PFNGLGENFRAGMENTSHADERSATIPROC) r3GetProcAddress( "glGenFragmentShadersATI" );
-        glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC) r3GetProcAddress( "glGenFramebuffers" );
-        glGenFramebuffersEXT = (PFNGLGENFRAMEBUFFERSEXTPROC) r3GetProcAddress( "glGenFramebuffersEXT" );
-        glGenOcclusionQueriesNV = (PFNGLGENOCCLUSIONQUERIESNVPROC) r3GetProcAddress( "glGenOcclusionQueriesNV" );
-        glGenPerfMonitorsAMD = (PFNGLGENPERFMONITORSAMDPROC) r3GetProcAddress( "glGenPerfMonitorsAMD" );
-        glGenProgramsARB = (PFNGLGENPROGRAMSARBPROC) r3GetProcAddress( "glGenProgramsARB" );
-        glGenProgramsNV = (PFNGLGENPROGRAMSNVPROC) r3GetProcAddress( "glGenProgramsNV" );
-        glGenQueries = (PFNGLGENQUERIESPROC) r3GetProcAddress( "glGenQueries" );
-        glGenQueriesARB = (PFNGLGENQUERIESARBPROC) r3GetProcAddress( "glGenQueriesARB" );
-        glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC) r3GetProcAddress( "glGenRenderbuffers" );
-        glGenRenderbuffersEXT = (PFNGLGENRENDERBUFFERSEXTPROC) r3GetProcAddress( "glGenRenderbuffersEXT" );
-        glGenSamplers = (PFNGLGENSAMPLERSPROC) r3GetProcAddress( "glGenSamplers" );
-        glGenSymbolsEXT = (PFNGLGENSYMBOLSEXTPROC) r3GetProcAddress( "glGenSymbolsEXT" );
-        glGenTexturesEXT = (PFNGLGENTEXTURESEXTPROC) r3GetProcAddress( "glGenTexturesEXT" );
-        glGenTransformFeedbacks = (PFNGLGENTRANSFORMFEEDBACKSPROC) r3GetProcAddress( "glGenTransformFeedbacks" );
-        glGenTransformFeedbacksNV = (PFNGLGENTRANSFORMFEEDBACKSNVPROC) r3GetProcAddress( "glGenTransformFeedbacksNV" );
-        glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC) r3GetProcAddress( "glGenVertexArrays" );
-        glGenVertexArraysAPPLE = (PFNGLGENVERTEXARRAYSAPPLEPROC) r3GetProcAddress( "glGenVertexArraysAPPLE" );
-        glGenVertexShadersEXT = (PFNGLGENVERTEXSHADERSEXTPROC) r3GetProcAddress( "glGenVertexShadersEXT" );
-        glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC) r3GetProcAddress( "glGenerateMipmap" );
-        glGenerateMipmapEXT = (PFNGLGENERATEMIPMAPEXTPROC) r3GetProcAddress( "glGenerateMipmapEXT" );
-        glGenerateMultiTexMipmapEXT = (PFNGLGENERATEMULTITEXMIPMAPEXTPROC) r3GetProcAddress( "glGenerateMultiTexMipmapEXT" );
-        glGenerateTextureMipmapEXT = (PFNGLGENERATETEXTUREMIPMAPEXTPROC) r3GetProcAddress( "glGenerateTextureMipmapEXT" );
-        glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC) r3GetProcAddress( "glGetActiveAttrib" );
-        glGetActiveAttribARB = (PFNGLGETACTIVEATTRIBARBPROC) r3GetProcAddress( "glGetActiveAttribARB" );
-        glGetActiveSubroutineName = (PFNGLGETACTIVESUBROUTINENAMEPROC) r3GetProcAddress( "glGetActiveSubroutineName" );
-        glGetActiveSubroutineUniformName = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC) r3GetProcAddress( "glGetActiveSubroutineUniformName" );
-        glGetActiveSubroutineUniformiv = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC) r3GetProcAddress( "glGetActiveSubroutineUniformiv" );
-        glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC) r3GetProcAddress( "glGetActiveUniform" );
-        glGetActiveUniformARB = (PFNGLGETACTIVEUNIFORMARBPROC) r3GetProcAddress( "glGetActiveUniformARB" );
-        glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC) r3GetProcAddress( "glGetActiveUniformBlockName" );
-        glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC) r3GetProcAddress( "glGetActiveUniformBlockiv" );
-        glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC) r3GetProcAddress( "glGetActiveUniformName" );
-        glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC) r3GetProcAddress( "glGetActiveUniformsiv" );
-        glGetActiveVaryingNV = (PFNGLGETACTIVEVARYINGNVPROC) r3GetProcAddress( "glGetActiveVaryingNV" );
-        glGetArrayObjectfvATI = (PFNGLGETARRAYOBJECTFVATIPROC) r3GetProcAddress( "glGetArrayObjectfvATI" );
-        glGetArrayObjectivATI = (PFNGLGETARRAYOBJECTIVATIPROC) r3GetProcAddress( "glGetArrayObjectivATI" );
-        glGetAttachedObjectsARB = (PFNGLGETATTACHEDOBJECTSARBPROC) r3GetProcAddress( "glGetAttachedObjectsARB" );
-        glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC) r3GetProcAddress( "glGetAttachedShaders" );
-        glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC) r3GetProcAddress( "glGetAttribLocation" );
-        glGetAttribLocationARB = (PFNGLGETATTRIBLOCATIONARBPROC) r3GetProcAddress( "glGetAttribLocationARB" );
-        glGetBooleanIndexedvEXT = (PFNGLGETBOOLEANINDEXEDVEXTPROC) r3GetProcAddress( "glGetBooleanIndexedvEXT" );
-        glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC) r3GetProcAddress( "glGetBufferParameteri64v" );
-        glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC) r3GetProcAddress( "glGetBufferParameteriv" );
-        glGetBufferParameterivARB = (PFNGLGETBUFFERPARAMETERIVARBPROC) r3GetProcAddress( "glGetBufferParameterivARB" );
-        glGetBufferParameterui64vNV = (PFNGLGETBUFFERPARAMETERUI64VNVPROC) r3GetProcAddress( "glGetBufferParameterui64vNV" );
-        glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC) r3GetProcAddress( "glGetBufferPointerv" );
-        glGetBufferPointervARB = (PFNGLGETBUFFERPOINTERVARBPROC) r3GetProcAddress( "glGetBufferPointervARB" );
-        glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC) r3GetProcAddress( "glGetBufferSubData" );
-        glGetBufferSubDataARB = (PFNGLGETBUFFERSUBDATAARBPROC) r3GetProcAddress( "glGetBufferSubDataARB" );
-        glGetColorTable = (PFNGLGETCOLORTABLEPROC) r3GetProcAddress( "glGetColorTable" );
-        glGetColorTableEXT = (PFNGLGETCOLORTABLEEXTPROC) r3GetProcAddress( "glGetColorTableEXT" );
-        glGetColorTableParameterfv = (PFNGLGETCOLORTABLEPARAMETERFVPROC) r3GetProcAddress( "glGetColorTableParameterfv" );
-        glGetColorTableParameterfvEXT = (PFNGLGETCOLORTABLEPARAMETERFVEXTPROC) r3GetProcAddress( "glGetColorTableParameterfvEXT" );
-        glGetColorTableParameterfvSGI = (PFNGLGETCOLORTABLEPARAMETERFVSGIPROC) r3GetProcAddress( "glGetColorTableParameterfvSGI" );
-        glGetColorTableParameteriv = (PFNGLGETCOLORTABLEPARAMETERIVPROC) r3GetProcAddress( "glGetColorTableParameteriv" );
-        glGetColorTableParameterivEXT = (PFNGLGETCOLORTABLEPARAMETERIVEXTPROC) r3GetProcAddress( "glGetColorTableParameterivEXT" );
-        glGetColorTableParameterivSGI = (PFNGLGETCOLORTABLEPARAMETERIVSGIPROC) r3GetProcAddress( "glGetColorTableParameterivSGI" );
-        glGetColorTableSGI = (PFNGLGETCOLORTABLESGIPROC) r3GetProcAddress( "glGetColorTableSGI" );
-        glGetCombinerInputParameterfvNV = (PFNGLGETCOMBINERINPUTPARAMETERFVNVPROC) r3GetProcAddress( "glGetCombinerInputParameterfvNV" );
-        glGetCombinerInputParameterivNV = (PFNGLGETCOMBINERINPUTPARAMETERIVNVPROC) r3GetProcAddress( "glGetCombinerInputParameterivNV" );
-        glGetCombinerOutputParameterfvNV = (PFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC) r3GetProcAddress( "glGetCombinerOutputParameterfvNV" );
-        glGetCombinerOutputParameterivNV = (PFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC) r3GetProcAddress( "glGetCombinerOutputParameterivNV" );
-        glGetCombinerStageParameterfvNV = (PFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC) r3GetProcAddress( "glGetCombinerStageParameterfvNV" );
-        glGetCompressedMultiTexImageEXT = (PFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC) r3GetProcAddress( "glGetCompressedMultiTexImageEXT" );
-        glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC) r3GetProcAddress( "glGetCompressedTexImage" );
-        glGetCompressedTexImageARB = (PFNGLGETCOMPRESSEDTEXIMAGEARBPROC) r3GetProcAddress( "glGetCompressedTexImageARB" );
-        glGetCompressedTextureImageEXT = (PFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC) r3GetProcAddress( "glGetCompressedTextureImageEXT" );
-        glGetConvolutionFilter = (PFNGLGETCONVOLUTIONFILTERPROC) r3GetProcAddress( "glGetConvolutionFilter" );
-        glGetConvolutionFilterEXT = (PFNGLGETCONVOLUTIONFILTEREXTPROC) r3GetProcAddress( "glGetConvolutionFilterEXT" );
-        glGetConvolutionParameterfv = (PFNGLGETCONVOLUTIONPARAMETERFVPROC) r3GetProcAddress( "glGetConvolutionParameterfv" );
-        glGetConvolutionParameterfvEXT = (PFNGLGETCONVOLUTIONPARAMETERFVEXTPROC) r3GetProcAddress( "glGetConvolutionParameterfvEXT" );
-        glGetConvolutionParameteriv = (PFNGLGETCONVOLUTIONPARAMETERIVPROC) r3GetProcAddress( "glGetConvolutionParameteriv" );
-        glGetConvolutionParameterivEXT = (PFNGLGETCONVOLUTIONPARAMETERIVEXTPROC) r3GetProcAddress( "glGetConvolutionParameterivEXT" );
-        glGetDetailTexFuncSGIS = (PFNGLGETDETAILTEXFUNCSGISPROC) r3GetProcAddress( "glGetDetailTexFuncSGIS" );
-        glGetDoubleIndexedvEXT = (PFNGLGETDOUBLEINDEXEDVEXTPROC) r3GetProcAddress( "glGetDoubleIndexedvEXT" );
-        glGetFenceivNV = (PFNGLGETFENCEIVNVPROC) r3GetProcAddress( "glGetFenceivNV" );
-        glGetFinalCombinerInputParameterfvNV = (PFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC) r3GetProcAddress( "glGetFinalCombinerInputParameterfvNV" );
-        glGetFinalCombinerInputParameterivNV = (PFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC) r3GetProcAddress( "glGetFinalCombinerInputParameterivNV" );
-        glGetFloatIndexedvEXT = (PFNGLGETFLOATINDEXEDVEXTPROC) r3GetProcAddress( "glGetFloatIndexedvEXT" );
-        glGetFogFuncSGIS = (PFNGLGETFOGFUNCSGISPROC) r3GetProcAddress( "glGetFogFuncSGIS" );
-        glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC) r3GetProcAddress( "glGetFragDataIndex" );
-        glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC) r3GetProcAddress( "glGetFragDataLocation" );
-        glGetFragDataLocationEXT = (PFNGLGETFRAGDATALOCATIONEXTPROC) r3GetProcAddress( "glGetFragDataLocationEXT" );
-        glGetFragmentLightfvSGIX = (PFNGLGETFRAGMENTLIGHTFVSGIXPROC) r3GetProcAddress( "glGetFragmentLightfvSGIX" );
-        glGetFragmentLightivSGIX = (PFNGLGETFRAGMENTLIGHTIVSGIXPROC) r3GetProcAddress( "glGetFragmentLightivSGIX" );
-        glGetFragmentMaterialfvSGIX = (PFNGLGETFRAGMENTMATERIALFVSGIXPROC) r3GetProcAddress( "glGetFragmentMaterialfvSGIX" );
-        glGetFragmentMaterialivSGIX = (PFNGLGETFRAGMENTMATERIALIVSGIXPROC) r3GetProcAddress( "glGetFragmentMaterialivSGIX" );
-        glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC) r3GetProcAddress( "glGetFramebufferAttachmentParameteriv" );
-        glGetFramebufferAttachmentParameterivEXT = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC) r3GetProcAddress( "glGetFramebufferAttachmentParameterivEXT" );
-        glGetFramebufferParameterivEXT = (PFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC) r3GetProcAddress( "glGetFramebufferParameterivEXT" );
-        glGetHandleARB = (PFNGLGETHANDLEARBPROC) r3GetProcAddress( "glGetHandleARB" );
-        glGetHistogram = (PFNGLGETHISTOGRAMPROC) r3GetProcAddress( "glGetHistogram" );
-        glGetHistogramEXT = (PFNGLGETHISTOGRAMEXTPROC) r3GetProcAddress( "glGetHistogramEXT" );
-        glGetHistogramParameterfv = (PFNGLGETHISTOGRAMPARAMETERFVPROC) r3GetProcAddress( "glGetHistogramParameterfv" );
-        glGetHistogramParameterfvEXT = (PFNGLGETHISTOGRAMPARAMETERFVEXTPROC) r3GetProcAddress( "glGetHistogramParameterfvEXT" );
-        glGetHistogramParameteriv = (PFNGLGETHISTOGRAMPARAMETERIVPROC) r3GetProcAddress( "glGetHistogramParameteriv" );
-        glGetHistogramParameterivEXT = (PFNGLGETHISTOGRAMPARAMETERIVEXTPROC) r3GetProcAddress( "glGetHistogramParameterivEXT" );
-        glGetImageTransformParameterfvHP = (PFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC) r3GetProcAddress( "glGetImageTransformParameterfvHP" );
-        glGetImageTransformParameterivHP = (PFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC) r3GetProcAddress( "glGetImageTransformParameterivHP" );
-        glGetInfoLogARB = (PFNGLGETINFOLOGARBPROC) r3GetProcAddress( "glGetInfoLogARB" );
-        glGetInstrumentsSGIX = (PFNGLGETINSTRUMENTSSGIXPROC) r3GetProcAddress( "glGetInstrumentsSGIX" );
-        glGetInteger64v = (PFNGLGETINTEGER64VPROC) r3GetProcAddress( "glGetInteger64v" );
-        glGetIntegerIndexedvEXT = (PFNGLGETINTEGERINDEXEDVEXTPROC) r3GetProcAddress( "glGetIntegerIndexedvEXT" );
-        glGetIntegerui64vNV = (PFNGLGETINTEGERUI64VNVPROC) r3GetProcAddress( "glGetIntegerui64vNV" );
-        glGetInvariantBooleanvEXT = (PFNGLGETINVARIANTBOOLEANVEXTPROC) r3GetProcAddress( "glGetInvariantBooleanvEXT" );
-        glGetInvariantFloatvEXT = (PFNGLGETINVARIANTFLOATVEXTPROC) r3GetProcAddress( "glGetInvariantFloatvEXT" );
-        glGetInvariantIntegervEXT = (PFNGLGETINVARIANTINTEGERVEXTPROC) r3GetProcAddress( "glGetInvariantIntegervEXT" );
-        glGetListParameterfvSGIX = (PFNGLGETLISTPARAMETERFVSGIXPROC) r3GetProcAddress( "glGetListParameterfvSGIX" );
-        glGetListParameterivSGIX = (PFNGLGETLISTPARAMETERIVSGIXPROC) r3GetProcAddress( "glGetListParameterivSGIX" );
-        glGetLocalConstantBooleanvEXT = (PFNGLGETLOCALCONSTANTBOOLEANVEXTPROC) r3GetProcAddress( "glGetLocalConstantBooleanvEXT" );
-        glGetLocalConstantFloatvEXT = (PFNGLGETLOCALCONSTANTFLOATVEXTPROC) r3GetProcAddress( "glGetLocalConstantFloatvEXT" );
-        glGetLocalConstantIntegervEXT = (PFNGLGETLOCALCONSTANTINTEGERVEXTPROC) r3GetProcAddress( "glGetLocalConstantIntegervEXT" );
-        glGetMapAttribParameterfvNV = (PFNGLGETMAPATTRIBPARAMETERFVNVPROC) r3GetProcAddress( "glGetMapAttribParameterfvNV" );
-        glGetMapAttribParameterivNV = (PFNGLGETMAPATTRIBPARAMETERIVNVPROC) r3GetProcAddress( "glGetMapAttribParameterivNV" );
-        glGetMapControlPointsNV = (PFNGLGETMAPCONTROLPOINTSNVPROC) r3GetProcAddress( "glGetMapControlPointsNV" );
-        glGetMapParameterfvNV = (PFNGLGETMAPPARAMETERFVNVPROC) r3GetProcAddress( "glGetMapParameterfvNV" );
-        glGetMapParameterivNV = (PFNGLGETMAPPARAMETERIVNVPROC) r3GetProcAddress( "glGetMapParameterivNV" );
-        glGetMinmax = (PFNGLGETMINMAXPROC) r3GetProcAddress( "glGetMinmax" );
-        glGetMinmaxEXT = (PFNGLGETMINMAXEXTPROC) r3GetProcAddress( "glGetMinmaxEXT" );
-        glGetMinmaxParameterfv = (PFNGLGETMINMAXPARAMETERFVPROC) r3GetProcAddress( "glGetMinmaxParameterfv" );
-        glGetMinmaxParameterfvEXT = (PFNGLGETMINMAXPARAMETERFVEXTPROC) r3GetProcAddress( "glGetMinmaxParameterfvEXT" );
-        glGetMinmaxParameteriv = (PFNGLGETMINMAXPARAMETERIVPROC) r3GetProcAddress( "glGetMinmaxParameteriv" );
-        glGetMinmaxParameterivEXT = (PFNGLGETMINMAXPARAMETERIVEXTPROC) r3GetProcAddress( "glGetMinmaxParameterivEXT" );
-        glGetMultiTexEnvfvEXT = (PFNGLGETMULTITEXENVFVEXTPROC) r3GetProcAddress( "glGetMultiTexEnvfvEXT" );
-        glGetMultiTexEnvivEXT = (PFNGLGETMULTITEXENVIVEXTPROC) r3GetProcAddress( "glGetMultiTexEnvivEXT" );
-        glGetMultiTexGendvEXT = (PFNGLGETMULTITEXGENDVEXTPROC) r3GetProcAddress( "glGetMultiTexGendvEXT" );
-        glGetMultiTexGenfvEXT = (PFNGLGETMULTITEXGENFVEXTPROC) r3GetProcAddress( "glGetMultiTexGenfvEXT" );
-        glGetMultiTexGenivEXT = (PFNGLGETMULTITEXGENIVEXTPROC) r3GetProcAddress( "glGetMultiTexGenivEXT" );
-        glGetMultiTexImageEXT = (PFNGLGETMULTITEXIMAGEEXTPROC) r3GetProcAddress( "glGetMultiTexImageEXT" );
-        glGetMultiTexLevelParameterfvEXT = (PFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC) r3GetProcAddress( "glGetMultiTexLevelParameterfvEXT" );
-        glGetMultiTexLevelParameterivEXT = (PFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC) r3GetProcAddress( "glGetMultiTexLevelParameterivEXT" );
-        glGetMultiTexParameterIivEXT = (PFNGLGETMULTITEXPARAMETERIIVEXTPROC) r3GetProcAddress( "glGetMultiTexParameterIivEXT" );
-        glGetMultiTexParameterIuivEXT = (PFNGLGETMULTITEXPARAMETERIUIVEXTPROC) r3GetProcAddress( "glGetMultiTexParameterIuivEXT" );
-        glGetMultiTexParameterfvEXT = (PFNGLGETMULTITEXPARAMETERFVEXTPROC) r3GetProcAddress( "glGetMultiTexParameterfvEXT" );
-        glGetMultiTexParameterivEXT = (PFNGLGETMULTITEXPARAMETERIVEXTPROC) r3GetProcAddress( "glGetMultiTexParameterivEXT" );
-        glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC) r3GetProcAddress( "glGetMultisamplefv" );
-        glGetMultisamplefvNV = (PFNGLGETMULTISAMPLEFVNVPROC) r3GetProcAddress( "glGetMultisamplefvNV" );
-        glGetNamedBufferParameterivEXT = (PFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC) r3GetProcAddress( "glGetNamedBufferParameterivEXT" );
-        glGetNamedBufferParameterui64vNV = (PFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC) r3GetProcAddress( "glGetNamedBufferParameterui64vNV" );
-        glGetNamedBufferPointervEXT = (PFNGLGETNAMEDBUFFERPOINTERVEXTPROC) r3GetProcAddress( "glGetNamedBufferPointervEXT" );
-        glGetNamedBufferSubDataEXT = (PFNGLGETNAMEDBUFFERSUBDATAEXTPROC) r3GetProcAddress( "glGetNamedBufferSubDataEXT" );
-        glGetNamedFramebufferAttachmentParameterivEXT = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC) r3GetProcAddress( "glGetNamedFramebufferAttachmentParameterivEXT" );
-        glGetNamedProgramLocalParameterIivEXT = (PFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC) r3GetProcAddress( "glGetNamedProgramLocalParameterIivEXT" );
-        glGetNamedProgramLocalParameterIuivEXT = (PFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC) r3GetProcAddress( "glGetNamedProgramLocalParameterIuivEXT" );
-        glGetNamedProgramLocalParameterdvEXT = (PFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC) r3GetProcAddress( "glGetNamedProgramLocalParameterdvEXT" );
-        glGetNamedProgramLocalParameterfvEXT = (PFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC) r3GetProcAddress( "glGetNamedProgramLocalParameterfvEXT" );
-        glGetNamedProgramStringEXT = (PFNGLGETNAMEDPROGRAMSTRINGEXTPROC) r3GetProcAddress( "glGetNamedProgramStringEXT" );
-        glGetNamedProgramivEXT = (PFNGLGETNAMEDPROGRAMIVEXTPROC) r3GetProcAddress( "glGetNamedProgramivEXT" );
-        glGetNamedRenderbufferParameterivEXT = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC) r3GetProcAddress( "glGetNamedRenderbufferParameterivEXT" );
-        glGetNamedStringARB = (PFNGLGETNAMEDSTRINGARBPROC) r3GetProcAddress( "glGetNamedStringARB" );
-        glGetNamedStringivARB = (PFNGLGETNAMEDSTRINGIVARBPROC) r3GetProcAddress( "glGetNamedStringivARB" );
-        glGetObjectBufferfvATI = (PFNGLGETOBJECTBUFFERFVATIPROC) r3GetProcAddress( "glGetObjectBufferfvATI" );
-        glGetObjectBufferivATI = (PFNGLGETOBJECTBUFFERIVATIPROC) r3GetProcAddress( "glGetObjectBufferivATI" );
-        glGetObjectParameterfvARB = (PFNGLGETOBJECTPARAMETERFVARBPROC) r3GetProcAddress( "glGetObjectParameterfvARB" );
-        glGetObjectParameterivAPPLE = (PFNGLGETOBJECTPARAMETERIVAPPLEPROC) r3GetProcAddress( "glGetObjectParameterivAPPLE" );
-        glGetObjectParameterivARB = (PFNGLGETOBJECTPARAMETERIVARBPROC) r3GetProcAddress( "glGetObjectParameterivARB" );
-        glGetOcclusionQueryivNV = (PFNGLGETOCCLUSIONQUERYIVNVPROC) r3GetProcAddress( "glGetOcclusionQueryivNV" );
-        glGetOcclusionQueryuivNV = (PFNGLGETOCCLUSIONQUERYUIVNVPROC) r3GetProcAddress( "glGetOcclusionQueryuivNV" );
-        glGetPerfMonitorCounterDataAMD = (PFNGLGETPERFMONITORCOUNTERDATAAMDPROC) r3GetProcAddress( "glGetPerfMonitorCounterDataAMD" );
-        glGetPerfMonitorCounterInfoAMD = (PFNGLGETPERFMONITORCOUNTERINFOAMDPROC) r3GetProcAddress( "glGetPerfMonitorCounterInfoAMD" );
-        glGetPerfMonitorCounterStringAMD = (PFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC) r3GetProcAddress( "glGetPerfMonitorCounterStringAMD" );
-        glGetPerfMonitorCountersAMD = (PFNGLGETPERFMONITORCOUNTERSAMDPROC) r3GetProcAddress( "glGetPerfMonitorCountersAMD" );
-        glGetPerfMonitorGroupStringAMD = (PFNGLGETPERFMONITORGROUPSTRINGAMDPROC) r3GetProcAddress( "glGetPerfMonitorGroupStringAMD" );
-        glGetPerfMonitorGroupsAMD = (PFNGLGETPERFMONITORGROUPSAMDPROC) r3GetProcAddress( "glGetPerfMonitorGroupsAMD" );
-        glGetPixelTexGenParameterfvSGIS = (PFNGLGETPIXELTEXGENPARAMETERFVSGISPROC) r3GetProcAddress( "glGetPixelTexGenParameterfvSGIS" );
-        glGetPixelTexGenParameterivSGIS = (PFNGLGETPIXELTEXGENPARAMETERIVSGISPROC) r3GetProcAddress( "glGetPixelTexGenParameterivSGIS" );
-        glGetPointerIndexedvEXT = (PFNGLGETPOINTERINDEXEDVEXTPROC) r3GetProcAddress( "glGetPointerIndexedvEXT" );
-        glGetPointervEXT = (PFNGLGETPOINTERVEXTPROC) r3GetProcAddress( "glGetPointervEXT" );
-        glGetProgramEnvParameterIivNV = (PFNGLGETPROGRAMENVPARAMETERIIVNVPROC) r3GetProcAddress( "glGetProgramEnvParameterIivNV" );
-        glGetProgramEnvParameterIuivNV = (PFNGLGETPROGRAMENVPARAMETERIUIVNVPROC) r3GetProcAddress( "glGetProgramEnvParameterIuivNV" );
-        glGetProgramEnvParameterdvARB = (PFNGLGETPROGRAMENVPARAMETERDVARBPROC) r3GetProcAddress( "glGetProgramEnvParameterdvARB" );
-        glGetProgramEnvParameterfvARB = (PFNGLGETPROGRAMENVPARAMETERFVARBPROC) r3GetProcAddress( "glGetProgramEnvParameterfvARB" );
-        glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC) r3GetProcAddress( "glGetProgramInfoLog" );
-        glGetProgramLocalParameterIivNV = (PFNGLGETPROGRAMLOCALPARAMETERIIVNVPROC) r3GetProcAddress( "glGetProgramLocalParameterIivNV" );
-        glGetProgramLocalParameterIuivNV = (PFNGLGETPROGRAMLOCALPARAMETERIUIVNVPROC) r3GetProcAddress( "glGetProgramLocalParameterIuivNV" );
-        glGetProgramLocalParameterdvARB = (PFNGLGETPROGRAMLOCALPARAMETERDVARBPROC) r3GetProcAddress( "glGetProgramLocalParameterdvARB" );
-        glGetProgramLocalParameterfvARB = (PFNGLGETPROGRAMLOCALPARAMETERFVARBPROC) r3GetProcAddress( "glGetProgramLocalParameterfvARB" );
-        glGetProgramNamedParameterdvNV = (PFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC) r3GetProcAddress( "glGetProgramNamedParameterdvNV" );
-        glGetProgramNamedParameterfvNV = (PFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC) r3GetProcAddress( "glGetProgramNamedParameterfvNV" );
-        glGetProgramParameterdvNV = (PFNGLGETPROGRAMPARAMETERDVNVPROC) r3GetProcAddress( "glGetProgramParameterdvNV" );
-        glGetProgramParameterfvNV = (PFNGLGETPROGRAMPARAMETERFVNVPROC) r3GetProcAddress( "glGetProgramParameterfvNV" );
-        glGetProgramStageiv = (PFNGLGETPROGRAMSTAGEIVPROC) r3GetProcAddress( "glGetProgramStageiv" );
-        glGetProgramStringARB = (PFNGLGETPROGRAMSTRINGARBPROC) r3GetProcAddress( "glGetProgramStringARB" );
-        glGetProgramStringNV = (PFNGLGETPROGRAMSTRINGNVPROC) r3GetProcAddress( "glGetProgramStringNV" );
-        glGetProgramiv = (PFNGLGETPROGRAMIVPROC) r3GetProcAddress( "glGetProgramiv" );
-        glGetProgramivARB = (PFNGLGETPROGRAMIVARBPROC) r3GetProcAddress( "glGetProgramivARB" );
-        glGetProgramivNV = (PFNGLGETPROGRAMIVNVPROC) r3GetProcAddress( "glGetProgramivNV" );
-        glGetQueryIndexediv = (PFNGLGETQUERYINDEXEDIVPROC) r3GetProcAddress( "glGetQueryIndexediv" );
-        glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC) r3GetProcAddress( "glGetQueryObjecti64v" );
-        glGetQueryObjecti64vEXT = (PFNGLGETQUERYOBJECTI64VEXTPROC) r3GetProcAddress( "glGetQueryObjecti64vEXT" );
-        glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC) r3GetProcAddress( "glGetQueryObjectiv" );
-        glGetQueryObjectivARB = (PFNGLGETQUERYOBJECTIVARBPROC) r3GetProcAddress( "glGetQueryObjectivARB" );
-        glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC) r3GetProcAddress( "glGetQueryObjectui64v" );
-        glGetQueryObjectui64vEXT = (PFNGLGETQUERYOBJECTUI64VEXTPROC) r3GetProcAddress( "glGetQueryObjectui64vEXT" );
-        glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC) r3GetProcAddress( "glGetQueryObjectuiv" );
-        glGetQueryObjectuivARB = (PFNGLGETQUERYOBJECTUIVARBPROC) r3GetProcAddress( "glGetQueryObjectuivARB" );
-        glGetQueryiv = (PFNGLGETQUERYIVPROC) r3GetProcAddress( "glGetQueryiv" );
-        glGetQueryivARB = (PFNGLGETQUERYIVARBPROC) r3GetProcAddress( "glGetQueryivARB" );
-        glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC) r3GetProcAddress( "glGetRenderbufferParameteriv" );
-        glGetRenderbufferParameterivEXT = (PFNGLGETRENDERBUFFERPARAMETERIVEXTPROC) r3GetProcAddress( "glGetRenderbufferParameterivEXT" );
-        glGetSamplerParameterIfv = (PFNGLGETSAMPLERPARAMETERIFVPROC) r3GetProcAddress( "glGetSamplerParameterIfv" );
-        glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC) r3GetProcAddress( "glGetSamplerParameterIiv" );
-        glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC) r3GetProcAddress( "glGetSamplerParameterfv" );
-        glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC) r3GetProcAddress( "glGetSamplerParameteriv" );
-        glGetSeparableFilter = (PFNGLGETSEPARABLEFILTERPROC) r3GetProcAddress( "glGetSeparableFilter" );
-        glGetSeparableFilterEXT = (PFNGLGETSEPARABLEFILTEREXTPROC) r3GetProcAddress( "glGetSeparableFilterEXT" );
-        glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC) r3GetProcAddress( "glGetShaderInfoLog" );
-        glGetShaderSource = (PFNGLGETSHADERSOURCEPROC) r3GetProcAddress( "glGetShaderSource" );
-        glGetShaderSourceARB = (PFNGLGETSHADERSOURCEARBPROC) r3GetProcAddress( "glGetShaderSourceARB" );
-        glGetShaderiv = (PFNGLGETSHADERIVPROC) r3GetProcAddress( "glGetShaderiv" );
-        glGetSharpenTexFuncSGIS = (PFNGLGETSHARPENTEXFUNCSGISPROC) r3GetProcAddress( "glGetSharpenTexFuncSGIS" );
-        glGetStringi = (PFNGLGETSTRINGIPROC) r3GetProcAddress( "glGetStringi" );
-        glGetSubroutineIndex = (PFNGLGETSUBROUTINEINDEXPROC) r3GetProcAddress( "glGetSubroutineIndex" );
-        glGetSubroutineUniformLocation = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC) r3GetProcAddress( "glGetSubroutineUniformLocation" );
-        glGetSynciv = (PFNGLGETSYNCIVPROC) r3GetProcAddress( "glGetSynciv" );
-        glGetTexBumpParameterfvATI = (PFNGLGETTEXBUMPPARAMETERFVATIPROC) r3GetProcAddress( "glGetTexBumpParameterfvATI" );
-        glGetTexBumpParameterivATI = (PFNGLGETTEXBUMPPARAMETERIVATIPROC) r3GetProcAddress( "glGetTexBumpParameterivATI" );
-        glGetTexFilterFuncSGIS = (PFNGLGETTEXFILTERFUNCSGISPROC) r3GetProcAddress( "glGetTexFilterFuncSGIS" );
-        glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC) r3GetProcAddress( "glGetTexParameterIiv" );
-        glGetTexParameterIivEXT = (PFNGLGETTEXPARAMETERIIVEXTPROC) r3GetProcAddress( "glGetTexParameterIivEXT" );
-        glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC) r3GetProcAddress( "glGetTexParameterIuiv" );
-        glGetTexParameterIuivEXT = (PFNGLGETTEXPARAMETERIUIVEXTPROC) r3GetProcAddress( "glGetTexParameterIuivEXT" );
-        glGetTexParameterPointervAPPLE = (PFNGLGETTEXPARAMETERPOINTERVAPPLEPROC) r3GetProcAddress( "glGetTexParameterPointervAPPLE" );
-        glGetTextureImageEXT = (PFNGLGETTEXTUREIMAGEEXTPROC) r3GetProcAddress( "glGetTextureImageEXT" );
-        glGetTextureLevelParameterfvEXT = (PFNGLGETTEXTURELEVELPARAMETERFVEXTPROC) r3GetProcAddress( "glGetTextureLevelParameterfvEXT" );
-        glGetTextureLevelParameterivEXT = (PFNGLGETTEXTURELEVELPARAMETERIVEXTPROC) r3GetProcAddress( "glGetTextureLevelParameterivEXT" );
-        glGetTextureParameterIivEXT = (PFNGLGETTEXTUREPARAMETERIIVEXTPROC) r3GetProcAddress( "glGetTextureParameterIivEXT" );
-        glGetTextureParameterIuivEXT = (PFNGLGETTEXTUREPARAMETERIUIVEXTPROC) r3GetProcAddress( "glGetTextureParameterIuivEXT" );
-        glGetTextureParameterfvEXT = (PFNGLGETTEXTUREPARAMETERFVEXTPROC) r3GetProcAddress( "glGetTextureParameterfvEXT" );
-        glGetTextureParameterivEXT = (PFNGLGETTEXTUREPARAMETERIVEXTPROC) r3GetProcAddress( "glGetTextureParameterivEXT" );
-        glGetTrackMatrixivNV = (PFNGLGETTRACKMATRIXIVNVPROC) r3GetProcAddress( "glGetTrackMatrixivNV" );
-        glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC) r3GetProcAddress( "glGetTransformFeedbackVarying" );
-        glGetTransformFeedbackVaryingEXT = (PFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC) r3GetProcAddress( "glGetTransformFeedbackVaryingEXT" );
-        glGetTransformFeedbackVaryingNV = (PFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC) r3GetProcAddress( "glGetTransformFeedbackVaryingNV" );
-        glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC) r3GetProcAddress( "glGetUniformBlockIndex" );
-        glGetUniformBufferSizeEXT = (PFNGLGETUNIFORMBUFFERSIZEEXTPROC) r3GetProcAddress( "glGetUniformBufferSizeEXT" );
-        glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC) r3GetProcAddress( "glGetUniformIndices" );
-        glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC) r3GetProcAddress( "glGetUniformLocation" );
-        glGetUniformLocationARB = (PFNGLGETUNIFORMLOCATIONARBPROC) r3GetProcAddress( "glGetUniformLocationARB" );
-        glGetUniformOffsetEXT = (PFNGLGETUNIFORMOFFSETEXTPROC) r3GetProcAddress( "glGetUniformOffsetEXT" );
-        glGetUniformSubroutineuiv = (PFNGLGETUNIFORMSUBROUTINEUIVPROC) r3GetProcAddress( "glGetUniformSubroutineuiv" );
-        glGetUniformdv = (PFNGLGETUNIFORMDVPROC) r3GetProcAddress( "glGetUniformdv" );
-        glGetUniformfv = (PFNGLGETUNIFORMFVPROC) r3GetProcAddress( "glGetUniformfv" );
-        glGetUniformfvARB = (PFNGLGETUNIFORMFVARBPROC) r3GetProcAddress( "glGetUniformfvARB" );
-        glGetUniformiv = (PFNGLGETUNIFORMIVPROC) r3GetProcAddress( "glGetUniformiv" );
-        glGetUniformivARB = (PFNGLGETUNIFORMIVARBPROC) r3GetProcAddress( "glGetUniformivARB" );
-        glGetUniformui64vNV = (PFNGLGETUNIFORMUI64VNVPROC) r3GetProcAddress( "glGetUniformui64vNV" );
-        glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC) r3GetProcAddress( "glGetUniformuiv" );
-        glGetUniformuivEXT = (PFNGLGETUNIFORMUIVEXTPROC) r3GetProcAddress( "glGetUniformuivEXT" );
-        glGetVariantArrayObjectfvATI = (PFNGLGETVARIANTARRAYOBJECTFVATIPROC) r3GetProcAddress( "glGetVariantArrayObjectfvATI" );
-        glGetVariantArrayObjectivATI = (PFNGLGETVARIANTARRAYOBJECTIVATIPROC) r3GetProcAddress( "glGetVariantArrayObjectivATI" );
-        glGetVariantBooleanvEXT = (PFNGLGETVARIANTBOOLEANVEXTPROC) r3GetProcAddress( "glGetVariantBooleanvEXT" );
-        glGetVariantFloatvEXT = (PFNGLGETVARIANTFLOATVEXTPROC) r3GetProcAddress( "glGetVariantFloatvEXT" );
-        glGetVariantIntegervEXT = (PFNGLGETVARIANTINTEGERVEXTPROC) r3GetProcAddress( "glGetVariantIntegervEXT" );
-        glGetVariantPointervEXT = (PFNGLGETVARIANTPOINTERVEXTPROC) r3GetProcAddress( "glGetVariantPointervEXT" );
-        glGetVaryingLocationNV = (PFNGLGETVARYINGLOCATIONNVPROC) r3GetProcAddress( "glGetVaryingLocationNV" );
-        glGetVertexAttribArrayObjectfvATI = (PFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC) r3GetProcAddress( "glGetVertexAttribArrayObjectfvATI" );
-        glGetVertexAttribArrayObjectivATI = (PFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC) r3GetProcAddress( "glGetVertexAttribArrayObjectivATI" );
-        glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC) r3GetProcAddress( "glGetVertexAttribIiv" );
-        glGetVertexAttribIivEXT = (PFNGLGETVERTEXATTRIBIIVEXTPROC) r3GetProcAddress( "glGetVertexAttribIivEXT" );
-        glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC) r3GetProcAddress( "glGetVertexAttribIuiv" );
-        glGetVertexAttribIuivEXT = (PFNGLGETVERTEXATTRIBIUIVEXTPROC) r3GetProcAddress( "glGetVertexAttribIuivEXT" );
-        glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC) r3GetProcAddress( "glGetVertexAttribPointerv" );
-        glGetVertexAttribPointervARB = (PFNGLGETVERTEXATTRIBPOINTERVARBPROC) r3GetProcAddress( "glGetVertexAttribPointervARB" );
-        glGetVertexAttribPointervNV = (PFNGLGETVERTEXATTRIBPOINTERVNVPROC) r3GetProcAddress( "glGetVertexAttribPointervNV" );
-        glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC) r3GetProcAddress( "glGetVertexAttribdv" );
-        glGetVertexAttribdvARB = (PFNGLGETVERTEXATTRIBDVARBPROC) r3GetProcAddress( "glGetVertexAttribdvARB" );
-        glGetVertexAttribdvNV = (PFNGLGETVERTEXATTRIBDVNVPROC) r3GetProcAddress( "glGetVertexAttribdvNV" );
-        glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC) r3GetProcAddress( "glGetVertexAttribfv" );
-        glGetVertexAttribfvARB = (PFNGLGETVERTEXATTRIBFVARBPROC) r3GetProcAddress( "glGetVertexAttribfvARB" );
-        glGetVertexAttribfvNV = (PFNGLGETVERTEXATTRIBFVNVPROC) r3GetProcAddress( "glGetVertexAttribfvNV" );
-        glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC) r3GetProcAddress( "glGetVertexAttribiv" );
-        glGetVertexAttribivARB = (PFNGLGETVERTEXATTRIBIVARBPROC) r3GetProcAddress( "glGetVertexAttribivARB" );
-        glGetVertexAttribivNV = (PFNGLGETVERTEXATTRIBIVNVPROC) r3GetProcAddress( "glGetVertexAttribivNV" );
-        glGetVideoCaptureStreamdvNV = (PFNGLGETVIDEOCAPTURESTREAMDVNVPROC) r3GetProcAddress( "glGetVideoCaptureStreamdvNV" );
-        glGetVideoCaptureStreamfvNV = (PFNGLGETVIDEOCAPTURESTREAMFVNVPROC) r3GetProcAddress( "glGetVideoCaptureStreamfvNV" );
-        glGetVideoCaptureStreamivNV = (PFNGLGETVIDEOCAPTURESTREAMIVNVPROC) r3GetProcAddress( "glGetVideoCaptureStreamivNV" );
-        glGetVideoCaptureivNV = (PFNGLGETVIDEOCAPTUREIVNVPROC) r3GetProcAddress( "glGetVideoCaptureivNV" );
-        glGetVideoi64vNV = (PFNGLGETVIDEOI64VNVPROC) r3GetProcAddress( "glGetVideoi64vNV" );
-        glGetVideoivNV = (PFNGLGETVIDEOIVNVPROC) r3GetProcAddress( "glGetVideoivNV" );
-        glGetVideoui64vNV = (PFNGLGETVIDEOUI64VNVPROC) r3GetProcAddress( "glGetVideoui64vNV" );
-        glGetVideouivNV = (PFNGLGETVIDEOUIVNVPROC) r3GetProcAddress( "glGetVideouivNV" );
-        glGlobalAlphaFactorbSUN = (PFNGLGLOBALALPHAFACTORBSUNPROC) r3GetProcAddress( "glGlobalAlphaFactorbSUN" );
-        glGlobalAlphaFactordSUN = (PFNGLGLOBALALPHAFACTORDSUNPROC) r3GetProcAddress( "glGlobalAlphaFactordSUN" );
-        glGlobalAlphaFactorfSUN = (PFNGLGLOBALALPHAFACTORFSUNPROC) r3GetProcAddress( "glGlobalAlphaFactorfSUN" );
-        glGlobalAlphaFactoriSUN = (PFNGLGLOBALALPHAFACTORISUNPROC) r3GetProcAddress( "glGlobalAlphaFactoriSUN" );
-        glGlobalAlphaFactorsSUN = (PFNGLGLOBALALPHAFACTORSSUNPROC) r3GetProcAddress( "glGlobalAlphaFactorsSUN" );
-        glGlobalAlphaFactorubSUN = (PFNGLGLOBALALPHAFACTORUBSUNPROC) r3GetProcAddress( "glGlobalAlphaFactorubSUN" );
-        glGlobalAlphaFactoruiSUN = (PFNGLGLOBALALPHAFACTORUISUNPROC) r3GetProcAddress( "glGlobalAlphaFactoruiSUN" );
-        glGlobalAlphaFactorusSUN = (PFNGLGLOBALALPHAFACTORUSSUNPROC) r3GetProcAddress( "glGlobalAlphaFactorusSUN" );
-        glHintPGI = (PFNGLHINTPGIPROC) r3GetProcAddress( "glHintPGI" );
-        glHistogram = (PFNGLHISTOGRAMPROC) r3GetProcAddress( "glHistogram" );
-        glHistogramEXT = (PFNGLHISTOGRAMEXTPROC) r3GetProcAddress( "glHistogramEXT" );
-        glIglooInterfaceSGIX = (PFNGLIGLOOINTERFACESGIXPROC) r3GetProcAddress( "glIglooInterfaceSGIX" );
-        glImageTransformParameterfHP = (PFNGLIMAGETRANSFORMPARAMETERFHPPROC) r3GetProcAddress( "glImageTransformParameterfHP" );
-        glImageTransformParameterfvHP = (PFNGLIMAGETRANSFORMPARAMETERFVHPPROC) r3GetProcAddress( "glImageTransformParameterfvHP" );
-        glImageTransformParameteriHP = (PFNGLIMAGETRANSFORMPARAMETERIHPPROC) r3GetProcAddress( "glImageTransformParameteriHP" );
-        glImageTransformParameterivHP = (PFNGLIMAGETRANSFORMPARAMETERIVHPPROC) r3GetProcAddress( "glImageTransformParameterivHP" );
-        glIndexFormatNV = (PFNGLINDEXFORMATNVPROC) r3GetProcAddress( "glIndexFormatNV" );
-        glIndexFuncEXT = (PFNGLINDEXFUNCEXTPROC) r3GetProcAddress( "glIndexFuncEXT" );
-        glIndexMaterialEXT = (PFNGLINDEXMATERIALEXTPROC) r3GetProcAddress( "glIndexMaterialEXT" );
-        glIndexPointerEXT = (PFNGLINDEXPOINTEREXTPROC) r3GetProcAddress( "glIndexPointerEXT" );
-        glIndexPointerListIBM = (PFNGLINDEXPOINTERLISTIBMPROC) r3GetProcAddress( "glIndexPointerListIBM" );
-        glInsertComponentEXT = (PFNGLINSERTCOMPONENTEXTPROC) r3GetProcAddress( "glInsertComponentEXT" );
-        glInstrumentsBufferSGIX = (PFNGLINSTRUMENTSBUFFERSGIXPROC) r3GetProcAddress( "glInstrumentsBufferSGIX" );
-        glIsAsyncMarkerSGIX = (PFNGLISASYNCMARKERSGIXPROC) r3GetProcAddress( "glIsAsyncMarkerSGIX" );
-        glIsBuffer = (PFNGLISBUFFERPROC) r3GetProcAddress( "glIsBuffer" );
-        glIsBufferARB = (PFNGLISBUFFERARBPROC) r3GetProcAddress( "glIsBufferARB" );
-        glIsBufferResidentNV = (PFNGLISBUFFERRESIDENTNVPROC) r3GetProcAddress( "glIsBufferResidentNV" );
-        glIsEnabledIndexedEXT = (PFNGLISENABLEDINDEXEDEXTPROC) r3GetProcAddress( "glIsEnabledIndexedEXT" );
-        glIsEnabledi = (PFNGLISENABLEDIPROC) r3GetProcAddress( "glIsEnabledi" );
-        glIsFenceAPPLE = (PFNGLISFENCEAPPLEPROC) r3GetProcAddress( "glIsFenceAPPLE" );
-        glIsFenceNV = (PFNGLISFENCENVPROC) r3GetProcAddress( "glIsFenceNV" );
-        glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC) r3GetProcAddress( "glIsFramebuffer" );
-        glIsFramebufferEXT = (PFNGLISFRAMEBUFFEREXTPROC) r3GetProcAddress( "glIsFramebufferEXT" );
-        glIsNamedBufferResidentNV = (PFNGLISNAMEDBUFFERRESIDENTNVPROC) r3GetProcAddress( "glIsNamedBufferResidentNV" );
-        glIsNamedStringARB = (PFNGLISNAMEDSTRINGARBPROC) r3GetProcAddress( "glIsNamedStringARB" );
-        glIsObjectBufferATI = (PFNGLISOBJECTBUFFERATIPROC) r3GetProcAddress( "glIsObjectBufferATI" );
-        glIsOcclusionQueryNV = (PFNGLISOCCLUSIONQUERYNVPROC) r3GetProcAddress( "glIsOcclusionQueryNV" );
-        glIsProgram = (PFNGLISPROGRAMPROC) r3GetProcAddress( "glIsProgram" );
-        glIsProgramARB = (PFNGLISPROGRAMARBPROC) r3GetProcAddress( "glIsProgramARB" );
-        glIsProgramNV = (PFNGLISPROGRAMNVPROC) r3GetProcAddress( "glIsProgramNV" );
-        glIsQuery = (PFNGLISQUERYPROC) r3GetProcAddress( "glIsQuery" );
-        glIsQueryARB = (PFNGLISQUERYARBPROC) r3GetProcAddress( "glIsQueryARB" );
-        glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC) r3GetProcAddress( "glIsRenderbuffer" );
-        glIsRenderbufferEXT = (PFNGLISRENDERBUFFEREXTPROC) r3GetProcAddress( "glIsRenderbufferEXT" );
-        glIsSampler = (PFNGLISSAMPLERPROC) r3GetProcAddress( "glIsSampler" );
-        glIsShader = (PFNGLISSHADERPROC) r3GetProcAddress( "glIsShader" );
-        glIsSync = (PFNGLISSYNCPROC) r3GetProcAddress( "glIsSync" );
-        glIsTextureEXT = (PFNGLISTEXTUREEXTPROC) r3GetProcAddress( "glIsTextureEXT" );
-        glIsTransformFeedback = (PFNGLISTRANSFORMFEEDBACKPROC) r3GetProcAddress( "glIsTransformFeedback" );
-        glIsTransformFeedbackNV = (PFNGLISTRANSFORMFEEDBACKNVPROC) r3GetProcAddress( "glIsTransformFeedbackNV" );
-        glIsVariantEnabledEXT = (PFNGLISVARIANTENABLEDEXTPROC) r3GetProcAddress( "glIsVariantEnabledEXT" );
-        glIsVertexArray = (PFNGLISVERTEXARRAYPROC) r3GetProcAddress( "glIsVertexArray" );
-        glIsVertexArrayAPPLE = (PFNGLISVERTEXARRAYAPPLEPROC) r3GetProcAddress( "glIsVertexArrayAPPLE" );
-        glIsVertexAttribEnabledAPPLE = (PFNGLISVERTEXATTRIBENABLEDAPPLEPROC) r3GetProcAddress( "glIsVertexAttribEnabledAPPLE" );
-        glLightEnviSGIX = (PFNGLLIGHTENVISGIXPROC) r3GetProcAddress( "glLightEnviSGIX" );
-        glLinkProgram = (PFNGLLINKPROGRAMPROC) r3GetProcAddress( "glLinkProgram" );
-        glLinkProgramARB = (PFNGLLINKPROGRAMARBPROC) r3GetProcAddress( "glLinkProgramARB" );
-        glListParameterfSGIX = (PFNGLLISTPARAMETERFSGIXPROC) r3GetProcAddress( "glListParameterfSGIX" );
-        glListParameterfvSGIX = (PFNGLLISTPARAMETERFVSGIXPROC) r3GetProcAddress( "glListParameterfvSGIX" );
-        glListParameteriSGIX = (PFNGLLISTPARAMETERISGIXPROC) r3GetProcAddress( "glListParameteriSGIX" );
-        glListParameterivSGIX = (PFNGLLISTPARAMETERIVSGIXPROC) r3GetProcAddress( "glListParameterivSGIX" );
-        glLoadIdentityDeformationMapSGIX = (PFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC) r3GetProcAddress( "glLoadIdentityDeformationMapSGIX" );
-        glLoadProgramNV = (PFNGLLOADPROGRAMNVPROC) r3GetProcAddress( "glLoadProgramNV" );
-        glLoadTransposeMatrixd = (PFNGLLOADTRANSPOSEMATRIXDPROC) r3GetProcAddress( "glLoadTransposeMatrixd" );
-        glLoadTransposeMatrixdARB = (PFNGLLOADTRANSPOSEMATRIXDARBPROC) r3GetProcAddress( "glLoadTransposeMatrixdARB" );
-        glLoadTransposeMatrixf = (PFNGLLOADTRANSPOSEMATRIXFPROC) r3GetProcAddress( "glLoadTransposeMatrixf" );
-        glLoadTransposeMatrixfARB = (PFNGLLOADTRANSPOSEMATRIXFARBPROC) r3GetProcAddress( "glLoadTransposeMatrixfARB" );
-        glLockArraysEXT = (PFNGLLOCKARRAYSEXTPROC) r3GetProcAddress( "glLockArraysEXT" );
-        glMakeBufferNonResidentNV = (PFNGLMAKEBUFFERNONRESIDENTNVPROC) r3GetProcAddress( "glMakeBufferNonResidentNV" );
-        glMakeBufferResidentNV = (PFNGLMAKEBUFFERRESIDENTNVPROC) r3GetProcAddress( "glMakeBufferResidentNV" );
-        glMakeNamedBufferNonResidentNV = (PFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC) r3GetProcAddress( "glMakeNamedBufferNonResidentNV" );
-        glMakeNamedBufferResidentNV = (PFNGLMAKENAMEDBUFFERRESIDENTNVPROC) r3GetProcAddress( "glMakeNamedBufferResidentNV" );
-        glMapBuffer = (PFNGLMAPBUFFERPROC) r3GetProcAddress( "glMapBuffer" );
-        glMapBufferARB = (PFNGLMAPBUFFERARBPROC) r3GetProcAddress( "glMapBufferARB" );
-        glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC) r3GetProcAddress( "glMapBufferRange" );
-        glMapControlPointsNV = (PFNGLMAPCONTROLPOINTSNVPROC) r3GetProcAddress( "glMapControlPointsNV" );
-        glMapNamedBufferEXT = (PFNGLMAPNAMEDBUFFEREXTPROC) r3GetProcAddress( "glMapNamedBufferEXT" );
-        glMapNamedBufferRangeEXT = (PFNGLMAPNAMEDBUFFERRANGEEXTPROC) r3GetProcAddress( "glMapNamedBufferRangeEXT" );
-        glMapObjectBufferATI = (PFNGLMAPOBJECTBUFFERATIPROC) r3GetProcAddress( "glMapObjectBufferATI" );
-        glMapParameterfvNV = (PFNGLMAPPARAMETERFVNVPROC) r3GetProcAddress( "glMapParameterfvNV" );
-        glMapParameterivNV = (PFNGLMAPPARAMETERIVNVPROC) r3GetProcAddress( "glMapParameterivNV" );
-        glMapVertexAttrib1dAPPLE = (PFNGLMAPVERTEXATTRIB1DAPPLEPROC) r3GetProcAddress( "glMapVertexAttrib1dAPPLE" );
-        glMapVertexAttrib1fAPPLE = (PFNGLMAPVERTEXATTRIB1FAPPLEPROC) r3GetProcAddress( "glMapVertexAttrib1fAPPLE" );
-        glMapVertexAttrib2dAPPLE = (PFNGLMAPVERTEXATTRIB2DAPPLEPROC) r3GetProcAddress( "glMapVertexAttrib2dAPPLE" );
-        glMapVertexAttrib2fAPPLE = (PFNGLMAPVERTEXATTRIB2FAPPLEPROC) r3GetProcAddress( "glMapVertexAttrib2fAPPLE" );
-        glMatrixFrustumEXT = (PFNGLMATRIXFRUSTUMEXTPROC) r3GetProcAddress( "glMatrixFrustumEXT" );
-        glMatrixIndexPointerARB = (PFNGLMATRIXINDEXPOINTERARBPROC) r3GetProcAddress( "glMatrixIndexPointerARB" );
-        glMatrixIndexubvARB = (PFNGLMATRIXINDEXUBVARBPROC) r3GetProcAddress( "glMatrixIndexubvARB" );
-        glMatrixIndexuivARB = (PFNGLMATRIXINDEXUIVARBPROC) r3GetProcAddress( "glMatrixIndexuivARB" );
-        glMatrixIndexusvARB = (PFNGLMATRIXINDEXUSVARBPROC) r3GetProcAddress( "glMatrixIndexusvARB" );
-        glMatrixLoadIdentityEXT = (PFNGLMATRIXLOADIDENTITYEXTPROC) r3GetProcAddress( "glMatrixLoadIdentityEXT" );
-        glMatrixLoadTransposedEXT = (PFNGLMATRIXLOADTRANSPOSEDEXTPROC) r3GetProcAddress( "glMatrixLoadTransposedEXT" );
-        glMatrixLoadTransposefEXT = (PFNGLMATRIXLOADTRANSPOSEFEXTPROC) r3GetProcAddress( "glMatrixLoadTransposefEXT" );
-        glMatrixLoaddEXT = (PFNGLMATRIXLOADDEXTPROC) r3GetProcAddress( "glMatrixLoaddEXT" );
-        glMatrixLoadfEXT = (PFNGLMATRIXLOADFEXTPROC) r3GetProcAddress( "glMatrixLoadfEXT" );
-        glMatrixMultTransposedEXT = (PFNGLMATRIXMULTTRANSPOSEDEXTPROC) r3GetProcAddress( "glMatrixMultTransposedEXT" );
-        glMatrixMultTransposefEXT = (PFNGLMATRIXMULTTRANSPOSEFEXTPROC) r3GetProcAddress( "glMatrixMultTransposefEXT" );
-        glMatrixMultdEXT = (PFNGLMATRIXMULTDEXTPROC) r3GetProcAddress( "glMatrixMultdEXT" );
-        glMatrixMultfEXT = (PFNGLMATRIXMULTFEXTPROC) r3GetProcAddress( "glMatrixMultfEXT" );
-        glMatrixOrthoEXT = (PFNGLMATRIXORTHOEXTPROC) r3GetProcAddress( "glMatrixOrthoEXT" );
-        glMatrixPopEXT = (PFNGLMATRIXPOPEXTPROC) r3GetProcAddress( "glMatrixPopEXT" );
-        glMatrixPushEXT = (PFNGLMATRIXPUSHEXTPROC) r3GetProcAddress( "glMatrixPushEXT" );
-        glMatrixRotatedEXT = (PFNGLMATRIXROTATEDEXTPROC) r3GetProcAddress( "glMatrixRotatedEXT" );
-        glMatrixRotatefEXT = (PFNGLMATRIXROTATEFEXTPROC) r3GetProcAddress( "glMatrixRotatefEXT" );
-        glMatrixScaledEXT = (PFNGLMATRIXSCALEDEXTPROC) r3GetProcAddress( "glMatrixScaledEXT" );
-        glMatrixScalefEXT = (PFNGLMATRIXSCALEFEXTPROC) r3GetProcAddress( "glMatrixScalefEXT" );
-        glMatrixTranslatedEXT = (PFNGLMATRIXTRANSLATEDEXTPROC) r3GetProcAddress( "glMatrixTranslatedEXT" );
-        glMatrixTranslatefEXT = (PFNGLMATRIXTRANSLATEFEXTPROC) r3GetProcAddress( "glMatrixTranslatefEXT" );
-        glMinSampleShading = (PFNGLMINSAMPLESHADINGPROC) r3GetProcAddress( "glMinSampleShading" );
-        glMinmax = (PFNGLMINMAXPROC) r3GetProcAddress( "glMinmax" );
-        glMinmaxEXT = (PFNGLMINMAXEXTPROC) r3GetProcAddress( "glMinmaxEXT" );
-        glMultTransposeMatrixd = (PFNGLMULTTRANSPOSEMATRIXDPROC) r3GetProcAddress( "glMultTransposeMatrixd" );
-        glMultTransposeMatrixdARB = (PFNGLMULTTRANSPOSEMATRIXDARBPROC) r3GetProcAddress( "glMultTransposeMatrixdARB" );
-        glMultTransposeMatrixf = (PFNGLMULTTRANSPOSEMATRIXFPROC) r3GetProcAddress( "glMultTransposeMatrixf" );
-        glMultTransposeMatrixfARB = (PFNGLMULTTRANSPOSEMATRIXFARBPROC) r3GetProcAddress( "glMultTransposeMatrixfARB" );
-        glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC) r3GetProcAddress( "glMultiDrawArrays" );
-        glMultiDrawArraysEXT = (PFNGLMULTIDRAWARRAYSEXTPROC) r3GetProcAddress( "glMultiDrawArraysEXT" );
-        glMultiDrawElementArrayAPPLE = (PFNGLMULTIDRAWELEMENTARRAYAPPLEPROC) r3GetProcAddress( "glMultiDrawElementArrayAPPLE" );
-        glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC) r3GetProcAddress( "glMultiDrawElements" );
-        glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC) r3GetProcAddress( "glMultiDrawElementsBaseVertex" );
-        glMultiDrawElementsEXT = (PFNGLMULTIDRAWELEMENTSEXTPROC) r3GetProcAddress( "glMultiDrawElementsEXT" );
-        glMultiDrawRangeElementArrayAPPLE = (PFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC) r3GetProcAddress( "glMultiDrawRangeElementArrayAPPLE" );
-        glMultiModeDrawArraysIBM = (PFNGLMULTIMODEDRAWARRAYSIBMPROC) r3GetProcAddress( "glMultiModeDrawArraysIBM" );
-        glMultiModeDrawElementsIBM = (PFNGLMULTIMODEDRAWELEMENTSIBMPROC) r3GetProcAddress( "glMultiModeDrawElementsIBM" );
-        glMultiTexBufferEXT = (PFNGLMULTITEXBUFFEREXTPROC) r3GetProcAddress( "glMultiTexBufferEXT" );
-        glMultiTexCoord1d = (PFNGLMULTITEXCOORD1DPROC) r3GetProcAddress( "glMultiTexCoord1d" );
-        glMultiTexCoord1dARB = (PFNGLMULTITEXCOORD1DARBPROC) r3GetProcAddress( "glMultiTexCoord1dARB" );
-        glMultiTexCoord1dv = (PFNGLMULTITEXCOORD1DVPROC) r3GetProcAddress( "glMultiTexCoord1dv" );
-        glMultiTexCoord1dvARB = (PFNGLMULTITEXCOORD1DVARBPROC) r3GetProcAddress( "glMultiTexCoord1dvARB" );
-        glMultiTexCoord1f = (PFNGLMULTITEXCOORD1FPROC) r3GetProcAddress( "glMultiTexCoord1f" );
-        glMultiTexCoord1fARB = (PFNGLMULTITEXCOORD1FARBPROC) r3GetProcAddress( "glMultiTexCoord1fARB" );
-        glMultiTexCoord1fv = (PFNGLMULTITEXCOORD1FVPROC) r3GetProcAddress( "glMultiTexCoord1fv" );
-        glMultiTexCoord1fvARB = (PFNGLMULTITEXCOORD1FVARBPROC) r3GetProcAddress( "glMultiTexCoord1fvARB" );
-        glMultiTexCoord1hNV = (PFNGLMULTITEXCOORD1HNVPROC) r3GetProcAddress( "glMultiTexCoord1hNV" );
-        glMultiTexCoord1hvNV = (PFNGLMULTITEXCOORD1HVNVPROC) r3GetProcAddress( "glMultiTexCoord1hvNV" );
-        glMultiTexCoord1i = (PFNGLMULTITEXCOORD1IPROC) r3GetProcAddress( "glMultiTexCoord1i" );
-        glMultiTexCoord1iARB = (PFNGLMULTITEXCOORD1IARBPROC) r3GetProcAddress( "glMultiTexCoord1iARB" );
-        glMultiTexCoord1iv = (PFNGLMULTITEXCOORD1IVPROC) r3GetProcAddress( "glMultiTexCoord1iv" );
-        glMultiTexCoord1ivARB = (PFNGLMULTITEXCOORD1IVARBPROC) r3GetProcAddress( "glMultiTexCoord1ivARB" );
-        glMultiTexCoord1s = (PFNGLMULTITEXCOORD1SPROC) r3GetProcAddress( "glMultiTexCoord1s" );
-        glMultiTexCoord1sARB = (PFNGLMULTITEXCOORD1SARBPROC) r3GetProcAddress( "glMultiTexCoord1sARB" );
-        glMultiTexCoord1sv = (PFNGLMULTITEXCOORD1SVPROC) r3GetProcAddress( "glMultiTexCoord1sv" );
-        glMultiTexCoord1svARB = (PFNGLMULTITEXCOORD1SVARBPROC) r3GetProcAddress( "glMultiTexCoord1svARB" );
-        glMultiTexCoord2d = (PFNGLMULTITEXCOORD2DPROC) r3GetProcAddress( "glMultiTexCoord2d" );
-        glMultiTexCoord2dARB = (PFNGLMULTITEXCOORD2DARBPROC) r3GetProcAddress( "glMultiTexCoord2dARB" );
-        glMultiTexCoord2dv = (PFNGLMULTITEXCOORD2DVPROC) r3GetProcAddress( "glMultiTexCoord2dv" );
-        glMultiTexCoord2dvARB = (PFNGLMULTITEXCOORD2DVARBPROC) r3GetProcAddress( "glMultiTexCoord2dvARB" );
-        glMultiTexCoord2f = (PFNGLMULTITEXCOORD2FPROC) r3GetProcAddress( "glMultiTexCoord2f" );
-        glMultiTexCoord2fARB = (PFNGLMULTITEXCOORD2FARBPROC) r3GetProcAddress( "glMultiTexCoord2fARB" );
-        glMultiTexCoord2fv = (PFNGLMULTITEXCOORD2FVPROC) r3GetProcAddress( "glMultiTexCoord2fv" );
-        glMultiTexCoord2fvARB = (PFNGLMULTITEXCOORD2FVARBPROC) r3GetProcAddress( "glMultiTexCoord2fvARB" );
-        glMultiTexCoord2hNV = (PFNGLMULTITEXCOORD2HNVPROC) r3GetProcAddress( "glMultiTexCoord2hNV" );
-        glMultiTexCoord2hvNV = (PFNGLMULTITEXCOORD2HVNVPROC) r3GetProcAddress( "glMultiTexCoord2hvNV" );
-        glMultiTexCoord2i = (PFNGLMULTITEXCOORD2IPROC) r3GetProcAddress( "glMultiTexCoord2i" );
-        glMultiTexCoord2iARB = (PFNGLMULTITEXCOORD2IARBPROC) r3GetProcAddress( "glMultiTexCoord2iARB" );
-        glMultiTexCoord2iv = (PFNGLMULTITEXCOORD2IVPROC) r3GetProcAddress( "glMultiTexCoord2iv" );
-        glMultiTexCoord2ivARB = (PFNGLMULTITEXCOORD2IVARBPROC) r3GetProcAddress( "glMultiTexCoord2ivARB" );
-        glMultiTexCoord2s = (PFNGLMULTITEXCOORD2SPROC) r3GetProcAddress( "glMultiTexCoord2s" );
-        glMultiTexCoord2sARB = (PFNGLMULTITEXCOORD2SARBPROC) r3GetProcAddress( "glMultiTexCoord2sARB" );
-        glMultiTexCoord2sv = (PFNGLMULTITEXCOORD2SVPROC) r3GetProcAddress( "glMultiTexCoord2sv" );
-        glMultiTexCoord2svARB = (PFNGLMULTITEXCOORD2SVARBPROC) r3GetProcAddress( "glMultiTexCoord2svARB" );
-        glMultiTexCoord3d = (PFNGLMULTITEXCOORD3DPROC) r3GetProcAddress( "glMultiTexCoord3d" );
-        glMultiTexCoord3dARB = (PFNGLMULTITEXCOORD3DARBPROC) r3GetProcAddress( "glMultiTexCoord3dARB" );
-        glMultiTexCoord3dv = (PFNGLMULTITEXCOORD3DVPROC) r3GetProcAddress( "glMultiTexCoord3dv" );
-        glMultiTexCoord3dvARB = (PFNGLMULTITEXCOORD3DVARBPROC) r3GetProcAddress( "glMultiTexCoord3dvARB" );
-        glMultiTexCoord3f = (PFNGLMULTITEXCOORD3FPROC) r3GetProcAddress( "glMultiTexCoord3f" );
-        glMultiTexCoord3fARB = (PFNGLMULTITEXCOORD3FARBPROC) r3GetProcAddress( "glMultiTexCoord3fARB" );
-        glMultiTexCoord3fv = (PFNGLMULTITEXCOORD3FVPROC) r3GetProcAddress( "glMultiTexCoord3fv" );
-        glMultiTexCoord3fvARB = (PFNGLMULTITEXCOORD3FVARBPROC) r3GetProcAddress( "glMultiTexCoord3fvARB" );
-        glMultiTexCoord3hNV = (PFNGLMULTITEXCOORD3HNVPROC) r3GetProcAddress( "glMultiTexCoord3hNV" );
-        glMultiTexCoord3hvNV = (PFNGLMULTITEXCOORD3HVNVPROC) r3GetProcAddress( "glMultiTexCoord3hvNV" );
-        glMultiTexCoord3i = (PFNGLMULTITEXCOORD3IPROC) r3GetProcAddress( "glMultiTexCoord3i" );
-        glMultiTexCoord3iARB = (PFNGLMULTITEXCOORD3IARBPROC) r3GetProcAddress( "glMultiTexCoord3iARB" );
-        glMultiTexCoord3iv = (PFNGLMULTITEXCOORD3IVPROC) r3GetProcAddress( "glMultiTexCoord3iv" );
-        glMultiTexCoord3ivARB = (PFNGLMULTITEXCOORD3IVARBPROC) r3GetProcAddress( "glMultiTexCoord3ivARB" );
-        glMultiTexCoord3s = (PFNGLMULTITEXCOORD3SPROC) r3GetProcAddress( "glMultiTexCoord3s" );
-        glMultiTexCoord3sARB = (PFNGLMULTITEXCOORD3SARBPROC) r3GetProcAddress( "glMultiTexCoord3sARB" );
-        glMultiTexCoord3sv = (PFNGLMULTITEXCOORD3SVPROC) r3GetProcAddress( "glMultiTexCoord3sv" );
-        glMultiTexCoord3svARB = (PFNGLMULTITEXCOORD3SVARBPROC) r3GetProcAddress( "glMultiTexCoord3svARB" );
-        glMultiTexCoord4d = (PFNGLMULTITEXCOORD4DPROC) r3GetProcAddress( "glMultiTexCoord4d" );
-        glMultiTexCoord4dARB = (PFNGLMULTITEXCOORD4DARBPROC) r3GetProcAddress( "glMultiTexCoord4dARB" );
-        glMultiTexCoord4dv = (PFNGLMULTITEXCOORD4DVPROC) r3GetProcAddress( "glMultiTexCoord4dv" );
-        glMultiTexCoord4dvARB = (PFNGLMULTITEXCOORD4DVARBPROC) r3GetProcAddress( "glMultiTexCoord4dvARB" );
-        glMultiTexCoord4f = (PFNGLMULTITEXCOORD4FPROC) r3GetProcAddress( "glMultiTexCoord4f" );
-        glMultiTexCoord4fARB = (PFNGLMULTITEXCOORD4FARBPROC) r3GetProcAddress( "glMultiTexCoord4fARB" );
-        glMultiTexCoord4fv = (PFNGLMULTITEXCOORD4FVPROC) r3GetProcAddress( "glMultiTexCoord4fv" );
-        glMultiTexCoord4fvARB = (PFNGLMULTITEXCOORD4FVARBPROC) r3GetProcAddress( "glMultiTexCoord4fvARB" );
-        glMultiTexCoord4hNV = (PFNGLMULTITEXCOORD4HNVPROC) r3GetProcAddress( "glMultiTexCoord4hNV" );
-        glMultiTexCoord4hvNV = (PFNGLMULTITEXCOORD4HVNVPROC) r3GetProcAddress( "glMultiTexCoord4hvNV" );
-        glMultiTexCoord4i = (PFNGLMULTITEXCOORD4IPROC) r3GetProcAddress( "glMultiTexCoord4i" );
-        glMultiTexCoord4iARB = (PFNGLMULTITEXCOORD4IARBPROC) r3GetProcAddress( "glMultiTexCoord4iARB" );
-        glMultiTexCoord4iv = (PFNGLMULTITEXCOORD4IVPROC) r3GetProcAddress( "glMultiTexCoord4iv" );
-        glMultiTexCoord4ivARB = (PFNGLMULTITEXCOORD4IVARBPROC) r3GetProcAddress( "glMultiTexCoord4ivARB" );
-        glMultiTexCoord4s = (PFNGLMULTITEXCOORD4SPROC) r3GetProcAddress( "glMultiTexCoord4s" );
-        glMultiTexCoord4sARB = (PFNGLMULTITEXCOORD4SARBPROC) r3GetProcAddress( "glMultiTexCoord4sARB" );
-        glMultiTexCoord4sv = (PFNGLMULTITEXCOORD4SVPROC) r3GetProcAddress( "glMultiTexCoord4sv" );
-        glMultiTexCoord4svARB = (PFNGLMULTITEXCOORD4SVARBPROC) r3GetProcAddress( "glMultiTexCoord4svARB" );
-        glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC) r3GetProcAddress( "glMultiTexCoordP1ui" );
-        glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC) r3GetProcAddress( "glMultiTexCoordP1uiv" );
-        glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC) r3GetProcAddress( "glMultiTexCoordP2ui" );
-        glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC) r3GetProcAddress( "glMultiTexCoordP2uiv" );
-        glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC) r3GetProcAddress( "glMultiTexCoordP3ui" );
-        glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC) r3GetProcAddress( "glMultiTexCoordP3uiv" );
-        glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC) r3GetProcAddress( "glMultiTexCoordP4ui" );
-        glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC) r3GetProcAddress( "glMultiTexCoordP4uiv" );
-        glMultiTexCoordPointerEXT = (PFNGLMULTITEXCOORDPOINTEREXTPROC) r3GetProcAddress( "glMultiTexCoordPointerEXT" );
-        glMultiTexEnvfEXT = (PFNGLMULTITEXENVFEXTPROC) r3GetProcAddress( "glMultiTexEnvfEXT" );
-        glMultiTexEnvfvEXT = (PFNGLMULTITEXENVFVEXTPROC) r3GetProcAddress( "glMultiTexEnvfvEXT" );
-        glMultiTexEnviEXT = (PFNGLMULTITEXENVIEXTPROC) r3GetProcAddress( "glMultiTexEnviEXT" );
-        glMultiTexEnvivEXT = (PFNGLMULTITEXENVIVEXTPROC) r3GetProcAddress( "glMultiTexEnvivEXT" );
-        glMultiTexGendEXT = (PFNGLMULTITEXGENDEXTPROC) r3GetProcAddress( "glMultiTexGendEXT" );
-        glMultiTexGendvEXT = (PFNGLMULTITEXGENDVEXTPROC) r3GetProcAddress( "glMultiTexGendvEXT" );
-        glMultiTexGenfEXT = (PFNGLMULTITEXGENFEXTPROC) r3GetProcAddress( "glMultiTexGenfEXT" );
-        glMultiTexGenfvEXT = (PFNGLMULTITEXGENFVEXTPROC) r3GetProcAddress( "glMultiTexGenfvEXT" );
-        glMultiTexGeniEXT = (PFNGLMULTITEXGENIEXTPROC) r3GetProcAddress( "glMultiTexGeniEXT" );
-        glMultiTexGenivEXT = (PFNGLMULTITEXGENIVEXTPROC) r3GetProcAddress( "glMultiTexGenivEXT" );
-        glMultiTexImage1DEXT = (PFNGLMULTITEXIMAGE1DEXTPROC) r3GetProcAddress( "glMultiTexImage1DEXT" );
-        glMultiTexImage2DEXT = (PFNGLMULTITEXIMAGE2DEXTPROC) r3GetProcAddress( "glMultiTexImage2DEXT" );
-        glMultiTexImage3DEXT = (PFNGLMULTITEXIMAGE3DEXTPROC) r3GetProcAddress( "glMultiTexImage3DEXT" );
-        glMultiTexParameterIivEXT = (PFNGLMULTITEXPARAMETERIIVEXTPROC) r3GetProcAddress( "glMultiTexParameterIivEXT" );
-        glMultiTexParameterIuivEXT = (PFNGLMULTITEXPARAMETERIUIVEXTPROC) r3GetProcAddress( "glMultiTexParameterIuivEXT" );
-        glMultiTexParameterfEXT = (PFNGLMULTITEXPARAMETERFEXTPROC) r3GetProcAddress( "glMultiTexParameterfEXT" );
-        glMultiTexParameterfvEXT = (PFNGLMULTITEXPARAMETERFVEXTPROC) r3GetProcAddress( "glMultiTexParameterfvEXT" );
-        glMultiTexParameteriEXT = (PFNGLMULTITEXPARAMETERIEXTPROC) r3GetProcAddress( "glMultiTexParameteriEXT" );
-        glMultiTexParameterivEXT = (PFNGLMULTITEXPARAMETERIVEXTPROC) r3GetProcAddress( "glMultiTexParameterivEXT" );
-        glMultiTexRenderbufferEXT = (PFNGLMULTITEXRENDERBUFFEREXTPROC) r3GetProcAddress( "glMultiTexRenderbufferEXT" );
-        glMultiTexSubImage1DEXT = (PFNGLMULTITEXSUBIMAGE1DEXTPROC) r3GetProcAddress( "glMultiTexSubImage1DEXT" );
-        glMultiTexSubImage2DEXT = (PFNGLMULTITEXSUBIMAGE2DEXTPROC) r3GetProcAddress( "glMultiTexSubImage2DEXT" );
-        glMultiTexSubImage3DEXT = (PFNGLMULTITEXSUBIMAGE3DEXTPROC) r3GetProcAddress( "glMultiTexSubImage3DEXT" );
-        glNamedBufferDataEXT = (PFNGLNAMEDBUFFERDATAEXTPROC) r3GetProcAddress( "glNamedBufferDataEXT" );
-        glNamedBufferSubDataEXT = (PFNGLNAMEDBUFFERSUBDATAEXTPROC) r3GetProcAddress( "glNamedBufferSubDataEXT" );
-        glNamedCopyBufferSubDataEXT = (PFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC) r3GetProcAddress( "glNamedCopyBufferSubDataEXT" );
-        glNamedFramebufferRenderbufferEXT = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC) r3GetProcAddress( "glNamedFramebufferRenderbufferEXT" );
-        glNamedFramebufferTexture1DEXT = (PFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC) r3GetProcAddress( "glNamedFramebufferTexture1DEXT" );
-        glNamedFramebufferTexture2DEXT = (PFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC) r3GetProcAddress( "glNamedFramebufferTexture2DEXT" );
-        glNamedFramebufferTexture3DEXT = (PFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC) r3GetProcAddress( "glNamedFramebufferTexture3DEXT" );
-        glNamedFramebufferTextureEXT = (PFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC) r3GetProcAddress( "glNamedFramebufferTextureEXT" );
-        glNamedFramebufferTextureFaceEXT = (PFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC) r3GetProcAddress( "glNamedFramebufferTextureFaceEXT" );
-        glNamedFramebufferTextureLayerEXT = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC) r3GetProcAddress( "glNamedFramebufferTextureLayerEXT" );
-        glNamedProgramLocalParameter4dEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC) r3GetProcAddress( "glNamedProgramLocalParameter4dEXT" );
-        glNamedProgramLocalParameter4dvEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC) r3GetProcAddress( "glNamedProgramLocalParameter4dvEXT" );
-        glNamedProgramLocalParameter4fEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC) r3GetProcAddress( "glNamedProgramLocalParameter4fEXT" );
-        glNamedProgramLocalParameter4fvEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC) r3GetProcAddress( "glNamedProgramLocalParameter4fvEXT" );
-        glNamedProgramLocalParameterI4iEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC) r3GetProcAddress( "glNamedProgramLocalParameterI4iEXT" );
-        glNamedProgramLocalParameterI4ivEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC) r3GetProcAddress( "glNamedProgramLocalParameterI4ivEXT" );
-        glNamedProgramLocalParameterI4uiEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC) r3GetProcAddress( "glNamedProgramLocalParameterI4uiEXT" );
-        glNamedProgramLocalParameterI4uivEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC) r3GetProcAddress( "glNamedProgramLocalParameterI4uivEXT" );
-        glNamedProgramLocalParameters4fvEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC) r3GetProcAddress( "glNamedProgramLocalParameters4fvEXT" );
-        glNamedProgramLocalParametersI4ivEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC) r3GetProcAddress( "glNamedProgramLocalParametersI4ivEXT" );
-        glNamedProgramLocalParametersI4uivEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC) r3GetProcAddress( "glNamedProgramLocalParametersI4uivEXT" );
-        glNamedProgramStringEXT = (PFNGLNAMEDPROGRAMSTRINGEXTPROC) r3GetProcAddress( "glNamedProgramStringEXT" );
-        glNamedRenderbufferStorageEXT = (PFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC) r3GetProcAddress( "glNamedRenderbufferStorageEXT" );
-        glNamedRenderbufferStorageMultisampleCoverageEXT = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC) r3GetProcAddress( "glNamedRenderbufferStorageMultisampleCoverageEXT" );
-        glNamedRenderbufferStorageMultisampleEXT = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC) r3GetProcAddress( "glNamedRenderbufferStorageMultisampleEXT" );
-        glNamedStringARB = (PFNGLNAMEDSTRINGARBPROC) r3GetProcAddress( "glNamedStringARB" );
-        glNewObjectBufferATI = (PFNGLNEWOBJECTBUFFERATIPROC) r3GetProcAddress( "glNewObjectBufferATI" );
-        glNormal3fVertex3fSUN = (PFNGLNORMAL3FVERTEX3FSUNPROC) r3GetProcAddress( "glNormal3fVertex3fSUN" );
-        glNormal3fVertex3fvSUN = (PFNGLNORMAL3FVERTEX3FVSUNPROC) r3GetProcAddress( "glNormal3fVertex3fvSUN" );
-        glNormal3hNV = (PFNGLNORMAL3HNVPROC) r3GetProcAddress( "glNormal3hNV" );
-        glNormal3hvNV = (PFNGLNORMAL3HVNVPROC) r3GetProcAddress( "glNormal3hvNV" );
-        glNormalFormatNV = (PFNGLNORMALFORMATNVPROC) r3GetProcAddress( "glNormalFormatNV" );
-        glNormalP3ui = (PFNGLNORMALP3UIPROC) r3GetProcAddress( "glNormalP3ui" );
-        glNormalP3uiv = (PFNGLNORMALP3UIVPROC) r3GetProcAddress( "glNormalP3uiv" );
-        glNormalPointerEXT = (PFNGLNORMALPOINTEREXTPROC) r3GetProcAddress( "glNormalPointerEXT" );
-        glNormalPointerListIBM = (PFNGLNORMALPOINTERLISTIBMPROC) r3GetProcAddress( "glNormalPointerListIBM" );
-        glNormalPointervINTEL = (PFNGLNORMALPOINTERVINTELPROC) r3GetProcAddress( "glNormalPointervINTEL" );
-        glNormalStream3bATI = (PFNGLNORMALSTREAM3BATIPROC) r3GetProcAddress( "glNormalStream3bATI" );
-        glNormalStream3bvATI = (PFNGLNORMALSTREAM3BVATIPROC) r3GetProcAddress( "glNormalStream3bvATI" );
-        glNormalStream3dATI = (PFNGLNORMALSTREAM3DATIPROC) r3GetProcAddress( "glNormalStream3dATI" );
-        glNormalStream3dvATI = (PFNGLNORMALSTREAM3DVATIPROC) r3GetProcAddress( "glNormalStream3dvATI" );
-        glNormalStream3fATI = (PFNGLNORMALSTREAM3FATIPROC) r3GetProcAddress( "glNormalStream3fATI" );
-        glNormalStream3fvATI = (PFNGLNORMALSTREAM3FVATIPROC) r3GetProcAddress( "glNormalStream3fvATI" );
-        glNormalStream3iATI = (PFNGLNORMALSTREAM3IATIPROC) r3GetProcAddress( "glNormalStream3iATI" );
-        glNormalStream3ivATI = (PFNGLNORMALSTREAM3IVATIPROC) r3GetProcAddress( "glNormalStream3ivATI" );
-        glNormalStream3sATI = (PFNGLNORMALSTREAM3SATIPROC) r3GetProcAddress( "glNormalStream3sATI" );
-        glNormalStream3svATI = (PFNGLNORMALSTREAM3SVATIPROC) r3GetProcAddress( "glNormalStream3svATI" );
-        glObjectPurgeableAPPLE = (PFNGLOBJECTPURGEABLEAPPLEPROC) r3GetProcAddress( "glObjectPurgeableAPPLE" );
-        glObjectUnpurgeableAPPLE = (PFNGLOBJECTUNPURGEABLEAPPLEPROC) r3GetProcAddress( "glObjectUnpurgeableAPPLE" );
-        glPNTrianglesfATI = (PFNGLPNTRIANGLESFATIPROC) r3GetProcAddress( "glPNTrianglesfATI" );
-        glPNTrianglesiATI = (PFNGLPNTRIANGLESIATIPROC) r3GetProcAddress( "glPNTrianglesiATI" );
-        glPassTexCoordATI = (PFNGLPASSTEXCOORDATIPROC) r3GetProcAddress( "glPassTexCoordATI" );
-        glPatchParameterfv = (PFNGLPATCHPARAMETERFVPROC) r3GetProcAddress( "glPatchParameterfv" );
-        glPatchParameteri = (PFNGLPATCHPARAMETERIPROC) r3GetProcAddress( "glPatchParameteri" );
-        glPauseTransformFeedback = (PFNGLPAUSETRANSFORMFEEDBACKPROC) r3GetProcAddress( "glPauseTransformFeedback" );
-        glPauseTransformFeedbackNV = (PFNGLPAUSETRANSFORMFEEDBACKNVPROC) r3GetProcAddress( "glPauseTransformFeedbackNV" );
-        glPixelDataRangeNV = (PFNGLPIXELDATARANGENVPROC) r3GetProcAddress( "glPixelDataRangeNV" );
-        glPixelTexGenParameterfSGIS = (PFNGLPIXELTEXGENPARAMETERFSGISPROC) r3GetProcAddress( "glPixelTexGenParameterfSGIS" );
-        glPixelTexGenParameterfvSGIS = (PFNGLPIXELTEXGENPARAMETERFVSGISPROC) r3GetProcAddress( "glPixelTexGenParameterfvSGIS" );
-        glPixelTexGenParameteriSGIS = (PFNGLPIXELTEXGENPARAMETERISGISPROC) r3GetProcAddress( "glPixelTexGenParameteriSGIS" );
-        glPixelTexGenParameterivSGIS = (PFNGLPIXELTEXGENPARAMETERIVSGISPROC) r3GetProcAddress( "glPixelTexGenParameterivSGIS" );
-        glPixelTexGenSGIX = (PFNGLPIXELTEXGENSGIXPROC) r3GetProcAddress( "glPixelTexGenSGIX" );
-        glPixelTransformParameterfEXT = (PFNGLPIXELTRANSFORMPARAMETERFEXTPROC) r3GetProcAddress( "glPixelTransformParameterfEXT" );
-        glPixelTransformParameterfvEXT = (PFNGLPIXELTRANSFORMPARAMETERFVEXTPROC) r3GetProcAddress( "glPixelTransformParameterfvEXT" );
-        glPixelTransformParameteriEXT = (PFNGLPIXELTRANSFORMPARAMETERIEXTPROC) r3GetProcAddress( "glPixelTransformParameteriEXT" );
-        glPixelTransformParameterivEXT = (PFNGLPIXELTRANSFORMPARAMETERIVEXTPROC) r3GetProcAddress( "glPixelTransformParameterivEXT" );
-        glPointParameterf = (PFNGLPOINTPARAMETERFPROC) r3GetProcAddress( "glPointParameterf" );
-        glPointParameterfARB = (PFNGLPOINTPARAMETERFARBPROC) r3GetProcAddress( "glPointParameterfARB" );
-        glPointParameterfEXT = (PFNGLPOINTPARAMETERFEXTPROC) r3GetProcAddress( "glPointParameterfEXT" );
-        glPointParameterfSGIS = (PFNGLPOINTPARAMETERFSGISPROC) r3GetProcAddress( "glPointParameterfSGIS" );
-        glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC) r3GetProcAddress( "glPointParameterfv" );
-        glPointParameterfvARB = (PFNGLPOINTPARAMETERFVARBPROC) r3GetProcAddress( "glPointParameterfvARB" );
-        glPointParameterfvEXT = (PFNGLPOINTPARAMETERFVEXTPROC) r3GetProcAddress( "glPointParameterfvEXT" );
-        glPointParameterfvSGIS = (PFNGLPOINTPARAMETERFVSGISPROC) r3GetProcAddress( "glPointParameterfvSGIS" );
-        glPointParameteri = (PFNGLPOINTPARAMETERIPROC) r3GetProcAddress( "glPointParameteri" );
-        glPointParameteriNV = (PFNGLPOINTPARAMETERINVPROC) r3GetProcAddress( "glPointParameteriNV" );
-        glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC) r3GetProcAddress( "glPointParameteriv" );
-        glPointParameterivNV = (PFNGLPOINTPARAMETERIVNVPROC) r3GetProcAddress( "glPointParameterivNV" );
-        glPollAsyncSGIX = (PFNGLPOLLASYNCSGIXPROC) r3GetProcAddress( "glPollAsyncSGIX" );
-        glPollInstrumentsSGIX = (PFNGLPOLLINSTRUMENTSSGIXPROC) r3GetProcAddress( "glPollInstrumentsSGIX" );
-        glPolygonOffsetEXT = (PFNGLPOLYGONOFFSETEXTPROC) r3GetProcAddress( "glPolygonOffsetEXT" );
-        glPresentFrameDualFillNV = (PFNGLPRESENTFRAMEDUALFILLNVPROC) r3GetProcAddress( "glPresentFrameDualFillNV" );
-        glPresentFrameKeyedNV = (PFNGLPRESENTFRAMEKEYEDNVPROC) r3GetProcAddress( "glPresentFrameKeyedNV" );
-        glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC) r3GetProcAddress( "glPrimitiveRestartIndex" );
-        glPrimitiveRestartIndexNV = (PFNGLPRIMITIVERESTARTINDEXNVPROC) r3GetProcAddress( "glPrimitiveRestartIndexNV" );
-        glPrimitiveRestartNV = (PFNGLPRIMITIVERESTARTNVPROC) r3GetProcAddress( "glPrimitiveRestartNV" );
-        glPrioritizeTexturesEXT = (PFNGLPRIORITIZETEXTURESEXTPROC) r3GetProcAddress( "glPrioritizeTexturesEXT" );
-        glProgramBufferParametersIivNV = (PFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC) r3GetProcAddress( "glProgramBufferParametersIivNV" );
-        glProgramBufferParametersIuivNV = (PFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC) r3GetProcAddress( "glProgramBufferParametersIuivNV" );
-        glProgramBufferParametersfvNV = (PFNGLPROGRAMBUFFERPARAMETERSFVNVPROC) r3GetProcAddress( "glProgramBufferParametersfvNV" );
-        glProgramEnvParameter4dARB = (PFNGLPROGRAMENVPARAMETER4DARBPROC) r3GetProcAddress( "glProgramEnvParameter4dARB" );
-        glProgramEnvParameter4dvARB = (PFNGLPROGRAMENVPARAMETER4DVARBPROC) r3GetProcAddress( "glProgramEnvParameter4dvARB" );
-        glProgramEnvParameter4fARB = (PFNGLPROGRAMENVPARAMETER4FARBPROC) r3GetProcAddress( "glProgramEnvParameter4fARB" );
-        glProgramEnvParameter4fvARB = (PFNGLPROGRAMENVPARAMETER4FVARBPROC) r3GetProcAddress( "glProgramEnvParameter4fvARB" );
-        glProgramEnvParameterI4iNV = (PFNGLPROGRAMENVPARAMETERI4INVPROC) r3GetProcAddress( "glProgramEnvParameterI4iNV" );
-        glProgramEnvParameterI4ivNV = (PFNGLPROGRAMENVPARAMETERI4IVNVPROC) r3GetProcAddress( "glProgramEnvParameterI4ivNV" );
-        glProgramEnvParameterI4uiNV = (PFNGLPROGRAMENVPARAMETERI4UINVPROC) r3GetProcAddress( "glProgramEnvParameterI4uiNV" );
-        glProgramEnvParameterI4uivNV = (PFNGLPROGRAMENVPARAMETERI4UIVNVPROC) r3GetProcAddress( "glProgramEnvParameterI4uivNV" );
-        glProgramEnvParameters4fvEXT = (PFNGLPROGRAMENVPARAMETERS4FVEXTPROC) r3GetProcAddress( "glProgramEnvParameters4fvEXT" );
-        glProgramEnvParametersI4ivNV = (PFNGLPROGRAMENVPARAMETERSI4IVNVPROC) r3GetProcAddress( "glProgramEnvParametersI4ivNV" );
-        glProgramEnvParametersI4uivNV = (PFNGLPROGRAMENVPARAMETERSI4UIVNVPROC) r3GetProcAddress( "glProgramEnvParametersI4uivNV" );
-        glProgramLocalParameter4dARB = (PFNGLPROGRAMLOCALPARAMETER4DARBPROC) r3GetProcAddress( "glProgramLocalParameter4dARB" );
-        glProgramLocalParameter4dvARB = (PFNGLPROGRAMLOCALPARAMETER4DVARBPROC) r3GetProcAddress( "glProgramLocalParameter4dvARB" );
-        glProgramLocalParameter4fARB = (PFNGLPROGRAMLOCALPARAMETER4FARBPROC) r3GetProcAddress( "glProgramLocalParameter4fARB" );
-        glProgramLocalParameter4fvARB = (PFNGLPROGRAMLOCALPARAMETER4FVARBPROC) r3GetProcAddress( "glProgramLocalParameter4fvARB" );
-        glProgramLocalParameterI4iNV = (PFNGLPROGRAMLOCALPARAMETERI4INVPROC) r3GetProcAddress( "glProgramLocalParameterI4iNV" );
-        glProgramLocalParameterI4ivNV = (PFNGLPROGRAMLOCALPARAMETERI4IVNVPROC) r3GetProcAddress( "glProgramLocalParameterI4ivNV" );
-        glProgramLocalParameterI4uiNV = (PFNGLPROGRAMLOCALPARAMETERI4UINVPROC) r3GetProcAddress( "glProgramLocalParameterI4uiNV" );
-        glProgramLocalParameterI4uivNV = (PFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC) r3GetProcAddress( "glProgramLocalParameterI4uivNV" );
-        glProgramLocalParameters4fvEXT = (PFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC) r3GetProcAddress( "glProgramLocalParameters4fvEXT" );
-        glProgramLocalParametersI4ivNV = (PFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC) r3GetProcAddress( "glProgramLocalParametersI4ivNV" );
-        glProgramLocalParametersI4uivNV = (PFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC) r3GetProcAddress( "glProgramLocalParametersI4uivNV" );
-        glProgramNamedParameter4dNV = (PFNGLPROGRAMNAMEDPARAMETER4DNVPROC) r3GetProcAddress( "glProgramNamedParameter4dNV" );
-        glProgramNamedParameter4dvNV = (PFNGLPROGRAMNAMEDPARAMETER4DVNVPROC) r3GetProcAddress( "glProgramNamedParameter4dvNV" );
-        glProgramNamedParameter4fNV = (PFNGLPROGRAMNAMEDPARAMETER4FNVPROC) r3GetProcAddress( "glProgramNamedParameter4fNV" );
-        glProgramNamedParameter4fvNV = (PFNGLPROGRAMNAMEDPARAMETER4FVNVPROC) r3GetProcAddress( "glProgramNamedParameter4fvNV" );
-        glProgramParameter4dNV = (PFNGLPROGRAMPARAMETER4DNVPROC) r3GetProcAddress( "glProgramParameter4dNV" );
-        glProgramParameter4dvNV = (PFNGLPROGRAMPARAMETER4DVNVPROC) r3GetProcAddress( "glProgramParameter4dvNV" );
-        glProgramParameter4fNV = (PFNGLPROGRAMPARAMETER4FNVPROC) r3GetProcAddress( "glProgramParameter4fNV" );
-        glProgramParameter4fvNV = (PFNGLPROGRAMPARAMETER4FVNVPROC) r3GetProcAddress( "glProgramParameter4fvNV" );
-        glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC) r3GetProcAddress( "glProgramParameteri" );
-        glProgramParameteriARB = (PFNGLPROGRAMPARAMETERIARBPROC) r3GetProcAddress( "glProgramParameteriARB" );
-        glProgramParameteriEXT = (PFNGLPROGRAMPARAMETERIEXTPROC) r3GetProcAddress( "glProgramParameteriEXT" );
-        glProgramParameters4dvNV = (PFNGLPROGRAMPARAMETERS4DVNVPROC) r3GetProcAddress( "glProgramParameters4dvNV" );
-        glProgramParameters4fvNV = (PFNGLPROGRAMPARAMETERS4FVNVPROC) r3GetProcAddress( "glProgramParameters4fvNV" );
-        glProgramStringARB = (PFNGLPROGRAMSTRINGARBPROC) r3GetProcAddress( "glProgramStringARB" );
-        glProgramUniform1dEXT = (PFNGLPROGRAMUNIFORM1DEXTPROC) r3GetProcAddress( "glProgramUniform1dEXT" );
-        glProgramUniform1dvEXT = (PFNGLPROGRAMUNIFORM1DVEXTPROC) r3GetProcAddress( "glProgramUniform1dvEXT" );
-        glProgramUniform1fEXT = (PFNGLPROGRAMUNIFORM1FEXTPROC) r3GetProcAddress( "glProgramUniform1fEXT" );
-        glProgramUniform1fvEXT = (PFNGLPROGRAMUNIFORM1FVEXTPROC) r3GetProcAddress( "glProgramUniform1fvEXT" );
-        glProgramUniform1iEXT = (PFNGLPROGRAMUNIFORM1IEXTPROC) r3GetProcAddress( "glProgramUniform1iEXT" );
-        glProgramUniform1ivEXT = (PFNGLPROGRAMUNIFORM1IVEXTPROC) r3GetProcAddress( "glProgramUniform1ivEXT" );
-        glProgramUniform1uiEXT = (PFNGLPROGRAMUNIFORM1UIEXTPROC) r3GetProcAddress( "glProgramUniform1uiEXT" );
-        glProgramUniform1uivEXT = (PFNGLPROGRAMUNIFORM1UIVEXTPROC) r3GetProcAddress( "glProgramUniform1uivEXT" );
-        glProgramUniform2dEXT = (PFNGLPROGRAMUNIFORM2DEXTPROC) r3GetProcAddress( "glProgramUniform2dEXT" );
-        glProgramUniform2dvEXT = (PFNGLPROGRAMUNIFORM2DVEXTPROC) r3GetProcAddress( "glProgramUniform2dvEXT" );
-        glProgramUniform2fEXT = (PFNGLPROGRAMUNIFORM2FEXTPROC) r3GetProcAddress( "glProgramUniform2fEXT" );
-        glProgramUniform2fvEXT = (PFNGLPROGRAMUNIFORM2FVEXTPROC) r3GetProcAddress( "glProgramUniform2fvEXT" );
-        glProgramUniform2iEXT = (PFNGLPROGRAMUNIFORM2IEXTPROC) r3GetProcAddress( "glProgramUniform2iEXT" );
-        glProgramUniform2ivEXT = (PFNGLPROGRAMUNIFORM2IVEXTPROC) r3GetProcAddress( "glProgramUniform2ivEXT" );
-        glProgramUniform2uiEXT = (PFNGLPROGRAMUNIFORM2UIEXTPROC) r3GetProcAddress( "glProgramUniform2uiEXT" );
-        glProgramUniform2uivEXT = (PFNGLPROGRAMUNIFORM2UIVEXTPROC) r3GetProcAddress( "glProgramUniform2uivEXT" );
-        glProgramUniform3dEXT = (PFNGLPROGRAMUNIFORM3DEXTPROC) r3GetProcAddress( "glProgramUniform3dEXT" );
-        glProgramUniform3dvEXT = (PFNGLPROGRAMUNIFORM3DVEXTPROC) r3GetProcAddress( "glProgramUniform3dvEXT" );
-        glProgramUniform3fEXT = (PFNGLPROGRAMUNIFORM3FEXTPROC) r3GetProcAddress( "glProgramUniform3fEXT" );
-        glProgramUniform3fvEXT = (PFNGLPROGRAMUNIFORM3FVEXTPROC) r3GetProcAddress( "glProgramUniform3fvEXT" );
-        glProgramUniform3iEXT = (PFNGLPROGRAMUNIFORM3IEXTPROC) r3GetProcAddress( "glProgramUniform3iEXT" );
-        glProgramUniform3ivEXT = (PFNGLPROGRAMUNIFORM3IVEXTPROC) r3GetProcAddress( "glProgramUniform3ivEXT" );
-        glProgramUniform3uiEXT = (PFNGLPROGRAMUNIFORM3UIEXTPROC) r3GetProcAddress( "glProgramUniform3uiEXT" );
-        glProgramUniform3uivEXT = (PFNGLPROGRAMUNIFORM3UIVEXTPROC) r3GetProcAddress( "glProgramUniform3uivEXT" );
-        glProgramUniform4dEXT = (PFNGLPROGRAMUNIFORM4DEXTPROC) r3GetProcAddress( "glProgramUniform4dEXT" );
-        glProgramUniform4dvEXT = (PFNGLPROGRAMUNIFORM4DVEXTPROC) r3GetProcAddress( "glProgramUniform4dvEXT" );
-        glProgramUniform4fEXT = (PFNGLPROGRAMUNIFORM4FEXTPROC) r3GetProcAddress( "glProgramUniform4fEXT" );
-        glProgramUniform4fvEXT = (PFNGLPROGRAMUNIFORM4FVEXTPROC) r3GetProcAddress( "glProgramUniform4fvEXT" );
-        glProgramUniform4iEXT = (PFNGLPROGRAMUNIFORM4IEXTPROC) r3GetProcAddress( "glProgramUniform4iEXT" );
-        glProgramUniform4ivEXT = (PFNGLPROGRAMUNIFORM4IVEXTPROC) r3GetProcAddress( "glProgramUniform4ivEXT" );
-        glProgramUniform4uiEXT = (PFNGLPROGRAMUNIFORM4UIEXTPROC) r3GetProcAddress( "glProgramUniform4uiEXT" );
-        glProgramUniform4uivEXT = (PFNGLPROGRAMUNIFORM4UIVEXTPROC) r3GetProcAddress( "glProgramUniform4uivEXT" );
-        glProgramUniformMatrix2dvEXT = (PFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC) r3GetProcAddress( "glProgramUniformMatrix2dvEXT" );
-        glProgramUniformMatrix2fvEXT = (PFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC) r3GetProcAddress( "glProgramUniformMatrix2fvEXT" );
-        glProgramUniformMatrix2x3dvEXT = (PFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC) r3GetProcAddress( "glProgramUniformMatrix2x3dvEXT" );
-        glProgramUniformMatrix2x3fvEXT = (PFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC) r3GetProcAddress( "glProgramUniformMatrix2x3fvEXT" );
-        glProgramUniformMatrix2x4dvEXT = (PFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC) r3GetProcAddress( "glProgramUniformMatrix2x4dvEXT" );
-        glProgramUniformMatrix2x4fvEXT = (PFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC) r3GetProcAddress( "glProgramUniformMatrix2x4fvEXT" );
-        glProgramUniformMatrix3dvEXT = (PFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC) r3GetProcAddress( "glProgramUniformMatrix3dvEXT" );
-        glProgramUniformMatrix3fvEXT = (PFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC) r3GetProcAddress( "glProgramUniformMatrix3fvEXT" );
-        glProgramUniformMatrix3x2dvEXT = (PFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC) r3GetProcAddress( "glProgramUniformMatrix3x2dvEXT" );
-        glProgramUniformMatrix3x2fvEXT = (PFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC) r3GetProcAddress( "glProgramUniformMatrix3x2fvEXT" );
-        glProgramUniformMatrix3x4dvEXT = (PFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC) r3GetProcAddress( "glProgramUniformMatrix3x4dvEXT" );
-        glProgramUniformMatrix3x4fvEXT = (PFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC) r3GetProcAddress( "glProgramUniformMatrix3x4fvEXT" );
-        glProgramUniformMatrix4dvEXT = (PFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC) r3GetProcAddress( "glProgramUniformMatrix4dvEXT" );
-        glProgramUniformMatrix4fvEXT = (PFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC) r3GetProcAddress( "glProgramUniformMatrix4fvEXT" );
-        glProgramUniformMatrix4x2dvEXT = (PFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC) r3GetProcAddress( "glProgramUniformMatrix4x2dvEXT" );
-        glProgramUniformMatrix4x2fvEXT = (PFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC) r3GetProcAddress( "glProgramUniformMatrix4x2fvEXT" );
-        glProgramUniformMatrix4x3dvEXT = (PFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC) r3GetProcAddress( "glProgramUniformMatrix4x3dvEXT" );
-        glProgramUniformMatrix4x3fvEXT = (PFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC) r3GetProcAddress( "glProgramUniformMatrix4x3fvEXT" );
-        glProgramUniformui64NV = (PFNGLPROGRAMUNIFORMUI64NVPROC) r3GetProcAddress( "glProgramUniformui64NV" );
-        glProgramUniformui64vNV = (PFNGLPROGRAMUNIFORMUI64VNVPROC) r3GetProcAddress( "glProgramUniformui64vNV" );
-        glProgramVertexLimitNV = (PFNGLPROGRAMVERTEXLIMITNVPROC) r3GetProcAddress( "glProgramVertexLimitNV" );
-        glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC) r3GetProcAddress( "glProvokingVertex" );
-        glProvokingVertexEXT = (PFNGLPROVOKINGVERTEXEXTPROC) r3GetProcAddress( "glProvokingVertexEXT" );
-        glPushClientAttribDefaultEXT = (PFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC) r3GetProcAddress( "glPushClientAttribDefaultEXT" );
-        glQueryCounter = (PFNGLQUERYCOUNTERPROC) r3GetProcAddress( "glQueryCounter" );
-        glReadInstrumentsSGIX = (PFNGLREADINSTRUMENTSSGIXPROC) r3GetProcAddress( "glReadInstrumentsSGIX" );
-        glReferencePlaneSGIX = (PFNGLREFERENCEPLANESGIXPROC) r3GetProcAddress( "glReferencePlaneSGIX" );
-        glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC) r3GetProcAddress( "glRenderbufferStorage" );
-        glRenderbufferStorageEXT = (PFNGLRENDERBUFFERSTORAGEEXTPROC) r3GetProcAddress( "glRenderbufferStorageEXT" );
-        glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC) r3GetProcAddress( "glRenderbufferStorageMultisample" );
-        glRenderbufferStorageMultisampleCoverageNV = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC) r3GetProcAddress( "glRenderbufferStorageMultisampleCoverageNV" );
-        glRenderbufferStorageMultisampleEXT = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC) r3GetProcAddress( "glRenderbufferStorageMultisampleEXT" );
-        glReplacementCodePointerSUN = (PFNGLREPLACEMENTCODEPOINTERSUNPROC) r3GetProcAddress( "glReplacementCodePointerSUN" );
-        glReplacementCodeubSUN = (PFNGLREPLACEMENTCODEUBSUNPROC) r3GetProcAddress( "glReplacementCodeubSUN" );
-        glReplacementCodeubvSUN = (PFNGLREPLACEMENTCODEUBVSUNPROC) r3GetProcAddress( "glReplacementCodeubvSUN" );
-        glReplacementCodeuiColor3fVertex3fSUN = (PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC) r3GetProcAddress( "glReplacementCodeuiColor3fVertex3fSUN" );
-        glReplacementCodeuiColor3fVertex3fvSUN = (PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC) r3GetProcAddress( "glReplacementCodeuiColor3fVertex3fvSUN" );
-        glReplacementCodeuiColor4fNormal3fVertex3fSUN = (PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC) r3GetProcAddress( "glReplacementCodeuiColor4fNormal3fVertex3fSUN" );
-        glReplacementCodeuiColor4fNormal3fVertex3fvSUN = (PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC) r3GetProcAddress( "glReplacementCodeuiColor4fNormal3fVertex3fvSUN" );
-        glReplacementCodeuiColor4ubVertex3fSUN = (PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC) r3GetProcAddress( "glReplacementCodeuiColor4ubVertex3fSUN" );
-        glReplacementCodeuiColor4ubVertex3fvSUN = (PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC) r3GetProcAddress( "glReplacementCodeuiColor4ubVertex3fvSUN" );
-        glReplacementCodeuiNormal3fVertex3fSUN = (PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC) r3GetProcAddress( "glReplacementCodeuiNormal3fVertex3fSUN" );
-        glReplacementCodeuiNormal3fVertex3fvSUN = (PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC) r3GetProcAddress( "glReplacementCodeuiNormal3fVertex3fvSUN" );
-        glReplacementCodeuiSUN = (PFNGLREPLACEMENTCODEUISUNPROC) r3GetProcAddress( "glReplacementCodeuiSUN" );
-        glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC) r3GetProcAddress( "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN" );
-        glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC) r3GetProcAddress( "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN" );
-        glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC) r3GetProcAddress( "glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN" );
-        glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC) r3GetProcAddress( "glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN" );
-        glReplacementCodeuiTexCoord2fVertex3fSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC) r3GetProcAddress( "glReplacementCodeuiTexCoord2fVertex3fSUN" );
-        glReplacementCodeuiTexCoord2fVertex3fvSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC) r3GetProcAddress( "glReplacementCodeuiTexCoord2fVertex3fvSUN" );
-        glReplacementCodeuiVertex3fSUN = (PFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC) r3GetProcAddress( "glReplacementCodeuiVertex3fSUN" );
-        glReplacementCodeuiVertex3fvSUN = (PFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC) r3GetProcAddress( "glReplacementCodeuiVertex3fvSUN" );
-        glReplacementCodeuivSUN = (PFNGLREPLACEMENTCODEUIVSUNPROC) r3GetProcAddress( "glReplacementCodeuivSUN" );
-        glReplacementCodeusSUN = (PFNGLREPLACEMENTCODEUSSUNPROC) r3GetProcAddress( "glReplacementCodeusSUN" );
-        glReplacementCodeusvSUN = (PFNGLREPLACEMENTCODEUSVSUNPROC) r3GetProcAddress( "glReplacementCodeusvSUN" );
-        glRequestResidentProgramsNV = (PFNGLREQUESTRESIDENTPROGRAMSNVPROC) r3GetProcAddress( "glRequestResidentProgramsNV" );
-        glResetHistogram = (PFNGLRESETHISTOGRAMPROC) r3GetProcAddress( "glResetHistogram" );
-        glResetHistogramEXT = (PFNGLRESETHISTOGRAMEXTPROC) r3GetProcAddress( "glResetHistogramEXT" );
-        glResetMinmax = (PFNGLRESETMINMAXPROC) r3GetProcAddress( "glResetMinmax" );
-        glResetMinmaxEXT = (PFNGLRESETMINMAXEXTPROC) r3GetProcAddress( "glResetMinmaxEXT" );
-        glResizeBuffersMESA = (PFNGLRESIZEBUFFERSMESAPROC) r3GetProcAddress( "glResizeBuffersMESA" );
-        glResumeTransformFeedback = (PFNGLRESUMETRANSFORMFEEDBACKPROC) r3GetProcAddress( "glResumeTransformFeedback" );
-        glResumeTransformFeedbackNV = (PFNGLRESUMETRANSFORMFEEDBACKNVPROC) r3GetProcAddress( "glResumeTransformFeedbackNV" );
-        glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC) r3GetProcAddress( "glSampleCoverage" );
-        glSampleCoverageARB = (PFNGLSAMPLECOVERAGEARBPROC) r3GetProcAddress( "glSampleCoverageARB" );
-        glSampleMapATI = (PFNGLSAMPLEMAPATIPROC) r3GetProcAddress( "glSampleMapATI" );
-        glSampleMaskEXT = (PFNGLSAMPLEMASKEXTPROC) r3GetProcAddress( "glSampleMaskEXT" );
-        glSampleMaskIndexedNV = (PFNGLSAMPLEMASKINDEXEDNVPROC) r3GetProcAddress( "glSampleMaskIndexedNV" );
-        glSampleMaskSGIS = (PFNGLSAMPLEMASKSGISPROC) r3GetProcAddress( "glSampleMaskSGIS" );
-        glSampleMaski = (PFNGLSAMPLEMASKIPROC) r3GetProcAddress( "glSampleMaski" );
-        glSamplePatternEXT = (PFNGLSAMPLEPATTERNEXTPROC) r3GetProcAddress( "glSamplePatternEXT" );
-        glSamplePatternSGIS = (PFNGLSAMPLEPATTERNSGISPROC) r3GetProcAddress( "glSamplePatternSGIS" );
-        glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC) r3GetProcAddress( "glSamplerParameterIiv" );
-        glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC) r3GetProcAddress( "glSamplerParameterIuiv" );
-        glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC) r3GetProcAddress( "glSamplerParameterf" );
-        glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC) r3GetProcAddress( "glSamplerParameterfv" );
-        glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC) r3GetProcAddress( "glSamplerParameteri" );
-        glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC) r3GetProcAddress( "glSamplerParameteriv" );
-        glSecondaryColor3b = (PFNGLSECONDARYCOLOR3BPROC) r3GetProcAddress( "glSecondaryColor3b" );
-        glSecondaryColor3bEXT = (PFNGLSECONDARYCOLOR3BEXTPROC) r3GetProcAddress( "glSecondaryColor3bEXT" );
-        glSecondaryColor3bv = (PFNGLSECONDARYCOLOR3BVPROC) r3GetProcAddress( "glSecondaryColor3bv" );
-        glSecondaryColor3bvEXT = (PFNGLSECONDARYCOLOR3BVEXTPROC) r3GetProcAddress( "glSecondaryColor3bvEXT" );
-        glSecondaryColor3d = (PFNGLSECONDARYCOLOR3DPROC) r3GetProcAddress( "glSecondaryColor3d" );
-        glSecondaryColor3dEXT = (PFNGLSECONDARYCOLOR3DEXTPROC) r3GetProcAddress( "glSecondaryColor3dEXT" );
-        glSecondaryColor3dv = (PFNGLSECONDARYCOLOR3DVPROC) r3GetProcAddress( "glSecondaryColor3dv" );
-        glSecondaryColor3dvEXT = (PFNGLSECONDARYCOLOR3DVEXTPROC) r3GetProcAddress( "glSecondaryColor3dvEXT" );
-        glSecondaryColor3f = (PFNGLSECONDARYCOLOR3FPROC) r3GetProcAddress( "glSecondaryColor3f" );
-        glSecondaryColor3fEXT = (PFNGLSECONDARYCOLOR3FEXTPROC) r3GetProcAddress( "glSecondaryColor3fEXT" );
-        glSecondaryColor3fv = (PFNGLSECONDARYCOLOR3FVPROC) r3GetProcAddress( "glSecondaryColor3fv" );
-        glSecondaryColor3fvEXT = (PFNGLSECONDARYCOLOR3FVEXTPROC) r3GetProcAddress( "glSecondaryColor3fvEXT" );
-        glSecondaryColor3hNV = (PFNGLSECONDARYCOLOR3HNVPROC) r3GetProcAddress( "glSecondaryColor3hNV" );
-        glSecondaryColor3hvNV = (PFNGLSECONDARYCOLOR3HVNVPROC) r3GetProcAddress( "glSecondaryColor3hvNV" );
-        glSecondaryColor3i = (PFNGLSECONDARYCOLOR3IPROC) r3GetProcAddress( "glSecondaryColor3i" );
-        glSecondaryColor3iEXT = (PFNGLSECONDARYCOLOR3IEXTPROC) r3GetProcAddress( "glSecondaryColor3iEXT" );
-        glSecondaryColor3iv = (PFNGLSECONDARYCOLOR3IVPROC) r3GetProcAddress( "glSecondaryColor3iv" );
-        glSecondaryColor3ivEXT = (PFNGLSECONDARYCOLOR3IVEXTPROC) r3GetProcAddress( "glSecondaryColor3ivEXT" );
-        glSecondaryColor3s = (PFNGLSECONDARYCOLOR3SPROC) r3GetProcAddress( "glSecondaryColor3s" );
-        glSecondaryColor3sEXT = (PFNGLSECONDARYCOLOR3SEXTPROC) r3GetProcAddress( "glSecondaryColor3sEXT" );
-        glSecondaryColor3sv = (PFNGLSECONDARYCOLOR3SVPROC) r3GetProcAddress( "glSecondaryColor3sv" );
-        glSecondaryColor3svEXT = (PFNGLSECONDARYCOLOR3SVEXTPROC) r3GetProcAddress( "glSecondaryColor3svEXT" );
-        glSecondaryColor3ub = (PFNGLSECONDARYCOLOR3UBPROC) r3GetProcAddress( "glSecondaryColor3ub" );
-        glSecondaryColor3ubEXT = (PFNGLSECONDARYCOLOR3UBEXTPROC) r3GetProcAddress( "glSecondaryColor3ubEXT" );
-        glSecondaryColor3ubv = (PFNGLSECONDARYCOLOR3UBVPROC) r3GetProcAddress( "glSecondaryColor3ubv" );
-        glSecondaryColor3ubvEXT = (PFNGLSECONDARYCOLOR3UBVEXTPROC) r3GetProcAddress( "glSecondaryColor3ubvEXT" );
-        glSecondaryColor3ui = (PFNGLSECONDARYCOLOR3UIPROC) r3GetProcAddress( "glSecondaryColor3ui" );
-        glSecondaryColor3uiEXT = (PFNGLSECONDARYCOLOR3UIEXTPROC) r3GetProcAddress( "glSecondaryColor3uiEXT" );
-        glSecondaryColor3uiv = (PFNGLSECONDARYCOLOR3UIVPROC) r3GetProcAddress( "glSecondaryColor3uiv" );
-        glSecondaryColor3uivEXT = (PFNGLSECONDARYCOLOR3UIVEXTPROC) r3GetProcAddress( "glSecondaryColor3uivEXT" );
-        glSecondaryColor3us = (PFNGLSECONDARYCOLOR3USPROC) r3GetProcAddress( "glSecondaryColor3us" );
-        glSecondaryColor3usEXT = (PFNGLSECONDARYCOLOR3USEXTPROC) r3GetProcAddress( "glSecondaryColor3usEXT" );
-        glSecondaryColor3usv = (PFNGLSECONDARYCOLOR3USVPROC) r3GetProcAddress( "glSecondaryColor3usv" );
-        glSecondaryColor3usvEXT = (PFNGLSECONDARYCOLOR3USVEXTPROC) r3GetProcAddress( "glSecondaryColor3usvEXT" );
-        glSecondaryColorFormatNV = (PFNGLSECONDARYCOLORFORMATNVPROC) r3GetProcAddress( "glSecondaryColorFormatNV" );
-        glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC) r3GetProcAddress( "glSecondaryColorP3ui" );
-        glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC) r3GetProcAddress( "glSecondaryColorP3uiv" );
-        glSecondaryColorPointer = (PFNGLSECONDARYCOLORPOINTERPROC) r3GetProcAddress( "glSecondaryColorPointer" );
-        glSecondaryColorPointerEXT = (PFNGLSECONDARYCOLORPOINTEREXTPROC) r3GetProcAddress( "glSecondaryColorPointerEXT" );
-        glSecondaryColorPointerListIBM = (PFNGLSECONDARYCOLORPOINTERLISTIBMPROC) r3GetProcAddress( "glSecondaryColorPointerListIBM" );
-        glSelectPerfMonitorCountersAMD = (PFNGLSELECTPERFMONITORCOUNTERSAMDPROC) r3GetProcAddress( "glSelectPerfMonitorCountersAMD" );
-        glSeparableFilter2D = (PFNGLSEPARABLEFILTER2DPROC) r3GetProcAddress( "glSeparableFilter2D" );
-        glSeparableFilter2DEXT = (PFNGLSEPARABLEFILTER2DEXTPROC) r3GetProcAddress( "glSeparableFilter2DEXT" );
-        glSetFenceAPPLE = (PFNGLSETFENCEAPPLEPROC) r3GetProcAddress( "glSetFenceAPPLE" );
-        glSetFenceNV = (PFNGLSETFENCENVPROC) r3GetProcAddress( "glSetFenceNV" );
-        glSetFragmentShaderConstantATI = (PFNGLSETFRAGMENTSHADERCONSTANTATIPROC) r3GetProcAddress( "glSetFragmentShaderConstantATI" );
-        glSetInvariantEXT = (PFNGLSETINVARIANTEXTPROC) r3GetProcAddress( "glSetInvariantEXT" );
-        glSetLocalConstantEXT = (PFNGLSETLOCALCONSTANTEXTPROC) r3GetProcAddress( "glSetLocalConstantEXT" );
-        glShaderOp1EXT = (PFNGLSHADEROP1EXTPROC) r3GetProcAddress( "glShaderOp1EXT" );
-        glShaderOp2EXT = (PFNGLSHADEROP2EXTPROC) r3GetProcAddress( "glShaderOp2EXT" );
-        glShaderOp3EXT = (PFNGLSHADEROP3EXTPROC) r3GetProcAddress( "glShaderOp3EXT" );
-        glShaderSource = (PFNGLSHADERSOURCEPROC) r3GetProcAddress( "glShaderSource" );
-        glShaderSourceARB = (PFNGLSHADERSOURCEARBPROC) r3GetProcAddress( "glShaderSourceARB" );
-        glSharpenTexFuncSGIS = (PFNGLSHARPENTEXFUNCSGISPROC) r3GetProcAddress( "glSharpenTexFuncSGIS" );
-        glSpriteParameterfSGIX = (PFNGLSPRITEPARAMETERFSGIXPROC) r3GetProcAddress( "glSpriteParameterfSGIX" );
-        glSpriteParameterfvSGIX = (PFNGLSPRITEPARAMETERFVSGIXPROC) r3GetProcAddress( "glSpriteParameterfvSGIX" );
-        glSpriteParameteriSGIX = (PFNGLSPRITEPARAMETERISGIXPROC) r3GetProcAddress( "glSpriteParameteriSGIX" );
-        glSpriteParameterivSGIX = (PFNGLSPRITEPARAMETERIVSGIXPROC) r3GetProcAddress( "glSpriteParameterivSGIX" );
-        glStartInstrumentsSGIX = (PFNGLSTARTINSTRUMENTSSGIXPROC) r3GetProcAddress( "glStartInstrumentsSGIX" );
-        glStencilClearTagEXT = (PFNGLSTENCILCLEARTAGEXTPROC) r3GetProcAddress( "glStencilClearTagEXT" );
-        glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC) r3GetProcAddress( "glStencilFuncSeparate" );
-        glStencilFuncSeparateATI = (PFNGLSTENCILFUNCSEPARATEATIPROC) r3GetProcAddress( "glStencilFuncSeparateATI" );
-        glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC) r3GetProcAddress( "glStencilMaskSeparate" );
-        glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC) r3GetProcAddress( "glStencilOpSeparate" );
-        glStencilOpSeparateATI = (PFNGLSTENCILOPSEPARATEATIPROC) r3GetProcAddress( "glStencilOpSeparateATI" );
-        glStopInstrumentsSGIX = (PFNGLSTOPINSTRUMENTSSGIXPROC) r3GetProcAddress( "glStopInstrumentsSGIX" );
-        glStringMarkerGREMEDY = (PFNGLSTRINGMARKERGREMEDYPROC) r3GetProcAddress( "glStringMarkerGREMEDY" );
-        glSwizzleEXT = (PFNGLSWIZZLEEXTPROC) r3GetProcAddress( "glSwizzleEXT" );
-        glTagSampleBufferSGIX = (PFNGLTAGSAMPLEBUFFERSGIXPROC) r3GetProcAddress( "glTagSampleBufferSGIX" );
-        glTangent3bEXT = (PFNGLTANGENT3BEXTPROC) r3GetProcAddress( "glTangent3bEXT" );
-        glTangent3bvEXT = (PFNGLTANGENT3BVEXTPROC) r3GetProcAddress( "glTangent3bvEXT" );
-        glTangent3dEXT = (PFNGLTANGENT3DEXTPROC) r3GetProcAddress( "glTangent3dEXT" );
-        glTangent3dvEXT = (PFNGLTANGENT3DVEXTPROC) r3GetProcAddress( "glTangent3dvEXT" );
-        glTangent3fEXT = (PFNGLTANGENT3FEXTPROC) r3GetProcAddress( "glTangent3fEXT" );
-        glTangent3fvEXT = (PFNGLTANGENT3FVEXTPROC) r3GetProcAddress( "glTangent3fvEXT" );
-        glTangent3iEXT = (PFNGLTANGENT3IEXTPROC) r3GetProcAddress( "glTangent3iEXT" );
-        glTangent3ivEXT = (PFNGLTANGENT3IVEXTPROC) r3GetProcAddress( "glTangent3ivEXT" );
-        glTangent3sEXT = (PFNGLTANGENT3SEXTPROC) r3GetProcAddress( "glTangent3sEXT" );
-        glTangent3svEXT = (PFNGLTANGENT3SVEXTPROC) r3GetProcAddress( "glTangent3svEXT" );
-        glTangentPointerEXT = (PFNGLTANGENTPOINTEREXTPROC) r3GetProcAddress( "glTangentPointerEXT" );
-        glTbufferMask3DFX = (PFNGLTBUFFERMASK3DFXPROC) r3GetProcAddress( "glTbufferMask3DFX" );
-        glTessellationFactorAMD = (PFNGLTESSELLATIONFACTORAMDPROC) r3GetProcAddress( "glTessellationFactorAMD" );
-        glTessellationModeAMD = (PFNGLTESSELLATIONMODEAMDPROC) r3GetProcAddress( "glTessellationModeAMD" );
-        glTestFenceAPPLE = (PFNGLTESTFENCEAPPLEPROC) r3GetProcAddress( "glTestFenceAPPLE" );
-        glTestFenceNV = (PFNGLTESTFENCENVPROC) r3GetProcAddress( "glTestFenceNV" );
-        glTestObjectAPPLE = (PFNGLTESTOBJECTAPPLEPROC) r3GetProcAddress( "glTestObjectAPPLE" );
-        glTexBuffer = (PFNGLTEXBUFFERPROC) r3GetProcAddress( "glTexBuffer" );
-        glTexBufferARB = (PFNGLTEXBUFFERARBPROC) r3GetProcAddress( "glTexBufferARB" );
-        glTexBufferEXT = (PFNGLTEXBUFFEREXTPROC) r3GetProcAddress( "glTexBufferEXT" );
-        glTexBumpParameterfvATI = (PFNGLTEXBUMPPARAMETERFVATIPROC) r3GetProcAddress( "glTexBumpParameterfvATI" );
-        glTexBumpParameterivATI = (PFNGLTEXBUMPPARAMETERIVATIPROC) r3GetProcAddress( "glTexBumpParameterivATI" );
-        glTexCoord1hNV = (PFNGLTEXCOORD1HNVPROC) r3GetProcAddress( "glTexCoord1hNV" );
-        glTexCoord1hvNV = (PFNGLTEXCOORD1HVNVPROC) r3GetProcAddress( "glTexCoord1hvNV" );
-        glTexCoord2fColor3fVertex3fSUN = (PFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC) r3GetProcAddress( "glTexCoord2fColor3fVertex3fSUN" );
-        glTexCoord2fColor3fVertex3fvSUN = (PFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC) r3GetProcAddress( "glTexCoord2fColor3fVertex3fvSUN" );
-        glTexCoord2fColor4fNormal3fVertex3fSUN = (PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC) r3GetProcAddress( "glTexCoord2fColor4fNormal3fVertex3fSUN" );
-        glTexCoord2fColor4fNormal3fVertex3fvSUN = (PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC) r3GetProcAddress( "glTexCoord2fColor4fNormal3fVertex3fvSUN" );
-        glTexCoord2fColor4ubVertex3fSUN = (PFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC) r3GetProcAddress( "glTexCoord2fColor4ubVertex3fSUN" );
-        glTexCoord2fColor4ubVertex3fvSUN = (PFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC) r3GetProcAddress( "glTexCoord2fColor4ubVertex3fvSUN" );
-        glTexCoord2fNormal3fVertex3fSUN = (PFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC) r3GetProcAddress( "glTexCoord2fNormal3fVertex3fSUN" );
-        glTexCoord2fNormal3fVertex3fvSUN = (PFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC) r3GetProcAddress( "glTexCoord2fNormal3fVertex3fvSUN" );
-        glTexCoord2fVertex3fSUN = (PFNGLTEXCOORD2FVERTEX3FSUNPROC) r3GetProcAddress( "glTexCoord2fVertex3fSUN" );
-        glTexCoord2fVertex3fvSUN = (PFNGLTEXCOORD2FVERTEX3FVSUNPROC) r3GetProcAddress( "glTexCoord2fVertex3fvSUN" );
-        glTexCoord2hNV = (PFNGLTEXCOORD2HNVPROC) r3GetProcAddress( "glTexCoord2hNV" );
-        glTexCoord2hvNV = (PFNGLTEXCOORD2HVNVPROC) r3GetProcAddress( "glTexCoord2hvNV" );
-        glTexCoord3hNV = (PFNGLTEXCOORD3HNVPROC) r3GetProcAddress( "glTexCoord3hNV" );
-        glTexCoord3hvNV = (PFNGLTEXCOORD3HVNVPROC) r3GetProcAddress( "glTexCoord3hvNV" );
-        glTexCoord4fColor4fNormal3fVertex4fSUN = (PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC) r3GetProcAddress( "glTexCoord4fColor4fNormal3fVertex4fSUN" );
-        glTexCoord4fColor4fNormal3fVertex4fvSUN = (PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC) r3GetProcAddress( "glTexCoord4fColor4fNormal3fVertex4fvSUN" );
-        glTexCoord4fVertex4fSUN = (PFNGLTEXCOORD4FVERTEX4FSUNPROC) r3GetProcAddress( "glTexCoord4fVertex4fSUN" );
-        glTexCoord4fVertex4fvSUN = (PFNGLTEXCOORD4FVERTEX4FVSUNPROC) r3GetProcAddress( "glTexCoord4fVertex4fvSUN" );
-        glTexCoord4hNV = (PFNGLTEXCOORD4HNVPROC) r3GetProcAddress( "glTexCoord4hNV" );
-        glTexCoord4hvNV = (PFNGLTEXCOORD4HVNVPROC) r3GetProcAddress( "glTexCoord4hvNV" );
-        glTexCoordFormatNV = (PFNGLTEXCOORDFORMATNVPROC) r3GetProcAddress( "glTexCoordFormatNV" );
-        glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC) r3GetProcAddress( "glTexCoordP1ui" );
-        glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC) r3GetProcAddress( "glTexCoordP1uiv" );
-        glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC) r3GetProcAddress( "glTexCoordP2ui" );
-        glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC) r3GetProcAddress( "glTexCoordP2uiv" );
-        glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC) r3GetProcAddress( "glTexCoordP3ui" );
-        glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC) r3GetProcAddress( "glTexCoordP3uiv" );
-        glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC) r3GetProcAddress( "glTexCoordP4ui" );
-        glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC) r3GetProcAddress( "glTexCoordP4uiv" );
-        glTexCoordPointerEXT = (PFNGLTEXCOORDPOINTEREXTPROC) r3GetProcAddress( "glTexCoordPointerEXT" );
-        glTexCoordPointerListIBM = (PFNGLTEXCOORDPOINTERLISTIBMPROC) r3GetProcAddress( "glTexCoordPointerListIBM" );
-        glTexCoordPointervINTEL = (PFNGLTEXCOORDPOINTERVINTELPROC) r3GetProcAddress( "glTexCoordPointervINTEL" );
-        glTexFilterFuncSGIS = (PFNGLTEXFILTERFUNCSGISPROC) r3GetProcAddress( "glTexFilterFuncSGIS" );
-        glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC) r3GetProcAddress( "glTexImage2DMultisample" );
-        glTexImage3D = (PFNGLTEXIMAGE3DPROC) r3GetProcAddress( "glTexImage3D" );
-        glTexImage3DEXT = (PFNGLTEXIMAGE3DEXTPROC) r3GetProcAddress( "glTexImage3DEXT" );
-        glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC) r3GetProcAddress( "glTexImage3DMultisample" );
-        glTexImage4DSGIS = (PFNGLTEXIMAGE4DSGISPROC) r3GetProcAddress( "glTexImage4DSGIS" );
-        glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC) r3GetProcAddress( "glTexParameterIiv" );
-        glTexParameterIivEXT = (PFNGLTEXPARAMETERIIVEXTPROC) r3GetProcAddress( "glTexParameterIivEXT" );
-        glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC) r3GetProcAddress( "glTexParameterIuiv" );
-        glTexParameterIuivEXT = (PFNGLTEXPARAMETERIUIVEXTPROC) r3GetProcAddress( "glTexParameterIuivEXT" );
-        glTexRenderbufferNV = (PFNGLTEXRENDERBUFFERNVPROC) r3GetProcAddress( "glTexRenderbufferNV" );
-        glTexSubImage1DEXT = (PFNGLTEXSUBIMAGE1DEXTPROC) r3GetProcAddress( "glTexSubImage1DEXT" );
-        glTexSubImage2DEXT = (PFNGLTEXSUBIMAGE2DEXTPROC) r3GetProcAddress( "glTexSubImage2DEXT" );
-        glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC) r3GetProcAddress( "glTexSubImage3D" );
-        glTexSubImage3DEXT = (PFNGLTEXSUBIMAGE3DEXTPROC) r3GetProcAddress( "glTexSubImage3DEXT" );
-        glTexSubImage4DSGIS = (PFNGLTEXSUBIMAGE4DSGISPROC) r3GetProcAddress( "glTexSubImage4DSGIS" );
-        glTextureBarrierNV = (PFNGLTEXTUREBARRIERNVPROC) r3GetProcAddress( "glTextureBarrierNV" );
-        glTextureBufferEXT = (PFNGLTEXTUREBUFFEREXTPROC) r3GetProcAddress( "glTextureBufferEXT" );
-        glTextureColorMaskSGIS = (PFNGLTEXTURECOLORMASKSGISPROC) r3GetProcAddress( "glTextureColorMaskSGIS" );
-        glTextureImage1DEXT = (PFNGLTEXTUREIMAGE1DEXTPROC) r3GetProcAddress( "glTextureImage1DEXT" );
-        glTextureImage2DEXT = (PFNGLTEXTUREIMAGE2DEXTPROC) r3GetProcAddress( "glTextureImage2DEXT" );
-        glTextureImage3DEXT = (PFNGLTEXTUREIMAGE3DEXTPROC) r3GetProcAddress( "glTextureImage3DEXT" );
-        glTextureLightEXT = (PFNGLTEXTURELIGHTEXTPROC) r3GetProcAddress( "glTextureLightEXT" );
-        glTextureMaterialEXT = (PFNGLTEXTUREMATERIALEXTPROC) r3GetProcAddress( "glTextureMaterialEXT" );
-        glTextureNormalEXT = (PFNGLTEXTURENORMALEXTPROC) r3GetProcAddress( "glTextureNormalEXT" );
-        glTextureParameterIivEXT = (PFNGLTEXTUREPARAMETERIIVEXTPROC) r3GetProcAddress( "glTextureParameterIivEXT" );
-        glTextureParameterIuivEXT = (PFNGLTEXTUREPARAMETERIUIVEXTPROC) r3GetProcAddress( "glTextureParameterIuivEXT" );
-        glTextureParameterfEXT = (PFNGLTEXTUREPARAMETERFEXTPROC) r3GetProcAddress( "glTextureParameterfEXT" );
-        glTextureParameterfvEXT = (PFNGLTEXTUREPARAMETERFVEXTPROC) r3GetProcAddress( "glTextureParameterfvEXT" );
-        glTextureParameteriEXT = (PFNGLTEXTUREPARAMETERIEXTPROC) r3GetProcAddress( "glTextureParameteriEXT" );
-        glTextureParameterivEXT = (PFNGLTEXTUREPARAMETERIVEXTPROC) r3GetProcAddress( "glTextureParameterivEXT" );
-        glTextureRangeAPPLE = (PFNGLTEXTURERANGEAPPLEPROC) r3GetProcAddress( "glTextureRangeAPPLE" );
-        glTextureRenderbufferEXT = (PFNGLTEXTURERENDERBUFFEREXTPROC) r3GetProcAddress( "glTextureRenderbufferEXT" );
-        glTextureSubImage1DEXT = (PFNGLTEXTURESUBIMAGE1DEXTPROC) r3GetProcAddress( "glTextureSubImage1DEXT" );
-        glTextureSubImage2DEXT = (PFNGLTEXTURESUBIMAGE2DEXTPROC) r3GetProcAddress( "glTextureSubImage2DEXT" );
-        glTextureSubImage3DEXT = (PFNGLTEXTURESUBIMAGE3DEXTPROC) r3GetProcAddress( "glTextureSubImage3DEXT" );
-        glTrackMatrixNV = (PFNGLTRACKMATRIXNVPROC) r3GetProcAddress( "glTrackMatrixNV" );
-        glTransformFeedbackAttribsNV = (PFNGLTRANSFORMFEEDBACKATTRIBSNVPROC) r3GetProcAddress( "glTransformFeedbackAttribsNV" );
-        glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC) r3GetProcAddress( "glTransformFeedbackVaryings" );
-        glTransformFeedbackVaryingsEXT = (PFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC) r3GetProcAddress( "glTransformFeedbackVaryingsEXT" );
-        glTransformFeedbackVaryingsNV = (PFNGLTRANSFORMFEEDBACKVARYINGSNVPROC) r3GetProcAddress( "glTransformFeedbackVaryingsNV" );
-        glUniform1d = (PFNGLUNIFORM1DPROC) r3GetProcAddress( "glUniform1d" );
-        glUniform1dv = (PFNGLUNIFORM1DVPROC) r3GetProcAddress( "glUniform1dv" );
-        glUniform1f = (PFNGLUNIFORM1FPROC) r3GetProcAddress( "glUniform1f" );
-        glUniform1fARB = (PFNGLUNIFORM1FARBPROC) r3GetProcAddress( "glUniform1fARB" );
-        glUniform1fv = (PFNGLUNIFORM1FVPROC) r3GetProcAddress( "glUniform1fv" );
-        glUniform1fvARB = (PFNGLUNIFORM1FVARBPROC) r3GetProcAddress( "glUniform1fvARB" );
-        glUniform1i = (PFNGLUNIFORM1IPROC) r3GetProcAddress( "glUniform1i" );
-        glUniform1iARB = (PFNGLUNIFORM1IARBPROC) r3GetProcAddress( "glUniform1iARB" );
-        glUniform1iv = (PFNGLUNIFORM1IVPROC) r3GetProcAddress( "glUniform1iv" );
-        glUniform1ivARB = (PFNGLUNIFORM1IVARBPROC) r3GetProcAddress( "glUniform1ivARB" );
-        glUniform1ui = (PFNGLUNIFORM1UIPROC) r3GetProcAddress( "glUniform1ui" );
-        glUniform1uiEXT = (PFNGLUNIFORM1UIEXTPROC) r3GetProcAddress( "glUniform1uiEXT" );
-        glUniform1uiv = (PFNGLUNIFORM1UIVPROC) r3GetProcAddress( "glUniform1uiv" );
-        glUniform1uivEXT = (PFNGLUNIFORM1UIVEXTPROC) r3GetProcAddress( "glUniform1uivEXT" );
-        glUniform2d = (PFNGLUNIFORM2DPROC) r3GetProcAddress( "glUniform2d" );
-        glUniform2dv = (PFNGLUNIFORM2DVPROC) r3GetProcAddress( "glUniform2dv" );
-        glUniform2f = (PFNGLUNIFORM2FPROC) r3GetProcAddress( "glUniform2f" );
-        glUniform2fARB = (PFNGLUNIFORM2FARBPROC) r3GetProcAddress( "glUniform2fARB" );
-        glUniform2fv = (PFNGLUNIFORM2FVPROC) r3GetProcAddress( "glUniform2fv" );
-        glUniform2fvARB = (PFNGLUNIFORM2FVARBPROC) r3GetProcAddress( "glUniform2fvARB" );
-        glUniform2i = (PFNGLUNIFORM2IPROC) r3GetProcAddress( "glUniform2i" );
-        glUniform2iARB = (PFNGLUNIFORM2IARBPROC) r3GetProcAddress( "glUniform2iARB" );
-        glUniform2iv = (PFNGLUNIFORM2IVPROC) r3GetProcAddress( "glUniform2iv" );
-        glUniform2ivARB = (PFNGLUNIFORM2IVARBPROC) r3GetProcAddress( "glUniform2ivARB" );
-        glUniform2ui = (PFNGLUNIFORM2UIPROC) r3GetProcAddress( "glUniform2ui" );
-        glUniform2uiEXT = (PFNGLUNIFORM2UIEXTPROC) r3GetProcAddress( "glUniform2uiEXT" );
-        glUniform2uiv = (PFNGLUNIFORM2UIVPROC) r3GetProcAddress( "glUniform2uiv" );
-        glUniform2uivEXT = (PFNGLUNIFORM2UIVEXTPROC) r3GetProcAddress( "glUniform2uivEXT" );
-        glUniform3d = (PFNGLUNIFORM3DPROC) r3GetProcAddress( "glUniform3d" );
-        glUniform3dv = (PFNGLUNIFORM3DVPROC) r3GetProcAddress( "glUniform3dv" );
-        glUniform3f = (PFNGLUNIFORM3FPROC) r3GetProcAddress( "glUniform3f" );
-        glUniform3fARB = (PFNGLUNIFORM3FARBPROC) r3GetProcAddress( "glUniform3fARB" );
-        glUniform3fv = (PFNGLUNIFORM3FVPROC) r3GetProcAddress( "glUniform3fv" );
-        glUniform3fvARB = (PFNGLUNIFORM3FVARBPROC) r3GetProcAddress( "glUniform3fvARB" );
-        glUniform3i = (PFNGLUNIFORM3IPROC) r3GetProcAddress( "glUniform3i" );
-        glUniform3iARB = (PFNGLUNIFORM3IARBPROC) r3GetProcAddress( "glUniform3iARB" );
-        glUniform3iv = (PFNGLUNIFORM3IVPROC) r3GetProcAddress( "glUniform3iv" );
-        glUniform3ivARB = (PFNGLUNIFORM3IVARBPROC) r3GetProcAddress( "glUniform3ivARB" );
-        glUniform3ui = (PFNGLUNIFORM3UIPROC) r3GetProcAddress( "glUniform3ui" );
-        glUniform3uiEXT = (PFNGLUNIFORM3UIEXTPROC) r3GetProcAddress( "glUniform3uiEXT" );
-        glUniform3uiv = (PFNGLUNIFORM3UIVPROC) r3GetProcAddress( "glUniform3uiv" );
-        glUniform3uivEXT = (PFNGLUNIFORM3UIVEXTPROC) r3GetProcAddress( "glUniform3uivEXT" );
-        glUniform4d = (PFNGLUNIFORM4DPROC) r3GetProcAddress( "glUniform4d" );
-        glUniform4dv = (PFNGLUNIFORM4DVPROC) r3GetProcAddress( "glUniform4dv" );
-        glUniform4f = (PFNGLUNIFORM4FPROC) r3GetProcAddress( "glUniform4f" );
-        glUniform4fARB = (PFNGLUNIFORM4FARBPROC) r3GetProcAddress( "glUniform4fARB" );
-        glUniform4fv = (PFNGLUNIFORM4FVPROC) r3GetProcAddress( "glUniform4fv" );
-        glUniform4fvARB = (PFNGLUNIFORM4FVARBPROC) r3GetProcAddress( "glUniform4fvARB" );
-        glUniform4i = (PFNGLUNIFORM4IPROC) r3GetProcAddress( "glUniform4i" );
-        glUniform4iARB = (PFNGLUNIFORM4IARBPROC) r3GetProcAddress( "glUniform4iARB" );
-        glUniform4iv = (PFNGLUNIFORM4IVPROC) r3GetProcAddress( "glUniform4iv" );
-        glUniform4ivARB = (PFNGLUNIFORM4IVARBPROC) r3GetProcAddress( "glUniform4ivARB" );
-        glUniform4ui = (PFNGLUNIFORM4UIPROC) r3GetProcAddress( "glUniform4ui" );
-        glUniform4uiEXT = (PFNGLUNIFORM4UIEXTPROC) r3GetProcAddress( "glUniform4uiEXT" );
-        glUniform4uiv = (PFNGLUNIFORM4UIVPROC) r3GetProcAddress( "glUniform4uiv" );
-        glUniform4uivEXT = (PFNGLUNIFORM4UIVEXTPROC) r3GetProcAddress( "glUniform4uivEXT" );
-        glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC) r3GetProcAddress( "glUniformBlockBinding" );
-        glUniformBufferEXT = (PFNGLUNIFORMBUFFEREXTPROC) r3GetProcAddress( "glUniformBufferEXT" );
-        glUniformMatrix2dv = (PFNGLUNIFORMMATRIX2DVPROC) r3GetProcAddress( "glUniformMatrix2dv" );
-        glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC) r3GetProcAddress( "glUniformMatrix2fv" );
-        glUniformMatrix2fvARB = (PFNGLUNIFORMMATRIX2FVARBPROC) r3GetProcAddress( "glUniformMatrix2fvARB" );
-        glUniformMatrix2x3dv = (PFNGLUNIFORMMATRIX2X3DVPROC) r3GetProcAddress( "glUniformMatrix2x3dv" );
-        glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC) r3GetProcAddress( "glUniformMatrix2x3fv" );
-        glUniformMatrix2x4dv = (PFNGLUNIFORMMATRIX2X4DVPROC) r3GetProcAddress( "glUniformMatrix2x4dv" );
-        glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC) r3GetProcAddress( "glUniformMatrix2x4fv" );
-        glUniformMatrix3dv = (PFNGLUNIFORMMATRIX3DVPROC) r3GetProcAddress( "glUniformMatrix3dv" );
-        glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC) r3GetProcAddress( "glUniformMatrix3fv" );
-        glUniformMatrix3fvARB = (PFNGLUNIFORMMATRIX3FVARBPROC) r3GetProcAddress( "glUniformMatrix3fvARB" );
-        glUniformMatrix3x2dv = (PFNGLUNIFORMMATRIX3X2DVPROC) r3GetProcAddress( "glUniformMatrix3x2dv" );
-        glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC) r3GetProcAddress( "glUniformMatrix3x2fv" );
-        glUniformMatrix3x4dv = (PFNGLUNIFORMMATRIX3X4DVPROC) r3GetProcAddress( "glUniformMatrix3x4dv" );
-        glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC) r3GetProcAddress( "glUniformMatrix3x4fv" );
-        glUniformMatrix4dv = (PFNGLUNIFORMMATRIX4DVPROC) r3GetProcAddress( "glUniformMatrix4dv" );
-        glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC) r3GetProcAddress( "glUniformMatrix4fv" );
-        glUniformMatrix4fvARB = (PFNGLUNIFORMMATRIX4FVARBPROC) r3GetProcAddress( "glUniformMatrix4fvARB" );
-        glUniformMatrix4x2dv = (PFNGLUNIFORMMATRIX4X2DVPROC) r3GetProcAddress( "glUniformMatrix4x2dv" );
-        glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC) r3GetProcAddress( "glUniformMatrix4x2fv" );
-        glUniformMatrix4x3dv = (PFNGLUNIFORMMATRIX4X3DVPROC) r3GetProcAddress( "glUniformMatrix4x3dv" );
-        glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC) r3GetProcAddress( "glUniformMatrix4x3fv" );
-        glUniformSubroutinesuiv = (PFNGLUNIFORMSUBROUTINESUIVPROC) r3GetProcAddress( "glUniformSubroutinesuiv" );
-        glUniformui64NV = (PFNGLUNIFORMUI64NVPROC) r3GetProcAddress( "glUniformui64NV" );
-        glUniformui64vNV = (PFNGLUNIFORMUI64VNVPROC) r3GetProcAddress( "glUniformui64vNV" );
-        glUnlockArraysEXT = (PFNGLUNLOCKARRAYSEXTPROC) r3GetProcAddress( "glUnlockArraysEXT" );
-        glUnmapBuffer = (PFNGLUNMAPBUFFERPROC) r3GetProcAddress( "glUnmapBuffer" );
-        glUnmapBufferARB = (PFNGLUNMAPBUFFERARBPROC) r3GetProcAddress( "glUnmapBufferARB" );
-        glUnmapNamedBufferEXT = (PFNGLUNMAPNAMEDBUFFEREXTPROC) r3GetProcAddress( "glUnmapNamedBufferEXT" );
-        glUnmapObjectBufferATI = (PFNGLUNMAPOBJECTBUFFERATIPROC) r3GetProcAddress( "glUnmapObjectBufferATI" );
-        glUpdateObjectBufferATI = (PFNGLUPDATEOBJECTBUFFERATIPROC) r3GetProcAddress( "glUpdateObjectBufferATI" );
-        glUseProgram = (PFNGLUSEPROGRAMPROC) r3GetProcAddress( "glUseProgram" );
-        glUseProgramObjectARB = (PFNGLUSEPROGRAMOBJECTARBPROC) r3GetProcAddress( "glUseProgramObjectARB" );
-        glUseShaderProgramEXT = (PFNGLUSESHADERPROGRAMEXTPROC) r3GetProcAddress( "glUseShaderProgramEXT" );
-        glValidateProgram = (PFNGLVALIDATEPROGRAMPROC) r3GetProcAddress( "glValidateProgram" );
-        glValidateProgramARB = (PFNGLVALIDATEPROGRAMARBPROC) r3GetProcAddress( "glValidateProgramARB" );
-        glVariantArrayObjectATI = (PFNGLVARIANTARRAYOBJECTATIPROC) r3GetProcAddress( "glVariantArrayObjectATI" );
-        glVariantPointerEXT = (PFNGLVARIANTPOINTEREXTPROC) r3GetProcAddress( "glVariantPointerEXT" );
-        glVariantbvEXT = (PFNGLVARIANTBVEXTPROC) r3GetProcAddress( "glVariantbvEXT" );
-        glVariantdvEXT = (PFNGLVARIANTDVEXTPROC) r3GetProcAddress( "glVariantdvEXT" );
-        glVariantfvEXT = (PFNGLVARIANTFVEXTPROC) r3GetProcAddress( "glVariantfvEXT" );
-        glVariantivEXT = (PFNGLVARIANTIVEXTPROC) r3GetProcAddress( "glVariantivEXT" );
-        glVariantsvEXT = (PFNGLVARIANTSVEXTPROC) r3GetProcAddress( "glVariantsvEXT" );
-        glVariantubvEXT = (PFNGLVARIANTUBVEXTPROC) r3GetProcAddress( "glVariantubvEXT" );
-        glVariantuivEXT = (PFNGLVARIANTUIVEXTPROC) r3GetProcAddress( "glVariantuivEXT" );
-        glVariantusvEXT = (PFNGLVARIANTUSVEXTPROC) r3GetProcAddress( "glVariantusvEXT" );
-        glVertex2hNV = (PFNGLVERTEX2HNVPROC) r3GetProcAddress( "glVertex2hNV" );
-        glVertex2hvNV = (PFNGLVERTEX2HVNVPROC) r3GetProcAddress( "glVertex2hvNV" );
-        glVertex3hNV = (PFNGLVERTEX3HNVPROC) r3GetProcAddress( "glVertex3hNV" );
-        glVertex3hvNV = (PFNGLVERTEX3HVNVPROC) r3GetProcAddress( "glVertex3hvNV" );
-        glVertex4hNV = (PFNGLVERTEX4HNVPROC) r3GetProcAddress( "glVertex4hNV" );
-        glVertex4hvNV = (PFNGLVERTEX4HVNVPROC) r3GetProcAddress( "glVertex4hvNV" );
-        glVertexArrayParameteriAPPLE = (PFNGLVERTEXARRAYPARAMETERIAPPLEPROC) r3GetProcAddress( "glVertexArrayParameteriAPPLE" );
-        glVertexArrayRangeAPPLE = (PFNGLVERTEXARRAYRANGEAPPLEPROC) r3GetProcAddress( "glVertexArrayRangeAPPLE" );
-        glVertexArrayRangeNV = (PFNGLVERTEXARRAYRANGENVPROC) r3GetProcAddress( "glVertexArrayRangeNV" );
-        glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC) r3GetProcAddress( "glVertexAttrib1d" );
-        glVertexAttrib1dARB = (PFNGLVERTEXATTRIB1DARBPROC) r3GetProcAddress( "glVertexAttrib1dARB" );
-        glVertexAttrib1dNV = (PFNGLVERTEXATTRIB1DNVPROC) r3GetProcAddress( "glVertexAttrib1dNV" );
-        glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC) r3GetProcAddress( "glVertexAttrib1dv" );
-        glVertexAttrib1dvARB = (PFNGLVERTEXATTRIB1DVARBPROC) r3GetProcAddress( "glVertexAttrib1dvARB" );
-        glVertexAttrib1dvNV = (PFNGLVERTEXATTRIB1DVNVPROC) r3GetProcAddress( "glVertexAttrib1dvNV" );
-        glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC) r3GetProcAddress( "glVertexAttrib1f" );
-        glVertexAttrib1fARB = (PFNGLVERTEXATTRIB1FARBPROC) r3GetProcAddress( "glVertexAttrib1fARB" );
-        glVertexAttrib1fNV = (PFNGLVERTEXATTRIB1FNVPROC) r3GetProcAddress( "glVertexAttrib1fNV" );
-        glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC) r3GetProcAddress( "glVertexAttrib1fv" );
-        glVertexAttrib1fvARB = (PFNGLVERTEXATTRIB1FVARBPROC) r3GetProcAddress( "glVertexAttrib1fvARB" );
-        glVertexAttrib1fvNV = (PFNGLVERTEXATTRIB1FVNVPROC) r3GetProcAddress( "glVertexAttrib1fvNV" );
-        glVertexAttrib1hNV = (PFNGLVERTEXATTRIB1HNVPROC) r3GetProcAddress( "glVertexAttrib1hNV" );
-        glVertexAttrib1hvNV = (PFNGLVERTEXATTRIB1HVNVPROC) r3GetProcAddress( "glVertexAttrib1hvNV" );
-        glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC) r3GetProcAddress( "glVertexAttrib1s" );
-        glVertexAttrib1sARB = (PFNGLVERTEXATTRIB1SARBPROC) r3GetProcAddress( "glVertexAttrib1sARB" );
-        glVertexAttrib1sNV = (PFNGLVERTEXATTRIB1SNVPROC) r3GetProcAddress( "glVertexAttrib1sNV" );
-        glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC) r3GetProcAddress( "glVertexAttrib1sv" );
-        glVertexAttrib1svARB = (PFNGLVERTEXATTRIB1SVARBPROC) r3GetProcAddress( "glVertexAttrib1svARB" );
-        glVertexAttrib1svNV = (PFNGLVERTEXATTRIB1SVNVPROC) r3GetProcAddress( "glVertexAttrib1svNV" );
-        glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC) r3GetProcAddress( "glVertexAttrib2d" );
-        glVertexAttrib2dARB = (PFNGLVERTEXATTRIB2DARBPROC) r3GetProcAddress( "glVertexAttrib2dARB" );
-        glVertexAttrib2dNV = (PFNGLVERTEXATTRIB2DNVPROC) r3GetProcAddress( "glVertexAttrib2dNV" );
-        glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC) r3GetProcAddress( "glVertexAttrib2dv" );
-        glVertexAttrib2dvARB = (PFNGLVERTEXATTRIB2DVARBPROC) r3GetProcAddress( "glVertexAttrib2dvARB" );
-        glVertexAttrib2dvNV = (PFNGLVERTEXATTRIB2DVNVPROC) r3GetProcAddress( "glVertexAttrib2dvNV" );
-        glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC) r3GetProcAddress( "glVertexAttrib2f" );
-        glVertexAttrib2fARB = (PFNGLVERTEXATTRIB2FARBPROC) r3GetProcAddress( "glVertexAttrib2fARB" );
-        glVertexAttrib2fNV = (PFNGLVERTEXATTRIB2FNVPROC) r3GetProcAddress( "glVertexAttrib2fNV" );
-        glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC) r3GetProcAddress( "glVertexAttrib2fv" );
-        glVertexAttrib2fvARB = (PFNGLVERTEXATTRIB2FVARBPROC) r3GetProcAddress( "glVertexAttrib2fvARB" );
-        glVertexAttrib2fvNV = (PFNGLVERTEXATTRIB2FVNVPROC) r3GetProcAddress( "glVertexAttrib2fvNV" );
-        glVertexAttrib2hNV = (PFNGLVERTEXATTRIB2HNVPROC) r3GetProcAddress( "glVertexAttrib2hNV" );
-        glVertexAttrib2hvNV = (PFNGLVERTEXATTRIB2HVNVPROC) r3GetProcAddress( "glVertexAttrib2hvNV" );
-        glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC) r3GetProcAddress( "glVertexAttrib2s" );
-        glVertexAttrib2sARB = (PFNGLVERTEXATTRIB2SARBPROC) r3GetProcAddress( "glVertexAttrib2sARB" );
-        glVertexAttrib2sNV = (PFNGLVERTEXATTRIB2SNVPROC) r3GetProcAddress( "glVertexAttrib2sNV" );
-        glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC) r3GetProcAddress( "glVertexAttrib2sv" );
-        glVertexAttrib2svARB = (PFNGLVERTEXATTRIB2SVARBPROC) r3GetProcAddress( "glVertexAttrib2svARB" );
-        glVertexAttrib2svNV = (PFNGLVERTEXATTRIB2SVNVPROC) r3GetProcAddress( "glVertexAttrib2svNV" );
-        glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC) r3GetProcAddress( "glVertexAttrib3d" );
-        glVertexAttrib3dARB = (PFNGLVERTEXATTRIB3DARBPROC) r3GetProcAddress( "glVertexAttrib3dARB" );
-        glVertexAttrib3dNV = (PFNGLVERTEXATTRIB3DNVPROC) r3GetProcAddress( "glVertexAttrib3dNV" );
-        glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC) r3GetProcAddress( "glVertexAttrib3dv" );
-        glVertexAttrib3dvARB = (PFNGLVERTEXATTRIB3DVARBPROC) r3GetProcAddress( "glVertexAttrib3dvARB" );
-        glVertexAttrib3dvNV = (PFNGLVERTEXATTRIB3DVNVPROC) r3GetProcAddress( "glVertexAttrib3dvNV" );
-        glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC) r3GetProcAddress( "glVertexAttrib3f" );
-        glVertexAttrib3fARB = (PFNGLVERTEXATTRIB3FARBPROC) r3GetProcAddress( "glVertexAttrib3fARB" );
-        glVertexAttrib3fNV = (PFNGLVERTEXATTRIB3FNVPROC) r3GetProcAddress( "glVertexAttrib3fNV" );
-        glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC) r3GetProcAddress( "glVertexAttrib3fv" );
-        glVertexAttrib3fvARB = (PFNGLVERTEXATTRIB3FVARBPROC) r3GetProcAddress( "glVertexAttrib3fvARB" );
-        glVertexAttrib3fvNV = (PFNGLVERTEXATTRIB3FVNVPROC) r3GetProcAddress( "glVertexAttrib3fvNV" );
-        glVertexAttrib3hNV = (PFNGLVERTEXATTRIB3HNVPROC) r3GetProcAddress( "glVertexAttrib3hNV" );
-        glVertexAttrib3hvNV = (PFNGLVERTEXATTRIB3HVNVPROC) r3GetProcAddress( "glVertexAttrib3hvNV" );
-        glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC) r3GetProcAddress( "glVertexAttrib3s" );
-        glVertexAttrib3sARB = (PFNGLVERTEXATTRIB3SARBPROC) r3GetProcAddress( "glVertexAttrib3sARB" );
-        glVertexAttrib3sNV = (PFNGLVERTEXATTRIB3SNVPROC) r3GetProcAddress( "glVertexAttrib3sNV" );
-        glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC) r3GetProcAddress( "glVertexAttrib3sv" );
-        glVertexAttrib3svARB = (PFNGLVERTEXATTRIB3SVARBPROC) r3GetProcAddress( "glVertexAttrib3svARB" );
-        glVertexAttrib3svNV = (PFNGLVERTEXATTRIB3SVNVPROC) r3GetProcAddress( "glVertexAttrib3svNV" );
-        glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC) r3GetProcAddress( "glVertexAttrib4Nbv" );
-        glVertexAttrib4NbvARB = (PFNGLVERTEXATTRIB4NBVARBPROC) r3GetProcAddress( "glVertexAttrib4NbvARB" );
-        glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC) r3GetProcAddress( "glVertexAttrib4Niv" );
-        glVertexAttrib4NivARB = (PFNGLVERTEXATTRIB4NIVARBPROC) r3GetProcAddress( "glVertexAttrib4NivARB" );
-        glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC) r3GetProcAddress( "glVertexAttrib4Nsv" );
-        glVertexAttrib4NsvARB = (PFNGLVERTEXATTRIB4NSVARBPROC) r3GetProcAddress( "glVertexAttrib4NsvARB" );
-        glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC) r3GetProcAddress( "glVertexAttrib4Nub" );
-        glVertexAttrib4NubARB = (PFNGLVERTEXATTRIB4NUBARBPROC) r3GetProcAddress( "glVertexAttrib4NubARB" );
-        glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC) r3GetProcAddress( "glVertexAttrib4Nubv" );
-        glVertexAttrib4NubvARB = (PFNGLVERTEXATTRIB4NUBVARBPROC) r3GetProcAddress( "glVertexAttrib4NubvARB" );
-        glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC) r3GetProcAddress( "glVertexAttrib4Nuiv" );
-        glVertexAttrib4NuivARB = (PFNGLVERTEXATTRIB4NUIVARBPROC) r3GetProcAddress( "glVertexAttrib4NuivARB" );
-        glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC) r3GetProcAddress( "glVertexAttrib4Nusv" );
-        glVertexAttrib4NusvARB = (PFNGLVERTEXATTRIB4NUSVARBPROC) r3GetProcAddress( "glVertexAttrib4NusvARB" );
-        glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC) r3GetProcAddress( "glVertexAttrib4bv" );
-        glVertexAttrib4bvARB = (PFNGLVERTEXATTRIB4BVARBPROC) r3GetProcAddress( "glVertexAttrib4bvARB" );
-        glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC) r3GetProcAddress( "glVertexAttrib4d" );
-        glVertexAttrib4dARB = (PFNGLVERTEXATTRIB4DARBPROC) r3GetProcAddress( "glVertexAttrib4dARB" );
-        glVertexAttrib4dNV = (PFNGLVERTEXATTRIB4DNVPROC) r3GetProcAddress( "glVertexAttrib4dNV" );
-        glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC) r3GetProcAddress( "glVertexAttrib4dv" );
-        glVertexAttrib4dvARB = (PFNGLVERTEXATTRIB4DVARBPROC) r3GetProcAddress( "glVertexAttrib4dvARB" );
-        glVertexAttrib4dvNV = (PFNGLVERTEXATTRIB4DVNVPROC) r3GetProcAddress( "glVertexAttrib4dvNV" );
-        glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC) r3GetProcAddress( "glVertexAttrib4f" );
-        glVertexAttrib4fARB = (PFNGLVERTEXATTRIB4FARBPROC) r3GetProcAddress( "glVertexAttrib4fARB" );
-        glVertexAttrib4fNV = (PFNGLVERTEXATTRIB4FNVPROC) r3GetProcAddress( "glVertexAttrib4fNV" );
-        glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC) r3GetProcAddress( "glVertexAttrib4fv" );
-        glVertexAttrib4fvARB = (PFNGLVERTEXATTRIB4FVARBPROC) r3GetProcAddress( "glVertexAttrib4fvARB" );
-        glVertexAttrib4fvNV = (PFNGLVERTEXATTRIB4FVNVPROC) r3GetProcAddress( "glVertexAttrib4fvNV" );
-        glVertexAttrib4hNV = (PFNGLVERTEXATTRIB4HNVPROC) r3GetProcAddress( "glVertexAttrib4hNV" );
-        glVertexAttrib4hvNV = (PFNGLVERTEXATTRIB4HVNVPROC) r3GetProcAddress( "glVertexAttrib4hvNV" );
-        glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC) r3GetProcAddress( "glVertexAttrib4iv" );
-        glVertexAttrib4ivARB = (PFNGLVERTEXATTRIB4IVARBPROC) r3GetProcAddress( "glVertexAttrib4ivARB" );
-        glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC) r3GetProcAddress( "glVertexAttrib4s" );
-        glVertexAttrib4sARB = (PFNGLVERTEXATTRIB4SARBPROC) r3GetProcAddress( "glVertexAttrib4sARB" );
-        glVertexAttrib4sNV = (PFNGLVERTEXATTRIB4SNVPROC) r3GetProcAddress( "glVertexAttrib4sNV" );
-        glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC) r3GetProcAddress( "glVertexAttrib4sv" );
-        glVertexAttrib4svARB = (PFNGLVERTEXATTRIB4SVARBPROC) r3GetProcAddress( "glVertexAttrib4svARB" );
-        glVertexAttrib4svNV = (PFNGLVERTEXATTRIB4SVNVPROC) r3GetProcAddress( "glVertexAttrib4svNV" );
-        glVertexAttrib4ubNV = (PFNGLVERTEXATTRIB4UBNVPROC) r3GetProcAddress( "glVertexAttrib4ubNV" );
-        glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC) r3GetProcAddress( "glVertexAttrib4ubv" );
-        glVertexAttrib4ubvARB = (PFNGLVERTEXATTRIB4UBVARBPROC) r3GetProcAddress( "glVertexAttrib4ubvARB" );
-        glVertexAttrib4ubvNV = (PFNGLVERTEXATTRIB4UBVNVPROC) r3GetProcAddress( "glVertexAttrib4ubvNV" );
-        glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC) r3GetProcAddress( "glVertexAttrib4uiv" );
-        glVertexAttrib4uivARB = (PFNGLVERTEXATTRIB4UIVARBPROC) r3GetProcAddress( "glVertexAttrib4uivARB" );
-        glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC) r3GetProcAddress( "glVertexAttrib4usv" );
-        glVertexAttrib4usvARB = (PFNGLVERTEXATTRIB4USVARBPROC) r3GetProcAddress( "glVertexAttrib4usvARB" );
-        glVertexAttribArrayObjectATI = (PFNGLVERTEXATTRIBARRAYOBJECTATIPROC) r3GetProcAddress( "glVertexAttribArrayObjectATI" );
-        glVertexAttribDivisorARB = (PFNGLVERTEXATTRIBDIVISORARBPROC) r3GetProcAddress( "glVertexAttribDivisorARB" );
-        glVertexAttribFormatNV = (PFNGLVERTEXATTRIBFORMATNVPROC) r3GetProcAddress( "glVertexAttribFormatNV" );
-        glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC) r3GetProcAddress( "glVertexAttribI1i" );
-        glVertexAttribI1iEXT = (PFNGLVERTEXATTRIBI1IEXTPROC) r3GetProcAddress( "glVertexAttribI1iEXT" );
-        glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC) r3GetProcAddress( "glVertexAttribI1iv" );
-        glVertexAttribI1ivEXT = (PFNGLVERTEXATTRIBI1IVEXTPROC) r3GetProcAddress( "glVertexAttribI1ivEXT" );
-        glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC) r3GetProcAddress( "glVertexAttribI1ui" );
-        glVertexAttribI1uiEXT = (PFNGLVERTEXATTRIBI1UIEXTPROC) r3GetProcAddress( "glVertexAttribI1uiEXT" );
-        glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC) r3GetProcAddress( "glVertexAttribI1uiv" );
-        glVertexAttribI1uivEXT = (PFNGLVERTEXATTRIBI1UIVEXTPROC) r3GetProcAddress( "glVertexAttribI1uivEXT" );
-        glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC) r3GetProcAddress( "glVertexAttribI2i" );
-        glVertexAttribI2iEXT = (PFNGLVERTEXATTRIBI2IEXTPROC) r3GetProcAddress( "glVertexAttribI2iEXT" );
-        glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC) r3GetProcAddress( "glVertexAttribI2iv" );
-        glVertexAttribI2ivEXT = (PFNGLVERTEXATTRIBI2IVEXTPROC) r3GetProcAddress( "glVertexAttribI2ivEXT" );
-        glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC) r3GetProcAddress( "glVertexAttribI2ui" );
-        glVertexAttribI2uiEXT = (PFNGLVERTEXATTRIBI2UIEXTPROC) r3GetProcAddress( "glVertexAttribI2uiEXT" );
-        glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC) r3GetProcAddress( "glVertexAttribI2uiv" );
-        glVertexAttribI2uivEXT = (PFNGLVERTEXATTRIBI2UIVEXTPROC) r3GetProcAddress( "glVertexAttribI2uivEXT" );
-        glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC) r3GetProcAddress( "glVertexAttribI3i" );
-        glVertexAttribI3iEXT = (PFNGLVERTEXATTRIBI3IEXTPROC) r3GetProcAddress( "glVertexAttribI3iEXT" );
-        glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC) r3GetProcAddress( "glVertexAttribI3iv" );
-        glVertexAttribI3ivEXT = (PFNGLVERTEXATTRIBI3IVEXTPROC) r3GetProcAddress( "glVertexAttribI3ivEXT" );
-        glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC) r3GetProcAddress( "glVertexAttribI3ui" );
-        glVertexAttribI3uiEXT = (PFNGLVERTEXATTRIBI3UIEXTPROC) r3GetProcAddress( "glVertexAttribI3uiEXT" );
-        glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC) r3GetProcAddress( "glVertexAttribI3uiv" );
-        glVertexAttribI3uivEXT = (PFNGLVERTEXATTRIBI3UIVEXTPROC) r3GetProcAddress( "glVertexAttribI3uivEXT" );
-        glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC) r3GetProcAddress( "glVertexAttribI4bv" );
-        glVertexAttribI4bvEXT = (PFNGLVERTEXATTRIBI4BVEXTPROC) r3GetProcAddress( "glVertexAttribI4bvEXT" );
-        glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC) r3GetProcAddress( "glVertexAttribI4i" );
-        glVertexAttribI4iEXT = (PFNGLVERTEXATTRIBI4IEXTPROC) r3GetProcAddress( "glVertexAttribI4iEXT" );
-        glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC) r3GetProcAddress( "glVertexAttribI4iv" );
-        glVertexAttribI4ivEXT = (PFNGLVERTEXATTRIBI4IVEXTPROC) r3GetProcAddress( "glVertexAttribI4ivEXT" );
-        glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC) r3GetProcAddress( "glVertexAttribI4sv" );
-        glVertexAttribI4svEXT = (PFNGLVERTEXATTRIBI4SVEXTPROC) r3GetProcAddress( "glVertexAttribI4svEXT" );
-        glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC) r3GetProcAddress( "glVertexAttribI4ubv" );
-        glVertexAttribI4ubvEXT = (PFNGLVERTEXATTRIBI4UBVEXTPROC) r3GetProcAddress( "glVertexAttribI4ubvEXT" );
-        glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC) r3GetProcAddress( "glVertexAttribI4ui" );
-        glVertexAttribI4uiEXT = (PFNGLVERTEXATTRIBI4UIEXTPROC) r3GetProcAddress( "glVertexAttribI4uiEXT" );
-        glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC) r3GetProcAddress( "glVertexAttribI4uiv" );
-        glVertexAttribI4uivEXT = (PFNGLVERTEXATTRIBI4UIVEXTPROC) r3GetProcAddress( "glVertexAttribI4uivEXT" );
-        glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC) r3GetProcAddress( "glVertexAttribI4usv" );
-        glVertexAttribI4usvEXT = (PFNGLVERTEXATTRIBI4USVEXTPROC) r3GetProcAddress( "glVertexAttribI4usvEXT" );
-        glVertexAttribIFormatNV = (PFNGLVERTEXATTRIBIFORMATNVPROC) r3GetProcAddress( "glVertexAttribIFormatNV" );
-        glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC) r3GetProcAddress( "glVertexAttribIPointer" );
-        glVertexAttribIPointerEXT = (PFNGLVERTEXATTRIBIPOINTEREXTPROC) r3GetProcAddress( "glVertexAttribIPointerEXT" );
-        glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC) r3GetProcAddress( "glVertexAttribP1ui" );
-        glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC) r3GetProcAddress( "glVertexAttribP1uiv" );
-        glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC) r3GetProcAddress( "glVertexAttribP2ui" );
-        glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC) r3GetProcAddress( "glVertexAttribP2uiv" );
-        glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC) r3GetProcAddress( "glVertexAttribP3ui" );
-        glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC) r3GetProcAddress( "glVertexAttribP3uiv" );
-        glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC) r3GetProcAddress( "glVertexAttribP4ui" );
-        glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC) r3GetProcAddress( "glVertexAttribP4uiv" );
-        glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC) r3GetProcAddress( "glVertexAttribPointer" );
-        glVertexAttribPointerARB = (PFNGLVERTEXATTRIBPOINTERARBPROC) r3GetProcAddress( "glVertexAttribPointerARB" );
-        glVertexAttribPointerNV = (PFNGLVERTEXATTRIBPOINTERNVPROC) r3GetProcAddress( "glVertexAttribPointerNV" );
-        glVertexAttribs1dvNV = (PFNGLVERTEXATTRIBS1DVNVPROC) r3GetProcAddress( "glVertexAttribs1dvNV" );
-        glVertexAttribs1fvNV = (PFNGLVERTEXATTRIBS1FVNVPROC) r3GetProcAddress( "glVertexAttribs1fvNV" );
-        glVertexAttribs1hvNV = (PFNGLVERTEXATTRIBS1HVNVPROC) r3GetProcAddress( "glVertexAttribs1hvNV" );
-        glVertexAttribs1svNV = (PFNGLVERTEXATTRIBS1SVNVPROC) r3GetProcAddress( "glVertexAttribs1svNV" );
-        glVertexAttribs2dvNV = (PFNGLVERTEXATTRIBS2DVNVPROC) r3GetProcAddress( "glVertexAttribs2dvNV" );
-        glVertexAttribs2fvNV = (PFNGLVERTEXATTRIBS2FVNVPROC) r3GetProcAddress( "glVertexAttribs2fvNV" );
-        glVertexAttribs2hvNV = (PFNGLVERTEXATTRIBS2HVNVPROC) r3GetProcAddress( "glVertexAttribs2hvNV" );
-        glVertexAttribs2svNV = (PFNGLVERTEXATTRIBS2SVNVPROC) r3GetProcAddress( "glVertexAttribs2svNV" );
-        glVertexAttribs3dvNV = (PFNGLVERTEXATTRIBS3DVNVPROC) r3GetProcAddress( "glVertexAttribs3dvNV" );
-        glVertexAttribs3fvNV = (PFNGLVERTEXATTRIBS3FVNVPROC) r3GetProcAddress( "glVertexAttribs3fvNV" );
-        glVertexAttribs3hvNV = (PFNGLVERTEXATTRIBS3HVNVPROC) r3GetProcAddress( "glVertexAttribs3hvNV" );
-        glVertexAttribs3svNV = (PFNGLVERTEXATTRIBS3SVNVPROC) r3GetProcAddress( "glVertexAttribs3svNV" );
-        glVertexAttribs4dvNV = (PFNGLVERTEXATTRIBS4DVNVPROC) r3GetProcAddress( "glVertexAttribs4dvNV" );
-        glVertexAttribs4fvNV = (PFNGLVERTEXATTRIBS4FVNVPROC) r3GetProcAddress( "glVertexAttribs4fvNV" );
-        glVertexAttribs4hvNV = (PFNGLVERTEXATTRIBS4HVNVPROC) r3GetProcAddress( "glVertexAttribs4hvNV" );
-        glVertexAttribs4svNV = (PFNGLVERTEXATTRIBS4SVNVPROC) r3GetProcAddress( "glVertexAttribs4svNV" );
-        glVertexAttribs4ubvNV = (PFNGLVERTEXATTRIBS4UBVNVPROC) r3GetProcAddress( "glVertexAttribs4ubvNV" );
-        glVertexBlendARB = (PFNGLVERTEXBLENDARBPROC) r3GetProcAddress( "glVertexBlendARB" );
-        glVertexBlendEnvfATI = (PFNGLVERTEXBLENDENVFATIPROC) r3GetProcAddress( "glVertexBlendEnvfATI" );
-        glVertexBlendEnviATI = (PFNGLVERTEXBLENDENVIATIPROC) r3GetProcAddress( "glVertexBlendEnviATI" );
-        glVertexFormatNV = (PFNGLVERTEXFORMATNVPROC) r3GetProcAddress( "glVertexFormatNV" );
-        glVertexP2ui = (PFNGLVERTEXP2UIPROC) r3GetProcAddress( "glVertexP2ui" );
-        glVertexP2uiv = (PFNGLVERTEXP2UIVPROC) r3GetProcAddress( "glVertexP2uiv" );
-        glVertexP3ui = (PFNGLVERTEXP3UIPROC) r3GetProcAddress( "glVertexP3ui" );
-        glVertexP3uiv = (PFNGLVERTEXP3UIVPROC) r3GetProcAddress( "glVertexP3uiv" );
-        glVertexP4ui = (PFNGLVERTEXP4UIPROC) r3GetProcAddress( "glVertexP4ui" );
-        glVertexP4uiv = (PFNGLVERTEXP4UIVPROC) r3GetProcAddress( "glVertexP4uiv" );
-        glVertexPointerEXT = (PFNGLVERTEXPOINTEREXTPROC) r3GetProcAddress( "glVertexPointerEXT" );
-        glVertexPointerListIBM = (PFNGLVERTEXPOINTERLISTIBMPROC) r3GetProcAddress( "glVertexPointerListIBM" );
-        glVertexPointervINTEL = (PFNGLVERTEXPOINTERVINTELPROC) r3GetProcAddress( "glVertexPointervINTEL" );
-        glVertexStream1dATI = (PFNGLVERTEXSTREAM1DATIPROC) r3GetProcAddress( "glVertexStream1dATI" );
-        glVertexStream1dvATI = (PFNGLVERTEXSTREAM1DVATIPROC) r3GetProcAddress( "glVertexStream1dvATI" );
-        glVertexStream1fATI = (PFNGLVERTEXSTREAM1FATIPROC) r3GetProcAddress( "glVertexStream1fATI" );
-        glVertexStream1fvATI = (PFNGLVERTEXSTREAM1FVATIPROC) r3GetProcAddress( "glVertexStream1fvATI" );
-        glVertexStream1iATI = (PFNGLVERTEXSTREAM1IATIPROC) r3GetProcAddress( "glVertexStream1iATI" );
-        glVertexStream1ivATI = (PFNGLVERTEXSTREAM1IVATIPROC) r3GetProcAddress( "glVertexStream1ivATI" );
-        glVertexStream1sATI = (PFNGLVERTEXSTREAM1SATIPROC) r3GetProcAddress( "glVertexStream1sATI" );
-        glVertexStream1svATI = (PFNGLVERTEXSTREAM1SVATIPROC) r3GetProcAddress( "glVertexStream1svATI" );
-        glVertexStream2dATI = (PFNGLVERTEXSTREAM2DATIPROC) r3GetProcAddress( "glVertexStream2dATI" );
-        glVertexStream2dvATI = (PFNGLVERTEXSTREAM2DVATIPROC) r3GetProcAddress( "glVertexStream2dvATI" );
-        glVertexStream2fATI = (PFNGLVERTEXSTREAM2FATIPROC) r3GetProcAddress( "glVertexStream2fATI" );
-        glVertexStream2fvATI = (PFNGLVERTEXSTREAM2FVATIPROC) r3GetProcAddress( "glVertexStream2fvATI" );
-        glVertexStream2iATI = (PFNGLVERTEXSTREAM2IATIPROC) r3GetProcAddress( "glVertexStream2iATI" );
-        glVertexStream2ivATI = (PFNGLVERTEXSTREAM2IVATIPROC) r3GetProcAddress( "glVertexStream2ivATI" );
-        glVertexStream2sATI = (PFNGLVERTEXSTREAM2SATIPROC) r3GetProcAddress( "glVertexStream2sATI" );
-        glVertexStream2svATI = (PFNGLVERTEXSTREAM2SVATIPROC) r3GetProcAddress( "glVertexStream2svATI" );
-        glVertexStream3dATI = (PFNGLVERTEXSTREAM3DATIPROC) r3GetProcAddress( "glVertexStream3dATI" );
-        glVertexStream3dvATI = (PFNGLVERTEXSTREAM3DVATIPROC) r3GetProcAddress( "glVertexStream3dvATI" );
-        glVertexStream3fATI = (PFNGLVERTEXSTREAM3FATIPROC) r3GetProcAddress( "glVertexStream3fATI" );
-        glVertexStream3fvATI = (PFNGLVERTEXSTREAM3FVATIPROC) r3GetProcAddress( "glVertexStream3fvATI" );
-        glVertexStream3iATI = (PFNGLVERTEXSTREAM3IATIPROC) r3GetProcAddress( "glVertexStream3iATI" );
-        glVertexStream3ivATI = (PFNGLVERTEXSTREAM3IVATIPROC) r3GetProcAddress( "glVertexStream3ivATI" );
-        glVertexStream3sATI = (PFNGLVERTEXSTREAM3SATIPROC) r3GetProcAddress( "glVertexStream3sATI" );
-        glVertexStream3svATI = (PFNGLVERTEXSTREAM3SVATIPROC) r3GetProcAddress( "glVertexStream3svATI" );
-        glVertexStream4dATI = (PFNGLVERTEXSTREAM4DATIPROC) r3GetProcAddress( "glVertexStream4dATI" );
-        glVertexStream4dvATI = (PFNGLVERTEXSTREAM4DVATIPROC) r3GetProcAddress( "glVertexStream4dvATI" );
-        glVertexStream4fATI = (PFNGLVERTEXSTREAM4FATIPROC) r3GetProcAddress( "glVertexStream4fATI" );
-        glVertexStream4fvATI = (PFNGLVERTEXSTREAM4FVATIPROC) r3GetProcAddress( "glVertexStream4fvATI" );
-        glVertexStream4iATI = (PFNGLVERTEXSTREAM4IATIPROC) r3GetProcAddress( "glVertexStream4iATI" );
-        glVertexStream4ivATI = (PFNGLVERTEXSTREAM4IVATIPROC) r3GetProcAddress( "glVertexStream4ivATI" );
-        glVertexStream4sATI = (PFNGLVERTEXSTREAM4SATIPROC) r3GetProcAddress( "glVertexStream4sATI" );
-        glVertexStream4svATI = (PFNGLVERTEXSTREAM4SVATIPROC) r3GetProcAddress( "glVertexStream4svATI" );
-        glVertexWeightPointerEXT = (PFNGLVERTEXWEIGHTPOINTEREXTPROC) r3GetProcAddress( "glVertexWeightPointerEXT" );
-        glVertexWeightfEXT = (PFNGLVERTEXWEIGHTFEXTPROC) r3GetProcAddress( "glVertexWeightfEXT" );
-        glVertexWeightfvEXT = (PFNGLVERTEXWEIGHTFVEXTPROC) r3GetProcAddress( "glVertexWeightfvEXT" );
-        glVertexWeighthNV = (PFNGLVERTEXWEIGHTHNVPROC) r3GetProcAddress( "glVertexWeighthNV" );
-        glVertexWeighthvNV = (PFNGLVERTEXWEIGHTHVNVPROC) r3GetProcAddress( "glVertexWeighthvNV" );
-        glVideoCaptureNV = (PFNGLVIDEOCAPTURENVPROC) r3GetProcAddress( "glVideoCaptureNV" );
-        glVideoCaptureStreamParameterdvNV = (PFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC) r3GetProcAddress( "glVideoCaptureStreamParameterdvNV" );
-        glVideoCaptureStreamParameterfvNV = (PFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC) r3GetProcAddress( "glVideoCaptureStreamParameterfvNV" );
-        glVideoCaptureStreamParameterivNV = (PFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC) r3GetProcAddress( "glVideoCaptureStreamParameterivNV" );
-        glWaitSync = (PFNGLWAITSYNCPROC) r3GetProcAddress( "glWaitSync" );
-        glWeightPointerARB = (PFNGLWEIGHTPOINTERARBPROC) r3GetProcAddress( "glWeightPointerARB" );
-        glWeightbvARB = (PFNGLWEIGHTBVARBPROC) r3GetProcAddress( "glWeightbvARB" );
-        glWeightdvARB = (PFNGLWEIGHTDVARBPROC) r3GetProcAddress( "glWeightdvARB" );
-        glWeightfvARB = (PFNGLWEIGHTFVARBPROC) r3GetProcAddress( "glWeightfvARB" );
-        glWeightivARB = (PFNGLWEIGHTIVARBPROC) r3GetProcAddress( "glWeightivARB" );
-        glWeightsvARB = (PFNGLWEIGHTSVARBPROC) r3GetProcAddress( "glWeightsvARB" );
-        glWeightubvARB = (PFNGLWEIGHTUBVARBPROC) r3GetProcAddress( "glWeightubvARB" );
-        glWeightuivARB = (PFNGLWEIGHTUIVARBPROC) r3GetProcAddress( "glWeightuivARB" );
-        glWeightusvARB = (PFNGLWEIGHTUSVARBPROC) r3GetProcAddress( "glWeightusvARB" );
-        glWindowPos2d = (PFNGLWINDOWPOS2DPROC) r3GetProcAddress( "glWindowPos2d" );
-        glWindowPos2dARB = (PFNGLWINDOWPOS2DARBPROC) r3GetProcAddress( "glWindowPos2dARB" );
-        glWindowPos2dMESA = (PFNGLWINDOWPOS2DMESAPROC) r3GetProcAddress( "glWindowPos2dMESA" );
-        glWindowPos2dv = (PFNGLWINDOWPOS2DVPROC) r3GetProcAddress( "glWindowPos2dv" );
-        glWindowPos2dvARB = (PFNGLWINDOWPOS2DVARBPROC) r3GetProcAddress( "glWindowPos2dvARB" );
-        glWindowPos2dvMESA = (PFNGLWINDOWPOS2DVMESAPROC) r3GetProcAddress( "glWindowPos2dvMESA" );
-        glWindowPos2f = (PFNGLWINDOWPOS2FPROC) r3GetProcAddress( "glWindowPos2f" );
-        glWindowPos2fARB = (PFNGLWINDOWPOS2FARBPROC) r3GetProcAddress( "glWindowPos2fARB" );
-        glWindowPos2fMESA = (PFNGLWINDOWPOS2FMESAPROC) r3GetProcAddress( "glWindowPos2fMESA" );
-        glWindowPos2fv = (PFNGLWINDOWPOS2FVPROC) r3GetProcAddress( "glWindowPos2fv" );
-        glWindowPos2fvARB = (PFNGLWINDOWPOS2FVARBPROC) r3GetProcAddress( "glWindowPos2fvARB" );
-        glWindowPos2fvMESA = (PFNGLWINDOWPOS2FVMESAPROC) r3GetProcAddress( "glWindowPos2fvMESA" );
-        glWindowPos2i = (PFNGLWINDOWPOS2IPROC) r3GetProcAddress( "glWindowPos2i" );
-        glWindowPos2iARB = (PFNGLWINDOWPOS2IARBPROC) r3GetProcAddress( "glWindowPos2iARB" );
-        glWindowPos2iMESA = (PFNGLWINDOWPOS2IMESAPROC) r3GetProcAddress( "glWindowPos2iMESA" );
-        glWindowPos2iv = (PFNGLWINDOWPOS2IVPROC) r3GetProcAddress( "glWindowPos2iv" );
-        glWindowPos2ivARB = (PFNGLWINDOWPOS2IVARBPROC) r3GetProcAddress( "glWindowPos2ivARB" );
-        glWindowPos2ivMESA = (PFNGLWINDOWPOS2IVMESAPROC) r3GetProcAddress( "glWindowPos2ivMESA" );
-        glWindowPos2s = (PFNGLWINDOWPOS2SPROC) r3GetProcAddress( "glWindowPos2s" );
-        glWindowPos2sARB = (PFNGLWINDOWPOS2SARBPROC) r3GetProcAddress( "glWindowPos2sARB" );
-        glWindowPos2sMESA = (PFNGLWINDOWPOS2SMESAPROC) r3GetProcAddress( "glWindowPos2sMESA" );
-        glWindowPos2sv = (PFNGLWINDOWPOS2SVPROC) r3GetProcAddress( "glWindowPos2sv" );
-        glWindowPos2svARB = (PFNGLWINDOWPOS2SVARBPROC) r3GetProcAddress( "glWindowPos2svARB" );
-        glWindowPos2svMESA = (PFNGLWINDOWPOS2SVMESAPROC) r3GetProcAddress( "glWindowPos2svMESA" );
-        glWindowPos3d = (PFNGLWINDOWPOS3DPROC) r3GetProcAddress( "glWindowPos3d" );
-        glWindowPos3dARB = (PFNGLWINDOWPOS3DARBPROC) r3GetProcAddress( "glWindowPos3dARB" );
-        glWindowPos3dMESA = (PFNGLWINDOWPOS3DMESAPROC) r3GetProcAddress( "glWindowPos3dMESA" );
-        glWindowPos3dv = (PFNGLWINDOWPOS3DVPROC) r3GetProcAddress( "glWindowPos3dv" );
-        glWindowPos3dvARB = (PFNGLWINDOWPOS3DVARBPROC) r3GetProcAddress( "glWindowPos3dvARB" );
-        glWindowPos3dvMESA = (PFNGLWINDOWPOS3DVMESAPROC) r3GetProcAddress( "glWindowPos3dvMESA" );
-        glWindowPos3f = (PFNGLWINDOWPOS3FPROC) r3GetProcAddress( "glWindowPos3f" );
-        glWindowPos3fARB = (PFNGLWINDOWPOS3FARBPROC) r3GetProcAddress( "glWindowPos3fARB" );
-        glWindowPos3fMESA = (PFNGLWINDOWPOS3FMESAPROC) r3GetProcAddress( "glWindowPos3fMESA" );
-        glWindowPos3fv = (PFNGLWINDOWPOS3FVPROC) r3GetProcAddress( "glWindowPos3fv" );
-        glWindowPos3fvARB = (PFNGLWINDOWPOS3FVARBPROC) r3GetProcAddress( "glWindowPos3fvARB" );
-        glWindowPos3fvMESA = (PFNGLWINDOWPOS3FVMESAPROC) r3GetProcAddress( "glWindowPos3fvMESA" );
-        glWindowPos3i = (PFNGLWINDOWPOS3IPROC) r3GetProcAddress( "glWindowPos3i" );
-        glWindowPos3iARB = (PFNGLWINDOWPOS3IARBPROC) r3GetProcAddress( "glWindowPos3iARB" );
-        glWindowPos3iMESA = (PFNGLWINDOWPOS3IMESAPROC) r3GetProcAddress( "glWindowPos3iMESA" );
-        glWindowPos3iv = (PFNGLWINDOWPOS3IVPROC) r3GetProcAddress( "glWindowPos3iv" );
-        glWindowPos3ivARB = (PFNGLWINDOWPOS3IVARBPROC) r3GetProcAddress( "glWindowPos3ivARB" );
-        glWindowPos3ivMESA = (PFNGLWINDOWPOS3IVMESAPROC) r3GetProcAddress( "glWindowPos3ivMESA" );
-        glWindowPos3s = (PFNGLWINDOWPOS3SPROC) r3GetProcAddress( "glWindowPos3s" );
-        glWindowPos3sARB = (PFNGLWINDOWPOS3SARBPROC) r3GetProcAddress( "glWindowPos3sARB" );
-        glWindowPos3sMESA = (PFNGLWINDOWPOS3SMESAPROC) r3GetProcAddress( "glWindowPos3sMESA" );
-        glWindowPos3sv = (PFNGLWINDOWPOS3SVPROC) r3GetProcAddress( "glWindowPos3sv" );
-        glWindowPos3svARB = (PFNGLWINDOWPOS3SVARBPROC) r3GetProcAddress( "glWindowPos3svARB" );
-        glWindowPos3svMESA = (PFNGLWINDOWPOS3SVMESAPROC) r3GetProcAddress( "glWindowPos3svMESA" );
-        glWindowPos4dMESA = (PFNGLWINDOWPOS4DMESAPROC) r3GetProcAddress( "glWindowPos4dMESA" );
-        glWindowPos4dvMESA = (PFNGLWINDOWPOS4DVMESAPROC) r3GetProcAddress( "glWindowPos4dvMESA" );
-        glWindowPos4fMESA = (PFNGLWINDOWPOS4FMESAPROC) r3GetProcAddress( "glWindowPos4fMESA" );
-        glWindowPos4fvMESA = (PFNGLWINDOWPOS4FVMESAPROC) r3GetProcAddress( "glWindowPos4fvMESA" );
-        glWindowPos4iMESA = (PFNGLWINDOWPOS4IMESAPROC) r3GetProcAddress( "glWindowPos4iMESA" );
-        glWindowPos4ivMESA = (PFNGLWINDOWPOS4IVMESAPROC) r3GetProcAddress( "glWindowPos4ivMESA" );
-        glWindowPos4sMESA = (PFNGLWINDOWPOS4SMESAPROC) r3GetProcAddress( "glWindowPos4sMESA" );
-        glWindowPos4svMESA = (PFNGLWINDOWPOS4SVMESAPROC) r3GetProcAddress( "glWindowPos4svMESA" );
-        glWriteMaskEXT = (PFNGLWRITEMASKEXTPROC) r3GetProcAddress( "glWriteMaskEXT" );
+        glActiveTexture = Lazy_glActiveTexture;
+        glAttachShader = Lazy_glAttachShader;
+        glBindBuffer = Lazy_glBindBuffer;
+        glBindMultiTextureEXT = Lazy_glBindMultiTextureEXT;
+        glBindRenderbuffer = Lazy_glBindRenderbuffer;
+        glBindRenderbufferEXT = Lazy_glBindRenderbufferEXT;
+        glBufferData = Lazy_glBufferData;
+        glBufferSubData = Lazy_glBufferSubData;
+        glClientWaitSync = Lazy_glClientWaitSync;
+        glCompileShader = Lazy_glCompileShader;
+        glCreateProgram = Lazy_glCreateProgram;
+        glCreateShader = Lazy_glCreateShader;
+        glDeleteBuffers = Lazy_glDeleteBuffers;
+        glDeleteProgram = Lazy_glDeleteProgram;
+        glDeleteRenderbuffers = Lazy_glDeleteRenderbuffers;
+        glDeleteRenderbuffersEXT = Lazy_glDeleteRenderbuffersEXT;
+        glDeleteShader = Lazy_glDeleteShader;
+        glDeleteSync = Lazy_glDeleteSync;
+        glDisableClientStateIndexedEXT = Lazy_glDisableClientStateIndexedEXT;
+        glDisableIndexedEXT = Lazy_glDisableIndexedEXT;
+        glDisableVertexAttribArray = Lazy_glDisableVertexAttribArray;
+        glEnableClientStateIndexedEXT = Lazy_glEnableClientStateIndexedEXT;
+        glEnableIndexedEXT = Lazy_glEnableIndexedEXT;
+        glEnableVertexAttribArray = Lazy_glEnableVertexAttribArray;
+        glFenceSync = Lazy_glFenceSync;
+        glGenBuffers = Lazy_glGenBuffers;
+        glGenRenderbuffers = Lazy_glGenRenderbuffers;
+        glGenRenderbuffersEXT = Lazy_glGenRenderbuffersEXT;
+        glGenerateMipmapEXT = Lazy_glGenerateMipmapEXT;
+        glGetProgramInfoLog = Lazy_glGetProgramInfoLog;
+        glGetShaderInfoLog = Lazy_glGetShaderInfoLog;
+        glGetStringi = Lazy_glGetStringi;
+        glGetUniformLocation = Lazy_glGetUniformLocation;
+        glLinkProgram = Lazy_glLinkProgram;
+        glMapBufferRange = Lazy_glMapBufferRange;
+        glMultiTexCoord2f = Lazy_glMultiTexCoord2f;
+        glMultiTexCoordPointerEXT = Lazy_glMultiTexCoordPointerEXT;
+        glMultiTexEnviEXT = Lazy_glMultiTexEnviEXT;
+        glProgramUniform1iEXT = Lazy_glProgramUniform1iEXT;
+        glProgramUniform3fvEXT = Lazy_glProgramUniform3fvEXT;
+        glProgramUniformMatrix4fvEXT = Lazy_glProgramUniformMatrix4fvEXT;
+        glRenderbufferStorage = Lazy_glRenderbufferStorage;
+        glRenderbufferStorageEXT = Lazy_glRenderbufferStorageEXT;
+        glShaderSource = Lazy_glShaderSource;
+        glUnmapBuffer = Lazy_glUnmapBuffer;
+        glUseProgram = Lazy_glUseProgram;
+        glVertexAttribPointer = Lazy_glVertexAttribPointer;
 
     }
 
@@ -3477,1732 +365,53 @@ namespace r3 {
 
     void ShutdownGLEntry() {
 
-        glActiveProgramEXT = NULL;
-        glActiveStencilFaceEXT = NULL;
-        glActiveTexture = NULL;
-        glActiveTextureARB = NULL;
-        glActiveVaryingNV = NULL;
-        glAlphaFragmentOp1ATI = NULL;
-        glAlphaFragmentOp2ATI = NULL;
-        glAlphaFragmentOp3ATI = NULL;
-        glApplyTextureEXT = NULL;
-        glAreProgramsResidentNV = NULL;
-        glAreTexturesResidentEXT = NULL;
-        glArrayElementEXT = NULL;
-        glArrayObjectATI = NULL;
-        glAsyncMarkerSGIX = NULL;
-        glAttachObjectARB = NULL;
-        glAttachShader = NULL;
-        glBeginConditionalRender = NULL;
-        glBeginConditionalRenderNV = NULL;
-        glBeginFragmentShaderATI = NULL;
-        glBeginOcclusionQueryNV = NULL;
-        glBeginPerfMonitorAMD = NULL;
-        glBeginQuery = NULL;
-        glBeginQueryARB = NULL;
-        glBeginQueryIndexed = NULL;
-        glBeginTransformFeedback = NULL;
-        glBeginTransformFeedbackEXT = NULL;
-        glBeginTransformFeedbackNV = NULL;
-        glBeginVertexShaderEXT = NULL;
-        glBeginVideoCaptureNV = NULL;
-        glBindAttribLocation = NULL;
-        glBindAttribLocationARB = NULL;
-        glBindBuffer = NULL;
-        glBindBufferARB = NULL;
-        glBindBufferBase = NULL;
-        glBindBufferBaseEXT = NULL;
-        glBindBufferBaseNV = NULL;
-        glBindBufferOffsetEXT = NULL;
-        glBindBufferOffsetNV = NULL;
-        glBindBufferRange = NULL;
-        glBindBufferRangeEXT = NULL;
-        glBindBufferRangeNV = NULL;
-        glBindFragDataLocation = NULL;
-        glBindFragDataLocationEXT = NULL;
-        glBindFragDataLocationIndexed = NULL;
-        glBindFragmentShaderATI = NULL;
-        glBindFramebuffer = NULL;
-        glBindFramebufferEXT = NULL;
-        glBindLightParameterEXT = NULL;
-        glBindMaterialParameterEXT = NULL;
-        glBindMultiTextureEXT = NULL;
-        glBindParameterEXT = NULL;
-        glBindProgramARB = NULL;
-        glBindProgramNV = NULL;
-        glBindRenderbuffer = NULL;
-        glBindRenderbufferEXT = NULL;
-        glBindSampler = NULL;
-        glBindTexGenParameterEXT = NULL;
-        glBindTextureEXT = NULL;
-        glBindTextureUnitParameterEXT = NULL;
-        glBindTransformFeedback = NULL;
-        glBindTransformFeedbackNV = NULL;
-        glBindVertexArray = NULL;
-        glBindVertexArrayAPPLE = NULL;
-        glBindVertexShaderEXT = NULL;
-        glBindVideoCaptureStreamBufferNV = NULL;
-        glBindVideoCaptureStreamTextureNV = NULL;
-        glBinormal3bEXT = NULL;
-        glBinormal3bvEXT = NULL;
-        glBinormal3dEXT = NULL;
-        glBinormal3dvEXT = NULL;
-        glBinormal3fEXT = NULL;
-        glBinormal3fvEXT = NULL;
-        glBinormal3iEXT = NULL;
-        glBinormal3ivEXT = NULL;
-        glBinormal3sEXT = NULL;
-        glBinormal3svEXT = NULL;
-        glBinormalPointerEXT = NULL;
-        glBlendColor = NULL;
-        glBlendColorEXT = NULL;
-        glBlendEquation = NULL;
-        glBlendEquationEXT = NULL;
-        glBlendEquationIndexedAMD = NULL;
-        glBlendEquationSeparate = NULL;
-        glBlendEquationSeparateEXT = NULL;
-        glBlendEquationSeparateIndexedAMD = NULL;
-        glBlendEquationSeparatei = NULL;
-        glBlendEquationi = NULL;
-        glBlendFuncIndexedAMD = NULL;
-        glBlendFuncSeparate = NULL;
-        glBlendFuncSeparateEXT = NULL;
-        glBlendFuncSeparateINGR = NULL;
-        glBlendFuncSeparateIndexedAMD = NULL;
-        glBlendFuncSeparatei = NULL;
-        glBlendFunci = NULL;
-        glBlitFramebuffer = NULL;
-        glBlitFramebufferEXT = NULL;
-        glBufferAddressRangeNV = NULL;
-        glBufferData = NULL;
-        glBufferDataARB = NULL;
-        glBufferParameteriAPPLE = NULL;
-        glBufferSubData = NULL;
-        glBufferSubDataARB = NULL;
-        glCheckFramebufferStatus = NULL;
-        glCheckFramebufferStatusEXT = NULL;
-        glCheckNamedFramebufferStatusEXT = NULL;
-        glClampColor = NULL;
-        glClampColorARB = NULL;
-        glClearBufferfi = NULL;
-        glClearBufferfv = NULL;
-        glClearBufferiv = NULL;
-        glClearBufferuiv = NULL;
-        glClearColorIiEXT = NULL;
-        glClearColorIuiEXT = NULL;
-        glClearDepthdNV = NULL;
-        glClientActiveTexture = NULL;
-        glClientActiveTextureARB = NULL;
-        glClientActiveVertexStreamATI = NULL;
-        glClientAttribDefaultEXT = NULL;
-        glClientWaitSync = NULL;
-        glColor3fVertex3fSUN = NULL;
-        glColor3fVertex3fvSUN = NULL;
-        glColor3hNV = NULL;
-        glColor3hvNV = NULL;
-        glColor4fNormal3fVertex3fSUN = NULL;
-        glColor4fNormal3fVertex3fvSUN = NULL;
-        glColor4hNV = NULL;
-        glColor4hvNV = NULL;
-        glColor4ubVertex2fSUN = NULL;
-        glColor4ubVertex2fvSUN = NULL;
-        glColor4ubVertex3fSUN = NULL;
-        glColor4ubVertex3fvSUN = NULL;
-        glColorFormatNV = NULL;
-        glColorFragmentOp1ATI = NULL;
-        glColorFragmentOp2ATI = NULL;
-        glColorFragmentOp3ATI = NULL;
-        glColorMaskIndexedEXT = NULL;
-        glColorMaski = NULL;
-        glColorP3ui = NULL;
-        glColorP3uiv = NULL;
-        glColorP4ui = NULL;
-        glColorP4uiv = NULL;
-        glColorPointerEXT = NULL;
-        glColorPointerListIBM = NULL;
-        glColorPointervINTEL = NULL;
-        glColorSubTable = NULL;
-        glColorSubTableEXT = NULL;
-        glColorTable = NULL;
-        glColorTableEXT = NULL;
-        glColorTableParameterfv = NULL;
-        glColorTableParameterfvSGI = NULL;
-        glColorTableParameteriv = NULL;
-        glColorTableParameterivSGI = NULL;
-        glColorTableSGI = NULL;
-        glCombinerInputNV = NULL;
-        glCombinerOutputNV = NULL;
-        glCombinerParameterfNV = NULL;
-        glCombinerParameterfvNV = NULL;
-        glCombinerParameteriNV = NULL;
-        glCombinerParameterivNV = NULL;
-        glCombinerStageParameterfvNV = NULL;
-        glCompileShader = NULL;
-        glCompileShaderARB = NULL;
-        glCompileShaderIncludeARB = NULL;
-        glCompressedMultiTexImage1DEXT = NULL;
-        glCompressedMultiTexImage2DEXT = NULL;
-        glCompressedMultiTexImage3DEXT = NULL;
-        glCompressedMultiTexSubImage1DEXT = NULL;
-        glCompressedMultiTexSubImage2DEXT = NULL;
-        glCompressedMultiTexSubImage3DEXT = NULL;
-        glCompressedTexImage1D = NULL;
-        glCompressedTexImage1DARB = NULL;
-        glCompressedTexImage2D = NULL;
-        glCompressedTexImage2DARB = NULL;
-        glCompressedTexImage3D = NULL;
-        glCompressedTexImage3DARB = NULL;
-        glCompressedTexSubImage1D = NULL;
-        glCompressedTexSubImage1DARB = NULL;
-        glCompressedTexSubImage2D = NULL;
-        glCompressedTexSubImage2DARB = NULL;
-        glCompressedTexSubImage3D = NULL;
-        glCompressedTexSubImage3DARB = NULL;
-        glCompressedTextureImage1DEXT = NULL;
-        glCompressedTextureImage2DEXT = NULL;
-        glCompressedTextureImage3DEXT = NULL;
-        glCompressedTextureSubImage1DEXT = NULL;
-        glCompressedTextureSubImage2DEXT = NULL;
-        glCompressedTextureSubImage3DEXT = NULL;
-        glConvolutionFilter1D = NULL;
-        glConvolutionFilter1DEXT = NULL;
-        glConvolutionFilter2D = NULL;
-        glConvolutionFilter2DEXT = NULL;
-        glConvolutionParameterf = NULL;
-        glConvolutionParameterfEXT = NULL;
-        glConvolutionParameterfv = NULL;
-        glConvolutionParameterfvEXT = NULL;
-        glConvolutionParameteri = NULL;
-        glConvolutionParameteriEXT = NULL;
-        glConvolutionParameteriv = NULL;
-        glConvolutionParameterivEXT = NULL;
-        glCopyBufferSubData = NULL;
-        glCopyColorSubTable = NULL;
-        glCopyColorSubTableEXT = NULL;
-        glCopyColorTable = NULL;
-        glCopyColorTableSGI = NULL;
-        glCopyConvolutionFilter1D = NULL;
-        glCopyConvolutionFilter1DEXT = NULL;
-        glCopyConvolutionFilter2D = NULL;
-        glCopyConvolutionFilter2DEXT = NULL;
-        glCopyImageSubDataNV = NULL;
-        glCopyMultiTexImage1DEXT = NULL;
-        glCopyMultiTexImage2DEXT = NULL;
-        glCopyMultiTexSubImage1DEXT = NULL;
-        glCopyMultiTexSubImage2DEXT = NULL;
-        glCopyMultiTexSubImage3DEXT = NULL;
-        glCopyTexImage1DEXT = NULL;
-        glCopyTexImage2DEXT = NULL;
-        glCopyTexSubImage1DEXT = NULL;
-        glCopyTexSubImage2DEXT = NULL;
-        glCopyTexSubImage3D = NULL;
-        glCopyTexSubImage3DEXT = NULL;
-        glCopyTextureImage1DEXT = NULL;
-        glCopyTextureImage2DEXT = NULL;
-        glCopyTextureSubImage1DEXT = NULL;
-        glCopyTextureSubImage2DEXT = NULL;
-        glCopyTextureSubImage3DEXT = NULL;
-        glCreateProgram = NULL;
-        glCreateProgramObjectARB = NULL;
-        glCreateShader = NULL;
-        glCreateShaderObjectARB = NULL;
-        glCreateShaderProgramEXT = NULL;
-        glCullParameterdvEXT = NULL;
-        glCullParameterfvEXT = NULL;
-        glCurrentPaletteMatrixARB = NULL;
-        glDeformSGIX = NULL;
-        glDeformationMap3dSGIX = NULL;
-        glDeformationMap3fSGIX = NULL;
-        glDeleteAsyncMarkersSGIX = NULL;
-        glDeleteBuffers = NULL;
-        glDeleteBuffersARB = NULL;
-        glDeleteFencesAPPLE = NULL;
-        glDeleteFencesNV = NULL;
-        glDeleteFragmentShaderATI = NULL;
-        glDeleteFramebuffers = NULL;
-        glDeleteFramebuffersEXT = NULL;
-        glDeleteNamedStringARB = NULL;
-        glDeleteObjectARB = NULL;
-        glDeleteOcclusionQueriesNV = NULL;
-        glDeletePerfMonitorsAMD = NULL;
-        glDeleteProgram = NULL;
-        glDeleteProgramsARB = NULL;
-        glDeleteProgramsNV = NULL;
-        glDeleteQueries = NULL;
-        glDeleteQueriesARB = NULL;
-        glDeleteRenderbuffers = NULL;
-        glDeleteRenderbuffersEXT = NULL;
-        glDeleteSamplers = NULL;
-        glDeleteShader = NULL;
-        glDeleteSync = NULL;
-        glDeleteTexturesEXT = NULL;
-        glDeleteTransformFeedbacks = NULL;
-        glDeleteTransformFeedbacksNV = NULL;
-        glDeleteVertexArrays = NULL;
-        glDeleteVertexArraysAPPLE = NULL;
-        glDeleteVertexShaderEXT = NULL;
-        glDepthBoundsEXT = NULL;
-        glDepthBoundsdNV = NULL;
-        glDepthRangedNV = NULL;
-        glDetachObjectARB = NULL;
-        glDetachShader = NULL;
-        glDetailTexFuncSGIS = NULL;
-        glDisableClientStateIndexedEXT = NULL;
-        glDisableIndexedEXT = NULL;
-        glDisableVariantClientStateEXT = NULL;
-        glDisableVertexAttribAPPLE = NULL;
-        glDisableVertexAttribArray = NULL;
-        glDisableVertexAttribArrayARB = NULL;
-        glDisablei = NULL;
-        glDrawArraysEXT = NULL;
-        glDrawArraysIndirect = NULL;
-        glDrawArraysInstanced = NULL;
-        glDrawArraysInstancedARB = NULL;
-        glDrawArraysInstancedEXT = NULL;
-        glDrawBuffers = NULL;
-        glDrawBuffersARB = NULL;
-        glDrawBuffersATI = NULL;
-        glDrawElementArrayAPPLE = NULL;
-        glDrawElementArrayATI = NULL;
-        glDrawElementsBaseVertex = NULL;
-        glDrawElementsIndirect = NULL;
-        glDrawElementsInstanced = NULL;
-        glDrawElementsInstancedARB = NULL;
-        glDrawElementsInstancedBaseVertex = NULL;
-        glDrawElementsInstancedEXT = NULL;
-        glDrawMeshArraysSUN = NULL;
-        glDrawRangeElementArrayAPPLE = NULL;
-        glDrawRangeElementArrayATI = NULL;
-        glDrawRangeElements = NULL;
-        glDrawRangeElementsBaseVertex = NULL;
-        glDrawRangeElementsEXT = NULL;
-        glDrawTransformFeedback = NULL;
-        glDrawTransformFeedbackNV = NULL;
-        glDrawTransformFeedbackStream = NULL;
-        glEdgeFlagFormatNV = NULL;
-        glEdgeFlagPointerEXT = NULL;
-        glEdgeFlagPointerListIBM = NULL;
-        glElementPointerAPPLE = NULL;
-        glElementPointerATI = NULL;
-        glEnableClientStateIndexedEXT = NULL;
-        glEnableIndexedEXT = NULL;
-        glEnableVariantClientStateEXT = NULL;
-        glEnableVertexAttribAPPLE = NULL;
-        glEnableVertexAttribArray = NULL;
-        glEnableVertexAttribArrayARB = NULL;
-        glEnablei = NULL;
-        glEndConditionalRender = NULL;
-        glEndConditionalRenderNV = NULL;
-        glEndFragmentShaderATI = NULL;
-        glEndOcclusionQueryNV = NULL;
-        glEndPerfMonitorAMD = NULL;
-        glEndQuery = NULL;
-        glEndQueryARB = NULL;
-        glEndQueryIndexed = NULL;
-        glEndTransformFeedback = NULL;
-        glEndTransformFeedbackEXT = NULL;
-        glEndTransformFeedbackNV = NULL;
-        glEndVertexShaderEXT = NULL;
-        glEndVideoCaptureNV = NULL;
-        glEvalMapsNV = NULL;
-        glExecuteProgramNV = NULL;
-        glExtractComponentEXT = NULL;
-        glFenceSync = NULL;
-        glFinalCombinerInputNV = NULL;
-        glFinishAsyncSGIX = NULL;
-        glFinishFenceAPPLE = NULL;
-        glFinishFenceNV = NULL;
-        glFinishObjectAPPLE = NULL;
-        glFinishTextureSUNX = NULL;
-        glFlushMappedBufferRange = NULL;
-        glFlushMappedBufferRangeAPPLE = NULL;
-        glFlushMappedNamedBufferRangeEXT = NULL;
-        glFlushPixelDataRangeNV = NULL;
-        glFlushRasterSGIX = NULL;
-        glFlushVertexArrayRangeAPPLE = NULL;
-        glFlushVertexArrayRangeNV = NULL;
-        glFogCoordFormatNV = NULL;
-        glFogCoordPointer = NULL;
-        glFogCoordPointerEXT = NULL;
-        glFogCoordPointerListIBM = NULL;
-        glFogCoordd = NULL;
-        glFogCoorddEXT = NULL;
-        glFogCoorddv = NULL;
-        glFogCoorddvEXT = NULL;
-        glFogCoordf = NULL;
-        glFogCoordfEXT = NULL;
-        glFogCoordfv = NULL;
-        glFogCoordfvEXT = NULL;
-        glFogCoordhNV = NULL;
-        glFogCoordhvNV = NULL;
-        glFogFuncSGIS = NULL;
-        glFragmentColorMaterialSGIX = NULL;
-        glFragmentLightModelfSGIX = NULL;
-        glFragmentLightModelfvSGIX = NULL;
-        glFragmentLightModeliSGIX = NULL;
-        glFragmentLightModelivSGIX = NULL;
-        glFragmentLightfSGIX = NULL;
-        glFragmentLightfvSGIX = NULL;
-        glFragmentLightiSGIX = NULL;
-        glFragmentLightivSGIX = NULL;
-        glFragmentMaterialfSGIX = NULL;
-        glFragmentMaterialfvSGIX = NULL;
-        glFragmentMaterialiSGIX = NULL;
-        glFragmentMaterialivSGIX = NULL;
-        glFrameTerminatorGREMEDY = NULL;
-        glFrameZoomSGIX = NULL;
-        glFramebufferDrawBufferEXT = NULL;
-        glFramebufferDrawBuffersEXT = NULL;
-        glFramebufferReadBufferEXT = NULL;
-        glFramebufferRenderbuffer = NULL;
-        glFramebufferRenderbufferEXT = NULL;
-        glFramebufferTexture = NULL;
-        glFramebufferTexture1D = NULL;
-        glFramebufferTexture1DEXT = NULL;
-        glFramebufferTexture2D = NULL;
-        glFramebufferTexture2DEXT = NULL;
-        glFramebufferTexture3D = NULL;
-        glFramebufferTexture3DEXT = NULL;
-        glFramebufferTextureARB = NULL;
-        glFramebufferTextureEXT = NULL;
-        glFramebufferTextureFaceARB = NULL;
-        glFramebufferTextureFaceEXT = NULL;
-        glFramebufferTextureLayer = NULL;
-        glFramebufferTextureLayerARB = NULL;
-        glFramebufferTextureLayerEXT = NULL;
-        glFreeObjectBufferATI = NULL;
-        glGenAsyncMarkersSGIX = NULL;
-        glGenBuffers = NULL;
-        glGenBuffersARB = NULL;
-        glGenFencesAPPLE = NULL;
-        glGenFencesNV = NULL;
-        glGenFragmentShadersATI = NULL;
-        glGenFramebuffers = NULL;
-        glGenFramebuffersEXT = NULL;
-        glGenOcclusionQueriesNV = NULL;
-        glGenPerfMonitorsAMD = NULL;
-        glGenProgramsARB = NULL;
-        glGenProgramsNV = NULL;
-        glGenQueries = NULL;
-        glGenQueriesARB = NULL;
-        glGenRenderbuffers = NULL;
-        glGenRenderbuffersEXT = NULL;
-        glGenSamplers = NULL;
-        glGenSymbolsEXT = NULL;
-        glGenTexturesEXT = NULL;
-        glGenTransformFeedbacks = NULL;
-        glGenTransformFeedbacksNV = NULL;
-        glGenVertexArrays = NULL;
-        glGenVertexArraysAPPLE = NULL;
-        glGenVertexShadersEXT = NULL;
-        glGenerateMipmap = NULL;
-        glGenerateMipmapEXT = NULL;
-        glGenerateMultiTexMipmapEXT = NULL;
-        glGenerateTextureMipmapEXT = NULL;
-        glGetActiveAttrib = NULL;
-        glGetActiveAttribARB = NULL;
-        glGetActiveSubroutineName = NULL;
-        glGetActiveSubroutineUniformName = NULL;
-        glGetActiveSubroutineUniformiv = NULL;
-        glGetActiveUniform = NULL;
-        glGetActiveUniformARB = NULL;
-        glGetActiveUniformBlockName = NULL;
-        glGetActiveUniformBlockiv = NULL;
-        glGetActiveUniformName = NULL;
-        glGetActiveUniformsiv = NULL;
-        glGetActiveVaryingNV = NULL;
-        glGetArrayObjectfvATI = NULL;
-        glGetArrayObjectivATI = NULL;
-        glGetAttachedObjectsARB = NULL;
-        glGetAttachedShaders = NULL;
-        glGetAttribLocation = NULL;
-        glGetAttribLocationARB = NULL;
-        glGetBooleanIndexedvEXT = NULL;
-        glGetBufferParameteri64v = NULL;
-        glGetBufferParameteriv = NULL;
-        glGetBufferParameterivARB = NULL;
-        glGetBufferParameterui64vNV = NULL;
-        glGetBufferPointerv = NULL;
-        glGetBufferPointervARB = NULL;
-        glGetBufferSubData = NULL;
-        glGetBufferSubDataARB = NULL;
-        glGetColorTable = NULL;
-        glGetColorTableEXT = NULL;
-        glGetColorTableParameterfv = NULL;
-        glGetColorTableParameterfvEXT = NULL;
-        glGetColorTableParameterfvSGI = NULL;
-        glGetColorTableParameteriv = NULL;
-        glGetColorTableParameterivEXT = NULL;
-        glGetColorTableParameterivSGI = NULL;
-        glGetColorTableSGI = NULL;
-        glGetCombinerInputParameterfvNV = NULL;
-        glGetCombinerInputParameterivNV = NULL;
-        glGetCombinerOutputParameterfvNV = NULL;
-        glGetCombinerOutputParameterivNV = NULL;
-        glGetCombinerStageParameterfvNV = NULL;
-        glGetCompressedMultiTexImageEXT = NULL;
-        glGetCompressedTexImage = NULL;
-        glGetCompressedTexImageARB = NULL;
-        glGetCompressedTextureImageEXT = NULL;
-        glGetConvolutionFilter = NULL;
-        glGetConvolutionFilterEXT = NULL;
-        glGetConvolutionParameterfv = NULL;
-        glGetConvolutionParameterfvEXT = NULL;
-        glGetConvolutionParameteriv = NULL;
-        glGetConvolutionParameterivEXT = NULL;
-        glGetDetailTexFuncSGIS = NULL;
-        glGetDoubleIndexedvEXT = NULL;
-        glGetFenceivNV = NULL;
-        glGetFinalCombinerInputParameterfvNV = NULL;
-        glGetFinalCombinerInputParameterivNV = NULL;
-        glGetFloatIndexedvEXT = NULL;
-        glGetFogFuncSGIS = NULL;
-        glGetFragDataIndex = NULL;
-        glGetFragDataLocation = NULL;
-        glGetFragDataLocationEXT = NULL;
-        glGetFragmentLightfvSGIX = NULL;
-        glGetFragmentLightivSGIX = NULL;
-        glGetFragmentMaterialfvSGIX = NULL;
-        glGetFragmentMaterialivSGIX = NULL;
-        glGetFramebufferAttachmentParameteriv = NULL;
-        glGetFramebufferAttachmentParameterivEXT = NULL;
-        glGetFramebufferParameterivEXT = NULL;
-        glGetHandleARB = NULL;
-        glGetHistogram = NULL;
-        glGetHistogramEXT = NULL;
-        glGetHistogramParameterfv = NULL;
-        glGetHistogramParameterfvEXT = NULL;
-        glGetHistogramParameteriv = NULL;
-        glGetHistogramParameterivEXT = NULL;
-        glGetImageTransformParameterfvHP = NULL;
-        glGetImageTransformParameterivHP = NULL;
-        glGetInfoLogARB = NULL;
-        glGetInstrumentsSGIX = NULL;
-        glGetInteger64v = NULL;
-        glGetIntegerIndexedvEXT = NULL;
-        glGetIntegerui64vNV = NULL;
-        glGetInvariantBooleanvEXT = NULL;
-        glGetInvariantFloatvEXT = NULL;
-        glGetInvariantIntegervEXT = NULL;
-        glGetListParameterfvSGIX = NULL;
-        glGetListParameterivSGIX = NULL;
-        glGetLocalConstantBooleanvEXT = NULL;
-        glGetLocalConstantFloatvEXT = NULL;
-        glGetLocalConstantIntegervEXT = NULL;
-        glGetMapAttribParameterfvNV = NULL;
-        glGetMapAttribParameterivNV = NULL;
-        glGetMapControlPointsNV = NULL;
-        glGetMapParameterfvNV = NULL;
-        glGetMapParameterivNV = NULL;
-        glGetMinmax = NULL;
-        glGetMinmaxEXT = NULL;
-        glGetMinmaxParameterfv = NULL;
-        glGetMinmaxParameterfvEXT = NULL;
-        glGetMinmaxParameteriv = NULL;
-        glGetMinmaxParameterivEXT = NULL;
-        glGetMultiTexEnvfvEXT = NULL;
-        glGetMultiTexEnvivEXT = NULL;
-        glGetMultiTexGendvEXT = NULL;
-        glGetMultiTexGenfvEXT = NULL;
-        glGetMultiTexGenivEXT = NULL;
-        glGetMultiTexImageEXT = NULL;
-        glGetMultiTexLevelParameterfvEXT = NULL;
-        glGetMultiTexLevelParameterivEXT = NULL;
-        glGetMultiTexParameterIivEXT = NULL;
-        glGetMultiTexParameterIuivEXT = NULL;
-        glGetMultiTexParameterfvEXT = NULL;
-        glGetMultiTexParameterivEXT = NULL;
-        glGetMultisamplefv = NULL;
-        glGetMultisamplefvNV = NULL;
-        glGetNamedBufferParameterivEXT = NULL;
-        glGetNamedBufferParameterui64vNV = NULL;
-        glGetNamedBufferPointervEXT = NULL;
-        glGetNamedBufferSubDataEXT = NULL;
-        glGetNamedFramebufferAttachmentParameterivEXT = NULL;
-        glGetNamedProgramLocalParameterIivEXT = NULL;
-        glGetNamedProgramLocalParameterIuivEXT = NULL;
-        glGetNamedProgramLocalParameterdvEXT = NULL;
-        glGetNamedProgramLocalParameterfvEXT = NULL;
-        glGetNamedProgramStringEXT = NULL;
-        glGetNamedProgramivEXT = NULL;
-        glGetNamedRenderbufferParameterivEXT = NULL;
-        glGetNamedStringARB = NULL;
-        glGetNamedStringivARB = NULL;
-        glGetObjectBufferfvATI = NULL;
-        glGetObjectBufferivATI = NULL;
-        glGetObjectParameterfvARB = NULL;
-        glGetObjectParameterivAPPLE = NULL;
-        glGetObjectParameterivARB = NULL;
-        glGetOcclusionQueryivNV = NULL;
-        glGetOcclusionQueryuivNV = NULL;
-        glGetPerfMonitorCounterDataAMD = NULL;
-        glGetPerfMonitorCounterInfoAMD = NULL;
-        glGetPerfMonitorCounterStringAMD = NULL;
-        glGetPerfMonitorCountersAMD = NULL;
-        glGetPerfMonitorGroupStringAMD = NULL;
-        glGetPerfMonitorGroupsAMD = NULL;
-        glGetPixelTexGenParameterfvSGIS = NULL;
-        glGetPixelTexGenParameterivSGIS = NULL;
-        glGetPointerIndexedvEXT = NULL;
-        glGetPointervEXT = NULL;
-        glGetProgramEnvParameterIivNV = NULL;
-        glGetProgramEnvParameterIuivNV = NULL;
-        glGetProgramEnvParameterdvARB = NULL;
-        glGetProgramEnvParameterfvARB = NULL;
-        glGetProgramInfoLog = NULL;
-        glGetProgramLocalParameterIivNV = NULL;
-        glGetProgramLocalParameterIuivNV = NULL;
-        glGetProgramLocalParameterdvARB = NULL;
-        glGetProgramLocalParameterfvARB = NULL;
-        glGetProgramNamedParameterdvNV = NULL;
-        glGetProgramNamedParameterfvNV = NULL;
-        glGetProgramParameterdvNV = NULL;
-        glGetProgramParameterfvNV = NULL;
-        glGetProgramStageiv = NULL;
-        glGetProgramStringARB = NULL;
-        glGetProgramStringNV = NULL;
-        glGetProgramiv = NULL;
-        glGetProgramivARB = NULL;
-        glGetProgramivNV = NULL;
-        glGetQueryIndexediv = NULL;
-        glGetQueryObjecti64v = NULL;
-        glGetQueryObjecti64vEXT = NULL;
-        glGetQueryObjectiv = NULL;
-        glGetQueryObjectivARB = NULL;
-        glGetQueryObjectui64v = NULL;
-        glGetQueryObjectui64vEXT = NULL;
-        glGetQueryObjectuiv = NULL;
-        glGetQueryObjectuivARB = NULL;
-        glGetQueryiv = NULL;
-        glGetQueryivARB = NULL;
-        glGetRenderbufferParameteriv = NULL;
-        glGetRenderbufferParameterivEXT = NULL;
-        glGetSamplerParameterIfv = NULL;
-        glGetSamplerParameterIiv = NULL;
-        glGetSamplerParameterfv = NULL;
-        glGetSamplerParameteriv = NULL;
-        glGetSeparableFilter = NULL;
-        glGetSeparableFilterEXT = NULL;
-        glGetShaderInfoLog = NULL;
-        glGetShaderSource = NULL;
-        glGetShaderSourceARB = NULL;
-        glGetShaderiv = NULL;
-        glGetSharpenTexFuncSGIS = NULL;
-        glGetStringi = NULL;
-        glGetSubroutineIndex = NULL;
-        glGetSubroutineUniformLocation = NULL;
-        glGetSynciv = NULL;
-        glGetTexBumpParameterfvATI = NULL;
-        glGetTexBumpParameterivATI = NULL;
-        glGetTexFilterFuncSGIS = NULL;
-        glGetTexParameterIiv = NULL;
-        glGetTexParameterIivEXT = NULL;
-        glGetTexParameterIuiv = NULL;
-        glGetTexParameterIuivEXT = NULL;
-        glGetTexParameterPointervAPPLE = NULL;
-        glGetTextureImageEXT = NULL;
-        glGetTextureLevelParameterfvEXT = NULL;
-        glGetTextureLevelParameterivEXT = NULL;
-        glGetTextureParameterIivEXT = NULL;
-        glGetTextureParameterIuivEXT = NULL;
-        glGetTextureParameterfvEXT = NULL;
-        glGetTextureParameterivEXT = NULL;
-        glGetTrackMatrixivNV = NULL;
-        glGetTransformFeedbackVarying = NULL;
-        glGetTransformFeedbackVaryingEXT = NULL;
-        glGetTransformFeedbackVaryingNV = NULL;
-        glGetUniformBlockIndex = NULL;
-        glGetUniformBufferSizeEXT = NULL;
-        glGetUniformIndices = NULL;
-        glGetUniformLocation = NULL;
-        glGetUniformLocationARB = NULL;
-        glGetUniformOffsetEXT = NULL;
-        glGetUniformSubroutineuiv = NULL;
-        glGetUniformdv = NULL;
-        glGetUniformfv = NULL;
-        glGetUniformfvARB = NULL;
-        glGetUniformiv = NULL;
-        glGetUniformivARB = NULL;
-        glGetUniformui64vNV = NULL;
-        glGetUniformuiv = NULL;
-        glGetUniformuivEXT = NULL;
-        glGetVariantArrayObjectfvATI = NULL;
-        glGetVariantArrayObjectivATI = NULL;
-        glGetVariantBooleanvEXT = NULL;
-        glGetVariantFloatvEXT = NULL;
-        glGetVariantIntegervEXT = NULL;
-        glGetVariantPointervEXT = NULL;
-        glGetVaryingLocationNV = NULL;
-        glGetVertexAttribArrayObjectfvATI = NULL;
-        glGetVertexAttribArrayObjectivATI = NULL;
-        glGetVertexAttribIiv = NULL;
-        glGetVertexAttribIivEXT = NULL;
-        glGetVertexAttribIuiv = NULL;
-        glGetVertexAttribIuivEXT = NULL;
-        glGetVertexAttribPointerv = NULL;
-        glGetVertexAttribPointervARB = NULL;
-        glGetVertexAttribPointervNV = NULL;
-        glGetVertexAttribdv = NULL;
-        glGetVertexAttribdvARB = NULL;
-        glGetVertexAttribdvNV = NULL;
-        glGetVertexAttribfv = NULL;
-        glGetVertexAttribfvARB = NULL;
-        glGetVertexAttribfvNV = NULL;
-        glGetVertexAttribiv = NULL;
-        glGetVertexAttribivARB = NULL;
-        glGetVertexAttribivNV = NULL;
-        glGetVideoCaptureStreamdvNV = NULL;
-        glGetVideoCaptureStreamfvNV = NULL;
-        glGetVideoCaptureStreamivNV = NULL;
-        glGetVideoCaptureivNV = NULL;
-        glGetVideoi64vNV = NULL;
-        glGetVideoivNV = NULL;
-        glGetVideoui64vNV = NULL;
-        glGetVideouivNV = NULL;
-        glGlobalAlphaFactorbSUN = NULL;
-        glGlobalAlphaFactordSUN = NULL;
-        glGlobalAlphaFactorfSUN = NULL;
-        glGlobalAlphaFactoriSUN = NULL;
-        glGlobalAlphaFactorsSUN = NULL;
-        glGlobalAlphaFactorubSUN = NULL;
-        glGlobalAlphaFactoruiSUN = NULL;
-        glGlobalAlphaFactorusSUN = NULL;
-        glHintPGI = NULL;
-        glHistogram = NULL;
-        glHistogramEXT = NULL;
-        glIglooInterfaceSGIX = NULL;
-        glImageTransformParameterfHP = NULL;
-        glImageTransformParameterfvHP = NULL;
-        glImageTransformParameteriHP = NULL;
-        glImageTransformParameterivHP = NULL;
-        glIndexFormatNV = NULL;
-        glIndexFuncEXT = NULL;
-        glIndexMaterialEXT = NULL;
-        glIndexPointerEXT = NULL;
-        glIndexPointerListIBM = NULL;
-        glInsertComponentEXT = NULL;
-        glInstrumentsBufferSGIX = NULL;
-        glIsAsyncMarkerSGIX = NULL;
-        glIsBuffer = NULL;
-        glIsBufferARB = NULL;
-        glIsBufferResidentNV = NULL;
-        glIsEnabledIndexedEXT = NULL;
-        glIsEnabledi = NULL;
-        glIsFenceAPPLE = NULL;
-        glIsFenceNV = NULL;
-        glIsFramebuffer = NULL;
-        glIsFramebufferEXT = NULL;
-        glIsNamedBufferResidentNV = NULL;
-        glIsNamedStringARB = NULL;
-        glIsObjectBufferATI = NULL;
-        glIsOcclusionQueryNV = NULL;
-        glIsProgram = NULL;
-        glIsProgramARB = NULL;
-        glIsProgramNV = NULL;
-        glIsQuery = NULL;
-        glIsQueryARB = NULL;
-        glIsRenderbuffer = NULL;
-        glIsRenderbufferEXT = NULL;
-        glIsSampler = NULL;
-        glIsShader = NULL;
-        glIsSync = NULL;
-        glIsTextureEXT = NULL;
-        glIsTransformFeedback = NULL;
-        glIsTransformFeedbackNV = NULL;
-        glIsVariantEnabledEXT = NULL;
-        glIsVertexArray = NULL;
-        glIsVertexArrayAPPLE = NULL;
-        glIsVertexAttribEnabledAPPLE = NULL;
-        glLightEnviSGIX = NULL;
-        glLinkProgram = NULL;
-        glLinkProgramARB = NULL;
-        glListParameterfSGIX = NULL;
-        glListParameterfvSGIX = NULL;
-        glListParameteriSGIX = NULL;
-        glListParameterivSGIX = NULL;
-        glLoadIdentityDeformationMapSGIX = NULL;
-        glLoadProgramNV = NULL;
-        glLoadTransposeMatrixd = NULL;
-        glLoadTransposeMatrixdARB = NULL;
-        glLoadTransposeMatrixf = NULL;
-        glLoadTransposeMatrixfARB = NULL;
-        glLockArraysEXT = NULL;
-        glMakeBufferNonResidentNV = NULL;
-        glMakeBufferResidentNV = NULL;
-        glMakeNamedBufferNonResidentNV = NULL;
-        glMakeNamedBufferResidentNV = NULL;
-        glMapBuffer = NULL;
-        glMapBufferARB = NULL;
-        glMapBufferRange = NULL;
-        glMapControlPointsNV = NULL;
-        glMapNamedBufferEXT = NULL;
-        glMapNamedBufferRangeEXT = NULL;
-        glMapObjectBufferATI = NULL;
-        glMapParameterfvNV = NULL;
-        glMapParameterivNV = NULL;
-        glMapVertexAttrib1dAPPLE = NULL;
-        glMapVertexAttrib1fAPPLE = NULL;
-        glMapVertexAttrib2dAPPLE = NULL;
-        glMapVertexAttrib2fAPPLE = NULL;
-        glMatrixFrustumEXT = NULL;
-        glMatrixIndexPointerARB = NULL;
-        glMatrixIndexubvARB = NULL;
-        glMatrixIndexuivARB = NULL;
-        glMatrixIndexusvARB = NULL;
-        glMatrixLoadIdentityEXT = NULL;
-        glMatrixLoadTransposedEXT = NULL;
-        glMatrixLoadTransposefEXT = NULL;
-        glMatrixLoaddEXT = NULL;
-        glMatrixLoadfEXT = NULL;
-        glMatrixMultTransposedEXT = NULL;
-        glMatrixMultTransposefEXT = NULL;
-        glMatrixMultdEXT = NULL;
-        glMatrixMultfEXT = NULL;
-        glMatrixOrthoEXT = NULL;
-        glMatrixPopEXT = NULL;
-        glMatrixPushEXT = NULL;
-        glMatrixRotatedEXT = NULL;
-        glMatrixRotatefEXT = NULL;
-        glMatrixScaledEXT = NULL;
-        glMatrixScalefEXT = NULL;
-        glMatrixTranslatedEXT = NULL;
-        glMatrixTranslatefEXT = NULL;
-        glMinSampleShading = NULL;
-        glMinmax = NULL;
-        glMinmaxEXT = NULL;
-        glMultTransposeMatrixd = NULL;
-        glMultTransposeMatrixdARB = NULL;
-        glMultTransposeMatrixf = NULL;
-        glMultTransposeMatrixfARB = NULL;
-        glMultiDrawArrays = NULL;
-        glMultiDrawArraysEXT = NULL;
-        glMultiDrawElementArrayAPPLE = NULL;
-        glMultiDrawElements = NULL;
-        glMultiDrawElementsBaseVertex = NULL;
-        glMultiDrawElementsEXT = NULL;
-        glMultiDrawRangeElementArrayAPPLE = NULL;
-        glMultiModeDrawArraysIBM = NULL;
-        glMultiModeDrawElementsIBM = NULL;
-        glMultiTexBufferEXT = NULL;
-        glMultiTexCoord1d = NULL;
-        glMultiTexCoord1dARB = NULL;
-        glMultiTexCoord1dv = NULL;
-        glMultiTexCoord1dvARB = NULL;
-        glMultiTexCoord1f = NULL;
-        glMultiTexCoord1fARB = NULL;
-        glMultiTexCoord1fv = NULL;
-        glMultiTexCoord1fvARB = NULL;
-        glMultiTexCoord1hNV = NULL;
-        glMultiTexCoord1hvNV = NULL;
-        glMultiTexCoord1i = NULL;
-        glMultiTexCoord1iARB = NULL;
-        glMultiTexCoord1iv = NULL;
-        glMultiTexCoord1ivARB = NULL;
-        glMultiTexCoord1s = NULL;
-        glMultiTexCoord1sARB = NULL;
-        glMultiTexCoord1sv = NULL;
-        glMultiTexCoord1svARB = NULL;
-        glMultiTexCoord2d = NULL;
-        glMultiTexCoord2dARB = NULL;
-        glMultiTexCoord2dv = NULL;
-        glMultiTexCoord2dvARB = NULL;
-        glMultiTexCoord2f = NULL;
-        glMultiTexCoord2fARB = NULL;
-        glMultiTexCoord2fv = NULL;
-        glMultiTexCoord2fvARB = NULL;
-        glMultiTexCoord2hNV = NULL;
-        glMultiTexCoord2hvNV = NULL;
-        glMultiTexCoord2i = NULL;
-        glMultiTexCoord2iARB = NULL;
-        glMultiTexCoord2iv = NULL;
-        glMultiTexCoord2ivARB = NULL;
-        glMultiTexCoord2s = NULL;
-        glMultiTexCoord2sARB = NULL;
-        glMultiTexCoord2sv = NULL;
-        glMultiTexCoord2svARB = NULL;
-        glMultiTexCoord3d = NULL;
-        glMultiTexCoord3dARB = NULL;
-        glMultiTexCoord3dv = NULL;
-        glMultiTexCoord3dvARB = NULL;
-        glMultiTexCoord3f = NULL;
-        glMultiTexCoord3fARB = NULL;
-        glMultiTexCoord3fv = NULL;
-        glMultiTexCoord3fvARB = NULL;
-        glMultiTexCoord3hNV = NULL;
-        glMultiTexCoord3hvNV = NULL;
-        glMultiTexCoord3i = NULL;
-        glMultiTexCoord3iARB = NULL;
-        glMultiTexCoord3iv = NULL;
-        glMultiTexCoord3ivARB = NULL;
-        glMultiTexCoord3s = NULL;
-        glMultiTexCoord3sARB = NULL;
-        glMultiTexCoord3sv = NULL;
-        glMultiTexCoord3svARB = NULL;
-        glMultiTexCoord4d = NULL;
-        glMultiTexCoord4dARB = NULL;
-        glMultiTexCoord4dv = NULL;
-        glMultiTexCoord4dvARB = NULL;
-        glMultiTexCoord4f = NULL;
-        glMultiTexCoord4fARB = NULL;
-        glMultiTexCoord4fv = NULL;
-        glMultiTexCoord4fvARB = NULL;
-        glMultiTexCoord4hNV = NULL;
-        glMultiTexCoord4hvNV = NULL;
-        glMultiTexCoord4i = NULL;
-        glMultiTexCoord4iARB = NULL;
-        glMultiTexCoord4iv = NULL;
-        glMultiTexCoord4ivARB = NULL;
-        glMultiTexCoord4s = NULL;
-        glMultiTexCoord4sARB = NULL;
-        glMultiTexCoord4sv = NULL;
-        glMultiTexCoord4svARB = NULL;
-        glMultiTexCoordP1ui = NULL;
-        glMultiTexCoordP1uiv = NULL;
-        glMultiTexCoordP2ui = NULL;
-        glMultiTexCoordP2uiv = NULL;
-        glMultiTexCoordP3ui = NULL;
-        glMultiTexCoordP3uiv = NULL;
-        glMultiTexCoordP4ui = NULL;
-        glMultiTexCoordP4uiv = NULL;
-        glMultiTexCoordPointerEXT = NULL;
-        glMultiTexEnvfEXT = NULL;
-        glMultiTexEnvfvEXT = NULL;
-        glMultiTexEnviEXT = NULL;
-        glMultiTexEnvivEXT = NULL;
-        glMultiTexGendEXT = NULL;
-        glMultiTexGendvEXT = NULL;
-        glMultiTexGenfEXT = NULL;
-        glMultiTexGenfvEXT = NULL;
-        glMultiTexGeniEXT = NULL;
-        glMultiTexGenivEXT = NULL;
-        glMultiTexImage1DEXT = NULL;
-        glMultiTexImage2DEXT = NULL;
-        glMultiTexImage3DEXT = NULL;
-        glMultiTexParameterIivEXT = NULL;
-        glMultiTexParameterIuivEXT = NULL;
-        glMultiTexParameterfEXT = NULL;
-        glMultiTexParameterfvEXT = NULL;
-        glMultiTexParameteriEXT = NULL;
-        glMultiTexParameterivEXT = NULL;
-        glMultiTexRenderbufferEXT = NULL;
-        glMultiTexSubImage1DEXT = NULL;
-        glMultiTexSubImage2DEXT = NULL;
-        glMultiTexSubImage3DEXT = NULL;
-        glNamedBufferDataEXT = NULL;
-        glNamedBufferSubDataEXT = NULL;
-        glNamedCopyBufferSubDataEXT = NULL;
-        glNamedFramebufferRenderbufferEXT = NULL;
-        glNamedFramebufferTexture1DEXT = NULL;
-        glNamedFramebufferTexture2DEXT = NULL;
-        glNamedFramebufferTexture3DEXT = NULL;
-        glNamedFramebufferTextureEXT = NULL;
-        glNamedFramebufferTextureFaceEXT = NULL;
-        glNamedFramebufferTextureLayerEXT = NULL;
-        glNamedProgramLocalParameter4dEXT = NULL;
-        glNamedProgramLocalParameter4dvEXT = NULL;
-        glNamedProgramLocalParameter4fEXT = NULL;
-        glNamedProgramLocalParameter4fvEXT = NULL;
-        glNamedProgramLocalParameterI4iEXT = NULL;
-        glNamedProgramLocalParameterI4ivEXT = NULL;
-        glNamedProgramLocalParameterI4uiEXT = NULL;
-        glNamedProgramLocalParameterI4uivEXT = NULL;
-        glNamedProgramLocalParameters4fvEXT = NULL;
-        glNamedProgramLocalParametersI4ivEXT = NULL;
-        glNamedProgramLocalParametersI4uivEXT = NULL;
-        glNamedProgramStringEXT = NULL;
-        glNamedRenderbufferStorageEXT = NULL;
-        glNamedRenderbufferStorageMultisampleCoverageEXT = NULL;
-        glNamedRenderbufferStorageMultisampleEXT = NULL;
-        glNamedStringARB = NULL;
-        glNewObjectBufferATI = NULL;
-        glNormal3fVertex3fSUN = NULL;
-        glNormal3fVertex3fvSUN = NULL;
-        glNormal3hNV = NULL;
-        glNormal3hvNV = NULL;
-        glNormalFormatNV = NULL;
-        glNormalP3ui = NULL;
-        glNormalP3uiv = NULL;
-        glNormalPointerEXT = NULL;
-        glNormalPointerListIBM = NULL;
-        glNormalPointervINTEL = NULL;
-        glNormalStream3bATI = NULL;
-        glNormalStream3bvATI = NULL;
-        glNormalStream3dATI = NULL;
-        glNormalStream3dvATI = NULL;
-        glNormalStream3fATI = NULL;
-        glNormalStream3fvATI = NULL;
-        glNormalStream3iATI = NULL;
-        glNormalStream3ivATI = NULL;
-        glNormalStream3sATI = NULL;
-        glNormalStream3svATI = NULL;
-        glObjectPurgeableAPPLE = NULL;
-        glObjectUnpurgeableAPPLE = NULL;
-        glPNTrianglesfATI = NULL;
-        glPNTrianglesiATI = NULL;
-        glPassTexCoordATI = NULL;
-        glPatchParameterfv = NULL;
-        glPatchParameteri = NULL;
-        glPauseTransformFeedback = NULL;
-        glPauseTransformFeedbackNV = NULL;
-        glPixelDataRangeNV = NULL;
-        glPixelTexGenParameterfSGIS = NULL;
-        glPixelTexGenParameterfvSGIS = NULL;
-        glPixelTexGenParameteriSGIS = NULL;
-        glPixelTexGenParameterivSGIS = NULL;
-        glPixelTexGenSGIX = NULL;
-        glPixelTransformParameterfEXT = NULL;
-        glPixelTransformParameterfvEXT = NULL;
-        glPixelTransformParameteriEXT = NULL;
-        glPixelTransformParameterivEXT = NULL;
-        glPointParameterf = NULL;
-        glPointParameterfARB = NULL;
-        glPointParameterfEXT = NULL;
-        glPointParameterfSGIS = NULL;
-        glPointParameterfv = NULL;
-        glPointParameterfvARB = NULL;
-        glPointParameterfvEXT = NULL;
-        glPointParameterfvSGIS = NULL;
-        glPointParameteri = NULL;
-        glPointParameteriNV = NULL;
-        glPointParameteriv = NULL;
-        glPointParameterivNV = NULL;
-        glPollAsyncSGIX = NULL;
-        glPollInstrumentsSGIX = NULL;
-        glPolygonOffsetEXT = NULL;
-        glPresentFrameDualFillNV = NULL;
-        glPresentFrameKeyedNV = NULL;
-        glPrimitiveRestartIndex = NULL;
-        glPrimitiveRestartIndexNV = NULL;
-        glPrimitiveRestartNV = NULL;
-        glPrioritizeTexturesEXT = NULL;
-        glProgramBufferParametersIivNV = NULL;
-        glProgramBufferParametersIuivNV = NULL;
-        glProgramBufferParametersfvNV = NULL;
-        glProgramEnvParameter4dARB = NULL;
-        glProgramEnvParameter4dvARB = NULL;
-        glProgramEnvParameter4fARB = NULL;
-        glProgramEnvParameter4fvARB = NULL;
-        glProgramEnvParameterI4iNV = NULL;
-        glProgramEnvParameterI4ivNV = NULL;
-        glProgramEnvParameterI4uiNV = NULL;
-        glProgramEnvParameterI4uivNV = NULL;
-        glProgramEnvParameters4fvEXT = NULL;
-        glProgramEnvParametersI4ivNV = NULL;
-        glProgramEnvParametersI4uivNV = NULL;
-        glProgramLocalParameter4dARB = NULL;
-        glProgramLocalParameter4dvARB = NULL;
-        glProgramLocalParameter4fARB = NULL;
-        glProgramLocalParameter4fvARB = NULL;
-        glProgramLocalParameterI4iNV = NULL;
-        glProgramLocalParameterI4ivNV = NULL;
-        glProgramLocalParameterI4uiNV = NULL;
-        glProgramLocalParameterI4uivNV = NULL;
-        glProgramLocalParameters4fvEXT = NULL;
-        glProgramLocalParametersI4ivNV = NULL;
-        glProgramLocalParametersI4uivNV = NULL;
-        glProgramNamedParameter4dNV = NULL;
-        glProgramNamedParameter4dvNV = NULL;
-        glProgramNamedParameter4fNV = NULL;
-        glProgramNamedParameter4fvNV = NULL;
-        glProgramParameter4dNV = NULL;
-        glProgramParameter4dvNV = NULL;
-        glProgramParameter4fNV = NULL;
-        glProgramParameter4fvNV = NULL;
-        glProgramParameteri = NULL;
-        glProgramParameteriARB = NULL;
-        glProgramParameteriEXT = NULL;
-        glProgramParameters4dvNV = NULL;
-        glProgramParameters4fvNV = NULL;
-        glProgramStringARB = NULL;
-        glProgramUniform1dEXT = NULL;
-        glProgramUniform1dvEXT = NULL;
-        glProgramUniform1fEXT = NULL;
-        glProgramUniform1fvEXT = NULL;
-        glProgramUniform1iEXT = NULL;
-        glProgramUniform1ivEXT = NULL;
-        glProgramUniform1uiEXT = NULL;
-        glProgramUniform1uivEXT = NULL;
-        glProgramUniform2dEXT = NULL;
-        glProgramUniform2dvEXT = NULL;
-        glProgramUniform2fEXT = NULL;
-        glProgramUniform2fvEXT = NULL;
-        glProgramUniform2iEXT = NULL;
-        glProgramUniform2ivEXT = NULL;
-        glProgramUniform2uiEXT = NULL;
-        glProgramUniform2uivEXT = NULL;
-        glProgramUniform3dEXT = NULL;
-        glProgramUniform3dvEXT = NULL;
-        glProgramUniform3fEXT = NULL;
-        glProgramUniform3fvEXT = NULL;
-        glProgramUniform3iEXT = NULL;
-        glProgramUniform3ivEXT = NULL;
-        glProgramUniform3uiEXT = NULL;
-        glProgramUniform3uivEXT = NULL;
-        glProgramUniform4dEXT = NULL;
-        glProgramUniform4dvEXT = NULL;
-        glProgramUniform4fEXT = NULL;
-        glProgramUniform4fvEXT = NULL;
-        glProgramUniform4iEXT = NULL;
-        glProgramUniform4ivEXT = NULL;
-        glProgramUniform4uiEXT = NULL;
-        glProgramUniform4uivEXT = NULL;
-        glProgramUniformMatrix2dvEXT = NULL;
-        glProgramUniformMatrix2fvEXT = NULL;
-        glProgramUniformMatrix2x3dvEXT = NULL;
-        glProgramUniformMatrix2x3fvEXT = NULL;
-        glProgramUniformMatrix2x4dvEXT = NULL;
-        glProgramUniformMatrix2x4fvEXT = NULL;
-        glProgramUniformMatrix3dvEXT = NULL;
-        glProgramUniformMatrix3fvEXT = NULL;
-        glProgramUniformMatrix3x2dvEXT = NULL;
-        glProgramUniformMatrix3x2fvEXT = NULL;
-        glProgramUniformMatrix3x4dvEXT = NULL;
-        glProgramUniformMatrix3x4fvEXT = NULL;
-        glProgramUniformMatrix4dvEXT = NULL;
-        glProgramUniformMatrix4fvEXT = NULL;
-        glProgramUniformMatrix4x2dvEXT = NULL;
-        glProgramUniformMatrix4x2fvEXT = NULL;
-        glProgramUniformMatrix4x3dvEXT = NULL;
-        glProgramUniformMatrix4x3fvEXT = NULL;
-        glProgramUniformui64NV = NULL;
-        glProgramUniformui64vNV = NULL;
-        glProgramVertexLimitNV = NULL;
-        glProvokingVertex = NULL;
-        glProvokingVertexEXT = NULL;
-        glPushClientAttribDefaultEXT = NULL;
-        glQueryCounter = NULL;
-        glReadInstrumentsSGIX = NULL;
-        glReferencePlaneSGIX = NULL;
-        glRenderbufferStorage = NULL;
-        glRenderbufferStorageEXT = NULL;
-        glRenderbufferStorageMultisample = NULL;
-        glRenderbufferStorageMultisampleCoverageNV = NULL;
-        glRenderbufferStorageMultisampleEXT = NULL;
-        glReplacementCodePointerSUN = NULL;
-        glReplacementCodeubSUN = NULL;
-        glReplacementCodeubvSUN = NULL;
-        glReplacementCodeuiColor3fVertex3fSUN = NULL;
-        glReplacementCodeuiColor3fVertex3fvSUN = NULL;
-        glReplacementCodeuiColor4fNormal3fVertex3fSUN = NULL;
-        glReplacementCodeuiColor4fNormal3fVertex3fvSUN = NULL;
-        glReplacementCodeuiColor4ubVertex3fSUN = NULL;
-        glReplacementCodeuiColor4ubVertex3fvSUN = NULL;
-        glReplacementCodeuiNormal3fVertex3fSUN = NULL;
-        glReplacementCodeuiNormal3fVertex3fvSUN = NULL;
-        glReplacementCodeuiSUN = NULL;
-        glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = NULL;
-        glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = NULL;
-        glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = NULL;
-        glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = NULL;
-        glReplacementCodeuiTexCoord2fVertex3fSUN = NULL;
-        glReplacementCodeuiTexCoord2fVertex3fvSUN = NULL;
-        glReplacementCodeuiVertex3fSUN = NULL;
-        glReplacementCodeuiVertex3fvSUN = NULL;
-        glReplacementCodeuivSUN = NULL;
-        glReplacementCodeusSUN = NULL;
-        glReplacementCodeusvSUN = NULL;
-        glRequestResidentProgramsNV = NULL;
-        glResetHistogram = NULL;
-        glResetHistogramEXT = NULL;
-        glResetMinmax = NULL;
-        glResetMinmaxEXT = NULL;
-        glResizeBuffersMESA = NULL;
-        glResumeTransformFeedback = NULL;
-        glResumeTransformFeedbackNV = NULL;
-        glSampleCoverage = NULL;
-        glSampleCoverageARB = NULL;
-        glSampleMapATI = NULL;
-        glSampleMaskEXT = NULL;
-        glSampleMaskIndexedNV = NULL;
-        glSampleMaskSGIS = NULL;
-        glSampleMaski = NULL;
-        glSamplePatternEXT = NULL;
-        glSamplePatternSGIS = NULL;
-        glSamplerParameterIiv = NULL;
-        glSamplerParameterIuiv = NULL;
-        glSamplerParameterf = NULL;
-        glSamplerParameterfv = NULL;
-        glSamplerParameteri = NULL;
-        glSamplerParameteriv = NULL;
-        glSecondaryColor3b = NULL;
-        glSecondaryColor3bEXT = NULL;
-        glSecondaryColor3bv = NULL;
-        glSecondaryColor3bvEXT = NULL;
-        glSecondaryColor3d = NULL;
-        glSecondaryColor3dEXT = NULL;
-        glSecondaryColor3dv = NULL;
-        glSecondaryColor3dvEXT = NULL;
-        glSecondaryColor3f = NULL;
-        glSecondaryColor3fEXT = NULL;
-        glSecondaryColor3fv = NULL;
-        glSecondaryColor3fvEXT = NULL;
-        glSecondaryColor3hNV = NULL;
-        glSecondaryColor3hvNV = NULL;
-        glSecondaryColor3i = NULL;
-        glSecondaryColor3iEXT = NULL;
-        glSecondaryColor3iv = NULL;
-        glSecondaryColor3ivEXT = NULL;
-        glSecondaryColor3s = NULL;
-        glSecondaryColor3sEXT = NULL;
-        glSecondaryColor3sv = NULL;
-        glSecondaryColor3svEXT = NULL;
-        glSecondaryColor3ub = NULL;
-        glSecondaryColor3ubEXT = NULL;
-        glSecondaryColor3ubv = NULL;
-        glSecondaryColor3ubvEXT = NULL;
-        glSecondaryColor3ui = NULL;
-        glSecondaryColor3uiEXT = NULL;
-        glSecondaryColor3uiv = NULL;
-        glSecondaryColor3uivEXT = NULL;
-        glSecondaryColor3us = NULL;
-        glSecondaryColor3usEXT = NULL;
-        glSecondaryColor3usv = NULL;
-        glSecondaryColor3usvEXT = NULL;
-        glSecondaryColorFormatNV = NULL;
-        glSecondaryColorP3ui = NULL;
-        glSecondaryColorP3uiv = NULL;
-        glSecondaryColorPointer = NULL;
-        glSecondaryColorPointerEXT = NULL;
-        glSecondaryColorPointerListIBM = NULL;
-        glSelectPerfMonitorCountersAMD = NULL;
-        glSeparableFilter2D = NULL;
-        glSeparableFilter2DEXT = NULL;
-        glSetFenceAPPLE = NULL;
-        glSetFenceNV = NULL;
-        glSetFragmentShaderConstantATI = NULL;
-        glSetInvariantEXT = NULL;
-        glSetLocalConstantEXT = NULL;
-        glShaderOp1EXT = NULL;
-        glShaderOp2EXT = NULL;
-        glShaderOp3EXT = NULL;
-        glShaderSource = NULL;
-        glShaderSourceARB = NULL;
-        glSharpenTexFuncSGIS = NULL;
-        glSpriteParameterfSGIX = NULL;
-        glSpriteParameterfvSGIX = NULL;
-        glSpriteParameteriSGIX = NULL;
-        glSpriteParameterivSGIX = NULL;
-        glStartInstrumentsSGIX = NULL;
-        glStencilClearTagEXT = NULL;
-        glStencilFuncSeparate = NULL;
-        glStencilFuncSeparateATI = NULL;
-        glStencilMaskSeparate = NULL;
-        glStencilOpSeparate = NULL;
-        glStencilOpSeparateATI = NULL;
-        glStopInstrumentsSGIX = NULL;
-        glStringMarkerGREMEDY = NULL;
-        glSwizzleEXT = NULL;
-        glTagSampleBufferSGIX = NULL;
-        glTangent3bEXT = NULL;
-        glTangent3bvEXT = NULL;
-        glTangent3dEXT = NULL;
-        glTangent3dvEXT = NULL;
-        glTangent3fEXT = NULL;
-        glTangent3fvEXT = NULL;
-        glTangent3iEXT = NULL;
-        glTangent3ivEXT = NULL;
-        glTangent3sEXT = NULL;
-        glTangent3svEXT = NULL;
-        glTangentPointerEXT = NULL;
-        glTbufferMask3DFX = NULL;
-        glTessellationFactorAMD = NULL;
-        glTessellationModeAMD = NULL;
-        glTestFenceAPPLE = NULL;
-        glTestFenceNV = NULL;
-        glTestObjectAPPLE = NULL;
-        glTexBuffer = NULL;
-        glTexBufferARB = NULL;
-        glTexBufferEXT = NULL;
-        glTexBumpParameterfvATI = NULL;
-        glTexBumpParameterivATI = NULL;
-        glTexCoord1hNV = NULL;
-        glTexCoord1hvNV = NULL;
-        glTexCoord2fColor3fVertex3fSUN = NULL;
-        glTexCoord2fColor3fVertex3fvSUN = NULL;
-        glTexCoord2fColor4fNormal3fVertex3fSUN = NULL;
-        glTexCoord2fColor4fNormal3fVertex3fvSUN = NULL;
-        glTexCoord2fColor4ubVertex3fSUN = NULL;
-        glTexCoord2fColor4ubVertex3fvSUN = NULL;
-        glTexCoord2fNormal3fVertex3fSUN = NULL;
-        glTexCoord2fNormal3fVertex3fvSUN = NULL;
-        glTexCoord2fVertex3fSUN = NULL;
-        glTexCoord2fVertex3fvSUN = NULL;
-        glTexCoord2hNV = NULL;
-        glTexCoord2hvNV = NULL;
-        glTexCoord3hNV = NULL;
-        glTexCoord3hvNV = NULL;
-        glTexCoord4fColor4fNormal3fVertex4fSUN = NULL;
-        glTexCoord4fColor4fNormal3fVertex4fvSUN = NULL;
-        glTexCoord4fVertex4fSUN = NULL;
-        glTexCoord4fVertex4fvSUN = NULL;
-        glTexCoord4hNV = NULL;
-        glTexCoord4hvNV = NULL;
-        glTexCoordFormatNV = NULL;
-        glTexCoordP1ui = NULL;
-        glTexCoordP1uiv = NULL;
-        glTexCoordP2ui = NULL;
-        glTexCoordP2uiv = NULL;
-        glTexCoordP3ui = NULL;
-        glTexCoordP3uiv = NULL;
-        glTexCoordP4ui = NULL;
-        glTexCoordP4uiv = NULL;
-        glTexCoordPointerEXT = NULL;
-        glTexCoordPointerListIBM = NULL;
-        glTexCoordPointervINTEL = NULL;
-        glTexFilterFuncSGIS = NULL;
-        glTexImage2DMultisample = NULL;
-        glTexImage3D = NULL;
-        glTexImage3DEXT = NULL;
-        glTexImage3DMultisample = NULL;
-        glTexImage4DSGIS = NULL;
-        glTexParameterIiv = NULL;
-        glTexParameterIivEXT = NULL;
-        glTexParameterIuiv = NULL;
-        glTexParameterIuivEXT = NULL;
-        glTexRenderbufferNV = NULL;
-        glTexSubImage1DEXT = NULL;
-        glTexSubImage2DEXT = NULL;
-        glTexSubImage3D = NULL;
-        glTexSubImage3DEXT = NULL;
-        glTexSubImage4DSGIS = NULL;
-        glTextureBarrierNV = NULL;
-        glTextureBufferEXT = NULL;
-        glTextureColorMaskSGIS = NULL;
-        glTextureImage1DEXT = NULL;
-        glTextureImage2DEXT = NULL;
-        glTextureImage3DEXT = NULL;
-        glTextureLightEXT = NULL;
-        glTextureMaterialEXT = NULL;
-        glTextureNormalEXT = NULL;
-        glTextureParameterIivEXT = NULL;
-        glTextureParameterIuivEXT = NULL;
-        glTextureParameterfEXT = NULL;
-        glTextureParameterfvEXT = NULL;
-        glTextureParameteriEXT = NULL;
-        glTextureParameterivEXT = NULL;
-        glTextureRangeAPPLE = NULL;
-        glTextureRenderbufferEXT = NULL;
-        glTextureSubImage1DEXT = NULL;
-        glTextureSubImage2DEXT = NULL;
-        glTextureSubImage3DEXT = NULL;
-        glTrackMatrixNV = NULL;
-        glTransformFeedbackAttribsNV = NULL;
-        glTransformFeedbackVaryings = NULL;
-        glTransformFeedbackVaryingsEXT = NULL;
-        glTransformFeedbackVaryingsNV = NULL;
-        glUniform1d = NULL;
-        glUniform1dv = NULL;
-        glUniform1f = NULL;
-        glUniform1fARB = NULL;
-        glUniform1fv = NULL;
-        glUniform1fvARB = NULL;
-        glUniform1i = NULL;
-        glUniform1iARB = NULL;
-        glUniform1iv = NULL;
-        glUniform1ivARB = NULL;
-        glUniform1ui = NULL;
-        glUniform1uiEXT = NULL;
-        glUniform1uiv = NULL;
-        glUniform1uivEXT = NULL;
-        glUniform2d = NULL;
-        glUniform2dv = NULL;
-        glUniform2f = NULL;
-        glUniform2fARB = NULL;
-        glUniform2fv = NULL;
-        glUniform2fvARB = NULL;
-        glUniform2i = NULL;
-        glUniform2iARB = NULL;
-        glUniform2iv = NULL;
-        glUniform2ivARB = NULL;
-        glUniform2ui = NULL;
-        glUniform2uiEXT = NULL;
-        glUniform2uiv = NULL;
-        glUniform2uivEXT = NULL;
-        glUniform3d = NULL;
-        glUniform3dv = NULL;
-        glUniform3f = NULL;
-        glUniform3fARB = NULL;
-        glUniform3fv = NULL;
-        glUniform3fvARB = NULL;
-        glUniform3i = NULL;
-        glUniform3iARB = NULL;
-        glUniform3iv = NULL;
-        glUniform3ivARB = NULL;
-        glUniform3ui = NULL;
-        glUniform3uiEXT = NULL;
-        glUniform3uiv = NULL;
-        glUniform3uivEXT = NULL;
-        glUniform4d = NULL;
-        glUniform4dv = NULL;
-        glUniform4f = NULL;
-        glUniform4fARB = NULL;
-        glUniform4fv = NULL;
-        glUniform4fvARB = NULL;
-        glUniform4i = NULL;
-        glUniform4iARB = NULL;
-        glUniform4iv = NULL;
-        glUniform4ivARB = NULL;
-        glUniform4ui = NULL;
-        glUniform4uiEXT = NULL;
-        glUniform4uiv = NULL;
-        glUniform4uivEXT = NULL;
-        glUniformBlockBinding = NULL;
-        glUniformBufferEXT = NULL;
-        glUniformMatrix2dv = NULL;
-        glUniformMatrix2fv = NULL;
-        glUniformMatrix2fvARB = NULL;
-        glUniformMatrix2x3dv = NULL;
-        glUniformMatrix2x3fv = NULL;
-        glUniformMatrix2x4dv = NULL;
-        glUniformMatrix2x4fv = NULL;
-        glUniformMatrix3dv = NULL;
-        glUniformMatrix3fv = NULL;
-        glUniformMatrix3fvARB = NULL;
-        glUniformMatrix3x2dv = NULL;
-        glUniformMatrix3x2fv = NULL;
-        glUniformMatrix3x4dv = NULL;
-        glUniformMatrix3x4fv = NULL;
-        glUniformMatrix4dv = NULL;
-        glUniformMatrix4fv = NULL;
-        glUniformMatrix4fvARB = NULL;
-        glUniformMatrix4x2dv = NULL;
-        glUniformMatrix4x2fv = NULL;
-        glUniformMatrix4x3dv = NULL;
-        glUniformMatrix4x3fv = NULL;
-        glUniformSubroutinesuiv = NULL;
-        glUniformui64NV = NULL;
-        glUniformui64vNV = NULL;
-        glUnlockArraysEXT = NULL;
-        glUnmapBuffer = NULL;
-        glUnmapBufferARB = NULL;
-        glUnmapNamedBufferEXT = NULL;
-        glUnmapObjectBufferATI = NULL;
-        glUpdateObjectBufferATI = NULL;
-        glUseProgram = NULL;
-        glUseProgramObjectARB = NULL;
-        glUseShaderProgramEXT = NULL;
-        glValidateProgram = NULL;
-        glValidateProgramARB = NULL;
-        glVariantArrayObjectATI = NULL;
-        glVariantPointerEXT = NULL;
-        glVariantbvEXT = NULL;
-        glVariantdvEXT = NULL;
-        glVariantfvEXT = NULL;
-        glVariantivEXT = NULL;
-        glVariantsvEXT = NULL;
-        glVariantubvEXT = NULL;
-        glVariantuivEXT = NULL;
-        glVariantusvEXT = NULL;
-        glVertex2hNV = NULL;
-        glVertex2hvNV = NULL;
-        glVertex3hNV = NULL;
-        glVertex3hvNV = NULL;
-        glVertex4hNV = NULL;
-        glVertex4hvNV = NULL;
-        glVertexArrayParameteriAPPLE = NULL;
-        glVertexArrayRangeAPPLE = NULL;
-        glVertexArrayRangeNV = NULL;
-        glVertexAttrib1d = NULL;
-        glVertexAttrib1dARB = NULL;
-        glVertexAttrib1dNV = NULL;
-        glVertexAttrib1dv = NULL;
-        glVertexAttrib1dvARB = NULL;
-        glVertexAttrib1dvNV = NULL;
-        glVertexAttrib1f = NULL;
-        glVertexAttrib1fARB = NULL;
-        glVertexAttrib1fNV = NULL;
-        glVertexAttrib1fv = NULL;
-        glVertexAttrib1fvARB = NULL;
-        glVertexAttrib1fvNV = NULL;
-        glVertexAttrib1hNV = NULL;
-        glVertexAttrib1hvNV = NULL;
-        glVertexAttrib1s = NULL;
-        glVertexAttrib1sARB = NULL;
-        glVertexAttrib1sNV = NULL;
-        glVertexAttrib1sv = NULL;
-        glVertexAttrib1svARB = NULL;
-        glVertexAttrib1svNV = NULL;
-        glVertexAttrib2d = NULL;
-        glVertexAttrib2dARB = NULL;
-        glVertexAttrib2dNV = NULL;
-        glVertexAttrib2dv = NULL;
-        glVertexAttrib2dvARB = NULL;
-        glVertexAttrib2dvNV = NULL;
-        glVertexAttrib2f = NULL;
-        glVertexAttrib2fARB = NULL;
-        glVertexAttrib2fNV = NULL;
-        glVertexAttrib2fv = NULL;
-        glVertexAttrib2fvARB = NULL;
-        glVertexAttrib2fvNV = NULL;
-        glVertexAttrib2hNV = NULL;
-        glVertexAttrib2hvNV = NULL;
-        glVertexAttrib2s = NULL;
-        glVertexAttrib2sARB = NULL;
-        glVertexAttrib2sNV = NULL;
-        glVertexAttrib2sv = NULL;
-        glVertexAttrib2svARB = NULL;
-        glVertexAttrib2svNV = NULL;
-        glVertexAttrib3d = NULL;
-        glVertexAttrib3dARB = NULL;
-        glVertexAttrib3dNV = NULL;
-        glVertexAttrib3dv = NULL;
-        glVertexAttrib3dvARB = NULL;
-        glVertexAttrib3dvNV = NULL;
-        glVertexAttrib3f = NULL;
-        glVertexAttrib3fARB = NULL;
-        glVertexAttrib3fNV = NULL;
-        glVertexAttrib3fv = NULL;
-        glVertexAttrib3fvARB = NULL;
-        glVertexAttrib3fvNV = NULL;
-        glVertexAttrib3hNV = NULL;
-        glVertexAttrib3hvNV = NULL;
-        glVertexAttrib3s = NULL;
-        glVertexAttrib3sARB = NULL;
-        glVertexAttrib3sNV = NULL;
-        glVertexAttrib3sv = NULL;
-        glVertexAttrib3svARB = NULL;
-        glVertexAttrib3svNV = NULL;
-        glVertexAttrib4Nbv = NULL;
-        glVertexAttrib4NbvARB = NULL;
-        glVertexAttrib4Niv = NULL;
-        glVertexAttrib4NivARB = NULL;
-        glVertexAttrib4Nsv = NULL;
-        glVertexAttrib4NsvARB = NULL;
-        glVertexAttrib4Nub = NULL;
-        glVertexAttrib4NubARB = NULL;
-        glVertexAttrib4Nubv = NULL;
-        glVertexAttrib4NubvARB = NULL;
-        glVertexAttrib4Nuiv = NULL;
-        glVertexAttrib4NuivARB = NULL;
-        glVertexAttrib4Nusv = NULL;
-        glVertexAttrib4NusvARB = NULL;
-        glVertexAttrib4bv = NULL;
-        glVertexAttrib4bvARB = NULL;
-        glVertexAttrib4d = NULL;
-        glVertexAttrib4dARB = NULL;
-        glVertexAttrib4dNV = NULL;
-        glVertexAttrib4dv = NULL;
-        glVertexAttrib4dvARB = NULL;
-        glVertexAttrib4dvNV = NULL;
-        glVertexAttrib4f = NULL;
-        glVertexAttrib4fARB = NULL;
-        glVertexAttrib4fNV = NULL;
-        glVertexAttrib4fv = NULL;
-        glVertexAttrib4fvARB = NULL;
-        glVertexAttrib4fvNV = NULL;
-        glVertexAttrib4hNV = NULL;
-        glVertexAttrib4hvNV = NULL;
-        glVertexAttrib4iv = NULL;
-        glVertexAttrib4ivARB = NULL;
-        glVertexAttrib4s = NULL;
-        glVertexAttrib4sARB = NULL;
-        glVertexAttrib4sNV = NULL;
-        glVertexAttrib4sv = NULL;
-        glVertexAttrib4svARB = NULL;
-        glVertexAttrib4svNV = NULL;
-        glVertexAttrib4ubNV = NULL;
-        glVertexAttrib4ubv = NULL;
-        glVertexAttrib4ubvARB = NULL;
-        glVertexAttrib4ubvNV = NULL;
-        glVertexAttrib4uiv = NULL;
-        glVertexAttrib4uivARB = NULL;
-        glVertexAttrib4usv = NULL;
-        glVertexAttrib4usvARB = NULL;
-        glVertexAttribArrayObjectATI = NULL;
-        glVertexAttribDivisorARB = NULL;
-        glVertexAttribFormatNV = NULL;
-        glVertexAttribI1i = NULL;
-        glVertexAttribI1iEXT = NULL;
-        glVertexAttribI1iv = NULL;
-        glVertexAttribI1ivEXT = NULL;
-        glVertexAttribI1ui = NULL;
-        glVertexAttribI1uiEXT = NULL;
-        glVertexAttribI1uiv = NULL;
-        glVertexAttribI1uivEXT = NULL;
-        glVertexAttribI2i = NULL;
-        glVertexAttribI2iEXT = NULL;
-        glVertexAttribI2iv = NULL;
-        glVertexAttribI2ivEXT = NULL;
-        glVertexAttribI2ui = NULL;
-        glVertexAttribI2uiEXT = NULL;
-        glVertexAttribI2uiv = NULL;
-        glVertexAttribI2uivEXT = NULL;
-        glVertexAttribI3i = NULL;
-        glVertexAttribI3iEXT = NULL;
-        glVertexAttribI3iv = NULL;
-        glVertexAttribI3ivEXT = NULL;
-        glVertexAttribI3ui = NULL;
-        glVertexAttribI3uiEXT = NULL;
-        glVertexAttribI3uiv = NULL;
-        glVertexAttribI3uivEXT = NULL;
-        glVertexAttribI4bv = NULL;
-        glVertexAttribI4bvEXT = NULL;
-        glVertexAttribI4i = NULL;
-        glVertexAttribI4iEXT = NULL;
-        glVertexAttribI4iv = NULL;
-        glVertexAttribI4ivEXT = NULL;
-        glVertexAttribI4sv = NULL;
-        glVertexAttribI4svEXT = NULL;
-        glVertexAttribI4ubv = NULL;
-        glVertexAttribI4ubvEXT = NULL;
-        glVertexAttribI4ui = NULL;
-        glVertexAttribI4uiEXT = NULL;
-        glVertexAttribI4uiv = NULL;
-        glVertexAttribI4uivEXT = NULL;
-        glVertexAttribI4usv = NULL;
-        glVertexAttribI4usvEXT = NULL;
-        glVertexAttribIFormatNV = NULL;
-        glVertexAttribIPointer = NULL;
-        glVertexAttribIPointerEXT = NULL;
-        glVertexAttribP1ui = NULL;
-        glVertexAttribP1uiv = NULL;
-        glVertexAttribP2ui = NULL;
-        glVertexAttribP2uiv = NULL;
-        glVertexAttribP3ui = NULL;
-        glVertexAttribP3uiv = NULL;
-        glVertexAttribP4ui = NULL;
-        glVertexAttribP4uiv = NULL;
-        glVertexAttribPointer = NULL;
-        glVertexAttribPointerARB = NULL;
-        glVertexAttribPointerNV = NULL;
-        glVertexAttribs1dvNV = NULL;
-        glVertexAttribs1fvNV = NULL;
-        glVertexAttribs1hvNV = NULL;
-        glVertexAttribs1svNV = NULL;
-        glVertexAttribs2dvNV = NULL;
-        glVertexAttribs2fvNV = NULL;
-        glVertexAttribs2hvNV = NULL;
-        glVertexAttribs2svNV = NULL;
-        glVertexAttribs3dvNV = NULL;
-        glVertexAttribs3fvNV = NULL;
-        glVertexAttribs3hvNV = NULL;
-        glVertexAttribs3svNV = NULL;
-        glVertexAttribs4dvNV = NULL;
-        glVertexAttribs4fvNV = NULL;
-        glVertexAttribs4hvNV = NULL;
-        glVertexAttribs4svNV = NULL;
-        glVertexAttribs4ubvNV = NULL;
-        glVertexBlendARB = NULL;
-        glVertexBlendEnvfATI = NULL;
-        glVertexBlendEnviATI = NULL;
-        glVertexFormatNV = NULL;
-        glVertexP2ui = NULL;
-        glVertexP2uiv = NULL;
-        glVertexP3ui = NULL;
-        glVertexP3uiv = NULL;
-        glVertexP4ui = NULL;
-        glVertexP4uiv = NULL;
-        glVertexPointerEXT = NULL;
-        glVertexPointerListIBM = NULL;
-        glVertexPointervINTEL = NULL;
-        glVertexStream1dATI = NULL;
-        glVertexStream1dvATI = NULL;
-        glVertexStream1fATI = NULL;
-        glVertexStream1fvATI = NULL;
-        glVertexStream1iATI = NULL;
-        glVertexStream1ivATI = NULL;
-        glVertexStream1sATI = NULL;
-        glVertexStream1svATI = NULL;
-        glVertexStream2dATI = NULL;
-        glVertexStream2dvATI = NULL;
-        glVertexStream2fATI = NULL;
-        glVertexStream2fvATI = NULL;
-        glVertexStream2iATI = NULL;
-        glVertexStream2ivATI = NULL;
-        glVertexStream2sATI = NULL;
-        glVertexStream2svATI = NULL;
-        glVertexStream3dATI = NULL;
-        glVertexStream3dvATI = NULL;
-        glVertexStream3fATI = NULL;
-        glVertexStream3fvATI = NULL;
-        glVertexStream3iATI = NULL;
-        glVertexStream3ivATI = NULL;
-        glVertexStream3sATI = NULL;
-        glVertexStream3svATI = NULL;
-        glVertexStream4dATI = NULL;
-        glVertexStream4dvATI = NULL;
-        glVertexStream4fATI = NULL;
-        glVertexStream4fvATI = NULL;
-        glVertexStream4iATI = NULL;
-        glVertexStream4ivATI = NULL;
-        glVertexStream4sATI = NULL;
-        glVertexStream4svATI = NULL;
-        glVertexWeightPointerEXT = NULL;
-        glVertexWeightfEXT = NULL;
-        glVertexWeightfvEXT = NULL;
-        glVertexWeighthNV = NULL;
-        glVertexWeighthvNV = NULL;
-        glVideoCaptureNV = NULL;
-        glVideoCaptureStreamParameterdvNV = NULL;
-        glVideoCaptureStreamParameterfvNV = NULL;
-        glVideoCaptureStreamParameterivNV = NULL;
-        glWaitSync = NULL;
-        glWeightPointerARB = NULL;
-        glWeightbvARB = NULL;
-        glWeightdvARB = NULL;
-        glWeightfvARB = NULL;
-        glWeightivARB = NULL;
-        glWeightsvARB = NULL;
-        glWeightubvARB = NULL;
-        glWeightuivARB = NULL;
-        glWeightusvARB = NULL;
-        glWindowPos2d = NULL;
-        glWindowPos2dARB = NULL;
-        glWindowPos2dMESA = NULL;
-        glWindowPos2dv = NULL;
-        glWindowPos2dvARB = NULL;
-        glWindowPos2dvMESA = NULL;
-        glWindowPos2f = NULL;
-        glWindowPos2fARB = NULL;
-        glWindowPos2fMESA = NULL;
-        glWindowPos2fv = NULL;
-        glWindowPos2fvARB = NULL;
-        glWindowPos2fvMESA = NULL;
-        glWindowPos2i = NULL;
-        glWindowPos2iARB = NULL;
-        glWindowPos2iMESA = NULL;
-        glWindowPos2iv = NULL;
-        glWindowPos2ivARB = NULL;
-        glWindowPos2ivMESA = NULL;
-        glWindowPos2s = NULL;
-        glWindowPos2sARB = NULL;
-        glWindowPos2sMESA = NULL;
-        glWindowPos2sv = NULL;
-        glWindowPos2svARB = NULL;
-        glWindowPos2svMESA = NULL;
-        glWindowPos3d = NULL;
-        glWindowPos3dARB = NULL;
-        glWindowPos3dMESA = NULL;
-        glWindowPos3dv = NULL;
-        glWindowPos3dvARB = NULL;
-        glWindowPos3dvMESA = NULL;
-        glWindowPos3f = NULL;
-        glWindowPos3fARB = NULL;
-        glWindowPos3fMESA = NULL;
-        glWindowPos3fv = NULL;
-        glWindowPos3fvARB = NULL;
-        glWindowPos3fvMESA = NULL;
-        glWindowPos3i = NULL;
-        glWindowPos3iARB = NULL;
-        glWindowPos3iMESA = NULL;
-        glWindowPos3iv = NULL;
-        glWindowPos3ivARB = NULL;
-        glWindowPos3ivMESA = NULL;
-        glWindowPos3s = NULL;
-        glWindowPos3sARB = NULL;
-        glWindowPos3sMESA = NULL;
-        glWindowPos3sv = NULL;
-        glWindowPos3svARB = NULL;
-        glWindowPos3svMESA = NULL;
-        glWindowPos4dMESA = NULL;
-        glWindowPos4dvMESA = NULL;
-        glWindowPos4fMESA = NULL;
-        glWindowPos4fvMESA = NULL;
-        glWindowPos4iMESA = NULL;
-        glWindowPos4ivMESA = NULL;
-        glWindowPos4sMESA = NULL;
-        glWindowPos4svMESA = NULL;
-        glWriteMaskEXT = NULL;
+        glActiveTexture = Lazy_glActiveTexture;
+        glAttachShader = Lazy_glAttachShader;
+        glBindBuffer = Lazy_glBindBuffer;
+        glBindMultiTextureEXT = Lazy_glBindMultiTextureEXT;
+        glBindRenderbuffer = Lazy_glBindRenderbuffer;
+        glBindRenderbufferEXT = Lazy_glBindRenderbufferEXT;
+        glBufferData = Lazy_glBufferData;
+        glBufferSubData = Lazy_glBufferSubData;
+        glClientWaitSync = Lazy_glClientWaitSync;
+        glCompileShader = Lazy_glCompileShader;
+        glCreateProgram = Lazy_glCreateProgram;
+        glCreateShader = Lazy_glCreateShader;
+        glDeleteBuffers = Lazy_glDeleteBuffers;
+        glDeleteProgram = Lazy_glDeleteProgram;
+        glDeleteRenderbuffers = Lazy_glDeleteRenderbuffers;
+        glDeleteRenderbuffersEXT = Lazy_glDeleteRenderbuffersEXT;
+        glDeleteShader = Lazy_glDeleteShader;
+        glDeleteSync = Lazy_glDeleteSync;
+        glDisableClientStateIndexedEXT = Lazy_glDisableClientStateIndexedEXT;
+        glDisableIndexedEXT = Lazy_glDisableIndexedEXT;
+        glDisableVertexAttribArray = Lazy_glDisableVertexAttribArray;
+        glEnableClientStateIndexedEXT = Lazy_glEnableClientStateIndexedEXT;
+        glEnableIndexedEXT = Lazy_glEnableIndexedEXT;
+        glEnableVertexAttribArray = Lazy_glEnableVertexAttribArray;
+        glFenceSync = Lazy_glFenceSync;
+        glGenBuffers = Lazy_glGenBuffers;
+        glGenRenderbuffers = Lazy_glGenRenderbuffers;
+        glGenRenderbuffersEXT = Lazy_glGenRenderbuffersEXT;
+        glGenerateMipmapEXT = Lazy_glGenerateMipmapEXT;
+        glGetProgramInfoLog = Lazy_glGetProgramInfoLog;
+        glGetShaderInfoLog = Lazy_glGetShaderInfoLog;
+        glGetStringi = Lazy_glGetStringi;
+        glGetUniformLocation = Lazy_glGetUniformLocation;
+        glLinkProgram = Lazy_glLinkProgram;
+        glMapBufferRange = Lazy_glMapBufferRange;
+        glMultiTexCoord2f = Lazy_glMultiTexCoord2f;
+        glMultiTexCoordPointerEXT = Lazy_glMultiTexCoordPointerEXT;
+        glMultiTexEnviEXT = Lazy_glMultiTexEnviEXT;
+        glProgramUniform1iEXT = Lazy_glProgramUniform1iEXT;
+        glProgramUniform3fvEXT = Lazy_glProgramUniform3fvEXT;
+        glProgramUniformMatrix4fvEXT = Lazy_glProgramUniformMatrix4fvEXT;
+        glRenderbufferStorage = Lazy_glRenderbufferStorage;
+        glRenderbufferStorageEXT = Lazy_glRenderbufferStorageEXT;
+        glShaderSource = Lazy_glShaderSource;
+        glUnmapBuffer = Lazy_glUnmapBuffer;
+        glUseProgram = Lazy_glUseProgram;
+        glVertexAttribPointer = Lazy_glVertexAttribPointer;
 
     }
 
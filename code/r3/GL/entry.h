@@ -11,1734 +11,58 @@
 
 namespace r3 {
 
-    extern PFNGLACTIVEPROGRAMEXTPROC glActiveProgramEXT;
-    extern PFNGLACTIVESTENCILFACEEXTPROC glActiveStencilFaceEXT;
     extern PFNGLACTIVETEXTUREPROC glActiveTexture;
-    extern PFNGLACTIVETEXTUREARBPROC glActiveTextureARB;
-    extern PFNGLACTIVEVARYINGNVPROC glActiveVaryingNV;
-    extern PFNGLALPHAFRAGMENTOP1ATIPROC glAlphaFragmentOp1ATI;
-    extern PFNGLALPHAFRAGMENTOP2ATIPROC glAlphaFragmentOp2ATI;
-    extern PFNGLALPHAFRAGMENTOP3ATIPROC glAlphaFragmentOp3ATI;
-    extern PFNGLAPPLYTEXTUREEXTPROC glApplyTextureEXT;
-    extern PFNGLAREPROGRAMSRESIDENTNVPROC glAreProgramsResidentNV;
-    extern PFNGLARETEXTURESRESIDENTEXTPROC glAreTexturesResidentEXT;
-    extern PFNGLARRAYELEMENTEXTPROC glArrayElementEXT;
-    extern PFNGLARRAYOBJECTATIPROC glArrayObjectATI;
-    extern PFNGLASYNCMARKERSGIXPROC glAsyncMarkerSGIX;
-    extern PFNGLATTACHOBJECTARBPROC glAttachObjectARB;
     extern PFNGLATTACHSHADERPROC glAttachShader;
-    extern PFNGLBEGINCONDITIONALRENDERPROC glBeginConditionalRender;
-    extern PFNGLBEGINCONDITIONALRENDERNVPROC glBeginConditionalRenderNV;
-    extern PFNGLBEGINFRAGMENTSHADERATIPROC glBeginFragmentShaderATI;
-    extern PFNGLBEGINOCCLUSIONQUERYNVPROC glBeginOcclusionQueryNV;
-    extern PFNGLBEGINPERFMONITORAMDPROC glBeginPerfMonitorAMD;
-    extern PFNGLBEGINQUERYPROC glBeginQuery;
-    extern PFNGLBEGINQUERYARBPROC glBeginQueryARB;
-    extern PFNGLBEGINQUERYINDEXEDPROC glBeginQueryIndexed;
-    extern PFNGLBEGINTRANSFORMFEEDBACKPROC glBeginTransformFeedback;
-    extern PFNGLBEGINTRANSFORMFEEDBACKEXTPROC glBeginTransformFeedbackEXT;
-    extern PFNGLBEGINTRANSFORMFEEDBACKNVPROC glBeginTransformFeedbackNV;
-    extern PFNGLBEGINVERTEXSHADEREXTPROC glBeginVertexShaderEXT;
-    extern PFNGLBEGINVIDEOCAPTURENVPROC glBeginVideoCaptureNV;
-    extern PFNGLBINDATTRIBLOCATIONPROC glBindAttribLocation;
-    extern PFNGLBINDATTRIBLOCATIONARBPROC glBindAttribLocationARB;
     extern PFNGLBINDBUFFERPROC glBindBuffer;
-    extern PFNGLBINDBUFFERARBPROC glBindBufferARB;
-    extern PFNGLBINDBUFFERBASEPROC glBindBufferBase;
-    extern PFNGLBINDBUFFERBASEEXTPROC glBindBufferBaseEXT;
-    extern PFNGLBINDBUFFERBASENVPROC glBindBufferBaseNV;
-    extern PFNGLBINDBUFFEROFFSETEXTPROC glBindBufferOffsetEXT;
-    extern PFNGLBINDBUFFEROFFSETNVPROC glBindBufferOffsetNV;
-    extern PFNGLBINDBUFFERRANGEPROC glBindBufferRange;
-    extern PFNGLBINDBUFFERRANGEEXTPROC glBindBufferRangeEXT;
-    extern PFNGLBINDBUFFERRANGENVPROC glBindBufferRangeNV;
-    extern PFNGLBINDFRAGDATALOCATIONPROC glBindFragDataLocation;
-    extern PFNGLBINDFRAGDATALOCATIONEXTPROC glBindFragDataLocationEXT;
-    extern PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glBindFragDataLocationIndexed;
-    extern PFNGLBINDFRAGMENTSHADERATIPROC glBindFragmentShaderATI;
-    extern PFNGLBINDFRAMEBUFFERPROC glBindFramebuffer;
-    extern PFNGLBINDFRAMEBUFFEREXTPROC glBindFramebufferEXT;
-    extern PFNGLBINDLIGHTPARAMETEREXTPROC glBindLightParameterEXT;
-    extern PFNGLBINDMATERIALPARAMETEREXTPROC glBindMaterialParameterEXT;
     extern PFNGLBINDMULTITEXTUREEXTPROC glBindMultiTextureEXT;
-    extern PFNGLBINDPARAMETEREXTPROC glBindParameterEXT;
-    extern PFNGLBINDPROGRAMARBPROC glBindProgramARB;
-    extern PFNGLBINDPROGRAMNVPROC glBindProgramNV;
     extern PFNGLBINDRENDERBUFFERPROC glBindRenderbuffer;
     extern PFNGLBINDRENDERBUFFEREXTPROC glBindRenderbufferEXT;
-    extern PFNGLBINDSAMPLERPROC glBindSampler;
-    extern PFNGLBINDTEXGENPARAMETEREXTPROC glBindTexGenParameterEXT;
-    extern PFNGLBINDTEXTUREEXTPROC glBindTextureEXT;
-    extern PFNGLBINDTEXTUREUNITPARAMETEREXTPROC glBindTextureUnitParameterEXT;
-    extern PFNGLBINDTRANSFORMFEEDBACKPROC glBindTransformFeedback;
-    extern PFNGLBINDTRANSFORMFEEDBACKNVPROC glBindTransformFeedbackNV;
-    extern PFNGLBINDVERTEXARRAYPROC glBindVertexArray;
-    extern PFNGLBINDVERTEXARRAYAPPLEPROC glBindVertexArrayAPPLE;
-    extern PFNGLBINDVERTEXSHADEREXTPROC glBindVertexShaderEXT;
-    extern PFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC glBindVideoCaptureStreamBufferNV;
-    extern PFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC glBindVideoCaptureStreamTextureNV;
-    extern PFNGLBINORMAL3BEXTPROC glBinormal3bEXT;
-    extern PFNGLBINORMAL3BVEXTPROC glBinormal3bvEXT;
-    extern PFNGLBINORMAL3DEXTPROC glBinormal3dEXT;
-    extern PFNGLBINORMAL3DVEXTPROC glBinormal3dvEXT;
-    extern PFNGLBINORMAL3FEXTPROC glBinormal3fEXT;
-    extern PFNGLBINORMAL3FVEXTPROC glBinormal3fvEXT;
-    extern PFNGLBINORMAL3IEXTPROC glBinormal3iEXT;
-    extern PFNGLBINORMAL3IVEXTPROC glBinormal3ivEXT;
-    extern PFNGLBINORMAL3SEXTPROC glBinormal3sEXT;
-    extern PFNGLBINORMAL3SVEXTPROC glBinormal3svEXT;
-    extern PFNGLBINORMALPOINTEREXTPROC glBinormalPointerEXT;
-    extern PFNGLBLENDCOLORPROC glBlendColor;
-    extern PFNGLBLENDCOLOREXTPROC glBlendColorEXT;
-    extern PFNGLBLENDEQUATIONPROC glBlendEquation;
-    extern PFNGLBLENDEQUATIONEXTPROC glBlendEquationEXT;
-    extern PFNGLBLENDEQUATIONINDEXEDAMDPROC glBlendEquationIndexedAMD;
-    extern PFNGLBLENDEQUATIONSEPARATEPROC glBlendEquationSeparate;
-    extern PFNGLBLENDEQUATIONSEPARATEEXTPROC glBlendEquationSeparateEXT;
-    extern PFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC glBlendEquationSeparateIndexedAMD;
-    extern PFNGLBLENDEQUATIONSEPARATEIPROC glBlendEquationSeparatei;
-    extern PFNGLBLENDEQUATIONIPROC glBlendEquationi;
-    extern PFNGLBLENDFUNCINDEXEDAMDPROC glBlendFuncIndexedAMD;
-    extern PFNGLBLENDFUNCSEPARATEPROC glBlendFuncSeparate;
-    extern PFNGLBLENDFUNCSEPARATEEXTPROC glBlendFuncSeparateEXT;
-    extern PFNGLBLENDFUNCSEPARATEINGRPROC glBlendFuncSeparateINGR;
-    extern PFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC glBlendFuncSeparateIndexedAMD;
-    extern PFNGLBLENDFUNCSEPARATEIPROC glBlendFuncSeparatei;
-    extern PFNGLBLENDFUNCIPROC glBlendFunci;
-    extern PFNGLBLITFRAMEBUFFERPROC glBlitFramebuffer;
-    extern PFNGLBLITFRAMEBUFFEREXTPROC glBlitFramebufferEXT;
-    extern PFNGLBUFFERADDRESSRANGENVPROC glBufferAddressRangeNV;
     extern PFNGLBUFFERDATAPROC glBufferData;
-    extern PFNGLBUFFERDATAARBPROC glBufferDataARB;
-    extern PFNGLBUFFERPARAMETERIAPPLEPROC glBufferParameteriAPPLE;
     extern PFNGLBUFFERSUBDATAPROC glBufferSubData;
-    extern PFNGLBUFFERSUBDATAARBPROC glBufferSubDataARB;
-    extern PFNGLCHECKFRAMEBUFFERSTATUSPROC glCheckFramebufferStatus;
-    extern PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC glCheckFramebufferStatusEXT;
-    extern PFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC glCheckNamedFramebufferStatusEXT;
-    extern PFNGLCLAMPCOLORPROC glClampColor;
-    extern PFNGLCLAMPCOLORARBPROC glClampColorARB;
-    extern PFNGLCLEARBUFFERFIPROC glClearBufferfi;
-    extern PFNGLCLEARBUFFERFVPROC glClearBufferfv;
-    extern PFNGLCLEARBUFFERIVPROC glClearBufferiv;
-    extern PFNGLCLEARBUFFERUIVPROC glClearBufferuiv;
-    extern PFNGLCLEARCOLORIIEXTPROC glClearColorIiEXT;
-    extern PFNGLCLEARCOLORIUIEXTPROC glClearColorIuiEXT;
-    extern PFNGLCLEARDEPTHDNVPROC glClearDepthdNV;
-    extern PFNGLCLIENTACTIVETEXTUREPROC glClientActiveTexture;
-    extern PFNGLCLIENTACTIVETEXTUREARBPROC glClientActiveTextureARB;
-    extern PFNGLCLIENTACTIVEVERTEXSTREAMATIPROC glClientActiveVertexStreamATI;
-    extern PFNGLCLIENTATTRIBDEFAULTEXTPROC glClientAttribDefaultEXT;
     extern PFNGLCLIENTWAITSYNCPROC glClientWaitSync;
-    extern PFNGLCOLOR3FVERTEX3FSUNPROC glColor3fVertex3fSUN;
-    extern PFNGLCOLOR3FVERTEX3FVSUNPROC glColor3fVertex3fvSUN;
-    extern PFNGLCOLOR3HNVPROC glColor3hNV;
-    extern PFNGLCOLOR3HVNVPROC glColor3hvNV;
-    extern PFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC glColor4fNormal3fVertex3fSUN;
-    extern PFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC glColor4fNormal3fVertex3fvSUN;
-    extern PFNGLCOLOR4HNVPROC glColor4hNV;
-    extern PFNGLCOLOR4HVNVPROC glColor4hvNV;
-    extern PFNGLCOLOR4UBVERTEX2FSUNPROC glColor4ubVertex2fSUN;
-    extern PFNGLCOLOR4UBVERTEX2FVSUNPROC glColor4ubVertex2fvSUN;
-    extern PFNGLCOLOR4UBVERTEX3FSUNPROC glColor4ubVertex3fSUN;
-    extern PFNGLCOLOR4UBVERTEX3FVSUNPROC glColor4ubVertex3fvSUN;
-    extern PFNGLCOLORFORMATNVPROC glColorFormatNV;
-    extern PFNGLCOLORFRAGMENTOP1ATIPROC glColorFragmentOp1ATI;
-    extern PFNGLCOLORFRAGMENTOP2ATIPROC glColorFragmentOp2ATI;
-    extern PFNGLCOLORFRAGMENTOP3ATIPROC glColorFragmentOp3ATI;
-    extern PFNGLCOLORMASKINDEXEDEXTPROC glColorMaskIndexedEXT;
-    extern PFNGLCOLORMASKIPROC glColorMaski;
-    extern PFNGLCOLORP3UIPROC glColorP3ui;
-    extern PFNGLCOLORP3UIVPROC glColorP3uiv;
-    extern PFNGLCOLORP4UIPROC glColorP4ui;
-    extern PFNGLCOLORP4UIVPROC glColorP4uiv;
-    extern PFNGLCOLORPOINTEREXTPROC glColorPointerEXT;
-    extern PFNGLCOLORPOINTERLISTIBMPROC glColorPointerListIBM;
-    extern PFNGLCOLORPOINTERVINTELPROC glColorPointervINTEL;
-    extern PFNGLCOLORSUBTABLEPROC glColorSubTable;
-    extern PFNGLCOLORSUBTABLEEXTPROC glColorSubTableEXT;
-    extern PFNGLCOLORTABLEPROC glColorTable;
-    extern PFNGLCOLORTABLEEXTPROC glColorTableEXT;
-    extern PFNGLCOLORTABLEPARAMETERFVPROC glColorTableParameterfv;
-    extern PFNGLCOLORTABLEPARAMETERFVSGIPROC glColorTableParameterfvSGI;
-    extern PFNGLCOLORTABLEPARAMETERIVPROC glColorTableParameteriv;
-    extern PFNGLCOLORTABLEPARAMETERIVSGIPROC glColorTableParameterivSGI;
-    extern PFNGLCOLORTABLESGIPROC glColorTableSGI;
-    extern PFNGLCOMBINERINPUTNVPROC glCombinerInputNV;
-    extern PFNGLCOMBINEROUTPUTNVPROC glCombinerOutputNV;
-    extern PFNGLCOMBINERPARAMETERFNVPROC glCombinerParameterfNV;
-    extern PFNGLCOMBINERPARAMETERFVNVPROC glCombinerParameterfvNV;
-    extern PFNGLCOMBINERPARAMETERINVPROC glCombinerParameteriNV;
-    extern PFNGLCOMBINERPARAMETERIVNVPROC glCombinerParameterivNV;
-    extern PFNGLCOMBINERSTAGEPARAMETERFVNVPROC glCombinerStageParameterfvNV;
     extern PFNGLCOMPILESHADERPROC glCompileShader;
-    extern PFNGLCOMPILESHADERARBPROC glCompileShaderARB;
-    extern PFNGLCOMPILESHADERINCLUDEARBPROC glCompileShaderIncludeARB;
-    extern PFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC glCompressedMultiTexImage1DEXT;
-    extern PFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC glCompressedMultiTexImage2DEXT;
-    extern PFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC glCompressedMultiTexImage3DEXT;
-    extern PFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC glCompressedMultiTexSubImage1DEXT;
-    extern PFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC glCompressedMultiTexSubImage2DEXT;
-    extern PFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC glCompressedMultiTexSubImage3DEXT;
-    extern PFNGLCOMPRESSEDTEXIMAGE1DPROC glCompressedTexImage1D;
-    extern PFNGLCOMPRESSEDTEXIMAGE1DARBPROC glCompressedTexImage1DARB;
-    extern PFNGLCOMPRESSEDTEXIMAGE2DPROC glCompressedTexImage2D;
-    extern PFNGLCOMPRESSEDTEXIMAGE2DARBPROC glCompressedTexImage2DARB;
-    extern PFNGLCOMPRESSEDTEXIMAGE3DPROC glCompressedTexImage3D;
-    extern PFNGLCOMPRESSEDTEXIMAGE3DARBPROC glCompressedTexImage3DARB;
-    extern PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glCompressedTexSubImage1D;
-    extern PFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC glCompressedTexSubImage1DARB;
-    extern PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glCompressedTexSubImage2D;
-    extern PFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC glCompressedTexSubImage2DARB;
-    extern PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glCompressedTexSubImage3D;
-    extern PFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC glCompressedTexSubImage3DARB;
-    extern PFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC glCompressedTextureImage1DEXT;
-    extern PFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC glCompressedTextureImage2DEXT;
-    extern PFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC glCompressedTextureImage3DEXT;
-    extern PFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC glCompressedTextureSubImage1DEXT;
-    extern PFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC glCompressedTextureSubImage2DEXT;
-    extern PFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC glCompressedTextureSubImage3DEXT;
-    extern PFNGLCONVOLUTIONFILTER1DPROC glConvolutionFilter1D;
-    extern PFNGLCONVOLUTIONFILTER1DEXTPROC glConvolutionFilter1DEXT;
-    extern PFNGLCONVOLUTIONFILTER2DPROC glConvolutionFilter2D;
-    extern PFNGLCONVOLUTIONFILTER2DEXTPROC glConvolutionFilter2DEXT;
-    extern PFNGLCONVOLUTIONPARAMETERFPROC glConvolutionParameterf;
-    extern PFNGLCONVOLUTIONPARAMETERFEXTPROC glConvolutionParameterfEXT;
-    extern PFNGLCONVOLUTIONPARAMETERFVPROC glConvolutionParameterfv;
-    extern PFNGLCONVOLUTIONPARAMETERFVEXTPROC glConvolutionParameterfvEXT;
-    extern PFNGLCONVOLUTIONPARAMETERIPROC glConvolutionParameteri;
-    extern PFNGLCONVOLUTIONPARAMETERIEXTPROC glConvolutionParameteriEXT;
-    extern PFNGLCONVOLUTIONPARAMETERIVPROC glConvolutionParameteriv;
-    extern PFNGLCONVOLUTIONPARAMETERIVEXTPROC glConvolutionParameterivEXT;
-    extern PFNGLCOPYBUFFERSUBDATAPROC glCopyBufferSubData;
-    extern PFNGLCOPYCOLORSUBTABLEPROC glCopyColorSubTable;
-    extern PFNGLCOPYCOLORSUBTABLEEXTPROC glCopyColorSubTableEXT;
-    extern PFNGLCOPYCOLORTABLEPROC glCopyColorTable;
-    extern PFNGLCOPYCOLORTABLESGIPROC glCopyColorTableSGI;
-    extern PFNGLCOPYCONVOLUTIONFILTER1DPROC glCopyConvolutionFilter1D;
-    extern PFNGLCOPYCONVOLUTIONFILTER1DEXTPROC glCopyConvolutionFilter1DEXT;
-    extern PFNGLCOPYCONVOLUTIONFILTER2DPROC glCopyConvolutionFilter2D;
-    extern PFNGLCOPYCONVOLUTIONFILTER2DEXTPROC glCopyConvolutionFilter2DEXT;
-    extern PFNGLCOPYIMAGESUBDATANVPROC glCopyImageSubDataNV;
-    extern PFNGLCOPYMULTITEXIMAGE1DEXTPROC glCopyMultiTexImage1DEXT;
-    extern PFNGLCOPYMULTITEXIMAGE2DEXTPROC glCopyMultiTexImage2DEXT;
-    extern PFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC glCopyMultiTexSubImage1DEXT;
-    extern PFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC glCopyMultiTexSubImage2DEXT;
-    extern PFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC glCopyMultiTexSubImage3DEXT;
-    extern PFNGLCOPYTEXIMAGE1DEXTPROC glCopyTexImage1DEXT;
-    extern PFNGLCOPYTEXIMAGE2DEXTPROC glCopyTexImage2DEXT;
-    extern PFNGLCOPYTEXSUBIMAGE1DEXTPROC glCopyTexSubImage1DEXT;
-    extern PFNGLCOPYTEXSUBIMAGE2DEXTPROC glCopyTexSubImage2DEXT;
-    extern PFNGLCOPYTEXSUBIMAGE3DPROC glCopyTexSubImage3D;
-    extern PFNGLCOPYTEXSUBIMAGE3DEXTPROC glCopyTexSubImage3DEXT;
-    extern PFNGLCOPYTEXTUREIMAGE1DEXTPROC glCopyTextureImage1DEXT;
-    extern PFNGLCOPYTEXTUREIMAGE2DEXTPROC glCopyTextureImage2DEXT;
-    extern PFNGLCOPYTEXTURESUBIMAGE1DEXTPROC glCopyTextureSubImage1DEXT;
-    extern PFNGLCOPYTEXTURESUBIMAGE2DEXTPROC glCopyTextureSubImage2DEXT;
-    extern PFNGLCOPYTEXTURESUBIMAGE3DEXTPROC glCopyTextureSubImage3DEXT;
     extern PFNGLCREATEPROGRAMPROC glCreateProgram;
-    extern PFNGLCREATEPROGRAMOBJECTARBPROC glCreateProgramObjectARB;
     extern PFNGLCREATESHADERPROC glCreateShader;
-    extern PFNGLCREATESHADEROBJECTARBPROC glCreateShaderObjectARB;
-    extern PFNGLCREATESHADERPROGRAMEXTPROC glCreateShaderProgramEXT;
-    extern PFNGLCULLPARAMETERDVEXTPROC glCullParameterdvEXT;
-    extern PFNGLCULLPARAMETERFVEXTPROC glCullParameterfvEXT;
-    extern PFNGLCURRENTPALETTEMATRIXARBPROC glCurrentPaletteMatrixARB;
-    extern PFNGLDEFORMSGIXPROC glDeformSGIX;
-    extern PFNGLDEFORMATIONMAP3DSGIXPROC glDeformationMap3dSGIX;
-    extern PFNGLDEFORMATIONMAP3FSGIXPROC glDeformationMap3fSGIX;
-    extern PFNGLDELETEASYNCMARKERSSGIXPROC glDeleteAsyncMarkersSGIX;
     extern PFNGLDELETEBUFFERSPROC glDeleteBuffers;
-    extern PFNGLDELETEBUFFERSARBPROC glDeleteBuffersARB;
-    extern PFNGLDELETEFENCESAPPLEPROC glDeleteFencesAPPLE;
-    extern PFNGLDELETEFENCESNVPROC glDeleteFencesNV;
-    extern PFNGLDELETEFRAGMENTSHADERATIPROC glDeleteFragmentShaderATI;
-    extern PFNGLDELETEFRAMEBUFFERSPROC glDeleteFramebuffers;
-    extern PFNGLDELETEFRAMEBUFFERSEXTPROC glDeleteFramebuffersEXT;
-    extern PFNGLDELETENAMEDSTRINGARBPROC glDeleteNamedStringARB;
-    extern PFNGLDELETEOBJECTARBPROC glDeleteObjectARB;
-    extern PFNGLDELETEOCCLUSIONQUERIESNVPROC glDeleteOcclusionQueriesNV;
-    extern PFNGLDELETEPERFMONITORSAMDPROC glDeletePerfMonitorsAMD;
     extern PFNGLDELETEPROGRAMPROC glDeleteProgram;
-    extern PFNGLDELETEPROGRAMSARBPROC glDeleteProgramsARB;
-    extern PFNGLDELETEPROGRAMSNVPROC glDeleteProgramsNV;
-    extern PFNGLDELETEQUERIESPROC glDeleteQueries;
-    extern PFNGLDELETEQUERIESARBPROC glDeleteQueriesARB;
     extern PFNGLDELETERENDERBUFFERSPROC glDeleteRenderbuffers;
     extern PFNGLDELETERENDERBUFFERSEXTPROC glDeleteRenderbuffersEXT;
-    extern PFNGLDELETESAMPLERSPROC glDeleteSamplers;
     extern PFNGLDELETESHADERPROC glDeleteShader;
     extern PFNGLDELETESYNCPROC glDeleteSync;
-    extern PFNGLDELETETEXTURESEXTPROC glDeleteTexturesEXT;
-    extern PFNGLDELETETRANSFORMFEEDBACKSPROC glDeleteTransformFeedbacks;
-    extern PFNGLDELETETRANSFORMFEEDBACKSNVPROC glDeleteTransformFeedbacksNV;
-    extern PFNGLDELETEVERTEXARRAYSPROC glDeleteVertexArrays;
-    extern PFNGLDELETEVERTEXARRAYSAPPLEPROC glDeleteVertexArraysAPPLE;
-    extern PFNGLDELETEVERTEXSHADEREXTPROC glDeleteVertexShaderEXT;
-    extern PFNGLDEPTHBOUNDSEXTPROC glDepthBoundsEXT;
-    extern PFNGLDEPTHBOUNDSDNVPROC glDepthBoundsdNV;
-    extern PFNGLDEPTHRANGEDNVPROC glDepthRangedNV;
-    extern PFNGLDETACHOBJECTARBPROC glDetachObjectARB;
-    extern PFNGLDETACHSHADERPROC glDetachShader;
-    extern PFNGLDETAILTEXFUNCSGISPROC glDetailTexFuncSGIS;
     extern PFNGLDISABLECLIENTSTATEINDEXEDEXTPROC glDisableClientStateIndexedEXT;
     extern PFNGLDISABLEINDEXEDEXTPROC glDisableIndexedEXT;
-    extern PFNGLDISABLEVARIANTCLIENTSTATEEXTPROC glDisableVariantClientStateEXT;
-    extern PFNGLDISABLEVERTEXATTRIBAPPLEPROC glDisableVertexAttribAPPLE;
     extern PFNGLDISABLEVERTEXATTRIBARRAYPROC glDisableVertexAttribArray;
-    extern PFNGLDISABLEVERTEXATTRIBARRAYARBPROC glDisableVertexAttribArrayARB;
-    extern PFNGLDISABLEIPROC glDisablei;
-    extern PFNGLDRAWARRAYSEXTPROC glDrawArraysEXT;
-    extern PFNGLDRAWARRAYSINDIRECTPROC glDrawArraysIndirect;
-    extern PFNGLDRAWARRAYSINSTANCEDPROC glDrawArraysInstanced;
-    extern PFNGLDRAWARRAYSINSTANCEDARBPROC glDrawArraysInstancedARB;
-    extern PFNGLDRAWARRAYSINSTANCEDEXTPROC glDrawArraysInstancedEXT;
-    extern PFNGLDRAWBUFFERSPROC glDrawBuffers;
-    extern PFNGLDRAWBUFFERSARBPROC glDrawBuffersARB;
-    extern PFNGLDRAWBUFFERSATIPROC glDrawBuffersATI;
-    extern PFNGLDRAWELEMENTARRAYAPPLEPROC glDrawElementArrayAPPLE;
-    extern PFNGLDRAWELEMENTARRAYATIPROC glDrawElementArrayATI;
-    extern PFNGLDRAWELEMENTSBASEVERTEXPROC glDrawElementsBaseVertex;
-    extern PFNGLDRAWELEMENTSINDIRECTPROC glDrawElementsIndirect;
-    extern PFNGLDRAWELEMENTSINSTANCEDPROC glDrawElementsInstanced;
-    extern PFNGLDRAWELEMENTSINSTANCEDARBPROC glDrawElementsInstancedARB;
-    extern PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glDrawElementsInstancedBaseVertex;
-    extern PFNGLDRAWELEMENTSINSTANCEDEXTPROC glDrawElementsInstancedEXT;
-    extern PFNGLDRAWMESHARRAYSSUNPROC glDrawMeshArraysSUN;
-    extern PFNGLDRAWRANGEELEMENTARRAYAPPLEPROC glDrawRangeElementArrayAPPLE;
-    extern PFNGLDRAWRANGEELEMENTARRAYATIPROC glDrawRangeElementArrayATI;
-    extern PFNGLDRAWRANGEELEMENTSPROC glDrawRangeElements;
-    extern PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glDrawRangeElementsBaseVertex;
-    extern PFNGLDRAWRANGEELEMENTSEXTPROC glDrawRangeElementsEXT;
-    extern PFNGLDRAWTRANSFORMFEEDBACKPROC glDrawTransformFeedback;
-    extern PFNGLDRAWTRANSFORMFEEDBACKNVPROC glDrawTransformFeedbackNV;
-    extern PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glDrawTransformFeedbackStream;
-    extern PFNGLEDGEFLAGFORMATNVPROC glEdgeFlagFormatNV;
-    extern PFNGLEDGEFLAGPOINTEREXTPROC glEdgeFlagPointerEXT;
-    extern PFNGLEDGEFLAGPOINTERLISTIBMPROC glEdgeFlagPointerListIBM;
-    extern PFNGLELEMENTPOINTERAPPLEPROC glElementPointerAPPLE;
-    extern PFNGLELEMENTPOINTERATIPROC glElementPointerATI;
     extern PFNGLENABLECLIENTSTATEINDEXEDEXTPROC glEnableClientStateIndexedEXT;
     extern PFNGLENABLEINDEXEDEXTPROC glEnableIndexedEXT;
-    extern PFNGLENABLEVARIANTCLIENTSTATEEXTPROC glEnableVariantClientStateEXT;
-    extern PFNGLENABLEVERTEXATTRIBAPPLEPROC glEnableVertexAttribAPPLE;
     extern PFNGLENABLEVERTEXATTRIBARRAYPROC glEnableVertexAttribArray;
-    extern PFNGLENABLEVERTEXATTRIBARRAYARBPROC glEnableVertexAttribArrayARB;
-    extern PFNGLENABLEIPROC glEnablei;
-    extern PFNGLENDCONDITIONALRENDERPROC glEndConditionalRender;
-    extern PFNGLENDCONDITIONALRENDERNVPROC glEndConditionalRenderNV;
-    extern PFNGLENDFRAGMENTSHADERATIPROC glEndFragmentShaderATI;
-    extern PFNGLENDOCCLUSIONQUERYNVPROC glEndOcclusionQueryNV;
-    extern PFNGLENDPERFMONITORAMDPROC glEndPerfMonitorAMD;
-    extern PFNGLENDQUERYPROC glEndQuery;
-    extern PFNGLENDQUERYARBPROC glEndQueryARB;
-    extern PFNGLENDQUERYINDEXEDPROC glEndQueryIndexed;
-    extern PFNGLENDTRANSFORMFEEDBACKPROC glEndTransformFeedback;
-    extern PFNGLENDTRANSFORMFEEDBACKEXTPROC glEndTransformFeedbackEXT;
-    extern PFNGLENDTRANSFORMFEEDBACKNVPROC glEndTransformFeedbackNV;
-    extern PFNGLENDVERTEXSHADEREXTPROC glEndVertexShaderEXT;
-    extern PFNGLENDVIDEOCAPTURENVPROC glEndVideoCaptureNV;
-    extern PFNGLEVALMAPSNVPROC glEvalMapsNV;
-    extern PFNGLEXECUTEPROGRAMNVPROC glExecuteProgramNV;
-    extern PFNGLEXTRACTCOMPONENTEXTPROC glExtractComponentEXT;
     extern PFNGLFENCESYNCPROC glFenceSync;
-    extern PFNGLFINALCOMBINERINPUTNVPROC glFinalCombinerInputNV;
-    extern PFNGLFINISHASYNCSGIXPROC glFinishAsyncSGIX;
-    extern PFNGLFINISHFENCEAPPLEPROC glFinishFenceAPPLE;
-    extern PFNGLFINISHFENCENVPROC glFinishFenceNV;
-    extern PFNGLFINISHOBJECTAPPLEPROC glFinishObjectAPPLE;
-    extern PFNGLFINISHTEXTURESUNXPROC glFinishTextureSUNX;
-    extern PFNGLFLUSHMAPPEDBUFFERRANGEPROC glFlushMappedBufferRange;
-    extern PFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC glFlushMappedBufferRangeAPPLE;
-    extern PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC glFlushMappedNamedBufferRangeEXT;
-    extern PFNGLFLUSHPIXELDATARANGENVPROC glFlushPixelDataRangeNV;
-    extern PFNGLFLUSHRASTERSGIXPROC glFlushRasterSGIX;
-    extern PFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC glFlushVertexArrayRangeAPPLE;
-    extern PFNGLFLUSHVERTEXARRAYRANGENVPROC glFlushVertexArrayRangeNV;
-    extern PFNGLFOGCOORDFORMATNVPROC glFogCoordFormatNV;
-    extern PFNGLFOGCOORDPOINTERPROC glFogCoordPointer;
-    extern PFNGLFOGCOORDPOINTEREXTPROC glFogCoordPointerEXT;
-    extern PFNGLFOGCOORDPOINTERLISTIBMPROC glFogCoordPointerListIBM;
-    extern PFNGLFOGCOORDDPROC glFogCoordd;
-    extern PFNGLFOGCOORDDEXTPROC glFogCoorddEXT;
-    extern PFNGLFOGCOORDDVPROC glFogCoorddv;
-    extern PFNGLFOGCOORDDVEXTPROC glFogCoorddvEXT;
-    extern PFNGLFOGCOORDFPROC glFogCoordf;
-    extern PFNGLFOGCOORDFEXTPROC glFogCoordfEXT;
-    extern PFNGLFOGCOORDFVPROC glFogCoordfv;
-    extern PFNGLFOGCOORDFVEXTPROC glFogCoordfvEXT;
-    extern PFNGLFOGCOORDHNVPROC glFogCoordhNV;
-    extern PFNGLFOGCOORDHVNVPROC glFogCoordhvNV;
-    extern PFNGLFOGFUNCSGISPROC glFogFuncSGIS;
-    extern PFNGLFRAGMENTCOLORMATERIALSGIXPROC glFragmentColorMaterialSGIX;
-    extern PFNGLFRAGMENTLIGHTMODELFSGIXPROC glFragmentLightModelfSGIX;
-    extern PFNGLFRAGMENTLIGHTMODELFVSGIXPROC glFragmentLightModelfvSGIX;
-    extern PFNGLFRAGMENTLIGHTMODELISGIXPROC glFragmentLightModeliSGIX;
-    extern PFNGLFRAGMENTLIGHTMODELIVSGIXPROC glFragmentLightModelivSGIX;
-    extern PFNGLFRAGMENTLIGHTFSGIXPROC glFragmentLightfSGIX;
-    extern PFNGLFRAGMENTLIGHTFVSGIXPROC glFragmentLightfvSGIX;
-    extern PFNGLFRAGMENTLIGHTISGIXPROC glFragmentLightiSGIX;
-    extern PFNGLFRAGMENTLIGHTIVSGIXPROC glFragmentLightivSGIX;
-    extern PFNGLFRAGMENTMATERIALFSGIXPROC glFragmentMaterialfSGIX;
-    extern PFNGLFRAGMENTMATERIALFVSGIXPROC glFragmentMaterialfvSGIX;
-    extern PFNGLFRAGMENTMATERIALISGIXPROC glFragmentMaterialiSGIX;
-    extern PFNGLFRAGMENTMATERIALIVSGIXPROC glFragmentMaterialivSGIX;
-    extern PFNGLFRAMETERMINATORGREMEDYPROC glFrameTerminatorGREMEDY;
-    extern PFNGLFRAMEZOOMSGIXPROC glFrameZoomSGIX;
-    extern PFNGLFRAMEBUFFERDRAWBUFFEREXTPROC glFramebufferDrawBufferEXT;
-    extern PFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC glFramebufferDrawBuffersEXT;
-    extern PFNGLFRAMEBUFFERREADBUFFEREXTPROC glFramebufferReadBufferEXT;
-    extern PFNGLFRAMEBUFFERRENDERBUFFERPROC glFramebufferRenderbuffer;
-    extern PFNGLFRAMEBUFFERRENDERBUFFEREXTPROC glFramebufferRenderbufferEXT;
-    extern PFNGLFRAMEBUFFERTEXTUREPROC glFramebufferTexture;
-    extern PFNGLFRAMEBUFFERTEXTURE1DPROC glFramebufferTexture1D;
-    extern PFNGLFRAMEBUFFERTEXTURE1DEXTPROC glFramebufferTexture1DEXT;
-    extern PFNGLFRAMEBUFFERTEXTURE2DPROC glFramebufferTexture2D;
-    extern PFNGLFRAMEBUFFERTEXTURE2DEXTPROC glFramebufferTexture2DEXT;
-    extern PFNGLFRAMEBUFFERTEXTURE3DPROC glFramebufferTexture3D;
-    extern PFNGLFRAMEBUFFERTEXTURE3DEXTPROC glFramebufferTexture3DEXT;
-    extern PFNGLFRAMEBUFFERTEXTUREARBPROC glFramebufferTextureARB;
-    extern PFNGLFRAMEBUFFERTEXTUREEXTPROC glFramebufferTextureEXT;
-    extern PFNGLFRAMEBUFFERTEXTUREFACEARBPROC glFramebufferTextureFaceARB;
-    extern PFNGLFRAMEBUFFERTEXTUREFACEEXTPROC glFramebufferTextureFaceEXT;
-    extern PFNGLFRAMEBUFFERTEXTURELAYERPROC glFramebufferTextureLayer;
-    extern PFNGLFRAMEBUFFERTEXTURELAYERARBPROC glFramebufferTextureLayerARB;
-    extern PFNGLFRAMEBUFFERTEXTURELAYEREXTPROC glFramebufferTextureLayerEXT;
-    extern PFNGLFREEOBJECTBUFFERATIPROC glFreeObjectBufferATI;
-    extern PFNGLGENASYNCMARKERSSGIXPROC glGenAsyncMarkersSGIX;
     extern PFNGLGENBUFFERSPROC glGenBuffers;
-    extern PFNGLGENBUFFERSARBPROC glGenBuffersARB;
-    extern PFNGLGENFENCESAPPLEPROC glGenFencesAPPLE;
-    extern PFNGLGENFENCESNVPROC glGenFencesNV;
-    extern PFNGLGENFRAGMENTSHADERSATIPROC glGenFragmentShadersATI;
-    extern PFNGLGENFRAMEBUFFERSPROC glGenFramebuffers;
-    extern PFNGLGENFRAMEBUFFERSEXTPROC glGenFramebuffersEXT;
-    extern PFNGLGENOCCLUSIONQUERIESNVPROC glGenOcclusionQueriesNV;
-    extern PFNGLGENPERFMONITORSAMDPROC glGenPerfMonitorsAMD;
-    extern PFNGLGENPROGRAMSARBPROC glGenProgramsARB;
-    extern PFNGLGENPROGRAMSNVPROC glGenProgramsNV;
-    extern PFNGLGENQUERIESPROC glGenQueries;
-    extern PFNGLGENQUERIESARBPROC glGenQueriesARB;
     extern PFNGLGENRENDERBUFFERSPROC glGenRenderbuffers;
     extern PFNGLGENRENDERBUFFERSEXTPROC glGenRenderbuffersEXT;
-    extern PFNGLGENSAMPLERSPROC glGenSamplers;
-    extern PFNGLGENSYMBOLSEXTPROC glGenSymbolsEXT;
-    extern PFNGLGENTEXTURESEXTPROC glGenTexturesEXT;
-    extern PFNGLGENTRANSFORMFEEDBACKSPROC glGenTransformFeedbacks;
-    extern PFNGLGENTRANSFORMFEEDBACKSNVPROC glGenTransformFeedbacksNV;
-    extern PFNGLGENVERTEXARRAYSPROC glGenVertexArrays;
-    extern PFNGLGENVERTEXARRAYSAPPLEPROC glGenVertexArraysAPPLE;
-    extern PFNGLGENVERTEXSHADERSEXTPROC glGenVertexShadersEXT;
-    extern PFNGLGENERATEMIPMAPPROC glGenerateMipmap;
     extern PFNGLGENERATEMIPMAPEXTPROC glGenerateMipmapEXT;
-    extern PFNGLGENERATEMULTITEXMIPMAPEXTPROC glGenerateMultiTexMipmapEXT;
-    extern PFNGLGENERATETEXTUREMIPMAPEXTPROC glGenerateTextureMipmapEXT;
-    extern PFNGLGETACTIVEATTRIBPROC glGetActiveAttrib;
-    extern PFNGLGETACTIVEATTRIBARBPROC glGetActiveAttribARB;
-    extern PFNGLGETACTIVESUBROUTINENAMEPROC glGetActiveSubroutineName;
-    extern PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glGetActiveSubroutineUniformName;
-    extern PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glGetActiveSubroutineUniformiv;
-    extern PFNGLGETACTIVEUNIFORMPROC glGetActiveUniform;
-    extern PFNGLGETACTIVEUNIFORMARBPROC glGetActiveUniformARB;
-    extern PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glGetActiveUniformBlockName;
-    extern PFNGLGETACTIVEUNIFORMBLOCKIVPROC glGetActiveUniformBlockiv;
-    extern PFNGLGETACTIVEUNIFORMNAMEPROC glGetActiveUniformName;
-    extern PFNGLGETACTIVEUNIFORMSIVPROC glGetActiveUniformsiv;
-    extern PFNGLGETACTIVEVARYINGNVPROC glGetActiveVaryingNV;
-    extern PFNGLGETARRAYOBJECTFVATIPROC glGetArrayObjectfvATI;
-    extern PFNGLGETARRAYOBJECTIVATIPROC glGetArrayObjectivATI;
-    extern PFNGLGETATTACHEDOBJECTSARBPROC glGetAttachedObjectsARB;
-    extern PFNGLGETATTACHEDSHADERSPROC glGetAttachedShaders;
-    extern PFNGLGETATTRIBLOCATIONPROC glGetAttribLocation;
-    extern PFNGLGETATTRIBLOCATIONARBPROC glGetAttribLocationARB;
-    extern PFNGLGETBOOLEANINDEXEDVEXTPROC glGetBooleanIndexedvEXT;
-    extern PFNGLGETBUFFERPARAMETERI64VPROC glGetBufferParameteri64v;
-    extern PFNGLGETBUFFERPARAMETERIVPROC glGetBufferParameteriv;
-    extern PFNGLGETBUFFERPARAMETERIVARBPROC glGetBufferParameterivARB;
-    extern PFNGLGETBUFFERPARAMETERUI64VNVPROC glGetBufferParameterui64vNV;
-    extern PFNGLGETBUFFERPOINTERVPROC glGetBufferPointerv;
-    extern PFNGLGETBUFFERPOINTERVARBPROC glGetBufferPointervARB;
-    extern PFNGLGETBUFFERSUBDATAPROC glGetBufferSubData;
-    extern PFNGLGETBUFFERSUBDATAARBPROC glGetBufferSubDataARB;
-    extern PFNGLGETCOLORTABLEPROC glGetColorTable;
-    extern PFNGLGETCOLORTABLEEXTPROC glGetColorTableEXT;
-    extern PFNGLGETCOLORTABLEPARAMETERFVPROC glGetColorTableParameterfv;
-    extern PFNGLGETCOLORTABLEPARAMETERFVEXTPROC glGetColorTableParameterfvEXT;
-    extern PFNGLGETCOLORTABLEPARAMETERFVSGIPROC glGetColorTableParameterfvSGI;
-    extern PFNGLGETCOLORTABLEPARAMETERIVPROC glGetColorTableParameteriv;
-    extern PFNGLGETCOLORTABLEPARAMETERIVEXTPROC glGetColorTableParameterivEXT;
-    extern PFNGLGETCOLORTABLEPARAMETERIVSGIPROC glGetColorTableParameterivSGI;
-    extern PFNGLGETCOLORTABLESGIPROC glGetColorTableSGI;
-    extern PFNGLGETCOMBINERINPUTPARAMETERFVNVPROC glGetCombinerInputParameterfvNV;
-    extern PFNGLGETCOMBINERINPUTPARAMETERIVNVPROC glGetCombinerInputParameterivNV;
-    extern PFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC glGetCombinerOutputParameterfvNV;
-    extern PFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC glGetCombinerOutputParameterivNV;
-    extern PFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC glGetCombinerStageParameterfvNV;
-    extern PFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC glGetCompressedMultiTexImageEXT;
-    extern PFNGLGETCOMPRESSEDTEXIMAGEPROC glGetCompressedTexImage;
-    extern PFNGLGETCOMPRESSEDTEXIMAGEARBPROC glGetCompressedTexImageARB;
-    extern PFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC glGetCompressedTextureImageEXT;
-    extern PFNGLGETCONVOLUTIONFILTERPROC glGetConvolutionFilter;
-    extern PFNGLGETCONVOLUTIONFILTEREXTPROC glGetConvolutionFilterEXT;
-    extern PFNGLGETCONVOLUTIONPARAMETERFVPROC glGetConvolutionParameterfv;
-    extern PFNGLGETCONVOLUTIONPARAMETERFVEXTPROC glGetConvolutionParameterfvEXT;
-    extern PFNGLGETCONVOLUTIONPARAMETERIVPROC glGetConvolutionParameteriv;
-    extern PFNGLGETCONVOLUTIONPARAMETERIVEXTPROC glGetConvolutionParameterivEXT;
-    extern PFNGLGETDETAILTEXFUNCSGISPROC glGetDetailTexFuncSGIS;
-    extern PFNGLGETDOUBLEINDEXEDVEXTPROC glGetDoubleIndexedvEXT;
-    extern PFNGLGETFENCEIVNVPROC glGetFenceivNV;
-    extern PFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC glGetFinalCombinerInputParameterfvNV;
-    extern PFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC glGetFinalCombinerInputParameterivNV;
-    extern PFNGLGETFLOATINDEXEDVEXTPROC glGetFloatIndexedvEXT;
-    extern PFNGLGETFOGFUNCSGISPROC glGetFogFuncSGIS;
-    extern PFNGLGETFRAGDATAINDEXPROC glGetFragDataIndex;
-    extern PFNGLGETFRAGDATALOCATIONPROC glGetFragDataLocation;
-    extern PFNGLGETFRAGDATALOCATIONEXTPROC glGetFragDataLocationEXT;
-    extern PFNGLGETFRAGMENTLIGHTFVSGIXPROC glGetFragmentLightfvSGIX;
-    extern PFNGLGETFRAGMENTLIGHTIVSGIXPROC glGetFragmentLightivSGIX;
-    extern PFNGLGETFRAGMENTMATERIALFVSGIXPROC glGetFragmentMaterialfvSGIX;
-    extern PFNGLGETFRAGMENTMATERIALIVSGIXPROC glGetFragmentMaterialivSGIX;
-    extern PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glGetFramebufferAttachmentParameteriv;
-    extern PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC glGetFramebufferAttachmentParameterivEXT;
-    extern PFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC glGetFramebufferParameterivEXT;
-    extern PFNGLGETHANDLEARBPROC glGetHandleARB;
-    extern PFNGLGETHISTOGRAMPROC glGetHistogram;
-    extern PFNGLGETHISTOGRAMEXTPROC glGetHistogramEXT;
-    extern PFNGLGETHISTOGRAMPARAMETERFVPROC glGetHistogramParameterfv;
-    extern PFNGLGETHISTOGRAMPARAMETERFVEXTPROC glGetHistogramParameterfvEXT;
-    extern PFNGLGETHISTOGRAMPARAMETERIVPROC glGetHistogramParameteriv;
-    extern PFNGLGETHISTOGRAMPARAMETERIVEXTPROC glGetHistogramParameterivEXT;
-    extern PFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC glGetImageTransformParameterfvHP;
-    extern PFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC glGetImageTransformParameterivHP;
-    extern PFNGLGETINFOLOGARBPROC glGetInfoLogARB;
-    extern PFNGLGETINSTRUMENTSSGIXPROC glGetInstrumentsSGIX;
-    extern PFNGLGETINTEGER64VPROC glGetInteger64v;
-    extern PFNGLGETINTEGERINDEXEDVEXTPROC glGetIntegerIndexedvEXT;
-    extern PFNGLGETINTEGERUI64VNVPROC glGetIntegerui64vNV;
-    extern PFNGLGETINVARIANTBOOLEANVEXTPROC glGetInvariantBooleanvEXT;
-    extern PFNGLGETINVARIANTFLOATVEXTPROC glGetInvariantFloatvEXT;
-    extern PFNGLGETINVARIANTINTEGERVEXTPROC glGetInvariantIntegervEXT;
-    extern PFNGLGETLISTPARAMETERFVSGIXPROC glGetListParameterfvSGIX;
-    extern PFNGLGETLISTPARAMETERIVSGIXPROC glGetListParameterivSGIX;
-    extern PFNGLGETLOCALCONSTANTBOOLEANVEXTPROC glGetLocalConstantBooleanvEXT;
-    extern PFNGLGETLOCALCONSTANTFLOATVEXTPROC glGetLocalConstantFloatvEXT;
-    extern PFNGLGETLOCALCONSTANTINTEGERVEXTPROC glGetLocalConstantIntegervEXT;
-    extern PFNGLGETMAPATTRIBPARAMETERFVNVPROC glGetMapAttribParameterfvNV;
-    extern PFNGLGETMAPATTRIBPARAMETERIVNVPROC glGetMapAttribParameterivNV;
-    extern PFNGLGETMAPCONTROLPOINTSNVPROC glGetMapControlPointsNV;
-    extern PFNGLGETMAPPARAMETERFVNVPROC glGetMapParameterfvNV;
-    extern PFNGLGETMAPPARAMETERIVNVPROC glGetMapParameterivNV;
-    extern PFNGLGETMINMAXPROC glGetMinmax;
-    extern PFNGLGETMINMAXEXTPROC glGetMinmaxEXT;
-    extern PFNGLGETMINMAXPARAMETERFVPROC glGetMinmaxParameterfv;
-    extern PFNGLGETMINMAXPARAMETERFVEXTPROC glGetMinmaxParameterfvEXT;
-    extern PFNGLGETMINMAXPARAMETERIVPROC glGetMinmaxParameteriv;
-    extern PFNGLGETMINMAXPARAMETERIVEXTPROC glGetMinmaxParameterivEXT;
-    extern PFNGLGETMULTITEXENVFVEXTPROC glGetMultiTexEnvfvEXT;
-    extern PFNGLGETMULTITEXENVIVEXTPROC glGetMultiTexEnvivEXT;
-    extern PFNGLGETMULTITEXGENDVEXTPROC glGetMultiTexGendvEXT;
-    extern PFNGLGETMULTITEXGENFVEXTPROC glGetMultiTexGenfvEXT;
-    extern PFNGLGETMULTITEXGENIVEXTPROC glGetMultiTexGenivEXT;
-    extern PFNGLGETMULTITEXIMAGEEXTPROC glGetMultiTexImageEXT;
-    extern PFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC glGetMultiTexLevelParameterfvEXT;
-    extern PFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC glGetMultiTexLevelParameterivEXT;
-    extern PFNGLGETMULTITEXPARAMETERIIVEXTPROC glGetMultiTexParameterIivEXT;
-    extern PFNGLGETMULTITEXPARAMETERIUIVEXTPROC glGetMultiTexParameterIuivEXT;
-    extern PFNGLGETMULTITEXPARAMETERFVEXTPROC glGetMultiTexParameterfvEXT;
-    extern PFNGLGETMULTITEXPARAMETERIVEXTPROC glGetMultiTexParameterivEXT;
-    extern PFNGLGETMULTISAMPLEFVPROC glGetMultisamplefv;
-    extern PFNGLGETMULTISAMPLEFVNVPROC glGetMultisamplefvNV;
-    extern PFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC glGetNamedBufferParameterivEXT;
-    extern PFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC glGetNamedBufferParameterui64vNV;
-    extern PFNGLGETNAMEDBUFFERPOINTERVEXTPROC glGetNamedBufferPointervEXT;
-    extern PFNGLGETNAMEDBUFFERSUBDATAEXTPROC glGetNamedBufferSubDataEXT;
-    extern PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC glGetNamedFramebufferAttachmentParameterivEXT;
-    extern PFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC glGetNamedProgramLocalParameterIivEXT;
-    extern PFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC glGetNamedProgramLocalParameterIuivEXT;
-    extern PFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC glGetNamedProgramLocalParameterdvEXT;
-    extern PFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC glGetNamedProgramLocalParameterfvEXT;
-    extern PFNGLGETNAMEDPROGRAMSTRINGEXTPROC glGetNamedProgramStringEXT;
-    extern PFNGLGETNAMEDPROGRAMIVEXTPROC glGetNamedProgramivEXT;
-    extern PFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC glGetNamedRenderbufferParameterivEXT;
-    extern PFNGLGETNAMEDSTRINGARBPROC glGetNamedStringARB;
-    extern PFNGLGETNAMEDSTRINGIVARBPROC glGetNamedStringivARB;
-    extern PFNGLGETOBJECTBUFFERFVATIPROC glGetObjectBufferfvATI;
-    extern PFNGLGETOBJECTBUFFERIVATIPROC glGetObjectBufferivATI;
-    extern PFNGLGETOBJECTPARAMETERFVARBPROC glGetObjectParameterfvARB;
-    extern PFNGLGETOBJECTPARAMETERIVAPPLEPROC glGetObjectParameterivAPPLE;
-    extern PFNGLGETOBJECTPARAMETERIVARBPROC glGetObjectParameterivARB;
-    extern PFNGLGETOCCLUSIONQUERYIVNVPROC glGetOcclusionQueryivNV;
-    extern PFNGLGETOCCLUSIONQUERYUIVNVPROC glGetOcclusionQueryuivNV;
-    extern PFNGLGETPERFMONITORCOUNTERDATAAMDPROC glGetPerfMonitorCounterDataAMD;
-    extern PFNGLGETPERFMONITORCOUNTERINFOAMDPROC glGetPerfMonitorCounterInfoAMD;
-    extern PFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC glGetPerfMonitorCounterStringAMD;
-    extern PFNGLGETPERFMONITORCOUNTERSAMDPROC glGetPerfMonitorCountersAMD;
-    extern PFNGLGETPERFMONITORGROUPSTRINGAMDPROC glGetPerfMonitorGroupStringAMD;
-    extern PFNGLGETPERFMONITORGROUPSAMDPROC glGetPerfMonitorGroupsAMD;
-    extern PFNGLGETPIXELTEXGENPARAMETERFVSGISPROC glGetPixelTexGenParameterfvSGIS;
-    extern PFNGLGETPIXELTEXGENPARAMETERIVSGISPROC glGetPixelTexGenParameterivSGIS;
-    extern PFNGLGETPOINTERINDEXEDVEXTPROC glGetPointerIndexedvEXT;
-    extern PFNGLGETPOINTERVEXTPROC glGetPointervEXT;
-    extern PFNGLGETPROGRAMENVPARAMETERIIVNVPROC glGetProgramEnvParameterIivNV;
-    extern PFNGLGETPROGRAMENVPARAMETERIUIVNVPROC glGetProgramEnvParameterIuivNV;
-    extern PFNGLGETPROGRAMENVPARAMETERDVARBPROC glGetProgramEnvParameterdvARB;
-    extern PFNGLGETPROGRAMENVPARAMETERFVARBPROC glGetProgramEnvParameterfvARB;
     extern PFNGLGETPROGRAMINFOLOGPROC glGetProgramInfoLog;
-    extern PFNGLGETPROGRAMLOCALPARAMETERIIVNVPROC glGetProgramLocalParameterIivNV;
-    extern PFNGLGETPROGRAMLOCALPARAMETERIUIVNVPROC glGetProgramLocalParameterIuivNV;
-    extern PFNGLGETPROGRAMLOCALPARAMETERDVARBPROC glGetProgramLocalParameterdvARB;
-    extern PFNGLGETPROGRAMLOCALPARAMETERFVARBPROC glGetProgramLocalParameterfvARB;
-    extern PFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC glGetProgramNamedParameterdvNV;
-    extern PFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC glGetProgramNamedParameterfvNV;
-    extern PFNGLGETPROGRAMPARAMETERDVNVPROC glGetProgramParameterdvNV;
-    extern PFNGLGETPROGRAMPARAMETERFVNVPROC glGetProgramParameterfvNV;
-    extern PFNGLGETPROGRAMSTAGEIVPROC glGetProgramStageiv;
-    extern PFNGLGETPROGRAMSTRINGARBPROC glGetProgramStringARB;
-    extern PFNGLGETPROGRAMSTRINGNVPROC glGetProgramStringNV;
-    extern PFNGLGETPROGRAMIVPROC glGetProgramiv;
-    extern PFNGLGETPROGRAMIVARBPROC glGetProgramivARB;
-    extern PFNGLGETPROGRAMIVNVPROC glGetProgramivNV;
-    extern PFNGLGETQUERYINDEXEDIVPROC glGetQueryIndexediv;
-    extern PFNGLGETQUERYOBJECTI64VPROC glGetQueryObjecti64v;
-    extern PFNGLGETQUERYOBJECTI64VEXTPROC glGetQueryObjecti64vEXT;
-    extern PFNGLGETQUERYOBJECTIVPROC glGetQueryObjectiv;
-    extern PFNGLGETQUERYOBJECTIVARBPROC glGetQueryObjectivARB;
-    extern PFNGLGETQUERYOBJECTUI64VPROC glGetQueryObjectui64v;
-    extern PFNGLGETQUERYOBJECTUI64VEXTPROC glGetQueryObjectui64vEXT;
-    extern PFNGLGETQUERYOBJECTUIVPROC glGetQueryObjectuiv;
-    extern PFNGLGETQUERYOBJECTUIVARBPROC glGetQueryObjectuivARB;
-    extern PFNGLGETQUERYIVPROC glGetQueryiv;
-    extern PFNGLGETQUERYIVARBPROC glGetQueryivARB;
-    extern PFNGLGETRENDERBUFFERPARAMETERIVPROC glGetRenderbufferParameteriv;
-    extern PFNGLGETRENDERBUFFERPARAMETERIVEXTPROC glGetRenderbufferParameterivEXT;
-    extern PFNGLGETSAMPLERPARAMETERIFVPROC glGetSamplerParameterIfv;
-    extern PFNGLGETSAMPLERPARAMETERIIVPROC glGetSamplerParameterIiv;
-    extern PFNGLGETSAMPLERPARAMETERFVPROC glGetSamplerParameterfv;
-    extern PFNGLGETSAMPLERPARAMETERIVPROC glGetSamplerParameteriv;
-    extern PFNGLGETSEPARABLEFILTERPROC glGetSeparableFilter;
-    extern PFNGLGETSEPARABLEFILTEREXTPROC glGetSeparableFilterEXT;
     extern PFNGLGETSHADERINFOLOGPROC glGetShaderInfoLog;
-    extern PFNGLGETSHADERSOURCEPROC glGetShaderSource;
-    extern PFNGLGETSHADERSOURCEARBPROC glGetShaderSourceARB;
-    extern PFNGLGETSHADERIVPROC glGetShaderiv;
-    extern PFNGLGETSHARPENTEXFUNCSGISPROC glGetSharpenTexFuncSGIS;
     extern PFNGLGETSTRINGIPROC glGetStringi;
-    extern PFNGLGETSUBROUTINEINDEXPROC glGetSubroutineIndex;
-    extern PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glGetSubroutineUniformLocation;
-    extern PFNGLGETSYNCIVPROC glGetSynciv;
-    extern PFNGLGETTEXBUMPPARAMETERFVATIPROC glGetTexBumpParameterfvATI;
-    extern PFNGLGETTEXBUMPPARAMETERIVATIPROC glGetTexBumpParameterivATI;
-    extern PFNGLGETTEXFILTERFUNCSGISPROC glGetTexFilterFuncSGIS;
-    extern PFNGLGETTEXPARAMETERIIVPROC glGetTexParameterIiv;
-    extern PFNGLGETTEXPARAMETERIIVEXTPROC glGetTexParameterIivEXT;
-    extern PFNGLGETTEXPARAMETERIUIVPROC glGetTexParameterIuiv;
-    extern PFNGLGETTEXPARAMETERIUIVEXTPROC glGetTexParameterIuivEXT;
-    extern PFNGLGETTEXPARAMETERPOINTERVAPPLEPROC glGetTexParameterPointervAPPLE;
-    extern PFNGLGETTEXTUREIMAGEEXTPROC glGetTextureImageEXT;
-    extern PFNGLGETTEXTURELEVELPARAMETERFVEXTPROC glGetTextureLevelParameterfvEXT;
-    extern PFNGLGETTEXTURELEVELPARAMETERIVEXTPROC glGetTextureLevelParameterivEXT;
-    extern PFNGLGETTEXTUREPARAMETERIIVEXTPROC glGetTextureParameterIivEXT;
-    extern PFNGLGETTEXTUREPARAMETERIUIVEXTPROC glGetTextureParameterIuivEXT;
-    extern PFNGLGETTEXTUREPARAMETERFVEXTPROC glGetTextureParameterfvEXT;
-    extern PFNGLGETTEXTUREPARAMETERIVEXTPROC glGetTextureParameterivEXT;
-    extern PFNGLGETTRACKMATRIXIVNVPROC glGetTrackMatrixivNV;
-    extern PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glGetTransformFeedbackVarying;
-    extern PFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC glGetTransformFeedbackVaryingEXT;
-    extern PFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC glGetTransformFeedbackVaryingNV;
-    extern PFNGLGETUNIFORMBLOCKINDEXPROC glGetUniformBlockIndex;
-    extern PFNGLGETUNIFORMBUFFERSIZEEXTPROC glGetUniformBufferSizeEXT;
-    extern PFNGLGETUNIFORMINDICESPROC glGetUniformIndices;
     extern PFNGLGETUNIFORMLOCATIONPROC glGetUniformLocation;
-    extern PFNGLGETUNIFORMLOCATIONARBPROC glGetUniformLocationARB;
-    extern PFNGLGETUNIFORMOFFSETEXTPROC glGetUniformOffsetEXT;
-    extern PFNGLGETUNIFORMSUBROUTINEUIVPROC glGetUniformSubroutineuiv;
-    extern PFNGLGETUNIFORMDVPROC glGetUniformdv;
-    extern PFNGLGETUNIFORMFVPROC glGetUniformfv;
-    extern PFNGLGETUNIFORMFVARBPROC glGetUniformfvARB;
-    extern PFNGLGETUNIFORMIVPROC glGetUniformiv;
-    extern PFNGLGETUNIFORMIVARBPROC glGetUniformivARB;
-    extern PFNGLGETUNIFORMUI64VNVPROC glGetUniformui64vNV;
-    extern PFNGLGETUNIFORMUIVPROC glGetUniformuiv;
-    extern PFNGLGETUNIFORMUIVEXTPROC glGetUniformuivEXT;
-    extern PFNGLGETVARIANTARRAYOBJECTFVATIPROC glGetVariantArrayObjectfvATI;
-    extern PFNGLGETVARIANTARRAYOBJECTIVATIPROC glGetVariantArrayObjectivATI;
-    extern PFNGLGETVARIANTBOOLEANVEXTPROC glGetVariantBooleanvEXT;
-    extern PFNGLGETVARIANTFLOATVEXTPROC glGetVariantFloatvEXT;
-    extern PFNGLGETVARIANTINTEGERVEXTPROC glGetVariantIntegervEXT;
-    extern PFNGLGETVARIANTPOINTERVEXTPROC glGetVariantPointervEXT;
-    extern PFNGLGETVARYINGLOCATIONNVPROC glGetVaryingLocationNV;
-    extern PFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC glGetVertexAttribArrayObjectfvATI;
-    extern PFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC glGetVertexAttribArrayObjectivATI;
-    extern PFNGLGETVERTEXATTRIBIIVPROC glGetVertexAttribIiv;
-    extern PFNGLGETVERTEXATTRIBIIVEXTPROC glGetVertexAttribIivEXT;
-    extern PFNGLGETVERTEXATTRIBIUIVPROC glGetVertexAttribIuiv;
-    extern PFNGLGETVERTEXATTRIBIUIVEXTPROC glGetVertexAttribIuivEXT;
-    extern PFNGLGETVERTEXATTRIBPOINTERVPROC glGetVertexAttribPointerv;
-    extern PFNGLGETVERTEXATTRIBPOINTERVARBPROC glGetVertexAttribPointervARB;
-    extern PFNGLGETVERTEXATTRIBPOINTERVNVPROC glGetVertexAttribPointervNV;
-    extern PFNGLGETVERTEXATTRIBDVPROC glGetVertexAttribdv;
-    extern PFNGLGETVERTEXATTRIBDVARBPROC glGetVertexAttribdvARB;
-    extern PFNGLGETVERTEXATTRIBDVNVPROC glGetVertexAttribdvNV;
-    extern PFNGLGETVERTEXATTRIBFVPROC glGetVertexAttribfv;
-    extern PFNGLGETVERTEXATTRIBFVARBPROC glGetVertexAttribfvARB;
-    extern PFNGLGETVERTEXATTRIBFVNVPROC glGetVertexAttribfvNV;
-    extern PFNGLGETVERTEXATTRIBIVPROC glGetVertexAttribiv;
-    extern PFNGLGETVERTEXATTRIBIVARBPROC glGetVertexAttribivARB;
-    extern PFNGLGETVERTEXATTRIBIVNVPROC glGetVertexAttribivNV;
-    extern PFNGLGETVIDEOCAPTURESTREAMDVNVPROC glGetVideoCaptureStreamdvNV;
-    extern PFNGLGETVIDEOCAPTURESTREAMFVNVPROC glGetVideoCaptureStreamfvNV;
-    extern PFNGLGETVIDEOCAPTURESTREAMIVNVPROC glGetVideoCaptureStreamivNV;
-    extern PFNGLGETVIDEOCAPTUREIVNVPROC glGetVideoCaptureivNV;
-    extern PFNGLGETVIDEOI64VNVPROC glGetVideoi64vNV;
-    extern PFNGLGETVIDEOIVNVPROC glGetVideoivNV;
-    extern PFNGLGETVIDEOUI64VNVPROC glGetVideoui64vNV;
-    extern PFNGLGETVIDEOUIVNVPROC glGetVideouivNV;
-    extern PFNGLGLOBALALPHAFACTORBSUNPROC glGlobalAlphaFactorbSUN;
-    extern PFNGLGLOBALALPHAFACTORDSUNPROC glGlobalAlphaFactordSUN;
-    extern PFNGLGLOBALALPHAFACTORFSUNPROC glGlobalAlphaFactorfSUN;
-    extern PFNGLGLOBALALPHAFACTORISUNPROC glGlobalAlphaFactoriSUN;
-    extern PFNGLGLOBALALPHAFACTORSSUNPROC glGlobalAlphaFactorsSUN;
-    extern PFNGLGLOBALALPHAFACTORUBSUNPROC glGlobalAlphaFactorubSUN;
-    extern PFNGLGLOBALALPHAFACTORUISUNPROC glGlobalAlphaFactoruiSUN;
-    extern PFNGLGLOBALALPHAFACTORUSSUNPROC glGlobalAlphaFactorusSUN;
-    extern PFNGLHINTPGIPROC glHintPGI;
-    extern PFNGLHISTOGRAMPROC glHistogram;
-    extern PFNGLHISTOGRAMEXTPROC glHistogramEXT;
-    extern PFNGLIGLOOINTERFACESGIXPROC glIglooInterfaceSGIX;
-    extern PFNGLIMAGETRANSFORMPARAMETERFHPPROC glImageTransformParameterfHP;
-    extern PFNGLIMAGETRANSFORMPARAMETERFVHPPROC glImageTransformParameterfvHP;
-    extern PFNGLIMAGETRANSFORMPARAMETERIHPPROC glImageTransformParameteriHP;
-    extern PFNGLIMAGETRANSFORMPARAMETERIVHPPROC glImageTransformParameterivHP;
-    extern PFNGLINDEXFORMATNVPROC glIndexFormatNV;
-    extern PFNGLINDEXFUNCEXTPROC glIndexFuncEXT;
-    extern PFNGLINDEXMATERIALEXTPROC glIndexMaterialEXT;
-    extern PFNGLINDEXPOINTEREXTPROC glIndexPointerEXT;
-    extern PFNGLINDEXPOINTERLISTIBMPROC glIndexPointerListIBM;
-    extern PFNGLINSERTCOMPONENTEXTPROC glInsertComponentEXT;
-    extern PFNGLINSTRUMENTSBUFFERSGIXPROC glInstrumentsBufferSGIX;
-    extern PFNGLISASYNCMARKERSGIXPROC glIsAsyncMarkerSGIX;
-    extern PFNGLISBUFFERPROC glIsBuffer;
-    extern PFNGLISBUFFERARBPROC glIsBufferARB;
-    extern PFNGLISBUFFERRESIDENTNVPROC glIsBufferResidentNV;
-    extern PFNGLISENABLEDINDEXEDEXTPROC glIsEnabledIndexedEXT;
-    extern PFNGLISENABLEDIPROC glIsEnabledi;
-    extern PFNGLISFENCEAPPLEPROC glIsFenceAPPLE;
-    extern PFNGLISFENCENVPROC glIsFenceNV;
-    extern PFNGLISFRAMEBUFFERPROC glIsFramebuffer;
-    extern PFNGLISFRAMEBUFFEREXTPROC glIsFramebufferEXT;
-    extern PFNGLISNAMEDBUFFERRESIDENTNVPROC glIsNamedBufferResidentNV;
-    extern PFNGLISNAMEDSTRINGARBPROC glIsNamedStringARB;
-    extern PFNGLISOBJECTBUFFERATIPROC glIsObjectBufferATI;
-    extern PFNGLISOCCLUSIONQUERYNVPROC glIsOcclusionQueryNV;
-    extern PFNGLISPROGRAMPROC glIsProgram;
-    extern PFNGLISPROGRAMARBPROC glIsProgramARB;
-    extern PFNGLISPROGRAMNVPROC glIsProgramNV;
-    extern PFNGLISQUERYPROC glIsQuery;
-    extern PFNGLISQUERYARBPROC glIsQueryARB;
-    extern PFNGLISRENDERBUFFERPROC glIsRenderbuffer;
-    extern PFNGLISRENDERBUFFEREXTPROC glIsRenderbufferEXT;
-    extern PFNGLISSAMPLERPROC glIsSampler;
-    extern PFNGLISSHADERPROC glIsShader;
-    extern PFNGLISSYNCPROC glIsSync;
-    extern PFNGLISTEXTUREEXTPROC glIsTextureEXT;
-    extern PFNGLISTRANSFORMFEEDBACKPROC glIsTransformFeedback;
-    extern PFNGLISTRANSFORMFEEDBACKNVPROC glIsTransformFeedbackNV;
-    extern PFNGLISVARIANTENABLEDEXTPROC glIsVariantEnabledEXT;
-    extern PFNGLISVERTEXARRAYPROC glIsVertexArray;
-    extern PFNGLISVERTEXARRAYAPPLEPROC glIsVertexArrayAPPLE;
-    extern PFNGLISVERTEXATTRIBENABLEDAPPLEPROC glIsVertexAttribEnabledAPPLE;
-    extern PFNGLLIGHTENVISGIXPROC glLightEnviSGIX;
     extern PFNGLLINKPROGRAMPROC glLinkProgram;
-    extern PFNGLLINKPROGRAMARBPROC glLinkProgramARB;
-    extern PFNGLLISTPARAMETERFSGIXPROC glListParameterfSGIX;
-    extern PFNGLLISTPARAMETERFVSGIXPROC glListParameterfvSGIX;
-    extern PFNGLLISTPARAMETERISGIXPROC glListParameteriSGIX;
-    extern PFNGLLISTPARAMETERIVSGIXPROC glListParameterivSGIX;
-    extern PFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC glLoadIdentityDeformationMapSGIX;
-    extern PFNGLLOADPROGRAMNVPROC glLoadProgramNV;
-    extern PFNGLLOADTRANSPOSEMATRIXDPROC glLoadTransposeMatrixd;
-    extern PFNGLLOADTRANSPOSEMATRIXDARBPROC glLoadTransposeMatrixdARB;
-    extern PFNGLLOADTRANSPOSEMATRIXFPROC glLoadTransposeMatrixf;
-    extern PFNGLLOADTRANSPOSEMATRIXFARBPROC glLoadTransposeMatrixfARB;
-    extern PFNGLLOCKARRAYSEXTPROC glLockArraysEXT;
-    extern PFNGLMAKEBUFFERNONRESIDENTNVPROC glMakeBufferNonResidentNV;
-    extern PFNGLMAKEBUFFERRESIDENTNVPROC glMakeBufferResidentNV;
-    extern PFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC glMakeNamedBufferNonResidentNV;
-    extern PFNGLMAKENAMEDBUFFERRESIDENTNVPROC glMakeNamedBufferResidentNV;
-    extern PFNGLMAPBUFFERPROC glMapBuffer;
-    extern PFNGLMAPBUFFERARBPROC glMapBufferARB;
     extern PFNGLMAPBUFFERRANGEPROC glMapBufferRange;
-    extern PFNGLMAPCONTROLPOINTSNVPROC glMapControlPointsNV;
-    extern PFNGLMAPNAMEDBUFFEREXTPROC glMapNamedBufferEXT;
-    extern PFNGLMAPNAMEDBUFFERRANGEEXTPROC glMapNamedBufferRangeEXT;
-    extern PFNGLMAPOBJECTBUFFERATIPROC glMapObjectBufferATI;
-    extern PFNGLMAPPARAMETERFVNVPROC glMapParameterfvNV;
-    extern PFNGLMAPPARAMETERIVNVPROC glMapParameterivNV;
-    extern PFNGLMAPVERTEXATTRIB1DAPPLEPROC glMapVertexAttrib1dAPPLE;
-    extern PFNGLMAPVERTEXATTRIB1FAPPLEPROC glMapVertexAttrib1fAPPLE;
-    extern PFNGLMAPVERTEXATTRIB2DAPPLEPROC glMapVertexAttrib2dAPPLE;
-    extern PFNGLMAPVERTEXATTRIB2FAPPLEPROC glMapVertexAttrib2fAPPLE;
-    extern PFNGLMATRIXFRUSTUMEXTPROC glMatrixFrustumEXT;
-    extern PFNGLMATRIXINDEXPOINTERARBPROC glMatrixIndexPointerARB;
-    extern PFNGLMATRIXINDEXUBVARBPROC glMatrixIndexubvARB;
-    extern PFNGLMATRIXINDEXUIVARBPROC glMatrixIndexuivARB;
-    extern PFNGLMATRIXINDEXUSVARBPROC glMatrixIndexusvARB;
-    extern PFNGLMATRIXLOADIDENTITYEXTPROC glMatrixLoadIdentityEXT;
-    extern PFNGLMATRIXLOADTRANSPOSEDEXTPROC glMatrixLoadTransposedEXT;
-    extern PFNGLMATRIXLOADTRANSPOSEFEXTPROC glMatrixLoadTransposefEXT;
-    extern PFNGLMATRIXLOADDEXTPROC glMatrixLoaddEXT;
-    extern PFNGLMATRIXLOADFEXTPROC glMatrixLoadfEXT;
-    extern PFNGLMATRIXMULTTRANSPOSEDEXTPROC glMatrixMultTransposedEXT;
-    extern PFNGLMATRIXMULTTRANSPOSEFEXTPROC glMatrixMultTransposefEXT;
-    extern PFNGLMATRIXMULTDEXTPROC glMatrixMultdEXT;
-    extern PFNGLMATRIXMULTFEXTPROC glMatrixMultfEXT;
-    extern PFNGLMATRIXORTHOEXTPROC glMatrixOrthoEXT;
-    extern PFNGLMATRIXPOPEXTPROC glMatrixPopEXT;
-    extern PFNGLMATRIXPUSHEXTPROC glMatrixPushEXT;
-    extern PFNGLMATRIXROTATEDEXTPROC glMatrixRotatedEXT;
-    extern PFNGLMATRIXROTATEFEXTPROC glMatrixRotatefEXT;
-    extern PFNGLMATRIXSCALEDEXTPROC glMatrixScaledEXT;
-    extern PFNGLMATRIXSCALEFEXTPROC glMatrixScalefEXT;
-    extern PFNGLMATRIXTRANSLATEDEXTPROC glMatrixTranslatedEXT;
-    extern PFNGLMATRIXTRANSLATEFEXTPROC glMatrixTranslatefEXT;
-    extern PFNGLMINSAMPLESHADINGPROC glMinSampleShading;
-    extern PFNGLMINMAXPROC glMinmax;
-    extern PFNGLMINMAXEXTPROC glMinmaxEXT;
-    extern PFNGLMULTTRANSPOSEMATRIXDPROC glMultTransposeMatrixd;
-    extern PFNGLMULTTRANSPOSEMATRIXDARBPROC glMultTransposeMatrixdARB;
-    extern PFNGLMULTTRANSPOSEMATRIXFPROC glMultTransposeMatrixf;
-    extern PFNGLMULTTRANSPOSEMATRIXFARBPROC glMultTransposeMatrixfARB;
-    extern PFNGLMULTIDRAWARRAYSPROC glMultiDrawArrays;
-    extern PFNGLMULTIDRAWARRAYSEXTPROC glMultiDrawArraysEXT;
-    extern PFNGLMULTIDRAWELEMENTARRAYAPPLEPROC glMultiDrawElementArrayAPPLE;
-    extern PFNGLMULTIDRAWELEMENTSPROC glMultiDrawElements;
-    extern PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glMultiDrawElementsBaseVertex;
-    extern PFNGLMULTIDRAWELEMENTSEXTPROC glMultiDrawElementsEXT;
-    extern PFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC glMultiDrawRangeElementArrayAPPLE;
-    extern PFNGLMULTIMODEDRAWARRAYSIBMPROC glMultiModeDrawArraysIBM;
-    extern PFNGLMULTIMODEDRAWELEMENTSIBMPROC glMultiModeDrawElementsIBM;
-    extern PFNGLMULTITEXBUFFEREXTPROC glMultiTexBufferEXT;
-    extern PFNGLMULTITEXCOORD1DPROC glMultiTexCoord1d;
-    extern PFNGLMULTITEXCOORD1DARBPROC glMultiTexCoord1dARB;
-    extern PFNGLMULTITEXCOORD1DVPROC glMultiTexCoord1dv;
-    extern PFNGLMULTITEXCOORD1DVARBPROC glMultiTexCoord1dvARB;
-    extern PFNGLMULTITEXCOORD1FPROC glMultiTexCoord1f;
-    extern PFNGLMULTITEXCOORD1FARBPROC glMultiTexCoord1fARB;
-    extern PFNGLMULTITEXCOORD1FVPROC glMultiTexCoord1fv;
-    extern PFNGLMULTITEXCOORD1FVARBPROC glMultiTexCoord1fvARB;
-    extern PFNGLMULTITEXCOORD1HNVPROC glMultiTexCoord1hNV;
-    extern PFNGLMULTITEXCOORD1HVNVPROC glMultiTexCoord1hvNV;
-    extern PFNGLMULTITEXCOORD1IPROC glMultiTexCoord1i;
-    extern PFNGLMULTITEXCOORD1IARBPROC glMultiTexCoord1iARB;
-    extern PFNGLMULTITEXCOORD1IVPROC glMultiTexCoord1iv;
-    extern PFNGLMULTITEXCOORD1IVARBPROC glMultiTexCoord1ivARB;
-    extern PFNGLMULTITEXCOORD1SPROC glMultiTexCoord1s;
-    extern PFNGLMULTITEXCOORD1SARBPROC glMultiTexCoord1sARB;
-    extern PFNGLMULTITEXCOORD1SVPROC glMultiTexCoord1sv;
-    extern PFNGLMULTITEXCOORD1SVARBPROC glMultiTexCoord1svARB;
-    extern PFNGLMULTITEXCOORD2DPROC glMultiTexCoord2d;
-    extern PFNGLMULTITEXCOORD2DARBPROC glMultiTexCoord2dARB;
-    extern PFNGLMULTITEXCOORD2DVPROC glMultiTexCoord2dv;
-    extern PFNGLMULTITEXCOORD2DVARBPROC glMultiTexCoord2dvARB;
     extern PFNGLMULTITEXCOORD2FPROC glMultiTexCoord2f;
-    extern PFNGLMULTITEXCOORD2FARBPROC glMultiTexCoord2fARB;
-    extern PFNGLMULTITEXCOORD2FVPROC glMultiTexCoord2fv;
-    extern PFNGLMULTITEXCOORD2FVARBPROC glMultiTexCoord2fvARB;
-    extern PFNGLMULTITEXCOORD2HNVPROC glMultiTexCoord2hNV;
-    extern PFNGLMULTITEXCOORD2HVNVPROC glMultiTexCoord2hvNV;
-    extern PFNGLMULTITEXCOORD2IPROC glMultiTexCoord2i;
-    extern PFNGLMULTITEXCOORD2IARBPROC glMultiTexCoord2iARB;
-    extern PFNGLMULTITEXCOORD2IVPROC glMultiTexCoord2iv;
-    extern PFNGLMULTITEXCOORD2IVARBPROC glMultiTexCoord2ivARB;
-    extern PFNGLMULTITEXCOORD2SPROC glMultiTexCoord2s;
-    extern PFNGLMULTITEXCOORD2SARBPROC glMultiTexCoord2sARB;
-    extern PFNGLMULTITEXCOORD2SVPROC glMultiTexCoord2sv;
-    extern PFNGLMULTITEXCOORD2SVARBPROC glMultiTexCoord2svARB;
-    extern PFNGLMULTITEXCOORD3DPROC glMultiTexCoord3d;
-    extern PFNGLMULTITEXCOORD3DARBPROC glMultiTexCoord3dARB;
-    extern PFNGLMULTITEXCOORD3DVPROC glMultiTexCoord3dv;
-    extern PFNGLMULTITEXCOORD3DVARBPROC glMultiTexCoord3dvARB;
-    extern PFNGLMULTITEXCOORD3FPROC glMultiTexCoord3f;
-    extern PFNGLMULTITEXCOORD3FARBPROC glMultiTexCoord3fARB;
-    extern PFNGLMULTITEXCOORD3FVPROC glMultiTexCoord3fv;
-    extern PFNGLMULTITEXCOORD3FVARBPROC glMultiTexCoord3fvARB;
-    extern PFNGLMULTITEXCOORD3HNVPROC glMultiTexCoord3hNV;
-    extern PFNGLMULTITEXCOORD3HVNVPROC glMultiTexCoord3hvNV;
-    extern PFNGLMULTITEXCOORD3IPROC glMultiTexCoord3i;
-    extern PFNGLMULTITEXCOORD3IARBPROC glMultiTexCoord3iARB;
-    extern PFNGLMULTITEXCOORD3IVPROC glMultiTexCoord3iv;
-    extern PFNGLMULTITEXCOORD3IVARBPROC glMultiTexCoord3ivARB;
-    extern PFNGLMULTITEXCOORD3SPROC glMultiTexCoord3s;
-    extern PFNGLMULTITEXCOORD3SARBPROC glMultiTexCoord3sARB;
-    extern PFNGLMULTITEXCOORD3SVPROC glMultiTexCoord3sv;
-    extern PFNGLMULTITEXCOORD3SVARBPROC glMultiTexCoord3svARB;
-    extern PFNGLMULTITEXCOORD4DPROC glMultiTexCoord4d;
-    extern PFNGLMULTITEXCOORD4DARBPROC glMultiTexCoord4dARB;
-    extern PFNGLMULTITEXCOORD4DVPROC glMultiTexCoord4dv;
-    extern PFNGLMULTITEXCOORD4DVARBPROC glMultiTexCoord4dvARB;
-    extern PFNGLMULTITEXCOORD4FPROC glMultiTexCoord4f;
-    extern PFNGLMULTITEXCOORD4FARBPROC glMultiTexCoord4fARB;
-    extern PFNGLMULTITEXCOORD4FVPROC glMultiTexCoord4fv;
-    extern PFNGLMULTITEXCOORD4FVARBPROC glMultiTexCoord4fvARB;
-    extern PFNGLMULTITEXCOORD4HNVPROC glMultiTexCoord4hNV;
-    extern PFNGLMULTITEXCOORD4HVNVPROC glMultiTexCoord4hvNV;
-    extern PFNGLMULTITEXCOORD4IPROC glMultiTexCoord4i;
-    extern PFNGLMULTITEXCOORD4IARBPROC glMultiTexCoord4iARB;
-    extern PFNGLMULTITEXCOORD4IVPROC glMultiTexCoord4iv;
-    extern PFNGLMULTITEXCOORD4IVARBPROC glMultiTexCoord4ivARB;
-    extern PFNGLMULTITEXCOORD4SPROC glMultiTexCoord4s;
-    extern PFNGLMULTITEXCOORD4SARBPROC glMultiTexCoord4sARB;
-    extern PFNGLMULTITEXCOORD4SVPROC glMultiTexCoord4sv;
-    extern PFNGLMULTITEXCOORD4SVARBPROC glMultiTexCoord4svARB;
-    extern PFNGLMULTITEXCOORDP1UIPROC glMultiTexCoordP1ui;
-    extern PFNGLMULTITEXCOORDP1UIVPROC glMultiTexCoordP1uiv;
-    extern PFNGLMULTITEXCOORDP2UIPROC glMultiTexCoordP2ui;
-    extern PFNGLMULTITEXCOORDP2UIVPROC glMultiTexCoordP2uiv;
-    extern PFNGLMULTITEXCOORDP3UIPROC glMultiTexCoordP3ui;
-    extern PFNGLMULTITEXCOORDP3UIVPROC glMultiTexCoordP3uiv;
-    extern PFNGLMULTITEXCOORDP4UIPROC glMultiTexCoordP4ui;
-    extern PFNGLMULTITEXCOORDP4UIVPROC glMultiTexCoordP4uiv;
     extern PFNGLMULTITEXCOORDPOINTEREXTPROC glMultiTexCoordPointerEXT;
-    extern PFNGLMULTITEXENVFEXTPROC glMultiTexEnvfEXT;
-    extern PFNGLMULTITEXENVFVEXTPROC glMultiTexEnvfvEXT;
     extern PFNGLMULTITEXENVIEXTPROC glMultiTexEnviEXT;
-    extern PFNGLMULTITEXENVIVEXTPROC glMultiTexEnvivEXT;
-    extern PFNGLMULTITEXGENDEXTPROC glMultiTexGendEXT;
-    extern PFNGLMULTITEXGENDVEXTPROC glMultiTexGendvEXT;
-    extern PFNGLMULTITEXGENFEXTPROC glMultiTexGenfEXT;
-    extern PFNGLMULTITEXGENFVEXTPROC glMultiTexGenfvEXT;
-    extern PFNGLMULTITEXGENIEXTPROC glMultiTexGeniEXT;
-    extern PFNGLMULTITEXGENIVEXTPROC glMultiTexGenivEXT;
-    extern PFNGLMULTITEXIMAGE1DEXTPROC glMultiTexImage1DEXT;
-    extern PFNGLMULTITEXIMAGE2DEXTPROC glMultiTexImage2DEXT;
-    extern PFNGLMULTITEXIMAGE3DEXTPROC glMultiTexImage3DEXT;
-    extern PFNGLMULTITEXPARAMETERIIVEXTPROC glMultiTexParameterIivEXT;
-    extern PFNGLMULTITEXPARAMETERIUIVEXTPROC glMultiTexParameterIuivEXT;
-    extern PFNGLMULTITEXPARAMETERFEXTPROC glMultiTexParameterfEXT;
-    extern PFNGLMULTITEXPARAMETERFVEXTPROC glMultiTexParameterfvEXT;
-    extern PFNGLMULTITEXPARAMETERIEXTPROC glMultiTexParameteriEXT;
-    extern PFNGLMULTITEXPARAMETERIVEXTPROC glMultiTexParameterivEXT;
-    extern PFNGLMULTITEXRENDERBUFFEREXTPROC glMultiTexRenderbufferEXT;
-    extern PFNGLMULTITEXSUBIMAGE1DEXTPROC glMultiTexSubImage1DEXT;
-    extern PFNGLMULTITEXSUBIMAGE2DEXTPROC glMultiTexSubImage2DEXT;
-    extern PFNGLMULTITEXSUBIMAGE3DEXTPROC glMultiTexSubImage3DEXT;
-    extern PFNGLNAMEDBUFFERDATAEXTPROC glNamedBufferDataEXT;
-    extern PFNGLNAMEDBUFFERSUBDATAEXTPROC glNamedBufferSubDataEXT;
-    extern PFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC glNamedCopyBufferSubDataEXT;
-    extern PFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC glNamedFramebufferRenderbufferEXT;
-    extern PFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC glNamedFramebufferTexture1DEXT;
-    extern PFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC glNamedFramebufferTexture2DEXT;
-    extern PFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC glNamedFramebufferTexture3DEXT;
-    extern PFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC glNamedFramebufferTextureEXT;
-    extern PFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC glNamedFramebufferTextureFaceEXT;
-    extern PFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC glNamedFramebufferTextureLayerEXT;
-    extern PFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC glNamedProgramLocalParameter4dEXT;
-    extern PFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC glNamedProgramLocalParameter4dvEXT;
-    extern PFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC glNamedProgramLocalParameter4fEXT;
-    extern PFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC glNamedProgramLocalParameter4fvEXT;
-    extern PFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC glNamedProgramLocalParameterI4iEXT;
-    extern PFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC glNamedProgramLocalParameterI4ivEXT;
-    extern PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC glNamedProgramLocalParameterI4uiEXT;
-    extern PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC glNamedProgramLocalParameterI4uivEXT;
-    extern PFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC glNamedProgramLocalParameters4fvEXT;
-    extern PFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC glNamedProgramLocalParametersI4ivEXT;
-    extern PFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC glNamedProgramLocalParametersI4uivEXT;
-    extern PFNGLNAMEDPROGRAMSTRINGEXTPROC glNamedProgramStringEXT;
-    extern PFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC glNamedRenderbufferStorageEXT;
-    extern PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC glNamedRenderbufferStorageMultisampleCoverageEXT;
-    extern PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC glNamedRenderbufferStorageMultisampleEXT;
-    extern PFNGLNAMEDSTRINGARBPROC glNamedStringARB;
-    extern PFNGLNEWOBJECTBUFFERATIPROC glNewObjectBufferATI;
-    extern PFNGLNORMAL3FVERTEX3FSUNPROC glNormal3fVertex3fSUN;
-    extern PFNGLNORMAL3FVERTEX3FVSUNPROC glNormal3fVertex3fvSUN;
-    extern PFNGLNORMAL3HNVPROC glNormal3hNV;
-    extern PFNGLNORMAL3HVNVPROC glNormal3hvNV;
-    extern PFNGLNORMALFORMATNVPROC glNormalFormatNV;
-    extern PFNGLNORMALP3UIPROC glNormalP3ui;
-    extern PFNGLNORMALP3UIVPROC glNormalP3uiv;
-    extern PFNGLNORMALPOINTEREXTPROC glNormalPointerEXT;
-    extern PFNGLNORMALPOINTERLISTIBMPROC glNormalPointerListIBM;
-    extern PFNGLNORMALPOINTERVINTELPROC glNormalPointervINTEL;
-    extern PFNGLNORMALSTREAM3BATIPROC glNormalStream3bATI;
-    extern PFNGLNORMALSTREAM3BVATIPROC glNormalStream3bvATI;
-    extern PFNGLNORMALSTREAM3DATIPROC glNormalStream3dATI;
-    extern PFNGLNORMALSTREAM3DVATIPROC glNormalStream3dvATI;
-    extern PFNGLNORMALSTREAM3FATIPROC glNormalStream3fATI;
-    extern PFNGLNORMALSTREAM3FVATIPROC glNormalStream3fvATI;
-    extern PFNGLNORMALSTREAM3IATIPROC glNormalStream3iATI;
-    extern PFNGLNORMALSTREAM3IVATIPROC glNormalStream3ivATI;
-    extern PFNGLNORMALSTREAM3SATIPROC glNormalStream3sATI;
-    extern PFNGLNORMALSTREAM3SVATIPROC glNormalStream3svATI;
-    extern PFNGLOBJECTPURGEABLEAPPLEPROC glObjectPurgeableAPPLE;
-    extern PFNGLOBJECTUNPURGEABLEAPPLEPROC glObjectUnpurgeableAPPLE;
-    extern PFNGLPNTRIANGLESFATIPROC glPNTrianglesfATI;
-    extern PFNGLPNTRIANGLESIATIPROC glPNTrianglesiATI;
-    extern PFNGLPASSTEXCOORDATIPROC glPassTexCoordATI;
-    extern PFNGLPATCHPARAMETERFVPROC glPatchParameterfv;
-    extern PFNGLPATCHPARAMETERIPROC glPatchParameteri;
-    extern PFNGLPAUSETRANSFORMFEEDBACKPROC glPauseTransformFeedback;
-    extern PFNGLPAUSETRANSFORMFEEDBACKNVPROC glPauseTransformFeedbackNV;
-    extern PFNGLPIXELDATARANGENVPROC glPixelDataRangeNV;
-    extern PFNGLPIXELTEXGENPARAMETERFSGISPROC glPixelTexGenParameterfSGIS;
-    extern PFNGLPIXELTEXGENPARAMETERFVSGISPROC glPixelTexGenParameterfvSGIS;
-    extern PFNGLPIXELTEXGENPARAMETERISGISPROC glPixelTexGenParameteriSGIS;
-    extern PFNGLPIXELTEXGENPARAMETERIVSGISPROC glPixelTexGenParameterivSGIS;
-    extern PFNGLPIXELTEXGENSGIXPROC glPixelTexGenSGIX;
-    extern PFNGLPIXELTRANSFORMPARAMETERFEXTPROC glPixelTransformParameterfEXT;
-    extern PFNGLPIXELTRANSFORMPARAMETERFVEXTPROC glPixelTransformParameterfvEXT;
-    extern PFNGLPIXELTRANSFORMPARAMETERIEXTPROC glPixelTransformParameteriEXT;
-    extern PFNGLPIXELTRANSFORMPARAMETERIVEXTPROC glPixelTransformParameterivEXT;
-    extern PFNGLPOINTPARAMETERFPROC glPointParameterf;
-    extern PFNGLPOINTPARAMETERFARBPROC glPointParameterfARB;
-    extern PFNGLPOINTPARAMETERFEXTPROC glPointParameterfEXT;
-    extern PFNGLPOINTPARAMETERFSGISPROC glPointParameterfSGIS;
-    extern PFNGLPOINTPARAMETERFVPROC glPointParameterfv;
-    extern PFNGLPOINTPARAMETERFVARBPROC glPointParameterfvARB;
-    extern PFNGLPOINTPARAMETERFVEXTPROC glPointParameterfvEXT;
-    extern PFNGLPOINTPARAMETERFVSGISPROC glPointParameterfvSGIS;
-    extern PFNGLPOINTPARAMETERIPROC glPointParameteri;
-    extern PFNGLPOINTPARAMETERINVPROC glPointParameteriNV;
-    extern PFNGLPOINTPARAMETERIVPROC glPointParameteriv;
-    extern PFNGLPOINTPARAMETERIVNVPROC glPointParameterivNV;
-    extern PFNGLPOLLASYNCSGIXPROC glPollAsyncSGIX;
-    extern PFNGLPOLLINSTRUMENTSSGIXPROC glPollInstrumentsSGIX;
-    extern PFNGLPOLYGONOFFSETEXTPROC glPolygonOffsetEXT;
-    extern PFNGLPRESENTFRAMEDUALFILLNVPROC glPresentFrameDualFillNV;
-    extern PFNGLPRESENTFRAMEKEYEDNVPROC glPresentFrameKeyedNV;
-    extern PFNGLPRIMITIVERESTARTINDEXPROC glPrimitiveRestartIndex;
-    extern PFNGLPRIMITIVERESTARTINDEXNVPROC glPrimitiveRestartIndexNV;
-    extern PFNGLPRIMITIVERESTARTNVPROC glPrimitiveRestartNV;
-    extern PFNGLPRIORITIZETEXTURESEXTPROC glPrioritizeTexturesEXT;
-    extern PFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC glProgramBufferParametersIivNV;
-    extern PFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC glProgramBufferParametersIuivNV;
-    extern PFNGLPROGRAMBUFFERPARAMETERSFVNVPROC glProgramBufferParametersfvNV;
-    extern PFNGLPROGRAMENVPARAMETER4DARBPROC glProgramEnvParameter4dARB;
-    extern PFNGLPROGRAMENVPARAMETER4DVARBPROC glProgramEnvParameter4dvARB;
-    extern PFNGLPROGRAMENVPARAMETER4FARBPROC glProgramEnvParameter4fARB;
-    extern PFNGLPROGRAMENVPARAMETER4FVARBPROC glProgramEnvParameter4fvARB;
-    extern PFNGLPROGRAMENVPARAMETERI4INVPROC glProgramEnvParameterI4iNV;
-    extern PFNGLPROGRAMENVPARAMETERI4IVNVPROC glProgramEnvParameterI4ivNV;
-    extern PFNGLPROGRAMENVPARAMETERI4UINVPROC glProgramEnvParameterI4uiNV;
-    extern PFNGLPROGRAMENVPARAMETERI4UIVNVPROC glProgramEnvParameterI4uivNV;
-    extern PFNGLPROGRAMENVPARAMETERS4FVEXTPROC glProgramEnvParameters4fvEXT;
-    extern PFNGLPROGRAMENVPARAMETERSI4IVNVPROC glProgramEnvParametersI4ivNV;
-    extern PFNGLPROGRAMENVPARAMETERSI4UIVNVPROC glProgramEnvParametersI4uivNV;
-    extern PFNGLPROGRAMLOCALPARAMETER4DARBPROC glProgramLocalParameter4dARB;
-    extern PFNGLPROGRAMLOCALPARAMETER4DVARBPROC glProgramLocalParameter4dvARB;
-    extern PFNGLPROGRAMLOCALPARAMETER4FARBPROC glProgramLocalParameter4fARB;
-    extern PFNGLPROGRAMLOCALPARAMETER4FVARBPROC glProgramLocalParameter4fvARB;
-    extern PFNGLPROGRAMLOCALPARAMETERI4INVPROC glProgramLocalParameterI4iNV;
-    extern PFNGLPROGRAMLOCALPARAMETERI4IVNVPROC glProgramLocalParameterI4ivNV;
-    extern PFNGLPROGRAMLOCALPARAMETERI4UINVPROC glProgramLocalParameterI4uiNV;
-    extern PFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC glProgramLocalParameterI4uivNV;
-    extern PFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC glProgramLocalParameters4fvEXT;
-    extern PFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC glProgramLocalParametersI4ivNV;
-    extern PFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC glProgramLocalParametersI4uivNV;
-    extern PFNGLPROGRAMNAMEDPARAMETER4DNVPROC glProgramNamedParameter4dNV;
-    extern PFNGLPROGRAMNAMEDPARAMETER4DVNVPROC glProgramNamedParameter4dvNV;
-    extern PFNGLPROGRAMNAMEDPARAMETER4FNVPROC glProgramNamedParameter4fNV;
-    extern PFNGLPROGRAMNAMEDPARAMETER4FVNVPROC glProgramNamedParameter4fvNV;
-    extern PFNGLPROGRAMPARAMETER4DNVPROC glProgramParameter4dNV;
-    extern PFNGLPROGRAMPARAMETER4DVNVPROC glProgramParameter4dvNV;
-    extern PFNGLPROGRAMPARAMETER4FNVPROC glProgramParameter4fNV;
-    extern PFNGLPROGRAMPARAMETER4FVNVPROC glProgramParameter4fvNV;
-    extern PFNGLPROGRAMPARAMETERIPROC glProgramParameteri;
-    extern PFNGLPROGRAMPARAMETERIARBPROC glProgramParameteriARB;
-    extern PFNGLPROGRAMPARAMETERIEXTPROC glProgramParameteriEXT;
-    extern PFNGLPROGRAMPARAMETERS4DVNVPROC glProgramParameters4dvNV;
-    extern PFNGLPROGRAMPARAMETERS4FVNVPROC glProgramParameters4fvNV;
-    extern PFNGLPROGRAMSTRINGARBPROC glProgramStringARB;
-    extern PFNGLPROGRAMUNIFORM1DEXTPROC glProgramUniform1dEXT;
-    extern PFNGLPROGRAMUNIFORM1DVEXTPROC glProgramUniform1dvEXT;
-    extern PFNGLPROGRAMUNIFORM1FEXTPROC glProgramUniform1fEXT;
-    extern PFNGLPROGRAMUNIFORM1FVEXTPROC glProgramUniform1fvEXT;
     extern PFNGLPROGRAMUNIFORM1IEXTPROC glProgramUniform1iEXT;
-    extern PFNGLPROGRAMUNIFORM1IVEXTPROC glProgramUniform1ivEXT;
-    extern PFNGLPROGRAMUNIFORM1UIEXTPROC glProgramUniform1uiEXT;
-    extern PFNGLPROGRAMUNIFORM1UIVEXTPROC glProgramUniform1uivEXT;
-    extern PFNGLPROGRAMUNIFORM2DEXTPROC glProgramUniform2dEXT;
-    extern PFNGLPROGRAMUNIFORM2DVEXTPROC glProgramUniform2dvEXT;
-    extern PFNGLPROGRAMUNIFORM2FEXTPROC glProgramUniform2fEXT;
-    extern PFNGLPROGRAMUNIFORM2FVEXTPROC glProgramUniform2fvEXT;
-    extern PFNGLPROGRAMUNIFORM2IEXTPROC glProgramUniform2iEXT;
-    extern PFNGLPROGRAMUNIFORM2IVEXTPROC glProgramUniform2ivEXT;
-    extern PFNGLPROGRAMUNIFORM2UIEXTPROC glProgramUniform2uiEXT;
-    extern PFNGLPROGRAMUNIFORM2UIVEXTPROC glProgramUniform2uivEXT;
-    extern PFNGLPROGRAMUNIFORM3DEXTPROC glProgramUniform3dEXT;
-    extern PFNGLPROGRAMUNIFORM3DVEXTPROC glProgramUniform3dvEXT;
-    extern PFNGLPROGRAMUNIFORM3FEXTPROC glProgramUniform3fEXT;
     extern PFNGLPROGRAMUNIFORM3FVEXTPROC glProgramUniform3fvEXT;
-    extern PFNGLPROGRAMUNIFORM3IEXTPROC glProgramUniform3iEXT;
-    extern PFNGLPROGRAMUNIFORM3IVEXTPROC glProgramUniform3ivEXT;
-    extern PFNGLPROGRAMUNIFORM3UIEXTPROC glProgramUniform3uiEXT;
-    extern PFNGLPROGRAMUNIFORM3UIVEXTPROC glProgramUniform3uivEXT;
-    extern PFNGLPROGRAMUNIFORM4DEXTPROC glProgramUniform4dEXT;
-    extern PFNGLPROGRAMUNIFORM4DVEXTPROC glProgramUniform4dvEXT;
-    extern PFNGLPROGRAMUNIFORM4FEXTPROC glProgramUniform4fEXT;
-    extern PFNGLPROGRAMUNIFORM4FVEXTPROC glProgramUniform4fvEXT;
-    extern PFNGLPROGRAMUNIFORM4IEXTPROC glProgramUniform4iEXT;
-    extern PFNGLPROGRAMUNIFORM4IVEXTPROC glProgramUniform4ivEXT;
-    extern PFNGLPROGRAMUNIFORM4UIEXTPROC glProgramUniform4uiEXT;
-    extern PFNGLPROGRAMUNIFORM4UIVEXTPROC glProgramUniform4uivEXT;
-    extern PFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC glProgramUniformMatrix2dvEXT;
-    extern PFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC glProgramUniformMatrix2fvEXT;
-    extern PFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC glProgramUniformMatrix2x3dvEXT;
-    extern PFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC glProgramUniformMatrix2x3fvEXT;
-    extern PFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC glProgramUniformMatrix2x4dvEXT;
-    extern PFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC glProgramUniformMatrix2x4fvEXT;
-    extern PFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC glProgramUniformMatrix3dvEXT;
-    extern PFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC glProgramUniformMatrix3fvEXT;
-    extern PFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC glProgramUniformMatrix3x2dvEXT;
-    extern PFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC glProgramUniformMatrix3x2fvEXT;
-    extern PFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC glProgramUniformMatrix3x4dvEXT;
-    extern PFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC glProgramUniformMatrix3x4fvEXT;
-    extern PFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC glProgramUniformMatrix4dvEXT;
     extern PFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC glProgramUniformMatrix4fvEXT;
-    extern PFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC glProgramUniformMatrix4x2dvEXT;
-    extern PFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC glProgramUniformMatrix4x2fvEXT;
-    extern PFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC glProgramUniformMatrix4x3dvEXT;
-    extern PFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC glProgramUniformMatrix4x3fvEXT;
-    extern PFNGLPROGRAMUNIFORMUI64NVPROC glProgramUniformui64NV;
-    extern PFNGLPROGRAMUNIFORMUI64VNVPROC glProgramUniformui64vNV;
-    extern PFNGLPROGRAMVERTEXLIMITNVPROC glProgramVertexLimitNV;
-    extern PFNGLPROVOKINGVERTEXPROC glProvokingVertex;
-    extern PFNGLPROVOKINGVERTEXEXTPROC glProvokingVertexEXT;
-    extern PFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC glPushClientAttribDefaultEXT;
-    extern PFNGLQUERYCOUNTERPROC glQueryCounter;
-    extern PFNGLREADINSTRUMENTSSGIXPROC glReadInstrumentsSGIX;
-    extern PFNGLREFERENCEPLANESGIXPROC glReferencePlaneSGIX;
     extern PFNGLRENDERBUFFERSTORAGEPROC glRenderbufferStorage;
     extern PFNGLRENDERBUFFERSTORAGEEXTPROC glRenderbufferStorageEXT;
-    extern PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glRenderbufferStorageMultisample;
-    extern PFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC glRenderbufferStorageMultisampleCoverageNV;
-    extern PFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC glRenderbufferStorageMultisampleEXT;
-    extern PFNGLREPLACEMENTCODEPOINTERSUNPROC glReplacementCodePointerSUN;
-    extern PFNGLREPLACEMENTCODEUBSUNPROC glReplacementCodeubSUN;
-    extern PFNGLREPLACEMENTCODEUBVSUNPROC glReplacementCodeubvSUN;
-    extern PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC glReplacementCodeuiColor3fVertex3fSUN;
-    extern PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC glReplacementCodeuiColor3fVertex3fvSUN;
-    extern PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC glReplacementCodeuiColor4fNormal3fVertex3fSUN;
-    extern PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC glReplacementCodeuiColor4fNormal3fVertex3fvSUN;
-    extern PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC glReplacementCodeuiColor4ubVertex3fSUN;
-    extern PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC glReplacementCodeuiColor4ubVertex3fvSUN;
-    extern PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC glReplacementCodeuiNormal3fVertex3fSUN;
-    extern PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC glReplacementCodeuiNormal3fVertex3fvSUN;
-    extern PFNGLREPLACEMENTCODEUISUNPROC glReplacementCodeuiSUN;
-    extern PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN;
-    extern PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN;
-    extern PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN;
-    extern PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN;
-    extern PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC glReplacementCodeuiTexCoord2fVertex3fSUN;
-    extern PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC glReplacementCodeuiTexCoord2fVertex3fvSUN;
-    extern PFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC glReplacementCodeuiVertex3fSUN;
-    extern PFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC glReplacementCodeuiVertex3fvSUN;
-    extern PFNGLREPLACEMENTCODEUIVSUNPROC glReplacementCodeuivSUN;
-    extern PFNGLREPLACEMENTCODEUSSUNPROC glReplacementCodeusSUN;
-    extern PFNGLREPLACEMENTCODEUSVSUNPROC glReplacementCodeusvSUN;
-    extern PFNGLREQUESTRESIDENTPROGRAMSNVPROC glRequestResidentProgramsNV;
-    extern PFNGLRESETHISTOGRAMPROC glResetHistogram;
-    extern PFNGLRESETHISTOGRAMEXTPROC glResetHistogramEXT;
-    extern PFNGLRESETMINMAXPROC glResetMinmax;
-    extern PFNGLRESETMINMAXEXTPROC glResetMinmaxEXT;
-    extern PFNGLRESIZEBUFFERSMESAPROC glResizeBuffersMESA;
-    extern PFNGLRESUMETRANSFORMFEEDBACKPROC glResumeTransformFeedback;
-    extern PFNGLRESUMETRANSFORMFEEDBACKNVPROC glResumeTransformFeedbackNV;
-    extern PFNGLSAMPLECOVERAGEPROC glSampleCoverage;
-    extern PFNGLSAMPLECOVERAGEARBPROC glSampleCoverageARB;
-    extern PFNGLSAMPLEMAPATIPROC glSampleMapATI;
-    extern PFNGLSAMPLEMASKEXTPROC glSampleMaskEXT;
-    extern PFNGLSAMPLEMASKINDEXEDNVPROC glSampleMaskIndexedNV;
-    extern PFNGLSAMPLEMASKSGISPROC glSampleMaskSGIS;
-    extern PFNGLSAMPLEMASKIPROC glSampleMaski;
-    extern PFNGLSAMPLEPATTERNEXTPROC glSamplePatternEXT;
-    extern PFNGLSAMPLEPATTERNSGISPROC glSamplePatternSGIS;
-    extern PFNGLSAMPLERPARAMETERIIVPROC glSamplerParameterIiv;
-    extern PFNGLSAMPLERPARAMETERIUIVPROC glSamplerParameterIuiv;
-    extern PFNGLSAMPLERPARAMETERFPROC glSamplerParameterf;
-    extern PFNGLSAMPLERPARAMETERFVPROC glSamplerParameterfv;
-    extern PFNGLSAMPLERPARAMETERIPROC glSamplerParameteri;
-    extern PFNGLSAMPLERPARAMETERIVPROC glSamplerParameteriv;
-    extern PFNGLSECONDARYCOLOR3BPROC glSecondaryColor3b;
-    extern PFNGLSECONDARYCOLOR3BEXTPROC glSecondaryColor3bEXT;
-    extern PFNGLSECONDARYCOLOR3BVPROC glSecondaryColor3bv;
-    extern PFNGLSECONDARYCOLOR3BVEXTPROC glSecondaryColor3bvEXT;
-    extern PFNGLSECONDARYCOLOR3DPROC glSecondaryColor3d;
-    extern PFNGLSECONDARYCOLOR3DEXTPROC glSecondaryColor3dEXT;
-    extern PFNGLSECONDARYCOLOR3DVPROC glSecondaryColor3dv;
-    extern PFNGLSECONDARYCOLOR3DVEXTPROC glSecondaryColor3dvEXT;
-    extern PFNGLSECONDARYCOLOR3FPROC glSecondaryColor3f;
-    extern PFNGLSECONDARYCOLOR3FEXTPROC glSecondaryColor3fEXT;
-    extern PFNGLSECONDARYCOLOR3FVPROC glSecondaryColor3fv;
-    extern PFNGLSECONDARYCOLOR3FVEXTPROC glSecondaryColor3fvEXT;
-    extern PFNGLSECONDARYCOLOR3HNVPROC glSecondaryColor3hNV;
-    extern PFNGLSECONDARYCOLOR3HVNVPROC glSecondaryColor3hvNV;
-    extern PFNGLSECONDARYCOLOR3IPROC glSecondaryColor3i;
-    extern PFNGLSECONDARYCOLOR3IEXTPROC glSecondaryColor3iEXT;
-    extern PFNGLSECONDARYCOLOR3IVPROC glSecondaryColor3iv;
-    extern PFNGLSECONDARYCOLOR3IVEXTPROC glSecondaryColor3ivEXT;
-    extern PFNGLSECONDARYCOLOR3SPROC glSecondaryColor3s;
-    extern PFNGLSECONDARYCOLOR3SEXTPROC glSecondaryColor3sEXT;
-    extern PFNGLSECONDARYCOLOR3SVPROC glSecondaryColor3sv;
-    extern PFNGLSECONDARYCOLOR3SVEXTPROC glSecondaryColor3svEXT;
-    extern PFNGLSECONDARYCOLOR3UBPROC glSecondaryColor3ub;
-    extern PFNGLSECONDARYCOLOR3UBEXTPROC glSecondaryColor3ubEXT;
-    extern PFNGLSECONDARYCOLOR3UBVPROC glSecondaryColor3ubv;
-    extern PFNGLSECONDARYCOLOR3UBVEXTPROC glSecondaryColor3ubvEXT;
-    extern PFNGLSECONDARYCOLOR3UIPROC glSecondaryColor3ui;
-    extern PFNGLSECONDARYCOLOR3UIEXTPROC glSecondaryColor3uiEXT;
-    extern PFNGLSECONDARYCOLOR3UIVPROC glSecondaryColor3uiv;
-    extern PFNGLSECONDARYCOLOR3UIVEXTPROC glSecondaryColor3uivEXT;
-    extern PFNGLSECONDARYCOLOR3USPROC glSecondaryColor3us;
-    extern PFNGLSECONDARYCOLOR3USEXTPROC glSecondaryColor3usEXT;
-    extern PFNGLSECONDARYCOLOR3USVPROC glSecondaryColor3usv;
-    extern PFNGLSECONDARYCOLOR3USVEXTPROC glSecondaryColor3usvEXT;
-    extern PFNGLSECONDARYCOLORFORMATNVPROC glSecondaryColorFormatNV;
-    extern PFNGLSECONDARYCOLORP3UIPROC glSecondaryColorP3ui;
-    extern PFNGLSECONDARYCOLORP3UIVPROC glSecondaryColorP3uiv;
-    extern PFNGLSECONDARYCOLORPOINTERPROC glSecondaryColorPointer;
-    extern PFNGLSECONDARYCOLORPOINTEREXTPROC glSecondaryColorPointerEXT;
-    extern PFNGLSECONDARYCOLORPOINTERLISTIBMPROC glSecondaryColorPointerListIBM;
-    extern PFNGLSELECTPERFMONITORCOUNTERSAMDPROC glSelectPerfMonitorCountersAMD;
-    extern PFNGLSEPARABLEFILTER2DPROC glSeparableFilter2D;
-    extern PFNGLSEPARABLEFILTER2DEXTPROC glSeparableFilter2DEXT;
-    extern PFNGLSETFENCEAPPLEPROC glSetFenceAPPLE;
-    extern PFNGLSETFENCENVPROC glSetFenceNV;
-    extern PFNGLSETFRAGMENTSHADERCONSTANTATIPROC glSetFragmentShaderConstantATI;
-    extern PFNGLSETINVARIANTEXTPROC glSetInvariantEXT;
-    extern PFNGLSETLOCALCONSTANTEXTPROC glSetLocalConstantEXT;
-    extern PFNGLSHADEROP1EXTPROC glShaderOp1EXT;
-    extern PFNGLSHADEROP2EXTPROC glShaderOp2EXT;
-    extern PFNGLSHADEROP3EXTPROC glShaderOp3EXT;
     extern PFNGLSHADERSOURCEPROC glShaderSource;
-    extern PFNGLSHADERSOURCEARBPROC glShaderSourceARB;
-    extern PFNGLSHARPENTEXFUNCSGISPROC glSharpenTexFuncSGIS;
-    extern PFNGLSPRITEPARAMETERFSGIXPROC glSpriteParameterfSGIX;
-    extern PFNGLSPRITEPARAMETERFVSGIXPROC glSpriteParameterfvSGIX;
-    extern PFNGLSPRITEPARAMETERISGIXPROC glSpriteParameteriSGIX;
-    extern PFNGLSPRITEPARAMETERIVSGIXPROC glSpriteParameterivSGIX;
-    extern PFNGLSTARTINSTRUMENTSSGIXPROC glStartInstrumentsSGIX;
-    extern PFNGLSTENCILCLEARTAGEXTPROC glStencilClearTagEXT;
-    extern PFNGLSTENCILFUNCSEPARATEPROC glStencilFuncSeparate;
-    extern PFNGLSTENCILFUNCSEPARATEATIPROC glStencilFuncSeparateATI;
-    extern PFNGLSTENCILMASKSEPARATEPROC glStencilMaskSeparate;
-    extern PFNGLSTENCILOPSEPARATEPROC glStencilOpSeparate;
-    extern PFNGLSTENCILOPSEPARATEATIPROC glStencilOpSeparateATI;
-    extern PFNGLSTOPINSTRUMENTSSGIXPROC glStopInstrumentsSGIX;
-    extern PFNGLSTRINGMARKERGREMEDYPROC glStringMarkerGREMEDY;
-    extern PFNGLSWIZZLEEXTPROC glSwizzleEXT;
-    extern PFNGLTAGSAMPLEBUFFERSGIXPROC glTagSampleBufferSGIX;
-    extern PFNGLTANGENT3BEXTPROC glTangent3bEXT;
-    extern PFNGLTANGENT3BVEXTPROC glTangent3bvEXT;
-    extern PFNGLTANGENT3DEXTPROC glTangent3dEXT;
-    extern PFNGLTANGENT3DVEXTPROC glTangent3dvEXT;
-    extern PFNGLTANGENT3FEXTPROC glTangent3fEXT;
-    extern PFNGLTANGENT3FVEXTPROC glTangent3fvEXT;
-    extern PFNGLTANGENT3IEXTPROC glTangent3iEXT;
-    extern PFNGLTANGENT3IVEXTPROC glTangent3ivEXT;
-    extern PFNGLTANGENT3SEXTPROC glTangent3sEXT;
-    extern PFNGLTANGENT3SVEXTPROC glTangent3svEXT;
-    extern PFNGLTANGENTPOINTEREXTPROC glTangentPointerEXT;
-    extern PFNGLTBUFFERMASK3DFXPROC glTbufferMask3DFX;
-    extern PFNGLTESSELLATIONFACTORAMDPROC glTessellationFactorAMD;
-    extern PFNGLTESSELLATIONMODEAMDPROC glTessellationModeAMD;
-    extern PFNGLTESTFENCEAPPLEPROC glTestFenceAPPLE;
-    extern PFNGLTESTFENCENVPROC glTestFenceNV;
-    extern PFNGLTESTOBJECTAPPLEPROC glTestObjectAPPLE;
-    extern PFNGLTEXBUFFERPROC glTexBuffer;
-    extern PFNGLTEXBUFFERARBPROC glTexBufferARB;
-    extern PFNGLTEXBUFFEREXTPROC glTexBufferEXT;
-    extern PFNGLTEXBUMPPARAMETERFVATIPROC glTexBumpParameterfvATI;
-    extern PFNGLTEXBUMPPARAMETERIVATIPROC glTexBumpParameterivATI;
-    extern PFNGLTEXCOORD1HNVPROC glTexCoord1hNV;
-    extern PFNGLTEXCOORD1HVNVPROC glTexCoord1hvNV;
-    extern PFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC glTexCoord2fColor3fVertex3fSUN;
-    extern PFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC glTexCoord2fColor3fVertex3fvSUN;
-    extern PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC glTexCoord2fColor4fNormal3fVertex3fSUN;
-    extern PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC glTexCoord2fColor4fNormal3fVertex3fvSUN;
-    extern PFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC glTexCoord2fColor4ubVertex3fSUN;
-    extern PFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC glTexCoord2fColor4ubVertex3fvSUN;
-    extern PFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC glTexCoord2fNormal3fVertex3fSUN;
-    extern PFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC glTexCoord2fNormal3fVertex3fvSUN;
-    extern PFNGLTEXCOORD2FVERTEX3FSUNPROC glTexCoord2fVertex3fSUN;
-    extern PFNGLTEXCOORD2FVERTEX3FVSUNPROC glTexCoord2fVertex3fvSUN;
-    extern PFNGLTEXCOORD2HNVPROC glTexCoord2hNV;
-    extern PFNGLTEXCOORD2HVNVPROC glTexCoord2hvNV;
-    extern PFNGLTEXCOORD3HNVPROC glTexCoord3hNV;
-    extern PFNGLTEXCOORD3HVNVPROC glTexCoord3hvNV;
-    extern PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC glTexCoord4fColor4fNormal3fVertex4fSUN;
-    extern PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC glTexCoord4fColor4fNormal3fVertex4fvSUN;
-    extern PFNGLTEXCOORD4FVERTEX4FSUNPROC glTexCoord4fVertex4fSUN;
-    extern PFNGLTEXCOORD4FVERTEX4FVSUNPROC glTexCoord4fVertex4fvSUN;
-    extern PFNGLTEXCOORD4HNVPROC glTexCoord4hNV;
-    extern PFNGLTEXCOORD4HVNVPROC glTexCoord4hvNV;
-    extern PFNGLTEXCOORDFORMATNVPROC glTexCoordFormatNV;
-    extern PFNGLTEXCOORDP1UIPROC glTexCoordP1ui;
-    extern PFNGLTEXCOORDP1UIVPROC glTexCoordP1uiv;
-    extern PFNGLTEXCOORDP2UIPROC glTexCoordP2ui;
-    extern PFNGLTEXCOORDP2UIVPROC glTexCoordP2uiv;
-    extern PFNGLTEXCOORDP3UIPROC glTexCoordP3ui;
-    extern PFNGLTEXCOORDP3UIVPROC glTexCoordP3uiv;
-    extern PFNGLTEXCOORDP4UIPROC glTexCoordP4ui;
-    extern PFNGLTEXCOORDP4UIVPROC glTexCoordP4uiv;
-    extern PFNGLTEXCOORDPOINTEREXTPROC glTexCoordPointerEXT;
-    extern PFNGLTEXCOORDPOINTERLISTIBMPROC glTexCoordPointerListIBM;
-    extern PFNGLTEXCOORDPOINTERVINTELPROC glTexCoordPointervINTEL;
-    extern PFNGLTEXFILTERFUNCSGISPROC glTexFilterFuncSGIS;
-    extern PFNGLTEXIMAGE2DMULTISAMPLEPROC glTexImage2DMultisample;
-    extern PFNGLTEXIMAGE3DPROC glTexImage3D;
-    extern PFNGLTEXIMAGE3DEXTPROC glTexImage3DEXT;
-    extern PFNGLTEXIMAGE3DMULTISAMPLEPROC glTexImage3DMultisample;
-    extern PFNGLTEXIMAGE4DSGISPROC glTexImage4DSGIS;
-    extern PFNGLTEXPARAMETERIIVPROC glTexParameterIiv;
-    extern PFNGLTEXPARAMETERIIVEXTPROC glTexParameterIivEXT;
-    extern PFNGLTEXPARAMETERIUIVPROC glTexParameterIuiv;
-    extern PFNGLTEXPARAMETERIUIVEXTPROC glTexParameterIuivEXT;
-    extern PFNGLTEXRENDERBUFFERNVPROC glTexRenderbufferNV;
-    extern PFNGLTEXSUBIMAGE1DEXTPROC glTexSubImage1DEXT;
-    extern PFNGLTEXSUBIMAGE2DEXTPROC glTexSubImage2DEXT;
-    extern PFNGLTEXSUBIMAGE3DPROC glTexSubImage3D;
-    extern PFNGLTEXSUBIMAGE3DEXTPROC glTexSubImage3DEXT;
-    extern PFNGLTEXSUBIMAGE4DSGISPROC glTexSubImage4DSGIS;
-    extern PFNGLTEXTUREBARRIERNVPROC glTextureBarrierNV;
-    extern PFNGLTEXTUREBUFFEREXTPROC glTextureBufferEXT;
-    extern PFNGLTEXTURECOLORMASKSGISPROC glTextureColorMaskSGIS;
-    extern PFNGLTEXTUREIMAGE1DEXTPROC glTextureImage1DEXT;
-    extern PFNGLTEXTUREIMAGE2DEXTPROC glTextureImage2DEXT;
-    extern PFNGLTEXTUREIMAGE3DEXTPROC glTextureImage3DEXT;
-    extern PFNGLTEXTURELIGHTEXTPROC glTextureLightEXT;
-    extern PFNGLTEXTUREMATERIALEXTPROC glTextureMaterialEXT;
-    extern PFNGLTEXTURENORMALEXTPROC glTextureNormalEXT;
-    extern PFNGLTEXTUREPARAMETERIIVEXTPROC glTextureParameterIivEXT;
-    extern PFNGLTEXTUREPARAMETERIUIVEXTPROC glTextureParameterIuivEXT;
-    extern PFNGLTEXTUREPARAMETERFEXTPROC glTextureParameterfEXT;
-    extern PFNGLTEXTUREPARAMETERFVEXTPROC glTextureParameterfvEXT;
-    extern PFNGLTEXTUREPARAMETERIEXTPROC glTextureParameteriEXT;
-    extern PFNGLTEXTUREPARAMETERIVEXTPROC glTextureParameterivEXT;
-    extern PFNGLTEXTURERANGEAPPLEPROC glTextureRangeAPPLE;
-    extern PFNGLTEXTURERENDERBUFFEREXTPROC glTextureRenderbufferEXT;
-    extern PFNGLTEXTURESUBIMAGE1DEXTPROC glTextureSubImage1DEXT;
-    extern PFNGLTEXTURESUBIMAGE2DEXTPROC glTextureSubImage2DEXT;
-    extern PFNGLTEXTURESUBIMAGE3DEXTPROC glTextureSubImage3DEXT;
-    extern PFNGLTRACKMATRIXNVPROC glTrackMatrixNV;
-    extern PFNGLTRANSFORMFEEDBACKATTRIBSNVPROC glTransformFeedbackAttribsNV;
-    extern PFNGLTRANSFORMFEEDBACKVARYINGSPROC glTransformFeedbackVaryings;
-    extern PFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC glTransformFeedbackVaryingsEXT;
-    extern PFNGLTRANSFORMFEEDBACKVARYINGSNVPROC glTransformFeedbackVaryingsNV;
-    extern PFNGLUNIFORM1DPROC glUniform1d;
-    extern PFNGLUNIFORM1DVPROC glUniform1dv;
-    extern PFNGLUNIFORM1FPROC glUniform1f;
-    extern PFNGLUNIFORM1FARBPROC glUniform1fARB;
-    extern PFNGLUNIFORM1FVPROC glUniform1fv;
-    extern PFNGLUNIFORM1FVARBPROC glUniform1fvARB;
-    extern PFNGLUNIFORM1IPROC glUniform1i;
-    extern PFNGLUNIFORM1IARBPROC glUniform1iARB;
-    extern PFNGLUNIFORM1IVPROC glUniform1iv;
-    extern PFNGLUNIFORM1IVARBPROC glUniform1ivARB;
-    extern PFNGLUNIFORM1UIPROC glUniform1ui;
-    extern PFNGLUNIFORM1UIEXTPROC glUniform1uiEXT;
-    extern PFNGLUNIFORM1UIVPROC glUniform1uiv;
-    extern PFNGLUNIFORM1UIVEXTPROC glUniform1uivEXT;
-    extern PFNGLUNIFORM2DPROC glUniform2d;
-    extern PFNGLUNIFORM2DVPROC glUniform2dv;
-    extern PFNGLUNIFORM2FPROC glUniform2f;
-    extern PFNGLUNIFORM2FARBPROC glUniform2fARB;
-    extern PFNGLUNIFORM2FVPROC glUniform2fv;
-    extern PFNGLUNIFORM2FVARBPROC glUniform2fvARB;
-    extern PFNGLUNIFORM2IPROC glUniform2i;
-    extern PFNGLUNIFORM2IARBPROC glUniform2iARB;
-    extern PFNGLUNIFORM2IVPROC glUniform2iv;
-    extern PFNGLUNIFORM2IVARBPROC glUniform2ivARB;
-    extern PFNGLUNIFORM2UIPROC glUniform2ui;
-    extern PFNGLUNIFORM2UIEXTPROC glUniform2uiEXT;
-    extern PFNGLUNIFORM2UIVPROC glUniform2uiv;
-    extern PFNGLUNIFORM2UIVEXTPROC glUniform2uivEXT;
-    extern PFNGLUNIFORM3DPROC glUniform3d;
-    extern PFNGLUNIFORM3DVPROC glUniform3dv;
-    extern PFNGLUNIFORM3FPROC glUniform3f;
-    extern PFNGLUNIFORM3FARBPROC glUniform3fARB;
-    extern PFNGLUNIFORM3FVPROC glUniform3fv;
-    extern PFNGLUNIFORM3FVARBPROC glUniform3fvARB;
-    extern PFNGLUNIFORM3IPROC glUniform3i;
-    extern PFNGLUNIFORM3IARBPROC glUniform3iARB;
-    extern PFNGLUNIFORM3IVPROC glUniform3iv;
-    extern PFNGLUNIFORM3IVARBPROC glUniform3ivARB;
-    extern PFNGLUNIFORM3UIPROC glUniform3ui;
-    extern PFNGLUNIFORM3UIEXTPROC glUniform3uiEXT;
-    extern PFNGLUNIFORM3UIVPROC glUniform3uiv;
-    extern PFNGLUNIFORM3UIVEXTPROC glUniform3uivEXT;
-    extern PFNGLUNIFORM4DPROC glUniform4d;
-    extern PFNGLUNIFORM4DVPROC glUniform4dv;
-    extern PFNGLUNIFORM4FPROC glUniform4f;
-    extern PFNGLUNIFORM4FARBPROC glUniform4fARB;
-    extern PFNGLUNIFORM4FVPROC glUniform4fv;
-    extern PFNGLUNIFORM4FVARBPROC glUniform4fvARB;
-    extern PFNGLUNIFORM4IPROC glUniform4i;
-    extern PFNGLUNIFORM4IARBPROC glUniform4iARB;
-    extern PFNGLUNIFORM4IVPROC glUniform4iv;
-    extern PFNGLUNIFORM4IVARBPROC glUniform4ivARB;
-    extern PFNGLUNIFORM4UIPROC glUniform4ui;
-    extern PFNGLUNIFORM4UIEXTPROC glUniform4uiEXT;
-    extern PFNGLUNIFORM4UIVPROC glUniform4uiv;
-    extern PFNGLUNIFORM4UIVEXTPROC glUniform4uivEXT;
-    extern PFNGLUNIFORMBLOCKBINDINGPROC glUniformBlockBinding;
-    extern PFNGLUNIFORMBUFFEREXTPROC glUniformBufferEXT;
-    extern PFNGLUNIFORMMATRIX2DVPROC glUniformMatrix2dv;
-    extern PFNGLUNIFORMMATRIX2FVPROC glUniformMatrix2fv;
-    extern PFNGLUNIFORMMATRIX2FVARBPROC glUniformMatrix2fvARB;
-    extern PFNGLUNIFORMMATRIX2X3DVPROC glUniformMatrix2x3dv;
-    extern PFNGLUNIFORMMATRIX2X3FVPROC glUniformMatrix2x3fv;
-    extern PFNGLUNIFORMMATRIX2X4DVPROC glUniformMatrix2x4dv;
-    extern PFNGLUNIFORMMATRIX2X4FVPROC glUniformMatrix2x4fv;
-    extern PFNGLUNIFORMMATRIX3DVPROC glUniformMatrix3dv;
-    extern PFNGLUNIFORMMATRIX3FVPROC glUniformMatrix3fv;
-    extern PFNGLUNIFORMMATRIX3FVARBPROC glUniformMatrix3fvARB;
-    extern PFNGLUNIFORMMATRIX3X2DVPROC glUniformMatrix3x2dv;
-    extern PFNGLUNIFORMMATRIX3X2FVPROC glUniformMatrix3x2fv;
-    extern PFNGLUNIFORMMATRIX3X4DVPROC glUniformMatrix3x4dv;
-    extern PFNGLUNIFORMMATRIX3X4FVPROC glUniformMatrix3x4fv;
-    extern PFNGLUNIFORMMATRIX4DVPROC glUniformMatrix4dv;
-    extern PFNGLUNIFORMMATRIX4FVPROC glUniformMatrix4fv;
-    extern PFNGLUNIFORMMATRIX4FVARBPROC glUniformMatrix4fvARB;
-    extern PFNGLUNIFORMMATRIX4X2DVPROC glUniformMatrix4x2dv;
-    extern PFNGLUNIFORMMATRIX4X2FVPROC glUniformMatrix4x2fv;
-    extern PFNGLUNIFORMMATRIX4X3DVPROC glUniformMatrix4x3dv;
-    extern PFNGLUNIFORMMATRIX4X3FVPROC glUniformMatrix4x3fv;
-    extern PFNGLUNIFORMSUBROUTINESUIVPROC glUniformSubroutinesuiv;
-    extern PFNGLUNIFORMUI64NVPROC glUniformui64NV;
-    extern PFNGLUNIFORMUI64VNVPROC glUniformui64vNV;
-    extern PFNGLUNLOCKARRAYSEXTPROC glUnlockArraysEXT;
     extern PFNGLUNMAPBUFFERPROC glUnmapBuffer;
-    extern PFNGLUNMAPBUFFERARBPROC glUnmapBufferARB;
-    extern PFNGLUNMAPNAMEDBUFFEREXTPROC glUnmapNamedBufferEXT;
-    extern PFNGLUNMAPOBJECTBUFFERATIPROC glUnmapObjectBufferATI;
-    extern PFNGLUPDATEOBJECTBUFFERATIPROC glUpdateObjectBufferATI;
     extern PFNGLUSEPROGRAMPROC glUseProgram;
-    extern PFNGLUSEPROGRAMOBJECTARBPROC glUseProgramObjectARB;
-    extern PFNGLUSESHADERPROGRAMEXTPROC glUseShaderProgramEXT;
-    extern PFNGLVALIDATEPROGRAMPROC glValidateProgram;
-    extern PFNGLVALIDATEPROGRAMARBPROC glValidateProgramARB;
-    extern PFNGLVARIANTARRAYOBJECTATIPROC glVariantArrayObjectATI;
-    extern PFNGLVARIANTPOINTEREXTPROC glVariantPointerEXT;
-    extern PFNGLVARIANTBVEXTPROC glVariantbvEXT;
-    extern PFNGLVARIANTDVEXTPROC glVariantdvEXT;
-    extern PFNGLVARIANTFVEXTPROC glVariantfvEXT;
-    extern PFNGLVARIANTIVEXTPROC glVariantivEXT;
-    extern PFNGLVARIANTSVEXTPROC glVariantsvEXT;
-    extern PFNGLVARIANTUBVEXTPROC glVariantubvEXT;
-    extern PFNGLVARIANTUIVEXTPROC glVariantuivEXT;
-    extern PFNGLVARIANTUSVEXTPROC glVariantusvEXT;
-    extern PFNGLVERTEX2HNVPROC glVertex2hNV;
-    extern PFNGLVERTEX2HVNVPROC glVertex2hvNV;
-    extern PFNGLVERTEX3HNVPROC glVertex3hNV;
-    extern PFNGLVERTEX3HVNVPROC glVertex3hvNV;
-    extern PFNGLVERTEX4HNVPROC glVertex4hNV;
-    extern PFNGLVERTEX4HVNVPROC glVertex4hvNV;
-    extern PFNGLVERTEXARRAYPARAMETERIAPPLEPROC glVertexArrayParameteriAPPLE;
-    extern PFNGLVERTEXARRAYRANGEAPPLEPROC glVertexArrayRangeAPPLE;
-    extern PFNGLVERTEXARRAYRANGENVPROC glVertexArrayRangeNV;
-    extern PFNGLVERTEXATTRIB1DPROC glVertexAttrib1d;
-    extern PFNGLVERTEXATTRIB1DARBPROC glVertexAttrib1dARB;
-    extern PFNGLVERTEXATTRIB1DNVPROC glVertexAttrib1dNV;
-    extern PFNGLVERTEXATTRIB1DVPROC glVertexAttrib1dv;
-    extern PFNGLVERTEXATTRIB1DVARBPROC glVertexAttrib1dvARB;
-    extern PFNGLVERTEXATTRIB1DVNVPROC glVertexAttrib1dvNV;
-    extern PFNGLVERTEXATTRIB1FPROC glVertexAttrib1f;
-    extern PFNGLVERTEXATTRIB1FARBPROC glVertexAttrib1fARB;
-    extern PFNGLVERTEXATTRIB1FNVPROC glVertexAttrib1fNV;
-    extern PFNGLVERTEXATTRIB1FVPROC glVertexAttrib1fv;
-    extern PFNGLVERTEXATTRIB1FVARBPROC glVertexAttrib1fvARB;
-    extern PFNGLVERTEXATTRIB1FVNVPROC glVertexAttrib1fvNV;
-    extern PFNGLVERTEXATTRIB1HNVPROC glVertexAttrib1hNV;
-    extern PFNGLVERTEXATTRIB1HVNVPROC glVertexAttrib1hvNV;
-    extern PFNGLVERTEXATTRIB1SPROC glVertexAttrib1s;
-    extern PFNGLVERTEXATTRIB1SARBPROC glVertexAttrib1sARB;
-    extern PFNGLVERTEXATTRIB1SNVPROC glVertexAttrib1sNV;
-    extern PFNGLVERTEXATTRIB1SVPROC glVertexAttrib1sv;
-    extern PFNGLVERTEXATTRIB1SVARBPROC glVertexAttrib1svARB;
-    extern PFNGLVERTEXATTRIB1SVNVPROC glVertexAttrib1svNV;
-    extern PFNGLVERTEXATTRIB2DPROC glVertexAttrib2d;
-    extern PFNGLVERTEXATTRIB2DARBPROC glVertexAttrib2dARB;
-    extern PFNGLVERTEXATTRIB2DNVPROC glVertexAttrib2dNV;
-    extern PFNGLVERTEXATTRIB2DVPROC glVertexAttrib2dv;
-    extern PFNGLVERTEXATTRIB2DVARBPROC glVertexAttrib2dvARB;
-    extern PFNGLVERTEXATTRIB2DVNVPROC glVertexAttrib2dvNV;
-    extern PFNGLVERTEXATTRIB2FPROC glVertexAttrib2f;
-    extern PFNGLVERTEXATTRIB2FARBPROC glVertexAttrib2fARB;
-    extern PFNGLVERTEXATTRIB2FNVPROC glVertexAttrib2fNV;
-    extern PFNGLVERTEXATTRIB2FVPROC glVertexAttrib2fv;
-    extern PFNGLVERTEXATTRIB2FVARBPROC glVertexAttrib2fvARB;
-    extern PFNGLVERTEXATTRIB2FVNVPROC glVertexAttrib2fvNV;
-    extern PFNGLVERTEXATTRIB2HNVPROC glVertexAttrib2hNV;
-    extern PFNGLVERTEXATTRIB2HVNVPROC glVertexAttrib2hvNV;
-    extern PFNGLVERTEXATTRIB2SPROC glVertexAttrib2s;
-    extern PFNGLVERTEXATTRIB2SARBPROC glVertexAttrib2sARB;
-    extern PFNGLVERTEXATTRIB2SNVPROC glVertexAttrib2sNV;
-    extern PFNGLVERTEXATTRIB2SVPROC glVertexAttrib2sv;
-    extern PFNGLVERTEXATTRIB2SVARBPROC glVertexAttrib2svARB;
-    extern PFNGLVERTEXATTRIB2SVNVPROC glVertexAttrib2svNV;
-    extern PFNGLVERTEXATTRIB3DPROC glVertexAttrib3d;
-    extern PFNGLVERTEXATTRIB3DARBPROC glVertexAttrib3dARB;
-    extern PFNGLVERTEXATTRIB3DNVPROC glVertexAttrib3dNV;
-    extern PFNGLVERTEXATTRIB3DVPROC glVertexAttrib3dv;
-    extern PFNGLVERTEXATTRIB3DVARBPROC glVertexAttrib3dvARB;
-    extern PFNGLVERTEXATTRIB3DVNVPROC glVertexAttrib3dvNV;
-    extern PFNGLVERTEXATTRIB3FPROC glVertexAttrib3f;
-    extern PFNGLVERTEXATTRIB3FARBPROC glVertexAttrib3fARB;
-    extern PFNGLVERTEXATTRIB3FNVPROC glVertexAttrib3fNV;
-    extern PFNGLVERTEXATTRIB3FVPROC glVertexAttrib3fv;
-    extern PFNGLVERTEXATTRIB3FVARBPROC glVertexAttrib3fvARB;
-    extern PFNGLVERTEXATTRIB3FVNVPROC glVertexAttrib3fvNV;
-    extern PFNGLVERTEXATTRIB3HNVPROC glVertexAttrib3hNV;
-    extern PFNGLVERTEXATTRIB3HVNVPROC glVertexAttrib3hvNV;
-    extern PFNGLVERTEXATTRIB3SPROC glVertexAttrib3s;
-    extern PFNGLVERTEXATTRIB3SARBPROC glVertexAttrib3sARB;
-    extern PFNGLVERTEXATTRIB3SNVPROC glVertexAttrib3sNV;
-    extern PFNGLVERTEXATTRIB3SVPROC glVertexAttrib3sv;
-    extern PFNGLVERTEXATTRIB3SVARBPROC glVertexAttrib3svARB;
-    extern PFNGLVERTEXATTRIB3SVNVPROC glVertexAttrib3svNV;
-    extern PFNGLVERTEXATTRIB4NBVPROC glVertexAttrib4Nbv;
-    extern PFNGLVERTEXATTRIB4NBVARBPROC glVertexAttrib4NbvARB;
-    extern PFNGLVERTEXATTRIB4NIVPROC glVertexAttrib4Niv;
-    extern PFNGLVERTEXATTRIB4NIVARBPROC glVertexAttrib4NivARB;
-    extern PFNGLVERTEXATTRIB4NSVPROC glVertexAttrib4Nsv;
-    extern PFNGLVERTEXATTRIB4NSVARBPROC glVertexAttrib4NsvARB;
-    extern PFNGLVERTEXATTRIB4NUBPROC glVertexAttrib4Nub;
-    extern PFNGLVERTEXATTRIB4NUBARBPROC glVertexAttrib4NubARB;
-    extern PFNGLVERTEXATTRIB4NUBVPROC glVertexAttrib4Nubv;
-    extern PFNGLVERTEXATTRIB4NUBVARBPROC glVertexAttrib4NubvARB;
-    extern PFNGLVERTEXATTRIB4NUIVPROC glVertexAttrib4Nuiv;
-    extern PFNGLVERTEXATTRIB4NUIVARBPROC glVertexAttrib4NuivARB;
-    extern PFNGLVERTEXATTRIB4NUSVPROC glVertexAttrib4Nusv;
-    extern PFNGLVERTEXATTRIB4NUSVARBPROC glVertexAttrib4NusvARB;
-    extern PFNGLVERTEXATTRIB4BVPROC glVertexAttrib4bv;
-    extern PFNGLVERTEXATTRIB4BVARBPROC glVertexAttrib4bvARB;
-    extern PFNGLVERTEXATTRIB4DPROC glVertexAttrib4d;
-    extern PFNGLVERTEXATTRIB4DARBPROC glVertexAttrib4dARB;
-    extern PFNGLVERTEXATTRIB4DNVPROC glVertexAttrib4dNV;
-    extern PFNGLVERTEXATTRIB4DVPROC glVertexAttrib4dv;
-    extern PFNGLVERTEXATTRIB4DVARBPROC glVertexAttrib4dvARB;
-    extern PFNGLVERTEXATTRIB4DVNVPROC glVertexAttrib4dvNV;
-    extern PFNGLVERTEXATTRIB4FPROC glVertexAttrib4f;
-    extern PFNGLVERTEXATTRIB4FARBPROC glVertexAttrib4fARB;
-    extern PFNGLVERTEXATTRIB4FNVPROC glVertexAttrib4fNV;
-    extern PFNGLVERTEXATTRIB4FVPROC glVertexAttrib4fv;
-    extern PFNGLVERTEXATTRIB4FVARBPROC glVertexAttrib4fvARB;
-    extern PFNGLVERTEXATTRIB4FVNVPROC glVertexAttrib4fvNV;
-    extern PFNGLVERTEXATTRIB4HNVPROC glVertexAttrib4hNV;
-    extern PFNGLVERTEXATTRIB4HVNVPROC glVertexAttrib4hvNV;
-    extern PFNGLVERTEXATTRIB4IVPROC glVertexAttrib4iv;
-    extern PFNGLVERTEXATTRIB4IVARBPROC glVertexAttrib4ivARB;
-    extern PFNGLVERTEXATTRIB4SPROC glVertexAttrib4s;
-    extern PFNGLVERTEXATTRIB4SARBPROC glVertexAttrib4sARB;
-    extern PFNGLVERTEXATTRIB4SNVPROC glVertexAttrib4sNV;
-    extern PFNGLVERTEXATTRIB4SVPROC glVertexAttrib4sv;
-    extern PFNGLVERTEXATTRIB4SVARBPROC glVertexAttrib4svARB;
-    extern PFNGLVERTEXATTRIB4SVNVPROC glVertexAttrib4svNV;
-    extern PFNGLVERTEXATTRIB4UBNVPROC glVertexAttrib4ubNV;
-    extern PFNGLVERTEXATTRIB4UBVPROC glVertexAttrib4ubv;
-    extern PFNGLVERTEXATTRIB4UBVARBPROC glVertexAttrib4ubvARB;
-    extern PFNGLVERTEXATTRIB4UBVNVPROC glVertexAttrib4ubvNV;
-    extern PFNGLVERTEXATTRIB4UIVPROC glVertexAttrib4uiv;
-    extern PFNGLVERTEXATTRIB4UIVARBPROC glVertexAttrib4uivARB;
-    extern PFNGLVERTEXATTRIB4USVPROC glVertexAttrib4usv;
-    extern PFNGLVERTEXATTRIB4USVARBPROC glVertexAttrib4usvARB;
-    extern PFNGLVERTEXATTRIBARRAYOBJECTATIPROC glVertexAttribArrayObjectATI;
-    extern PFNGLVERTEXATTRIBDIVISORARBPROC glVertexAttribDivisorARB;
-    extern PFNGLVERTEXATTRIBFORMATNVPROC glVertexAttribFormatNV;
-    extern PFNGLVERTEXATTRIBI1IPROC glVertexAttribI1i;
-    extern PFNGLVERTEXATTRIBI1IEXTPROC glVertexAttribI1iEXT;
-    extern PFNGLVERTEXATTRIBI1IVPROC glVertexAttribI1iv;
-    extern PFNGLVERTEXATTRIBI1IVEXTPROC glVertexAttribI1ivEXT;
-    extern PFNGLVERTEXATTRIBI1UIPROC glVertexAttribI1ui;
-    extern PFNGLVERTEXATTRIBI1UIEXTPROC glVertexAttribI1uiEXT;
-    extern PFNGLVERTEXATTRIBI1UIVPROC glVertexAttribI1uiv;
-    extern PFNGLVERTEXATTRIBI1UIVEXTPROC glVertexAttribI1uivEXT;
-    extern PFNGLVERTEXATTRIBI2IPROC glVertexAttribI2i;
-    extern PFNGLVERTEXATTRIBI2IEXTPROC glVertexAttribI2iEXT;
-    extern PFNGLVERTEXATTRIBI2IVPROC glVertexAttribI2iv;
-    extern PFNGLVERTEXATTRIBI2IVEXTPROC glVertexAttribI2ivEXT;
-    extern PFNGLVERTEXATTRIBI2UIPROC glVertexAttribI2ui;
-    extern PFNGLVERTEXATTRIBI2UIEXTPROC glVertexAttribI2uiEXT;
-    extern PFNGLVERTEXATTRIBI2UIVPROC glVertexAttribI2uiv;
-    extern PFNGLVERTEXATTRIBI2UIVEXTPROC glVertexAttribI2uivEXT;
-    extern PFNGLVERTEXATTRIBI3IPROC glVertexAttribI3i;
-    extern PFNGLVERTEXATTRIBI3IEXTPROC glVertexAttribI3iEXT;
-    extern PFNGLVERTEXATTRIBI3IVPROC glVertexAttribI3iv;
-    extern PFNGLVERTEXATTRIBI3IVEXTPROC glVertexAttribI3ivEXT;
-    extern PFNGLVERTEXATTRIBI3UIPROC glVertexAttribI3ui;
-    extern PFNGLVERTEXATTRIBI3UIEXTPROC glVertexAttribI3uiEXT;
-    extern PFNGLVERTEXATTRIBI3UIVPROC glVertexAttribI3uiv;
-    extern PFNGLVERTEXATTRIBI3UIVEXTPROC glVertexAttribI3uivEXT;
-    extern PFNGLVERTEXATTRIBI4BVPROC glVertexAttribI4bv;
-    extern PFNGLVERTEXATTRIBI4BVEXTPROC glVertexAttribI4bvEXT;
-    extern PFNGLVERTEXATTRIBI4IPROC glVertexAttribI4i;
-    extern PFNGLVERTEXATTRIBI4IEXTPROC glVertexAttribI4iEXT;
-    extern PFNGLVERTEXATTRIBI4IVPROC glVertexAttribI4iv;
-    extern PFNGLVERTEXATTRIBI4IVEXTPROC glVertexAttribI4ivEXT;
-    extern PFNGLVERTEXATTRIBI4SVPROC glVertexAttribI4sv;
-    extern PFNGLVERTEXATTRIBI4SVEXTPROC glVertexAttribI4svEXT;
-    extern PFNGLVERTEXATTRIBI4UBVPROC glVertexAttribI4ubv;
-    extern PFNGLVERTEXATTRIBI4UBVEXTPROC glVertexAttribI4ubvEXT;
-    extern PFNGLVERTEXATTRIBI4UIPROC glVertexAttribI4ui;
-    extern PFNGLVERTEXATTRIBI4UIEXTPROC glVertexAttribI4uiEXT;
-    extern PFNGLVERTEXATTRIBI4UIVPROC glVertexAttribI4uiv;
-    extern PFNGLVERTEXATTRIBI4UIVEXTPROC glVertexAttribI4uivEXT;
-    extern PFNGLVERTEXATTRIBI4USVPROC glVertexAttribI4usv;
-    extern PFNGLVERTEXATTRIBI4USVEXTPROC glVertexAttribI4usvEXT;
-    extern PFNGLVERTEXATTRIBIFORMATNVPROC glVertexAttribIFormatNV;
-    extern PFNGLVERTEXATTRIBIPOINTERPROC glVertexAttribIPointer;
-    extern PFNGLVERTEXATTRIBIPOINTEREXTPROC glVertexAttribIPointerEXT;
-    extern PFNGLVERTEXATTRIBP1UIPROC glVertexAttribP1ui;
-    extern PFNGLVERTEXATTRIBP1UIVPROC glVertexAttribP1uiv;
-    extern PFNGLVERTEXATTRIBP2UIPROC glVertexAttribP2ui;
-    extern PFNGLVERTEXATTRIBP2UIVPROC glVertexAttribP2uiv;
-    extern PFNGLVERTEXATTRIBP3UIPROC glVertexAttribP3ui;
-    extern PFNGLVERTEXATTRIBP3UIVPROC glVertexAttribP3uiv;
-    extern PFNGLVERTEXATTRIBP4UIPROC glVertexAttribP4ui;
-    extern PFNGLVERTEXATTRIBP4UIVPROC glVertexAttribP4uiv;
     extern PFNGLVERTEXATTRIBPOINTERPROC glVertexAttribPointer;
-    extern PFNGLVERTEXATTRIBPOINTERARBPROC glVertexAttribPointerARB;
-    extern PFNGLVERTEXATTRIBPOINTERNVPROC glVertexAttribPointerNV;
-    extern PFNGLVERTEXATTRIBS1DVNVPROC glVertexAttribs1dvNV;
-    extern PFNGLVERTEXATTRIBS1FVNVPROC glVertexAttribs1fvNV;
-    extern PFNGLVERTEXATTRIBS1HVNVPROC glVertexAttribs1hvNV;
-    extern PFNGLVERTEXATTRIBS1SVNVPROC glVertexAttribs1svNV;
-    extern PFNGLVERTEXATTRIBS2DVNVPROC glVertexAttribs2dvNV;
-    extern PFNGLVERTEXATTRIBS2FVNVPROC glVertexAttribs2fvNV;
-    extern PFNGLVERTEXATTRIBS2HVNVPROC glVertexAttribs2hvNV;
-    extern PFNGLVERTEXATTRIBS2SVNVPROC glVertexAttribs2svNV;
-    extern PFNGLVERTEXATTRIBS3DVNVPROC glVertexAttribs3dvNV;
-    extern PFNGLVERTEXATTRIBS3FVNVPROC glVertexAttribs3fvNV;
-    extern PFNGLVERTEXATTRIBS3HVNVPROC glVertexAttribs3hvNV;
-    extern PFNGLVERTEXATTRIBS3SVNVPROC glVertexAttribs3svNV;
-    extern PFNGLVERTEXATTRIBS4DVNVPROC glVertexAttribs4dvNV;
-    extern PFNGLVERTEXATTRIBS4FVNVPROC glVertexAttribs4fvNV;
-    extern PFNGLVERTEXATTRIBS4HVNVPROC glVertexAttribs4hvNV;
-    extern PFNGLVERTEXATTRIBS4SVNVPROC glVertexAttribs4svNV;
-    extern PFNGLVERTEXATTRIBS4UBVNVPROC glVertexAttribs4ubvNV;
-    extern PFNGLVERTEXBLENDARBPROC glVertexBlendARB;
-    extern PFNGLVERTEXBLENDENVFATIPROC glVertexBlendEnvfATI;
-    extern PFNGLVERTEXBLENDENVIATIPROC glVertexBlendEnviATI;
-    extern PFNGLVERTEXFORMATNVPROC glVertexFormatNV;
-    extern PFNGLVERTEXP2UIPROC glVertexP2ui;
-    extern PFNGLVERTEXP2UIVPROC glVertexP2uiv;
-    extern PFNGLVERTEXP3UIPROC glVertexP3ui;
-    extern PFNGLVERTEXP3UIVPROC glVertexP3uiv;
-    extern PFNGLVERTEXP4UIPROC glVertexP4ui;
-    extern PFNGLVERTEXP4UIVPROC glVertexP4uiv;
-    extern PFNGLVERTEXPOINTEREXTPROC glVertexPointerEXT;
-    extern PFNGLVERTEXPOINTERLISTIBMPROC glVertexPointerListIBM;
-    extern PFNGLVERTEXPOINTERVINTELPROC glVertexPointervINTEL;
-    extern PFNGLVERTEXSTREAM1DATIPROC glVertexStream1dATI;
-    extern PFNGLVERTEXSTREAM1DVATIPROC glVertexStream1dvATI;
-    extern PFNGLVERTEXSTREAM1FATIPROC glVertexStream1fATI;
-    extern PFNGLVERTEXSTREAM1FVATIPROC glVertexStream1fvATI;
-    extern PFNGLVERTEXSTREAM1IATIPROC glVertexStream1iATI;
-    extern PFNGLVERTEXSTREAM1IVATIPROC glVertexStream1ivATI;
-    extern PFNGLVERTEXSTREAM1SATIPROC glVertexStream1sATI;
-    extern PFNGLVERTEXSTREAM1SVATIPROC glVertexStream1svATI;
-    extern PFNGLVERTEXSTREAM2DATIPROC glVertexStream2dATI;
-    extern PFNGLVERTEXSTREAM2DVATIPROC glVertexStream2dvATI;
-    extern PFNGLVERTEXSTREAM2FATIPROC glVertexStream2fATI;
-    extern PFNGLVERTEXSTREAM2FVATIPROC glVertexStream2fvATI;
-    extern PFNGLVERTEXSTREAM2IATIPROC glVertexStream2iATI;
-    extern PFNGLVERTEXSTREAM2IVATIPROC glVertexStream2ivATI;
-    extern PFNGLVERTEXSTREAM2SATIPROC glVertexStream2sATI;
-    extern PFNGLVERTEXSTREAM2SVATIPROC glVertexStream2svATI;
-    extern PFNGLVERTEXSTREAM3DATIPROC glVertexStream3dATI;
-    extern PFNGLVERTEXSTREAM3DVATIPROC glVertexStream3dvATI;
-    extern PFNGLVERTEXSTREAM3FATIPROC glVertexStream3fATI;
-    extern PFNGLVERTEXSTREAM3FVATIPROC glVertexStream3fvATI;
-    extern PFNGLVERTEXSTREAM3IATIPROC glVertexStream3iATI;
-    extern PFNGLVERTEXSTREAM3IVATIPROC glVertexStream3ivATI;
-    extern PFNGLVERTEXSTREAM3SATIPROC glVertexStream3sATI;
-    extern PFNGLVERTEXSTREAM3SVATIPROC glVertexStream3svATI;
-    extern PFNGLVERTEXSTREAM4DATIPROC glVertexStream4dATI;
-    extern PFNGLVERTEXSTREAM4DVATIPROC glVertexStream4dvATI;
-    extern PFNGLVERTEXSTREAM4FATIPROC glVertexStream4fATI;
-    extern PFNGLVERTEXSTREAM4FVATIPROC glVertexStream4fvATI;
-    extern PFNGLVERTEXSTREAM4IATIPROC glVertexStream4iATI;
-    extern PFNGLVERTEXSTREAM4IVATIPROC glVertexStream4ivATI;
-    extern PFNGLVERTEXSTREAM4SATIPROC glVertexStream4sATI;
-    extern PFNGLVERTEXSTREAM4SVATIPROC glVertexStream4svATI;
-    extern PFNGLVERTEXWEIGHTPOINTEREXTPROC glVertexWeightPointerEXT;
-    extern PFNGLVERTEXWEIGHTFEXTPROC glVertexWeightfEXT;
-    extern PFNGLVERTEXWEIGHTFVEXTPROC glVertexWeightfvEXT;
-    extern PFNGLVERTEXWEIGHTHNVPROC glVertexWeighthNV;
-    extern PFNGLVERTEXWEIGHTHVNVPROC glVertexWeighthvNV;
-    extern PFNGLVIDEOCAPTURENVPROC glVideoCaptureNV;
-    extern PFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC glVideoCaptureStreamParameterdvNV;
-    extern PFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC glVideoCaptureStreamParameterfvNV;
-    extern PFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC glVideoCaptureStreamParameterivNV;
-    extern PFNGLWAITSYNCPROC glWaitSync;
-    extern PFNGLWEIGHTPOINTERARBPROC glWeightPointerARB;
-    extern PFNGLWEIGHTBVARBPROC glWeightbvARB;
-    extern PFNGLWEIGHTDVARBPROC glWeightdvARB;
-    extern PFNGLWEIGHTFVARBPROC glWeightfvARB;
-    extern PFNGLWEIGHTIVARBPROC glWeightivARB;
-    extern PFNGLWEIGHTSVARBPROC glWeightsvARB;
-    extern PFNGLWEIGHTUBVARBPROC glWeightubvARB;
-    extern PFNGLWEIGHTUIVARBPROC glWeightuivARB;
-    extern PFNGLWEIGHTUSVARBPROC glWeightusvARB;
-    extern PFNGLWINDOWPOS2DPROC glWindowPos2d;
-    extern PFNGLWINDOWPOS2DARBPROC glWindowPos2dARB;
-    extern PFNGLWINDOWPOS2DMESAPROC glWindowPos2dMESA;
-    extern PFNGLWINDOWPOS2DVPROC glWindowPos2dv;
-    extern PFNGLWINDOWPOS2DVARBPROC glWindowPos2dvARB;
-    extern PFNGLWINDOWPOS2DVMESAPROC glWindowPos2dvMESA;
-    extern PFNGLWINDOWPOS2FPROC glWindowPos2f;
-    extern PFNGLWINDOWPOS2FARBPROC glWindowPos2fARB;
-    extern PFNGLWINDOWPOS2FMESAPROC glWindowPos2fMESA;
-    extern PFNGLWINDOWPOS2FVPROC glWindowPos2fv;
-    extern PFNGLWINDOWPOS2FVARBPROC glWindowPos2fvARB;
-    extern PFNGLWINDOWPOS2FVMESAPROC glWindowPos2fvMESA;
-    extern PFNGLWINDOWPOS2IPROC glWindowPos2i;
-    extern PFNGLWINDOWPOS2IARBPROC glWindowPos2iARB;
-    extern PFNGLWINDOWPOS2IMESAPROC glWindowPos2iMESA;
-    extern PFNGLWINDOWPOS2IVPROC glWindowPos2iv;
-    extern PFNGLWINDOWPOS2IVARBPROC glWindowPos2ivARB;
-    extern PFNGLWINDOWPOS2IVMESAPROC glWindowPos2ivMESA;
-    extern PFNGLWINDOWPOS2SPROC glWindowPos2s;
-    extern PFNGLWINDOWPOS2SARBPROC glWindowPos2sARB;
-    extern PFNGLWINDOWPOS2SMESAPROC glWindowPos2sMESA;
-    extern PFNGLWINDOWPOS2SVPROC glWindowPos2sv;
-    extern PFNGLWINDOWPOS2SVARBPROC glWindowPos2svARB;
-    extern PFNGLWINDOWPOS2SVMESAPROC glWindowPos2svMESA;
-    extern PFNGLWINDOWPOS3DPROC glWindowPos3d;
-    extern PFNGLWINDOWPOS3DARBPROC glWindowPos3dARB;
-    extern PFNGLWINDOWPOS3DMESAPROC glWindowPos3dMESA;
-    extern PFNGLWINDOWPOS3DVPROC glWindowPos3dv;
-    extern PFNGLWINDOWPOS3DVARBPROC glWindowPos3dvARB;
-    extern PFNGLWINDOWPOS3DVMESAPROC glWindowPos3dvMESA;
-    extern PFNGLWINDOWPOS3FPROC glWindowPos3f;
-    extern PFNGLWINDOWPOS3FARBPROC glWindowPos3fARB;
-    extern PFNGLWINDOWPOS3FMESAPROC glWindowPos3fMESA;
-    extern PFNGLWINDOWPOS3FVPROC glWindowPos3fv;
-    extern PFNGLWINDOWPOS3FVARBPROC glWindowPos3fvARB;
-    extern PFNGLWINDOWPOS3FVMESAPROC glWindowPos3fvMESA;
-    extern PFNGLWINDOWPOS3IPROC glWindowPos3i;
-    extern PFNGLWINDOWPOS3IARBPROC glWindowPos3iARB;
-    extern PFNGLWINDOWPOS3IMESAPROC glWindowPos3iMESA;
-    extern PFNGLWINDOWPOS3IVPROC glWindowPos3iv;
-    extern PFNGLWINDOWPOS3IVARBPROC glWindowPos3ivARB;
-    extern PFNGLWINDOWPOS3IVMESAPROC glWindowPos3ivMESA;
-    extern PFNGLWINDOWPOS3SPROC glWindowPos3s;
-    extern PFNGLWINDOWPOS3SARBPROC glWindowPos3sARB;
-    extern PFNGLWINDOWPOS3SMESAPROC glWindowPos3sMESA;
-    extern PFNGLWINDOWPOS3SVPROC glWindowPos3sv;
-    extern PFNGLWINDOWPOS3SVARBPROC glWindowPos3svARB;
-    extern PFNGLWINDOWPOS3SVMESAPROC glWindowPos3svMESA;
-    extern PFNGLWINDOWPOS4DMESAPROC glWindowPos4dMESA;
-    extern PFNGLWINDOWPOS4DVMESAPROC glWindowPos4dvMESA;
-    extern PFNGLWINDOWPOS4FMESAPROC glWindowPos4fMESA;
-    extern PFNGLWINDOWPOS4FVMESAPROC glWindowPos4fvMESA;
-    extern PFNGLWINDOWPOS4IMESAPROC glWindowPos4iMESA;
-    extern PFNGLWINDOWPOS4IVMESAPROC glWindowPos4ivMESA;
-    extern PFNGLWINDOWPOS4SMESAPROC glWindowPos4sMESA;
-    extern PFNGLWINDOWPOS4SVMESAPROC glWindowPos4svMESA;
-    extern PFNGLWRITEMASKEXTPROC glWriteMaskEXT;
 
 
+    // Entry points resolve on their first call and are never NULL, so use
+    // the extension string to check for support.  Both of these put every
+    // entry point back to unresolved, as a new context needs.
     void InitGLEntry();
 
     void ShutdownGLEntry();
@@ -5,6 +5,12 @@
 # I apologize to all those who are offended by the quality of this code.
 # Cass Everitt
 #
+# Each entry point starts out pointing at a trampoline that resolves it on
+# first call and patches the pointer, so startup does not pay for the
+# thousands of entry points r3 never calls.  With an allowlist (one entry
+# point per line, # comments) only those entry points are emitted.
+#
+#   glext_entry.pl glext.h [entry_allowlist.txt]
 #
 
 use FileHandle;
@@ -15,7 +21,10 @@ my $srcheader = <<END;
 #include "r3/gl.h"
 #include "r3/GL/entry.h"
 
-#if _WIN32
+#if R3_NULL_GL
+# include "r3/nullgl.h"
+# define r3GetProcAddress( proc ) NullGLGetProcAddress( proc )
+#elif _WIN32
 # define r3GetProcAddress wglGetProcAddress
 #elif __linux__
 # include <GL/glx.h>
@@ -25,8 +34,8 @@ my $srcheader = <<END;
 namespace r3 {
 END
 
-if ( scalar( @ARGV ) != 1 ) {
-   print "\nusage: glext_entry.pl <glext.h_file>\n";
+if ( scalar( @ARGV ) < 1 || scalar( @ARGV ) > 2 ) {
+   print "\nusage: glext_entry.pl <glext.h_file> [<allowlist_file>]\n";
    print join " ", @ARGV;
    print "\n";
 }
@@ -57,6 +66,23 @@ while( $line = <GLEXT> ) {
 
 $glext->close();
 
+if ( scalar( @ARGV ) == 2 ) {
+  my %allowed;
+  open( ALLOW, "<$ARGV[1]" ) or die "unable to open $ARGV[1]";
+  while( $line = <ALLOW> ) {
+    $line =~ s/#.*//;
+    $line =~ s/\s+//g;
+    next if $line eq "";
+    if ( ! exists $entries{ $line } ) {
+      print STDERR "warning: $line is not in $ARGV[0]\n";
+      next;
+    }
+    $allowed{ $line } = $entries{ $line };
+  }
+  close( ALLOW );
+  %entries = %allowed;
+}
+
 write_header();
 write_source();
 
@@ -90,6 +116,9 @@ sub write_header {
 		print $fp "    extern PFN" . $ue . "PROC $e;\n";
 	}
 	print $fp "\n\n";
+	print $fp "    // Entry points resolve on their first call and are never NULL, so use\n";
+	print $fp "    // the extension string to check for support.  Both of these put every\n";
+	print $fp "    // entry point back to unresolved, as a new context needs.\n";
 	print $fp "    void InitGLEntry();\n\n";
 	print $fp "    void ShutdownGLEntry();\n\n";
 	print $fp "\n}\n\n";
@@ -102,6 +131,20 @@ sub write_header {
 
 }
 
+# names of the parameters in a "(GLenum target, const GLvoid *data)" list
+sub arg_names($) {
+	my $args = shift;
+	$args =~ s/^\s*\(//;
+	$args =~ s/\)\s*$//;
+	my @names;
+	return "" if $args =~ /^\s*(void)?\s*$/;
+	foreach my $a ( split( /,/, $args ) ) {
+		$a =~ /([A-Za-z0-9_]+)\s*$/;
+		push( @names, $1 );
+	}
+	return join( ", ", @names );
+}
+
 sub write_source {
 	my $fp  = new FileHandle;
 	$fp->open( ">_entry.cpp" );
@@ -110,24 +153,41 @@ sub write_source {
 
         print $fp $srcheader;
 
+        print $fp "\n    namespace {\n\n";
+        print $fp "        // Resolve on first call, then patch the pointer so later calls go\n";
+        print $fp "        // straight to GL.  Racing first calls resolve to the same address.\n\n";
         foreach my $e ( sort keys %entries ) {
           my $ue = uc( $e );
-          print $fp "    PFN" . $ue . "PROC $e;\n";
+          my $ret = $entries{ $e }{ "return" };
+          my $args = $entries{ $e }{ "args" };
+          my $names = arg_names( $args );
+          print $fp "        $ret APIENTRY Lazy_$e $args {\n";
+          print $fp "            $e = (PFN" . $ue . "PROC) r3GetProcAddress( \"$e\" );\n";
+          if ( $ret eq "void" ) {
+            print $fp "            $e( $names );\n";
+          } else {
+            print $fp "            return $e( $names );\n";
+          }
+          print $fp "        }\n\n";
+        }
+        print $fp "    }\n\n";
+
+        foreach my $e ( sort keys %entries ) {
+          my $ue = uc( $e );
+          print $fp "    PFN" . $ue . "PROC $e = Lazy_$e;\n";
         }
 
         print $fp "\n\n";
 	print $fp "    void InitGLEntry() {\n\n";
 	foreach my $e ( sort keys %entries ) {
-		my $ue = uc( $e );
-		print $fp "        $e = (PFN" . $ue . "PROC) r3GetProcAddress( \"$e\" );\n";
+		print $fp "        $e = Lazy_$e;\n";
 	}
 	print $fp "\n    }\n\n";
 
         print $fp "\n\n";
 	print $fp "    void ShutdownGLEntry() {\n\n";
 	foreach my $e ( sort keys %entries ) {
-		my $ue = uc( $e );
-		print $fp "        $e = NULL;\n";
+		print $fp "        $e = Lazy_$e;\n";
 	}
 	print $fp "\n    }\n\n";
 
@@ -139,7 +199,3 @@ sub write_source {
 	close ( $fp );
 
 }
-
-
-
-
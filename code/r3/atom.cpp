@@ -45,6 +45,7 @@
 #include "r3/atom.h"
 
 #include "r3/common.h"
+#include "r3/metrics.h"
 
 #include <vector>
 #include <map>
@@ -54,6 +55,8 @@
 
 using namespace std;
 
+r3::MetricCounter atom_created( "atom_created", "Number of distinct atoms created." );
+
 namespace {
 	
 	// We have to do this to have static initialization of atoms works.
@@ -79,6 +82,7 @@ namespace {
 		}
 		int v = (int)atoms->table.size();
 		atoms->table.push_back( strdup( str ) );
+		atom_created.Incr();
 		//Output( "Atom: adding %d %s\n", v, str );
 		atoms->lookup[ s ] = v;
 		return v;
@@ -0,0 +1,348 @@
+/*
+ *  batch
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#include "r3/batch.h"
+
+#include "r3/simd.h"
+#include "r3/thread.h"
+
+#include <algorithm>
+
+using namespace std;
+using namespace r3;
+
+namespace {
+	
+	// too few points and waking threads costs more than it saves
+	const int MinBatchPerThread = 16384;
+	
+	struct BatchArgs {
+		BatchArgs( const Matrix4f & mat ) : m( mat ), outcodes( NULL ) {}
+		const Matrix4f & m;
+		Vec3Array src;
+		Vec3Array dst;
+		Vec4Array clip;
+		uchar * outcodes;
+		Bounds3Array bsrc;
+		Bounds3Array bdst;
+	};
+	
+	// Each does points begin to end, and returns a count where there is one.
+	typedef int (*BatchKernel)( const BatchArgs & a, int begin, int end );
+	
+#if R3_SIMD
+	// The matrix elements, splatted.
+	struct Matrix4x4 {
+		Matrix4x4( const Matrix4f & m ) {
+			for( int i = 0; i < 4; i++ ) {
+				for( int j = 0; j < 4; j++ ) {
+					e[ i ][ j ] = Splat4( m( i, j ) );
+				}
+			}
+		}
+		Float4 e[4][4];
+	};
+	
+	// row i of m times ( x, y, z, 1 ), summed like the Matrix4f code
+	inline Float4 Row4( const Matrix4x4 & m, int i, Float4 x, Float4 y, Float4 z ) {
+		Float4 r = Mul4( x, m.e[ i ][0] );
+		r = Add4( r, Mul4( y, m.e[ i ][1] ) );
+		r = Add4( r, Mul4( z, m.e[ i ][2] ) );
+		return Add4( r, m.e[ i ][3] );
+	}
+	
+	inline Float4 DirRow4( const Matrix4x4 & m, int i, Float4 x, Float4 y, Float4 z ) {
+		Float4 r = Mul4( x, m.e[ i ][0] );
+		r = Add4( r, Mul4( y, m.e[ i ][1] ) );
+		return Add4( r, Mul4( z, m.e[ i ][2] ) );
+	}
+#endif
+	
+	int PointsRange( const BatchArgs & a, int begin, int end ) {
+		const Vec3Array & s = a.src;
+		const Vec3Array & d = a.dst;
+		int i = begin;
+#if R3_SIMD
+		Matrix4x4 m( a.m );
+		for( ; i + 4 <= end; i += 4 ) {
+			Float4 x = Load4( s.x + i ), y = Load4( s.y + i ), z = Load4( s.z + i );
+			Float4 w = Row4( m, 3, x, y, z );
+			Float4 ox = Div4( Row4( m, 0, x, y, z ), w );
+			Float4 oy = Div4( Row4( m, 1, x, y, z ), w );
+			Float4 oz = Div4( Row4( m, 2, x, y, z ), w );
+			Store4( d.x + i, ox );
+			Store4( d.y + i, oy );
+			Store4( d.z + i, oz );
+		}
+#endif
+		for( ; i < end; i++ ) {
+			Vec3f p( s.x[ i ], s.y[ i ], s.z[ i ] );
+			a.m.MultMatrixVec( p );
+			d.x[ i ] = p.x;
+			d.y[ i ] = p.y;
+			d.z[ i ] = p.z;
+		}
+		return 0;
+	}
+	
+	int DirectionsRange( const BatchArgs & a, int begin, int end ) {
+		const Vec3Array & s = a.src;
+		const Vec3Array & d = a.dst;
+		int i = begin;
+#if R3_SIMD
+		Matrix4x4 m( a.m );
+		for( ; i + 4 <= end; i += 4 ) {
+			Float4 x = Load4( s.x + i ), y = Load4( s.y + i ), z = Load4( s.z + i );
+			Float4 ox = DirRow4( m, 0, x, y, z );
+			Float4 oy = DirRow4( m, 1, x, y, z );
+			Float4 oz = DirRow4( m, 2, x, y, z );
+			Store4( d.x + i, ox );
+			Store4( d.y + i, oy );
+			Store4( d.z + i, oz );
+		}
+#endif
+		for( ; i < end; i++ ) {
+			Vec3f v( s.x[ i ], s.y[ i ], s.z[ i ] );
+			a.m.MultMatrixDir( v );
+			d.x[ i ] = v.x;
+			d.y[ i ] = v.y;
+			d.z[ i ] = v.z;
+		}
+		return 0;
+	}
+	
+	int ProjectRange( const BatchArgs & a, int begin, int end ) {
+		const Vec3Array & s = a.src;
+		const Vec4Array & c = a.clip;
+		int i = begin;
+#if R3_SIMD
+		Matrix4x4 m( a.m );
+		for( ; i + 4 <= end; i += 4 ) {
+			Float4 x = Load4( s.x + i ), y = Load4( s.y + i ), z = Load4( s.z + i );
+			Store4( c.x + i, Row4( m, 0, x, y, z ) );
+			Store4( c.y + i, Row4( m, 1, x, y, z ) );
+			Store4( c.z + i, Row4( m, 2, x, y, z ) );
+			Store4( c.w + i, Row4( m, 3, x, y, z ) );
+		}
+#endif
+		for( ; i < end; i++ ) {
+			Vec4f v( s.x[ i ], s.y[ i ], s.z[ i ], 1.0f );
+			a.m.MultMatrixVec( v );
+			c.x[ i ] = v.x;
+			c.y[ i ] = v.y;
+			c.z[ i ] = v.z;
+			c.w[ i ] = v.w;
+		}
+		return 0;
+	}
+	
+	int OutcodesRange( const BatchArgs & a, int begin, int end ) {
+		const Vec3Array & s = a.src;
+		uchar * codes = a.outcodes;
+		int inside = 0;
+		int i = begin;
+#if R3_SIMD
+		Matrix4x4 m( a.m );
+		Float4 left = Bits4( Outcode_Left ), right = Bits4( Outcode_Right );
+		Float4 bottom = Bits4( Outcode_Bottom ), top = Bits4( Outcode_Top );
+		Float4 nearBit = Bits4( Outcode_Near ), farBit = Bits4( Outcode_Far );
+		Float4 zero = Splat4( 0.0f );
+		for( ; i + 4 <= end; i += 4 ) {
+			Float4 x = Load4( s.x + i ), y = Load4( s.y + i ), z = Load4( s.z + i );
+			Float4 cx = Row4( m, 0, x, y, z );
+			Float4 cy = Row4( m, 1, x, y, z );
+			Float4 cz = Row4( m, 2, x, y, z );
+			Float4 w = Row4( m, 3, x, y, z );
+			Float4 nw = Sub4( zero, w );
+			Float4 c = Or4( And4( Less4( cx, nw ), left ), And4( Greater4( cx, w ), right ) );
+			c = Or4( c, Or4( And4( Less4( cy, nw ), bottom ), And4( Greater4( cy, w ), top ) ) );
+			c = Or4( c, Or4( And4( Less4( cz, nw ), nearBit ), And4( Greater4( cz, w ), farBit ) ) );
+			StoreBytes4( codes + i, c );
+			inside += ( codes[ i ] == 0 ) + ( codes[ i + 1 ] == 0 ) + ( codes[ i + 2 ] == 0 ) + ( codes[ i + 3 ] == 0 );
+		}
+#endif
+		for( ; i < end; i++ ) {
+			Vec4f v( s.x[ i ], s.y[ i ], s.z[ i ], 1.0f );
+			a.m.MultMatrixVec( v );
+			float nw = -v.w;
+			int c = 0;
+			c |= v.x < nw ? Outcode_Left : 0;
+			c |= v.x > v.w ? Outcode_Right : 0;
+			c |= v.y < nw ? Outcode_Bottom : 0;
+			c |= v.y > v.w ? Outcode_Top : 0;
+			c |= v.z < nw ? Outcode_Near : 0;
+			c |= v.z > v.w ? Outcode_Far : 0;
+			codes[ i ] = uchar( c );
+			inside += c == 0;
+		}
+		return inside;
+	}
+	
+	int BoundsRange( const BatchArgs & a, int begin, int end ) {
+		const Bounds3Array & s = a.bsrc;
+		const Bounds3Array & d = a.bdst;
+		const float * smin[3] = { s.bmin.x, s.bmin.y, s.bmin.z };
+		const float * smax[3] = { s.bmax.x, s.bmax.y, s.bmax.z };
+		float * dmin[3] = { d.bmin.x, d.bmin.y, d.bmin.z };
+		float * dmax[3] = { d.bmax.x, d.bmax.y, d.bmax.z };
+		int i = begin;
+#if R3_SIMD
+		Matrix4x4 m( a.m );
+		for( ; i + 4 <= end; i += 4 ) {
+			Float4 lo[3], hi[3];
+			for( int j = 0; j < 3; j++ ) {
+				lo[ j ] = Load4( smin[ j ] + i );
+				hi[ j ] = Load4( smax[ j ] + i );
+			}
+			for( int r = 0; r < 3; r++ ) {
+				Float4 rlo = m.e[ r ][3], rhi = m.e[ r ][3];
+				for( int j = 0; j < 3; j++ ) {
+					Float4 p = Mul4( m.e[ r ][ j ], lo[ j ] );
+					Float4 q = Mul4( m.e[ r ][ j ], hi[ j ] );
+					rlo = Add4( rlo, Min4( p, q ) );
+					rhi = Add4( rhi, Max4( p, q ) );
+				}
+				Store4( dmin[ r ] + i, rlo );
+				Store4( dmax[ r ] + i, rhi );
+			}
+		}
+#endif
+		for( ; i < end; i++ ) {
+			float lo[3], hi[3];
+			for( int j = 0; j < 3; j++ ) {
+				lo[ j ] = smin[ j ][ i ];
+				hi[ j ] = smax[ j ][ i ];
+			}
+			for( int r = 0; r < 3; r++ ) {
+				float rlo = a.m( r, 3 ), rhi = a.m( r, 3 );
+				for( int j = 0; j < 3; j++ ) {
+					float p = a.m( r, j ) * lo[ j ];
+					float q = a.m( r, j ) * hi[ j ];
+					rlo += min( p, q );
+					rhi += max( p, q );
+				}
+				dmin[ r ][ i ] = rlo;
+				dmax[ r ][ i ] = rhi;
+			}
+		}
+		return 0;
+	}
+	
+	struct BatchJob {
+		BatchKernel kernel;
+		const BatchArgs * args;
+		int begin;
+		int end;
+		int result;
+	};
+	
+	void RunJob( void * arg ) {
+		BatchJob & job = *static_cast< BatchJob * >( arg );
+		job.result = job.kernel( *job.args, job.begin, job.end );
+	}
+	
+	// Runs kernel over all n points, split into ranges on multiples of 4
+	// for up to threads threads, and returns the sum of the results.
+	int RunBatch( BatchKernel kernel, const BatchArgs & args, int n, int threads ) {
+		threads = max( 1, min( min( threads, MaxBatchThreads ), n / MinBatchPerThread ) );
+		if( threads == 1 ) {
+			return n > 0 ? kernel( args, 0, n ) : 0;
+		}
+		BatchJob jobs[ MaxBatchThreads ];
+		int per = ( ( n + threads - 1 ) / threads + 3 ) & ~3;
+		for( int i = 0; i < threads; i++ ) {
+			BatchJob & j = jobs[ i ];
+			j.kernel = kernel;
+			j.args = &args;
+			j.begin = min( n, i * per );
+			j.end = min( n, j.begin + per );
+			j.result = 0;
+		}
+		RunJobs( jobs, threads, RunJob );
+		int result = 0;
+		for( int i = 0; i < threads; i++ ) {
+			result += jobs[ i ].result;
+		}
+		return result;
+	}
+	
+}
+
+namespace r3 {
+	
+	void TransformPoints( const Matrix4f & m, const Vec3Array & src, const Vec3Array & dst, int n, int threads ) {
+		BatchArgs a( m );
+		a.src = src;
+		a.dst = dst;
+		RunBatch( PointsRange, a, n, threads );
+	}
+	
+	void TransformDirections( const Matrix4f & m, const Vec3Array & src, const Vec3Array & dst, int n, int threads ) {
+		BatchArgs a( m );
+		a.src = src;
+		a.dst = dst;
+		RunBatch( DirectionsRange, a, n, threads );
+	}
+	
+	void ProjectPoints( const Matrix4f & m, const Vec3Array & src, const Vec4Array & clip, int n, int threads ) {
+		BatchArgs a( m );
+		a.src = src;
+		a.clip = clip;
+		RunBatch( ProjectRange, a, n, threads );
+	}
+	
+	int FrustumOutcodes( const Matrix4f & m, const Vec3Array & src, uchar * outcodes, int n, int threads ) {
+		BatchArgs a( m );
+		a.src = src;
+		a.outcodes = outcodes;
+		return RunBatch( OutcodesRange, a, n, threads );
+	}
+	
+	void TransformBounds( const Matrix4f & m, const Bounds3Array & src, const Bounds3Array & dst, int n, int threads ) {
+		BatchArgs a( m );
+		a.bsrc = src;
+		a.bdst = dst;
+		RunBatch( BoundsRange, a, n, threads );
+	}
+	
+}
@@ -46,8 +46,11 @@
 #include "r3/common.h"
 #include "r3/command.h"
 #include "r3/draw.h"
+#include "r3/filesystem.h"
+#include "r3/glstate.h"
 #include "r3/output.h"
 
+#include <algorithm>
 #include <assert.h>
 #include <string.h>
 #include <map>
@@ -82,6 +85,23 @@ namespace {
     }		
   };
   BufferDatabase * bufferDatabase;
+  
+  vector< StreamBuffer * > streamBuffers;
+  BufferArena * vertexArena;
+  BufferArena * indexArena;
+  
+  // arena blocks are this big unless one allocation needs more
+  const int ArenaBlockSize = 1 << 20;
+  
+  // dirty ranges closer than this are uploaded as one, the extra bytes
+  // cost less than another call
+  const int DirtyMergeGap = 256;
+  
+  VarBool r_bufferDeferUploads( "r_bufferDeferUploads", "Merge buffer updates until the buffer is next bound.", 0, true );
+  
+  inline int RoundUp( int x, int align ) {
+    return ( x + align - 1 ) / align * align;
+  }
 
   // listbuffers command
   void ListBuffers( const vector< Token > & tokens ) {
@@ -160,6 +180,8 @@ namespace {
 
 
 namespace r3 {
+  MemoryTag mem_buffer( "buffer", "Budget in KB for the CPU shadow copies of buffers, 0 for none." );
+
   void ComputeOffsets( int varyings, int & stride, int * offsets );
 
   void InitBuffer() {
@@ -168,6 +190,8 @@ namespace r3 {
     }
     Output( "Initializing r3::Buffer." );
     bufferDatabase = new BufferDatabase();
+    vertexArena = new BufferArena( "vertexArena", GL_ARRAY_BUFFER, ArenaBlockSize );
+    indexArena = new BufferArena( "indexArena", GL_ELEMENT_ARRAY_BUFFER, ArenaBlockSize );
     initialized = true;
   }
 
@@ -176,6 +200,10 @@ namespace r3 {
       return;
     }
     Output( "Shutting down r3::Buffer." );
+    delete vertexArena;
+    vertexArena = NULL;
+    delete indexArena;
+    indexArena = NULL;
     delete bufferDatabase;
     initialized = false;
   }
@@ -192,64 +220,162 @@ namespace r3 {
     }
   }
 
-  Buffer::Buffer( const std::string & bufName, int bufTarget ) : name( bufName ), target( bufTarget ), allocListener( NULL ) {
+  void EndBufferFrame() {
+    for( int i = 0; i < (int)streamBuffers.size(); i++ ) {
+      streamBuffers[ i ]->EndFrame();
+    }
+  }
+
+  BufferArena & GetVertexArena() {
+    return *vertexArena;
+  }
+
+  BufferArena & GetIndexArena() {
+    return *indexArena;
+  }
+
+  Buffer::Buffer( const std::string & bufName, int bufTarget )
+  : name( bufName ), size( 0 ), target( bufTarget ), allocListener( NULL ), shadow( BufferShadow_Keep ), shadowFileOffset( 0 ) {
     glGenBuffers( 1, & obj );
     bufferDatabase->AddBuffer( name, this );
   }
   Buffer::~Buffer() {
+    StateForgetBuffer( obj );
     glDeleteBuffers( 1, & obj );
     bufferDatabase->DeleteBuffer( name );
   }
 
-  void Buffer::Bind() const {
-    glBindBuffer( target, obj );
+  void Buffer::Bind() {
+    StateBindBuffer( target, obj );
+    if( dirty.size() ) {
+      UploadDirty();
+    }
   }
 
   void Buffer::Unbind() const {
-    glBindBuffer( target, 0 );		
+    StateBindBuffer( target, 0 );
   }
 
+  // Updates leave the buffer bound, so drawing it next costs no bind.
+
 
   void Buffer::SetData( int sz, const void * data ) {
     size = sz;
-    cache.resize( size );
-    memcpy( &cache[0], data, size );
-    glBindBuffer( target, obj );
+    dirty.clear();
+    if( shadow == BufferShadow_Keep ) {
+      cache.resize( size );
+      if( data ) {
+        memcpy( &cache[0], data, size );
+      }
+    }
+    Bind();
     glBufferData( target, size, data, GL_DYNAMIC_DRAW );
-    glBindBuffer( target, 0 );
   }
 
   void Buffer::SetSubdata( int offset, int sz, const void * data ) {
     assert( ( offset + sz ) <= size );
+    if( shadow != BufferShadow_Keep ) {
+      Bind();
+      glBufferSubData( target, offset, sz, data );
+      return;
+    }
     memcpy( &cache[offset], data, sz );
-    glBindBuffer( target, obj );
-    glBufferSubData( target, offset, sz, data );
-    glBindBuffer( target, 0 );
+    MarkDirty( offset, offset + sz );
+    if( r_bufferDeferUploads.GetVal() == false ) {
+      Bind();
+    }
+  }
+
+  void Buffer::MarkDirty( int begin, int end ) {
+    vector< pair< int, int > >::iterator it = lower_bound( dirty.begin(), dirty.end(), make_pair( begin, end ) );
+    // swallow the neighbours within DirtyMergeGap on either side
+    if( it != dirty.begin() && ( it - 1 )->second + DirtyMergeGap >= begin ) {
+      --it;
+      begin = it->first;
+    }
+    vector< pair< int, int > >::iterator last = it;
+    while( last != dirty.end() && last->first <= end + DirtyMergeGap ) {
+      end = max( end, last->second );
+      ++last;
+    }
+    it = dirty.erase( it, last );
+    dirty.insert( it, make_pair( begin, end ) );
+  }
+
+  void Buffer::UploadDirty() {
+    for( int i = 0; i < (int)dirty.size(); i++ ) {
+      glBufferSubData( target, dirty[ i ].first, dirty[ i ].second - dirty[ i ].first, &cache[ dirty[ i ].first ] );
+    }
+    dirty.clear();
   }
 
   void Buffer::GetData( void * data ) {
+    assert( shadow == BufferShadow_Keep );
     memcpy( data, &cache[0], cache.size() );
   }
 
   void Buffer::GetSubData( int offset, int sz, void * data ) {
+    assert( shadow == BufferShadow_Keep );
     assert( ( offset + sz ) <= size );
     memcpy( data, &cache[ offset ], sz );
   }
 
+  void Buffer::SetShadow( BufferShadowEnum s ) {
+    if( s != BufferShadow_Keep && dirty.size() ) {
+      Bind();
+    }
+    if( s == shadow ) {
+      return;
+    }
+    // nothing to fill a new copy from but GL, which may not read buffers back
+    assert( s != BufferShadow_Keep || size == 0 );
+    shadow = s;
+    if( shadow == BufferShadow_Keep ) {
+      return;
+    }
+    vector< unsigned char, TrackedAllocator< unsigned char, mem_buffer > > none;
+    cache.swap( none );
+  }
+
+  void Buffer::SetShadowFile( const std::string & filename, int offset ) {
+    SetShadow( BufferShadow_File );
+    shadowFile = filename;
+    shadowFileOffset = offset;
+  }
+
   void Buffer::Alloc() {
     if( obj == 0 ) {
       glGenBuffers( 1, & obj );
     }
-    glBindBuffer( target, obj );
-    glBufferData( target, size, &cache[0], GL_DYNAMIC_DRAW );        
+    dirty.clear();
+    vector< uchar > fileData;
+    const void * data = NULL;
+    if( shadow == BufferShadow_Keep && size > 0 ) {
+      data = &cache[0];
+    } else if( shadow == BufferShadow_File && size > 0 ) {
+      File * f = FileOpenForRead( shadowFile );
+      if( f ) {
+        fileData.resize( size );
+        f->Seek( Seek_Begin, shadowFileOffset );
+        if( f->Read( &fileData[0], 1, size ) == size ) {
+          data = &fileData[0];
+        }
+        delete f;
+      }
+      if( data == NULL ) {
+        Output( "Buffer %s could not reread %s.", name.c_str(), shadowFile.c_str() );
+      }
+    }
+    Bind();
+    glBufferData( target, size, data, GL_DYNAMIC_DRAW );        
     CallAllocListener();
-    glBindBuffer( target, 0 );
   }
 
   void Buffer::Dealloc() {
     if( obj == 0 ) {
       return;
     }
+    StateForgetBuffer( obj );
     glDeleteBuffers( 1, & obj );
     obj = 0;
   }
@@ -280,6 +406,206 @@ namespace r3 {
 
   IndexBuffer::IndexBuffer( const std::string & ibName ) : Buffer( ibName, GL_ELEMENT_ARRAY_BUFFER ) {}
 
+  StreamBuffer::StreamBuffer( const std::string & sbName, int sbTarget, int sbSize )
+  : Buffer( sbName, sbTarget ), head( 0 ), used( 0 ), frameBytes( 0 ) {
+    shadow = BufferShadow_Drop; // rewritten every frame, nothing to restore
+    size = sbSize;
+    Bind();
+    glBufferData( target, size, NULL, GL_STREAM_DRAW );
+    streamBuffers.push_back( this );
+  }
+
+  StreamBuffer::~StreamBuffer() {
+    while( fences.size() ) {
+      glDeleteSync( fences.front().first );
+      fences.pop_front();
+    }
+    streamBuffers.erase( find( streamBuffers.begin(), streamBuffers.end(), this ) );
+  }
+
+  void StreamBuffer::WaitOldest() {
+    GLsync fence = fences.front().first;
+    while( glClientWaitSync( fence, GL_SYNC_FLUSH_COMMANDS_BIT, 100000000 ) == GL_TIMEOUT_EXPIRED ) {
+    }
+    glDeleteSync( fence );
+    used -= fences.front().second;
+    fences.pop_front();
+  }
+
+  int StreamBuffer::Write( const void * data, int sz, int align ) {
+    assert( sz <= size );
+    int offset = RoundUp( head, align );
+    int need = offset - head + sz;
+    if( offset + sz > size ) {
+      offset = 0; // skip the tail end of the ring
+      need = size - head + sz;
+    }
+    while( used + need > size && fences.size() ) {
+      WaitOldest();
+    }
+    Bind();
+    if( used + need > size ) {
+      // this frame alone fills the ring, so give GL fresh storage
+      glBufferData( target, size, NULL, GL_STREAM_DRAW );
+      head = used = frameBytes = 0;
+      offset = 0;
+      need = sz;
+    }
+    void * dst = glMapBufferRange( target, offset, sz, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT );
+    if( dst ) {
+      memcpy( dst, data, sz );
+      glUnmapBuffer( target );
+    } else {
+      glBufferSubData( target, offset, sz, data );
+    }
+    head = offset + sz;
+    used += need;
+    frameBytes += need;
+    return offset;
+  }
+
+  void StreamBuffer::EndFrame() {
+    if( frameBytes == 0 ) {
+      return;
+    }
+    fences.push_back( make_pair( glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 ), frameBytes ) );
+    frameBytes = 0;
+  }
+
+  void StreamBuffer::Alloc() {
+    if( obj == 0 ) {
+      glGenBuffers( 1, & obj );
+    }
+    Bind();
+    glBufferData( target, size, NULL, GL_STREAM_DRAW );
+    head = used = frameBytes = 0;
+    CallAllocListener();
+  }
+
+  void StreamBuffer::Dealloc() {
+    while( fences.size() ) {
+      glDeleteSync( fences.front().first );
+      fences.pop_front();
+    }
+    head = used = frameBytes = 0;
+    Buffer::Dealloc();
+  }
+
+  BufferArena::BufferArena( const std::string & arenaName, int arenaTarget, int arenaBlockSize )
+  : name( arenaName ), target( arenaTarget ), blockSize( arenaBlockSize ) {}
+
+  BufferArena::~BufferArena() {
+    for( int i = 0; i < (int)blocks.size(); i++ ) {
+      delete blocks[ i ].buffer;
+    }
+  }
+
+  bool BufferArena::Carve( Block & b, int sz, int align, BufferRange & r ) {
+    vector< pair< int, int > > & fr = b.freeRanges;
+    for( int i = 0; i < (int)fr.size(); i++ ) {
+      int begin = fr[ i ].first;
+      int end = begin + fr[ i ].second;
+      int offset = RoundUp( begin, align );
+      if( offset + sz > end ) {
+        continue;
+      }
+      fr.erase( fr.begin() + i );
+      if( offset + sz < end ) {
+        fr.insert( fr.begin() + i, make_pair( offset + sz, end - offset - sz ) );
+      }
+      if( begin < offset ) {
+        fr.insert( fr.begin() + i, make_pair( begin, offset - begin ) );
+      }
+      r.buffer = b.buffer;
+      r.offset = offset;
+      r.size = sz;
+      return true;
+    }
+    return false;
+  }
+
+  BufferRange BufferArena::Alloc( int sz, int align, const void * data, BufferAllocListener * refill ) {
+    BufferRange r;
+    for( int i = 0; i < (int)blocks.size() && r.buffer == NULL; i++ ) {
+      Carve( blocks[ i ], sz, align, r );
+    }
+    if( r.buffer == NULL ) {
+      char blockName[ 64 ];
+      r3Sprintf( blockName, "%s_%d", name.c_str(), (int)blocks.size() );
+      Block b;
+      if( target == GL_ELEMENT_ARRAY_BUFFER ) {
+        b.buffer = new IndexBuffer( blockName );
+      } else {
+        b.buffer = new VertexBuffer( blockName );
+      }
+      int bsz = max( blockSize, sz );
+      b.buffer->SetShadow( BufferShadow_Drop );
+      b.buffer->SetAllocListener( this );
+      b.buffer->SetData( bsz, NULL );
+      b.freeRanges.push_back( make_pair( 0, bsz ) );
+      blocks.push_back( b );
+      Carve( blocks.back(), sz, align, r );
+    }
+    if( data ) {
+      r.buffer->SetSubdata( r.offset, sz, data );
+    }
+    if( refill ) {
+      for( int i = 0; i < (int)blocks.size(); i++ ) {
+        if( blocks[ i ].buffer == r.buffer ) {
+          blocks[ i ].refills.push_back( make_pair( r.offset, refill ) );
+        }
+      }
+    }
+    return r;
+  }
+
+  void BufferArena::Free( const BufferRange & r ) {
+    if( r.buffer == NULL ) {
+      return;
+    }
+    for( int i = 0; i < (int)blocks.size(); i++ ) {
+      if( blocks[ i ].buffer != r.buffer ) {
+        continue;
+      }
+      vector< pair< int, BufferAllocListener * > > & rf = blocks[ i ].refills;
+      for( int j = 0; j < (int)rf.size(); j++ ) {
+        if( rf[ j ].first == r.offset ) {
+          rf.erase( rf.begin() + j );
+          break;
+        }
+      }
+      vector< pair< int, int > > & fr = blocks[ i ].freeRanges;
+      vector< pair< int, int > >::iterator it = lower_bound( fr.begin(), fr.end(), make_pair( r.offset, 0 ) );
+      it = fr.insert( it, make_pair( r.offset, r.size ) );
+      // merge with the free ranges on either side
+      vector< pair< int, int > >::iterator next = it + 1;
+      if( next != fr.end() && it->first + it->second == next->first ) {
+        it->second += next->second;
+        fr.erase( next );
+      }
+      if( it != fr.begin() ) {
+        vector< pair< int, int > >::iterator prev = it - 1;
+        if( prev->first + prev->second == it->first ) {
+          prev->second += it->second;
+          fr.erase( it );
+        }
+      }
+      return;
+    }
+  }
+
+  void BufferArena::OnBufferAlloc( Buffer * buf ) {
+    for( int i = 0; i < (int)blocks.size(); i++ ) {
+      if( blocks[ i ].buffer != buf ) {
+        continue;
+      }
+      vector< pair< int, BufferAllocListener * > > & rf = blocks[ i ].refills;
+      for( int j = 0; j < (int)rf.size(); j++ ) {
+        rf[ j ].second->OnBufferAlloc( buf );
+      }
+      return;
+    }
+  }
 
 }
 
@@ -42,13 +42,18 @@
  */
 
 #include "r3/command.h"
+#include "r3/eventlog.h"
 #include "r3/output.h"
+#include "r3/profile.h"
 #include "r3/var.h"
 #include <map>
 
 using namespace std;
 using namespace r3;
 
+OutputCategory out_cmd( "cmd", "Output level for command execution, -1 to use out_level." );
+EventFormat ev_command( "command %s" );
+
 namespace {
 	
 	// We have to do this to have static initialization of commands works.
@@ -92,7 +97,9 @@ namespace r3 {
 	}
 	
 	void ExecuteCommand( const char *cmd ) {
-		Output("executing command: \"%s\"", cmd );
+		R3_PROFILE( "ExecuteCommand" );
+		R3_OUTPUT_VERBOSE( out_cmd, "executing command: \"%s\"", cmd );
+		LogEvent( ev_command, cmd );
 		vector< Token > tokens = TokenizeString( cmd );
 		if ( tokens.size() == 0 ) {
 			return;
@@ -125,8 +132,6 @@ namespace r3 {
 	
 }
 
-extern VarInteger f_numOpenFiles;
-
 namespace {
 
 	// quit command
@@ -45,6 +45,8 @@
 
 #include "r3/buffer.h"
 #include "r3/common.h"
+#include "r3/glstate.h"
+#include "r3/model.h"
 #include "r3/output.h"
 #include "r3/thread.h"
 #include <GL/Regal.h>
@@ -59,16 +61,73 @@ using namespace std;
 using namespace r3;
 
 namespace {
-		
+	
+	struct QuadVertex {
+		float x, y;
+		float s, t;
+		uchar color[4];
+	};
+	
+	// well inside the MaxQuadVertexes the quad indexes cover
+	const int MaxBatchQuads = 4096;
+	
+	// size of the ring the batches are streamed through
+	const int QuadStreamSize = 1 << 20;
+	
+	struct QuadBatch {
+		QuadBatch() : stream( NULL ), flushing( false ) {}
+		vector< QuadVertex > verts;
+		StreamBuffer * stream;
+		bool flushing;
+	};
+	QuadBatch batch;
+	
+	inline void SetVertex( QuadVertex & v, float x, float y, float s, float t, const uchar * color ) {
+		v.x = x;
+		v.y = y;
+		v.s = s;
+		v.t = t;
+		memcpy( v.color, color, sizeof( v.color ) );
+	}
+	
 }
 
 namespace r3 {
 	
 	void InitDraw() {
+		SetStateChangeFunc( FlushQuads );
 	}
     
     void ShutdownDraw() {
+		SetStateChangeFunc( NULL );
+		batch.verts.clear();
+		delete batch.stream;
+		batch.stream = NULL;
     }
+	
+	void FlushQuads() {
+		// drawing changes state too, which must not flush again
+		if( batch.verts.empty() || batch.flushing ) {
+			return;
+		}
+		batch.flushing = true;
+		if( batch.stream == NULL ) {
+			batch.stream = new StreamBuffer( "quadBatch_sb", GL_ARRAY_BUFFER, QuadStreamSize );
+		}
+		int numQuads = (int)batch.verts.size() / 4;
+		const GLsizei stride = sizeof( QuadVertex );
+		const char * base = (const char *)NULL + batch.stream->Write( &batch.verts[0], numQuads * 4 * stride, stride );
+		StateArrayPointer( GL_VERTEX_ARRAY, 2, GL_FLOAT, GL_FALSE, stride, base );
+		StateArrayPointer( GL_TEXTURE0, 2, GL_FLOAT, GL_FALSE, stride, base + 8 );
+		StateArrayPointer( GL_COLOR_ARRAY, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, base + 16 );
+		StateEnableArrays( StateArrayBit( GL_VERTEX_ARRAY ) | StateArrayBit( GL_TEXTURE0 ) | StateArrayBit( GL_COLOR_ARRAY ) );
+		GetQuadIndexBuffer()->Bind();
+		glDrawElements( GL_TRIANGLES, numQuads * 6, GL_UNSIGNED_SHORT, 0 );
+		StateForgetColor();
+		batch.verts.clear();
+		batch.flushing = false;
+	}
+	
 
 	int GetDepthBits() {
 		int r;
@@ -77,74 +136,54 @@ namespace r3 {
 	}
 			
 	void TexEnvCombineAlpha( int index ) {
-		glMultiTexEnviEXT( GL_TEXTURE0 + index, GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE );
-		glMultiTexEnviEXT( GL_TEXTURE0 + index, GL_TEXTURE_ENV, GL_COMBINE_RGB, GL_REPLACE );
-		glMultiTexEnviEXT( GL_TEXTURE0 + index, GL_TEXTURE_ENV, GL_SRC0_RGB, GL_PREVIOUS );
-		glMultiTexEnviEXT( GL_TEXTURE0 + index, GL_TEXTURE_ENV, GL_OPERAND0_RGB, GL_SRC_COLOR );
-		glMultiTexEnviEXT( GL_TEXTURE0 + index, GL_TEXTURE_ENV, GL_COMBINE_ALPHA, GL_MODULATE );
-		glMultiTexEnviEXT( GL_TEXTURE0 + index, GL_TEXTURE_ENV, GL_SRC0_ALPHA, GL_PREVIOUS );
-		glMultiTexEnviEXT( GL_TEXTURE0 + index, GL_TEXTURE_ENV, GL_OPERAND0_ALPHA, GL_SRC_ALPHA );			
-		glMultiTexEnviEXT( GL_TEXTURE0 + index, GL_TEXTURE_ENV, GL_SRC1_ALPHA, GL_TEXTURE );
-		glMultiTexEnviEXT( GL_TEXTURE0 + index, GL_TEXTURE_ENV, GL_OPERAND1_ALPHA, GL_SRC_ALPHA );			
+		StateTexEnv( index, GL_TEXTURE_ENV_MODE, GL_COMBINE );
+		StateTexEnv( index, GL_COMBINE_RGB, GL_REPLACE );
+		StateTexEnv( index, GL_SRC0_RGB, GL_PREVIOUS );
+		StateTexEnv( index, GL_OPERAND0_RGB, GL_SRC_COLOR );
+		StateTexEnv( index, GL_COMBINE_ALPHA, GL_MODULATE );
+		StateTexEnv( index, GL_SRC0_ALPHA, GL_PREVIOUS );
+		StateTexEnv( index, GL_OPERAND0_ALPHA, GL_SRC_ALPHA );			
+		StateTexEnv( index, GL_SRC1_ALPHA, GL_TEXTURE );
+		StateTexEnv( index, GL_OPERAND1_ALPHA, GL_SRC_ALPHA );			
 	}
 
 	void TexEnvCombineAlphaModulate( int index ) {
-		glMultiTexEnviEXT( GL_TEXTURE0 + index, GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE );
-		glMultiTexEnviEXT( GL_TEXTURE0 + index, GL_TEXTURE_ENV, GL_COMBINE_RGB, GL_MODULATE);
-		glMultiTexEnviEXT( GL_TEXTURE0 + index, GL_TEXTURE_ENV, GL_SRC0_RGB, GL_PREVIOUS );
-		glMultiTexEnviEXT( GL_TEXTURE0 + index, GL_TEXTURE_ENV, GL_OPERAND0_RGB, GL_SRC_COLOR );
-		glMultiTexEnviEXT( GL_TEXTURE0 + index, GL_TEXTURE_ENV, GL_SRC1_RGB, GL_TEXTURE );
-		glMultiTexEnviEXT( GL_TEXTURE0 + index, GL_TEXTURE_ENV, GL_OPERAND1_RGB, GL_SRC_ALPHA );
-		glMultiTexEnviEXT( GL_TEXTURE0 + index, GL_TEXTURE_ENV, GL_COMBINE_ALPHA, GL_MODULATE );
-		glMultiTexEnviEXT( GL_TEXTURE0 + index, GL_TEXTURE_ENV, GL_SRC0_ALPHA, GL_PREVIOUS );
-		glMultiTexEnviEXT( GL_TEXTURE0 + index, GL_TEXTURE_ENV, GL_OPERAND0_ALPHA, GL_SRC_ALPHA );			
-		glMultiTexEnviEXT( GL_TEXTURE0 + index, GL_TEXTURE_ENV, GL_SRC1_ALPHA, GL_TEXTURE );
-		glMultiTexEnviEXT( GL_TEXTURE0 + index, GL_TEXTURE_ENV, GL_OPERAND1_ALPHA, GL_SRC_ALPHA );			
+		StateTexEnv( index, GL_TEXTURE_ENV_MODE, GL_COMBINE );
+		StateTexEnv( index, GL_COMBINE_RGB, GL_MODULATE);
+		StateTexEnv( index, GL_SRC0_RGB, GL_PREVIOUS );
+		StateTexEnv( index, GL_OPERAND0_RGB, GL_SRC_COLOR );
+		StateTexEnv( index, GL_SRC1_RGB, GL_TEXTURE );
+		StateTexEnv( index, GL_OPERAND1_RGB, GL_SRC_ALPHA );
+		StateTexEnv( index, GL_COMBINE_ALPHA, GL_MODULATE );
+		StateTexEnv( index, GL_SRC0_ALPHA, GL_PREVIOUS );
+		StateTexEnv( index, GL_OPERAND0_ALPHA, GL_SRC_ALPHA );			
+		StateTexEnv( index, GL_SRC1_ALPHA, GL_TEXTURE );
+		StateTexEnv( index, GL_OPERAND1_ALPHA, GL_SRC_ALPHA );			
 	}
-		void DrawQuad( float x0, float y0, float x1, float y1 ) {
-		glBegin( GL_QUADS );
-		glVertex2f( x0, y0 );
-		glVertex2f( x1, y0 );
-		glVertex2f( x1, y1 );
-		glVertex2f( x0, y1 );		
-		glEnd();
+	void DrawQuad( float x0, float y0, float x1, float y1 ) {
+		DrawTexturedQuad( x0, y0, x1, y1, 0, 0, 0, 0 );
 	}
 	
 	void ImTexturedQuad( float x0, float y0, float x1, float y1, float s0, float t0, float s1, float t1 ) {
-		glMultiTexCoord2f( GL_TEXTURE0, s0, t0 );
-		glVertex2f( x0, y0 );
-		glMultiTexCoord2f( GL_TEXTURE0, s1, t0 );
-		glVertex2f( x1, y0 );
-		glMultiTexCoord2f( GL_TEXTURE0, s1, t1 );
-		glVertex2f( x1, y1 );
-		glMultiTexCoord2f( GL_TEXTURE0, s0, t1 );
-		glVertex2f( x0, y1 );		
+		DrawTexturedQuad( x0, y0, x1, y1, s0, t0, s1, t1 );
 	}
 	
 	void DrawTexturedQuad( float x0, float y0, float x1, float y1, float s0, float t0, float s1, float t1 ) {
-		glBegin( GL_QUADS );
-		glMultiTexCoord2f( GL_TEXTURE0, s0, t0 );
-		glVertex2f( x0, y0 );
-		glMultiTexCoord2f( GL_TEXTURE0, s1, t0 );
-		glVertex2f( x1, y0 );
-		glMultiTexCoord2f( GL_TEXTURE0, s1, t1 );
-		glVertex2f( x1, y1 );
-		glMultiTexCoord2f( GL_TEXTURE0, s0, t1 );
-		glVertex2f( x0, y1 );		
-		glEnd();
+		if( (int)batch.verts.size() >= MaxBatchQuads * 4 ) {
+			FlushQuads();
+		}
+		size_t n = batch.verts.size();
+		batch.verts.resize( n + 4 );
+		QuadVertex * v = &batch.verts[ n ];
+		const uchar * color = GetStateColor();
+		SetVertex( v[0], x0, y0, s0, t0, color );
+		SetVertex( v[1], x1, y0, s1, t0, color );
+		SetVertex( v[2], x1, y1, s1, t1, color );
+		SetVertex( v[3], x0, y1, s0, t1, color );
 	}
 	
 	void DrawSprite( float x0, float y0, float x1, float y1 ) {
-		glBegin( GL_QUADS );
-		glMultiTexCoord2f( GL_TEXTURE0, 0, 0 );
-		glVertex2f( x0, y0 );
-		glMultiTexCoord2f( GL_TEXTURE0, 1, 0 );
-		glVertex2f( x1, y0 );
-		glMultiTexCoord2f( GL_TEXTURE0, 1, 1 );
-		glVertex2f( x1, y1 );
-		glMultiTexCoord2f( GL_TEXTURE0, 0, 1 );
-		glVertex2f( x0, y1 );		
-		glEnd();
+		DrawTexturedQuad( x0, y0, x1, y1, 0, 0, 1, 1 );
 	}
 	
 	
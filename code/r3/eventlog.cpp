@@ -0,0 +1,223 @@
+/*
+ *  eventlog
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#include "r3/eventlog.h"
+
+#include "r3/filesystem.h"
+#include "r3/output.h"
+#include "r3/queue.h"
+#include "r3/thread.h"
+#include "r3/time.h"
+#include "r3/timer.h"
+
+#include <vector>
+
+using namespace std;
+using namespace r3;
+
+// Records buffered between flushes, beyond this events are dropped.
+#define EVENT_QUEUE_SIZE 8192
+// How often buffered events are written out, in seconds.
+#define EVENT_FLUSH_INTERVAL 0.25
+
+namespace r3 {
+	VarBool ev_enable( "ev_enable", "Record binary events to ev_file.", Var_Archive, false );
+}
+
+VarString ev_file( "ev_file", "Binary event log file name, relative to f_cachePath.", Var_Archive, "events.r3ev" );
+VarInteger ev_dropped( "ev_dropped", "Number of events dropped because the event queue was full.", Var_ReadOnly, 0 );
+
+namespace {
+	
+	// We have to do this to have static initialization of formats work.
+	struct EventFormats {
+		vector< const char * > fmts;
+	};
+	EventFormats * formats;
+	
+	LockFreeQueue< EventRecord > * eventQueue;
+	Atomic<uint> eventsDropped;
+	Atomic<int> flushScheduled;
+	// Once set, late events are ignored rather than reopening ev_file,
+	// which would truncate the log.
+	Atomic<int> eventLogShutdown;
+	
+	Mutex eventMutex;
+	TimerId flushTimer = InvalidTimerId; // guarded by eventMutex
+	File * eventFile;
+	vector< bool > formatWritten;
+	
+	template <typename T> void WriteValue( File * f, const T & v ) {
+		f->Write( &v, sizeof( v ), 1 );
+	}
+	
+	// Caller holds eventMutex.
+	void DrainEvents() {
+		if( eventQueue == NULL || eventLogShutdown.Get() ) {
+			return;
+		}
+		if( eventFile == NULL ) {
+			if( eventQueue->Size() == 0 ) {
+				return;
+			}
+			eventFile = FileOpenForWrite( ev_file.GetVal() );
+			if( eventFile == NULL ) {
+				Output( "Unable to open event log %s, disabling.", ev_file.GetVal().c_str() );
+				ev_enable.SetVal( false );
+				return;
+			}
+			eventFile->Write( R3_EVENTLOG_MAGIC, 4, 1 );
+			WriteValue( eventFile, uint( R3_EVENTLOG_VERSION ) );
+			formatWritten.clear();
+		}
+		File * f = eventFile;
+		EventRecord r;
+		while( eventQueue->TryPop( r ) ) {
+			if( r.id >= formatWritten.size() ) {
+				formatWritten.resize( formats->fmts.size(), false );
+			}
+			if( formatWritten[ r.id ] == false ) {
+				const char * fmt = formats->fmts[ r.id ];
+				WriteValue( f, uchar( EventChunk_Format ) );
+				WriteValue( f, r.id );
+				WriteValue( f, ushort( strlen( fmt ) ) );
+				f->Write( fmt, 1, (int)strlen( fmt ) );
+				formatWritten[ r.id ] = true;
+			}
+			WriteValue( f, uchar( EventChunk_Event ) );
+			WriteValue( f, r.id );
+			WriteValue( f, r.time );
+			WriteValue( f, r.size );
+			f->Write( r.args, 1, r.size );
+		}
+		uint dropped = eventsDropped.Get();
+		if( dropped ) {
+			eventsDropped.Add( uint( -int( dropped ) ) );
+			ev_dropped.SetVal( ev_dropped.GetVal() + dropped );
+			WriteValue( f, uchar( EventChunk_Dropped ) );
+			WriteValue( f, dropped );
+		}
+	}
+	
+	// The timer only wakes the writer, the file I/O happens on its thread.
+	Atomic<int> flushPending;
+	Semaphore flushSem;
+	
+	struct EventWriterThread : public Thread {
+		EventWriterThread() : Thread( "EventWriter" ) {}
+		void Run() {
+			for( ;; ) {
+				flushSem.Wait();
+				flushPending.Set( 0 );
+				ScopedMutex m( eventMutex, R3_LOC );
+				DrainEvents();
+			}
+		}
+	};
+	EventWriterThread eventWriterThread;
+	
+	void FlushEventsTimer( void * ) {
+		if( flushPending.Get() == 0 && flushPending.CompareAndSwap( 0, 1 ) ) {
+			flushSem.Post();
+		}
+	}
+	
+}
+
+namespace r3 {
+	
+	EventFormat::EventFormat( const char * fmt ) {
+		if( formats == NULL ) {
+			formats = new EventFormats;
+		}
+		assert( formats->fmts.size() < 0xffff );
+		id = ushort( formats->fmts.size() );
+		formats->fmts.push_back( fmt );
+	}
+	
+	EventRecord::EventRecord( const EventFormat & fmt ) : time( GetMonotonicNanoseconds() ), id( fmt.Id() ), size( 0 ) {
+	}
+	
+	void EventRecord::Commit() {
+		if( eventQueue == NULL || eventLogShutdown.Get() ) {
+			return; // too early, or already shut down
+		}
+		if( eventQueue->TryPush( *this ) == false ) {
+			eventsDropped.Incr();
+		}
+		if( flushScheduled.Get() == 0 && flushScheduled.CompareAndSwap( 0, 1 ) ) {
+			// under the lock so a concurrent shutdown sees the timer, or
+			// this sees the shutdown
+			ScopedMutex m( eventMutex, R3_LOC );
+			if( eventLogShutdown.Get() == 0 ) {
+				eventWriterThread.Start();
+				flushTimer = ScheduleTimer( EVENT_FLUSH_INTERVAL, FlushEventsTimer, NULL, EVENT_FLUSH_INTERVAL );
+			}
+		}
+	}
+	
+	void InitEventLog() {
+		if( eventQueue == NULL ) {
+			eventQueue = new LockFreeQueue< EventRecord >( EVENT_QUEUE_SIZE );
+		}
+	}
+	
+	void FlushEventLog() {
+		ScopedMutex m( eventMutex, R3_LOC );
+		DrainEvents();
+	}
+	
+	void ShutdownEventLog() {
+		ScopedMutex m( eventMutex, R3_LOC );
+		if( flushTimer != InvalidTimerId ) {
+			CancelTimer( flushTimer );
+			flushTimer = InvalidTimerId;
+		}
+		DrainEvents();
+		eventLogShutdown.Set( 1 );
+		delete eventFile;
+		eventFile = NULL;
+		// the queue is leaked on purpose, late Commit() calls may still be in flight
+	}
+	
+}
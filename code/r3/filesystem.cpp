@@ -44,12 +44,16 @@
 #include "r3/filesystem.h"
 
 #include "r3/command.h"
+#include "r3/eventlog.h"
 #include "r3/http.h"
 #include "r3/md5.h"
+#include "r3/memory.h"
+#include "r3/metrics.h"
 #include "r3/output.h"
 #include "r3/parse.h"
 #include "r3/thread.h"
 #include "r3/time.h"
+#include "r3/timer.h"
 #include "r3/ujson.h"
 #include "r3/var.h"
 
@@ -61,10 +65,14 @@
 # include <unistd.h>
 # include <dirent.h>
 # include <sys/stat.h>
+# include <sys/mman.h>
+# include <fcntl.h>
 #endif
 
 #if _WIN32
 # include <Windows.h>
+# include <sys/types.h>
+# include <sys/stat.h>
 #endif
 
 #include <stdio.h>
@@ -79,7 +87,18 @@
 using namespace std;
 using namespace r3;
 
-VarInteger f_numOpenFiles( "f_numOpenFiles", "Number of open files.", 0, 0 );
+MetricGauge f_numOpenFiles( "f_numOpenFiles", "Number of open files." );
+MetricCounter f_filesOpened( "f_filesOpened", "Number of files successfully opened." );
+MetricCounter f_bytesRead( "f_bytesRead", "Number of bytes read from files." );
+MetricCounter f_cacheHits( "f_cacheHits", "Number of reads satisfied from the cache directory." );
+MetricCounter f_cacheMisses( "f_cacheMisses", "Number of reads not found in the cache directory." );
+OutputCategory out_fs( "fs", "Output level for file opens and directory handling, -1 to use out_level." );
+OutputCategory out_net( "net", "Output level for NetCache fetches, -1 to use out_level." );
+MemoryTag mem_manifest( "manifest", "Budget in KB for the cache manifest, 0 for none." );
+
+EventFormat ev_fopen( "fopen %s %s -> %d" );
+EventFormat ev_netFetch( "netcache fetch %s from %s -> %d bytes" );
+EventFormat ev_netFetchFailed( "netcache fetch %s failed" );
 
 #if ANDROID
 // copy a file out of the apk into the cache
@@ -103,6 +122,16 @@ namespace r3 {
 namespace {
   File * CachedFileOpenForPrivateRead( const string & inFileName );
   
+  string DigestToHex( const unsigned char * digest ) {
+    char hex[] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+    string sum;
+    for( int i = 0; i < 16; i++ ) {
+      sum += hex[ ( digest[i] >> 4 ) & 0xf ];
+      sum += hex[ ( digest[i] >> 0 ) & 0xf ];
+    }
+    return sum;
+  }
+  
   string ComputeMd5Sum(File *file) {
     if( file == NULL || file->Size() == 0 ) {
       return "00000000000000000000000000000000000000";
@@ -121,13 +150,16 @@ namespace {
     }
     file->Seek( Seek_Begin, pos );
     MD5Final( buf, &ctx );
-    char hex[] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
-    string sum;
-    for( int i = 0; i < 16; i++ ) {
-      sum += hex[ ( buf[i] >> 4 ) & 0xf ];
-      sum += hex[ ( buf[i] >> 0 ) & 0xf ];
-    }
-    return sum;
+    return DigestToHex( buf );
+  }
+  
+  string ComputeMd5Sum( const void * data, int size ) {
+    unsigned char digest[16];
+    MD5Context ctx;
+    MD5Init( &ctx );
+    MD5Update( &ctx, static_cast< const unsigned char * >( data ), size );
+    MD5Final( digest, &ctx );
+    return DigestToHex( digest );
   }
   
   struct ManifestInfo {
@@ -136,12 +168,14 @@ namespace {
     string md5;
     string etag;
     string lastModified;
-    int lastTry;
+    int lastTry; // wall clock, since it is persisted in the manifest
   };
   
-  Condition filesystemCond;
+  typedef map< string, ManifestInfo, less<string>, TrackedAllocator< pair< const string, ManifestInfo >, mem_manifest > > ManifestMap;
+  
+  Semaphore fetchSem;
   Mutex filesystemMutex;
-  map<string, ManifestInfo> manifest;
+  ManifestMap manifest;
   
   ManifestInfo & GetManifestInfo( const string & filename ) {
     ScopedMutex scm( filesystemMutex, R3_LOC );
@@ -159,7 +193,7 @@ namespace {
     stringstream ss ( stringstream::out );
     ss << "{ ";
     string sep = "";
-		for( map<string,ManifestInfo>::iterator it = manifest.begin(); it != manifest.end(); ++it ) {
+		for( ManifestMap::iterator it = manifest.begin(); it != manifest.end(); ++it ) {
       ManifestInfo &mi = it->second;
       ss << sep << endl;
       ss << "  \"" << it->first.c_str() << "\": {" << endl;
@@ -246,7 +280,7 @@ namespace {
         GetManifestInfo( i->first ) = mi;
       }
     }
-    
+    ujson::Delete( root );
   }
   
   void WriteCacheManifest_cmd( const vector< Token > & tokens ) {
@@ -284,8 +318,10 @@ namespace {
 	FILE *Fopen( const char *filename, const char *mode ) {
 		FILE *fp;
 		fopen_s( &fp, filename, mode );
+		LogEvent( ev_fopen, filename, mode, fp != NULL );
 		if ( fp ) {
-			f_numOpenFiles.SetVal( f_numOpenFiles.GetVal() + 1 );
+			f_numOpenFiles.Incr();
+			f_filesOpened.Incr();
 		}
 		return fp;
 	}
@@ -293,12 +329,16 @@ namespace {
 	FILE *Fopen( const char *filename, const char *mode ) {
 		FILE *fp;
 		fp = fopen( filename, mode );
-		f_numOpenFiles.SetVal( f_numOpenFiles.GetVal() + 1 );
+		LogEvent( ev_fopen, filename, mode, fp != NULL );
+		if ( fp ) {
+			f_numOpenFiles.Incr();
+			f_filesOpened.Incr();
+		}
 		return fp;
 	}
 #endif
   void Fclose( FILE * fp ) {
-    f_numOpenFiles.SetVal( f_numOpenFiles.GetVal() - 1 );
+    f_numOpenFiles.Decr();
     fclose( fp );
   }
   
@@ -342,7 +382,9 @@ namespace {
       }
     }
     virtual int Read( void *data, int size, int nitems ) {
-      return (int)fread( data, (size_t)size, (size_t)nitems, fp );
+      int n = (int)fread( data, (size_t)size, (size_t)nitems, fp );
+      f_bytesRead.Add( int64( n ) * size );
+      return n;
     }
     
     virtual int Write( const void *data, int size, int nitems ) {
@@ -381,6 +423,102 @@ namespace {
     
   };
   
+  class StdMappedFile : public r3::MappedFile {
+  public:
+    const uchar * data;
+    int size;
+#if ! ( __APPLE__ || ANDROID || __linux__ )
+    vector< uchar > contents;
+#endif
+    StdMappedFile() : data( NULL ), size( 0 ) {}
+    
+    virtual ~StdMappedFile() {
+#if __APPLE__ || ANDROID || __linux__
+      if( data ) {
+        munmap( (void *)data, size );
+      }
+#endif
+    }
+    virtual const uchar * Data() {
+      return data;
+    }
+    virtual int Size() {
+      return size;
+    }
+  };
+  
+  // size, and modification time in nanoseconds where the platform has them
+  bool StatFile( const string & fn, int64 & size, int64 & mtime ) {
+#if _WIN32
+    struct _stat64 s;
+    if( _stat64( fn.c_str(), &s ) != 0 ) {
+      return false;
+    }
+    size = s.st_size;
+    mtime = int64( s.st_mtime ) * 1000000000;
+#else
+    struct stat s;
+    if( stat( fn.c_str(), &s ) != 0 || S_ISREG( s.st_mode ) == 0 ) {
+      return false;
+    }
+    size = s.st_size;
+# if __APPLE__
+    mtime = int64( s.st_mtimespec.tv_sec ) * 1000000000 + s.st_mtimespec.tv_nsec;
+# else
+    mtime = int64( s.st_mtim.tv_sec ) * 1000000000 + s.st_mtim.tv_nsec;
+# endif
+#endif
+    return true;
+  }
+  
+  StdMappedFile * MapFile( const string & fn ) {
+#if __APPLE__ || ANDROID || __linux__
+    int fd = open( fn.c_str(), O_RDONLY );
+    LogEvent( ev_fopen, fn.c_str(), "mmap", fd >= 0 );
+    if( fd < 0 ) {
+      return NULL;
+    }
+    struct stat s;
+    if( fstat( fd, &s ) != 0 ) {
+      close( fd );
+      return NULL;
+    }
+    StdMappedFile * m = new StdMappedFile;
+    m->size = int( s.st_size );
+    if( m->size > 0 ) {
+      void * p = mmap( NULL, m->size, PROT_READ, MAP_PRIVATE, fd, 0 );
+      if( p == MAP_FAILED ) {
+        R3_OUTPUT_WARNING( out_fs, "Failed to map %s", fn.c_str() );
+        close( fd );
+        delete m;
+        return NULL;
+      }
+      m->data = static_cast< const uchar * >( p );
+    }
+    // the mapping outlives the descriptor
+    close( fd );
+    f_filesOpened.Incr();
+    return m;
+#else
+    // no mmap, so read it all
+    FILE * fp = Fopen( fn.c_str(), "rb" );
+    if( fp == NULL ) {
+      return NULL;
+    }
+    StdMappedFile * m = new StdMappedFile;
+    fseek( fp, 0, SEEK_END );
+    m->contents.resize( ftell( fp ) );
+    fseek( fp, 0, SEEK_SET );
+    m->size = (int)m->contents.size();
+    if( m->size > 0 ) {
+      f_bytesRead.Add( fread( &m->contents[0], 1, m->size, fp ) );
+      m->data = &m->contents[0];
+    }
+    Fclose( fp );
+    return m;
+#endif
+  }
+  
   bool FindDirectory( VarString & path, const char * dirName ) {
     string dirname = dirName;
 #if ! _WIN32
@@ -444,17 +582,17 @@ namespace {
   bool MakeDirectory( const char * dirName ) {
     assert( dirName );
     vector<Token> tokens = TokenizeString( dirName, "/" );
-    Output( "In MakeDirectory( \"%s\" )", dirName );
+    R3_OUTPUT_VERBOSE( out_fs, "In MakeDirectory( \"%s\" )", dirName );
     string dirname = dirName[0] == '/' ? "/" : "";
     for ( int i = 0; i < (int)tokens.size(); i++ ) {
       dirname += tokens[i].valString;
       //Output( "Checking dir %s", dirname.c_str() );
 #if ! _WIN32
       if ( getFileTimestamp( dirname.c_str() ) == 0.0 ) {
-        Output( "Attempting to create dir %s", dirname.c_str() );
+        R3_OUTPUT_VERBOSE( out_fs, "Attempting to create dir %s", dirname.c_str() );
         int ret = mkdir( dirname.c_str(), 0777 );
         if ( ret != 0 ) {
-          Output( "Failed to create dir %s", dirname.c_str() );
+          R3_OUTPUT_WARNING( out_fs, "Failed to create dir %s", dirname.c_str() );
           return false;
         }
       }
@@ -463,11 +601,11 @@ namespace {
       // figure out current working directory
       HANDLE hDir = FindFirstFileA( dirname.c_str(), &findData );
       if ( hDir == INVALID_HANDLE_VALUE ) {
-        Output( "Attempting to create dir %s", dirname.c_str() );
+        R3_OUTPUT_VERBOSE( out_fs, "Attempting to create dir %s", dirname.c_str() );
         CreateDirectoryA( dirname.c_str(), NULL );
         HANDLE hDir = FindFirstFileA( dirname.c_str(), &findData );
         if ( hDir == INVALID_HANDLE_VALUE ) {
-          Output( "Failed to create dir %s", dirname.c_str() );
+          R3_OUTPUT_WARNING( out_fs, "Failed to create dir %s", dirname.c_str() );
           return false;
         }
       }
@@ -478,35 +616,47 @@ namespace {
     return true;
   }
   
-  struct FileFetchEntry {
-    FileFetchEntry() : notBefore( 0.0 ) {}
-    FileFetchEntry( const string & file_name, double not_before ) : filename( file_name ), notBefore( not_before ) {}
-    string filename;
-    double notBefore;
-  };
-  
-  deque<FileFetchEntry> fetchQueue;
+  // fetchSet holds everything queued or waiting on a timer, fetchQueue
+  // only what the NetCache thread may work on now.
+  deque<string> fetchQueue;
   set<string> fetchSet;
   
-  void PushFileFetch( const string & filename, double notBefore = 0.0 ) {
+  void QueueFileFetch( const string & filename ) {
+    fetchQueue.push_back( filename );
+    fetchSem.Post();
+  }
+  
+  void DelayedFileFetch( void * data ) {
+    string * filename = static_cast< string * >( data );
+    {
+      ScopedMutex scm( filesystemMutex, R3_LOC );
+      QueueFileFetch( *filename );
+    }
+    delete filename;
+  }
+  
+  void PushFileFetch( const string & filename, double delay = 0.0 ) {
     ScopedMutex scm( filesystemMutex, R3_LOC );
-    FileFetchEntry ffe( filename, notBefore );
-    if( fetchSet.count( ffe.filename ) ) {
-      Output( "PushFileFetch: Already have %s", ffe.filename.c_str() );
+    if( fetchSet.count( filename ) ) {
+      R3_OUTPUT_VERBOSE( out_net, "PushFileFetch: Already have %s", filename.c_str() );
       return;
     }
     fetchSet.insert( filename );
-    fetchQueue.push_back( ffe );
+    if( delay > 0.0 ) {
+      ScheduleTimer( delay, DelayedFileFetch, new string( filename ) );
+    } else {
+      QueueFileFetch( filename );
+    }
   }
   
-  bool PopFileFetch( FileFetchEntry & ffe ) {
+  bool PopFileFetch( string & filename ) {
     ScopedMutex scm( filesystemMutex, R3_LOC );
     if( fetchQueue.size() == 0 ) {
       return false;
     }
-    ffe = fetchQueue.front();
+    filename = fetchQueue.front();
     fetchQueue.pop_front();
-    fetchSet.erase( ffe.filename );
+    fetchSet.erase( filename );
     return true;
   }
   
@@ -526,7 +676,7 @@ namespace {
     }
     string fn = path + filename;
     FILE * fp = Fopen( fn.c_str(), "wb" );
-    Output( "Opening file %s for write %s", fn.c_str(), fp ? "succeeded" : "failed" );
+    R3_OUTPUT_VERBOSE( out_fs, "Opening file %s for write %s", fn.c_str(), fp ? "succeeded" : "failed" );
     if ( fp ) {
       StdCFile * F = new StdCFile( fn, true );
       F->fp = fp;
@@ -536,17 +686,16 @@ namespace {
     return NULL;
   }
   
-  double lastCacheRefresh = 0;
-  void RefreshCache() {
-    map<string,ManifestInfo> m;
+  // periodic timer callback
+  TimerId refreshTimer = InvalidTimerId;
+  void RefreshCache( void * ) {
+    ManifestMap m;
     {
       ScopedMutex scm( filesystemMutex, R3_LOC );
       m = manifest;
     }
-    double t = GetTime();
-    lastCacheRefresh = t;
-    for( map<string,ManifestInfo>::iterator i = m.begin(); i != m.end(); ++i ) {
-      PushFileFetch( i->first, t );
+    for( ManifestMap::iterator i = m.begin(); i != m.end(); ++i ) {
+      PushFileFetch( i->first );
     }
   }
   
@@ -561,40 +710,27 @@ namespace {
 		void Run() {
       int count = 0;
 			while( ++count ) {
-        filesystemCond.Wait();
-        FileFetchEntry ffe;
-        double t = GetTime();
-        if( PopFileFetch( ffe ) == false ) {
-          if( ( t - lastCacheRefresh ) > CACHE_REFRESH_INTERVAL ) {
-            RefreshCache();
-          }
-          continue;
-        }
+        fetchSem.Wait();
         string file;
-        {
-          if( t < ffe.notBefore ) {
-            PushFileFetch( ffe.filename, ffe.notBefore );
-            continue;
-          }
-          file = ffe.filename;
-          if( file.size() == 0 ) {
-            continue;
-          }
+        if( PopFileFetch( file ) == false || file.size() == 0 ) {
+          continue;
         }
+        double t = GetTime();
         vector<Token> urls = TokenizeString( f_netPath.GetVal().c_str(), ";" );
         ManifestInfo mi = GetManifestInfo( file );
         if( mi.url == "local" ) {
           continue;
         }
         if( ( t - mi.lastTry ) < CACHE_REFRESH_INTERVAL ) {
-          Output( "NetCache - skipping %s, last try only %.0lf minutes ago", file.c_str(), (t - mi.lastTry ) / 60 );
+          R3_OUTPUT_VERBOSE( out_net, "NetCache - skipping %s, last try only %.0lf minutes ago", file.c_str(), (t - mi.lastTry ) / 60 );
           continue;
         }
-        Output( "NetCache looking for %s", file.c_str() );
+        R3_OUTPUT_INFO( out_net, "NetCache looking for %s", file.c_str() );
         mi.lastTry = t;
+        bool fetched = false;
         for( int i = 0; i < urls.size(); i++ ) {
           string url = urls[i].valString;
-          Output( "NetCache trying %s -  %s", url.c_str(), file.c_str() );
+          R3_OUTPUT_VERBOSE( out_net, "NetCache trying %s -  %s", url.c_str(), file.c_str() );
           vector<uchar> data;
           map<string,string> header;
           if( url == mi.url && mi.etag.size() ) {
@@ -602,6 +738,8 @@ namespace {
           }
           if( UrlReadToMemory( url + '/' + file, data, header ) ) {
             mi.url = url;
+            fetched = true;
+            LogEvent( ev_netFetch, file, url, (int)data.size() );
             if( header.count( "Last-Modified" ) ) {
               mi.lastModified = header["Last-Modified"];
             }
@@ -619,6 +757,9 @@ namespace {
             break;
           }
         }
+        if( fetched == false ) {
+          LogEvent( ev_netFetchFailed, file );
+        }
         GetManifestInfo( file ) = mi;
       }
     }
@@ -644,7 +785,7 @@ namespace {
     }
     string fn = path + filename;
     FILE * fp = Fopen( fn.c_str(), "rb" );
-    Output( "Opening file %s for read %s", fn.c_str(), fp ? "succeeded" : "failed" );
+    R3_OUTPUT_VERBOSE( out_fs, "Opening file %s for read %s", fn.c_str(), fp ? "succeeded" : "failed" );
     if ( fp ) {
       StdCFile * F = new StdCFile( fn, true );
       F->fp = fp;
@@ -655,9 +796,14 @@ namespace {
 
   File * CachedFileOpenForRead( const string & inFileName ) {
     File *fp = CachedFileOpenForPrivateRead( inFileName );
+    if( fp ) {
+      f_cacheHits.Incr();
+    } else {
+      f_cacheMisses.Incr();
+    }
     if( inFileName != "CacheManifest.json" ) {
       string filename = NormalizePathSeparator( inFileName );
-      PushFileFetch( filename, GetTime() + CACHE_FETCH_DELAY );
+      PushFileFetch( filename, CACHE_FETCH_DELAY );
     }
     return fp;
   }
@@ -679,17 +825,22 @@ namespace r3 {
     if( MakeDirectory( f_cachePath.GetVal().c_str() ) == false ) {
       exit( 1 );
     }
-    lastCacheRefresh = GetTime() + 120.0;
     ReadCacheManifest();
+    refreshTimer = ScheduleTimer( CACHE_REFRESH_INTERVAL + 120.0, RefreshCache, NULL, CACHE_REFRESH_INTERVAL );
     netCacheThread.Start();
   }
   
   void ShutdownFilesystem() {
+    if( refreshTimer != InvalidTimerId ) {
+      CancelTimer( refreshTimer );
+      refreshTimer = InvalidTimerId;
+    }
     WriteCacheManifest();
   }
   
+  // Fetches and cache refreshes are driven by the timer service now, so
+  // there is nothing left to do per tick.
   void TickFilesystem() {
-    filesystemCond.Broadcast();
   }
   
   bool CacheUpdated() { return f_cacheUpdated.GetVal(); }
@@ -713,7 +864,7 @@ namespace r3 {
     {
       string fn = f_basePath.GetVal() + filename;
       FILE * fp = Fopen( fn.c_str(), "rb" );
-      Output( "Opening file %s for read %s", fn.c_str(), fp ? "succeeded" : "failed" );
+      R3_OUTPUT_VERBOSE( out_fs, "Opening file %s for read %s", fn.c_str(), fp ? "succeeded" : "failed" );
       if ( fp ) {
         StdCFile * F = new StdCFile( fn, false);
         F->fp = fp;
@@ -730,7 +881,7 @@ namespace r3 {
       }
       string fn = f_basePath.GetVal() + filename;
       FILE * fp = Fopen( fn.c_str(), "rb" );
-      Output( "Opening file %s for read %s", fn.c_str(), fp ? "succeeded" : "failed" );
+      R3_OUTPUT_VERBOSE( out_fs, "Opening file %s for read %s", fn.c_str(), fp ? "succeeded" : "failed" );
       if ( fp ) {
         StdCFile * F = new StdCFile(fn, false);
         F->fp = fp;
@@ -796,6 +947,65 @@ namespace r3 {
   }
   
   
+  MappedFile * FileMapForRead( const string & inFileName ) {
+    string filename = NormalizePathSeparator( inFileName );
+    string path = f_cachePath.GetVal();
+    if( path.size() && filename.size() && filename[0] != '/' ) {
+      MappedFile * m = MapFile( path + filename );
+      if( m ) {
+        f_cacheHits.Incr();
+        return m;
+      }
+      f_cacheMisses.Incr();
+    }
+    return MapFile( f_basePath.GetVal() + filename );
+  }
+  
+  string FileMd5( const string & inFileName ) {
+    string filename = NormalizePathSeparator( inFileName );
+    {
+      ScopedMutex scm( filesystemMutex, R3_LOC );
+      ManifestMap::iterator it = manifest.find( filename );
+      if( it != manifest.end() && it->second.md5.size() ) {
+        return it->second.md5;
+      }
+    }
+    // mapped rather than opened, so asking never queues a net fetch
+    MappedFile * m = FileMapForRead( filename );
+    if( m == NULL ) {
+      return string();
+    }
+    string md5 = ComputeMd5Sum( m->Data(), m->Size() );
+    delete m;
+    return md5;
+  }
+  
+  string FileVersionKey( const string & inFileName ) {
+    string filename = NormalizePathSeparator( inFileName );
+    {
+      ScopedMutex scm( filesystemMutex, R3_LOC );
+      ManifestMap::iterator it = manifest.find( filename );
+      if( it != manifest.end() && it->second.md5.size() ) {
+        return it->second.md5;
+      }
+    }
+    // the same copy FileMapForRead would pick
+    string path = f_cachePath.GetVal();
+    string fn;
+    int64 size = 0, mtime = 0;
+    if( path.size() && filename.size() && filename[0] != '/' && StatFile( path + filename, size, mtime ) ) {
+      fn = path + filename;
+    } else if( StatFile( f_basePath.GetVal() + filename, size, mtime ) ) {
+      fn = f_basePath.GetVal() + filename;
+    } else {
+      return string();
+    }
+    char stamp[64];
+    r3Sprintf( stamp, "\n%lld\n%lld", (long long)size, (long long)mtime );
+    string key = fn + stamp;
+    return ComputeMd5Sum( key.c_str(), (int)key.size() );
+  }
+  
   string File::ReadLine() {
     string ret;
     char s[256];
@@ -45,8 +45,12 @@
 #include "r3/common.h"
 #include "r3/draw.h"
 #include "r3/filesystem.h"
+#include "r3/glstate.h"
 #include "r3/font.h"
+#include "r3/memory.h"
+#include "r3/metrics.h"
 #include "r3/output.h"
+#include "r3/profile.h"
 #include "r3/texture.h"
 
 #include <GL/Regal.h>
@@ -69,6 +73,9 @@ using namespace r3;
 
 #include <stdio.h>
 
+MetricCounter font_glyphEvictions( "font_glyphEvictions", "Number of glyphs evicted from font caches." );
+MemoryTag mem_font( "font", "Budget in KB for loaded TTF files, 0 for none." );
+
 namespace {
 	
 	struct FontDatabase {
@@ -304,7 +311,7 @@ namespace {
 			float lineGap;
 			float scale;
 			bool reverse;
-			vector<uchar> ttf;  // contents of the ttf file
+			vector< uchar, TrackedAllocator< uchar, mem_font > > ttf;  // contents of the ttf file
 		};
     
 		vector<FontData> fv;
@@ -419,6 +426,8 @@ namespace {
 			g.lastUsed = usageCount++;
 			return g; // return the hit
 		}
+		// only the miss is worth profiling, hits happen per character per frame
+		R3_PROFILE( "StbCachedGlyphFont::GetGlyph" );
 		
 		for( int i = 0; i < fv.size(); i++ ) {
 			stbtt_fontinfo & font = fv[i].font;
@@ -460,6 +469,7 @@ namespace {
 				}
 				MarkGlyph( victim, false ); // clear used bits
 				gm.erase( victim );
+				font_glyphEvictions.Incr();
 			}
 			CachedGlyph & g = gm[ idx ];
 			g.reverse = reverse;
@@ -570,7 +580,6 @@ namespace {
 		ftex->Enable( 0 );
 		TexEnvCombineAlpha( 0 );
 		
-    glBegin( GL_QUADS );
 		vector<int> uc;
 		UnescapeUnicode( text, uc );
 		bool reverse = false;
@@ -587,10 +596,9 @@ namespace {
 		for ( int i = 0; i < (int)uc.size(); i++ ) {
 			int c = uc[i];
 			GlyphQuad q = GetGlyphQuad( GetGlyph( c ), imgSize, imgSize, &x, y, scale );
-			ImTexturedQuad( q.x0, q.y0, q.x1, q.y1, q.s0, q.t0, q.s1, q.t1 );
+			DrawTexturedQuad( q.x0, q.y0, q.x1, q.y1, q.s0, q.t0, q.s1, q.t1 );
 		}
-    glEnd();
-    glTexEnvi( GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE );
+    StateTexEnv( 0, GL_TEXTURE_ENV_MODE, GL_MODULATE );
 		ftex->Disable( 0 );
 	}
 	
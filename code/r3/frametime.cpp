@@ -0,0 +1,143 @@
+/*
+ *  frametime
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#include "r3/frametime.h"
+
+#include "r3/command.h"
+#include "r3/eventlog.h"
+#include "r3/output.h"
+#include "r3/thread.h"
+#include "r3/time.h"
+#include "r3/var.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace std;
+using namespace r3;
+
+// Upper bound on fr_window.
+#define FRAME_TIME_MAX_WINDOW 4096
+
+VarInteger fr_window( "fr_window", "Number of frames in the rolling frame time statistics.", Var_Archive, 240 );
+
+namespace {
+	
+	EventFormat ev_frame( "frame %u %.3f ms" );
+	
+	Mutex frameMutex;
+	uint64 lastTick;
+	uint frameNumber;
+	// ring of the most recent frame times, in milliseconds
+	vector< float > frameTimes;
+	int frameTimesPos;
+	int frameTimesCount;
+	
+	void FrameStats( const vector< Token > & tokens ) {
+		FrameTimeStats s = GetFrameTimeStats();
+		if( s.frames == 0 ) {
+			Output( "No frames timed yet." );
+			return;
+		}
+		Output( "%d frames: last %.2f min %.2f avg %.2f max %.2f p50 %.2f p95 %.2f p99 %.2f ms (%.1f fps)",
+		       s.frames, s.last, s.min, s.avg, s.max, s.p50, s.p95, s.p99, 1000.0f / s.avg );
+	}
+	CommandFunc FrameStatsCmd( "framestats", "prints rolling frame time statistics", FrameStats );
+	
+	float Percentile( const vector< float > & sorted, float p ) {
+		int i = int( p * ( sorted.size() - 1 ) + 0.5f );
+		return sorted[ i ];
+	}
+	
+}
+
+namespace r3 {
+	
+	void TickFrameTime() {
+		uint64 now = GetMonotonicNanoseconds();
+		ScopedMutex m( frameMutex, R3_LOC );
+		if( lastTick != 0 ) {
+			float ms = float( ( now - lastTick ) * 1e-6 );
+			int window = max( 1, min( fr_window.GetVal(), FRAME_TIME_MAX_WINDOW ) );
+			if( (int)frameTimes.size() != window ) {
+				frameTimes.assign( window, 0.0f );
+				frameTimesPos = 0;
+				frameTimesCount = 0;
+			}
+			frameTimes[ frameTimesPos ] = ms;
+			frameTimesPos = ( frameTimesPos + 1 ) % window;
+			frameTimesCount = min( frameTimesCount + 1, window );
+			LogEvent( ev_frame, frameNumber, ms );
+		}
+		lastTick = now;
+		frameNumber++;
+	}
+	
+	FrameTimeStats GetFrameTimeStats() {
+		FrameTimeStats s;
+		vector< float > sorted;
+		{
+			ScopedMutex m( frameMutex, R3_LOC );
+			if( frameTimesCount == 0 ) {
+				return s;
+			}
+			int window = (int)frameTimes.size();
+			s.last = frameTimes[ ( frameTimesPos + window - 1 ) % window ];
+			sorted.assign( frameTimes.begin(), frameTimes.begin() + frameTimesCount );
+		}
+		sort( sorted.begin(), sorted.end() );
+		float sum = 0.0f;
+		for( int i = 0; i < (int)sorted.size(); i++ ) {
+			sum += sorted[ i ];
+		}
+		s.frames = (int)sorted.size();
+		s.min = sorted.front();
+		s.max = sorted.back();
+		s.avg = sum / s.frames;
+		s.p50 = Percentile( sorted, 0.50f );
+		s.p95 = Percentile( sorted, 0.95f );
+		s.p99 = Percentile( sorted, 0.99f );
+		return s;
+	}
+	
+}
@@ -0,0 +1,451 @@
+/*
+ *  glstate
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#include "r3/glstate.h"
+
+#include "r3/output.h"
+#include "r3/var.h"
+
+#include <string.h>
+
+using namespace std;
+using namespace r3;
+
+namespace r3 {
+	VarBool r_stateCache( "r_stateCache", "Drop GL state calls that would not change the current state.", 0, true );
+}
+
+namespace {
+	
+	bool initialized = false;
+	
+	const GLuint Unknown = ~0u;
+	
+	// units and targets outside these ranges are passed through uncached
+	const int MaxUnits = 8;
+	const int MaxTargets = 4;
+	const int MaxEnvParams = 16;
+	const int MaxCaps = 16;
+	
+	// array slots: 0-15 generic, 16-18 fixed function, 19-22 texture coordinates
+	const int MaxArrays = 23;
+	const uint AllArrays = ( 1 << MaxArrays ) - 1;
+	const GLenum ClientArrays[] = { GL_VERTEX_ARRAY, GL_NORMAL_ARRAY, GL_COLOR_ARRAY };
+	
+	enum Tristate { Off, On, Unset };
+	
+	struct ArrayPointer {
+		GLuint buffer;
+		GLint size;
+		GLenum type;
+		GLboolean normalized;
+		GLsizei stride;
+		const GLvoid * pointer;
+		bool operator == ( const ArrayPointer & rhs ) const {
+			return buffer == rhs.buffer && size == rhs.size && type == rhs.type &&
+			normalized == rhs.normalized && stride == rhs.stride && pointer == rhs.pointer;
+		}
+	};
+	
+	struct EnvParam {
+		GLenum pname;
+		GLint param;
+	};
+	
+	struct CapState {
+		GLenum cap;
+		char enabled;
+	};
+	
+	struct ShadowState {
+		GLuint arrayBuffer;
+		GLuint elementBuffer;
+		GLuint program;
+		GLenum blendSrc;
+		GLenum blendDst;
+		CapState caps[ MaxCaps ];
+		int capCount;
+		GLuint textures[ MaxUnits ][ MaxTargets ];
+		char textureEnabled[ MaxUnits ][ MaxTargets ];
+		EnvParam texEnv[ MaxUnits ][ MaxEnvParams ];
+		int texEnvCount[ MaxUnits ];
+		uint arrays;      // enabled arrays
+		uint arraysKnown; // arrays whose bit in arrays is trustworthy
+		ArrayPointer pointers[ MaxArrays ];
+		uchar color[4];   // r3's current color, kept across Invalidate
+		bool colorKnown;  // GL's current color is color
+		
+		void Invalidate() {
+			colorKnown = false;
+			arrayBuffer = elementBuffer = program = Unknown;
+			blendSrc = blendDst = Unknown;
+			capCount = 0;
+			for( int u = 0; u < MaxUnits; u++ ) {
+				for( int t = 0; t < MaxTargets; t++ ) {
+					textures[ u ][ t ] = Unknown;
+					textureEnabled[ u ][ t ] = Unset;
+				}
+				texEnvCount[ u ] = 0;
+			}
+			arrays = 0;
+			arraysKnown = 0;
+			for( int i = 0; i < MaxArrays; i++ ) {
+				pointers[ i ].buffer = Unknown;
+			}
+		}
+	};
+	ShadowState s;
+	const uchar White[4] = { 255, 255, 255, 255 };
+	StateChangeFunc stateChangeFunc = NULL;
+	
+	// true when the call can be dropped
+	inline bool Skip( bool same ) {
+		return same && r_stateCache.GetVal();
+	}
+	
+	// First thing in every State* call.  The hook draws through State* calls
+	// itself, so it has to run before the shadow state is read or updated,
+	// or the outer call would act on state the hook has since changed.
+	inline void Changing() {
+		if( stateChangeFunc ) {
+			stateChangeFunc();
+		}
+	}
+	
+	int TargetSlot( GLenum target ) {
+		switch( target ) {
+			case GL_TEXTURE_1D: return 0;
+			case GL_TEXTURE_2D: return 1;
+			case GL_TEXTURE_3D: return 2;
+			case GL_TEXTURE_CUBE_MAP: return 3;
+			default: break;
+		}
+		return -1;
+	}
+	
+	int ArraySlot( GLuint index ) {
+		if( index < 16 ) {
+			return index;
+		}
+		switch( index ) {
+			case GL_VERTEX_ARRAY: return 16;
+			case GL_NORMAL_ARRAY: return 17;
+			case GL_COLOR_ARRAY: return 18;
+			case GL_TEXTURE0:
+			case GL_TEXTURE1:
+			case GL_TEXTURE2:
+			case GL_TEXTURE3:
+				return 19 + index - GL_TEXTURE0;
+			default:
+				break;
+		}
+		return -1;
+	}
+	
+	void SetArray( int slot, bool enable ) {
+		if( slot < 16 ) {
+			if( enable ) {
+				glEnableVertexAttribArray( slot );
+			} else {
+				glDisableVertexAttribArray( slot );
+			}
+		} else if( slot < 19 ) {
+			if( enable ) {
+				glEnableClientState( ClientArrays[ slot - 16 ] );
+			} else {
+				glDisableClientState( ClientArrays[ slot - 16 ] );
+			}
+		} else {
+			if( enable ) {
+				glEnableClientStateIndexedEXT( GL_TEXTURE_COORD_ARRAY, slot - 19 );
+			} else {
+				glDisableClientStateIndexedEXT( GL_TEXTURE_COORD_ARRAY, slot - 19 );
+			}
+		}
+	}
+	
+}
+
+namespace r3 {
+	
+	void InitGLState() {
+		if( initialized ) {
+			return;
+		}
+		Output( "Initializing r3::GLState." );
+		s.Invalidate();
+		memcpy( s.color, White, sizeof( s.color ) );
+		initialized = true;
+	}
+	
+	void ShutdownGLState() {
+		if( ! initialized ) {
+			return;
+		}
+		Output( "Shutting down r3::GLState." );
+		s.Invalidate();
+		initialized = false;
+	}
+	
+	void InvalidateGLState() {
+		s.Invalidate();
+	}
+	
+	void SetStateChangeFunc( StateChangeFunc func ) {
+		stateChangeFunc = func;
+	}
+	
+	void StateEnable( GLenum cap, bool enable ) {
+		Changing();
+		char e = enable ? On : Off;
+		int i = 0;
+		while( i < s.capCount && s.caps[ i ].cap != cap ) {
+			i++;
+		}
+		if( i < s.capCount ) {
+			if( Skip( s.caps[ i ].enabled == e ) ) {
+				return;
+			}
+			s.caps[ i ].enabled = e;
+		} else if( s.capCount < MaxCaps ) {
+			s.caps[ i ].cap = cap;
+			s.caps[ i ].enabled = e;
+			s.capCount++;
+		}
+		if( enable ) {
+			glEnable( cap );
+		} else {
+			glDisable( cap );
+		}
+	}
+	
+	void StateBlendFunc( GLenum src, GLenum dst ) {
+		Changing();
+		if( Skip( s.blendSrc == src && s.blendDst == dst ) ) {
+			return;
+		}
+		s.blendSrc = src;
+		s.blendDst = dst;
+		glBlendFunc( src, dst );
+	}
+	
+	void StateBindBuffer( GLenum target, GLuint buffer ) {
+		Changing();
+		GLuint * bound = NULL;
+		switch( target ) {
+			case GL_ARRAY_BUFFER: bound = &s.arrayBuffer; break;
+			case GL_ELEMENT_ARRAY_BUFFER: bound = &s.elementBuffer; break;
+			default: break;
+		}
+		if( bound ) {
+			if( Skip( *bound == buffer ) ) {
+				return;
+			}
+			*bound = buffer;
+		}
+		glBindBuffer( target, buffer );
+	}
+	
+	void StateBindTexture( int unit, GLenum target, GLuint texture ) {
+		Changing();
+		int t = TargetSlot( target );
+		if( unit < MaxUnits && t >= 0 ) {
+			if( Skip( s.textures[ unit ][ t ] == texture ) ) {
+				return;
+			}
+			s.textures[ unit ][ t ] = texture;
+		}
+		glBindMultiTextureEXT( GL_TEXTURE0 + unit, target, texture );
+	}
+	
+	void StateEnableTexture( int unit, GLenum target, bool enable ) {
+		Changing();
+		int t = TargetSlot( target );
+		if( unit < MaxUnits && t >= 0 ) {
+			char e = enable ? On : Off;
+			if( Skip( s.textureEnabled[ unit ][ t ] == e ) ) {
+				return;
+			}
+			s.textureEnabled[ unit ][ t ] = e;
+		}
+		if( enable ) {
+			glEnableIndexedEXT( target, unit );
+		} else {
+			glDisableIndexedEXT( target, unit );
+		}
+	}
+	
+	void StateTexEnv( int unit, GLenum pname, GLint param ) {
+		Changing();
+		if( unit < MaxUnits ) {
+			EnvParam * env = s.texEnv[ unit ];
+			int & count = s.texEnvCount[ unit ];
+			int i = 0;
+			while( i < count && env[ i ].pname != pname ) {
+				i++;
+			}
+			if( i < count ) {
+				if( Skip( env[ i ].param == param ) ) {
+					return;
+				}
+				env[ i ].param = param;
+			} else if( count < MaxEnvParams ) {
+				env[ count ].pname = pname;
+				env[ count ].param = param;
+				count++;
+			}
+		}
+		glMultiTexEnviEXT( GL_TEXTURE0 + unit, GL_TEXTURE_ENV, pname, param );
+	}
+	
+	void StateUseProgram( GLuint program ) {
+		Changing();
+		if( Skip( s.program == program ) ) {
+			return;
+		}
+		s.program = program;
+		glUseProgram( program );
+	}
+	
+	void StateColor( uchar r, uchar g, uchar b, uchar a ) {
+		uchar c[4] = { r, g, b, a };
+		if( Skip( s.colorKnown && memcmp( s.color, c, sizeof( c ) ) == 0 ) ) {
+			return;
+		}
+		memcpy( s.color, c, sizeof( c ) );
+		s.colorKnown = true;
+		glColor4ub( r, g, b, a );
+	}
+	
+	const uchar * GetStateColor() {
+		return s.color;
+	}
+	
+	void StateForgetColor() {
+		s.colorKnown = false;
+	}
+	
+	void StateLoadMatrix( GLenum mode, const float * m ) {
+		Changing();
+		glMatrixMode( mode );
+		glLoadMatrixf( m );
+	}
+	
+	uint StateArrayBit( GLuint index ) {
+		int slot = ArraySlot( index );
+		return slot >= 0 ? 1 << slot : 0;
+	}
+	
+	void StateEnableArrays( uint mask ) {
+		Changing();
+		uint touch = ( mask | s.arrays | ~s.arraysKnown ) & AllArrays;
+		if( r_stateCache.GetVal() ) {
+			touch &= ( mask ^ s.arrays ) | ~s.arraysKnown;
+		}
+		for( int slot = 0; touch; slot++, touch >>= 1 ) {
+			if( touch & 1 ) {
+				SetArray( slot, ( mask & ( 1 << slot ) ) != 0 );
+			}
+		}
+		s.arrays = mask;
+		s.arraysKnown = AllArrays;
+	}
+	
+	void StateArrayPointer( GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid * pointer ) {
+		Changing();
+		int slot = ArraySlot( index );
+		if( slot < 0 ) {
+			return;
+		}
+		ArrayPointer p = { s.arrayBuffer, size, type, normalized, stride, pointer };
+		if( Skip( s.arrayBuffer != Unknown && s.pointers[ slot ] == p ) ) {
+			return;
+		}
+		s.pointers[ slot ] = p;
+		switch( slot ) {
+			case 16: glVertexPointer( size, type, stride, pointer ); break;
+			case 17: glNormalPointer( type, stride, pointer ); break;
+			case 18: glColorPointer( size, type, stride, pointer ); break;
+			default:
+				if( slot < 16 ) {
+					glVertexAttribPointer( index, size, type, normalized, stride, pointer );
+				} else {
+					glMultiTexCoordPointerEXT( index, size, type, stride, pointer );
+				}
+				break;
+		}
+	}
+	
+	void StateForgetBuffer( GLuint buffer ) {
+		if( s.arrayBuffer == buffer ) {
+			s.arrayBuffer = 0;
+		}
+		if( s.elementBuffer == buffer ) {
+			s.elementBuffer = 0;
+		}
+		// the name can come back from glGenBuffers
+		for( int i = 0; i < MaxArrays; i++ ) {
+			if( s.pointers[ i ].buffer == buffer ) {
+				s.pointers[ i ].buffer = Unknown;
+			}
+		}
+	}
+	
+	void StateForgetTexture( GLuint texture ) {
+		for( int u = 0; u < MaxUnits; u++ ) {
+			for( int t = 0; t < MaxTargets; t++ ) {
+				if( s.textures[ u ][ t ] == texture ) {
+					s.textures[ u ][ t ] = 0;
+				}
+			}
+		}
+	}
+	
+	void StateForgetProgram( GLuint program ) {
+		// a deleted program stays current until something else is used
+		if( s.program == program ) {
+			s.program = Unknown;
+		}
+	}
+	
+}
@@ -42,8 +42,10 @@ Cass Everitt
 
 #include "r3/http.h"
 
+#include "r3/metrics.h"
 #include "r3/output.h"
 #include "r3/parse.h"
+#include "r3/profile.h"
 #include "r3/socket.h"
 #include "r3/time.h"
 
@@ -58,6 +60,9 @@ Cass Everitt
 using namespace std;
 using namespace r3;
 
+OutputCategory out_http( "http", "Output level for http requests, -1 to use out_level." );
+MetricCounter http_requests( "http_requests", "Number of http requests made." );
+MetricHistogram http_latency( "http_latency", "Time taken by http requests, including the body." );
 
 namespace {
 
@@ -143,6 +148,7 @@ namespace {
 						return;
 					}
 					p = p * 10 + digit;
+					url.erase( 0, 1 );
 				}
 				port = p;
 				if ( p != int( port ) ) {
@@ -338,6 +344,9 @@ namespace r3 {
   }
   
   bool UrlReadToMemory( const string & urlString, vector< uchar > & data, map<string, string> & header ) {
+		R3_PROFILE( "UrlReadToMemory" );
+		http_requests.Incr();
+		ScopedMetricTimer timer( http_latency );
 		data.clear();
 		UniformResourceLocator u( urlString );
 		if ( u.protocol == UrlProtocol_INVALID ) {
@@ -358,25 +367,21 @@ namespace r3 {
       r3Sprintf( buf, "GET %s HTTP/1.1\r\nIf-None-Match: \"%s\"\r\nHost: %s:%d\r\n\r\n", u.path.c_str(), header["etag"].c_str(), u.hostname.c_str(), u.port );
     }
 		sz = (int)strlen( buf );
-		Output( "Sending http request (%d chars): %s", sz, buf );
+		R3_OUTPUT_VERBOSE( out_http, "Sending http request (%d chars): %s", sz, buf );
 		sock.Write( buf, sz );
 		InputStream is( sock );
 
     // add If-None-Match with etag in the header....
-    int read_try_count = 5;
-    while( read_try_count > 0 && sock.CanRead() == false ) {
-      SleepMilliseconds( 500 );
-      read_try_count--;
-    }
-    if( read_try_count == 0 ) {
-      Output( "Socket read for %s timed out.", urlString.c_str() );
+    // wait in select rather than sleeping, so a quick reply is read right away
+    if( sock.CanRead( 2.5 ) == false ) {
+      R3_OUTPUT_WARNING( out_http, "Socket read for %s timed out.", urlString.c_str() );
       sock.Disconnect();
       return false;
     }
 
 		HttpResponse resp ( is );
     if( resp.code == 404 || resp.code == 304 ) {
-      Output( "Http exiting read with code %d", resp.code );
+      R3_OUTPUT_VERBOSE( out_http, "Http exiting read with code %d", resp.code );
       sock.Disconnect();
       return false;
     }
@@ -392,7 +397,7 @@ namespace r3 {
 		int bytes = resp.GetInt("Content-Length");
 		if ( bytes > 0 ) { // not chunked - single payload
 			int r = is.Read( bytes, data );
-			Output( "content length = %d, and read = %d", bytes, r );
+			R3_OUTPUT_VERBOSE( out_http, "content length = %d, and read = %d", bytes, r );
 		} else if ( resp.GetString( "Transfer-Encoding" ).find( "chunked" )  != string::npos ) { // chunks
 			while( 1 ) {
 				string chunkHeader = is.GetLine();
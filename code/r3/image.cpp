@@ -43,7 +43,9 @@
 
 #include "r3/image.h"
 #include "r3/filesystem.h"
+#include "r3/memory.h"
 #include "r3/output.h"
+#include "r3/profile.h"
 
 
 #include <string.h>
@@ -61,7 +63,10 @@ using namespace r3;
 
 namespace r3 {
 
+	MemoryTag mem_image( "image", "Budget in KB for CPU copies of images, 0 for none." );
+
 	Image<unsigned char> * ReadImageFile( const std::string & filename, int desiredComponents ) {
+		R3_PROFILE( "ReadImageFile" );
 		
 		vector< unsigned char > v;
 		if ( FileReadToMemory( filename, v ) == false || v.size() <= 0 ) {
@@ -76,7 +81,12 @@ namespace r3 {
 		int components;
 		unsigned char *d = stbi_load_from_memory(& v[0], (int)v.size(), &width, &height, &components, desiredComponents); 
 		c = max( desiredComponents, components );
-        img->SetSize( width, height, c );
+        if ( d == NULL || img->SetSize( width, height, c ) == false ) {
+			Output( "Unable to load %s", filename.c_str() );
+			stbi_image_free( d );
+			delete img;
+			return NULL;
+		}
         unsigned char * data = img->data;
 		int pitch = width * c;
 		for ( int j = 0; j < height; j++ ) {
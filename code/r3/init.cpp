@@ -43,15 +43,22 @@
 
 #include "r3/command.h"
 #include "r3/console.h"
+#include "r3/eventlog.h"
 #include "r3/filesystem.h"
+#include "r3/frametime.h"
 #include "r3/output.h"
+#include "r3/timer.h"
 #include "r3/var.h"
 
 #if R3_HAS_GL
 #include "r3/buffer.h"
 #include "r3/draw.h"
 #include "r3/font.h"
+#include "r3/glstate.h"
 #include "r3/model.h"
+#if R3_NULL_GL
+#include "r3/nullgl.h"
+#endif
 #include "r3/shader.h"
 #include "r3/texture.h"
 #endif
@@ -84,7 +91,9 @@ namespace r3 {
       ExecuteCommand( commands[ i ].c_str() );
     }
     Output( "end   Command Line directives ----------------" );
+    InitTimer();
     InitFilesystem();
+    InitEventLog();
     extern VarString f_basePath;
     if ( f_basePath.GetVal().size() == 0 ) {
       OutputDebug( "Unable to initialize f_basePath, exiting." );			
@@ -95,13 +104,19 @@ namespace r3 {
     ExecuteCommand( "readbindings default" );
     ExecuteCommand( "readvars" );
 #if R3_HAS_GL
+#if R3_NULL_GL
+    InitNullGL();
+#endif
+    InitGLState();
     InitBuffer();
     InitDraw();
     InitFont();
     InitModel();
     InitShader();
     InitTexture();
+#if R3_HAS_CONSOLE
     InitConsole();
+#endif
 #endif
   }
 
@@ -109,15 +124,36 @@ namespace r3 {
     
   void Shutdown() {
 #if R3_HAS_GL
+#if R3_HAS_CONSOLE
     ShutdownConsole();
+#endif
     ShutdownFont();
     ShutdownModel();
     ShutdownTexture();
     ShutdownShader();
     ShutdownDraw();
     ShutdownBuffer();
+    ShutdownGLState();
+#if R3_NULL_GL
+    ShutdownNullGL();
+#endif
 #endif
+    ShutdownEventLog();
     ShutdownFilesystem();
+    ShutdownTimer();
+    FlushOutput();
+  }
+
+  void EndFrame() {
+#if R3_HAS_GL
+    // quads still queued belong to this frame, not the next
+    FlushQuads();
+    EndBufferFrame();
+#if R3_NULL_GL
+    NullGLEndFrame();
+#endif
+#endif
+    TickFrameTime();
   }
 
 }
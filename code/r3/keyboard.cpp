@@ -9,6 +9,7 @@
 #include "r3/bounds.h"
 #include "r3/draw.h"
 #include "r3/font.h"
+#include "r3/glstate.h"
 #include "r3/var.h"
 #include <GL/Regal.h>
 
@@ -202,7 +203,8 @@ namespace r3 {
 
 	void SimpleKeyboard::Draw()	{
 
-		glColor4f( .4f, .4f, .4f, 1 );
+		FlushQuads(); // the outline is immediate mode
+		StateColor( 102, 102, 102, 255 );
 		
 		Bounds2f b = GetBounds( keys );
         glBegin( GL_LINE_STRIP );
@@ -215,11 +217,9 @@ namespace r3 {
 		
 		circle->Bind( 0 );
 		circle->Enable( 0 );
-        glEnable( GL_BLEND );
+        StateEnable( GL_BLEND, true );
 
-		glColor4f( .4f, .4f, .4f, 1 );
 			
-        glBegin( GL_QUADS );
 		for ( int i = 0; i < (int)keys.size(); i++ ) {
 			Bounds2f b = keys[i].bounds;
 			float radius = 8;
@@ -253,26 +253,19 @@ namespace r3 {
 					
 			for( int i = 0; i < 3; i++ ) {
 				for( int j = 0; j < 3; j++ ) {
-                    glMultiTexCoord2f( GL_TEXTURE0, ft[ i + 0 ], ft[ j + 0 ] );
-					glVertex2f( fi[ i + 0 ], fj[ j + 0 ] );
-					glMultiTexCoord2f( GL_TEXTURE0, ft[ i + 1 ], ft[ j + 0 ] );
-					glVertex2f( fi[ i + 1 ], fj[ j + 0 ] );
-					glMultiTexCoord2f( GL_TEXTURE0, ft[ i + 1 ], ft[ j + 1 ] );
-					glVertex2f( fi[ i + 1 ], fj[ j + 1 ] );
-					glMultiTexCoord2f( GL_TEXTURE0, ft[ i + 0 ], ft[ j + 1 ] );
-					glVertex2f( fi[ i + 0 ], fj[ j + 1 ] );
+					DrawTexturedQuad( fi[ i + 0 ], fj[ j + 0 ], fi[ i + 1 ], fj[ j + 1 ],
+									 ft[ i + 0 ], ft[ j + 0 ], ft[ i + 1 ], ft[ j + 1 ] );
 				}				
 			}
 		}
-        glEnd();
-        glDisable( GL_BLEND );
+        StateEnable( GL_BLEND, false );
 		circle->Disable( 0 );
 		
 		float s = kbd_fontScale.GetVal();
-		glColor4f( .4f, 0, 0, 1 );
+		StateColor( 102, 0, 0, 255 );
 
-        glBlendFunc( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA );
-        glEnable( GL_BLEND );
+        StateBlendFunc( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA );
+        StateEnable( GL_BLEND, true );
 		for ( int i = 0; i < (int)keys.size(); i++ ) {
 			Bounds2f b = keys[i].bounds;
 			string str;
@@ -280,7 +273,7 @@ namespace r3 {
 			float descent = font->GetDescent() * s;
 			font->Print( str, b.Mid().x, b.Min().y - descent, s, Align_Mid, Align_Min );
 		}
-        glDisable( GL_BLEND );
+        StateEnable( GL_BLEND, false );
 	}
 
 
@@ -0,0 +1,228 @@
+/*
+ *  memory
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#include "r3/memory.h"
+
+#include "r3/command.h"
+#include "r3/output.h"
+#include "r3/thread.h"
+#include "r3/time.h"
+
+#include <vector>
+
+using namespace std;
+using namespace r3;
+
+VarBool mem_budgetFail( "mem_budgetFail", "Fail allocations that would take a memory tag over its budget instead of logging a warning.", Var_Archive, false );
+
+OutputCategory out_mem( "mem", "Output level for memory budget warnings, -1 to use out_level." );
+
+namespace {
+	
+	// The peak breakdown is only snapshotted when the total grows by this
+	// much, so steady growth does not take the lock on every allocation.
+	const int64 PeakSnapshotGranularity = 64 * 1024;
+	
+	// We have to do this to have static initialization of memory tags work.
+	struct MemoryTags {
+		MemoryTags() : peakTotal( 0 ), peakTime( 0 ), lastTime( 0 ) {}
+		vector< MemoryTag * > list;
+		vector< int64 > peakLive;     // per tag live bytes at the last peak snapshot
+		vector< int64 > lastAllocated; // per tag allocated bytes at the last memstats
+		int64 peakTotal;
+		float peakTime;
+		float lastTime;
+	};
+	MemoryTags * tags = NULL;
+	Mutex tagsMutex;
+	
+	volatile int64 totalLive;
+	volatile int64 totalPeak;
+	volatile int64 snapshotTotal;
+	
+	void InitMemoryTags() {
+		if( tags == NULL ) {
+			tags = new MemoryTags;
+		}
+	}
+	
+	void SnapshotPeak( int64 total ) {
+		ScopedMutex m( tagsMutex, R3_LOC );
+		InitMemoryTags();
+		if( total <= tags->peakTotal ) {
+			return;
+		}
+		tags->peakTotal = total;
+		tags->peakTime = GetSeconds();
+		tags->peakLive.resize( tags->list.size() );
+		for( int i = 0; i < (int)tags->list.size(); i++ ) {
+			tags->peakLive[ i ] = tags->list[ i ]->Live();
+		}
+	}
+	
+	void AccountTotal( int64 bytes ) {
+		int64 t = AtomicAdd( &totalLive, bytes );
+		if( bytes <= 0 ) {
+			return;
+		}
+		int64 p = AtomicLoad( &totalPeak );
+		while( t > p && AtomicCompareAndSwap( &totalPeak, p, t ) == false ) {
+			p = AtomicLoad( &totalPeak );
+		}
+		int64 s = AtomicLoad( &snapshotTotal );
+		int64 step = s / 64 > PeakSnapshotGranularity ? s / 64 : PeakSnapshotGranularity;
+		if( t >= s + step && AtomicCompareAndSwap( &snapshotTotal, s, t ) ) {
+			SnapshotPeak( t );
+		}
+	}
+	
+	double KB( int64 bytes ) {
+		return bytes / 1024.0;
+	}
+	
+	// memstats command
+	void MemStats( const vector< Token > & tokens ) {
+		ScopedMutex m( tagsMutex, R3_LOC );
+		InitMemoryTags();
+		float now = GetSeconds();
+		float dt = now - tags->lastTime;
+		tags->lastTime = now;
+		tags->lastAllocated.resize( tags->list.size() );
+		Output( "%-12s %12s %12s %10s %12s %10s", "tag", "live KB", "peak KB", "allocs", "rate KB/s", "budget KB" );
+		for( int i = 0; i < (int)tags->list.size(); i++ ) {
+			MemoryTag * t = tags->list[ i ];
+			int64 a = t->Allocated();
+			double rate = dt > 0 ? KB( a - tags->lastAllocated[ i ] ) / dt : 0.0;
+			tags->lastAllocated[ i ] = a;
+			Output( "%-12s %12.1f %12.1f %10lld %12.1f %10d", t->TagName(), KB( t->Live() ), KB( t->Peak() ), t->Allocs(), rate, t->GetVal() );
+		}
+		Output( "total live %.1f KB, peak %.1f KB", KB( AtomicLoad( &totalLive ) ), KB( AtomicLoad( &totalPeak ) ) );
+		if( tags->peakTotal > 0 ) {
+			Output( "at the peak (%.1f KB, %.2f s after start):", KB( tags->peakTotal ), tags->peakTime );
+			for( int i = 0; i < (int)tags->peakLive.size(); i++ ) {
+				if( tags->peakLive[ i ] > 0 ) {
+					Output( "  %-12s %12.1f KB (%.0f%%)", tags->list[ i ]->TagName(), KB( tags->peakLive[ i ] ), 100.0 * tags->peakLive[ i ] / tags->peakTotal );
+				}
+			}
+		}
+	}
+	CommandFunc MemStatsCmd( "memstats", "prints live, peak and allocation rate per memory tag, and the breakdown at the peak", MemStats );
+	
+	// Header in front of TrackedMalloc blocks, sized to keep the block aligned.
+	union TrackedHeader {
+		struct {
+			MemoryTag * tag;
+			size_t bytes;
+		} h;
+		double align[2];
+	};
+	
+}
+
+namespace r3 {
+	
+	MemoryTag::MemoryTag( const char * name, const char * desc )
+	: VarInteger( ( string( "mem_" ) + name ).c_str(), desc, Var_Archive, 0 ), tagName( name ) {
+		ScopedMutex m( tagsMutex, R3_LOC );
+		InitMemoryTags();
+		tags->list.push_back( this );
+	}
+	
+	bool MemoryTag::Alloc( int64 bytes ) {
+		int64 budget = int64( GetVal() ) * 1024;
+		int64 l;
+		if( budget > 0 && mem_budgetFail.GetVal() ) {
+			// reserve with a compare and swap so racing allocations cannot overshoot together
+			do {
+				l = AtomicLoad( &live );
+				if( l + bytes > budget ) {
+					R3_OUTPUT_WARNING( out_mem, "mem_%s: failed allocation of %lld bytes, %lld of %lld bytes live", tagName, bytes, l, budget );
+					return false;
+				}
+			} while( AtomicCompareAndSwap( &live, l, l + bytes ) == false );
+			l += bytes;
+		} else {
+			l = AtomicAdd( &live, bytes );
+			if( budget > 0 && l > budget && l - bytes <= budget ) {
+				R3_OUTPUT_WARNING( out_mem, "mem_%s: over budget, %lld of %lld bytes live", tagName, l, budget );
+			}
+		}
+		AtomicAdd( &allocs, int64( 1 ) );
+		AtomicAdd( &allocated, bytes );
+		int64 p = AtomicLoad( &peak );
+		while( l > p && AtomicCompareAndSwap( &peak, p, l ) == false ) {
+			p = AtomicLoad( &peak );
+		}
+		AccountTotal( bytes );
+		return true;
+	}
+	
+	void MemoryTag::Free( int64 bytes ) {
+		AtomicAdd( &live, -bytes );
+		AccountTotal( -bytes );
+	}
+	
+	void * TrackedMalloc( MemoryTag & tag, size_t bytes ) {
+		if( tag.Alloc( int64( bytes ) ) == false ) {
+			return NULL;
+		}
+		TrackedHeader * th = (TrackedHeader *)malloc( sizeof( TrackedHeader ) + bytes );
+		if( th == NULL ) {
+			tag.Free( int64( bytes ) );
+			return NULL;
+		}
+		th->h.tag = &tag;
+		th->h.bytes = bytes;
+		return th + 1;
+	}
+	
+	void TrackedFree( void * p ) {
+		if( p == NULL ) {
+			return;
+		}
+		TrackedHeader * th = (TrackedHeader *)p - 1;
+		th->h.tag->Free( int64( th->h.bytes ) );
+		free( th );
+	}
+	
+}
@@ -0,0 +1,258 @@
+/*
+ *  meshcache
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#include "r3/meshcache.h"
+
+#include "r3/filesystem.h"
+#include "r3/profile.h"
+
+#include <string.h>
+
+#include <vector>
+
+using namespace std;
+using namespace r3;
+
+namespace {
+	
+	const char MeshCacheMagic[4] = { 'r', '3', 'm', 'c' };
+	// Bump when the layout changes, so older files get rebuilt.
+	const int MeshCacheVersion = 4;
+	const int MaxMeshCacheAttributes = 16;
+	const int MaxMeshCacheLods = 32;
+	
+	// The file is the header, numAttributes of these, numLods MeshLods,
+	// then the vertex and index data at 16 byte aligned offsets.
+	struct MeshCacheAttribute {
+		uint index;
+		int size;
+		uint type;
+		int normalized;
+		int stride;
+		int offset;
+	};
+	
+	struct MeshCacheHeader {
+		char magic[4];
+		int version;
+		char sourceMd5[32];
+		uint importOptions;
+		uint prim;
+		uint indexType;
+		int numVertexes; // for drawing without indexes
+		int numAttributes;
+		int numLods;
+		float boundsMin[3];
+		float boundsMax[3];
+		float positionScale[3];
+		float positionOffset[3];
+		float texCoordScale[2];
+		float texCoordOffset[2];
+		int vertexOffset;
+		int vertexBytes;
+		int indexOffset;
+		int indexBytes;
+	};
+	
+	int Align16( int offset ) {
+		return ( offset + 15 ) & ~15;
+	}
+	
+	bool WritePadded( File * f, const void * data, int size, int end ) {
+		static const uchar zeros[16] = { 0 };
+		if( size && f->Write( data, 1, size ) != size ) {
+			return false;
+		}
+		int pad = end - f->Tell();
+		return pad == 0 || f->Write( zeros, 1, pad ) == pad;
+	}
+	
+	bool ValidHeader( const MeshCacheHeader & h, const string & sourceMd5, uint importOptions, int fileSize ) {
+		if( memcmp( h.magic, MeshCacheMagic, sizeof( h.magic ) ) != 0 || h.version != MeshCacheVersion || h.importOptions != importOptions ) {
+			return false;
+		}
+		if( sourceMd5.size() != sizeof( h.sourceMd5 ) || memcmp( h.sourceMd5, sourceMd5.c_str(), sizeof( h.sourceMd5 ) ) != 0 ) {
+			return false;
+		}
+		if( h.numAttributes < 0 || h.numAttributes > MaxMeshCacheAttributes || h.numLods < 0 || h.numLods > MaxMeshCacheLods ||
+		    h.vertexBytes < 0 || h.indexBytes < 0 ) {
+			return false;
+		}
+		int64 tablesEnd = sizeof( MeshCacheHeader ) + int64( h.numAttributes ) * sizeof( MeshCacheAttribute ) + int64( h.numLods ) * sizeof( MeshLod );
+		return tablesEnd <= h.vertexOffset &&
+		       int64( h.vertexOffset ) + h.vertexBytes <= h.indexOffset &&
+		       int64( h.indexOffset ) + h.indexBytes <= fileSize;
+	}
+	
+}
+
+namespace r3 {
+	
+	bool WriteMeshCache( const string & filename, const string & sourceMd5, uint importOptions, Model * model ) {
+		R3_PROFILE( "WriteMeshCache" );
+		MeshCacheHeader h;
+		memset( &h, 0, sizeof( h ) );
+		VertexBuffer & vb = model->GetVertexBuffer();
+		bool indexed = model->HasIndexBuffer();
+		const vector< AttributeArray > & attr = model->GetAttributeArrays();
+		const vector< MeshLod > & lods = model->GetLods();
+		if( vb.GetShadow() != BufferShadow_Keep || ( indexed && model->GetIndexBuffer().GetShadow() != BufferShadow_Keep ) ||
+		    sourceMd5.size() != sizeof( h.sourceMd5 ) || (int)attr.size() > MaxMeshCacheAttributes || (int)lods.size() > MaxMeshCacheLods ) {
+			return false;
+		}
+		
+		memcpy( h.magic, MeshCacheMagic, sizeof( h.magic ) );
+		h.version = MeshCacheVersion;
+		memcpy( h.sourceMd5, sourceMd5.c_str(), sizeof( h.sourceMd5 ) );
+		h.importOptions = importOptions;
+		h.prim = model->GetPrimitive();
+		h.indexType = model->GetIndexType();
+		h.numVertexes = indexed ? 0 : model->GetNumVertexes();
+		h.numAttributes = (int)attr.size();
+		h.numLods = (int)lods.size();
+		const Bounds3f & b = model->GetBounds();
+		memcpy( h.boundsMin, &b.Min().x, sizeof( h.boundsMin ) );
+		memcpy( h.boundsMax, &b.Max().x, sizeof( h.boundsMax ) );
+		const Dequantize & dq = model->GetDequantize();
+		memcpy( h.positionScale, &dq.positionScale.x, sizeof( h.positionScale ) );
+		memcpy( h.positionOffset, &dq.positionOffset.x, sizeof( h.positionOffset ) );
+		memcpy( h.texCoordScale, &dq.texCoordScale.x, sizeof( h.texCoordScale ) );
+		memcpy( h.texCoordOffset, &dq.texCoordOffset.x, sizeof( h.texCoordOffset ) );
+		int attributesEnd = sizeof( h ) + h.numAttributes * sizeof( MeshCacheAttribute );
+		h.vertexOffset = Align16( attributesEnd + h.numLods * sizeof( MeshLod ) );
+		h.vertexBytes = vb.GetSize();
+		h.indexOffset = Align16( h.vertexOffset + h.vertexBytes );
+		h.indexBytes = indexed ? model->GetIndexBuffer().GetSize() : 0;
+		
+		vector< MeshCacheAttribute > attributes( attr.size() );
+		for( int i = 0; i < (int)attr.size(); i++ ) {
+			MeshCacheAttribute & a = attributes[ i ];
+			a.index = attr[ i ].index;
+			a.size = attr[ i ].size;
+			a.type = attr[ i ].type;
+			a.normalized = attr[ i ].normalized;
+			a.stride = attr[ i ].stride;
+			a.offset = int( (const char *)attr[ i ].pointer - (const char *)NULL );
+		}
+		
+		File * f = FileOpenForWrite( filename );
+		if( f == NULL ) {
+			return false;
+		}
+		bool ok = f->Write( &h, sizeof( h ), 1 ) == 1;
+		ok = ok && WritePadded( f, attributes.empty() ? NULL : &attributes[0], h.numAttributes * sizeof( MeshCacheAttribute ), attributesEnd );
+		ok = ok && WritePadded( f, lods.empty() ? NULL : &lods[0], h.numLods * sizeof( MeshLod ), h.vertexOffset );
+		vector< uchar > data( h.vertexBytes );
+		if( ok && h.vertexBytes ) {
+			vb.GetData( &data[0] );
+		}
+		ok = ok && WritePadded( f, data.empty() ? NULL : &data[0], h.vertexBytes, h.indexOffset );
+		data.resize( h.indexBytes );
+		if( ok && h.indexBytes ) {
+			model->GetIndexBuffer().GetData( &data[0] );
+		}
+		ok = ok && WritePadded( f, data.empty() ? NULL : &data[0], h.indexBytes, h.indexOffset + h.indexBytes );
+		delete f;
+		return ok;
+	}
+	
+	Model * CreateModelFromMeshCache( const string & filename, const string & sourceMd5, uint importOptions, const string & modelName ) {
+		R3_PROFILE( "CreateModelFromMeshCache" );
+		MappedFile * mf = FileMapForRead( filename );
+		if( mf == NULL ) {
+			return NULL;
+		}
+		const uchar * data = mf->Data();
+		MeshCacheHeader h;
+		if( mf->Size() < (int)sizeof( h ) ) {
+			delete mf;
+			return NULL;
+		}
+		memcpy( &h, data, sizeof( h ) );
+		if( ValidHeader( h, sourceMd5, importOptions, mf->Size() ) == false ) {
+			delete mf;
+			return NULL;
+		}
+		
+		vector< MeshLod > lods( h.numLods );
+		int numIndexes = h.indexBytes / ( h.indexType == GL_UNSIGNED_INT ? 4 : 2 );
+		for( int i = 0; i < h.numLods; i++ ) {
+			MeshLod & l = lods[ i ];
+			memcpy( &l, data + sizeof( h ) + h.numAttributes * sizeof( MeshCacheAttribute ) + i * sizeof( l ), sizeof( l ) );
+			if( l.firstIndex < 0 || l.numIndexes < 0 || int64( l.firstIndex ) + l.numIndexes > numIndexes ) {
+				delete mf;
+				return NULL;
+			}
+		}
+		
+		Model * m = new Model( modelName );
+		m->SetPrimitive( h.prim );
+		m->SetIndexType( h.indexType );
+		m->SetNumVertexes( h.numVertexes );
+		m->SetBounds( Bounds3f( Vec3f( h.boundsMin ), Vec3f( h.boundsMax ) ) );
+		Dequantize dq;
+		dq.positionScale = Vec3f( h.positionScale );
+		dq.positionOffset = Vec3f( h.positionOffset );
+		dq.texCoordScale = Vec2f( h.texCoordScale );
+		dq.texCoordOffset = Vec2f( h.texCoordOffset );
+		m->SetDequantize( dq );
+		for( int i = 0; i < h.numAttributes; i++ ) {
+			MeshCacheAttribute a;
+			memcpy( &a, data + sizeof( h ) + i * sizeof( a ), sizeof( a ) );
+			m->AddAttributeArray( AttributeArray( a.index, a.size, a.type, GLboolean( a.normalized ), a.stride, a.offset ) );
+		}
+		m->SetLods( lods );
+		// no copies kept, the buffers go back to the file if GL loses them
+		VertexBuffer & vb = m->GetVertexBuffer();
+		vb.SetShadowFile( filename, h.vertexOffset );
+		vb.SetData( h.vertexBytes, data + h.vertexOffset );
+		if( h.indexBytes ) {
+			IndexBuffer & ib = m->GetIndexBuffer();
+			ib.SetShadowFile( filename, h.indexOffset );
+			ib.SetData( h.indexBytes, data + h.indexOffset );
+		}
+		delete mf;
+		return m;
+	}
+	
+}
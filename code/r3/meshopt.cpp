@@ -0,0 +1,725 @@
+/*
+ *  meshopt
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#include "r3/meshopt.h"
+
+#include "r3/linear.h"
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace std;
+using namespace r3;
+
+namespace {
+	
+	// Forsyth's constants, for an LRU cache of ForsythCacheSize vertexes.
+	const int ForsythCacheSize = 32;
+	const float ForsythDecayPower = 1.5f;
+	const float ForsythLastTriScore = 0.75f;
+	const float ForsythValenceScale = 2.0f;
+	const float ForsythValencePower = 0.5f;
+	const int ForsythValenceTable = 32;
+	
+	struct ForsythScores {
+		float cache[ ForsythCacheSize ];
+		float valence[ ForsythValenceTable ];
+		ForsythScores() {
+			for( int i = 0; i < ForsythCacheSize; i++ ) {
+				// the last triangle's vertexes get a fixed score, so the
+				// next one does not just go back and forth over an edge
+				if( i < 3 ) {
+					cache[ i ] = ForsythLastTriScore;
+				} else {
+					cache[ i ] = powf( 1.0f - float( i - 3 ) / ( ForsythCacheSize - 3 ), ForsythDecayPower );
+				}
+			}
+			for( int i = 0; i < ForsythValenceTable; i++ ) {
+				valence[ i ] = Valence( i );
+			}
+		}
+		static float Valence( int remaining ) {
+			return remaining ? ForsythValenceScale * powf( float( remaining ), -ForsythValencePower ) : 0.0f;
+		}
+		// vertexes with few triangles left score high, to finish them off
+		float Score( int cachePos, int remaining ) const {
+			if( remaining == 0 ) {
+				return -1.0f;
+			}
+			float score = cachePos >= 0 ? cache[ cachePos ] : 0.0f;
+			return score + ( remaining < ForsythValenceTable ? valence[ remaining ] : Valence( remaining ) );
+		}
+	};
+	
+	// FIFO cache simulated with timestamps: a vertex is still cached if
+	// fewer than cacheSize others were added after it.
+	struct FifoCache {
+		vector< uint > stamps;
+		uint time;
+		uint size;
+		FifoCache( int numVertexes, int cacheSize ) : stamps( numVertexes, 0 ), time( cacheSize + 1 ), size( cacheSize ) {}
+		int Miss( uint v ) {
+			if( time - stamps[ v ] > size ) {
+				stamps[ v ] = time++;
+				return 1;
+			}
+			return 0;
+		}
+		void Flush() {
+			time += size + 1;
+		}
+	};
+	
+	struct Cluster {
+		int begin;
+		int end;
+		float sortKey;
+		bool operator < ( const Cluster & rhs ) const {
+			return sortKey > rhs.sortKey;
+		}
+	};
+	
+	const Vec3f & Position( const float * positions, int stride, uint v ) {
+		return *reinterpret_cast< const Vec3f * >( reinterpret_cast< const char * >( positions ) + size_t( v ) * stride );
+	}
+	
+	// Squared distances to weighted planes, with the total weight kept so
+	// the error comes out as a distance.
+	struct Quadric {
+		double a2, ab, ac, ad, b2, bc, bd, c2, cd, d2, w;
+		Quadric() : a2( 0 ), ab( 0 ), ac( 0 ), ad( 0 ), b2( 0 ), bc( 0 ), bd( 0 ), c2( 0 ), cd( 0 ), d2( 0 ), w( 0 ) {}
+		void AddPlane( const Vec3f & n, float d, float weight ) {
+			a2 += weight * n.x * n.x;
+			ab += weight * n.x * n.y;
+			ac += weight * n.x * n.z;
+			ad += weight * n.x * d;
+			b2 += weight * n.y * n.y;
+			bc += weight * n.y * n.z;
+			bd += weight * n.y * d;
+			c2 += weight * n.z * n.z;
+			cd += weight * n.z * d;
+			d2 += weight * d * d;
+			w += weight;
+		}
+		void operator += ( const Quadric & q ) {
+			a2 += q.a2; ab += q.ab; ac += q.ac; ad += q.ad;
+			b2 += q.b2; bc += q.bc; bd += q.bd;
+			c2 += q.c2; cd += q.cd;
+			d2 += q.d2;
+			w += q.w;
+		}
+		// squared distance
+		float Error( const Vec3f & p ) const {
+			double x = p.x, y = p.y, z = p.z;
+			double e = a2 * x * x + b2 * y * y + c2 * z * z + 2.0 * ( ab * x * y + ac * x * z + bc * y * z + ad * x + bd * y + cd * z ) + d2;
+			return w > 0.0 ? float( max( e, 0.0 ) / w ) : 0.0f;
+		}
+	};
+	
+	enum VertexKindEnum {
+		VertexKind_Interior,
+		VertexKind_Border, // on an open edge, only slides along it
+		VertexKind_Locked  // seams, corners and non-manifold spots
+	};
+	
+	// How much more border planes count than the surface's, so the
+	// outline of an open mesh holds.
+	const float BorderWeight = 10.0f;
+	
+	// A simplification pass takes collapses up to this much past the cost
+	// of the last one it needs.
+	const float PassSlack = 1.5f;
+	
+	// After this many passes in a row that find nothing to collapse, a
+	// pass takes every candidate there is.
+	const int MaxPassRetries = 4;
+	
+	typedef pair< uint, uint > Edge;
+	
+	Edge MakeEdge( uint a, uint b ) {
+		return a < b ? Edge( a, b ) : Edge( b, a );
+	}
+	
+	// Every triangle edge, sorted, with the triangle it came from.
+	void SortedEdges( const uint * indexes, int numIndexes, vector< pair< Edge, int > > & edges ) {
+		edges.resize( numIndexes );
+		for( int i = 0; i < numIndexes; i++ ) {
+			int t = i / 3;
+			edges[ i ] = make_pair( MakeEdge( indexes[ i ], indexes[ t * 3 + ( i + 1 ) % 3 ] ), t );
+		}
+		sort( edges.begin(), edges.end() );
+	}
+	
+	struct EdgeCollapse {
+		uint from;
+		uint to;
+		float cost;
+		bool operator < ( const EdgeCollapse & rhs ) const {
+			return cost < rhs.cost;
+		}
+	};
+	
+	struct PositionLess {
+		bool operator()( const pair< Vec3f, uint > & a, const pair< Vec3f, uint > & b ) const {
+			if( a.first.x != b.first.x ) {
+				return a.first.x < b.first.x;
+			}
+			if( a.first.y != b.first.y ) {
+				return a.first.y < b.first.y;
+			}
+			return a.first.z < b.first.z;
+		}
+	};
+	
+	struct CostAtMost {
+		float limit;
+		CostAtMost( float l ) : limit( l ) {}
+		bool operator()( const EdgeCollapse & c ) const {
+			return c.cost <= limit;
+		}
+	};
+	
+	Vec3f TriangleNormal( const Vec3f & p0, const Vec3f & p1, const Vec3f & p2 ) {
+		return ( p1 - p0 ).Cross( p2 - p0 );
+	}
+	
+}
+
+namespace r3 {
+	
+	VertexCacheStats SimulateVertexCache( const uint * indexes, int numIndexes, int numVertexes, int cacheSize ) {
+		VertexCacheStats stats;
+		if( numIndexes < 3 || numVertexes == 0 ) {
+			return stats;
+		}
+		FifoCache cache( numVertexes, cacheSize );
+		int misses = 0;
+		for( int i = 0; i < numIndexes; i++ ) {
+			misses += cache.Miss( indexes[ i ] );
+		}
+		stats.acmr = float( misses ) / ( numIndexes / 3 );
+		stats.atvr = float( misses ) / numVertexes;
+		return stats;
+	}
+	
+	void OptimizeVertexCache( uint * indexes, int numIndexes, int numVertexes ) {
+		static const ForsythScores scores;
+		int numTris = numIndexes / 3;
+		if( numTris == 0 ) {
+			return;
+		}
+		
+		// triangles using each vertex, the first remaining[v] of them not
+		// yet emitted
+		vector< int > remaining( numVertexes, 0 );
+		for( int i = 0; i < numTris * 3; i++ ) {
+			remaining[ indexes[ i ] ]++;
+		}
+		vector< int > first( numVertexes + 1, 0 );
+		for( int v = 0; v < numVertexes; v++ ) {
+			first[ v + 1 ] = first[ v ] + remaining[ v ];
+		}
+		vector< int > tris( numTris * 3 );
+		vector< int > fill( first.begin(), first.end() - 1 );
+		for( int i = 0; i < numTris * 3; i++ ) {
+			tris[ fill[ indexes[ i ] ]++ ] = i / 3;
+		}
+		
+		vector< int > cachePos( numVertexes, -1 );
+		vector< float > vertexScore( numVertexes );
+		for( int v = 0; v < numVertexes; v++ ) {
+			vertexScore[ v ] = scores.Score( -1, remaining[ v ] );
+		}
+		vector< float > triScore( numTris );
+		vector< bool > emitted( numTris, false );
+		int best = 0;
+		for( int t = 0; t < numTris; t++ ) {
+			const uint * tri = indexes + t * 3;
+			triScore[ t ] = vertexScore[ tri[0] ] + vertexScore[ tri[1] ] + vertexScore[ tri[2] ];
+			best = triScore[ t ] > triScore[ best ] ? t : best;
+		}
+		
+		vector< uint > out( numTris * 3 );
+		uint cache[ ForsythCacheSize + 3 ];
+		int cacheCount = 0;
+		int deadEnd = 0;
+		for( int i = 0; i < numTris; i++ ) {
+			if( best < 0 ) {
+				// nothing in the cache has triangles left, so start over at
+				// the first one not yet emitted
+				while( emitted[ deadEnd ] ) {
+					deadEnd++;
+				}
+				best = deadEnd;
+			}
+			const uint * tri = indexes + best * 3;
+			memcpy( &out[ i * 3 ], tri, 3 * sizeof( uint ) );
+			emitted[ best ] = true;
+			
+			// the triangle's vertexes go to the front of the LRU cache
+			uint newCache[ ForsythCacheSize + 3 ];
+			int newCount = 0;
+			for( int j = 0; j < 3; j++ ) {
+				uint v = tri[ j ];
+				if( find( newCache, newCache + newCount, v ) == newCache + newCount ) {
+					newCache[ newCount++ ] = v;
+				}
+				int * vt = &tris[ first[ v ] ];
+				int * last = vt + remaining[ v ] - 1;
+				*find( vt, last, best ) = *last;
+				remaining[ v ]--;
+			}
+			for( int j = 0; j < cacheCount; j++ ) {
+				uint v = cache[ j ];
+				if( v != tri[0] && v != tri[1] && v != tri[2] ) {
+					newCache[ newCount++ ] = v;
+				}
+			}
+			
+			// rescore what moved, including what fell out, and pick the
+			// best triangle among theirs
+			best = -1;
+			float bestScore = -1.0f;
+			for( int j = 0; j < newCount; j++ ) {
+				uint v = newCache[ j ];
+				cachePos[ v ] = j < ForsythCacheSize ? j : -1;
+				vertexScore[ v ] = scores.Score( cachePos[ v ], remaining[ v ] );
+			}
+			for( int j = 0; j < newCount; j++ ) {
+				uint v = newCache[ j ];
+				const int * vt = &tris[ first[ v ] ];
+				for( int k = 0; k < remaining[ v ]; k++ ) {
+					int t = vt[ k ];
+					const uint * ti = indexes + t * 3;
+					float s = vertexScore[ ti[0] ] + vertexScore[ ti[1] ] + vertexScore[ ti[2] ];
+					triScore[ t ] = s;
+					if( s > bestScore ) {
+						bestScore = s;
+						best = t;
+					}
+				}
+			}
+			cacheCount = min( newCount, ForsythCacheSize );
+			memcpy( cache, newCache, cacheCount * sizeof( uint ) );
+		}
+		memcpy( indexes, &out[0], numTris * 3 * sizeof( uint ) );
+	}
+	
+	int OptimizeOverdraw( uint * indexes, int numIndexes, const float * positions, int stride, int numVertexes, int cacheSize, float threshold ) {
+		int numTris = numIndexes / 3;
+		if( numTris == 0 ) {
+			return 0;
+		}
+		
+		// hard boundaries where the vertex cache order starts over, at
+		// triangles whose vertexes all miss
+		FifoCache cache( numVertexes, cacheSize );
+		vector< int > hard;
+		for( int t = 0; t < numTris; t++ ) {
+			const uint * tri = indexes + t * 3;
+			int misses = cache.Miss( tri[0] ) + cache.Miss( tri[1] ) + cache.Miss( tri[2] );
+			if( t == 0 || misses == 3 ) {
+				hard.push_back( t );
+			}
+		}
+		hard.push_back( numTris );
+		
+		// soft boundaries inside those, wherever a cluster ending there
+		// would miss little more than the whole hard cluster does
+		vector< Cluster > clusters;
+		for( int h = 0; h + 1 < (int)hard.size(); h++ ) {
+			int begin = hard[ h ];
+			int end = hard[ h + 1 ];
+			cache.Flush();
+			int misses = 0;
+			for( int i = begin * 3; i < end * 3; i++ ) {
+				misses += cache.Miss( indexes[ i ] );
+			}
+			float limit = float( misses ) / ( end - begin ) * threshold;
+			cache.Flush();
+			misses = 0;
+			Cluster c;
+			c.begin = begin;
+			for( int t = begin; t < end; t++ ) {
+				const uint * tri = indexes + t * 3;
+				misses += cache.Miss( tri[0] ) + cache.Miss( tri[1] ) + cache.Miss( tri[2] );
+				if( t + 1 < end && misses <= limit * ( t + 1 - c.begin ) ) {
+					c.end = t + 1;
+					clusters.push_back( c );
+					c.begin = t + 1;
+					cache.Flush();
+					misses = 0;
+				}
+			}
+			c.end = end;
+			clusters.push_back( c );
+		}
+		
+		// sort by how far out along its average normal each cluster sits
+		Vec3f meshCenter;
+		for( int v = 0; v < numVertexes; v++ ) {
+			meshCenter += Position( positions, stride, v );
+		}
+		meshCenter *= 1.0f / max( numVertexes, 1 );
+		for( int i = 0; i < (int)clusters.size(); i++ ) {
+			Cluster & c = clusters[ i ];
+			Vec3f center;
+			Vec3f normal;
+			float area = 0.0f;
+			for( int t = c.begin; t < c.end; t++ ) {
+				const uint * tri = indexes + t * 3;
+				const Vec3f & p0 = Position( positions, stride, tri[0] );
+				const Vec3f & p1 = Position( positions, stride, tri[1] );
+				const Vec3f & p2 = Position( positions, stride, tri[2] );
+				Vec3f n = ( p1 - p0 ).Cross( p2 - p0 );
+				float a = n.Length();
+				center += ( p0 + p1 + p2 ) * ( a / 3.0f );
+				normal += n;
+				area += a;
+			}
+			center *= area > 0.0f ? 1.0f / area : 0.0f;
+			normal.Normalize();
+			c.sortKey = ( center - meshCenter ).Dot( normal );
+		}
+		stable_sort( clusters.begin(), clusters.end() );
+		
+		vector< uint > out( numTris * 3 );
+		uint * o = &out[0];
+		for( int i = 0; i < (int)clusters.size(); i++ ) {
+			int n = ( clusters[ i ].end - clusters[ i ].begin ) * 3;
+			memcpy( o, indexes + clusters[ i ].begin * 3, n * sizeof( uint ) );
+			o += n;
+		}
+		memcpy( indexes, &out[0], numTris * 3 * sizeof( uint ) );
+		return (int)clusters.size();
+	}
+	
+	int SimplifyMesh( uint * indexes, int numIndexes, const float * positions, int stride, int numVertexes, int targetIndexes, float * error ) {
+		float maxError = 0.0f;
+		int count = numIndexes - numIndexes % 3;
+		
+		// vertexes that share a position with another are seams
+		vector< uchar > seams( numVertexes, VertexKind_Interior );
+		vector< Vec3f > pos( numVertexes );
+		vector< pair< Vec3f, uint > > byPos( numVertexes );
+		for( int v = 0; v < numVertexes; v++ ) {
+			pos[ v ] = Position( positions, stride, v );
+			byPos[ v ] = make_pair( pos[ v ], uint( v ) );
+		}
+		sort( byPos.begin(), byPos.end(), PositionLess() );
+		for( int i = 1; i < numVertexes; i++ ) {
+			if( byPos[ i ].first == byPos[ i - 1 ].first ) {
+				seams[ byPos[ i ].second ] = VertexKind_Locked;
+				seams[ byPos[ i - 1 ].second ] = VertexKind_Locked;
+			}
+		}
+		
+		// surface planes weighted by area, and planes standing on the open
+		// edges so the border resists moving
+		vector< Quadric > quadrics( numVertexes );
+		vector< Vec3f > normals( count / 3 );
+		for( int t = 0; t < count / 3; t++ ) {
+			const uint * tri = indexes + t * 3;
+			Vec3f n = TriangleNormal( pos[ tri[0] ], pos[ tri[1] ], pos[ tri[2] ] );
+			float area = n.Normalize();
+			normals[ t ] = n;
+			for( int k = 0; k < 3; k++ ) {
+				quadrics[ tri[ k ] ].AddPlane( n, -n.Dot( pos[ tri[0] ] ), area * 0.5f );
+			}
+		}
+		vector< pair< Edge, int > > edges;
+		SortedEdges( indexes, count, edges );
+		for( int i = 0; i < (int)edges.size(); ) {
+			int j = i + 1;
+			while( j < (int)edges.size() && edges[ j ].first == edges[ i ].first ) {
+				j++;
+			}
+			uint a = edges[ i ].first.first;
+			uint b = edges[ i ].first.second;
+			if( j - i == 1 ) {
+				Vec3f e = pos[ b ] - pos[ a ];
+				Vec3f n = e.Cross( normals[ edges[ i ].second ] );
+				n.Normalize();
+				float weight = e.Dot( e ) * BorderWeight;
+				quadrics[ a ].AddPlane( n, -n.Dot( pos[ a ] ), weight );
+				quadrics[ b ].AddPlane( n, -n.Dot( pos[ a ] ), weight );
+			}
+			i = j;
+		}
+		
+		// Passes of the cheapest collapses that do not touch each other,
+		// then the index list is rewritten without the degenerate triangles.
+		vector< EdgeCollapse > collapses;
+		float slack = PassSlack;
+		float passFloor = -1.0f;
+		int retries = 0;
+		vector< int > first( numVertexes + 1 );
+		vector< int > fillPos( numVertexes );
+		vector< int > vertexTris;
+		vector< uint > remap( numVertexes );
+		vector< uchar > touched( numVertexes );
+		vector< uchar > kind( numVertexes );
+		vector< uchar > borderEdges( numVertexes );
+		vector< int > edgeTris;
+		vector< int > linkMark( numVertexes, 0 );
+		int linkStamp = 0;
+		while( count > targetIndexes ) {
+			// triangles around each vertex
+			fill( first.begin(), first.end(), 0 );
+			for( int i = 0; i < count; i++ ) {
+				first[ indexes[ i ] + 1 ]++;
+			}
+			for( int v = 0; v < numVertexes; v++ ) {
+				first[ v + 1 ] += first[ v ];
+			}
+			vertexTris.resize( count );
+			copy( first.begin(), first.end() - 1, fillPos.begin() );
+			for( int i = 0; i < count; i++ ) {
+				vertexTris[ fillPos[ indexes[ i ] ]++ ] = i / 3;
+			}
+			
+			// Open edges make borders and edges shared by more than two
+			// triangles lock their ends.  Collapses change both, so this is
+			// redone every pass.
+			edgeTris.resize( count );
+			copy( seams.begin(), seams.end(), kind.begin() );
+			fill( borderEdges.begin(), borderEdges.end(), 0 );
+			for( int i = 0; i < count; i++ ) {
+				uint a = indexes[ i ];
+				uint b = indexes[ i - i % 3 + ( i + 1 ) % 3 ];
+				int shared = 0;
+				for( int j = first[ a ]; j < first[ a + 1 ]; j++ ) {
+					const uint * tri = indexes + vertexTris[ j ] * 3;
+					shared += tri[0] == b || tri[1] == b || tri[2] == b;
+				}
+				edgeTris[ i ] = shared;
+				if( shared == 1 ) {
+					borderEdges[ a ] = (uchar)min( borderEdges[ a ] + 1, 255 );
+					borderEdges[ b ] = (uchar)min( borderEdges[ b ] + 1, 255 );
+				} else if( shared > 2 ) {
+					kind[ a ] = kind[ b ] = VertexKind_Locked;
+				}
+			}
+			for( int v = 0; v < numVertexes; v++ ) {
+				if( kind[ v ] == VertexKind_Interior && borderEdges[ v ] ) {
+					kind[ v ] = borderEdges[ v ] == 2 ? VertexKind_Border : VertexKind_Locked;
+				}
+			}
+			
+			// Candidates both ways along each edge, once per edge: shared
+			// edges from the side where a < b, open ones from their only
+			// triangle.
+			collapses.clear();
+			for( int i = 0; i < count; i++ ) {
+				uint a = indexes[ i ];
+				uint b = indexes[ i - i % 3 + ( i + 1 ) % 3 ];
+				bool open = edgeTris[ i ] == 1;
+				if( open == false && a > b ) {
+					continue;
+				}
+				for( int k = 0; k < 2; k++ ) {
+					uint u = k ? b : a;
+					uint v = k ? a : b;
+					if( kind[ u ] == VertexKind_Locked || ( kind[ u ] == VertexKind_Border && ( open == false || kind[ v ] == VertexKind_Interior ) ) ) {
+						continue;
+					}
+					Quadric q = quadrics[ u ];
+					q += quadrics[ v ];
+					EdgeCollapse c = { u, v, q.Error( pos[ v ] ) };
+					collapses.push_back( c );
+				}
+			}
+			if( collapses.empty() ) {
+				break;
+			}
+			
+			// each collapse takes about two triangles, and a pass stops a
+			// little past the cost of the last one it should need, so only
+			// that much gets sorted
+			int goal = ( count - targetIndexes + 2 ) / 3;
+			vector< EdgeCollapse >::iterator nth = collapses.begin() + min( (int)collapses.size() - 1, goal / 2 );
+			nth_element( collapses.begin(), nth, collapses.end() );
+			float passLimit = nth->cost * slack;
+			if( retries >= MaxPassRetries ) {
+				passLimit = FLT_MAX;
+			} else if( passLimit <= passFloor ) {
+				// a free collapse does not grow with the slack, so go on
+				// from the next cost past the last pass's limit
+				float next = FLT_MAX;
+				for( vector< EdgeCollapse >::iterator it = nth; it != collapses.end(); ++it ) {
+					if( it->cost > passFloor && it->cost < next ) {
+						next = it->cost;
+					}
+				}
+				passLimit = next < FLT_MAX / slack ? next * slack : FLT_MAX;
+			}
+			size_t candidates = collapses.size();
+			collapses.erase( partition( nth, collapses.end(), CostAtMost( passLimit ) ), collapses.end() );
+			bool allCandidates = collapses.size() == candidates;
+			sort( collapses.begin(), collapses.end() );
+			
+			fill( touched.begin(), touched.end(), 0 );
+			for( int v = 0; v < numVertexes; v++ ) {
+				remap[ v ] = v;
+			}
+			int removed = 0;
+			for( int i = 0; i < (int)collapses.size() && removed < goal; i++ ) {
+				const EdgeCollapse & c = collapses[ i ];
+				if( touched[ c.from ] || touched[ c.to ] ) {
+					continue;
+				}
+				// Link condition: the ends may only share the neighbours
+				// across the triangles on their edge, or the collapse
+				// would fold the surface into a non-manifold edge.
+				linkStamp += 2;
+				for( int j = first[ c.from ]; j < first[ c.from + 1 ]; j++ ) {
+					const uint * tri = indexes + vertexTris[ j ] * 3;
+					bool onEdge = tri[0] == c.to || tri[1] == c.to || tri[2] == c.to;
+					for( int k = 0; k < 3; k++ ) {
+						if( tri[ k ] != c.from && tri[ k ] != c.to && linkMark[ tri[ k ] ] != linkStamp + 1 ) {
+							linkMark[ tri[ k ] ] = onEdge ? linkStamp + 1 : linkStamp;
+						}
+					}
+				}
+				bool linked = false;
+				for( int j = first[ c.to ]; j < first[ c.to + 1 ] && linked == false; j++ ) {
+					const uint * tri = indexes + vertexTris[ j ] * 3;
+					for( int k = 0; k < 3; k++ ) {
+						linked = linked || linkMark[ tri[ k ] ] == linkStamp;
+					}
+				}
+				if( linked ) {
+					continue;
+				}
+				// No triangle that stays may turn over.  One with no area
+				// has no facing to keep.
+				bool flips = false;
+				for( int j = first[ c.from ]; j < first[ c.from + 1 ] && flips == false; j++ ) {
+					const uint * tri = indexes + vertexTris[ j ] * 3;
+					if( tri[0] == c.to || tri[1] == c.to || tri[2] == c.to ) {
+						continue;
+					}
+					Vec3f p[3];
+					for( int k = 0; k < 3; k++ ) {
+						p[ k ] = pos[ tri[ k ] == c.from ? c.to : tri[ k ] ];
+					}
+					Vec3f before = TriangleNormal( pos[ tri[0] ], pos[ tri[1] ], pos[ tri[2] ] );
+					if( before.Dot( before ) == 0.0f ) {
+						continue;
+					}
+					flips = before.Dot( TriangleNormal( p[0], p[1], p[2] ) ) <= 0.0f;
+				}
+				if( flips ) {
+					continue;
+				}
+				// everything around is off limits for the rest of the pass,
+				// so later checks see the triangles as they are
+				for( int j = first[ c.from ]; j < first[ c.from + 1 ]; j++ ) {
+					const uint * tri = indexes + vertexTris[ j ] * 3;
+					touched[ tri[0] ] = touched[ tri[1] ] = touched[ tri[2] ] = 1;
+					removed += tri[0] == c.to || tri[1] == c.to || tri[2] == c.to;
+				}
+				remap[ c.from ] = c.to;
+				quadrics[ c.to ] += quadrics[ c.from ];
+				maxError = max( maxError, c.cost );
+			}
+			// when everything cheap enough flips, look further up
+			if( removed == 0 ) {
+				if( allCandidates ) {
+					break;
+				}
+				passFloor = passLimit;
+				retries++;
+				slack = slack * 4.0f + 1.0f;
+				continue;
+			}
+			slack = PassSlack;
+			passFloor = -1.0f;
+			retries = 0;
+			int out = 0;
+			for( int i = 0; i < count; i += 3 ) {
+				uint a = remap[ indexes[ i ] ];
+				uint b = remap[ indexes[ i + 1 ] ];
+				uint c = remap[ indexes[ i + 2 ] ];
+				if( a != b && b != c && a != c ) {
+					indexes[ out++ ] = a;
+					indexes[ out++ ] = b;
+					indexes[ out++ ] = c;
+				}
+			}
+			count = out;
+		}
+		if( error ) {
+			*error = sqrtf( maxError );
+		}
+		return count;
+	}
+	
+	void OptimizeVertexFetch( void * vertexes, int stride, uint * indexes, int numIndexes, int numVertexes ) {
+		const uint Unused = ~0u;
+		vector< uint > remap( numVertexes, Unused );
+		uint next = 0;
+		for( int i = 0; i < numIndexes; i++ ) {
+			uint & r = remap[ indexes[ i ] ];
+			if( r == Unused ) {
+				r = next++;
+			}
+			indexes[ i ] = r;
+		}
+		for( int v = 0; v < numVertexes; v++ ) {
+			if( remap[ v ] == Unused ) {
+				remap[ v ] = next++;
+			}
+		}
+		uchar * data = static_cast< uchar * >( vertexes );
+		vector< uchar > old( data, data + size_t( numVertexes ) * stride );
+		for( int v = 0; v < numVertexes; v++ ) {
+			memcpy( data + size_t( remap[ v ] ) * stride, &old[ size_t( v ) * stride ], stride );
+		}
+	}
+	
+}
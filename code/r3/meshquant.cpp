@@ -0,0 +1,315 @@
+/*
+ *  meshquant
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#include "r3/meshquant.h"
+
+#include "r3/bounds.h"
+#include "r3/varying.h"
+
+#include <math.h>
+#include <string.h>
+
+using namespace std;
+using namespace r3;
+
+namespace {
+	
+	const float Unorm16Max = 65535.0f;
+	
+	float Sign( float f ) {
+		return f < 0.0f ? -1.0f : 1.0f;
+	}
+	
+	int Align4( int i ) {
+		return ( i + 3 ) & ~3;
+	}
+	
+	ushort ToUnorm16( float f, float offset, float scale ) {
+		if( scale <= 0.0f ) {
+			return 0;
+		}
+		float u = ( f - offset ) / scale * Unorm16Max + 0.5f;
+		return ushort( u < 0.0f ? 0.0f : u > Unorm16Max ? Unorm16Max : u );
+	}
+	
+	signed char ToSnorm8( float f ) {
+		float s = floorf( f * 127.0f + 0.5f );
+		return (signed char)( s < -127.0f ? -127.0f : s > 127.0f ? 127.0f : s );
+	}
+	
+	// The octahedron's square unfolded, before quantization.
+	void FoldOctahedral( const float * n, float & x, float & y ) {
+		float s = fabsf( n[0] ) + fabsf( n[1] ) + fabsf( n[2] );
+		if( s == 0.0f ) {
+			x = y = 0.0f;
+			return;
+		}
+		x = n[0] / s;
+		y = n[1] / s;
+		if( n[2] < 0.0f ) {
+			float t = x;
+			x = ( 1.0f - fabsf( y ) ) * Sign( t );
+			y = ( 1.0f - fabsf( t ) ) * Sign( y );
+		}
+	}
+	
+}
+
+namespace r3 {
+	
+	ushort FloatToHalf( float f ) {
+		uint x;
+		memcpy( &x, &f, sizeof( x ) );
+		uint sign = ( x >> 16 ) & 0x8000;
+		uint exponent = ( x >> 23 ) & 0xff;
+		uint mantissa = x & 0x7fffff;
+		if( exponent == 0xff ) {
+			return ushort( sign | 0x7c00 | ( mantissa ? 0x200 | ( mantissa >> 13 ) : 0 ) );
+		}
+		int e = int( exponent ) - 127 + 15;
+		if( e >= 31 ) {
+			return ushort( sign | 0x7c00 );
+		}
+		uint h, rest, half;
+		if( e <= 0 ) {
+			// denormal, or too small even for that
+			if( e < -10 ) {
+				return ushort( sign );
+			}
+			mantissa |= 0x800000;
+			int shift = 14 - e;
+			h = mantissa >> shift;
+			rest = mantissa & ( ( 1u << shift ) - 1 );
+			half = 1u << ( shift - 1 );
+		} else {
+			h = ( uint( e ) << 10 ) | ( mantissa >> 13 );
+			rest = mantissa & 0x1fff;
+			half = 0x1000;
+		}
+		// a carry out of the mantissa correctly bumps the exponent
+		if( rest > half || ( rest == half && ( h & 1 ) ) ) {
+			h++;
+		}
+		return ushort( sign | h );
+	}
+	
+	float HalfToFloat( ushort h ) {
+		uint sign = uint( h & 0x8000 ) << 16;
+		uint exponent = ( h >> 10 ) & 0x1f;
+		uint mantissa = h & 0x3ff;
+		uint x;
+		if( exponent == 0 ) {
+			float f = ldexpf( float( mantissa ), -24 );
+			return sign ? -f : f;
+		} else if( exponent == 31 ) {
+			x = sign | 0x7f800000 | ( mantissa << 13 );
+		} else {
+			x = sign | ( ( exponent + 112 ) << 23 ) | ( mantissa << 13 );
+		}
+		float f;
+		memcpy( &f, &x, sizeof( f ) );
+		return f;
+	}
+	
+	void EncodeOctahedral( const float * n, signed char * oct ) {
+		float x, y;
+		FoldOctahedral( n, x, y );
+		// of the four nearest codes, the one that decodes closest
+		float len = sqrtf( n[0] * n[0] + n[1] * n[1] + n[2] * n[2] );
+		float bestDot = -2.0f;
+		for( int i = 0; i < 4; i++ ) {
+			signed char c[2];
+			c[0] = ToSnorm8( ( i & 1 ? ceilf( x * 127.0f ) : floorf( x * 127.0f ) ) / 127.0f );
+			c[1] = ToSnorm8( ( i & 2 ? ceilf( y * 127.0f ) : floorf( y * 127.0f ) ) / 127.0f );
+			float d[3];
+			DecodeOctahedral( c, d );
+			float dot = len > 0.0f ? ( d[0] * n[0] + d[1] * n[1] + d[2] * n[2] ) / len : 0.0f;
+			if( dot > bestDot ) {
+				bestDot = dot;
+				oct[0] = c[0];
+				oct[1] = c[1];
+			}
+		}
+	}
+	
+	void DecodeOctahedral( const signed char * oct, float * n ) {
+		float x = max( -1.0f, oct[0] / 127.0f );
+		float y = max( -1.0f, oct[1] / 127.0f );
+		float z = 1.0f - fabsf( x ) - fabsf( y );
+		if( z < 0.0f ) {
+			float t = x;
+			x = ( 1.0f - fabsf( y ) ) * Sign( t );
+			y = ( 1.0f - fabsf( t ) ) * Sign( y );
+		}
+		float s = 1.0f / sqrtf( x * x + y * y + z * z );
+		n[0] = x * s;
+		n[1] = y * s;
+		n[2] = z * s;
+	}
+	
+	QuantizedLayout GetQuantizedLayout( int varying, QuantizeTexCoordEnum texCoords ) {
+		QuantizedLayout l;
+		l.texCoords = texCoords;
+		int offset = 0;
+		if( varying & Varying_PositionBit ) {
+			l.positionOffset = offset;
+			offset += 3 * sizeof( ushort );
+		}
+		if( varying & Varying_NormalBit ) {
+			l.normalOffset = offset;
+			offset += 2;
+		}
+		offset = Align4( offset );
+		if( varying & Varying_TexCoord0Bit ) {
+			l.texCoordOffset = offset;
+			offset += 2 * sizeof( ushort );
+		}
+		l.stride = offset;
+		return l;
+	}
+	
+	void QuantizeVertexes( const float * src, int varying, int numVertexes, const QuantizedLayout & layout, vector< uchar > & dst, Dequantize & dequantize ) {
+		int comps = 0;
+		int positionComp = -1, normalComp = -1, texCoordComp = -1;
+		if( varying & Varying_PositionBit ) {
+			positionComp = comps;
+			comps += 3;
+		}
+		if( varying & Varying_NormalBit ) {
+			normalComp = comps;
+			comps += 3;
+		}
+		if( varying & Varying_TexCoord0Bit ) {
+			texCoordComp = comps;
+			comps += 2;
+		}
+		
+		dequantize = Dequantize();
+		if( positionComp >= 0 && numVertexes > 0 ) {
+			Bounds3f b;
+			for( int i = 0; i < numVertexes; i++ ) {
+				b.Add( Vec3f( src + i * comps + positionComp ) );
+			}
+			dequantize.positionOffset = b.Min();
+			dequantize.positionScale = b.Max() - b.Min();
+		}
+		bool unormTexCoords = layout.texCoords == QuantizeTexCoord_Unorm16;
+		if( texCoordComp >= 0 && unormTexCoords && numVertexes > 0 ) {
+			Bounds2f b;
+			for( int i = 0; i < numVertexes; i++ ) {
+				b.Add( Vec2f( src + i * comps + texCoordComp ) );
+			}
+			dequantize.texCoordOffset = b.Min();
+			dequantize.texCoordScale = b.Max() - b.Min();
+		}
+		
+		dst.assign( numVertexes * layout.stride, 0 );
+		const Vec3f & po = dequantize.positionOffset;
+		const Vec3f & ps = dequantize.positionScale;
+		const Vec2f & to = dequantize.texCoordOffset;
+		const Vec2f & ts = dequantize.texCoordScale;
+		for( int i = 0; i < numVertexes; i++ ) {
+			const float * v = src + i * comps;
+			uchar * q = numVertexes ? &dst[ i * layout.stride ] : NULL;
+			if( positionComp >= 0 && layout.positionOffset >= 0 ) {
+				const float * p = v + positionComp;
+				ushort u[3] = { ToUnorm16( p[0], po.x, ps.x ), ToUnorm16( p[1], po.y, ps.y ), ToUnorm16( p[2], po.z, ps.z ) };
+				memcpy( q + layout.positionOffset, u, sizeof( u ) );
+			}
+			if( normalComp >= 0 && layout.normalOffset >= 0 ) {
+				EncodeOctahedral( v + normalComp, (signed char *)( q + layout.normalOffset ) );
+			}
+			if( texCoordComp >= 0 && layout.texCoordOffset >= 0 ) {
+				const float * t = v + texCoordComp;
+				ushort u[2];
+				if( unormTexCoords ) {
+					u[0] = ToUnorm16( t[0], to.x, ts.x );
+					u[1] = ToUnorm16( t[1], to.y, ts.y );
+				} else {
+					u[0] = FloatToHalf( t[0] );
+					u[1] = FloatToHalf( t[1] );
+				}
+				memcpy( q + layout.texCoordOffset, u, sizeof( u ) );
+			}
+		}
+	}
+	
+	void DequantizeVertexes( const uchar * src, int varying, int numVertexes, const QuantizedLayout & layout, const Dequantize & dequantize, float * dst ) {
+		bool position = ( varying & Varying_PositionBit ) && layout.positionOffset >= 0;
+		bool normal = ( varying & Varying_NormalBit ) && layout.normalOffset >= 0;
+		bool texCoord = ( varying & Varying_TexCoord0Bit ) && layout.texCoordOffset >= 0;
+		bool unormTexCoords = layout.texCoords == QuantizeTexCoord_Unorm16;
+		Vec3f ps = dequantize.positionScale / Unorm16Max;
+		const Vec3f & po = dequantize.positionOffset;
+		Vec2f ts = dequantize.texCoordScale / Unorm16Max;
+		const Vec2f & to = dequantize.texCoordOffset;
+		for( int i = 0; i < numVertexes; i++ ) {
+			const uchar * q = src + i * layout.stride;
+			if( position ) {
+				ushort u[3];
+				memcpy( u, q + layout.positionOffset, sizeof( u ) );
+				dst[0] = u[0] * ps.x + po.x;
+				dst[1] = u[1] * ps.y + po.y;
+				dst[2] = u[2] * ps.z + po.z;
+				dst += 3;
+			}
+			if( normal ) {
+				DecodeOctahedral( (const signed char *)( q + layout.normalOffset ), dst );
+				dst += 3;
+			}
+			if( texCoord ) {
+				ushort u[2];
+				memcpy( u, q + layout.texCoordOffset, sizeof( u ) );
+				if( unormTexCoords ) {
+					dst[0] = u[0] * ts.x + to.x;
+					dst[1] = u[1] * ts.y + to.y;
+				} else {
+					dst[0] = HalfToFloat( u[0] );
+					dst[1] = HalfToFloat( u[1] );
+				}
+				dst += 2;
+			}
+		}
+	}
+	
+}
@@ -0,0 +1,150 @@
+/*
+ *  metrics
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#include "r3/metrics.h"
+
+#include "r3/command.h"
+#include "r3/output.h"
+#include "r3/thread.h"
+
+#include <map>
+#include <vector>
+
+using namespace std;
+using namespace r3;
+
+namespace {
+	
+	// We have to do this to have static initialization of metrics work.
+	struct Metrics {
+		vector< Metric * > list;
+		map< Metric *, double > lastSnapshot;
+	};
+	Metrics * metrics = NULL;
+	Mutex metricsMutex;
+	
+	void InitMetrics() {
+		if( metrics == NULL ) {
+			metrics = new Metrics;
+		}
+	}
+	
+	// metrics command
+	void MetricsCmd( const vector< Token > & tokens ) {
+		InitMetrics();
+		ScopedMutex m( metricsMutex, R3_LOC );
+		for( int i = 0; i < (int)metrics->list.size(); i++ ) {
+			Metric * mt = metrics->list[ i ];
+			double v = mt->Value();
+			double delta = v - metrics->lastSnapshot[ mt ];
+			metrics->lastSnapshot[ mt ] = v;
+			Output( "%s = %s (%+.0f)", mt->Name().Str().c_str(), mt->Get().c_str(), delta );
+		}
+	}
+	CommandFunc MetricsCmdCmd( "metrics", "prints all metrics and their change since the last metrics command", MetricsCmd );
+	
+	string Int64ToString( int64 v ) {
+		char buf[32];
+		r3Sprintf( buf, "%lld", v );
+		return buf;
+	}
+	
+}
+
+namespace r3 {
+	
+	Metric::Metric( const char * metricName, const char * metricDesc ) : Var( metricName, metricDesc, Var_ReadOnly ) {
+		InitMetrics();
+		metrics->list.push_back( this );
+	}
+	
+	string MetricCounter::Get() const {
+		return Int64ToString( GetVal() );
+	}
+	
+	string MetricGauge::Get() const {
+		return Int64ToString( GetVal() );
+	}
+	
+	void MetricHistogram::Record( uint64 nanoseconds ) {
+		uint64 us = nanoseconds / 1000;
+		int b = 0;
+		while( b < R3_METRIC_HISTOGRAM_BUCKETS - 1 && ( uint64( 1 ) << b ) <= us ) {
+			b++;
+		}
+		AtomicAdd( &buckets[ b ], uint( 1 ) );
+		AtomicAdd( &count, int64( 1 ) );
+		AtomicAdd( &sumNs, int64( nanoseconds ) );
+		int64 m = AtomicLoad( &maxNs );
+		while( int64( nanoseconds ) > m && AtomicCompareAndSwap( &maxNs, m, int64( nanoseconds ) ) == false ) {
+			m = AtomicLoad( &maxNs );
+		}
+	}
+	
+	double MetricHistogram::Percentile( double p ) const {
+		int64 n = AtomicLoad( &count );
+		int64 target = int64( p * n + 0.5 );
+		int64 seen = 0;
+		for( int b = 0; b < R3_METRIC_HISTOGRAM_BUCKETS; b++ ) {
+			seen += AtomicLoad( &buckets[ b ] );
+			if( seen >= target ) {
+				double ms = ( uint64( 1 ) << b ) / 1000.0;
+				double maxMs = AtomicLoad( &maxNs ) / 1e6;
+				return ms < maxMs ? ms : maxMs;
+			}
+		}
+		return AtomicLoad( &maxNs ) / 1e6;
+	}
+	
+	string MetricHistogram::Get() const {
+		int64 n = AtomicLoad( &count );
+		if( n == 0 ) {
+			return "n=0";
+		}
+		char buf[256];
+		r3Sprintf( buf, "n=%lld avg=%.3fms p50<%.3fms p90<%.3fms p99<%.3fms max=%.3fms", n,
+		          AtomicLoad( &sumNs ) / 1e6 / n, Percentile( 0.5 ), Percentile( 0.9 ), Percentile( 0.99 ), AtomicLoad( &maxNs ) / 1e6 );
+		return buf;
+	}
+	
+}
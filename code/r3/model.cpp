@@ -43,9 +43,13 @@
 #include "r3/model.h"
 
 #include "r3/command.h"
+#include "r3/glstate.h"
 #include "r3/output.h"
 #include "r3/thread.h"
 
+#include <math.h>
+
+#include <algorithm>
 #include <map>
 
 using namespace std;
@@ -83,11 +87,26 @@ namespace {
     CommandFunc ListModelsCmd( "listmodels", "lists defined models", ListModels );
     
     
-#define MAX_VERTS 32768
 	IndexBuffer *quadIndexBuffer = NULL;
+	// 32 bit quad indexes for more vertexes, grown as needed
+	IndexBuffer *quadIndexBuffer32 = NULL;
+	int quadIndexBuffer32Vertexes = 0;
     
 	//int attrib_sizes[] = { 12, 4, 12, 8, 8 };
 	
+	template< typename T >
+	void MakeQuadIndexes( int numVerts, vector< T > & quadIndexes ) {
+		quadIndexes.resize( numVerts * 3 / 2 );
+		for ( int i = 0; i < numVerts / 4; i++ )  {
+			quadIndexes[ i * 6 + 0 ] = i * 4 + 0;  // first triangle
+			quadIndexes[ i * 6 + 1 ] = i * 4 + 1;
+			quadIndexes[ i * 6 + 2 ] = i * 4 + 2;			
+			quadIndexes[ i * 6 + 3 ] = i * 4 + 0;  // second triangle
+			quadIndexes[ i * 6 + 4 ] = i * 4 + 2;
+			quadIndexes[ i * 6 + 5 ] = i * 4 + 3;
+		}
+	}
+	
 	Mutex initQuadMutex;
 	void InitQuadIndexes() {
 		if ( quadIndexBuffer ) { // early out without acquiring the mutex
@@ -97,80 +116,75 @@ namespace {
 		if ( quadIndexBuffer ) { // early out again if we weren't the first one in...
 			return;
 		}
-		GLushort quadIndexes[ MAX_VERTS * 3 / 2 ];
-		for ( int i = 0; i < MAX_VERTS / 4; i++ )  {
-			quadIndexes[ i * 6 + 0 ] = i * 4 + 0;  // first triangle
-			quadIndexes[ i * 6 + 1 ] = i * 4 + 1;
-			quadIndexes[ i * 6 + 2 ] = i * 4 + 2;			
-			quadIndexes[ i * 6 + 3 ] = i * 4 + 0;  // second triangle
-			quadIndexes[ i * 6 + 4 ] = i * 4 + 2;
-			quadIndexes[ i * 6 + 5 ] = i * 4 + 3;
-		}
+		vector< GLushort > quadIndexes;
+		MakeQuadIndexes( MaxQuadVertexes, quadIndexes );
 		quadIndexBuffer = new IndexBuffer( "quadIndexBuffer_ib" );
-		quadIndexBuffer->SetData( sizeof( quadIndexes ), quadIndexes );
+		quadIndexBuffer->SetData( (int)quadIndexes.size() * sizeof( GLushort ), &quadIndexes[0] );
+	}
+	
+	IndexBuffer * GetQuadIndexBuffer32( int numVerts ) {
+		if ( quadIndexBuffer32Vertexes < numVerts ) {
+			int n = max( quadIndexBuffer32Vertexes, MaxQuadVertexes );
+			while ( n < numVerts ) {
+				n *= 2;
+			}
+			vector< GLuint > quadIndexes;
+			MakeQuadIndexes( n, quadIndexes );
+			if ( quadIndexBuffer32 == NULL ) {
+				quadIndexBuffer32 = new IndexBuffer( "quadIndexBuffer32_ib" );
+			}
+			quadIndexBuffer32->SetData( (int)quadIndexes.size() * sizeof( GLuint ), &quadIndexes[0] );
+			quadIndexBuffer32Vertexes = n;
+		}
+		return quadIndexBuffer32;
+	}
+	
+	// Narrows the indexes to 16 bits if they all fit, returns the GL type.
+	GLenum PackIndexes( const uint * indexes, int numIndexes, vector< ushort > & packed ) {
+		uint maxIndex = 0;
+		for ( int i = 0; i < numIndexes; i++ ) {
+			maxIndex = max( maxIndex, indexes[ i ] );
+		}
+		if ( maxIndex > 0xffff ) {
+			return GL_UNSIGNED_INT;
+		}
+		packed.assign( indexes, indexes + numIndexes );
+		return GL_UNSIGNED_SHORT;
 	}
 
-    void EnableAttributeArray( const AttributeArray & a ) {
-        if( a.index < 16 ) {
-            glEnableVertexAttribArray( a.index );
-            glVertexAttribPointer( a.index, a.size, a.type, a.normalized, a.stride, a.pointer );
-            return;
-        }
-        switch ( a.index ) {
-            case GL_VERTEX_ARRAY:
-                glEnableClientState( a.index );
-                glVertexPointer( a.size, a.type, a.stride, a.pointer);
-                break;
-            case GL_NORMAL_ARRAY:
-                glEnableClientState( a.index );
-                glNormalPointer( a.type, a.stride, a.pointer );
-                break;
-            case GL_COLOR_ARRAY:
-                glEnableClientState( a.index );
-                glColorPointer( a.size, a.type, a.stride, a.pointer );
-                break;
-            case GL_TEXTURE0:
-            case GL_TEXTURE1:
-            case GL_TEXTURE2:
-            case GL_TEXTURE3:
-                glEnableClientStateIndexedEXT( GL_TEXTURE_COORD_ARRAY, a.index - GL_TEXTURE0 );
-                glMultiTexCoordPointerEXT( a.index, a.size, a.type, a.stride, a.pointer );
-                break;
-            default:
-                break;
-        }
-    }
-
-    void DisableAttributeArray( const AttributeArray & a ) {
-        if( a.index < 16 ) {
-            glDisableVertexAttribArray( a.index );
-            return;
-        }
-        switch ( a.index ) {
-            case GL_VERTEX_ARRAY:
-                glDisableClientState( a.index );
-                break;
-            case GL_NORMAL_ARRAY:
-                glDisableClientState( a.index );
-                break;
-            case GL_COLOR_ARRAY:
-                glDisableClientState( a.index );
-                break;
-            case GL_TEXTURE0:
-            case GL_TEXTURE1:
-            case GL_TEXTURE2:
-            case GL_TEXTURE3:
-                glDisableClientStateIndexedEXT( GL_TEXTURE_COORD_ARRAY, a.index - GL_TEXTURE0 );
-                break;
-            default:
-                break;
+    // Arrays stay enabled after a draw, the next draw disables what it doesn't use.
+    uint SetAttributeArrays( const vector< AttributeArray > & attr, int offset ) {
+        uint arrays = 0;
+        for( int i = 0; i < (int)attr.size(); i++ ) {
+            const AttributeArray & a = attr[i];
+            StateArrayPointer( a.index, a.size, a.type, a.normalized, a.stride, (const char *)a.pointer + offset );
+            arrays |= StateArrayBit( a.index );
         }
+        return arrays;
     }
     
 }
 
 namespace r3 {
     
+    IndexBuffer * GetQuadIndexBuffer() {
+        InitQuadIndexes();
+        return quadIndexBuffer;
+    }
+    
+    float ProjectedSize( const Bounds3f & bounds, float distance, float fovy, float viewportHeight ) {
+        if( bounds.IsClear() ) {
+            return 0.0f;
+        }
+        float radius = ( bounds.Max() - bounds.Min() ).Length() * 0.5f;
+        // from inside the sphere it covers everything
+        if( distance <= radius ) {
+            return viewportHeight;
+        }
+        float tangent = radius / sqrtf( distance * distance - radius * radius );
+        return min( viewportHeight, tangent / tanf( ToRadians( fovy ) * 0.5f ) * viewportHeight );
+    }
+    
     void InitModel() {
         if ( initialized ) {
             return;
@@ -190,13 +204,22 @@ namespace r3 {
         Output( "Shutting down r3::Model." );
         delete modelDatabase;
         modelDatabase = NULL;
+        // owned by the buffer database, but InitModel must make a new one
+        delete quadIndexBuffer;
+        quadIndexBuffer = NULL;
+        delete quadIndexBuffer32;
+        quadIndexBuffer32 = NULL;
+        quadIndexBuffer32Vertexes = 0;
         initialized = false;
     }
     
     Model::Model( const string & mName ) 
     : name( mName )
     , vertexBuffer( NULL )
-    , indexBuffer( NULL ) {
+    , indexBuffer( NULL )
+    , indexType( GL_UNSIGNED_SHORT )
+    , numVerts( 0 )
+    , lod( 0 ) {
         assert( modelDatabase->models.count( name ) == 0 );
         modelDatabase->models[ name ] = this;
     }
@@ -205,6 +228,8 @@ namespace r3 {
         modelDatabase->models.erase( name );
         delete vertexBuffer;
         delete indexBuffer;
+        GetVertexArena().Free( vertexRange );
+        GetIndexArena().Free( indexRange );
     }
     
     VertexBuffer & Model::GetVertexBuffer() {
@@ -220,34 +245,93 @@ namespace r3 {
         return *indexBuffer;
     }
     
+    void Model::SetIndexes( const uint * indexes, int numIndexes ) {
+        vector< ushort > packed;
+        indexType = PackIndexes( indexes, numIndexes, packed );
+        if( indexType == GL_UNSIGNED_SHORT ) {
+            GetIndexBuffer().SetData( numIndexes * sizeof( ushort ), packed.empty() ? NULL : &packed[0] );
+        } else {
+            GetIndexBuffer().SetData( numIndexes * sizeof( uint ), indexes );
+        }
+    }
+    
+    int Model::SelectLod( float projectedSize, float maxErrorPixels ) const {
+        float diameter = ( bounds.Max() - bounds.Min() ).Length();
+        if( bounds.IsClear() || diameter <= 0.0f ) {
+            return 0;
+        }
+        float pixelsPerUnit = projectedSize / diameter;
+        for( int l = (int)lods.size() - 1; l > 0; l-- ) {
+            if( lods[ l ].error * pixelsPerUnit <= maxErrorPixels ) {
+                return l;
+            }
+        }
+        return 0;
+    }
+    
+    void Model::SetArenaGeometry( const void * verts, int vertBytes, int stride, const uint * indexes, int numIndexes, BufferAllocListener * refill ) {
+        GetVertexArena().Free( vertexRange );
+        GetIndexArena().Free( indexRange );
+        vertexRange = GetVertexArena().Alloc( vertBytes, stride, verts, refill );
+        indexRange = BufferRange();
+        if( numIndexes ) {
+            vector< ushort > packed;
+            indexType = PackIndexes( indexes, numIndexes, packed );
+            if( indexType == GL_UNSIGNED_SHORT ) {
+                indexRange = GetIndexArena().Alloc( numIndexes * sizeof( ushort ), 4, &packed[0], refill );
+            } else {
+                indexRange = GetIndexArena().Alloc( numIndexes * sizeof( uint ), 4, indexes, refill );
+            }
+        }
+    }
+    
+    void Model::RestoreArenaGeometry( Buffer * block, const void * verts, const uint * indexes ) {
+        if( block == vertexRange.buffer ) {
+            block->SetSubdata( vertexRange.offset, vertexRange.size, verts );
+        }
+        if( block == indexRange.buffer ) {
+            if( indexType == GL_UNSIGNED_SHORT ) {
+                vector< ushort > packed( indexes, indexes + indexRange.size / sizeof( ushort ) );
+                block->SetSubdata( indexRange.offset, indexRange.size, &packed[0] );
+            } else {
+                block->SetSubdata( indexRange.offset, indexRange.size, indexes );
+            }
+        }
+    }
+    
     void Model::Draw() {
         assert( attr.size() );
-        assert( vertexBuffer );
+        assert( vertexBuffer || vertexRange.buffer );
         
-		vertexBuffer->Bind();
-        for( int i = 0; i < (int)attr.size(); i++ ) {
-            EnableAttributeArray( attr[i] );
+        FlushQuads();
+        if( vertexRange.buffer ) {
+            vertexRange.buffer->Bind();
+        } else {
+            vertexBuffer->Bind();
         }
+        StateEnableArrays( SetAttributeArrays( attr, vertexRange.offset ) );
         
-		if ( indexBuffer ) {
+		if ( indexRange.buffer ) {
+			indexRange.buffer->Bind();
+			int first = lods.size() ? lods[ lod ].firstIndex : 0;
+			glDrawElements( prim, GetNumVertexes(), indexType, (const char *)NULL + indexRange.offset + first * GetIndexSize() );
+		} else if ( indexBuffer ) {
 			indexBuffer->Bind();
-			glDrawElements( prim, indexBuffer->GetSize() / 2, GL_UNSIGNED_SHORT, (void *)0 );
-			indexBuffer->Unbind();
+			int first = lods.size() ? lods[ lod ].firstIndex : 0;
+			glDrawElements( prim, GetNumVertexes(), indexType, (const char *)NULL + first * GetIndexSize() );
 		} else {
-            // FIXME: This needs to be passed some other way.
-			assert( numVerts < MAX_VERTS ); 
 			if ( prim == GL_QUADS ) { // support non-indexed quads
-				quadIndexBuffer->Bind();
-				glDrawElements( GL_TRIANGLES, numVerts * 3 / 2, GL_UNSIGNED_SHORT, 0 );
-				quadIndexBuffer->Unbind();
+				if ( numVerts <= MaxQuadVertexes ) {
+					GetQuadIndexBuffer()->Bind();
+					glDrawElements( GL_TRIANGLES, numVerts * 3 / 2, GL_UNSIGNED_SHORT, 0 );
+				} else {
+					GetQuadIndexBuffer32( numVerts )->Bind();
+					glDrawElements( GL_TRIANGLES, numVerts * 3 / 2, GL_UNSIGNED_INT, 0 );
+				}
 			} else {	
 				glDrawArrays( prim, 0, numVerts );
 			}
 		}
-        for( int i = 0; i < (int)attr.size(); i++ ) {
-            DisableAttributeArray( attr[i] );
-        }
-        vertexBuffer->Unbind();
     }
     
     
@@ -45,225 +45,836 @@
 
 #include "r3/common.h"
 #include "r3/filesystem.h"
+#if R3_HAS_GL
+#include "r3/meshcache.h"
+#endif
+#include "r3/meshopt.h"
+#include "r3/meshquant.h"
 #include "r3/output.h"
-#include "r3/parse.h"
+#include "r3/profile.h"
+#include "r3/thread.h"
+#include "r3/var.h"
+#include "r3/varying.h"
 
+#include <assert.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
 #include <vector>
-#include <map>
 
 using namespace r3;
 using namespace std;
 
 namespace {
-
-	enum Mode {
-		Mode_INVALID,
-		Mode_Vertex,
-		Mode_Face,
-		Mode_Failed
+	
+	// powers of ten for the number parser, exact in a double up to 1e22
+	const double Pow10[] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
 	};
 	
+	inline bool IsDigit( char c ) {
+		return c >= '0' && c <= '9';
+	}
 	
+	inline void SkipSpace( const char * & p, const char * end ) {
+		while( p < end && ( *p == ' ' || *p == '\t' || *p == '\r' ) ) {
+			p++;
+		}
+	}
 	
-	struct ParseState {
-		ParseState() : mode( Mode_Face ), varying( 0 ), indexBase( 0 ) {}
-		Mode mode;
-		int varying;
-		vector< Vec3f > v;
-		vector< Vec2f > vt;
-		vector< Vec3f > vn;
-		int sizes[3];
-		map< r3::uint64, int > unique;
-		vector< float > vbdata;
-		vector< r3::ushort> ibdata;
-		int indexBase;
-
-		void ChangeMode( Mode newMode ) {
-			if ( mode == newMode ) {
-				return;
-			}
-			if ( newMode == Mode_Vertex ) {
-				v.clear();
-				vn.clear();
-				vt.clear();
-				int components = 0;
-				components += varying & Varying_PositionBit ? 3 : 0;
-				components += varying & Varying_NormalBit ? 3 : 0;
-				components += varying & Varying_TexCoord0Bit ? 2 : 0;
-				if ( components ) {
-					indexBase = (int)vbdata.size() / components;
-				} else {
-					indexBase = 0;
-				}
-				unique.clear();
-			} else if ( newMode == Mode_Face ) {
-				sizes[0] = (int)v.size();
-				sizes[1] = (int)vt.size();
-				sizes[2] = (int)vn.size();
+	inline void SkipLine( const char * & p, const char * end ) {
+		while( p < end && *p != '\n' ) {
+			p++;
+		}
+	}
+	
+	inline bool AtLineEnd( const char * p, const char * end ) {
+		return p == end || *p == '\n' || *p == '#';
+	}
+	
+	// Parses the decimal numbers OBJ exporters write.  Anything unusual,
+	// like long mantissas or big exponents, goes to strtod instead.
+	bool ParseFloat( const char * & p, const char * end, float & val ) {
+		SkipSpace( p, end );
+		const char * start = p;
+		bool neg = false;
+		if( p < end && ( *p == '-' || *p == '+' ) ) {
+			neg = *p == '-';
+			p++;
+		}
+		uint64 mant = 0;
+		int digits = 0;
+		int scale = 0;
+		while( p < end && IsDigit( *p ) ) {
+			mant = mant * 10 + ( *p++ - '0' );
+			digits++;
+		}
+		if( p < end && *p == '.' ) {
+			p++;
+			while( p < end && IsDigit( *p ) ) {
+				mant = mant * 10 + ( *p++ - '0' );
+				digits++;
+				scale--;
+			}
+		}
+		if( digits == 0 ) {
+			p = start;
+			return false;
+		}
+		if( p < end && ( *p == 'e' || *p == 'E' ) ) {
+			p++;
+			bool eneg = false;
+			if( p < end && ( *p == '-' || *p == '+' ) ) {
+				eneg = *p == '-';
+				p++;
+			}
+			int e = 0;
+			while( p < end && IsDigit( *p ) && e < 10000 ) {
+				e = e * 10 + ( *p++ - '0' );
 			}
-			mode = newMode;
+			scale += eneg ? -e : e;
 		}
+		if( digits > 18 || scale < -22 || scale > 22 ) {
+			// strtod wants a terminated string, and the buffer is not one
+			char buf[ 64 ];
+			int len = int( p - start );
+			if( len >= (int)sizeof( buf ) ) {
+				return false;
+			}
+			memcpy( buf, start, len );
+			buf[ len ] = 0;
+			val = float( strtod( buf, NULL ) );
+			return true;
+		}
+		double d = double( mant );
+		d = scale < 0 ? d / Pow10[ -scale ] : d * Pow10[ scale ];
+		val = float( neg ? -d : d );
+		return true;
+	}
+	
+	bool ParseInt( const char * & p, const char * end, int & val ) {
+		bool neg = false;
+		if( p < end && *p == '-' ) {
+			neg = true;
+			p++;
+		}
+		if( p == end || IsDigit( *p ) == false ) {
+			return false;
+		}
+		int i = 0;
+		while( p < end && IsDigit( *p ) ) {
+			i = i * 10 + ( *p++ - '0' );
+		}
+		val = neg ? -i : i;
+		return true;
+	}
+	
+	// one corner of a face, as zero based indexes into v, vt and vn
+	struct ObjCorner {
+		int v, vt, vn;
+		bool operator==( const ObjCorner & rhs ) const {
+			return v == rhs.v && vt == rhs.vt && vn == rhs.vn;
+		}
+	};
+	
+	// Open addressing map from corners to the vertexes made for them,
+	// which are numbered in insertion order.  Slots hold the vertex number,
+	// or -1 when empty.
+	class CornerMap {
+		vector< int > slots;
+		vector< ObjCorner > corners;
+		uint mask;
 		
-		void PushVertexBufferData( int vindex, int vtindex, int vnindex ) {
-			if ( varying & Varying_PositionBit ) {
-				Vec3f p = v[ vindex ];
-				vbdata.push_back( p.x );
-				vbdata.push_back( p.y );
-				vbdata.push_back( p.z );
-				//Output( "pushing vertex [%d] %f, %f, %f", (int)vbdata.size(), p.x, p.y, p.z );
-			}
-			if ( varying & Varying_NormalBit ) {
-				Vec3f n = vn[ vnindex ];
-				vbdata.push_back( n.x );
-				vbdata.push_back( n.y );
-				vbdata.push_back( n.z );
-				//Output( "pushing normal [%d] %f, %f, %f", (int)vbdata.size(), n.x, n.y, n.z );
-			}
-			if ( varying & Varying_TexCoord0Bit ) {
-				Vec2f t = vt[ vindex ];
-				vbdata.push_back( t.x );
-				vbdata.push_back( t.y );
+		static uint Hash( const ObjCorner & c ) {
+			uint h = uint( c.v ) * 0x9e3779b1u;
+			h ^= uint( c.vt ) * 0x85ebca6bu + ( h >> 15 );
+			h ^= uint( c.vn ) * 0xc2b2ae35u + ( h >> 13 );
+			return h ^ ( h >> 16 );
+		}
+		
+		void Grow() {
+			slots.assign( slots.size() * 2, -1 );
+			mask = uint( slots.size() - 1 );
+			for( int i = 0; i < (int)corners.size(); i++ ) {
+				uint s = Hash( corners[ i ] ) & mask;
+				while( slots[ s ] >= 0 ) {
+					s = ( s + 1 ) & mask;
+				}
+				slots[ s ] = i;
 			}
 		}
 		
-		r3::ushort ProcessIndex( const Token & t ) {
-			string s = t.valString;
-			vector< int > ind;
-			int bits[] = { Varying_PositionBit, Varying_TexCoord0Bit, Varying_NormalBit };
-			int var = 0;
-			while( s.size() > 0 ) {
-				if ( ind.size() > 3 ) {
+	public:
+		CornerMap() : slots( 1024, -1 ), mask( 1023 ) {}
+		
+		int Size() const {
+			return (int)corners.size();
+		}
+		
+		// in vertex order
+		const vector< ObjCorner > & Corners() const {
+			return corners;
+		}
+		
+		// Returns the vertex for c, and sets added if it is new.
+		int Insert( const ObjCorner & c, bool & added ) {
+			if( corners.size() * 2 >= slots.size() ) {
+				Grow();
+			}
+			uint s = Hash( c ) & mask;
+			for( ;; ) {
+				int i = slots[ s ];
+				if( i < 0 ) {
 					break;
 				}
-				string t;
-				while( s.size() > 0 && ( s[0] != '/' ) ) {
-					t += s[0];
-					s.erase( s.begin() );
+				if( corners[ i ] == c ) {
+					added = false;
+					return i;
 				}
-				if ( s.size() > 0 ) {
-					s.erase( s.begin() );
+				s = ( s + 1 ) & mask;
+			}
+			slots[ s ] = (int)corners.size();
+			corners.push_back( c );
+			added = true;
+			return slots[ s ];
+		}
+	};
+	
+	// face corner indexes are stored as read, with this for the ones left out
+	const int AbsentIndex = INT_MIN;
+	
+	struct ObjFace {
+		int line;       // in the chunk, from 0
+		int numCorners;
+		int counts[3];  // v, vt and vn read in the chunk before the face
+	};
+	
+	// A piece of the file that starts at a line.  Chunks are parsed on their
+	// own, and only then can their indexes be resolved, because negative
+	// ones count back from the vertexes of the chunks before.
+	struct ObjChunk {
+		ObjChunk() : begin( NULL ), end( NULL ), lines( 0 ), firstLine( 1 ), varying( 0 ), numTriangles( 0 ), firstTriangle( 0 ), firstVertex( 0 ), errorLine( -1 ), error( NULL ) {
+			bases[0] = bases[1] = bases[2] = 0;
+		}
+		const char * begin;
+		const char * end;
+		int lines;
+		int firstLine;
+		vector< Vec3f > v;
+		vector< Vec2f > vt;
+		vector< Vec3f > vn;
+		vector< ObjFace > faces;
+		vector< int > corners;  // v, vt, vn for each corner, then resolved in place
+		int bases[3];           // v, vt and vn in the chunks before
+		int varying;            // of the chunk's first corner
+		CornerMap unique;       // the chunk's own vertexes
+		vector< int > cornerVertexes; // each corner's vertex in unique
+		vector< int > vertexes; // unique's vertexes numbered for the whole file
+		int numTriangles;
+		int firstTriangle;
+		int firstVertex;        // vertexes below this came from earlier chunks
+		int errorLine;
+		const char * error;
+		
+		bool Fail( int line, const char * what ) {
+			errorLine = line;
+			error = what;
+			return false;
+		}
+		
+		// v/vt/vn, v//vn, v/vt or v
+		bool ParseCorner( const char * & p, const char * e ) {
+			int c[3] = { 0, AbsentIndex, AbsentIndex };
+			if( ParseInt( p, e, c[0] ) == false ) {
+				return Fail( lines, "bad position index" );
+			}
+			if( p < e && *p == '/' ) {
+				p++;
+				if( p < e && *p != '/' && ParseInt( p, e, c[1] ) == false ) {
+					return Fail( lines, "bad texcoord index" );
 				}
-				float f;
-				if ( StringToFloat( t, f ) ) {
-					var |= bits[ ind.size() ];
-					int i = f;
-					if ( i < 0 ) {
-						i += sizes[ ind.size() ];
-					} else {
-						i -= 1;
+				if( p < e && *p == '/' ) {
+					p++;
+					if( ParseInt( p, e, c[2] ) == false ) {
+						return Fail( lines, "bad normal index" );
 					}
-					ind.push_back( i );
-				} else {
-					ind.push_back( 0 );
 				}
 			}
-			if ( varying == 0 ) {
-				varying = var;
-			}
-			if ( varying != var ) {
-				Output( "modelobj: Varying not allowed to mismatch in face index." );
-				mode = Mode_Failed;
-			}
-			while ( ind.size() < 3 ) {
-				ind.push_back( 0 );
-			}
-			r3::uint64 r = 0;
-			for ( int i = 0; i < (int)ind.size(); i++ ) {
-				r |= ( r3::uint64( ind[i] ) & 0xfffff ) << ( i * 20 );
-			}
-			if ( unique.count( r ) == 0 ) {
-				int sz = (int)unique.size();
-				unique[ r ] = sz;
-				PushVertexBufferData( ind[0], ind[1], ind[2] );
-			}
-			return unique[ r ] + indexBase;
-		} 
+			corners.push_back( c[0] );
+			corners.push_back( c[1] );
+			corners.push_back( c[2] );
+			return true;
+		}
 		
-		void ProcessLine( const vector< Token > & tokens ) {
-			if ( mode == Mode_Failed ) {
-				return;
+		bool ParseLine( const char * & p, const char * e ) {
+			SkipSpace( p, e );
+			if( AtLineEnd( p, e ) ) {
+				return true;
 			}
-			if ( tokens.size() > 0 ) {
-				// comment
-				if ( tokens[0].valString[0] == '#' ) {
-					return;
-				} else if ( tokens[0].valString == "v" ) {	 // vertex position
-					ChangeMode( Mode_Vertex );
-					if ( tokens.size() < 4 || tokens.size() > 5 ) {
-						mode = Mode_Failed;
-					}
-					Vec3f p;
-					p.x = tokens[1].valNumber;
-					p.y = tokens[2].valNumber;
-					p.z = tokens[3].valNumber;
-					if ( tokens.size() == 5 ) {
-						p *= 1.0 / tokens[4].valNumber;
+			if( p[0] == 'v' && p + 1 < e ) {
+				char kind = p[1];
+				p += 2;
+				if( kind == ' ' || kind == '\t' ) { // vertex position
+					Vec3f pos;
+					if( ! ParseFloat( p, e, pos.x ) || ! ParseFloat( p, e, pos.y ) || ! ParseFloat( p, e, pos.z ) ) {
+						return Fail( lines, "bad vertex" );
 					}
-					v.push_back( p );
-				} else if ( tokens[0].valString == "vt" ) {	 // vertex texcoord
-					ChangeMode( Mode_Vertex );
-					if ( tokens.size() != 3 ) {
-						mode = Mode_Failed;
+					float w;
+					if( ParseFloat( p, e, w ) ) {
+						pos *= 1.0f / w;
 					}
-					Vec2f t;
-					t.x = tokens[1].valNumber;
-					t.y = tokens[2].valNumber;
-					vt.push_back( t );
-				} else if ( tokens[0].valString == "vn" ) {	 // vertex normal
-					ChangeMode( Mode_Vertex );
-					if ( tokens.size() != 4 ) {
-						mode = Mode_Failed;
+					v.push_back( pos );
+				} else if( kind == 't' ) { // vertex texcoord
+					Vec2f tc;
+					if( ! ParseFloat( p, e, tc.x ) || ! ParseFloat( p, e, tc.y ) ) {
+						return Fail( lines, "bad texcoord" );
 					}
+					vt.push_back( tc );
+				} else if( kind == 'n' ) { // vertex normal
 					Vec3f n;
-					n.x = tokens[1].valNumber;
-					n.y = tokens[2].valNumber;
-					n.z = tokens[3].valNumber;
+					if( ! ParseFloat( p, e, n.x ) || ! ParseFloat( p, e, n.y ) || ! ParseFloat( p, e, n.z ) ) {
+						return Fail( lines, "bad normal" );
+					}
 					vn.push_back( n );
-				} else if ( tokens[0].valString == "f" ) { // a face
-					ChangeMode( Mode_Face );
-					if ( tokens.size() < 4 ) {
-						mode = Mode_Failed;
-						return;
+				} else {
+					SkipLine( p, e );
+					return true;
+				}
+				SkipSpace( p, e );
+				if( AtLineEnd( p, e ) == false ) {
+					return Fail( lines, "extra values" );
+				}
+			} else if( p[0] == 'f' && p + 1 < e && ( p[1] == ' ' || p[1] == '\t' ) ) { // a face
+				p += 2;
+				ObjFace f;
+				f.line = lines;
+				f.numCorners = 0;
+				f.counts[0] = (int)v.size();
+				f.counts[1] = (int)vt.size();
+				f.counts[2] = (int)vn.size();
+				for( ;; ) {
+					SkipSpace( p, e );
+					if( AtLineEnd( p, e ) ) {
+						break;
+					}
+					if( ParseCorner( p, e ) == false ) {
+						return false;
+					}
+					f.numCorners++;
+				}
+				if( f.numCorners < 3 ) {
+					return Fail( lines, "face with fewer than 3 vertexes" );
+				}
+				faces.push_back( f );
+			}
+			// comments, groups, materials and the rest are ignored
+			SkipLine( p, e );
+			return true;
+		}
+		
+		void Parse() {
+			const char * p = begin;
+			while( p < end ) {
+				if( ParseLine( p, end ) == false ) {
+					// faces past the bad line never get resolved
+					return;
+				}
+				if( p < end ) {
+					p++; // the newline
+					lines++;
+				}
+			}
+		}
+		
+		// OBJ indexes count from 1, or back from the latest element if negative.
+		static bool Resolve( int & i, int base, int count ) {
+			i = i < 0 ? base + count + i : i - 1;
+			return i >= 0 && i < base + count;
+		}
+		
+		// Turns the corners into indexes into the whole file's arrays.  Stops
+		// at the first bad one, or at the parse error if there was one.
+		void ResolveCorners() {
+			static const char * bad[] = { "bad position index", "bad texcoord index", "bad normal index" };
+			static const int bits[] = { Varying_PositionBit, Varying_TexCoord0Bit, Varying_NormalBit };
+			int * c = corners.empty() ? NULL : &corners[0];
+			for( int i = 0; i < (int)faces.size(); i++ ) {
+				const ObjFace & f = faces[ i ];
+				for( int j = 0; j < f.numCorners; j++, c += 3 ) {
+					int var = 0;
+					for( int k = 0; k < 3; k++ ) {
+						if( c[ k ] == AbsentIndex ) {
+							c[ k ] = 0;
+							continue;
+						}
+						if( Resolve( c[ k ], bases[ k ], f.counts[ k ] ) == false ) {
+							Fail( f.line, bad[ k ] );
+							faces.resize( i );
+							return;
+						}
+						var |= bits[ k ];
+					}
+					if( varying == 0 ) {
+						varying = var;
 					}
-					r3::ushort i0 = ProcessIndex( tokens[1] );
-					r3::ushort i1 = ProcessIndex( tokens[2] );
-					for ( int i = 3; i < (int)tokens.size(); i++ ) {
-						r3::ushort i2 = ProcessIndex( tokens[i] );
-						ibdata.push_back( i0 );
-						ibdata.push_back( i1 );
-						ibdata.push_back( i2 );
-						//Output( "index [%d] = %d %d %d", (int)ibdata.size(), (int)i0, (int)i1, (int)i2 );
-						i1 = i2; 
+					if( varying != var ) {
+						Fail( f.line, "varying not allowed to mismatch in face index" );
+						faces.resize( i );
+						return;
 					}
 				}
 			}
 		}
+		
+		// Dedups the resolved corners within the chunk.
+		void FindVertexes() {
+			cornerVertexes.resize( corners.size() / 3 );
+			int n = 0;
+			for( int i = 0; i < (int)faces.size(); i++ ) {
+				numTriangles += faces[ i ].numCorners - 2;
+				for( int j = 0; j < faces[ i ].numCorners; j++, n++ ) {
+					ObjCorner oc = { corners[ n * 3 ], corners[ n * 3 + 1 ], corners[ n * 3 + 2 ] };
+					bool added;
+					cornerVertexes[ n ] = unique.Insert( oc, added );
+				}
+			}
+			cornerVertexes.resize( n );
+			vector< int >().swap( corners );
+		}
+	};
+	
+	// The whole file's arrays, shared by the chunk jobs.
+	struct ObjArrays {
+		vector< Vec3f > v;
+		vector< Vec2f > vt;
+		vector< Vec3f > vn;
+		int varying;
+		vector< float > vbdata;
+		vector< int > ibdata;
+	};
+	
+	struct ChunkJob {
+		ObjChunk * chunk;
+		ObjArrays * arrays;
+	};
+	
+	// Once the chunks before are counted, the indexes can be resolved and
+	// the chunk's vertexes found.
+	void ResolveChunk( ChunkJob & job ) {
+		ObjChunk & c = *job.chunk;
+		ObjArrays & a = *job.arrays;
+		c.ResolveCorners();
+		c.FindVertexes();
+		if( c.v.size() ) {
+			memcpy( &a.v[ c.bases[0] ], &c.v[0], c.v.size() * sizeof( Vec3f ) );
+		}
+		if( c.vt.size() ) {
+			memcpy( &a.vt[ c.bases[1] ], &c.vt[0], c.vt.size() * sizeof( Vec2f ) );
+		}
+		if( c.vn.size() ) {
+			memcpy( &a.vn[ c.bases[2] ], &c.vn[0], c.vn.size() * sizeof( Vec3f ) );
+		}
+		vector< Vec3f >().swap( c.v );
+		vector< Vec2f >().swap( c.vt );
+		vector< Vec3f >().swap( c.vn );
+	}
+	
+	// floats per vertex
+	int VaryingComponents( int varying ) {
+		int comps = 0;
+		comps += varying & Varying_PositionBit ? 3 : 0;
+		comps += varying & Varying_NormalBit ? 3 : 0;
+		comps += varying & Varying_TexCoord0Bit ? 2 : 0;
+		return comps;
+	}
+	
+	// Writes the chunk's triangles, and the vertexes it was first to use.
+	void OutputChunk( ChunkJob & job ) {
+		ObjChunk & c = *job.chunk;
+		ObjArrays & a = *job.arrays;
+		int * ib = a.ibdata.empty() ? NULL : &a.ibdata[ c.firstTriangle * 3 ];
+		const int * cv = c.cornerVertexes.empty() ? NULL : &c.cornerVertexes[0];
+		for( int i = 0; i < (int)c.faces.size(); i++ ) {
+			int n = c.faces[ i ].numCorners;
+			int v0 = c.vertexes[ cv[0] ];
+			for( int j = 2; j < n; j++ ) {
+				*ib++ = v0;
+				*ib++ = c.vertexes[ cv[ j - 1 ] ];
+				*ib++ = c.vertexes[ cv[ j ] ];
+			}
+			cv += n;
+		}
+		int comps = VaryingComponents( a.varying );
+		const vector< ObjCorner > & uc = c.unique.Corners();
+		for( int i = 0; i < (int)uc.size(); i++ ) {
+			int vertex = c.vertexes[ i ];
+			if( vertex < c.firstVertex ) {
+				continue;
+			}
+			float * d = &a.vbdata[ vertex * comps ];
+			if ( a.varying & Varying_PositionBit ) {
+				const Vec3f & p = a.v[ uc[ i ].v ];
+				*d++ = p.x;
+				*d++ = p.y;
+				*d++ = p.z;
+			}
+			if ( a.varying & Varying_NormalBit ) {
+				const Vec3f & n = a.vn[ uc[ i ].vn ];
+				*d++ = n.x;
+				*d++ = n.y;
+				*d++ = n.z;
+			}
+			if ( a.varying & Varying_TexCoord0Bit ) {
+				const Vec2f & tc = a.vt[ uc[ i ].vt ];
+				*d++ = tc.x;
+				*d++ = tc.y;
+			}
+		}
+	}
+	
+	const int MaxParseThreads = MaxJobThreads;
+	
+	void RunParse( void * arg ) {
+		static_cast< ObjChunk * >( arg )->Parse();
+	}
+	
+	void RunResolve( void * arg ) {
+		ResolveChunk( *static_cast< ChunkJob * >( arg ) );
+	}
+	
+	void RunOutput( void * arg ) {
+		OutputChunk( *static_cast< ChunkJob * >( arg ) );
+	}
+	
+	template< typename T > void RunObjJobs( vector< T > & jobs, void (*func)( void * ) ) {
+		RunJobs( &jobs[0], (int)jobs.size(), func );
+	}
+	
+	VarInteger obj_parseThreads( "obj_parseThreads", "Threads that parse an OBJ file, at most 16.", 0, 4 );
+	VarInteger obj_parseChunkSize( "obj_parseChunkSize", "Smallest piece of an OBJ file given its own thread, in KB.", 0, 1024 );
+	VarBool obj_meshCache( "obj_meshCache", "Load OBJ models from binary copies in the cache directory, made on first load.", 0, true );
+	VarBool obj_optimize( "obj_optimize", "Reorder OBJ models for the vertex cache and vertex fetch at import.", 0, true );
+	VarBool obj_optimizeOverdraw( "obj_optimizeOverdraw", "Also order OBJ models in clusters to cut overdraw, at some cost in vertex cache hits.", 0, false );
+	OutputCategory out_obj( "obj", "Output level for OBJ model import, -1 to use out_level." );
+	
+	VarInteger obj_lods( "obj_lods", "Levels of detail built for OBJ models at import, counting the full one, at most 8.", 0, 4 );
+	VarFloat obj_lodRatio( "obj_lodRatio", "Triangles in each level of detail of an OBJ model, as a fraction of the level before.", 0, 0.5f );
+	VarInteger obj_lodThreads( "obj_lodThreads", "Threads that build OBJ model levels of detail, at most 16.", 0, 4 );
+	
+	const int MaxObjLods = 8;
+	
+	VarBool obj_quantize( "obj_quantize", "Store OBJ model positions as 16 bit fractions of the bounds and normals in 2 bytes.", 0, false );
+	VarString obj_quantizeTexCoords( "obj_quantizeTexCoords", "How quantized OBJ models store texcoords, half or unorm16.", 0, "half" );
+	
+	// One level of detail, simplified from the full mesh, so the levels
+	// do not depend on each other or on how many threads build them.
+	struct LodJob {
+		const ObjMesh * mesh;
+		int target;
+		vector< uint > indices;
+		float error;
+	};
+	
+	void RunLod( void * arg ) {
+		LodJob & job = *static_cast< LodJob * >( arg );
+		const ObjMesh & mesh = *job.mesh;
+		int comps = VaryingComponents( mesh.varying );
+		job.indices.assign( mesh.indices.begin(), mesh.indices.begin() + mesh.lods[0].numIndexes );
+		int n = SimplifyMesh( &job.indices[0], (int)job.indices.size(), &mesh.vertices[0], comps * sizeof( float ),
+		                      (int)mesh.vertices.size() / comps, job.target, &job.error );
+		job.indices.resize( n );
+	}
+	
+	// the simulated cache that import stats are reported for
+	const int ObjCacheSize = 32;
+	const float ObjOverdrawThreshold = 1.05f;
+	
+	// import options, which tell mesh cache copies apart
+	enum ObjImportEnum {
+		ObjImport_Optimize = 0x1,
+		ObjImport_Overdraw = 0x2,
+		ObjImport_Quantize = 0x4,
+		ObjImport_QuantizeUnorm16 = 0x8,
+		// then the number of levels, and the ratio between them in 1/255ths
+		ObjImport_LodShift = 8,
+		ObjImport_LodRatioShift = 16
 	};
 	
 }
 
-
 namespace r3 {
+	bool ParseObj( const char * text, int size, ObjMesh & mesh ) {
+		R3_PROFILE( "ParseObj" );
+		// split at line boundaries, so every chunk starts a line
+		int threads = max( 1, min( obj_parseThreads.GetVal(), MaxParseThreads ) );
+		int minChunk = max( 1, obj_parseChunkSize.GetVal() ) * 1024;
+		int numChunks = max( 1, min( threads, size / minChunk ) );
+		vector< ObjChunk > chunks( numChunks );
+		const char * end = text + size;
+		const char * p = text;
+		for( int i = 0; i < numChunks; i++ ) {
+			chunks[ i ].begin = p;
+			p = i == numChunks - 1 ? end : text + int64( size ) * ( i + 1 ) / numChunks;
+			p = max( p, chunks[ i ].begin );
+			while( p < end && p[-1] != '\n' ) {
+				p++;
+			}
+			chunks[ i ].end = p;
+		}
+		
+		RunObjJobs( chunks, RunParse );
+		
+		int counts[3] = { 0, 0, 0 };
+		int line = 1;
+		for( int i = 0; i < numChunks; i++ ) {
+			ObjChunk & c = chunks[ i ];
+			c.firstLine = line;
+			line += c.lines;
+			c.bases[0] = counts[0];
+			c.bases[1] = counts[1];
+			c.bases[2] = counts[2];
+			counts[0] += (int)c.v.size();
+			counts[1] += (int)c.vt.size();
+			counts[2] += (int)c.vn.size();
+			if( c.error ) {
+				// nothing after a parse error counts
+				chunks.resize( i + 1 );
+				numChunks = i + 1;
+				break;
+			}
+		}
+		ObjArrays arrays;
+		arrays.v.resize( counts[0] );
+		arrays.vt.resize( counts[1] );
+		arrays.vn.resize( counts[2] );
+		vector< ChunkJob > jobs( numChunks );
+		for( int i = 0; i < numChunks; i++ ) {
+			jobs[ i ].chunk = &chunks[ i ];
+			jobs[ i ].arrays = &arrays;
+		}
+		RunObjJobs( jobs, RunResolve );
+		
+		// the first corner of the file sets the varying
+		int varying = 0;
+		for( int i = 0; i < numChunks; i++ ) {
+			ObjChunk & c = chunks[ i ];
+			if( c.varying && varying == 0 ) {
+				varying = c.varying;
+			}
+			if( c.faces.size() && c.varying != varying ) {
+				c.Fail( c.faces[0].line, "varying not allowed to mismatch in face index" );
+			}
+			if( c.error ) {
+				Output( "modelobj: %s on line %d.", c.error, c.firstLine + c.errorLine );
+				return false;
+			}
+		}
+		
+		// Number the chunks' vertexes in file order, so they come out the
+		// same for any number of chunks.  One chunk's are already numbered.
+		CornerMap unique;
+		int numTriangles = 0;
+		for( int i = 0; i < numChunks; i++ ) {
+			ObjChunk & c = chunks[ i ];
+			const vector< ObjCorner > & uc = c.unique.Corners();
+			c.firstVertex = unique.Size();
+			c.firstTriangle = numTriangles;
+			numTriangles += c.numTriangles;
+			c.vertexes.resize( uc.size() );
+			for( int j = 0; j < (int)uc.size(); j++ ) {
+				bool added;
+				c.vertexes[ j ] = numChunks == 1 ? j : unique.Insert( uc[ j ], added );
+			}
+		}
+		int numVertexes = numChunks == 1 ? chunks[0].unique.Size() : unique.Size();
+		int comps = VaryingComponents( varying );
+		arrays.varying = varying;
+		arrays.vbdata.resize( numVertexes * comps );
+		arrays.ibdata.resize( numTriangles * 3 );
+		RunObjJobs( jobs, RunOutput );
+		
+		mesh.varying = varying;
+		mesh.vertices.swap( arrays.vbdata );
+		mesh.indices.assign( arrays.ibdata.begin(), arrays.ibdata.end() );
+		return true;
+	}
+	
+	bool ReadObjFile( const std::string & filename, ObjMesh & mesh ) {
+		R3_PROFILE( "ReadObjFile" );
+		// parsed straight out of the mapping, no copy of the file
+		MappedFile * m = FileMapForRead( filename );
+		if ( m == NULL ) {
+			return false;
+		}
+		bool ok = m->Size() > 0 ? ParseObj( (const char *)m->Data(), m->Size(), mesh ) : ParseObj( "", 0, mesh );
+		delete m;
+		return ok;
+	}
+	
+	void BuildObjLods( ObjMesh & mesh, int numLods, float ratio, int threads ) {
+		R3_PROFILE( "BuildObjLods" );
+		mesh.lods.clear();
+		numLods = min( numLods, MaxObjLods );
+		if ( ( mesh.varying & Varying_PositionBit ) == 0 || mesh.indices.empty() || numLods < 2 ) {
+			return;
+		}
+		mesh.lods.push_back( MeshLod( 0, (int)mesh.indices.size(), 0.0f ) );
+		vector< LodJob > jobs( numLods - 1 );
+		float target = float( mesh.indices.size() / 3 );
+		for ( int i = 0; i < (int)jobs.size(); i++ ) {
+			target *= ratio;
+			jobs[ i ].mesh = &mesh;
+			jobs[ i ].target = max( 1, int( target ) ) * 3;
+			jobs[ i ].error = 0.0f;
+		}
+		threads = max( 1, min( threads, MaxParseThreads ) );
+		for ( int i = 0; i < (int)jobs.size(); i += threads ) {
+			RunJobs( &jobs[ i ], min( threads, (int)jobs.size() - i ), RunLod );
+		}
+		// levels that could not get any smaller are left out
+		for ( int i = 0; i < (int)jobs.size(); i++ ) {
+			int n = (int)jobs[ i ].indices.size();
+			if ( n == 0 || n >= mesh.lods.back().numIndexes ) {
+				continue;
+			}
+			mesh.lods.push_back( MeshLod( (int)mesh.indices.size(), n, jobs[ i ].error ) );
+			mesh.indices.insert( mesh.indices.end(), jobs[ i ].indices.begin(), jobs[ i ].indices.end() );
+		}
+		if ( mesh.lods.size() == 1 ) {
+			mesh.lods.clear();
+		}
+	}
+	
+	void OptimizeObjMesh( ObjMesh & mesh, bool overdraw, VertexCacheStats * before, VertexCacheStats * after ) {
+		R3_PROFILE( "OptimizeObjMesh" );
+		int comps = VaryingComponents( mesh.varying );
+		if ( comps == 0 || mesh.indices.empty() ) {
+			return;
+		}
+		vector< MeshLod > lods = mesh.lods;
+		if ( lods.empty() ) {
+			lods.push_back( MeshLod( 0, (int)mesh.indices.size(), 0.0f ) );
+		}
+		int numVertexes = (int)mesh.vertices.size() / comps;
+		if ( before ) {
+			*before = SimulateVertexCache( &mesh.indices[0], lods[0].numIndexes, numVertexes, ObjCacheSize );
+		}
+		for ( int i = 0; i < (int)lods.size(); i++ ) {
+			uint * indexes = &mesh.indices[ lods[ i ].firstIndex ];
+			OptimizeVertexCache( indexes, lods[ i ].numIndexes, numVertexes );
+			// position comes first when there is one
+			if ( overdraw && ( mesh.varying & Varying_PositionBit ) ) {
+				OptimizeOverdraw( indexes, lods[ i ].numIndexes, &mesh.vertices[0], comps * sizeof( float ), numVertexes, ObjCacheSize, ObjOverdrawThreshold );
+			}
+		}
+		// the full level first, the coarser ones mostly reuse its vertexes
+		OptimizeVertexFetch( &mesh.vertices[0], comps * sizeof( float ), &mesh.indices[0], (int)mesh.indices.size(), numVertexes );
+		if ( after ) {
+			*after = SimulateVertexCache( &mesh.indices[0], lods[0].numIndexes, numVertexes, ObjCacheSize );
+		}
+	}
+	
+#if R3_HAS_GL
 	Model * CreateModelFromObjFile( const std::string & filename ) {
-		File *file = FileOpenForRead( filename );
-		ParseState ps;
-		while ( file->AtEnd() == false && ps.mode != Mode_Failed ) {
-			string line = file->ReadLine();
-			vector< Token > tokens = TokenizeString( line.c_str() );
-			ps.ProcessLine( tokens );
-		}
-		delete file;
-		if ( ps.mode == Mode_Failed ) {
+		R3_PROFILE( "CreateModelFromObjFile" );
+		string md5 = FileVersionKey( filename );
+		if ( md5.empty() ) {
+			return NULL;
+		}
+		// keyed by the source's version, so an edited OBJ gets parsed and
+		// cached again
+		string cacheName = filename + ".r3mesh";
+		uint options = 0;
+		options |= obj_optimize.GetVal() ? ObjImport_Optimize : 0;
+		options |= obj_optimize.GetVal() && obj_optimizeOverdraw.GetVal() ? ObjImport_Overdraw : 0;
+		options |= obj_quantize.GetVal() ? ObjImport_Quantize : 0;
+		// without half float attributes, unorm16 is the only texcoord choice
+		bool unormTexCoords = obj_quantizeTexCoords.GetVal() == "unorm16" || R3_HALF_FLOAT_ATTRIBS == 0;
+		options |= obj_quantize.GetVal() && unormTexCoords ? ObjImport_QuantizeUnorm16 : 0;
+		int numLods = max( 1, min( obj_lods.GetVal(), MaxObjLods ) );
+		float lodRatio = max( 0.0f, min( obj_lodRatio.GetVal(), 1.0f ) );
+		if ( numLods > 1 ) {
+			options |= numLods << ObjImport_LodShift;
+			options |= uint( lodRatio * 255.0f + 0.5f ) << ObjImport_LodRatioShift;
+		}
+		if ( obj_meshCache.GetVal() ) {
+			Model * m = CreateModelFromMeshCache( cacheName, md5, options, filename );
+			if ( m ) {
+				return m;
+			}
+		}
+		ObjMesh ps;
+		if ( ReadObjFile( filename, ps ) == false ) {
 			return NULL;
 		}
 		Model *m = new Model( filename );
 		m->SetPrimitive( GL_TRIANGLES );
+		BuildObjLods( ps, numLods, lodRatio, obj_lodThreads.GetVal() );
+		if ( options & ObjImport_Optimize ) {
+			VertexCacheStats before, after;
+			OptimizeObjMesh( ps, ( options & ObjImport_Overdraw ) != 0, &before, &after );
+			R3_OUTPUT_VERBOSE( out_obj, "%s: acmr %.3f -> %.3f, atvr %.3f -> %.3f", filename.c_str(), before.acmr, after.acmr, before.atvr, after.atvr );
+		}
+		// position, normal, texcoord in generic attributes 0, 2 and 8
+		int comps = VaryingComponents( ps.varying );
+		int numVertexes = comps ? (int)ps.vertices.size() / comps : 0;
+		if ( ps.varying & Varying_PositionBit ) {
+			Bounds3f b;
+			for ( int i = 0; i < (int)ps.vertices.size(); i += comps ) {
+				b.Add( Vec3f( &ps.vertices[ i ] ) );
+			}
+			m->SetBounds( b );
+		}
 		VertexBuffer & vb = m->GetVertexBuffer();
-        // FIXME: Need to add AttributeArrays here, varying flags have been removed...
-		//vb.SetVarying( ps.varying );
-		//Output( "model %s varying = %d", filename.c_str(), ps.varying );
-		vb.SetData( (int)ps.vbdata.size() * sizeof( float ), &ps.vbdata[0] );
-		m->GetIndexBuffer().SetData( (int)ps.ibdata.size() * sizeof( r3::ushort ), &ps.ibdata[0] );
+		if ( options & ObjImport_Quantize ) {
+			QuantizedLayout l = GetQuantizedLayout( ps.varying, options & ObjImport_QuantizeUnorm16 ? QuantizeTexCoord_Unorm16 : QuantizeTexCoord_Half );
+			vector< uchar > packed;
+			Dequantize dq;
+			QuantizeVertexes( ps.vertices.empty() ? NULL : &ps.vertices[0], ps.varying, numVertexes, l, packed, dq );
+			if ( l.positionOffset >= 0 ) {
+				m->AddAttributeArray( AttributeArray( 0, 3, GL_UNSIGNED_SHORT, GL_TRUE, l.stride, l.positionOffset ) );
+			}
+			// octahedral, for the shader to unfold like DecodeOctahedral
+			if ( l.normalOffset >= 0 ) {
+				m->AddAttributeArray( AttributeArray( 2, 2, GL_BYTE, GL_TRUE, l.stride, l.normalOffset ) );
+			}
+			if ( l.texCoordOffset >= 0 ) {
+				bool unorm = l.texCoords == QuantizeTexCoord_Unorm16;
+#if R3_HALF_FLOAT_ATTRIBS
+				GLenum texCoordType = unorm ? GL_UNSIGNED_SHORT : GL_HALF_FLOAT;
+#else
+				assert( unorm );
+				GLenum texCoordType = GL_UNSIGNED_SHORT;
+#endif
+				m->AddAttributeArray( AttributeArray( 8, 2, texCoordType, GLboolean( unorm ), l.stride, l.texCoordOffset ) );
+			}
+			m->SetDequantize( dq );
+			vb.SetData( (int)packed.size(), packed.empty() ? NULL : &packed[0] );
+		} else {
+			int stride = comps * sizeof( float );
+			int offset = 0;
+			if ( ps.varying & Varying_PositionBit ) {
+				m->AddAttributeArray( AttributeArray( 0, 3, GL_FLOAT, GL_FALSE, stride, offset ) );
+				offset += 3 * sizeof( float );
+			}
+			if ( ps.varying & Varying_NormalBit ) {
+				m->AddAttributeArray( AttributeArray( 2, 3, GL_FLOAT, GL_FALSE, stride, offset ) );
+				offset += 3 * sizeof( float );
+			}
+			if ( ps.varying & Varying_TexCoord0Bit ) {
+				m->AddAttributeArray( AttributeArray( 8, 2, GL_FLOAT, GL_FALSE, stride, offset ) );
+			}
+			vb.SetData( (int)ps.vertices.size() * sizeof( float ), ps.vertices.empty() ? NULL : &ps.vertices[0] );
+		}
+		m->SetIndexes( ps.indices.empty() ? NULL : &ps.indices[0], (int)ps.indices.size() );
+		m->SetLods( ps.lods );
+		if ( obj_meshCache.GetVal() ) {
+			WriteMeshCache( cacheName, md5, options, m );
+		}
 		return m;
 	}
+#endif
 }
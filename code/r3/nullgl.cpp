@@ -0,0 +1,872 @@
+/*
+ *  nullgl
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#include "r3/nullgl.h"
+
+#include "r3/command.h"
+#include "r3/gl.h"
+#include "r3/metrics.h"
+#include "r3/output.h"
+#include "r3/var.h"
+
+#include <algorithm>
+#include <map>
+#include <string.h>
+
+using namespace std;
+using namespace r3;
+
+VarBool nullgl_trace( "nullgl_trace", "Record the GL call sequence of each frame for the nullgltrace command.", 0, false );
+
+MetricCounter nullgl_frames( "nullgl_frames", "Frames ended on the null GL backend." );
+MetricCounter nullgl_calls( "nullgl_calls", "GL calls made on the null GL backend." );
+MetricCounter nullgl_draws( "nullgl_draws", "Draw calls made on the null GL backend." );
+MetricCounter nullgl_vertices( "nullgl_vertices", "Vertices or indices drawn on the null GL backend." );
+MetricCounter nullgl_bytesUploaded( "nullgl_bytesUploaded", "Buffer and texture bytes handed to the null GL backend." );
+MetricCounter nullgl_stateChanges( "nullgl_stateChanges", "GL state changes made on the null GL backend." );
+MetricCounter nullgl_redundantStateChanges( "nullgl_redundantStateChanges", "GL state changes that set what was already set." );
+
+namespace {
+	
+	// Call counts for one entry point.  They are function local statics, so
+	// the list is in first call order.
+	struct EntryPoint;
+	EntryPoint * entryPoints = NULL;
+	EntryPoint ** entryPointsTail = &entryPoints;
+	
+	struct EntryPoint {
+		EntryPoint( const char * epName ) : name( epName ), frameCalls( 0 ), lastFrameCalls( 0 ), next( NULL ) {
+			*entryPointsTail = this;
+			entryPointsTail = &next;
+		}
+		const char * name;
+		int64 frameCalls;
+		int64 lastFrameCalls;
+		EntryPoint * next;
+	};
+	
+	NullGLStats frame;
+	NullGLStats lastFrame;
+	vector< EntryPoint * > trace;
+	vector< EntryPoint * > lastTrace;
+	
+	// A vertex array pointer and the array buffer it was specified against.
+	struct ArrayPointer {
+		ArrayPointer() : buffer( 0 ), size( 0 ), type( 0 ), normalized( 0 ), stride( 0 ), pointer( NULL ) {}
+		ArrayPointer( GLuint b, GLint sz, GLenum t, GLboolean n, GLsizei st, const GLvoid * p )
+		: buffer( b ), size( sz ), type( t ), normalized( n ), stride( st ), pointer( p ) {}
+		bool operator == ( const ArrayPointer & rhs ) const {
+			return buffer == rhs.buffer && size == rhs.size && type == rhs.type &&
+			normalized == rhs.normalized && stride == rhs.stride && pointer == rhs.pointer;
+		}
+		GLuint buffer;
+		GLint size;
+		GLenum type;
+		GLboolean normalized;
+		GLsizei stride;
+		const GLvoid * pointer;
+	};
+	
+	// The GL state the backend tracks to tell redundant changes apart.
+	struct GLState {
+		GLState() : arrayBuffer( 0 ), elementBuffer( 0 ), renderbuffer( 0 ), program( 0 ), activeTexture( 0 ),
+		blendSrc( GL_ONE ), blendDst( GL_ZERO ), nextName( 1 ), inBegin( false ), mappedLength( 0 ) {}
+		GLuint arrayBuffer;
+		GLuint elementBuffer;
+		GLuint renderbuffer;
+		GLuint program;
+		GLuint activeTexture;                           // unit index, not GL_TEXTUREi
+		map< pair< GLuint, GLenum >, GLuint > textures; // (unit, target) -> texture
+		map< pair< GLenum, GLuint >, bool > enables;    // (cap, unit) -> enabled
+		map< pair< GLenum, GLuint >, bool > clientStates;
+		map< GLuint, bool > attribArrays;
+		map< GLuint, ArrayPointer > pointers;           // attribute index or array cap -> pointer
+		map< pair< GLuint, GLenum >, GLint > texEnv;    // (unit, pname) -> param
+		map< pair< GLuint, GLenum >, float > texParams; // (texture, pname) -> param
+		map< pair< GLuint, GLint >, GLint > uniformInts;
+		GLenum blendSrc;
+		GLenum blendDst;
+		GLuint nextName;
+		bool inBegin;
+		vector< uchar > mapped;                         // memory for the one mapped buffer range
+		GLsizeiptr mappedLength;
+		map< GLuint, GLsizeiptr > bufferSizes;
+	};
+	GLState * state = NULL;
+	
+	inline void Call( EntryPoint & ep ) {
+		frame.calls++;
+		ep.frameCalls++;
+		if( nullgl_trace.GetVal() ) {
+			trace.push_back( &ep );
+		}
+	}
+	
+	template< typename K, typename V >
+	void SetState( map< K, V > & m, const K & key, const V & val ) {
+		frame.stateChanges++;
+		typename map< K, V >::iterator it = m.find( key );
+		if( it != m.end() && it->second == val ) {
+			frame.redundantStateChanges++;
+			return;
+		}
+		m[ key ] = val;
+	}
+	
+	template< typename V >
+	void SetState( V & cur, const V & val ) {
+		frame.stateChanges++;
+		if( cur == val ) {
+			frame.redundantStateChanges++;
+			return;
+		}
+		cur = val;
+	}
+	
+	void GenNames( GLsizei n, GLuint * names ) {
+		for( int i = 0; i < n; i++ ) {
+			names[ i ] = state->nextName++;
+		}
+		frame.objectsCreated += n;
+	}
+	
+	// A driver reads what it is handed, so fault in every page of an
+	// upload, which matters when the data is a mapped file.
+	void ReadUpload( const GLvoid * data, GLsizeiptr size ) {
+		const uchar * p = static_cast< const uchar * >( data );
+		uchar sum = 0;
+		for( GLsizeiptr i = 0; i < size; i += 4096 ) {
+			sum += p[ i ];
+		}
+		// keep the reads without storing the sum anywhere
+#if _MSC_VER
+		static volatile uchar sink;
+		sink = sum;
+		(void)sink;
+#else
+		asm volatile( "" : : "r"( sum ) );
+#endif
+	}
+	
+	GLuint & BufferBinding( GLenum target ) {
+		static GLuint other;
+		switch( target ) {
+			case GL_ARRAY_BUFFER: return state->arrayBuffer;
+			case GL_ELEMENT_ARRAY_BUFFER: return state->elementBuffer;
+			default: break;
+		}
+		return other;
+	}
+	
+	GLuint BoundTexture( GLenum target ) {
+		map< pair< GLuint, GLenum >, GLuint >::iterator it = state->textures.find( make_pair( state->activeTexture, target ) );
+		return it != state->textures.end() ? it->second : 0;
+	}
+	
+	void AddTextureBytes( int64 bytes ) {
+		frame.bytesUploaded += bytes;
+		frame.textureBytesUploaded += bytes;
+	}
+	
+	int TypeSize( GLenum type ) {
+		switch( type ) {
+			case GL_UNSIGNED_SHORT:
+			case GL_SHORT:
+				return 2;
+			case GL_UNSIGNED_INT:
+			case GL_INT:
+			case GL_FLOAT:
+				return 4;
+			default:
+				break;
+		}
+		return 1;
+	}
+	
+	int PixelSize( GLenum format, GLenum type ) {
+		int components = 4;
+		switch( format ) {
+			case GL_ALPHA:
+			case GL_LUMINANCE:
+			case GL_RED:
+			case GL_DEPTH_COMPONENT:
+				components = 1;
+				break;
+			case GL_LUMINANCE_ALPHA:
+				components = 2;
+				break;
+			case GL_RGB:
+			case GL_BGR:
+				components = 3;
+				break;
+			default:
+				break;
+		}
+		return components * TypeSize( type );
+	}
+	
+	const char * extensions[] = {
+		"GL_ARB_vertex_buffer_object",
+		"GL_EXT_direct_state_access",
+		"GL_EXT_framebuffer_object",
+		"GL_EXT_texture_filter_anisotropic"
+	};
+	
+	string ExtensionString() {
+		string s;
+		for( int i = 0; i < (int)ARRAY_ELEMENTS( extensions ); i++ ) {
+			s += extensions[ i ];
+			s += " ";
+		}
+		return s;
+	}
+	
+	// nullglstats command
+	void NullGLStatsCmd( const vector< Token > & tokens ) {
+		NullGLStats s = GetNullGLFrameStats();
+		Output( "last frame: %lld calls, %lld draws, %lld vertices, %lld bytes uploaded, %lld state changes (%lld redundant), %lld objects created",
+		       s.calls, s.draws, s.vertices, s.bytesUploaded, s.stateChanges, s.redundantStateChanges, s.objectsCreated );
+		vector< pair< string, int64 > > calls;
+		GetNullGLFrameCalls( calls );
+		for( int i = 0; i < (int)calls.size(); i++ ) {
+			Output( "  %8lld %s", calls[ i ].second, calls[ i ].first.c_str() );
+		}
+	}
+	CommandFunc NullGLStatsCmdCmd( "nullglstats", "prints null GL backend counts for the last frame", NullGLStatsCmd );
+	
+	// nullgltrace command
+	void NullGLTraceCmd( const vector< Token > & tokens ) {
+		if( lastTrace.size() == 0 ) {
+			Output( "No trace recorded, set nullgl_trace 1 and end a frame." );
+			return;
+		}
+		for( int i = 0; i < (int)lastTrace.size(); ) {
+			int j = i + 1;
+			while( j < (int)lastTrace.size() && lastTrace[ j ] == lastTrace[ i ] ) {
+				j++;
+			}
+			if( j - i > 1 ) {
+				Output( "%s x%d", lastTrace[ i ]->name, j - i );
+			} else {
+				Output( "%s", lastTrace[ i ]->name );
+			}
+			i = j;
+		}
+	}
+	CommandFunc NullGLTraceCmdCmd( "nullgltrace", "prints the GL calls of the last frame recorded with nullgl_trace", NullGLTraceCmd );
+	
+}
+
+#define NULL_GL_CALL( entry ) static EntryPoint ep( #entry ); Call( ep )
+
+// GL 1.1, which the platform gl.h declares and libGL would otherwise define.
+
+extern "C" {
+	
+	GLenum GLAPIENTRY glGetError() {
+		NULL_GL_CALL( glGetError );
+		return GL_NO_ERROR;
+	}
+	
+	const GLubyte * GLAPIENTRY glGetString( GLenum name ) {
+		NULL_GL_CALL( glGetString );
+		static string ext = ExtensionString();
+		switch( name ) {
+			case GL_VENDOR: return (const GLubyte *)"r3";
+			case GL_RENDERER: return (const GLubyte *)"r3 null GL";
+			case GL_VERSION: return (const GLubyte *)"2.1 r3 null GL";
+			case GL_EXTENSIONS: return (const GLubyte *)ext.c_str();
+			default: break;
+		}
+		return NULL;
+	}
+	
+	void GLAPIENTRY glGetIntegerv( GLenum pname, GLint * params ) {
+		NULL_GL_CALL( glGetIntegerv );
+		switch( pname ) {
+			case GL_DEPTH_BITS: *params = 24; break;
+			case GL_MAX_TEXTURE_SIZE: *params = 8192; break;
+			case GL_NUM_EXTENSIONS: *params = ARRAY_ELEMENTS( extensions ); break;
+			default: *params = 0; break;
+		}
+	}
+	
+	void GLAPIENTRY glFinish() {
+		NULL_GL_CALL( glFinish );
+	}
+	
+	void GLAPIENTRY glEnable( GLenum cap ) {
+		NULL_GL_CALL( glEnable );
+		SetState( state->enables, make_pair( cap, state->activeTexture ), true );
+	}
+	
+	void GLAPIENTRY glDisable( GLenum cap ) {
+		NULL_GL_CALL( glDisable );
+		SetState( state->enables, make_pair( cap, state->activeTexture ), false );
+	}
+	
+	void GLAPIENTRY glBlendFunc( GLenum sfactor, GLenum dfactor ) {
+		NULL_GL_CALL( glBlendFunc );
+		frame.stateChanges++;
+		if( state->blendSrc == sfactor && state->blendDst == dfactor ) {
+			frame.redundantStateChanges++;
+		}
+		state->blendSrc = sfactor;
+		state->blendDst = dfactor;
+	}
+	
+	void GLAPIENTRY glTexEnvi( GLenum target, GLenum pname, GLint param ) {
+		NULL_GL_CALL( glTexEnvi );
+		SetState( state->texEnv, make_pair( state->activeTexture, pname ), param );
+	}
+	
+	void GLAPIENTRY glGenTextures( GLsizei n, GLuint * textures ) {
+		NULL_GL_CALL( glGenTextures );
+		GenNames( n, textures );
+	}
+	
+	void GLAPIENTRY glDeleteTextures( GLsizei n, const GLuint * textures ) {
+		NULL_GL_CALL( glDeleteTextures );
+		for( int i = 0; i < n; i++ ) {
+			for( map< pair< GLuint, GLenum >, GLuint >::iterator it = state->textures.begin(); it != state->textures.end(); ++it ) {
+				if( it->second == textures[ i ] ) {
+					it->second = 0;
+				}
+			}
+		}
+	}
+	
+	void GLAPIENTRY glBindTexture( GLenum target, GLuint texture ) {
+		NULL_GL_CALL( glBindTexture );
+		SetState( state->textures, make_pair( state->activeTexture, target ), texture );
+	}
+	
+	void GLAPIENTRY glTexParameteri( GLenum target, GLenum pname, GLint param ) {
+		NULL_GL_CALL( glTexParameteri );
+		SetState( state->texParams, make_pair( BoundTexture( target ), pname ), float( param ) );
+	}
+	
+	void GLAPIENTRY glTexParameterf( GLenum target, GLenum pname, GLfloat param ) {
+		NULL_GL_CALL( glTexParameterf );
+		SetState( state->texParams, make_pair( BoundTexture( target ), pname ), param );
+	}
+	
+	void GLAPIENTRY glTexImage2D( GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid * pixels ) {
+		NULL_GL_CALL( glTexImage2D );
+		if( pixels ) {
+			AddTextureBytes( int64( width ) * height * PixelSize( format, type ) );
+		}
+	}
+	
+	void GLAPIENTRY glTexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * pixels ) {
+		NULL_GL_CALL( glTexSubImage2D );
+		AddTextureBytes( int64( width ) * height * PixelSize( format, type ) );
+	}
+	
+	void GLAPIENTRY glGetTexImage( GLenum target, GLint level, GLenum format, GLenum type, GLvoid * pixels ) {
+		NULL_GL_CALL( glGetTexImage );
+	}
+	
+	void GLAPIENTRY glEnableClientState( GLenum cap ) {
+		NULL_GL_CALL( glEnableClientState );
+		SetState( state->clientStates, make_pair( cap, GLuint( 0 ) ), true );
+	}
+	
+	void GLAPIENTRY glDisableClientState( GLenum cap ) {
+		NULL_GL_CALL( glDisableClientState );
+		SetState( state->clientStates, make_pair( cap, GLuint( 0 ) ), false );
+	}
+	
+	void GLAPIENTRY glVertexPointer( GLint size, GLenum type, GLsizei stride, const GLvoid * ptr ) {
+		NULL_GL_CALL( glVertexPointer );
+		SetState( state->pointers, GLuint( GL_VERTEX_ARRAY ), ArrayPointer( state->arrayBuffer, size, type, GL_FALSE, stride, ptr ) );
+	}
+	
+	void GLAPIENTRY glNormalPointer( GLenum type, GLsizei stride, const GLvoid * ptr ) {
+		NULL_GL_CALL( glNormalPointer );
+		SetState( state->pointers, GLuint( GL_NORMAL_ARRAY ), ArrayPointer( state->arrayBuffer, 3, type, GL_FALSE, stride, ptr ) );
+	}
+	
+	void GLAPIENTRY glColorPointer( GLint size, GLenum type, GLsizei stride, const GLvoid * ptr ) {
+		NULL_GL_CALL( glColorPointer );
+		SetState( state->pointers, GLuint( GL_COLOR_ARRAY ), ArrayPointer( state->arrayBuffer, size, type, GL_FALSE, stride, ptr ) );
+	}
+	
+	void GLAPIENTRY glDrawArrays( GLenum mode, GLint first, GLsizei count ) {
+		NULL_GL_CALL( glDrawArrays );
+		frame.draws++;
+		frame.vertices += count;
+	}
+	
+	void GLAPIENTRY glDrawElements( GLenum mode, GLsizei count, GLenum type, const GLvoid * indices ) {
+		NULL_GL_CALL( glDrawElements );
+		frame.draws++;
+		frame.vertices += count;
+		if( state->elementBuffer == 0 && indices != NULL ) {
+			// client side indices are copied on every draw
+			frame.bytesUploaded += int64( count ) * TypeSize( type );
+		} else if( state->elementBuffer ) {
+			int64 end = (const char *)indices - (const char *)NULL + int64( count ) * TypeSize( type );
+			if( end > state->bufferSizes[ state->elementBuffer ] ) {
+				frame.badDraws++;
+			}
+		}
+	}
+	
+	void GLAPIENTRY glBegin( GLenum mode ) {
+		NULL_GL_CALL( glBegin );
+		state->inBegin = true;
+	}
+	
+	void GLAPIENTRY glEnd() {
+		NULL_GL_CALL( glEnd );
+		state->inBegin = false;
+		frame.draws++;
+	}
+	
+	void GLAPIENTRY glVertex2f( GLfloat x, GLfloat y ) {
+		NULL_GL_CALL( glVertex2f );
+		frame.vertices++;
+	}
+	
+	void GLAPIENTRY glTexCoord2f( GLfloat s, GLfloat t ) {
+		NULL_GL_CALL( glTexCoord2f );
+	}
+	
+	void GLAPIENTRY glColor4f( GLfloat r, GLfloat g, GLfloat b, GLfloat a ) {
+		NULL_GL_CALL( glColor4f );
+	}
+	
+	void GLAPIENTRY glColor4ub( GLubyte r, GLubyte g, GLubyte b, GLubyte a ) {
+		NULL_GL_CALL( glColor4ub );
+	}
+	
+	void GLAPIENTRY glMatrixMode( GLenum mode ) {
+		NULL_GL_CALL( glMatrixMode );
+	}
+	
+	void GLAPIENTRY glLoadMatrixf( const GLfloat * m ) {
+		NULL_GL_CALL( glLoadMatrixf );
+	}
+	
+}
+
+// Everything newer, handed out by NullGLGetProcAddress.
+
+namespace {
+	
+	void APIENTRY NullActiveTexture( GLenum texture ) {
+		NULL_GL_CALL( glActiveTexture );
+		SetState( state->activeTexture, GLuint( texture - GL_TEXTURE0 ) );
+	}
+	
+	void APIENTRY NullMultiTexCoord2f( GLenum target, GLfloat s, GLfloat t ) {
+		NULL_GL_CALL( glMultiTexCoord2f );
+	}
+	
+	void APIENTRY NullGenBuffers( GLsizei n, GLuint * buffers ) {
+		NULL_GL_CALL( glGenBuffers );
+		GenNames( n, buffers );
+	}
+	
+	void APIENTRY NullDeleteBuffers( GLsizei n, const GLuint * buffers ) {
+		NULL_GL_CALL( glDeleteBuffers );
+		for( int i = 0; i < n; i++ ) {
+			if( state->arrayBuffer == buffers[ i ] ) {
+				state->arrayBuffer = 0;
+			}
+			if( state->elementBuffer == buffers[ i ] ) {
+				state->elementBuffer = 0;
+			}
+			state->bufferSizes.erase( buffers[ i ] );
+		}
+	}
+	
+	void APIENTRY NullBindBuffer( GLenum target, GLuint buffer ) {
+		NULL_GL_CALL( glBindBuffer );
+		SetState( BufferBinding( target ), buffer );
+	}
+	
+	void APIENTRY NullBufferData( GLenum target, GLsizeiptr size, const GLvoid * data, GLenum usage ) {
+		NULL_GL_CALL( glBufferData );
+		state->bufferSizes[ BufferBinding( target ) ] = size;
+		if( data ) {
+			ReadUpload( data, size );
+			frame.bytesUploaded += size;
+		}
+	}
+	
+	void CheckUpload( GLenum target, GLintptr offset, GLsizeiptr size ) {
+		if( offset + size > state->bufferSizes[ BufferBinding( target ) ] ) {
+			frame.badUploads++;
+		}
+	}
+	
+	void APIENTRY NullBufferSubData( GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid * data ) {
+		NULL_GL_CALL( glBufferSubData );
+		CheckUpload( target, offset, size );
+		ReadUpload( data, size );
+		frame.bytesUploaded += size;
+	}
+	
+	GLvoid * APIENTRY NullMapBufferRange( GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access ) {
+		NULL_GL_CALL( glMapBufferRange );
+		CheckUpload( target, offset, length );
+		if( (GLsizeiptr)state->mapped.size() < length ) {
+			state->mapped.resize( length );
+		}
+		state->mappedLength = length;
+		return &state->mapped[0];
+	}
+	
+	GLboolean APIENTRY NullUnmapBuffer( GLenum target ) {
+		NULL_GL_CALL( glUnmapBuffer );
+		frame.bytesUploaded += state->mappedLength;
+		state->mappedLength = 0;
+		return GL_TRUE;
+	}
+	
+	// the null GPU is never behind, so every fence is already signaled
+	GLsync APIENTRY NullFenceSync( GLenum condition, GLbitfield flags ) {
+		NULL_GL_CALL( glFenceSync );
+		return (GLsync)(size_t)state->nextName++;
+	}
+	
+	GLenum APIENTRY NullClientWaitSync( GLsync sync, GLbitfield flags, GLuint64 timeout ) {
+		NULL_GL_CALL( glClientWaitSync );
+		frame.fenceWaits++;
+		return GL_ALREADY_SIGNALED;
+	}
+	
+	void APIENTRY NullDeleteSync( GLsync sync ) {
+		NULL_GL_CALL( glDeleteSync );
+	}
+	
+	void APIENTRY NullEnableVertexAttribArray( GLuint index ) {
+		NULL_GL_CALL( glEnableVertexAttribArray );
+		SetState( state->attribArrays, index, true );
+	}
+	
+	void APIENTRY NullDisableVertexAttribArray( GLuint index ) {
+		NULL_GL_CALL( glDisableVertexAttribArray );
+		SetState( state->attribArrays, index, false );
+	}
+	
+	void APIENTRY NullVertexAttribPointer( GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid * pointer ) {
+		NULL_GL_CALL( glVertexAttribPointer );
+		SetState( state->pointers, index, ArrayPointer( state->arrayBuffer, size, type, normalized, stride, pointer ) );
+	}
+	
+	GLuint APIENTRY NullCreateProgram() {
+		NULL_GL_CALL( glCreateProgram );
+		frame.objectsCreated++;
+		return state->nextName++;
+	}
+	
+	GLuint APIENTRY NullCreateShader( GLenum type ) {
+		NULL_GL_CALL( glCreateShader );
+		frame.objectsCreated++;
+		return state->nextName++;
+	}
+	
+	void APIENTRY NullDeleteProgram( GLuint program ) {
+		NULL_GL_CALL( glDeleteProgram );
+	}
+	
+	void APIENTRY NullDeleteShader( GLuint shader ) {
+		NULL_GL_CALL( glDeleteShader );
+	}
+	
+	void APIENTRY NullShaderSource( GLuint shader, GLsizei count, const GLchar* * string, const GLint * length ) {
+		NULL_GL_CALL( glShaderSource );
+	}
+	
+	void APIENTRY NullCompileShader( GLuint shader ) {
+		NULL_GL_CALL( glCompileShader );
+	}
+	
+	void APIENTRY NullAttachShader( GLuint program, GLuint shader ) {
+		NULL_GL_CALL( glAttachShader );
+	}
+	
+	void APIENTRY NullLinkProgram( GLuint program ) {
+		NULL_GL_CALL( glLinkProgram );
+	}
+	
+	void APIENTRY NullGetShaderInfoLog( GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * infoLog ) {
+		NULL_GL_CALL( glGetShaderInfoLog );
+		if( length ) {
+			*length = 0;
+		}
+		if( bufSize > 0 ) {
+			infoLog[ 0 ] = 0;
+		}
+	}
+	
+	void APIENTRY NullGetProgramInfoLog( GLuint program, GLsizei bufSize, GLsizei * length, GLchar * infoLog ) {
+		NULL_GL_CALL( glGetProgramInfoLog );
+		if( length ) {
+			*length = 0;
+		}
+		if( bufSize > 0 ) {
+			infoLog[ 0 ] = 0;
+		}
+	}
+	
+	GLint APIENTRY NullGetUniformLocation( GLuint program, const GLchar * name ) {
+		NULL_GL_CALL( glGetUniformLocation );
+		GLint loc = 0;
+		for( const GLchar * c = name; *c; c++ ) {
+			loc = ( loc * 31 + *c ) & 0xffff;
+		}
+		return loc;
+	}
+	
+	void APIENTRY NullUseProgram( GLuint program ) {
+		NULL_GL_CALL( glUseProgram );
+		SetState( state->program, program );
+	}
+	
+	void APIENTRY NullProgramUniform1iEXT( GLuint program, GLint location, GLint v0 ) {
+		NULL_GL_CALL( glProgramUniform1iEXT );
+		SetState( state->uniformInts, make_pair( program, location ), v0 );
+	}
+	
+	void APIENTRY NullProgramUniform3fvEXT( GLuint program, GLint location, GLsizei count, const GLfloat * value ) {
+		NULL_GL_CALL( glProgramUniform3fvEXT );
+		frame.stateChanges++;
+	}
+	
+	void APIENTRY NullProgramUniformMatrix4fvEXT( GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat * value ) {
+		NULL_GL_CALL( glProgramUniformMatrix4fvEXT );
+		frame.stateChanges++;
+	}
+	
+	void APIENTRY NullBindMultiTextureEXT( GLenum texunit, GLenum target, GLuint texture ) {
+		NULL_GL_CALL( glBindMultiTextureEXT );
+		SetState( state->textures, make_pair( GLuint( texunit - GL_TEXTURE0 ), target ), texture );
+	}
+	
+	void APIENTRY NullMultiTexEnviEXT( GLenum texunit, GLenum target, GLenum pname, GLint param ) {
+		NULL_GL_CALL( glMultiTexEnviEXT );
+		SetState( state->texEnv, make_pair( GLuint( texunit - GL_TEXTURE0 ), pname ), param );
+	}
+	
+	void APIENTRY NullEnableIndexedEXT( GLenum target, GLuint index ) {
+		NULL_GL_CALL( glEnableIndexedEXT );
+		SetState( state->enables, make_pair( target, index ), true );
+	}
+	
+	void APIENTRY NullDisableIndexedEXT( GLenum target, GLuint index ) {
+		NULL_GL_CALL( glDisableIndexedEXT );
+		SetState( state->enables, make_pair( target, index ), false );
+	}
+	
+	void APIENTRY NullEnableClientStateIndexedEXT( GLenum array, GLuint index ) {
+		NULL_GL_CALL( glEnableClientStateIndexedEXT );
+		SetState( state->clientStates, make_pair( array, index ), true );
+	}
+	
+	void APIENTRY NullDisableClientStateIndexedEXT( GLenum array, GLuint index ) {
+		NULL_GL_CALL( glDisableClientStateIndexedEXT );
+		SetState( state->clientStates, make_pair( array, index ), false );
+	}
+	
+	void APIENTRY NullMultiTexCoordPointerEXT( GLenum texunit, GLint size, GLenum type, GLsizei stride, const GLvoid * pointer ) {
+		NULL_GL_CALL( glMultiTexCoordPointerEXT );
+		SetState( state->pointers, GLuint( texunit ), ArrayPointer( state->arrayBuffer, size, type, GL_FALSE, stride, pointer ) );
+	}
+	
+	void APIENTRY NullGenerateMipmapEXT( GLenum target ) {
+		NULL_GL_CALL( glGenerateMipmapEXT );
+	}
+	
+	const GLubyte * APIENTRY NullGetStringi( GLenum name, GLuint index ) {
+		NULL_GL_CALL( glGetStringi );
+		if( name == GL_EXTENSIONS && index < ARRAY_ELEMENTS( extensions ) ) {
+			return (const GLubyte *)extensions[ index ];
+		}
+		return NULL;
+	}
+	
+	void APIENTRY NullGenRenderbuffers( GLsizei n, GLuint * renderbuffers ) {
+		NULL_GL_CALL( glGenRenderbuffers );
+		GenNames( n, renderbuffers );
+	}
+	
+	void APIENTRY NullDeleteRenderbuffers( GLsizei n, const GLuint * renderbuffers ) {
+		NULL_GL_CALL( glDeleteRenderbuffers );
+	}
+	
+	void APIENTRY NullBindRenderbuffer( GLenum target, GLuint renderbuffer ) {
+		NULL_GL_CALL( glBindRenderbuffer );
+		SetState( state->renderbuffer, renderbuffer );
+	}
+	
+	void APIENTRY NullRenderbufferStorage( GLenum target, GLenum internalformat, GLsizei width, GLsizei height ) {
+		NULL_GL_CALL( glRenderbufferStorage );
+	}
+	
+	struct Proc {
+		const char * name;
+		void * proc;
+	};
+	
+	const Proc procs[] = {
+		{ "glActiveTexture", (void *)NullActiveTexture },
+		{ "glAttachShader", (void *)NullAttachShader },
+		{ "glBindBuffer", (void *)NullBindBuffer },
+		{ "glBindMultiTextureEXT", (void *)NullBindMultiTextureEXT },
+		{ "glBindRenderbuffer", (void *)NullBindRenderbuffer },
+		{ "glBufferData", (void *)NullBufferData },
+		{ "glBufferSubData", (void *)NullBufferSubData },
+		{ "glClientWaitSync", (void *)NullClientWaitSync },
+		{ "glCompileShader", (void *)NullCompileShader },
+		{ "glCreateProgram", (void *)NullCreateProgram },
+		{ "glCreateShader", (void *)NullCreateShader },
+		{ "glDeleteBuffers", (void *)NullDeleteBuffers },
+		{ "glDeleteProgram", (void *)NullDeleteProgram },
+		{ "glDeleteRenderbuffers", (void *)NullDeleteRenderbuffers },
+		{ "glDeleteShader", (void *)NullDeleteShader },
+		{ "glDeleteSync", (void *)NullDeleteSync },
+		{ "glDisableClientStateIndexedEXT", (void *)NullDisableClientStateIndexedEXT },
+		{ "glDisableIndexedEXT", (void *)NullDisableIndexedEXT },
+		{ "glDisableVertexAttribArray", (void *)NullDisableVertexAttribArray },
+		{ "glEnableClientStateIndexedEXT", (void *)NullEnableClientStateIndexedEXT },
+		{ "glEnableIndexedEXT", (void *)NullEnableIndexedEXT },
+		{ "glEnableVertexAttribArray", (void *)NullEnableVertexAttribArray },
+		{ "glFenceSync", (void *)NullFenceSync },
+		{ "glGenBuffers", (void *)NullGenBuffers },
+		{ "glGenRenderbuffers", (void *)NullGenRenderbuffers },
+		{ "glGenerateMipmapEXT", (void *)NullGenerateMipmapEXT },
+		{ "glGetProgramInfoLog", (void *)NullGetProgramInfoLog },
+		{ "glGetShaderInfoLog", (void *)NullGetShaderInfoLog },
+		{ "glGetStringi", (void *)NullGetStringi },
+		{ "glGetUniformLocation", (void *)NullGetUniformLocation },
+		{ "glLinkProgram", (void *)NullLinkProgram },
+		{ "glMapBufferRange", (void *)NullMapBufferRange },
+		{ "glMultiTexCoord2f", (void *)NullMultiTexCoord2f },
+		{ "glMultiTexCoordPointerEXT", (void *)NullMultiTexCoordPointerEXT },
+		{ "glMultiTexEnviEXT", (void *)NullMultiTexEnviEXT },
+		{ "glProgramUniform1iEXT", (void *)NullProgramUniform1iEXT },
+		{ "glProgramUniform3fvEXT", (void *)NullProgramUniform3fvEXT },
+		{ "glProgramUniformMatrix4fvEXT", (void *)NullProgramUniformMatrix4fvEXT },
+		{ "glRenderbufferStorage", (void *)NullRenderbufferStorage },
+		{ "glShaderSource", (void *)NullShaderSource },
+		{ "glUnmapBuffer", (void *)NullUnmapBuffer },
+		{ "glUseProgram", (void *)NullUseProgram },
+		{ "glVertexAttribPointer", (void *)NullVertexAttribPointer }
+	};
+	
+	bool CompareCalls( const pair< string, int64 > & a, const pair< string, int64 > & b ) {
+		return a.second > b.second;
+	}
+	
+}
+
+namespace r3 {
+	
+	void InitNullGL() {
+		Output( "Initializing r3 null GL backend." );
+		delete state;
+		state = new GLState;
+		frame = NullGLStats();
+		lastFrame = NullGLStats();
+		trace.clear();
+		lastTrace.clear();
+		InitGLEntry();
+	}
+	
+	void ShutdownNullGL() {
+		Output( "Shutting down r3 null GL backend." );
+		ShutdownGLEntry();
+		delete state;
+		state = NULL;
+	}
+	
+	void * NullGLGetProcAddress( const char * name ) {
+		for( int i = 0; i < (int)ARRAY_ELEMENTS( procs ); i++ ) {
+			if( strcmp( procs[ i ].name, name ) == 0 ) {
+				return procs[ i ].proc;
+			}
+		}
+		return NULL;
+	}
+	
+	void NullGLEndFrame() {
+		for( EntryPoint * ep = entryPoints; ep != NULL; ep = ep->next ) {
+			ep->lastFrameCalls = ep->frameCalls;
+			ep->frameCalls = 0;
+		}
+		nullgl_frames.Incr();
+		nullgl_calls.Add( frame.calls );
+		nullgl_draws.Add( frame.draws );
+		nullgl_vertices.Add( frame.vertices );
+		nullgl_bytesUploaded.Add( frame.bytesUploaded );
+		nullgl_stateChanges.Add( frame.stateChanges );
+		nullgl_redundantStateChanges.Add( frame.redundantStateChanges );
+		lastFrame = frame;
+		frame = NullGLStats();
+		lastTrace.swap( trace );
+		trace.clear();
+	}
+	
+	NullGLStats GetNullGLStats() {
+		return frame;
+	}
+	
+	NullGLStats GetNullGLFrameStats() {
+		return lastFrame;
+	}
+	
+	void GetNullGLFrameCalls( vector< pair< string, int64 > > & calls ) {
+		calls.clear();
+		for( EntryPoint * ep = entryPoints; ep != NULL; ep = ep->next ) {
+			if( ep->lastFrameCalls > 0 ) {
+				calls.push_back( make_pair( string( ep->name ), ep->lastFrameCalls ) );
+			}
+		}
+		stable_sort( calls.begin(), calls.end(), CompareCalls );
+	}
+	
+}
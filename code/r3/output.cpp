@@ -42,6 +42,7 @@
  */
 
 #include "r3/output.h"
+#include "r3/atomic.h"
 #include "r3/common.h"
 #include "r3/console.h"
 #include "r3/thread.h"
@@ -49,16 +50,34 @@
 
 #include <stdio.h>
 #include <stdarg.h>
+#include <string.h>
+#include <stdlib.h>
+#include <signal.h>
+
+#include <algorithm>
+#include <vector>
 
 #if _WIN32
 # include <Windows.h>
+# include <io.h>
+#else
+# include <unistd.h>
 #endif
 r3::VarBool win_OutputDebugString( "win_OutputDebugString", "Dump output to debugger in Windows.", r3::Var_Archive, false );
+r3::VarBool out_async( "out_async", "Hand Output() to a background writer thread instead of writing in place.", r3::Var_Archive, false );
+r3::VarInteger out_dropped( "out_dropped", "Number of async Output() messages dropped because a thread's ring was full.", r3::Var_ReadOnly, 0 );
 
 #if ANDROID
 extern void platformOutput(const char *msg);
 #endif
 
+// Per-thread ring size for async output, must be a power of two.
+#define OUTPUT_RING_SIZE ( 64 * 1024 )
+// Threads beyond this many fall back to synchronous output.
+#define OUTPUT_MAX_RINGS 64
+// Longest single async message, longer ones are truncated.
+#define OUTPUT_MAX_RECORD ( OUTPUT_RING_SIZE / 4 )
+
 using namespace r3;
 using namespace std;
 
@@ -84,11 +103,338 @@ namespace {
 
 	void (*theOutputFunction)( const char *msg ) = outputFunction;
 
+	void Emit( const char *str, bool toConsole ) {
+#if R3_HAS_CONSOLE
+		extern Console *console;
+		if( toConsole && console != NULL ) {
+			console->AppendOutput( str );
+		}
+#endif
+		theOutputFunction( str );
+	}
+	
+	// Single producer (the owning thread), single consumer (whoever holds
+	// drainMutex).  Records are an 8 byte header followed by the message
+	// bytes, padded to 8 so a header never wraps.
+	struct OutputRing {
+		OutputRing() : dropped( 0 ) {}
+		struct Header {
+			uint len;
+			uint seq;
+		};
+		char data[ OUTPUT_RING_SIZE ];
+		Atomic<uint> head;
+		Atomic<uint> tail;
+		Atomic<uint> dropped;
+		
+		Header HeaderAt( uint pos ) const {
+			return *reinterpret_cast< const Header * >( data + ( pos & ( OUTPUT_RING_SIZE - 1 ) ) );
+		}
+		
+		void Copy( uint pos, const char * src, uint len ) {
+			uint p = pos & ( OUTPUT_RING_SIZE - 1 );
+			uint first = min( len, OUTPUT_RING_SIZE - p );
+			memcpy( data + p, src, first );
+			memcpy( data, src + first, len - first );
+		}
+		
+		bool Write( const char * str, uint len, uint seq ) {
+			uint need = ( sizeof( Header ) + len + 7 ) & ~7;
+			uint t = tail.Get();
+			if( need > OUTPUT_RING_SIZE - ( t - head.Get() ) ) {
+				dropped.Incr();
+				return false;
+			}
+			Header * h = reinterpret_cast< Header * >( data + ( t & ( OUTPUT_RING_SIZE - 1 ) ) );
+			h->len = len;
+			h->seq = seq;
+			Copy( t + sizeof( Header ), str, len );
+			tail.Set( t + need );
+			return true;
+		}
+	};
+	
+	struct PendingRecord {
+		uint seq;
+		string str;
+		bool operator < ( const PendingRecord & rhs ) const {
+			return int( seq - rhs.seq ) < 0;
+		}
+	};
+	
+	OutputRing * rings[ OUTPUT_MAX_RINGS ];
+	Atomic<int> numRings;
+	Atomic<uint> outputSeq;
+	Atomic<int> wakePending;
+	Semaphore outputWake;
+	Mutex drainMutex;
+	// Set by whoever is draining, so the crash handler, which cannot take
+	// drainMutex, knows when the rings are safe to walk.
+	Atomic<int> draining;
+	
+	ThreadLocalPtr< OutputRing > threadRing;
+	
+	// Rings are never freed.  Threads in r3 live as long as the process, so
+	// this bounds memory at OUTPUT_MAX_RINGS * OUTPUT_RING_SIZE.
+	OutputRing * AcquireThreadRing() {
+		OutputRing * r = threadRing.Get();
+		if( r != NULL ) {
+			return r;
+		}
+		int idx = numRings.Get();
+		if( idx >= OUTPUT_MAX_RINGS ) {
+			return NULL;
+		}
+		r = new OutputRing();
+		// reserve the slot before publishing the ring
+		for(;;) {
+			idx = numRings.Get();
+			if( idx >= OUTPUT_MAX_RINGS ) {
+				delete r;
+				return NULL;
+			}
+			if( numRings.CompareAndSwap( idx, idx + 1 ) ) {
+				break;
+			}
+		}
+		AtomicStore( &rings[ idx ], r );
+		threadRing.Set( r );
+		return r;
+	}
+	
+	// Caller holds drainMutex and has set draining.
+	void DrainRings( vector< PendingRecord > & records ) {
+		int n = numRings.Get();
+		for( int i = 0; i < n; i++ ) {
+			OutputRing * r = AtomicLoad( &rings[ i ] );
+			if( r == NULL ) {
+				continue; // slot reserved but not yet published
+			}
+			uint h = r->head.Get();
+			uint t = r->tail.Get();
+			while( h != t ) {
+				OutputRing::Header hdr = r->HeaderAt( h );
+				records.push_back( PendingRecord() );
+				PendingRecord & pr = records.back();
+				pr.seq = hdr.seq;
+				pr.str.resize( hdr.len );
+				uint p = ( h + sizeof( OutputRing::Header ) ) & ( OUTPUT_RING_SIZE - 1 );
+				uint first = min( hdr.len, OUTPUT_RING_SIZE - p );
+				pr.str.replace( 0, first, r->data + p, first );
+				pr.str.replace( first, hdr.len - first, r->data, hdr.len - first );
+				h += ( sizeof( OutputRing::Header ) + hdr.len + 7 ) & ~7;
+			}
+			r->head.Set( h );
+			uint dropped = r->dropped.Get();
+			if( dropped ) {
+				r->dropped.Add( uint( -int( dropped ) ) );
+				out_dropped.SetVal( out_dropped.GetVal() + dropped );
+				PendingRecord pr;
+				pr.seq = records.size() ? records.back().seq : outputSeq.Get();
+				char msg[128];
+				r3Sprintf( msg, "Output: dropped %u messages", dropped );
+				pr.str = msg;
+				records.push_back( pr );
+			}
+		}
+		// restore cross-thread order
+		stable_sort( records.begin(), records.end() );
+	}
+	
+	void FlushRings() {
+		vector< PendingRecord > records;
+		ScopedMutex m( drainMutex, R3_LOC );
+		while( draining.CompareAndSwap( 0, 1 ) == false ) {
+			ThreadYield(); // only contended while crashing
+		}
+		DrainRings( records );
+		draining.Set( 0 );
+		for( int i = 0; i < (int)records.size(); i++ ) {
+			Emit( records[ i ].str.c_str(), true );
+		}
+	}
+	
+	struct OutputThread : public Thread {
+		OutputThread() : Thread( "Output" ) {}
+		void Run() {
+			for(;;) {
+				// A wakeup every so often catches writers that lost the race
+				// on wakePending.
+				outputWake.TimedWait( 0.1 );
+				wakePending.Set( 0 );
+				FlushRings();
+			}
+		}
+	};
+	OutputThread outputThread;
+	
+	// Best effort: get whatever is buffered out before the process dies.
+	// This runs in a signal handler, so it may only touch the rings and
+	// write(2) the bytes already in them: no allocation, no formatting, no
+	// stdio, and no console, since any of those may be what crashed.
+	Atomic<int> crashing;
+	
+	void CrashWrite( const char * str, uint len ) {
+		while( len > 0 ) {
+#if _WIN32
+			int n = _write( 2, str, len );
+#else
+			ssize_t n = write( 2, str, len );
+#endif
+			if( n <= 0 ) {
+				return;
+			}
+			str += n;
+			len -= uint( n );
+		}
+	}
+	
+	void CrashFlush() {
+		if( numRings.Get() == 0 || crashing.CompareAndSwap( 0, 1 ) == false ) {
+			return;
+		}
+		// The Output thread may be part way through a drain.  Give it a
+		// moment to finish, and if it doesn't, leave the rings to it rather
+		// than emit its records a second time.
+		bool acquired = false;
+		for( int i = 0; i < 1000000 && acquired == false; i++ ) {
+			acquired = draining.CompareAndSwap( 0, 1 );
+		}
+		if( acquired == false ) {
+			return;
+		}
+		// merge the rings in sequence order, oldest first
+		int n = numRings.Get();
+		for(;;) {
+			OutputRing * oldest = NULL;
+			uint oldestSeq = 0;
+			for( int i = 0; i < n; i++ ) {
+				OutputRing * r = AtomicLoad( &rings[ i ] );
+				if( r == NULL || r->head.Get() == r->tail.Get() ) {
+					continue;
+				}
+				uint seq = r->HeaderAt( r->head.Get() ).seq;
+				if( oldest == NULL || int( seq - oldestSeq ) < 0 ) {
+					oldest = r;
+					oldestSeq = seq;
+				}
+			}
+			if( oldest == NULL ) {
+				break;
+			}
+			uint h = oldest->head.Get();
+			OutputRing::Header hdr = oldest->HeaderAt( h );
+			uint p = ( h + sizeof( OutputRing::Header ) ) & ( OUTPUT_RING_SIZE - 1 );
+			uint first = min( hdr.len, OUTPUT_RING_SIZE - p );
+			CrashWrite( oldest->data + p, first );
+			CrashWrite( oldest->data, hdr.len - first );
+			CrashWrite( "\n", 1 );
+			oldest->head.Set( h + ( ( sizeof( OutputRing::Header ) + hdr.len + 7 ) & ~7 ) );
+		}
+		for( int i = 0; i < n; i++ ) {
+			OutputRing * r = AtomicLoad( &rings[ i ] );
+			if( r != NULL && r->dropped.Get() ) {
+				const char msg[] = "Output: messages were dropped\n";
+				CrashWrite( msg, sizeof( msg ) - 1 );
+				break;
+			}
+		}
+		draining.Set( 0 );
+	}
+	
+#if _WIN32
+	LONG WINAPI CrashHandler( EXCEPTION_POINTERS * ) {
+		CrashFlush();
+		return EXCEPTION_CONTINUE_SEARCH;
+	}
+	void InstallCrashHandlers() {
+		SetUnhandledExceptionFilter( CrashHandler );
+	}
+#else
+	const int crashSignals[] = { SIGSEGV, SIGBUS, SIGILL, SIGFPE, SIGABRT };
+	struct sigaction previousActions[ ARRAY_ELEMENTS( crashSignals ) ];
+	
+	// Flush, then hand the signal to whatever handler the application had
+	// installed before us, or to the default action.
+	void CrashHandler( int sig, siginfo_t * info, void * context ) {
+		CrashFlush();
+		for( int i = 0; i < (int)ARRAY_ELEMENTS( crashSignals ); i++ ) {
+			if( crashSignals[ i ] != sig ) {
+				continue;
+			}
+			struct sigaction & prev = previousActions[ i ];
+			sigaction( sig, &prev, NULL );
+			if( prev.sa_flags & SA_SIGINFO ) {
+				prev.sa_sigaction( sig, info, context );
+			} else if( prev.sa_handler == SIG_DFL ) {
+				raise( sig );
+			} else if( prev.sa_handler != SIG_IGN ) {
+				prev.sa_handler( sig );
+			}
+			return;
+		}
+	}
+	void InstallCrashHandlers() {
+		struct sigaction sa;
+		memset( &sa, 0, sizeof( sa ) );
+		sa.sa_sigaction = CrashHandler;
+		sa.sa_flags = SA_SIGINFO;
+		sigemptyset( &sa.sa_mask );
+		for( int i = 0; i < (int)ARRAY_ELEMENTS( crashSignals ); i++ ) {
+			sigaction( crashSignals[ i ], &sa, &previousActions[ i ] );
+		}
+	}
+#endif
+	
+	void AtExitFlush() {
+		FlushOutput();
+	}
+	
+	bool OutputAsync( const char * str );
+	
+	void OutputString( const char * str ) {
+		if( out_async.GetVal() && OutputAsync( str ) ) {
+			return;
+		}
+		// keep ordering sane if async mode was just switched off
+		FlushOutput();
+		Emit( str, true );
+	}
+	
+	bool OutputAsync( const char * str ) {
+		OutputRing * r = AcquireThreadRing();
+		if( r == NULL ) {
+			return false;
+		}
+		if( outputThread.running == false ) {
+			ScopedMutex m( outputMutex, R3_LOC );
+			if( outputThread.running == false ) {
+				InstallCrashHandlers();
+				atexit( AtExitFlush );
+				outputThread.Start();
+			}
+		}
+		uint len = (uint)strlen( str );
+		if( len > OUTPUT_MAX_RECORD ) {
+			len = OUTPUT_MAX_RECORD;
+		}
+		r->Write( str, len, outputSeq.Incr() );
+		if( wakePending.CompareAndSwap( 0, 1 ) ) {
+			outputWake.Post();
+		}
+		return true;
+	}
 	
 }
 
 namespace r3 {
 	
+	VarInteger out_level( "out_level", "Minimum level of Output() messages shown (0 = verbose, 1 = info, 2 = warning, 3 = error).", Var_Archive, Output_Info );
+	
+	OutputCategory::OutputCategory( const char * catName, const char * catDesc )
+	: VarInteger( ( string( "out_" ) + catName ).c_str(), catDesc, Var_Archive, -1 ) {
+	}
+	
 	void InitOutput() {
 	}
 
@@ -96,19 +442,33 @@ namespace r3 {
 		theOutputFunction = outFunc;
 	}
 	
+	void FlushOutput() {
+		if( numRings.Get() ) {
+			FlushRings();
+		}
+	}
+	
 	void Output( const char *fmt, ... ) {
+		if( out_level.GetVal() > Output_Info ) {
+			return;
+		}
 		char str[16384];
 		va_list args;
 		va_start( args, fmt );
 		r3Vsprintf( str, fmt, args );
 		va_end( args );
-#if R3_HAS_CONSOLE
-		extern Console *console;
-        if( console  != NULL ) {
-            console->AppendOutput( str );
-        }
-#endif
-		theOutputFunction( str );
+		OutputString( str );
+	}
+	
+	void OutputAt( OutputLevelEnum level, const char *fmt, ... ) {
+		const char * prefix[] = { "", "", "warning: ", "error: " };
+		char str[16384];
+		int len = r3Sprintf( str, "%s", prefix[ level ] );
+		va_list args;
+		va_start( args, fmt );
+		vsnprintf( str + len, sizeof( str ) - len, fmt, args );
+		va_end( args );
+		OutputString( str );
 	}
 
 	void OutputDebug( const char *fmt, ... ) {
@@ -43,6 +43,7 @@
 
 #include "r3/common.h"
 #include "r3/parse.h"
+#include "r3/profile.h"
 
 #include <map>
 #include <stdlib.h>
@@ -95,6 +96,7 @@ namespace r3 {
 	}
 	
 	vector< Token > TokenizeString( const char *str, const char *delimiters ) {
+		R3_PROFILE( "TokenizeString" );
 		string s( str );
 		vector< Token > toks;
 		//Output("Called TokenizeString( %s )\n", str );
@@ -0,0 +1,224 @@
+/*
+ *  profile
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#include "r3/profile.h"
+
+#include "r3/command.h"
+#include "r3/filesystem.h"
+#include "r3/output.h"
+#include "r3/thread.h"
+#include "r3/time.h"
+#include "r3/var.h"
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+using namespace std;
+using namespace r3;
+
+// Threads beyond this many are not profiled.
+#define PROFILE_MAX_THREADS 64
+
+VarInteger prof_maxEvents( "prof_maxEvents", "Per-thread event capacity of a profile capture.", Var_Archive, 65536 );
+
+namespace r3 {
+	volatile int profileCapturing;
+}
+
+namespace {
+	
+	struct ProfileEvent {
+		const char * name;
+		uint64 begin;
+		uint64 end;
+	};
+	
+	// Written only by its own thread.  A new capture is noticed by the
+	// generation changing, and the owning thread resets the buffer itself.
+	struct ProfileBuffer {
+		ProfileBuffer( int capacity ) : events( capacity ), count( 0 ), generation( 0 ), dropped( 0 ) {}
+		vector< ProfileEvent > events;
+		Atomic<int> count;
+		Atomic<int> generation;
+		Atomic<uint> dropped;
+		string threadName;
+	};
+	
+	ProfileBuffer * buffers[ PROFILE_MAX_THREADS ];
+	Atomic<int> numBuffers;
+	Atomic<int> captureGeneration;
+	ThreadLocalPtr< ProfileBuffer > threadBuffer;
+	uint64 captureStart;
+	
+	ProfileBuffer * AcquireThreadBuffer() {
+		ProfileBuffer * b = threadBuffer.Get();
+		if( b != NULL ) {
+			return b;
+		}
+		int idx;
+		for(;;) {
+			idx = numBuffers.Get();
+			if( idx >= PROFILE_MAX_THREADS ) {
+				return NULL;
+			}
+			if( numBuffers.CompareAndSwap( idx, idx + 1 ) ) {
+				break;
+			}
+		}
+		b = new ProfileBuffer( max( 1, prof_maxEvents.GetVal() ) );
+		b->threadName = GetThreadName();
+		AtomicStore( &buffers[ idx ], b );
+		threadBuffer.Set( b );
+		return b;
+	}
+	
+	string JsonEscape( const char * s ) {
+		string r;
+		for( ; *s; s++ ) {
+			if( *s == '"' || *s == '\\' ) {
+				r += '\\';
+			}
+			r += *s;
+		}
+		return r;
+	}
+	
+	void ProfileStartCmd( const vector< Token > & tokens ) {
+		ProfileStart();
+		Output( "Profile capture started." );
+	}
+	CommandFunc ProfileStartCmdCmd( "profilestart", "starts a profile capture", ProfileStartCmd );
+	
+	void ProfileStopCmd( const vector< Token > & tokens ) {
+		string filename = tokens.size() > 1 ? tokens[1].valString : "profile.json";
+		if( ProfileStop( filename ) ) {
+			Output( "Wrote profile capture to %s", filename.c_str() );
+		} else {
+			Output( "Unable to write profile capture to %s", filename.c_str() );
+		}
+	}
+	CommandFunc ProfileStopCmdCmd( "profilestop", "stops the profile capture and writes it as chrome trace json - profilestop [filename]", ProfileStopCmd );
+	
+}
+
+namespace r3 {
+	
+	uint64 ProfileTimestamp() {
+		return GetMonotonicNanoseconds();
+	}
+	
+	void ProfileRecord( const char * name, uint64 begin, uint64 end ) {
+		ProfileBuffer * b = AcquireThreadBuffer();
+		if( b == NULL ) {
+			return;
+		}
+		int gen = captureGeneration.Get();
+		if( b->generation.Get() != gen ) {
+			b->count.Set( 0 );
+			b->dropped.Set( 0 );
+			b->generation.Set( gen );
+		}
+		int n = b->count.Get();
+		if( n >= (int)b->events.size() ) {
+			b->dropped.Incr();
+			return;
+		}
+		ProfileEvent & e = b->events[ n ];
+		e.name = name;
+		e.begin = begin;
+		e.end = end;
+		b->count.Set( n + 1 );
+	}
+	
+	void ProfileStart() {
+		captureStart = ProfileTimestamp();
+		captureGeneration.Incr();
+		AtomicStore( &profileCapturing, 1 );
+	}
+	
+	bool ProfileStop( const string & filename ) {
+		AtomicStore( &profileCapturing, 0 );
+		int gen = captureGeneration.Get();
+		stringstream ss( stringstream::out );
+		ss.setf( ios::fixed );
+		ss.precision( 3 );
+		ss << "{ \"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+		int total = 0;
+		uint dropped = 0;
+		int n = numBuffers.Get();
+		for( int i = 0; i < n; i++ ) {
+			ProfileBuffer * b = AtomicLoad( &buffers[ i ] );
+			if( b == NULL || b->generation.Get() != gen ) {
+				continue;
+			}
+			ss << ( total ? ",\n" : "" ) << "{ \"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << i
+			   << ", \"args\": { \"name\": \"" << JsonEscape( b->threadName.c_str() ) << "\" } }";
+			total++;
+			int count = b->count.Get();
+			for( int j = 0; j < count; j++ ) {
+				const ProfileEvent & e = b->events[ j ];
+				if( e.begin < captureStart ) {
+					continue; // scope began before the capture
+				}
+				ss << ",\n{ \"name\": \"" << JsonEscape( e.name ) << "\", \"cat\": \"r3\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << i
+				   << ", \"ts\": " << ( e.begin - captureStart ) * 1e-3 << ", \"dur\": " << ( e.end - e.begin ) * 1e-3 << " }";
+				total++;
+			}
+			dropped += b->dropped.Get();
+		}
+		ss << "\n] }\n";
+		if( dropped ) {
+			Output( "Profile capture dropped %u events, raise prof_maxEvents.", dropped );
+		}
+		File * f = FileOpenForWrite( filename );
+		if( f == NULL ) {
+			return false;
+		}
+		string s = ss.str();
+		f->Write( s.c_str(), 1, (int)s.size() );
+		delete f;
+		return true;
+	}
+	
+}
@@ -44,6 +44,8 @@
 #include "r3/shader.h"
 
 #include "r3/common.h"
+#include "r3/draw.h"
+#include "r3/glstate.h"
 #include "r3/command.h"
 #include "r3/filesystem.h"
 #include "r3/output.h"
@@ -188,6 +190,7 @@ namespace r3 {
     
     Shader::~Shader() {
         shaderDatabase->DeleteShader( name );
+        StateForgetProgram( pgObject );
         glDeleteProgram( pgObject );
         glDeleteShader( vsObject );
         glDeleteShader( fsObject );
@@ -206,14 +209,17 @@ namespace r3 {
     }
     
     void Shader::SetUniform( const string & name, const Matrix4f & m ) {
+        FlushQuads(); // queued quads were meant to draw with the old value
         GLint slot = GetSlot( pgObject, uniform, name );
         glProgramUniformMatrix4fvEXT( pgObject, slot, 1, GL_FALSE, m.Ptr() );
     }    
     void Shader::SetUniform( const string & name, const Vec3f & v ) {
+        FlushQuads(); // queued quads were meant to draw with the old value
         GLint slot = GetSlot( pgObject, uniform, name );
         glProgramUniform3fvEXT( pgObject, slot, 1, v.Ptr() );
     }
     void Shader::SetUniform( const string & name, GLint i ) {
+        FlushQuads(); // queued quads were meant to draw with the old value
         GLint slot = GetSlot( pgObject, uniform, name );
         glProgramUniform1iEXT( pgObject, slot, i );
     }    
@@ -238,9 +244,9 @@ namespace r3 {
         dbgLog[ dbgLogLen ] = 0;
         Output( "%s\n", dbgLog );
         
-        glUseProgram( shd->pgObject );
+        StateUseProgram( shd->pgObject );
         // set up samplers and uniforms
-        glUseProgram( 0 );
+        StateUseProgram( 0 );
         
         // load the shaders!
         return shd;
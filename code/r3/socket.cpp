@@ -316,7 +316,7 @@ namespace r3 {
 		return i;
 	}
 
-	bool Socket::CanRead() {
+	bool Socket::CanRead( double timeout ) {
     if( s < 0 ) {
       return false;
     }
@@ -324,8 +324,8 @@ namespace r3 {
 		FD_ZERO( & fds );
 		FD_SET( s, & fds );
 		timeval tv;
-		tv.tv_sec = 0;
-		tv.tv_usec = 0;
+		tv.tv_sec = long( timeout );
+		tv.tv_usec = long( ( timeout - tv.tv_sec ) * 1e6 );
 		int r = 0;
 		if( (r = select( (int)s+1, & fds, NULL, NULL, &tv )) <= 0 ) {
 			if( r < 0 ) {
@@ -45,6 +45,8 @@
 
 #include "r3/command.h"
 #include "r3/common.h"
+#include "r3/draw.h"
+#include "r3/glstate.h"
 #include "r3/image.h"
 #include "r3/output.h"
 #include <GL/Regal.h>
@@ -281,24 +283,30 @@ namespace r3 {
   
   Texture::~Texture() {
     textureDatabase->DeleteTexture( name );
+    StateForgetTexture( object );
     glDeleteTextures( 1, &object );
   }
   
   
   void Texture::Bind( int imageUnit ) {
-    glBindMultiTextureEXT( GL_TEXTURE0 + imageUnit, GlTarget[ target ], object );
+    StateBindTexture( imageUnit, GlTarget[ target ], object );
   }
   
   void Texture::Enable( int imageUnit ) {
-    glEnableIndexedEXT( GlTarget[ target ], imageUnit );
+    StateEnableTexture( imageUnit, GlTarget[ target ], true );
   }
   
   void Texture::Disable( int imageUnit ) {
-    glDisableIndexedEXT( GlTarget[ target ], imageUnit );
+    StateEnableTexture( imageUnit, GlTarget[ target ], false );
   }
   
-  void Texture::ClampToEdge() {
+  void Texture::BindForUpdate() {
+    FlushQuads(); // queued quads may sample the old contents
     Bind( modBindUnit );
+  }
+  
+  void Texture::ClampToEdge() {
+    BindForUpdate();
     GLenum t = GlTarget[ target ];
     glTexParameteri( t, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
     glTexParameteri( t, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE	);
@@ -306,7 +314,7 @@ namespace r3 {
   
   void Texture::SetSampler( const SamplerParams & s ) {
     GET_ERROR( e );
-    Bind( modBindUnit );
+    BindForUpdate();
     sampler = s;
     GLenum t = GlTarget[ target ];
     glTexParameteri( t, GL_TEXTURE_MAG_FILTER, GlMagFilt[ s.magFilter ] );
@@ -363,6 +371,7 @@ namespace r3 {
     if( object == 0 ) {
       return;
     }
+    StateForgetTexture( object );
     glDeleteTextures( 1, &object );
     object = 0;
   }
@@ -370,7 +379,7 @@ namespace r3 {
   
   void Texture2D::SetImage( int level, void *data ) {
     GET_ERROR( e );
-    Bind( modBindUnit );
+    BindForUpdate();
     
     // FIXME:  Need a feature level query
     paddedWidth = NextPowerOfTwo( width );
@@ -395,14 +404,14 @@ namespace r3 {
   
   void Texture2D::SetSubImage( int level, int xoff, int yoff, int w, int h, void *data ) {
     GET_ERROR( e );
-    Bind( modBindUnit );
+    BindForUpdate();
     glTexSubImage2D( GlTarget[ Target() ], level, xoff, yoff, w, h, GlFormat[ Format() ], GL_UNSIGNED_BYTE, data );
     GET_ERROR( e2 );
     //Output( "setting sub image data - e=%x, e2=%x, xoff=%d, yoff=%d, w=%d, h=%d", e, e2, xoff, yoff, w, h );
   }
   
   void Texture2D::GetImage( int level, void *pixels ) {
-    Bind( modBindUnit );
+    BindForUpdate();
     
     // FIXME: Need a feature level query, or Regal needs to construct an FBO with this texture and read it back via ReadPixels
     glGetTexImage( GlTarget[ Target() ], level, GlFormat[ Format() ], GL_UNSIGNED_BYTE, pixels );
@@ -438,7 +447,11 @@ namespace r3 {
     }
     Image<byte> * img = new Image<byte>();
     int w = 128;
-    img->SetSize( w, w, 4 );
+    if ( img->SetSize( w, w, 4 ) == false ) {
+      Output( "Failed creating texture for %s", name.c_str() );
+      delete img;
+      return NULL;
+    }
     for( int i = 0; i < w; i++ ) {
       for( int j = 0; j < w; j++ ) {
         byte * c = &(*img)( i, j, 0 );
@@ -506,7 +519,11 @@ namespace r3 {
       int yoff[] = { 1, 1, 1, 0, 0, 0 };
       int rot[] = { 0, 1, 2, 2, 2, 2 };
       Image<byte> subimg;
-      subimg.SetSize( w, w, img->Components());
+      if ( subimg.SetSize( w, w, img->Components() ) == false ) {
+        Output( "Failed creating texture for %s", Name().c_str() );
+        delete img;
+        return;
+      }
       for( int i = 0; i < 6; i++ ) {
         img->CopySubImage( subimg, w * xoff[i], w * yoff[i] );
         subimg.Rotate( rot[i] );
@@ -523,6 +540,7 @@ namespace r3 {
     if( object == 0 ) {
       return;
     }
+    StateForgetTexture( object );
     glDeleteTextures( 1, &object );
     object = 0;
   }
@@ -530,7 +548,7 @@ namespace r3 {
   
   void TextureCube::SetImage( GLenum face, int level, void *data ) {
     GET_ERROR( e );
-    Bind( modBindUnit );
+    BindForUpdate();
     
     // FIXME:  Need a feature level query
     paddedWidth = NextPowerOfTwo( width );
@@ -564,14 +582,14 @@ namespace r3 {
   
   void TextureCube::SetSubImage( GLenum face, int level, int xoff, int yoff, int w, int h, void *data ) {
     GET_ERROR( e );
-    Bind( modBindUnit );
+    BindForUpdate();
     glTexSubImage2D( face, level, xoff, yoff, w, h, GlFormat[ Format() ], GL_UNSIGNED_BYTE, data );
     GET_ERROR( e2 );
     //Output( "setting sub image data - e=%x, e2=%x, xoff=%d, yoff=%d, w=%d, h=%d", e, e2, xoff, yoff, w, h );
   }
   
   void TextureCube::GetImage( GLenum face, int level, void *pixels ) {
-    Bind( modBindUnit );
+    BindForUpdate();
     
     // FIXME: Need a feature level query, or Regal needs to construct an FBO with this texture and read it back via ReadPixels
     glGetTexImage( face, level, GlFormat[ Format() ], GL_UNSIGNED_BYTE, pixels );
@@ -597,6 +615,12 @@ namespace r3 {
     Output( "Creating texture for %s", filename.c_str() );
     
     int w = img->Height() / 2;
+    Image<byte> subimg;
+    if ( subimg.SetSize( w, w, img->Components() ) == false ) {
+      Output( "Failed creating texture for %s", filename.c_str() );
+      delete img;
+      return NULL;
+    }
     tex = TextureCube::Create( filename, (TextureFormatEnum)img->Components(), w );
     tex->SetGenerated( false );
     
@@ -607,8 +631,6 @@ namespace r3 {
     int xoff[] = { 0, 1, 2, 0, 1, 2 };
     int yoff[] = { 1, 1, 1, 0, 0, 0 };
     int rot[] = { 0, 1, 2, 2, 2, 2 };
-    Image<byte> subimg;
-    subimg.SetSize( w, w, img->Components());
     for( int i = 0; i < 6; i++ ) {
       img->CopySubImage( subimg, w * xoff[i], w * yoff[i] );
       subimg.Rotate( rot[i] );
@@ -629,7 +651,11 @@ namespace r3 {
     }
     Image<byte> * img = new Image<byte>();
     int w = 128;
-    img->SetSize( w, w, 4 );
+    if ( img->SetSize( w, w, 4 ) == false ) {
+      Output( "Failed creating texture for %s", name.c_str() );
+      delete img;
+      return NULL;
+    }
     for( int i = 0; i < w; i++ ) {
       for( int j = 0; j < w; j++ ) {
         byte * c = &(*img)( i, j, 0 );
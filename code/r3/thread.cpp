@@ -49,6 +49,7 @@
 # include <unistd.h> 
 #endif
 
+#include <assert.h>
 #include <map>
 
 using namespace r3;
@@ -59,6 +60,25 @@ namespace  {
 	int numThreads;
     string invalidThread;
     map<NativeThread,string> threadToName;    
+	
+	struct JobWorker : public Thread {
+		JobWorker() : Thread( "JobWorker" ), func( NULL ), arg( NULL ) {}
+		Semaphore start;
+		void (*func)( void * );
+		void * arg;
+		virtual void Run();
+	};
+	JobWorker jobWorkers[ MaxJobThreads - 1 ];
+	Semaphore jobWorkersDone;
+	Mutex jobWorkersMutex;
+	
+	void JobWorker::Run() {
+		for( ;; ) {
+			start.Wait();
+			func( arg );
+			jobWorkersDone.Post();
+		}
+	}
 }
 
 
@@ -119,6 +139,26 @@ namespace r3 {
             threadToName.erase( thr );
         }
     }
+	
+	void RunJobs( void (*func)( void * ), void * jobs, int jobSize, int numJobs ) {
+		assert( numJobs <= MaxJobThreads );
+		if( numJobs <= 0 ) {
+			return;
+		}
+		char * job = static_cast< char * >( jobs );
+		ScopedMutex scm( jobWorkersMutex, R3_LOC );
+		for( int i = 1; i < numJobs; i++ ) {
+			JobWorker & w = jobWorkers[ i - 1 ];
+			w.func = func;
+			w.arg = job + i * jobSize;
+			w.Start();
+			w.start.Post();
+		}
+		func( job );
+		for( int i = 1; i < numJobs; i++ ) {
+			jobWorkersDone.Wait();
+		}
+	}
 
 	
 	void Thread::Start() {
@@ -42,8 +42,19 @@
 
 #include "r3/time.h"
 
+#include "r3/atomic.h"
+
+#if __APPLE__
+# include <mach/mach_time.h>
+#elif !_WIN32
+# include <time.h>
+#endif
+
+using namespace r3;
+
 namespace {
 	double timeOffset = 0.0;
+	int64 secondsOrigin;
 }
 
 namespace r3 {
@@ -53,5 +64,38 @@ namespace r3 {
 	double GetTimeOffset() {
 		return timeOffset;
 	}
+	
+	uint64 GetMonotonicNanoseconds() {
+#if __APPLE__
+		static mach_timebase_info_data_t tb;
+		if( tb.denom == 0 ) {
+			mach_timebase_info( &tb );
+		}
+		return mach_absolute_time() * tb.numer / tb.denom;
+#elif _WIN32
+		static LARGE_INTEGER freq;
+		if( freq.QuadPart == 0 ) {
+			QueryPerformanceFrequency( &freq );
+		}
+		LARGE_INTEGER c;
+		QueryPerformanceCounter( &c );
+		return uint64( c.QuadPart / freq.QuadPart ) * 1000000000ULL + uint64( c.QuadPart % freq.QuadPart ) * 1000000000ULL / freq.QuadPart;
+#else
+		timespec ts;
+		clock_gettime( CLOCK_MONOTONIC, &ts );
+		return uint64( ts.tv_sec ) * 1000000000ULL + ts.tv_nsec;
+#endif
+	}
+	
+	float GetSeconds() {
+		int64 now = int64( GetMonotonicNanoseconds() );
+		int64 origin = AtomicLoad( &secondsOrigin );
+		if( origin == 0 ) {
+			// first caller wins, everyone else uses its value
+			AtomicCompareAndSwap( &secondsOrigin, int64( 0 ), now );
+			origin = AtomicLoad( &secondsOrigin );
+		}
+		return float( ( now - origin ) * 1e-9 );
+	}
 }
 
@@ -0,0 +1,418 @@
+/*
+ *  timer
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#include "r3/timer.h"
+
+#include "r3/thread.h"
+#include "r3/time.h"
+
+#include <vector>
+
+using namespace std;
+using namespace r3;
+
+// Granularity of the wheel, in seconds.
+#define TIMER_TICK 0.01
+
+// Four levels of 64 slots cover 2^24 ticks, about 46 hours at 10ms.
+// Anything further out sits in the last slot of the top level and is
+// re-placed each time that slot cascades.
+#define WHEEL_BITS 6
+#define WHEEL_SIZE ( 1 << WHEEL_BITS )
+#define WHEEL_MASK ( WHEEL_SIZE - 1 )
+#define WHEEL_LEVELS 4
+
+namespace {
+	
+	const uint64 NoTick = ~uint64( 0 );
+	
+	enum TimerState {
+		Timer_Free,
+		Timer_Pending,
+		Timer_Firing
+	};
+	
+	struct TimerNode {
+		int prev;
+		int next;
+		int level;
+		int slot;
+		uint64 expires;
+		uint64 period;
+		TimerFunc func;
+		void * data;
+		uint serial;
+		TimerState state;
+	};
+	
+	struct FiringTimer {
+		int index;
+		uint serial;
+		TimerFunc func;
+		void * data;
+	};
+	
+	// Hierarchical timing wheel.  Timers live in intrusive doubly linked
+	// lists indexed into the nodes array, so insert and cancel are constant
+	// time.  "current" is the next tick to be processed.
+	struct TimerWheel {
+		uint64 current;
+		int slots[ WHEEL_LEVELS ][ WHEEL_SIZE ];
+		int count[ WHEEL_LEVELS ];
+		vector< TimerNode > nodes;
+		int freeList;
+		uint serial;
+		
+		TimerWheel() : current( 0 ), freeList( -1 ), serial( 0 ) {
+			for( int l = 0; l < WHEEL_LEVELS; l++ ) {
+				count[ l ] = 0;
+				for( int s = 0; s < WHEEL_SIZE; s++ ) {
+					slots[ l ][ s ] = -1;
+				}
+			}
+		}
+		
+		int Alloc() {
+			int i = freeList;
+			if( i >= 0 ) {
+				freeList = nodes[ i ].next;
+			} else {
+				i = (int)nodes.size();
+				nodes.push_back( TimerNode() );
+			}
+			if( ++serial == 0 ) {
+				serial = 1;
+			}
+			TimerNode & n = nodes[ i ];
+			n.prev = n.next = -1;
+			n.serial = serial;
+			n.state = Timer_Pending;
+			return i;
+		}
+		
+		void Free( int i ) {
+			nodes[ i ].state = Timer_Free;
+			nodes[ i ].next = freeList;
+			freeList = i;
+		}
+		
+		void Link( int i ) {
+			TimerNode & n = nodes[ i ];
+			uint64 e = n.expires < current ? current : n.expires;
+			uint64 delta = e - current;
+			int level = 0;
+			while( level < WHEEL_LEVELS - 1 && delta >= ( uint64( 1 ) << ( WHEEL_BITS * ( level + 1 ) ) ) ) {
+				level++;
+			}
+			if( delta >= ( uint64( 1 ) << ( WHEEL_BITS * WHEEL_LEVELS ) ) ) {
+				e = current + ( uint64( 1 ) << ( WHEEL_BITS * WHEEL_LEVELS ) ) - 1;
+			}
+			n.level = level;
+			n.slot = int( ( e >> ( WHEEL_BITS * level ) ) & WHEEL_MASK );
+			int & head = slots[ n.level ][ n.slot ];
+			n.prev = -1;
+			n.next = head;
+			if( head >= 0 ) {
+				nodes[ head ].prev = i;
+			}
+			head = i;
+			count[ level ]++;
+		}
+		
+		void Unlink( int i ) {
+			TimerNode & n = nodes[ i ];
+			if( n.prev >= 0 ) {
+				nodes[ n.prev ].next = n.next;
+			} else {
+				slots[ n.level ][ n.slot ] = n.next;
+			}
+			if( n.next >= 0 ) {
+				nodes[ n.next ].prev = n.prev;
+			}
+			n.prev = n.next = -1;
+			count[ n.level ]--;
+		}
+		
+		void Cascade( int level, int slot ) {
+			int i = slots[ level ][ slot ];
+			while( i >= 0 ) {
+				int next = nodes[ i ].next;
+				Unlink( i );
+				Link( i );
+				i = next;
+			}
+		}
+		
+		// The first tick at or after current where Step() has something to do.
+		uint64 NextEventTick() const {
+			uint64 best = NoTick;
+			if( count[ 0 ] ) {
+				for( int i = 0; i < WHEEL_SIZE; i++ ) {
+					if( slots[ 0 ][ ( current + i ) & WHEEL_MASK ] >= 0 ) {
+						best = current + i;
+						break;
+					}
+				}
+			}
+			for( int l = 1; l < WHEEL_LEVELS; l++ ) {
+				if( count[ l ] == 0 ) {
+					continue;
+				}
+				int shift = WHEEL_BITS * l;
+				for( int i = 0; i <= WHEEL_SIZE; i++ ) {
+					uint64 b = ( current >> shift ) + i;
+					uint64 t = b << shift;
+					if( t < current ) {
+						continue;
+					}
+					if( slots[ l ][ b & WHEEL_MASK ] >= 0 ) {
+						if( t < best ) {
+							best = t;
+						}
+						break;
+					}
+				}
+			}
+			return best;
+		}
+		
+		void Step( vector< FiringTimer > & firing ) {
+			int index = int( current & WHEEL_MASK );
+			for( int l = 1; index == 0 && l < WHEEL_LEVELS; l++ ) {
+				index = int( ( current >> ( WHEEL_BITS * l ) ) & WHEEL_MASK );
+				Cascade( l, index );
+			}
+			index = int( current & WHEEL_MASK );
+			int i = slots[ 0 ][ index ];
+			while( i >= 0 ) {
+				TimerNode & n = nodes[ i ];
+				int next = n.next;
+				Unlink( i );
+				n.state = Timer_Firing;
+				FiringTimer f;
+				f.index = i;
+				f.serial = n.serial;
+				f.func = n.func;
+				f.data = n.data;
+				firing.push_back( f );
+				i = next;
+			}
+			current++;
+		}
+		
+		// Process every tick up to and including now, skipping the empty ones.
+		void Advance( uint64 now, vector< FiringTimer > & firing ) {
+			while( current <= now ) {
+				uint64 next = NextEventTick();
+				if( next > now ) {
+					current = now + 1;
+					break;
+				}
+				current = next;
+				Step( firing );
+			}
+		}
+	};
+	
+	struct TimerThread : public Thread {
+		TimerThread() : Thread( "Timer" ), sleepUntil( NoTick ), shutdown( false ) {
+			base = GetMonotonicSeconds();
+		}
+		
+		Mutex mutex;
+		Semaphore wakeup;
+		TimerWheel wheel;
+		double base;
+		uint64 sleepUntil;
+		bool shutdown;
+		
+		uint64 TimeToTick( double t ) const {
+			double ticks = ( t - base ) / TIMER_TICK;
+			return ticks > 0.0 ? uint64( ticks ) : 0;
+		}
+		
+		double TickToTime( uint64 tick ) const {
+			return base + tick * TIMER_TICK;
+		}
+		
+		TimerId Schedule( double delay, TimerFunc func, void * data, double period ) {
+			ScopedMutex m( mutex, R3_LOC );
+			if( shutdown ) {
+				return InvalidTimerId;
+			}
+			int i = wheel.Alloc();
+			TimerNode & n = wheel.nodes[ i ];
+			// round up, so a timer never fires early
+			n.expires = TimeToTick( GetMonotonicSeconds() + ( delay > 0.0 ? delay : 0.0 ) + TIMER_TICK );
+			n.period = 0;
+			if( period > 0.0 ) {
+				n.period = uint64( period / TIMER_TICK );
+				n.period = n.period > 0 ? n.period : 1;
+			}
+			n.func = func;
+			n.data = data;
+			wheel.Link( i );
+			if( n.expires < sleepUntil ) {
+				sleepUntil = n.expires;
+				wakeup.Post();
+			}
+			if( running == false ) {
+				Start();
+			}
+			return ( TimerId( n.serial ) << 32 ) | uint( i );
+		}
+		
+		bool Cancel( TimerId id ) {
+			ScopedMutex m( mutex, R3_LOC );
+			int i = int( id & 0xffffffff );
+			uint serial = uint( id >> 32 );
+			if( id == InvalidTimerId || i >= (int)wheel.nodes.size() ) {
+				return false;
+			}
+			TimerNode & n = wheel.nodes[ i ];
+			if( n.serial != serial || n.state == Timer_Free ) {
+				return false;
+			}
+			if( n.state == Timer_Pending ) {
+				wheel.Unlink( i );
+			} else if( n.period == 0 ) {
+				return false; // one-shot already running
+			}
+			wheel.Free( i );
+			return true;
+		}
+		
+		void Finish( const vector< FiringTimer > & firing ) {
+			ScopedMutex m( mutex, R3_LOC );
+			for( int j = 0; j < (int)firing.size(); j++ ) {
+				const FiringTimer & f = firing[ j ];
+				TimerNode & n = wheel.nodes[ f.index ];
+				if( n.serial != f.serial || n.state != Timer_Firing ) {
+					continue; // cancelled from inside the callback
+				}
+				if( n.period == 0 ) {
+					wheel.Free( f.index );
+					continue;
+				}
+				// don't try to catch up on periods that were missed
+				n.expires += n.period;
+				if( n.expires < wheel.current ) {
+					n.expires = wheel.current;
+				}
+				n.state = Timer_Pending;
+				wheel.Link( f.index );
+			}
+		}
+		
+		void Run() {
+			vector< FiringTimer > firing;
+			for(;;) {
+				double wait = -1.0;
+				{
+					ScopedMutex m( mutex, R3_LOC );
+					if( shutdown ) {
+						break;
+					}
+					double t = GetMonotonicSeconds();
+					wheel.Advance( TimeToTick( t ), firing );
+					if( firing.size() == 0 ) {
+						sleepUntil = wheel.NextEventTick();
+						if( sleepUntil != NoTick ) {
+							wait = TickToTime( sleepUntil ) - t;
+						}
+					}
+				}
+				if( firing.size() ) {
+					for( int j = 0; j < (int)firing.size(); j++ ) {
+						firing[ j ].func( firing[ j ].data );
+					}
+					Finish( firing );
+					firing.clear();
+					continue;
+				}
+				// nothing scheduled means nothing to do until someone schedules
+				if( wait < 0.0 ) {
+					wakeup.Wait();
+				} else {
+					wakeup.TimedWait( wait );
+				}
+			}
+		}
+	};
+	
+	TimerThread * timerThread;
+	
+	TimerThread * GetTimerThread() {
+		if( timerThread == NULL ) {
+			timerThread = new TimerThread();
+		}
+		return timerThread;
+	}
+	
+}
+
+namespace r3 {
+	
+	void InitTimer() {
+		GetTimerThread();
+	}
+	
+	void ShutdownTimer() {
+		if( timerThread == NULL ) {
+			return;
+		}
+		ScopedMutex m( timerThread->mutex, R3_LOC );
+		timerThread->shutdown = true;
+		timerThread->wakeup.Post();
+		// the thread is not joined, so the object is intentionally leaked
+	}
+	
+	TimerId ScheduleTimer( double delay, TimerFunc func, void * data, double period ) {
+		return GetTimerThread()->Schedule( delay, func, data, period );
+	}
+	
+	bool CancelTimer( TimerId id ) {
+		return GetTimerThread()->Cancel( id );
+	}
+	
+}
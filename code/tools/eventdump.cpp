@@ -0,0 +1,283 @@
+/*
+ *  eventdump
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+// Renders an r3 binary event log (see r3/eventlog.h) as text or JSON.
+//   eventdump [-json] events.r3ev
+
+#include "r3/eventlog.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace r3;
+
+namespace {
+	
+	struct EventArg {
+		uchar tag;
+		int64 i;
+		double d;
+		string s;
+	};
+	
+	template <typename T> bool ReadValue( FILE * fp, T & v ) {
+		return fread( &v, sizeof( v ), 1, fp ) == 1;
+	}
+	
+	template <typename T> bool ReadArg( const uchar * & p, const uchar * end, T & v ) {
+		if( end - p < (int)sizeof( v ) ) {
+			return false;
+		}
+		memcpy( &v, p, sizeof( v ) );
+		p += sizeof( v );
+		return true;
+	}
+	
+	// Rejects the record if any argument runs past its end.
+	bool DecodeArgs( const uchar * p, int size, vector< EventArg > & args ) {
+		const uchar * end = p + size;
+		while( p < end ) {
+			EventArg a;
+			a.tag = *p++;
+			a.i = 0;
+			a.d = 0.0;
+			switch( a.tag ) {
+				case 'i': { int v; if( ReadArg( p, end, v ) == false ) return false; a.i = v; a.d = v; } break;
+				case 'u': { uint v; if( ReadArg( p, end, v ) == false ) return false; a.i = v; a.d = v; } break;
+				case 'l': { int64 v; if( ReadArg( p, end, v ) == false ) return false; a.i = v; a.d = double( v ); } break;
+				case 'd': { if( ReadArg( p, end, a.d ) == false ) return false; a.i = int64( a.d ); } break;
+				case 's': {
+					uchar len;
+					if( ReadArg( p, end, len ) == false || end - p < len ) {
+						return false;
+					}
+					a.s.assign( (const char *)p, len );
+					p += len;
+				} break;
+				default: return false;
+			}
+			args.push_back( a );
+		}
+		return p == end;
+	}
+	
+	// Re-apply the printf format one conversion at a time, using the
+	// recorded argument type rather than trusting the length modifiers.
+	string Render( const string & fmt, const vector< EventArg > & args ) {
+		string out;
+		int argi = 0;
+		for( int i = 0; i < (int)fmt.size(); i++ ) {
+			if( fmt[ i ] != '%' ) {
+				out += fmt[ i ];
+				continue;
+			}
+			if( i + 1 < (int)fmt.size() && fmt[ i + 1 ] == '%' ) {
+				out += '%';
+				i++;
+				continue;
+			}
+			string spec = "%";
+			int j = i + 1;
+			while( j < (int)fmt.size() && strchr( "-+ #0123456789.", fmt[ j ] ) ) {
+				spec += fmt[ j++ ];
+			}
+			while( j < (int)fmt.size() && strchr( "hlLqjzt", fmt[ j ] ) ) {
+				j++;
+			}
+			if( j >= (int)fmt.size() ) {
+				break;
+			}
+			char conv = fmt[ j ];
+			i = j;
+			if( argi >= (int)args.size() ) {
+				out += "<?>";
+				continue;
+			}
+			const EventArg & a = args[ argi++ ];
+			char buf[1024];
+			if( a.tag == 's' ) {
+				snprintf( buf, sizeof( buf ), ( spec + 's' ).c_str(), a.s.c_str() );
+			} else if( strchr( "eEfgGaA", conv ) ) {
+				snprintf( buf, sizeof( buf ), ( spec + conv ).c_str(), a.d );
+			} else if( conv == 'c' ) {
+				snprintf( buf, sizeof( buf ), ( spec + 'c' ).c_str(), int( a.i ) );
+			} else if( strchr( "diouxX", conv ) ) {
+				snprintf( buf, sizeof( buf ), ( spec + "ll" + conv ).c_str(), (long long)a.i );
+			} else if( a.tag == 'd' ) {
+				snprintf( buf, sizeof( buf ), "%g", a.d );
+			} else {
+				snprintf( buf, sizeof( buf ), "%lld", (long long)a.i );
+			}
+			out += buf;
+		}
+		return out;
+	}
+	
+	string JsonString( const string & s ) {
+		string out = "\"";
+		for( int i = 0; i < (int)s.size(); i++ ) {
+			uchar c = s[ i ];
+			if( c == '"' || c == '\\' ) {
+				out += '\\';
+				out += c;
+			} else if( c < 0x20 ) {
+				char buf[8];
+				snprintf( buf, sizeof( buf ), "\\u%04x", c );
+				out += buf;
+			} else {
+				out += c;
+			}
+		}
+		return out + "\"";
+	}
+	
+	string JsonArgs( const vector< EventArg > & args ) {
+		string out = "[";
+		for( int i = 0; i < (int)args.size(); i++ ) {
+			char buf[64];
+			if( i ) {
+				out += ", ";
+			}
+			switch( args[ i ].tag ) {
+				case 's': out += JsonString( args[ i ].s ); break;
+				case 'd': snprintf( buf, sizeof( buf ), "%.17g", args[ i ].d ); out += buf; break;
+				default: snprintf( buf, sizeof( buf ), "%lld", (long long)args[ i ].i ); out += buf; break;
+			}
+		}
+		return out + "]";
+	}
+	
+}
+
+int main( int argc, char **argv ) {
+	bool json = false;
+	const char * filename = NULL;
+	for( int i = 1; i < argc; i++ ) {
+		if( strcmp( argv[ i ], "-json" ) == 0 ) {
+			json = true;
+		} else {
+			filename = argv[ i ];
+		}
+	}
+	if( filename == NULL ) {
+		fprintf( stderr, "usage: %s [-json] <eventlog>\n", argv[ 0 ] );
+		return 1;
+	}
+	FILE * fp = fopen( filename, "rb" );
+	if( fp == NULL ) {
+		fprintf( stderr, "unable to open %s\n", filename );
+		return 1;
+	}
+	char magic[4];
+	uint version = 0;
+	if( fread( magic, 4, 1, fp ) != 1 || memcmp( magic, R3_EVENTLOG_MAGIC, 4 ) || ReadValue( fp, version ) == false || version != R3_EVENTLOG_VERSION ) {
+		fprintf( stderr, "%s is not a version %d r3 event log\n", filename, R3_EVENTLOG_VERSION );
+		return 1;
+	}
+	
+	map< ushort, string > formats;
+	uint64 t0 = 0;
+	bool first = true;
+	if( json ) {
+		printf( "[\n" );
+	}
+	uchar kind;
+	bool ok = true;
+	while( ok && ReadValue( fp, kind ) ) {
+		if( kind == EventChunk_Format ) {
+			ushort id, len;
+			ok = ReadValue( fp, id ) && ReadValue( fp, len );
+			string fmt( len, ' ' );
+			ok = ok && ( len == 0 || fread( &fmt[0], len, 1, fp ) == 1 );
+			formats[ id ] = fmt;
+		} else if( kind == EventChunk_Event ) {
+			ushort id;
+			uint64 t;
+			uchar size;
+			uchar data[256];
+			ok = ReadValue( fp, id ) && ReadValue( fp, t ) && ReadValue( fp, size );
+			ok = ok && ( size == 0 || fread( data, size, 1, fp ) == 1 );
+			vector< EventArg > args;
+			ok = ok && DecodeArgs( data, size, args );
+			if( ok == false ) {
+				break;
+			}
+			if( t0 == 0 ) {
+				t0 = t;
+			}
+			// threads commit out of order, so a stamp may precede t0
+			double secs = double( int64( t - t0 ) ) / 1e9;
+			string text = Render( formats[ id ], args );
+			if( json ) {
+				printf( "%s  { \"t\": %.9f, \"id\": %d, \"fmt\": %s, \"args\": %s, \"text\": %s }", first ? "" : ",\n", secs, id, JsonString( formats[ id ] ).c_str(), JsonArgs( args ).c_str(), JsonString( text ).c_str() );
+			} else {
+				printf( "%14.6f  %s\n", secs, text.c_str() );
+			}
+			first = false;
+		} else if( kind == EventChunk_Dropped ) {
+			uint count;
+			ok = ReadValue( fp, count );
+			if( json ) {
+				printf( "%s  { \"dropped\": %u }", first ? "" : ",\n", count );
+			} else {
+				printf( "%14s  -- dropped %u events --\n", "", count );
+			}
+			first = false;
+		} else {
+			ok = false;
+		}
+	}
+	if( json ) {
+		printf( "\n]\n" );
+	}
+	if( ok == false ) {
+		fprintf( stderr, "%s: truncated or corrupt chunk\n", filename );
+	}
+	fclose( fp );
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,157 @@
+/*
+ *  atomic
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#ifndef __R3_ATOMIC_H__
+#define __R3_ATOMIC_H__
+
+#include "r3/common.h"
+
+#if _WIN32
+# ifndef WIN32_LEAN_AND_MEAN
+#  define WIN32_LEAN_AND_MEAN 1
+# endif
+# include <windows.h>
+#endif
+
+// Loads are acquire and stores are release.  Where the compiler has the
+// __atomic builtins we use them, since they are what ThreadSanitizer
+// understands; otherwise we fall back to volatile access plus a full barrier.
+
+namespace r3 {
+
+#if _WIN32
+	inline void AtomicBarrier() {
+		MemoryBarrier();
+	}
+	inline int AtomicAdd( volatile int * v, int incr ) {
+		return InterlockedExchangeAdd( (volatile LONG *)v, incr ) + incr;
+	}
+	inline uint AtomicAdd( volatile uint * v, uint incr ) {
+		return InterlockedExchangeAdd( (volatile LONG *)v, incr ) + incr;
+	}
+	inline int64 AtomicAdd( volatile int64 * v, int64 incr ) {
+		return InterlockedExchangeAdd64( (volatile LONGLONG *)v, incr ) + incr;
+	}
+	inline bool AtomicCompareAndSwap( volatile int * v, int oldVal, int newVal ) {
+		return InterlockedCompareExchange( (volatile LONG *)v, newVal, oldVal ) == oldVal;
+	}
+	inline bool AtomicCompareAndSwap( volatile uint * v, uint oldVal, uint newVal ) {
+		return InterlockedCompareExchange( (volatile LONG *)v, newVal, oldVal ) == (LONG)oldVal;
+	}
+	inline bool AtomicCompareAndSwap( volatile int64 * v, int64 oldVal, int64 newVal ) {
+		return InterlockedCompareExchange64( (volatile LONGLONG *)v, newVal, oldVal ) == oldVal;
+	}
+	template <typename T> inline T AtomicLoad( const volatile T * v ) {
+		T r = *v;
+		MemoryBarrier();
+		return r;
+	}
+	template <typename T> inline void AtomicStore( volatile T * v, T val ) {
+		MemoryBarrier();
+		*v = val;
+	}
+#else
+	inline void AtomicBarrier() {
+		__sync_synchronize();
+	}
+	template <typename T> inline T AtomicAdd( volatile T * v, T incr ) {
+		return __sync_add_and_fetch( v, incr );
+	}
+	template <typename T> inline bool AtomicCompareAndSwap( volatile T * v, T oldVal, T newVal ) {
+		return __sync_bool_compare_and_swap( v, oldVal, newVal );
+	}
+# if defined( __ATOMIC_ACQUIRE )
+	template <typename T> inline T AtomicLoad( const volatile T * v ) {
+		return __atomic_load_n( v, __ATOMIC_ACQUIRE );
+	}
+	template <typename T> inline void AtomicStore( volatile T * v, T val ) {
+		__atomic_store_n( v, val, __ATOMIC_RELEASE );
+	}
+# else
+	template <typename T> inline T AtomicLoad( const volatile T * v ) {
+		T r = *v;
+		__sync_synchronize();
+		return r;
+	}
+	template <typename T> inline void AtomicStore( volatile T * v, T val ) {
+		__sync_synchronize();
+		*v = val;
+	}
+# endif
+#endif
+	
+	// Integer wrapper, mostly so that the intent is obvious at the declaration.
+	template <typename T>
+	class Atomic {
+		volatile T val;
+		// disallow copying and assignment
+		Atomic( const Atomic & rhs ) {}
+		const Atomic & operator= ( const Atomic & rhs ) {
+			return *this;
+		}
+	public:
+		Atomic( T v = 0 ) : val( v ) {}
+		T Get() const {
+			return AtomicLoad( &val );
+		}
+		void Set( T v ) {
+			AtomicStore( &val, v );
+		}
+		// returns the new value
+		T Add( T incr ) {
+			return AtomicAdd( &val, incr );
+		}
+		T Incr() {
+			return AtomicAdd( &val, T( 1 ) );
+		}
+		T Decr() {
+			return AtomicAdd( &val, T( -1 ) );
+		}
+		bool CompareAndSwap( T oldVal, T newVal ) {
+			return AtomicCompareAndSwap( &val, oldVal, newVal );
+		}
+	};
+	
+}
+
+#endif // __R3_ATOMIC_H__
@@ -0,0 +1,113 @@
+/*
+ *  batch
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#ifndef __R3_BATCH_H__
+#define __R3_BATCH_H__
+
+#include "r3/common.h"
+#include "r3/linear.h"
+
+// Structure of arrays kernels for transforming and culling many points
+// at once, four at a time where there is SIMD, and optionally spread
+// over up to MaxBatchThreads threads.  Each matches the Matrix4f call
+// it stands in for exactly, point for point.
+
+namespace r3 {
+	
+	const int MaxBatchThreads = 16;
+	
+	// n vectors as separate x, y and z arrays.  Sources are only read.
+	struct Vec3Array {
+		Vec3Array() : x( NULL ), y( NULL ), z( NULL ) {}
+		Vec3Array( float * ax, float * ay, float * az ) : x( ax ), y( ay ), z( az ) {}
+		float * x;
+		float * y;
+		float * z;
+	};
+	
+	struct Vec4Array {
+		Vec4Array() : x( NULL ), y( NULL ), z( NULL ), w( NULL ) {}
+		Vec4Array( float * ax, float * ay, float * az, float * aw ) : x( ax ), y( ay ), z( az ), w( aw ) {}
+		float * x;
+		float * y;
+		float * z;
+		float * w;
+	};
+	
+	struct Bounds3Array {
+		Vec3Array bmin;
+		Vec3Array bmax;
+	};
+	
+	// Which clip space planes a point is outside of, 0 when inside.  A
+	// group of points whose outcodes AND to nonzero is all outside.
+	enum OutcodeEnum {
+		Outcode_Left   = 0x01,
+		Outcode_Right  = 0x02,
+		Outcode_Bottom = 0x04,
+		Outcode_Top    = 0x08,
+		Outcode_Near   = 0x10,
+		Outcode_Far    = 0x20
+	};
+	
+	// dst = m * src divided by w, as Matrix4f::MultMatrixVec does.  dst
+	// may be src.
+	void TransformPoints( const Matrix4f & m, const Vec3Array & src, const Vec3Array & dst, int n, int threads = 1 );
+	
+	// dst = m * src without translation, as Matrix4f::MultMatrixDir does.
+	void TransformDirections( const Matrix4f & m, const Vec3Array & src, const Vec3Array & dst, int n, int threads = 1 );
+	
+	// clip = m * ( src, 1 ), with m usually projection * modelview.
+	void ProjectPoints( const Matrix4f & m, const Vec3Array & src, const Vec4Array & clip, int n, int threads = 1 );
+	
+	// OutcodeEnum bits of each point against the view volume of m, -w to
+	// w on every axis of clip space.  Returns how many are inside.
+	int FrustumOutcodes( const Matrix4f & m, const Vec3Array & src, uchar * outcodes, int n, int threads = 1 );
+	
+	// Bounds around each box after an affine m, by Arvo's method.  For a
+	// projection, take outcodes of the corners instead.  dst may be src.
+	void TransformBounds( const Matrix4f & m, const Bounds3Array & src, const Bounds3Array & dst, int n, int threads = 1 );
+	
+}
+
+#endif // __R3_BATCH_H__
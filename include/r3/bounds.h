@@ -163,6 +163,35 @@ namespace r3 {
 		return r;
 	}
 	
+	struct Bounds3f {
+		Bounds3f() { Clear(); }
+		Bounds3f( const Vec3f &pmin, const Vec3f &pmax ) : bmin( pmin ), bmax( pmax ) {}
+		
+		Vec3f & Min() { return bmin; }
+		Vec3f & Max() { return bmax; }
+		const Vec3f & Min() const { return bmin; }
+		const Vec3f & Max() const { return bmax; }
+		
+		void Clear() { bmin = Vec3f( 1e20f, 1e20f, 1e20f );  bmax = Vec3f( -1e20f, -1e20f, -1e20f ); }
+		bool IsClear() const { return bmin.x > bmax.x || bmin.y > bmax.y || bmin.z > bmax.z; }
+		
+		void Add( const Vec3f & v ) {
+			if ( IsClear() ) {
+				bmin = bmax = v;
+				return;
+			}
+			bmin.x = v.x < bmin.x ? v.x : bmin.x;
+			bmin.y = v.y < bmin.y ? v.y : bmin.y;
+			bmin.z = v.z < bmin.z ? v.z : bmin.z;
+			bmax.x = v.x > bmax.x ? v.x : bmax.x;
+			bmax.y = v.y > bmax.y ? v.y : bmax.y;
+			bmax.z = v.z > bmax.z ? v.z : bmax.z;
+		}
+		
+		Vec3f bmin;
+		Vec3f bmax;
+	};
+	
 	struct OrientedBounds2f {
 		OrientedBounds2f() : empty( true ) {}
 		bool empty;
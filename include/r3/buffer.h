@@ -45,25 +45,43 @@
 #ifndef __R3_BUFFER_H__
 #define __R3_BUFFER_H__
 
+#include "r3/memory.h"
+
+#include <deque>
 #include <string>
 #include <vector>
 #include <GL/Regal.h>
 
 namespace r3 {
 	
+	extern MemoryTag mem_buffer;
+	
 	void InitBuffer();
     void ShutdownBuffer();
 
     void AllocBuffer();
     void DeallocBuffer();
+    
+    // Called once a frame by r3::EndFrame.  Fences what the frame wrote to
+    // stream buffers, so the space can be reused once the GPU is done.
+    void EndBufferFrame();
 		
     class Buffer;
     
     class BufferAllocListener {
     public:
+        virtual ~BufferAllocListener() {}
         virtual void OnBufferAlloc( Buffer * buf ) = 0;
     };
     
+    // What a buffer keeps on the CPU side to restore its contents when the
+    // GL objects are reallocated.
+    enum BufferShadowEnum {
+        BufferShadow_Keep, // a full copy, the default
+        BufferShadow_Drop, // nothing, the alloc listener refills the buffer
+        BufferShadow_File  // nothing, the contents are reread from a file
+    };
+    
 	class Buffer {
 	protected:
 		std::string name; 
@@ -71,25 +89,42 @@ namespace r3 {
 		unsigned int target;
 		unsigned int obj;
         BufferAllocListener *allocListener;
-        std::vector<unsigned char> cache;
+        BufferShadowEnum shadow;
+        std::string shadowFile;
+        int shadowFileOffset;
+        std::vector< unsigned char, TrackedAllocator< unsigned char, mem_buffer > > cache;
+        // (begin, end) byte ranges of the copy not yet uploaded, sorted
+        std::vector< std::pair< int, int > > dirty;
 		Buffer( const std::string & bufName, int bufTarget );
+		void MarkDirty( int begin, int end );
+		void UploadDirty();
 	public:
-		~Buffer();
+		virtual ~Buffer();
         
 		const std::string & Name() {
 			return name;
 		}
 		
-		void Bind() const;
+		// Uploads pending SetSubdata changes first.
+		void Bind();
 		void Unbind() const;
 
 		int GetSize() const { return size; }
 
 		void SetData( int size, const void * data );
+		// With a shadow copy, the upload waits for the next Bind, so
+		// several updates between draws go up as a few merged ranges.
 		void SetSubdata( int offset, int size, const void * data );
 		
+		// Only for buffers that keep their shadow copy.
 		void GetData( void * data );
 		void GetSubData( int offset, int size, void * data );
+		
+		BufferShadowEnum GetShadow() const { return shadow; }
+		// Changing to Drop frees the copy now.
+		void SetShadow( BufferShadowEnum s );
+		// The contents are the size bytes at offset in filename.
+		void SetShadowFile( const std::string & filename, int offset );
         
         virtual void Alloc();
         virtual void Dealloc();
@@ -122,6 +157,66 @@ namespace r3 {
 		IndexBuffer( const std::string & ibName );
 	};
 	
+	// A ring of GL buffer memory for geometry that changes every frame.
+	// Writes go to aligned ranges after the last one, without a CPU copy,
+	// and space comes back once the fence of the frame that wrote it has
+	// passed.  A frame that outgrows the ring orphans the GL buffer.
+	class StreamBuffer : public Buffer {
+		int head;       // where the next write goes
+		int used;       // bytes written and not yet known to be consumed
+		int frameBytes; // this frame's share of used
+		std::deque< std::pair< GLsync, int > > fences; // older frames' fences and bytes
+		void WaitOldest();
+	public:
+		StreamBuffer( const std::string & sbName, int sbTarget, int sbSize );
+		~StreamBuffer();
+		
+		// Copies size bytes into the ring, returns their offset in the buffer.
+		int Write( const void * data, int size, int align );
+		void EndFrame();
+		
+		virtual void Alloc();
+		virtual void Dealloc();
+	};
+	
+	// A piece of an arena block.
+	struct BufferRange {
+		BufferRange() : buffer( NULL ), offset( 0 ), size( 0 ) {}
+		Buffer * buffer;
+		int offset;
+		int size;
+	};
+	
+	// Packs static geometry from many owners into a few large buffers, so
+	// drawing one after another rarely rebinds.  Offsets are multiples of
+	// the requested alignment, which for vertices should be the stride.
+	// Blocks keep no CPU copy.  When a block's GL buffer is reallocated,
+	// the listener given for each range in it is called with the block, and
+	// must write its range again.
+	class BufferArena : public BufferAllocListener {
+		struct Block {
+			Buffer * buffer;
+			std::vector< std::pair< int, int > > freeRanges; // (offset, size), sorted
+			std::vector< std::pair< int, BufferAllocListener * > > refills; // (offset, listener) of live ranges
+		};
+		std::string name;
+		int target;
+		int blockSize;
+		std::vector< Block > blocks;
+		bool Carve( Block & b, int size, int align, BufferRange & r );
+	public:
+		BufferArena( const std::string & arenaName, int arenaTarget, int arenaBlockSize );
+		~BufferArena();
+		
+		BufferRange Alloc( int size, int align, const void * data, BufferAllocListener * refill = NULL );
+		void Free( const BufferRange & r );
+		
+		virtual void OnBufferAlloc( Buffer * buf );
+	};
+	
+	BufferArena & GetVertexArena();
+	BufferArena & GetIndexArena();
+	
 }
 
 #endif // __R3_BUFFER_H__
\ No newline at end of file
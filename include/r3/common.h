@@ -53,6 +53,11 @@
 #define R3_HAS_GL 1
 #endif
 
+// GL calls go to the null backend in r3/nullgl.h instead of a driver.
+#ifndef R3_NULL_GL
+#define R3_NULL_GL 0
+#endif
+
 #ifndef R3_HAS_CONSOLE
 #define R3_HAS_CONSOLE R3_HAS_GL
 #endif
@@ -46,6 +46,7 @@
 
 #include "r3/buffer.h"
 #include "r3/linear.h"
+#include "r3/varying.h"
 #include <GL/Regal.h>
 
 #include <vector>
@@ -55,17 +56,6 @@ namespace r3 {
 	void InitDraw();
     void ShutdownDraw();
 	
-#define R3_NUM_VARYINGS 5
-	
-	enum VaryingEnum {
-		Varying_Nothing      = 0x00,
-		Varying_PositionBit  = 0x01,
-		Varying_ColorBit     = 0x02,
-		Varying_NormalBit    = 0x04,
-		Varying_TexCoord0Bit = 0x08,
-		Varying_TexCoord1Bit = 0x10
-	};
-	
     int GetDepthBits();
 	int GetVertexSize( int varying );
 	
@@ -73,6 +63,15 @@ namespace r3 {
 	void TexEnvCombineAlpha( int index );
     void TexEnvCombineAlphaModulate( int index );
 
+	// Quads are batched.  These functions append to a CPU vertex array
+	// that is drawn with the shared quad indexes when a r3/glstate.h call
+	// changes GL state, or at FlushQuads.  Flush before touching GL state
+	// some other way (immediate mode, raw GL calls); r3::EndFrame flushes
+	// before the swap.  Each quad takes its color from StateColor when it
+	// is queued, not from glColor when it is drawn, so set quad colors
+	// with StateColor.  Like glColor, the color lasts until it is set again.
+	void FlushQuads();
+
     void DrawQuad( float x0, float y0, float x1, float y1 );
 	void ImTexturedQuad( float x0, float y0, float x1, float y1, float s0, float t0, float s1, float t1 );
 	void DrawTexturedQuad( float x0, float y0, float x1, float y1, float s0, float t0, float s1, float t1 );
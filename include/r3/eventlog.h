@@ -0,0 +1,188 @@
+/*
+ *  eventlog
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#ifndef __R3_EVENTLOG_H__
+#define __R3_EVENTLOG_H__
+
+#include "r3/common.h"
+#include "r3/var.h"
+
+#include <string.h>
+
+/*
+ Binary event log, for high volume events that would be too expensive as
+ formatted text.  An event is a registered format string id, a monotonic
+ timestamp and the raw arguments.  Formatting happens offline, in
+ eventdump.
+
+ File layout (native byte order):
+   "R3EV", uint version
+   then a sequence of chunks, each starting with a uchar kind:
+   EventChunk_Format:  ushort id, ushort len, len chars (no terminator)
+   EventChunk_Event:   ushort id, uint64 nanoseconds, uchar size, size bytes of args
+   EventChunk_Dropped: uint count
+ Each argument is a uchar tag followed by its value:
+   'i' int, 'u' uint, 'l' int64, 'd' double, 's' uchar len + len chars
+*/
+
+#define R3_EVENTLOG_MAGIC "R3EV"
+#define R3_EVENTLOG_VERSION 1
+// Space for encoded arguments in a single event, strings are truncated to fit.
+#define R3_EVENT_MAX_ARG_BYTES 112
+
+namespace r3 {
+	
+	enum EventChunkEnum {
+		EventChunk_Format = 1,
+		EventChunk_Event = 2,
+		EventChunk_Dropped = 3
+	};
+	
+	extern VarBool ev_enable;
+	
+	void InitEventLog();
+	// Writes what is buffered and closes ev_file, events committed after
+	// this are ignored.
+	void ShutdownEventLog();
+	void FlushEventLog();
+	
+	// Define these at namespace scope, registration is not thread safe.
+	class EventFormat {
+		ushort id;
+	public:
+		EventFormat( const char * fmt );
+		ushort Id() const {
+			return id;
+		}
+	};
+	
+	// Fixed size so that encoding never allocates.
+	struct EventRecord {
+		uint64 time;
+		ushort id;
+		uchar size;
+		uchar args[ R3_EVENT_MAX_ARG_BYTES ];
+		
+		EventRecord() : time( 0 ), id( 0 ), size( 0 ) {}
+		EventRecord( const EventFormat & fmt );
+		
+		void PutRaw( uchar tag, const void * val, int bytes ) {
+			if( size + 1 + bytes > R3_EVENT_MAX_ARG_BYTES ) {
+				return;
+			}
+			args[ size++ ] = tag;
+			memcpy( args + size, val, bytes );
+			size += bytes;
+		}
+		void Put( int v ) { PutRaw( 'i', &v, sizeof( v ) ); }
+		void Put( uint v ) { PutRaw( 'u', &v, sizeof( v ) ); }
+		void Put( int64 v ) { PutRaw( 'l', &v, sizeof( v ) ); }
+		void Put( bool v ) { Put( int( v ) ); }
+		void Put( float v ) { Put( double( v ) ); }
+		void Put( double v ) { PutRaw( 'd', &v, sizeof( v ) ); }
+		void Put( const char * v ) {
+			int len = (int)strlen( v );
+			int room = R3_EVENT_MAX_ARG_BYTES - size - 2;
+			if( room < 0 ) {
+				return;
+			}
+			len = len < room ? len : room;
+			len = len < 255 ? len : 255;
+			args[ size++ ] = 's';
+			args[ size++ ] = uchar( len );
+			memcpy( args + size, v, len );
+			size += len;
+		}
+		void Put( const std::string & v ) { Put( v.c_str() ); }
+		
+		void Commit();
+	};
+	
+	inline void LogEvent( const EventFormat & fmt ) {
+		if( ev_enable.GetVal() ) {
+			EventRecord r( fmt );
+			r.Commit();
+		}
+	}
+	template <typename A0>
+	inline void LogEvent( const EventFormat & fmt, const A0 & a0 ) {
+		if( ev_enable.GetVal() ) {
+			EventRecord r( fmt );
+			r.Put( a0 );
+			r.Commit();
+		}
+	}
+	template <typename A0, typename A1>
+	inline void LogEvent( const EventFormat & fmt, const A0 & a0, const A1 & a1 ) {
+		if( ev_enable.GetVal() ) {
+			EventRecord r( fmt );
+			r.Put( a0 );
+			r.Put( a1 );
+			r.Commit();
+		}
+	}
+	template <typename A0, typename A1, typename A2>
+	inline void LogEvent( const EventFormat & fmt, const A0 & a0, const A1 & a1, const A2 & a2 ) {
+		if( ev_enable.GetVal() ) {
+			EventRecord r( fmt );
+			r.Put( a0 );
+			r.Put( a1 );
+			r.Put( a2 );
+			r.Commit();
+		}
+	}
+	template <typename A0, typename A1, typename A2, typename A3>
+	inline void LogEvent( const EventFormat & fmt, const A0 & a0, const A1 & a1, const A2 & a2, const A3 & a3 ) {
+		if( ev_enable.GetVal() ) {
+			EventRecord r( fmt );
+			r.Put( a0 );
+			r.Put( a1 );
+			r.Put( a2 );
+			r.Put( a3 );
+			r.Commit();
+		}
+	}
+	
+}
+
+#endif // __R3_EVENTLOG_H__
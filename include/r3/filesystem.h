@@ -85,6 +85,30 @@ namespace r3 {
 	
 	bool FileReadToMemory( const std::string & filename, std::vector< uchar > & data );
 	
+	// A whole file as read only memory, mapped where the platform can.
+	class MappedFile {
+	public:
+		virtual ~MappedFile() {}
+		virtual const uchar * Data() = 0;
+		virtual int Size() = 0;
+	};
+	
+	// Looks in the cache and then the base path like FileOpenForRead, but
+	// never queues a net fetch.
+	MappedFile * FileMapForRead( const std::string & filename );
+	
+	// Hex md5 of the file's contents, from the cache manifest when it has
+	// one, empty if there is no such file.  Like FileMapForRead, it never
+	// queues a net fetch.
+	std::string FileMd5( const std::string & filename );
+	
+	// A 32 character hex key that changes when the file does, for tagging
+	// things derived from it.  The manifest md5 when there is one, which is
+	// the case for files written to the cache.  Otherwise a hash of the
+	// path, size and modification time, so the file is never read.  Empty
+	// if there is no such file.
+	std::string FileVersionKey( const std::string & filename );
+	
 }
 
 #endif // __R3_FILESYSTEM_H__
\ No newline at end of file
@@ -45,7 +45,18 @@
 #ifndef __R3_GL_H__
 #define __R3_GL_H__
 
-#ifdef __APPLE__
+#if R3_NULL_GL
+// The null backend (r3/nullgl.h) stands in for the driver.  The platform
+// gl.h supplies the GL 1.1 prototypes, which nullgl.cpp defines, and every
+// newer entry point goes through the r3::gl* pointers.
+# define GL_GLEXT_LEGACY 1
+# include <GL/gl.h>
+// Mesa's gl.h defines GL_VERSION_1_2 without these two, so glext.h skips them.
+typedef void (APIENTRYP PFNGLBLENDCOLORPROC) (GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha);
+typedef void (APIENTRYP PFNGLBLENDEQUATIONPROC) (GLenum mode);
+# include "r3/GL/entry.h"
+
+#elif __APPLE__
 # include <TargetConditionals.h>
 # if TARGET_OS_IPHONE
 #  include <OpenGLES/ES1/gl.h>
@@ -76,6 +87,8 @@
 #  define GL_TEXTURE_MIN_LOD 0
 #  define GL_TEXTURE_MAX_LOD 0
 #  define GL_DEPTH_COMPONENT GL_DEPTH_COMPONENT16_OES
+// ES1 vertex arrays have no half float type.
+#  define R3_HALF_FLOAT_ATTRIBS 0
 #  define glGenerateMipmapEXT glGenerateMipmapOES
 #  define GlInternalFormat GlFormat
 
@@ -90,7 +103,7 @@
 
 #  define glOrtho glOrthof
 
-#elif __linux__
+#elif __linux__ && ! R3_NULL_GL
 
 #define GL_GLEXT_LEGACY 1
 #error "Why am I here?"
@@ -99,5 +112,8 @@
 
 #endif
 
+#ifndef R3_HALF_FLOAT_ATTRIBS
+# define R3_HALF_FLOAT_ATTRIBS 1
+#endif
 
 #endif // __R3_GL_H__
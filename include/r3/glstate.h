@@ -0,0 +1,107 @@
+/*
+ *  glstate
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#ifndef __R3_GLSTATE_H__
+#define __R3_GLSTATE_H__
+
+#include "r3/common.h"
+#include "r3/var.h"
+#include <GL/Regal.h>
+
+namespace r3 {
+	
+	// Shadow copy of the GL state r3 sets on every draw: buffer bindings,
+	// texture bindings and enables per unit, vertex arrays, tex env, blending,
+	// the current color and a few other enables.  Each
+	// State* call forwards to GL only when it changes something.  Code that
+	// touches this state behind r3's back must call InvalidateGLState.
+	
+	extern VarBool r_stateCache;
+	
+	void InitGLState();
+	void ShutdownGLState();
+	
+	// forget the shadow state, the next call for each piece of state goes to GL
+	void InvalidateGLState();
+	
+	// Called at the start of every State* call, so deferred drawing (the quad
+	// batch in draw.cpp) goes out under the state it was queued with.
+	typedef void ( *StateChangeFunc )();
+	void SetStateChangeFunc( StateChangeFunc func );
+	
+	void StateEnable( GLenum cap, bool enable );
+	void StateBlendFunc( GLenum src, GLenum dst );
+	void StateBindBuffer( GLenum target, GLuint buffer );
+	void StateBindTexture( int unit, GLenum target, GLuint texture );
+	void StateEnableTexture( int unit, GLenum target, bool enable );
+	void StateTexEnv( int unit, GLenum pname, GLint param );
+	void StateUseProgram( GLuint program );
+	
+	// Current vertex color, what glColor sets.  Batched quads take it when
+	// they are queued, so unlike the rest it does not flush them.  Drawing
+	// with GL_COLOR_ARRAY enabled leaves GL's color undefined; call
+	// StateForgetColor after such draws so the next StateColor goes to GL.
+	void StateColor( uchar r, uchar g, uchar b, uchar a );
+	const uchar * GetStateColor();
+	void StateForgetColor();
+	
+	// Loads a fixed function matrix, leaving mode as the matrix mode.  Not
+	// cached, but it flushes deferred drawing like the other State* calls.
+	void StateLoadMatrix( GLenum mode, const float * m );
+	
+	// Vertex arrays are named by AttributeArray index: 0-15 are generic
+	// attributes, then GL_VERTEX_ARRAY, GL_NORMAL_ARRAY, GL_COLOR_ARRAY and
+	// GL_TEXTURE0-3 for texture coordinates.
+	uint StateArrayBit( GLuint index );
+	// enables exactly the arrays in mask, disabling any others left enabled
+	void StateEnableArrays( uint mask );
+	void StateArrayPointer( GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid * pointer );
+	
+	// GL drops deleted objects from every binding, so must the shadow state
+	void StateForgetBuffer( GLuint buffer );
+	void StateForgetTexture( GLuint texture );
+	void StateForgetProgram( GLuint program );
+	
+}
+
+#endif // __R3_GLSTATE_H__
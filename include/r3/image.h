@@ -46,11 +46,16 @@
 #ifndef __R3_IMAGE_H__
 #define __R3_IMAGE_H__
 
+#include "r3/memory.h"
+
 #include <string.h>
 #include <string>
 
 namespace r3 {
 	
+	// CPU copies of images, mostly on their way to textures
+	extern MemoryTag mem_image;
+	
 	template< typename T >
 	class Image {
 	public:
@@ -62,14 +67,25 @@ namespace r3 {
 		ComponentType *data;
     Image() : width( 0 ), height( 0 ), components( 0 ), data( NULL ) {}
     
-    ~Image() { delete [] data; }
+    ~Image() {
+      mem_image.Free( Bytes() );
+      delete [] data;
+    }
     
-    void SetSize( int w, int h, int c ) {
+    // Fails, leaving the image empty, when mem_image refuses the bytes.
+    bool SetSize( int w, int h, int c ) {
+      mem_image.Free( Bytes() );
       delete [] data;
+      data = NULL;
+      width = height = components = 0;
+      if( mem_image.Alloc( int64( w ) * h * c * sizeof( T ) ) == false ) {
+        return false;
+      }
       data = new ComponentType[ w * h * c ];
       width = w;
       height = h;
       components = c;
+      return true;
     }
     
 		int Width() const {
@@ -83,6 +99,10 @@ namespace r3 {
 		int Components() const {
 			return components;
 		}
+		
+		int64 Bytes() const {
+			return data ? int64( width ) * height * components * sizeof( T ) : 0;
+		}
     
     int Index( int x, int y, int c ) const {
       return ( y * width + x ) * components + c;
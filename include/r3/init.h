@@ -49,6 +49,9 @@ namespace r3 {
 	
 	void Init( int argc, const char **argv );
 	void Shutdown();
+	
+	// Call once per frame, after its last draw and before the swap.
+	void EndFrame();
 
 }
 
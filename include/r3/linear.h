@@ -53,6 +53,8 @@
 #include <assert.h>
 #include <algorithm>
 
+#include "r3/simd.h"
+
 #ifdef _WIN32
 # define TEMPLATE_FUNCTION
 #else
@@ -1480,13 +1482,176 @@ namespace r3 {
 		T m[16];
 	};
 	
+#if R3_SIMD
+	// Matrix4f on four wide vectors, a column at a time.  Sums go in the
+	// same order as the generic code, so products, transposes and vector
+	// transforms match it exactly.  Inverse uses cofactors rather than
+	// elimination, so it only matches to rounding.
+	
+	// the columns a0 to a3 times the column c
+	inline Float4 MultColumn4f( Float4 a0, Float4 a1, Float4 a2, Float4 a3, Float4 c ) {
+		Float4 r = Mul4( a0, Lane4<0>( c ) );
+		r = Add4( r, Mul4( a1, Lane4<1>( c ) ) );
+		r = Add4( r, Mul4( a2, Lane4<2>( c ) ) );
+		return Add4( r, Mul4( a3, Lane4<3>( c ) ) );
+	}
+	
+	// r = a * b, with r free to be either
+	inline void MultMatrix4f( const float * a, const float * b, float * r ) {
+		Float4 a0 = Load4( a ), a1 = Load4( a + 4 ), a2 = Load4( a + 8 ), a3 = Load4( a + 12 );
+#if R3_SIMD_AVX
+		__m256 b01 = _mm256_loadu_ps( b ), b23 = _mm256_loadu_ps( b + 8 );
+		__m256 c0 = _mm256_set_m128( a0, a0 ), c1 = _mm256_set_m128( a1, a1 );
+		__m256 c2 = _mm256_set_m128( a2, a2 ), c3 = _mm256_set_m128( a3, a3 );
+		__m256 r01 = _mm256_mul_ps( c0, _mm256_permute_ps( b01, 0x00 ) );
+		__m256 r23 = _mm256_mul_ps( c0, _mm256_permute_ps( b23, 0x00 ) );
+		r01 = _mm256_add_ps( r01, _mm256_mul_ps( c1, _mm256_permute_ps( b01, 0x55 ) ) );
+		r23 = _mm256_add_ps( r23, _mm256_mul_ps( c1, _mm256_permute_ps( b23, 0x55 ) ) );
+		r01 = _mm256_add_ps( r01, _mm256_mul_ps( c2, _mm256_permute_ps( b01, 0xaa ) ) );
+		r23 = _mm256_add_ps( r23, _mm256_mul_ps( c2, _mm256_permute_ps( b23, 0xaa ) ) );
+		r01 = _mm256_add_ps( r01, _mm256_mul_ps( c3, _mm256_permute_ps( b01, 0xff ) ) );
+		r23 = _mm256_add_ps( r23, _mm256_mul_ps( c3, _mm256_permute_ps( b23, 0xff ) ) );
+		_mm256_storeu_ps( r, r01 );
+		_mm256_storeu_ps( r + 8, r23 );
+#else
+		Float4 b0 = Load4( b ), b1 = Load4( b + 4 ), b2 = Load4( b + 8 ), b3 = Load4( b + 12 );
+		Store4( r, MultColumn4f( a0, a1, a2, a3, b0 ) );
+		Store4( r + 4, MultColumn4f( a0, a1, a2, a3, b1 ) );
+		Store4( r + 8, MultColumn4f( a0, a1, a2, a3, b2 ) );
+		Store4( r + 12, MultColumn4f( a0, a1, a2, a3, b3 ) );
+#endif
+	}
+	
+	// columns of m times x, y, z and w, in order
+	inline Float4 TransformColumns4f( const float * m, float x, float y, float z, float w ) {
+		Float4 r = Mul4( Load4( m ), Splat4( x ) );
+		r = Add4( r, Mul4( Load4( m + 4 ), Splat4( y ) ) );
+		r = Add4( r, Mul4( Load4( m + 8 ), Splat4( z ) ) );
+		return Add4( r, Mul4( Load4( m + 12 ), Splat4( w ) ) );
+	}
+	
+	// the same with rows, for vectors on the left
+	inline Float4 TransformRows4f( const float * m, float x, float y, float z, float w ) {
+		Float4 r0 = Load4( m ), r1 = Load4( m + 4 ), r2 = Load4( m + 8 ), r3 = Load4( m + 12 );
+		Transpose4( r0, r1, r2, r3 );
+		Float4 r = Mul4( r0, Splat4( x ) );
+		r = Add4( r, Mul4( r1, Splat4( y ) ) );
+		r = Add4( r, Mul4( r2, Splat4( z ) ) );
+		return Add4( r, Mul4( r3, Splat4( w ) ) );
+	}
+	
+	template <> inline Matrix4<float> & Matrix4<float>::MultRight( const Matrix4<float> & b ) {
+		MultMatrix4f( m, b.m, m );
+		return *this;
+	}
+	
+	template <> inline Matrix4<float> & Matrix4<float>::MultLeft( const Matrix4<float> & b ) {
+		MultMatrix4f( b.m, m, m );
+		return *this;
+	}
+	
+	template <> inline Matrix4<float> Matrix4<float>::Transpose() const {
+		Matrix4<float> t;
+		Float4 c0 = Load4( m ), c1 = Load4( m + 4 ), c2 = Load4( m + 8 ), c3 = Load4( m + 12 );
+		Transpose4( c0, c1, c2, c3 );
+		Store4( t.m, c0 );
+		Store4( t.m + 4, c1 );
+		Store4( t.m + 8, c2 );
+		Store4( t.m + 12, c3 );
+		return t;
+	}
+	
+	// Lengyel's, from cross products of the columns' first three rows.
+	template <> inline Matrix4<float> Matrix4<float>::Inverse() const {
+		Float4 a = Load4( m ), b = Load4( m + 4 ), c = Load4( m + 8 ), d = Load4( m + 12 );
+		Float4 x = Lane4<3>( a ), y = Lane4<3>( b ), z = Lane4<3>( c ), w = Lane4<3>( d );
+		// the last lanes of all four come out 0
+		Float4 s = Cross4( a, b );
+		Float4 t = Cross4( c, d );
+		Float4 u = Sub4( Mul4( a, y ), Mul4( b, x ) );
+		Float4 v = Sub4( Mul4( c, w ), Mul4( d, z ) );
+		Float4 det = Sum4( Add4( Mul4( s, v ), Mul4( t, u ) ) );
+		if( First4( det ) == 0.0f ) {
+			return Matrix4<float>(); // singular matrix!
+		}
+		Float4 invDet = Div4( Splat4( 1.0f ), det );
+		s = Mul4( s, invDet );
+		t = Mul4( t, invDet );
+		u = Mul4( u, invDet );
+		v = Mul4( v, invDet );
+		Float4 r0 = Add4( Cross4( b, v ), Mul4( t, y ) );
+		Float4 r1 = Sub4( Cross4( v, a ), Mul4( t, x ) );
+		Float4 r2 = Add4( Cross4( d, u ), Mul4( s, w ) );
+		Float4 r3 = Sub4( Cross4( u, c ), Mul4( s, z ) );
+		// the last column is -b.t, a.t, -d.s, c.s
+		Float4 p0 = Mul4( b, t ), p1 = Mul4( a, t ), p2 = Mul4( d, s ), p3 = Mul4( c, s );
+		Transpose4( p0, p1, p2, p3 );
+		Float4 last = Mul4( Add4( Add4( p0, p1 ), Add4( p2, p3 ) ), Set4( -1.0f, 1.0f, -1.0f, 1.0f ) );
+		// rows to columns, where the rows' zero last lanes land in the last column
+		Transpose4( r0, r1, r2, r3 );
+		Matrix4<float> inv;
+		Store4( inv.m, r0 );
+		Store4( inv.m + 4, r1 );
+		Store4( inv.m + 8, r2 );
+		Store4( inv.m + 12, last );
+		return inv;
+	}
+	
+	template <> inline void Matrix4<float>::MultMatrixVec( const Vec3<float> & src, Vec3<float> & dst ) const {
+		float r[4];
+		Float4 v = TransformColumns4f( m, src.x, src.y, src.z, 1.0f );
+		assert( First4( Lane4<3>( v ) ) != R3_ZERO );
+		Store4( r, Div4( v, Lane4<3>( v ) ) );
+		dst.x = r[0];
+		dst.y = r[1];
+		dst.z = r[2];
+	}
+	
+	template <> inline void Matrix4<float>::MultVecMatrix( const Vec3<float> & src, Vec3<float> & dst ) const {
+		float r[4];
+		Float4 v = TransformRows4f( m, src.x, src.y, src.z, 1.0f );
+		assert( First4( Lane4<3>( v ) ) != R3_ZERO );
+		Store4( r, Div4( v, Lane4<3>( v ) ) );
+		dst.x = r[0];
+		dst.y = r[1];
+		dst.z = r[2];
+	}
+	
+	template <> inline void Matrix4<float>::MultMatrixVec( const Vec4<float> & src, Vec4<float> & dst ) const {
+		Store4( dst.Ptr(), TransformColumns4f( m, src.x, src.y, src.z, src.w ) );
+	}
+	
+	template <> inline void Matrix4<float>::MultVecMatrix( const Vec4<float> & src, Vec4<float> & dst ) const {
+		Store4( dst.Ptr(), TransformRows4f( m, src.x, src.y, src.z, src.w ) );
+	}
+	
+	template <> inline void Matrix4<float>::MultMatrixDir( const Vec3<float> & src, Vec3<float> & dst ) const {
+		float r[4];
+		Float4 v = Mul4( Load4( m ), Splat4( src.x ) );
+		v = Add4( v, Mul4( Load4( m + 4 ), Splat4( src.y ) ) );
+		Store4( r, Add4( v, Mul4( Load4( m + 8 ), Splat4( src.z ) ) ) );
+		dst.x = r[0];
+		dst.y = r[1];
+		dst.z = r[2];
+	}
+	
+	template <> inline void Matrix4<float>::MultDirMatrix( const Vec3<float> & src, Vec3<float> & dst ) const {
+		float r[4];
+		Float4 r0 = Load4( m ), r1 = Load4( m + 4 ), r2 = Load4( m + 8 ), r3 = Load4( m + 12 );
+		Transpose4( r0, r1, r2, r3 );
+		Float4 v = Mul4( r0, Splat4( src.x ) );
+		v = Add4( v, Mul4( r1, Splat4( src.y ) ) );
+		Store4( r, Add4( v, Mul4( r2, Splat4( src.z ) ) ) );
+		dst.x = r[0];
+		dst.y = r[1];
+		dst.z = r[2];
+	}
+#endif
+	
 	template <typename T> inline  
 	Matrix4<T> operator * ( const Matrix4<T> & m1, const Matrix4<T> & m2 ) {
-		static Matrix4<T> product;
-		
-		product = m1;
+		Matrix4<T> product( m1 );
 		product.MultRight(m2);
-		
 		return product;
 	}
 	
@@ -0,0 +1,136 @@
+/*
+ *  memory
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#ifndef __R3_MEMORY_H__
+#define __R3_MEMORY_H__
+
+#include "r3/atomic.h"
+#include "r3/var.h"
+
+#include <new>
+#include <stddef.h>
+#include <stdlib.h>
+
+namespace r3 {
+	
+	// A MemoryTag accounts for the memory held by one subsystem.  The tag is
+	// also the var "mem_<name>", which is the subsystem's budget in kilobytes,
+	// 0 for no budget.  Going over budget logs a warning, or with
+	// mem_budgetFail set, fails the allocation instead.  Like metrics, the
+	// counters are not reset by construction, so only give tags static
+	// storage duration.
+	class MemoryTag : public VarInteger {
+		const char * tagName;
+		volatile int64 live;
+		volatile int64 peak;
+		volatile int64 allocs;
+		volatile int64 allocated;
+	public:
+		MemoryTag( const char * name, const char * desc );
+		const char * TagName() const { return tagName; }
+		int64 Live() const { return AtomicLoad( &live ); }
+		int64 Peak() const { return AtomicLoad( &peak ); }
+		int64 Allocs() const { return AtomicLoad( &allocs ); }
+		// total bytes ever allocated, for the allocation rate
+		int64 Allocated() const { return AtomicLoad( &allocated ); }
+		// Returns false without accounting anything if the allocation would
+		// exceed the budget and mem_budgetFail is set.  Callers that cannot
+		// fail may ignore the result.
+		bool Alloc( int64 bytes );
+		void Free( int64 bytes );
+	};
+	
+	// malloc and free with the size and tag kept in a small header.
+	void * TrackedMalloc( MemoryTag & tag, size_t bytes );
+	void TrackedFree( void * p );
+	
+	// Stateless STL allocator that charges a tag, throws std::bad_alloc
+	// when the tag fails an allocation.
+	template< typename T, MemoryTag & Tag >
+	class TrackedAllocator {
+	public:
+		typedef T value_type;
+		typedef T * pointer;
+		typedef const T * const_pointer;
+		typedef T & reference;
+		typedef const T & const_reference;
+		typedef size_t size_type;
+		typedef ptrdiff_t difference_type;
+		template< typename U > struct rebind { typedef TrackedAllocator< U, Tag > other; };
+		
+		TrackedAllocator() {}
+		template< typename U > TrackedAllocator( const TrackedAllocator< U, Tag > & ) {}
+		
+		pointer address( reference r ) const { return &r; }
+		const_pointer address( const_reference r ) const { return &r; }
+		size_type max_size() const { return size_type( -1 ) / sizeof( T ); }
+		
+		pointer allocate( size_type n, const void * hint = 0 ) {
+			if( n > max_size() || Tag.Alloc( int64( n * sizeof( T ) ) ) == false ) {
+				throw std::bad_alloc();
+			}
+			void * p = malloc( n * sizeof( T ) );
+			if( p == NULL ) {
+				Tag.Free( int64( n * sizeof( T ) ) );
+				throw std::bad_alloc();
+			}
+			return static_cast< pointer >( p );
+		}
+		void deallocate( pointer p, size_type n ) {
+			if( p ) {
+				Tag.Free( int64( n * sizeof( T ) ) );
+				free( p );
+			}
+		}
+		void construct( pointer p, const T & v ) { new( p ) T( v ); }
+		void destroy( pointer p ) { p->~T(); }
+	};
+	
+	template< typename T, typename U, MemoryTag & Tag >
+	bool operator==( const TrackedAllocator< T, Tag > &, const TrackedAllocator< U, Tag > & ) { return true; }
+	template< typename T, typename U, MemoryTag & Tag >
+	bool operator!=( const TrackedAllocator< T, Tag > &, const TrackedAllocator< U, Tag > & ) { return false; }
+	
+}
+
+#endif // __R3_MEMORY_H__
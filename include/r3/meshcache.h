@@ -0,0 +1,73 @@
+/*
+ *  meshcache
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#ifndef __R3_MESHCACHE_H__
+#define __R3_MESHCACHE_H__
+
+#include "r3/model.h"
+
+#include <string>
+
+// Binary copies of models in the cache directory, tagged with the
+// FileVersionKey of the file they were built from.  Loading one maps the
+// file and uploads its vertex and index ranges as they are, with nothing
+// to parse.  The data is in the byte order of the machine that wrote it.
+
+namespace r3 {
+	
+	// importOptions are the importer's own bits for how it built the model,
+	// such as which optimizations ran.  A copy made with other options is
+	// as stale as one made from another source.
+	
+	// The model's geometry must be in buffers of its own that keep their
+	// shadow copies.
+	bool WriteMeshCache( const std::string & filename, const std::string & sourceMd5, uint importOptions, Model * model );
+	
+	// NULL if the file is missing, from another version of the format, or
+	// was not built from a source with sourceMd5 with importOptions.  The
+	// model's buffers reread the file when they are reallocated.
+	Model * CreateModelFromMeshCache( const std::string & filename, const std::string & sourceMd5, uint importOptions, const std::string & modelName );
+	
+}
+
+#endif // __R3_MESHCACHE_H__
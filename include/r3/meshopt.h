@@ -0,0 +1,104 @@
+/*
+ *  meshopt
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#ifndef __R3_MESHOPT_H__
+#define __R3_MESHOPT_H__
+
+#include "r3/common.h"
+
+// Reordering of indexed triangle lists for the GPU, and a simulator to
+// measure it without one.  No GL, so importers can run it headless.
+
+namespace r3 {
+	
+	// Post-transform cache behavior of a FIFO cache of cacheSize vertexes:
+	// acmr is vertexes transformed per triangle, atvr per vertex.  Ideal
+	// values are 0.5 and 1.
+	struct VertexCacheStats {
+		VertexCacheStats() : acmr( 0 ), atvr( 0 ) {}
+		float acmr;
+		float atvr;
+	};
+	
+	VertexCacheStats SimulateVertexCache( const uint * indexes, int numIndexes, int numVertexes, int cacheSize );
+	
+	// Reorders triangles so they reuse recently transformed vertexes, with
+	// Forsyth's linear speed greedy algorithm.
+	void OptimizeVertexCache( uint * indexes, int numIndexes, int numVertexes );
+	
+	// Splits vertex cache ordered triangles into clusters and sorts those
+	// so outward facing ones on the outside of the mesh draw first, which
+	// cuts overdraw from most directions.  threshold bounds how much worse
+	// a cluster's acmr may get for being split off, 1.05 is typical.
+	// positions are 3 floats, stride bytes apart.  Returns the number of
+	// clusters.
+	int OptimizeOverdraw( uint * indexes, int numIndexes, const float * positions, int stride, int numVertexes, int cacheSize, float threshold );
+	
+	// Collapses edges in order of quadric error until at most
+	// targetIndexes remain or no collapse is left, and returns the new
+	// index count.  Vertexes only ever move onto neighbours, so the vertex
+	// data is shared with the original.  Vertexes sharing a position with
+	// another, the attribute seams, stay put, and open borders only
+	// collapse along themselves.  No collapse makes an edge non-manifold
+	// or turns a triangle over.  The largest error taken on, as a
+	// distance in position units, goes in error when given.
+	int SimplifyMesh( uint * indexes, int numIndexes, const float * positions, int stride, int numVertexes, int targetIndexes, float * error = NULL );
+	
+	// One level of detail: a range of a shared index list, and how far it
+	// strays from the full model in position units.
+	struct MeshLod {
+		MeshLod() : firstIndex( 0 ), numIndexes( 0 ), error( 0 ) {}
+		MeshLod( int first, int num, float err ) : firstIndex( first ), numIndexes( num ), error( err ) {}
+		int firstIndex;
+		int numIndexes;
+		float error;
+	};
+	
+	// Renumbers vertexes in the order the indexes first use them, and moves
+	// the vertex data, stride bytes each, to match.  Unused vertexes go at
+	// the end.
+	void OptimizeVertexFetch( void * vertexes, int stride, uint * indexes, int numIndexes, int numVertexes );
+	
+}
+
+#endif // __R3_MESHOPT_H__
@@ -0,0 +1,119 @@
+/*
+ *  meshquant
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#ifndef __R3_MESHQUANT_H__
+#define __R3_MESHQUANT_H__
+
+#include "r3/common.h"
+#include "r3/linear.h"
+
+#include <vector>
+
+// Compact vertex encodings, to pack interleaved float vertexes into a
+// fraction of the bytes and get them back.  No GL, so importers can run
+// it headless.
+
+namespace r3 {
+	
+	// IEEE half floats, rounded to nearest even, with denormals,
+	// infinities and NaNs.
+	ushort FloatToHalf( float f );
+	float HalfToFloat( ushort h );
+	
+	// Unit vectors folded onto an octahedron, as two signed normalized
+	// bytes, good to about a degree.  Decoding gives a unit vector.
+	void EncodeOctahedral( const float * n, signed char * oct );
+	void DecodeOctahedral( const signed char * oct, float * n );
+	
+	enum QuantizeTexCoordEnum {
+		QuantizeTexCoord_Half,
+		QuantizeTexCoord_Unorm16
+	};
+	
+	// Where each attribute of a quantized vertex lives, -1 for absent.
+	// Positions are 3 unorm16s and normals 2 octahedral snorm8s, packed
+	// into 8 bytes, then texcoords as 2 halfs or unorm16s.
+	struct QuantizedLayout {
+		QuantizedLayout() : stride( 0 ), positionOffset( -1 ), normalOffset( -1 ), texCoordOffset( -1 ), texCoords( QuantizeTexCoord_Half ) {}
+		int stride;
+		int positionOffset;
+		int normalOffset;
+		int texCoordOffset;
+		QuantizeTexCoordEnum texCoords;
+	};
+	
+	// The layout for vertexes with position, normal and texcoord 0 as the
+	// varying bits say, the way the OBJ importer orders them.
+	QuantizedLayout GetQuantizedLayout( int varying, QuantizeTexCoordEnum texCoords );
+	
+	// What turns normalized quantized values back into the originals:
+	// value = scale * normalized + offset.  Identity for values that were
+	// not scaled.
+	struct Dequantize {
+		Dequantize() : positionScale( 1, 1, 1 ), texCoordScale( 1, 1 ) {}
+		Vec3f positionScale;
+		Vec3f positionOffset;
+		Vec2f texCoordScale;
+		Vec2f texCoordOffset;
+		// Goes before the model matrix, for drawing quantized positions.
+		Matrix4f GetPositionMatrix() const {
+			return Matrix4f::Translate( positionOffset ) * Matrix4f::Scale( positionScale );
+		}
+		// Goes before the texture matrix, for unorm16 texcoords.
+		Matrix4f GetTexCoordMatrix() const {
+			return Matrix4f::Translate( Vec3f( texCoordOffset.x, texCoordOffset.y, 0 ) ) * Matrix4f::Scale( Vec3f( texCoordScale.x, texCoordScale.y, 1 ) );
+		}
+	};
+	
+	// Packs numVertexes interleaved float vertexes, laid out as varying
+	// says, into dst in layout's format, scaling positions, and unorm16
+	// texcoords, to their bounds.  The scaling goes in dequantize.
+	void QuantizeVertexes( const float * src, int varying, int numVertexes, const QuantizedLayout & layout, std::vector< uchar > & dst, Dequantize & dequantize );
+	
+	// The software path back: unpacks quantized vertexes into interleaved
+	// floats laid out as varying says.
+	void DequantizeVertexes( const uchar * src, int varying, int numVertexes, const QuantizedLayout & layout, const Dequantize & dequantize, float * dst );
+	
+}
+
+#endif // __R3_MESHQUANT_H__
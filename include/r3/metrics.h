@@ -0,0 +1,120 @@
+/*
+ *  metrics
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#ifndef __R3_METRICS_H__
+#define __R3_METRICS_H__
+
+#include "r3/atomic.h"
+#include "r3/time.h"
+#include "r3/var.h"
+
+// Number of histogram buckets, bucket i counts samples below 2^i microseconds.
+#define R3_METRIC_HISTOGRAM_BUCKETS 28
+
+namespace r3 {
+	
+	// Metrics are read-only vars, so listvars and get show them, and the
+	// metrics command shows them with deltas.  Values are updated with
+	// atomics and are not reset by construction, so a metric may be bumped
+	// during static initialization before its constructor has run.  Only
+	// give them static storage duration.
+	class Metric : public Var {
+	public:
+		Metric( const char * metricName, const char * metricDesc );
+		virtual void Set( const char * str ) {}
+		// single number used for the deltas in the metrics command
+		virtual double Value() const = 0;
+	};
+	
+	class MetricCounter : public Metric {
+		volatile int64 val;
+	public:
+		MetricCounter( const char * metricName, const char * metricDesc ) : Metric( metricName, metricDesc ) {}
+		virtual std::string Get() const;
+		virtual double Value() const { return double( GetVal() ); }
+		int64 GetVal() const { return AtomicLoad( &val ); }
+		void Add( int64 v ) { AtomicAdd( &val, v ); }
+		void Incr() { AtomicAdd( &val, int64( 1 ) ); }
+	};
+	
+	class MetricGauge : public Metric {
+		volatile int64 val;
+	public:
+		MetricGauge( const char * metricName, const char * metricDesc ) : Metric( metricName, metricDesc ) {}
+		virtual std::string Get() const;
+		virtual double Value() const { return double( GetVal() ); }
+		int64 GetVal() const { return AtomicLoad( &val ); }
+		void SetVal( int64 v ) { AtomicStore( &val, v ); }
+		void Add( int64 v ) { AtomicAdd( &val, v ); }
+		void Incr() { AtomicAdd( &val, int64( 1 ) ); }
+		void Decr() { AtomicAdd( &val, int64( -1 ) ); }
+	};
+	
+	// Latency histogram with power of two microsecond buckets.
+	class MetricHistogram : public Metric {
+		volatile uint buckets[ R3_METRIC_HISTOGRAM_BUCKETS ];
+		volatile int64 count;
+		volatile int64 sumNs;
+		volatile int64 maxNs;
+	public:
+		MetricHistogram( const char * metricName, const char * metricDesc ) : Metric( metricName, metricDesc ) {}
+		virtual std::string Get() const;
+		virtual double Value() const { return double( AtomicLoad( &count ) ); }
+		void Record( uint64 nanoseconds );
+		// upper bound in milliseconds of the bucket holding fraction p of the samples
+		double Percentile( double p ) const;
+	};
+	
+	class ScopedMetricTimer {
+		MetricHistogram & hist;
+		uint64 begin;
+	public:
+		ScopedMetricTimer( MetricHistogram & h ) : hist( h ), begin( GetMonotonicNanoseconds() ) {}
+		~ScopedMetricTimer() {
+			hist.Record( GetMonotonicNanoseconds() - begin );
+		}
+	};
+	
+}
+
+#endif // __R3_METRICS_H__
@@ -43,10 +43,14 @@
 #ifndef __R3_MODEL_H__
 #define __R3_MODEL_H__
 
+#include "r3/bounds.h"
 #include "r3/buffer.h"
 #include "r3/draw.h"
 #include "r3/linear.h"
+#include "r3/meshopt.h"
+#include "r3/meshquant.h"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -54,6 +58,16 @@ namespace r3 {
 	
 	void InitModel();
 	void ShutdownModel();
+	
+	// Shared 16 bit indexes drawing quads as triangle pairs, 4 vertexes per
+	// quad, for up to MaxQuadVertexes vertexes.
+	const int MaxQuadVertexes = 65536;
+	IndexBuffer * GetQuadIndexBuffer();
+	
+	// Pixels the sphere around bounds spans when its center is distance
+	// away, for a perspective view with a vertical field of view of fovy
+	// degrees into a viewport viewportHeight pixels tall.
+	float ProjectedSize( const Bounds3f & bounds, float distance, float fovy, float viewportHeight );
     
     struct AttributeArray {
         AttributeArray( GLuint idx, GLint sz, GLenum tp, GLboolean n, GLsizei str, const GLvoid * ptr ) 
@@ -74,9 +88,16 @@ namespace r3 {
 		std::string name;
 		VertexBuffer *vertexBuffer;
 		IndexBuffer *indexBuffer;
+		BufferRange vertexRange;
+		BufferRange indexRange;
+		GLenum indexType;
 		GLenum prim;
         int numVerts;
         std::vector<AttributeArray> attr;
+        Bounds3f bounds;
+        std::vector<MeshLod> lods;
+        int lod;
+        Dequantize dequantize;
 		// disallow copying and assignment
 		Model( const Model & rhs ) {}
 		const Model & operator= ( const Model & rhs ) {
@@ -90,6 +111,9 @@ namespace r3 {
 		}
 		VertexBuffer & GetVertexBuffer();
 		IndexBuffer & GetIndexBuffer();
+		bool HasIndexBuffer() const {
+			return indexBuffer != NULL;
+		}
 		GLenum GetPrimitive() const {
 			return prim;
 		}
@@ -97,8 +121,14 @@ namespace r3 {
 			prim = mPrim;
 		}
         GLint GetNumVertexes() {
+            if( lods.size() && ( indexBuffer || indexRange.buffer ) ) {
+                return lods[ lod ].numIndexes;
+            }
+            if( indexRange.buffer ) {
+                return indexRange.size / GetIndexSize();
+            }
             if( indexBuffer ) {
-                return indexBuffer->GetSize() / 2;                
+                return indexBuffer->GetSize() / GetIndexSize();                
             }
             return numVerts;
         }
@@ -107,6 +137,60 @@ namespace r3 {
         }
         void ClearAttributeArrays() { attr.clear(); }
         void AddAttributeArray( const AttributeArray & a ) { attr.push_back( a ); }
+        const std::vector<AttributeArray> & GetAttributeArrays() const { return attr; }
+        // object space, clear unless the loader set it
+        const Bounds3f & GetBounds() const {
+            return bounds;
+        }
+        void SetBounds( const Bounds3f & b ) {
+            bounds = b;
+        }
+        // GL_UNSIGNED_SHORT unless set otherwise, for indexes written
+        // straight to GetIndexBuffer().
+        GLenum GetIndexType() const {
+            return indexType;
+        }
+        int GetIndexSize() const {
+            return indexType == GL_UNSIGNED_INT ? 4 : 2;
+        }
+        void SetIndexType( GLenum type ) {
+            indexType = type;
+        }
+        // Scaling back from quantized attributes, for the matrices that
+        // draw them.  Identity for float attributes.
+        const Dequantize & GetDequantize() const { return dequantize; }
+        void SetDequantize( const Dequantize & dq ) {
+            dequantize = dq;
+        }
+        // Levels of detail as ranges of the index buffer, finest first.
+        // Without any, the whole buffer is the one level.
+        const std::vector<MeshLod> & GetLods() const { return lods; }
+        void SetLods( const std::vector<MeshLod> & l ) {
+            lods = l;
+            lod = 0;
+        }
+        int GetLod() const {
+            return lod;
+        }
+        // Draw uses this level from now on.
+        void SetLod( int l ) {
+            lod = std::max( 0, std::min( l, (int)lods.size() - 1 ) );
+        }
+        // The coarsest level whose error spans at most maxErrorPixels when
+        // the bounds span projectedSize pixels.
+        int SelectLod( float projectedSize, float maxErrorPixels = 1.0f ) const;
+        // Fills the index buffer with 16 bit indexes if they all fit, and
+        // 32 bit ones if not.
+        void SetIndexes( const uint * indexes, int numIndexes );
+        // Puts the geometry in the shared vertex and index arenas instead of
+        // buffers of the model's own.  Attribute array offsets stay relative
+        // to the first vertex.  Without indexes, SetNumVertexes as usual.
+        // Indexes are stored as for SetIndexes.  The arenas keep no copy, so
+        // when their GL buffers are reallocated refill is called with each
+        // block the model lives in, and should pass the same geometry to
+        // RestoreArenaGeometry.
+        void SetArenaGeometry( const void * verts, int vertBytes, int stride, const uint * indexes, int numIndexes, BufferAllocListener * refill = NULL );
+        void RestoreArenaGeometry( Buffer * block, const void * verts, const uint * indexes );
 		void Draw();        
 	};
 
@@ -43,11 +43,45 @@
 #ifndef __R3_MODELOBJ_H__
 #define __R3_MODELOBJ_H__
 
+#include "r3/common.h"
+#include "r3/meshopt.h"
+#if R3_HAS_GL
 #include "r3/model.h"
+#endif
 #include <string>
+#include <vector>
 
 namespace r3 {
+	
+	// Interleaved vertex data and triangle indices from an OBJ file, with no
+	// GL objects, so it can be built headless.
+	struct ObjMesh {
+		ObjMesh() : varying( 0 ) {}
+		int varying;
+		std::vector< float > vertices;
+		std::vector< uint > indices;
+		// ranges of indices, empty for just the one level
+		std::vector< MeshLod > lods;
+	};
+	
+	// Parses OBJ text already in memory.
+	bool ParseObj( const char * text, int size, ObjMesh & mesh );
+	bool ReadObjFile( const std::string & filename, ObjMesh & mesh );
+	
+	// Appends up to numLods - 1 simplified levels of detail to the indices,
+	// each with ratio times the triangles of the one before, built on up
+	// to threads threads.  Vertexes stay as they are and are shared.
+	void BuildObjLods( ObjMesh & mesh, int numLods, float ratio, int threads );
+	
+	// Reorders each level's triangles for the vertex cache, and with
+	// overdraw, in clusters for overdraw too, then vertexes for fetch
+	// locality.  The full level's simulated cache stats from before and
+	// after go in before and after when given.
+	void OptimizeObjMesh( ObjMesh & mesh, bool overdraw, VertexCacheStats * before = NULL, VertexCacheStats * after = NULL );
+	
+#if R3_HAS_GL
 	Model * CreateModelFromObjFile( const std::string & filename );
+#endif
 }
 
 
@@ -0,0 +1,98 @@
+/*
+ *  nullgl
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#ifndef __R3_NULLGL_H__
+#define __R3_NULLGL_H__
+
+#include "r3/common.h"
+
+#include <string>
+#include <vector>
+
+namespace r3 {
+	
+	// Null GL backend for headless builds (R3_NULL_GL).  Every entry point
+	// the r3 GL code uses is implemented as a no-op that counts what a driver
+	// would have been asked to do, so the CPU side of rendering can be timed
+	// and regression tested without a GPU.  Like a GL context it is meant to
+	// be used from one thread.
+	
+	// Counts for one frame.  A state change is any call that sets pipeline
+	// state: binds, enables, blend, tex env and parameters, uniforms and
+	// vertex array setup.  It is redundant when it sets what was already set.
+	struct NullGLStats {
+		NullGLStats() : calls( 0 ), draws( 0 ), vertices( 0 ), bytesUploaded( 0 ), textureBytesUploaded( 0 ), stateChanges( 0 ), redundantStateChanges( 0 ), objectsCreated( 0 ), fenceWaits( 0 ), badDraws( 0 ), badUploads( 0 ) {}
+		int64 calls;
+		int64 draws;          // glDrawElements, glDrawArrays and glBegin/glEnd pairs
+		int64 vertices;       // vertices or indices submitted by those draws
+		int64 bytesUploaded;  // buffer and texture data handed to GL
+		int64 textureBytesUploaded;
+		int64 stateChanges;
+		int64 redundantStateChanges;
+		int64 objectsCreated;
+		int64 fenceWaits;     // glClientWaitSync calls
+		int64 badDraws;       // glDrawElements reading past the end of the index buffer
+		int64 badUploads;     // glBufferSubData or glMapBufferRange past the end of the bound buffer
+	};
+	
+	// Installs the null entry points and resets the tracked GL state.
+	void InitNullGL();
+	void ShutdownNullGL();
+	
+	// What r3GetProcAddress resolves to in null builds, NULL for entry points
+	// the backend does not implement.
+	void * NullGLGetProcAddress( const char * name );
+	
+	// Call once per frame, after the frame's last GL call.  Adds the frame to
+	// the nullgl_* metrics and starts counting the next one.
+	void NullGLEndFrame();
+	// the frame in progress
+	NullGLStats GetNullGLStats();
+	// the last frame ended by NullGLEndFrame
+	NullGLStats GetNullGLFrameStats();
+	// per entry point calls in the last frame, most called first
+	void GetNullGLFrameCalls( std::vector< std::pair< std::string, int64 > > & calls );
+	
+}
+
+#endif // __R3_NULLGL_H__
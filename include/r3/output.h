@@ -44,15 +44,64 @@
 #ifndef __R3_OUTPUT_H__
 #define __R3_OUTPUT_H__
 
+#include "r3/var.h"
+
+// Calls made through R3_OUTPUT below this level are compiled out entirely.
+// 0 = verbose, 1 = info, 2 = warning, 3 = error
+#ifndef R3_OUTPUT_MIN_LEVEL
+# if defined( NDEBUG )
+#  define R3_OUTPUT_MIN_LEVEL 1
+# else
+#  define R3_OUTPUT_MIN_LEVEL 0
+# endif
+#endif
+
 namespace r3 {
 	
+	enum OutputLevelEnum {
+		Output_Verbose,
+		Output_Info,
+		Output_Warning,
+		Output_Error
+	};
+	
+	extern VarInteger out_level;
+	
+	// A named group of messages with its own threshold var, "out_<name>".
+	// The default of -1 defers to out_level.
+	class OutputCategory : public VarInteger {
+	public:
+		OutputCategory( const char * catName, const char * catDesc );
+		bool Enabled( OutputLevelEnum level ) const {
+			int l = GetVal();
+			return int( level ) >= ( l < 0 ? out_level.GetVal() : l );
+		}
+	};
+	
 	void InitOutput();
 	void SetOutputFunction( void (*outputFunction)( const char *msg ) );
+	// Writes out anything still queued when out_async is set.
+	void FlushOutput();
 	
 	
 	void Output( const char *fmt, ... );
 	void OutputDebug( const char *fmt, ... );
+	// Unconditional, use R3_OUTPUT so filtered messages are never formatted.
+	// The level only picks the "warning: " or "error: " prefix.
+	void OutputAt( OutputLevelEnum level, const char *fmt, ... );
 	
 }
 
+#define R3_OUTPUT( cat, level, ... ) \
+	do { \
+		if( int( level ) >= R3_OUTPUT_MIN_LEVEL && (cat).Enabled( level ) ) { \
+			r3::OutputAt( level, __VA_ARGS__ ); \
+		} \
+	} while( 0 )
+
+#define R3_OUTPUT_VERBOSE( cat, ... ) R3_OUTPUT( cat, r3::Output_Verbose, __VA_ARGS__ )
+#define R3_OUTPUT_INFO( cat, ... ) R3_OUTPUT( cat, r3::Output_Info, __VA_ARGS__ )
+#define R3_OUTPUT_WARNING( cat, ... ) R3_OUTPUT( cat, r3::Output_Warning, __VA_ARGS__ )
+#define R3_OUTPUT_ERROR( cat, ... ) R3_OUTPUT( cat, r3::Output_Error, __VA_ARGS__ )
+
 #endif // __R3_OUTPUT_H__
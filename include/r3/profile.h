@@ -0,0 +1,95 @@
+/*
+ *  profile
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#ifndef __R3_PROFILE_H__
+#define __R3_PROFILE_H__
+
+#include "r3/common.h"
+#include "r3/atomic.h"
+
+#ifndef R3_HAS_PROFILE
+#define R3_HAS_PROFILE 1
+#endif
+
+namespace r3 {
+	
+	extern volatile int profileCapturing;
+	
+	uint64 ProfileTimestamp();
+	void ProfileRecord( const char * name, uint64 begin, uint64 end );
+	
+	// Start and stop a capture, the stop writes Chrome trace JSON
+	// (chrome://tracing, ui.perfetto.dev) to filename in f_cachePath.
+	void ProfileStart();
+	bool ProfileStop( const std::string & filename );
+	
+	// name must outlive the capture, in practice a string literal.
+	class ProfileScope {
+		const char * name;
+		uint64 begin;
+	public:
+		ProfileScope( const char * scopeName ) : name( NULL ), begin( 0 ) {
+			if( AtomicLoad( &profileCapturing ) ) {
+				name = scopeName;
+				begin = ProfileTimestamp();
+			}
+		}
+		~ProfileScope() {
+			if( name ) {
+				ProfileRecord( name, begin, ProfileTimestamp() );
+			}
+		}
+	};
+	
+}
+
+#define R3_PROFILE_CONCAT2( a, b ) a ## b
+#define R3_PROFILE_CONCAT( a, b ) R3_PROFILE_CONCAT2( a, b )
+
+#if R3_HAS_PROFILE
+# define R3_PROFILE( name ) r3::ProfileScope R3_PROFILE_CONCAT( r3ProfileScope, __LINE__ )( name )
+#else
+# define R3_PROFILE( name )
+#endif
+
+#endif // __R3_PROFILE_H__
@@ -0,0 +1,283 @@
+/*
+ *  queue
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#ifndef __R3_QUEUE_H__
+#define __R3_QUEUE_H__
+
+#include "r3/atomic.h"
+#include "r3/thread.h"
+
+#include <assert.h>
+
+#define R3_CACHE_LINE_SIZE 64
+
+// The multi-threaded exactness checks for these queues and for Semaphore
+// are the queue/* benchmarks in code/bench/threadbench.cpp.
+
+namespace r3 {
+	
+	inline uint RoundUpToPowerOfTwo( uint v ) {
+		uint p = 1;
+		while( p < v ) {
+			p <<= 1;
+		}
+		return p;
+	}
+	
+	// Bounded multi-producer / multi-consumer queue.  Each cell carries a
+	// sequence number that tells producers and consumers whose turn it is,
+	// so the only contended operations are the CAS on the two positions.
+	// Capacity is rounded up to a power of two.
+	template <typename T>
+	class LockFreeQueue {
+		struct Cell {
+			Atomic<uint> sequence;
+			T data;
+		};
+		Cell * cells;
+		uint mask;
+		char pad0[ R3_CACHE_LINE_SIZE ];
+		Atomic<uint> enqueuePos;
+		char pad1[ R3_CACHE_LINE_SIZE ];
+		Atomic<uint> dequeuePos;
+		char pad2[ R3_CACHE_LINE_SIZE ];
+		// disallow copying and assignment
+		LockFreeQueue( const LockFreeQueue & rhs ) {}
+		const LockFreeQueue & operator= ( const LockFreeQueue & rhs ) {
+			return *this;
+		}
+	public:
+		typedef T ValueType;
+		
+		LockFreeQueue( int capacity ) {
+			assert( capacity > 1 );
+			uint cap = RoundUpToPowerOfTwo( capacity );
+			cells = new Cell[ cap ];
+			mask = cap - 1;
+			for( uint i = 0; i < cap; i++ ) {
+				cells[ i ].sequence.Set( i );
+			}
+		}
+		~LockFreeQueue() {
+			delete [] cells;
+		}
+		
+		int Capacity() const {
+			return int( mask + 1 );
+		}
+		
+		// Only a snapshot when other threads are active.
+		int Size() const {
+			return int( enqueuePos.Get() - dequeuePos.Get() );
+		}
+		
+		bool TryPush( const T & val ) {
+			Cell * cell;
+			uint pos = enqueuePos.Get();
+			for(;;) {
+				cell = &cells[ pos & mask ];
+				int dif = int( cell->sequence.Get() - pos );
+				if( dif == 0 ) {
+					if( enqueuePos.CompareAndSwap( pos, pos + 1 ) ) {
+						break;
+					}
+					pos = enqueuePos.Get();
+				} else if( dif < 0 ) {
+					return false; // full
+				} else {
+					pos = enqueuePos.Get();
+				}
+			}
+			cell->data = val;
+			cell->sequence.Set( pos + 1 );
+			return true;
+		}
+		
+		bool TryPop( T & val ) {
+			Cell * cell;
+			uint pos = dequeuePos.Get();
+			for(;;) {
+				cell = &cells[ pos & mask ];
+				int dif = int( cell->sequence.Get() - ( pos + 1 ) );
+				if( dif == 0 ) {
+					if( dequeuePos.CompareAndSwap( pos, pos + 1 ) ) {
+						break;
+					}
+					pos = dequeuePos.Get();
+				} else if( dif < 0 ) {
+					return false; // empty
+				} else {
+					pos = dequeuePos.Get();
+				}
+			}
+			val = cell->data;
+			cell->data = T(); // don't hold on to resources until the slot is reused
+			cell->sequence.Set( pos + mask + 1 );
+			return true;
+		}
+	};
+	
+	// Bounded single-producer / single-consumer ring.  Cheaper than
+	// LockFreeQueue since there is no CAS, but only valid with exactly one
+	// pushing thread and one popping thread.
+	template <typename T>
+	class SpscQueue {
+		T * data;
+		uint mask;
+		char pad0[ R3_CACHE_LINE_SIZE ];
+		Atomic<uint> head; // next slot to pop, written by the consumer
+		char pad1[ R3_CACHE_LINE_SIZE ];
+		Atomic<uint> tail; // next slot to push, written by the producer
+		char pad2[ R3_CACHE_LINE_SIZE ];
+		// disallow copying and assignment
+		SpscQueue( const SpscQueue & rhs ) {}
+		const SpscQueue & operator= ( const SpscQueue & rhs ) {
+			return *this;
+		}
+	public:
+		typedef T ValueType;
+		
+		SpscQueue( int capacity ) {
+			assert( capacity > 1 );
+			uint cap = RoundUpToPowerOfTwo( capacity );
+			data = new T[ cap ];
+			mask = cap - 1;
+		}
+		~SpscQueue() {
+			delete [] data;
+		}
+		
+		int Capacity() const {
+			return int( mask + 1 );
+		}
+		
+		int Size() const {
+			return int( tail.Get() - head.Get() );
+		}
+		
+		bool TryPush( const T & val ) {
+			uint t = tail.Get();
+			if( ( t - head.Get() ) > mask ) {
+				return false; // full
+			}
+			data[ t & mask ] = val;
+			tail.Set( t + 1 );
+			return true;
+		}
+		
+		bool TryPop( T & val ) {
+			uint h = head.Get();
+			if( h == tail.Get() ) {
+				return false; // empty
+			}
+			val = data[ h & mask ];
+			data[ h & mask ] = T();
+			head.Set( h + 1 );
+			return true;
+		}
+	};
+	
+	// Blocking wrapper for either of the above.  Semaphores count filled and
+	// free slots so that waiters sleep instead of spinning.  A slot count can
+	// briefly run ahead of the cell it refers to (another thread is between
+	// claiming and publishing it), so the underlying Try call is retried.
+	template <typename T, typename Q = LockFreeQueue<T> >
+	class BlockingQueue {
+		Q queue;
+		Semaphore items;
+		Semaphore slots;
+	public:
+		typedef T ValueType;
+		
+		BlockingQueue( int capacity ) : queue( capacity ), items( 0 ), slots( queue.Capacity() ) {}
+		
+		int Capacity() const {
+			return queue.Capacity();
+		}
+		
+		int Size() const {
+			return queue.Size();
+		}
+		
+		void Push( const T & val ) {
+			slots.Wait();
+			while( queue.TryPush( val ) == false ) {
+				ThreadYield();
+			}
+			items.Post();
+		}
+		
+		bool TryPush( const T & val ) {
+			if( slots.TryWait() == false ) {
+				return false;
+			}
+			while( queue.TryPush( val ) == false ) {
+				ThreadYield();
+			}
+			items.Post();
+			return true;
+		}
+		
+		void Pop( T & val ) {
+			items.Wait();
+			while( queue.TryPop( val ) == false ) {
+				ThreadYield();
+			}
+			slots.Post();
+		}
+		
+		bool TryPop( T & val ) {
+			if( items.TryWait() == false ) {
+				return false;
+			}
+			while( queue.TryPop( val ) == false ) {
+				ThreadYield();
+			}
+			slots.Post();
+			return true;
+		}
+	};
+	
+}
+
+#endif // __R3_QUEUE_H__
@@ -0,0 +1,214 @@
+/*
+ *  simd
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#ifndef __R3_SIMD_H__
+#define __R3_SIMD_H__
+
+// Four wide float vectors over SSE2 or NEON, for the few kernels that are
+// worth writing twice.  R3_SIMD is 1 when either is there, and build
+// with -DR3_SIMD=0 to use the scalar code everywhere.  R3_SIMD_AVX is 1
+// too when the compiler targets AVX, for kernels that can go eight wide.
+
+#ifndef R3_SIMD
+# if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#  define R3_SIMD 1
+#  define R3_SIMD_SSE 1
+# elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#  define R3_SIMD 1
+#  define R3_SIMD_NEON 1
+# else
+#  define R3_SIMD 0
+# endif
+#endif
+
+#if R3_SIMD_SSE
+# include <emmintrin.h>
+# if defined( __AVX__ )
+#  define R3_SIMD_AVX 1
+#  include <immintrin.h>
+# endif
+#elif R3_SIMD_NEON
+# include <arm_neon.h>
+#endif
+
+#if R3_SIMD
+
+#include <string.h>
+
+namespace r3 {
+	
+#if R3_SIMD_SSE
+	
+	typedef __m128 Float4;
+	
+	// unaligned
+	inline Float4 Load4( const float * p ) { return _mm_loadu_ps( p ); }
+	inline void Store4( float * p, Float4 v ) { _mm_storeu_ps( p, v ); }
+	inline Float4 Splat4( float f ) { return _mm_set1_ps( f ); }
+	inline Float4 Set4( float x, float y, float z, float w ) { return _mm_setr_ps( x, y, z, w ); }
+	inline Float4 Add4( Float4 a, Float4 b ) { return _mm_add_ps( a, b ); }
+	inline Float4 Sub4( Float4 a, Float4 b ) { return _mm_sub_ps( a, b ); }
+	inline Float4 Mul4( Float4 a, Float4 b ) { return _mm_mul_ps( a, b ); }
+	inline Float4 Div4( Float4 a, Float4 b ) { return _mm_div_ps( a, b ); }
+	inline float First4( Float4 v ) { return _mm_cvtss_f32( v ); }
+	
+	// result lane k is v's lane ik
+	template < int i0, int i1, int i2, int i3 >
+	inline Float4 Swizzle4( Float4 v ) {
+		return _mm_shuffle_ps( v, v, _MM_SHUFFLE( i3, i2, i1, i0 ) );
+	}
+	
+	inline void Transpose4( Float4 & r0, Float4 & r1, Float4 & r2, Float4 & r3 ) {
+		_MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+	}
+	
+	inline Float4 Min4( Float4 a, Float4 b ) { return _mm_min_ps( a, b ); }
+	inline Float4 Max4( Float4 a, Float4 b ) { return _mm_max_ps( a, b ); }
+	
+	// comparisons give all ones or all zeros in each lane
+	inline Float4 Less4( Float4 a, Float4 b ) { return _mm_cmplt_ps( a, b ); }
+	inline Float4 Greater4( Float4 a, Float4 b ) { return _mm_cmpgt_ps( a, b ); }
+	inline Float4 And4( Float4 a, Float4 b ) { return _mm_and_ps( a, b ); }
+	inline Float4 Or4( Float4 a, Float4 b ) { return _mm_or_ps( a, b ); }
+	// the integer bits in every lane
+	inline Float4 Bits4( int bits ) { return _mm_castsi128_ps( _mm_set1_epi32( bits ) ); }
+	// each lane's bits, which must be under 256, as a byte
+	inline void StoreBytes4( unsigned char * p, Float4 v ) {
+		__m128i i = _mm_castps_si128( v );
+		i = _mm_packs_epi32( i, i );
+		i = _mm_packus_epi16( i, i );
+		int bytes = _mm_cvtsi128_si32( i );
+		memcpy( p, &bytes, 4 );
+	}
+	
+#elif R3_SIMD_NEON
+	
+	typedef float32x4_t Float4;
+	
+	inline Float4 Load4( const float * p ) { return vld1q_f32( p ); }
+	inline void Store4( float * p, Float4 v ) { vst1q_f32( p, v ); }
+	inline Float4 Splat4( float f ) { return vdupq_n_f32( f ); }
+	inline Float4 Set4( float x, float y, float z, float w ) {
+		float f[4] = { x, y, z, w };
+		return vld1q_f32( f );
+	}
+	inline Float4 Add4( Float4 a, Float4 b ) { return vaddq_f32( a, b ); }
+	inline Float4 Sub4( Float4 a, Float4 b ) { return vsubq_f32( a, b ); }
+	inline Float4 Mul4( Float4 a, Float4 b ) { return vmulq_f32( a, b ); }
+	// a true divide, not the reciprocal estimate, so results match scalar
+	inline Float4 Div4( Float4 a, Float4 b ) {
+# if defined( __aarch64__ )
+		return vdivq_f32( a, b );
+# else
+		float fa[4], fb[4];
+		vst1q_f32( fa, a );
+		vst1q_f32( fb, b );
+		return Set4( fa[0] / fb[0], fa[1] / fb[1], fa[2] / fb[2], fa[3] / fb[3] );
+# endif
+	}
+	inline float First4( Float4 v ) { return vgetq_lane_f32( v, 0 ); }
+	
+	template < int i0, int i1, int i2, int i3 >
+	inline Float4 Swizzle4( Float4 v ) {
+# if defined( __clang__ )
+		return __builtin_shufflevector( v, v, i0, i1, i2, i3 );
+# else
+		const uint32x4_t mask = { i0, i1, i2, i3 };
+		return __builtin_shuffle( v, mask );
+# endif
+	}
+	
+	inline void Transpose4( Float4 & r0, Float4 & r1, Float4 & r2, Float4 & r3 ) {
+		float32x4x2_t t01 = vtrnq_f32( r0, r1 );
+		float32x4x2_t t23 = vtrnq_f32( r2, r3 );
+		r0 = vcombine_f32( vget_low_f32( t01.val[0] ), vget_low_f32( t23.val[0] ) );
+		r1 = vcombine_f32( vget_low_f32( t01.val[1] ), vget_low_f32( t23.val[1] ) );
+		r2 = vcombine_f32( vget_high_f32( t01.val[0] ), vget_high_f32( t23.val[0] ) );
+		r3 = vcombine_f32( vget_high_f32( t01.val[1] ), vget_high_f32( t23.val[1] ) );
+	}
+	
+	inline Float4 Min4( Float4 a, Float4 b ) { return vminq_f32( a, b ); }
+	inline Float4 Max4( Float4 a, Float4 b ) { return vmaxq_f32( a, b ); }
+	
+	inline Float4 Less4( Float4 a, Float4 b ) { return vreinterpretq_f32_u32( vcltq_f32( a, b ) ); }
+	inline Float4 Greater4( Float4 a, Float4 b ) { return vreinterpretq_f32_u32( vcgtq_f32( a, b ) ); }
+	inline Float4 And4( Float4 a, Float4 b ) {
+		return vreinterpretq_f32_u32( vandq_u32( vreinterpretq_u32_f32( a ), vreinterpretq_u32_f32( b ) ) );
+	}
+	inline Float4 Or4( Float4 a, Float4 b ) {
+		return vreinterpretq_f32_u32( vorrq_u32( vreinterpretq_u32_f32( a ), vreinterpretq_u32_f32( b ) ) );
+	}
+	inline Float4 Bits4( int bits ) { return vreinterpretq_f32_u32( vdupq_n_u32( bits ) ); }
+	inline void StoreBytes4( unsigned char * p, Float4 v ) {
+		uint16x4_t h = vmovn_u32( vreinterpretq_u32_f32( v ) );
+		uint8x8_t b = vmovn_u16( vcombine_u16( h, h ) );
+		unsigned char bytes[8];
+		vst1_u8( bytes, b );
+		memcpy( p, bytes, 4 );
+	}
+	
+#endif
+	
+	// every lane set to v's lane i
+	template < int i >
+	inline Float4 Lane4( Float4 v ) {
+		return Swizzle4< i, i, i, i >( v );
+	}
+	
+	// cross product of the first three lanes, with 0 in the last
+	inline Float4 Cross4( Float4 a, Float4 b ) {
+		return Sub4( Mul4( Swizzle4< 1, 2, 0, 3 >( a ), Swizzle4< 2, 0, 1, 3 >( b ) ),
+		             Mul4( Swizzle4< 2, 0, 1, 3 >( a ), Swizzle4< 1, 2, 0, 3 >( b ) ) );
+	}
+	
+	// sum of all four lanes, in every lane
+	inline Float4 Sum4( Float4 v ) {
+		Float4 s = Add4( v, Swizzle4< 1, 0, 3, 2 >( v ) );
+		return Add4( s, Swizzle4< 2, 3, 0, 1 >( s ) );
+	}
+	
+}
+
+#endif // R3_SIMD
+
+#endif // __R3_SIMD_H__
@@ -81,7 +81,8 @@ namespace r3 {
 		int ReadPartial( char * dst, uint dst_bytes ); // only make one read attempt
 		bool Write( const char * src, uint src_bytes );        
 
-		bool CanRead();
+		// waits up to timeout seconds for data
+		bool CanRead( double timeout = 0.0 );
 
 		template <typename T>
 		bool Read( T & t ) {
@@ -126,6 +126,7 @@ namespace r3 {
     int levelMax; // this describes the highest mip level defined - so 0 if no mipmaps
     unsigned int object;
 		Texture( const std::string & texName, TextureFormatEnum texFormat, TextureTargetEnum texTarget );
+    void BindForUpdate();
 	public:
     
 		virtual ~Texture();
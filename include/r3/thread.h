@@ -51,8 +51,13 @@
 # include <windows.h>
 #else
 # include <pthread.h>
+# include <sched.h>
+# include <sys/time.h>
+# include <time.h>
 #endif
 
+#include "r3/atomic.h"
+
 #include <string>
 
 #define R3_STRINGIZE(x) R3_STRINGIZE2(x)
@@ -81,6 +86,14 @@ namespace r3 {
 #endif
     }
     
+    inline void ThreadYield() {
+#if _WIN32
+        SwitchToThread();
+#else
+        sched_yield();
+#endif
+    }
+    
     
 #if _WIN32
 	class Mutex {
@@ -160,6 +173,114 @@ namespace r3 {
         }
     };
 #endif
+    
+    // Counting semaphore.  Unlike Condition, a Post() that happens before
+    // the Wait() is not lost.
+#if _WIN32
+    class Semaphore {
+        HANDLE sem;
+    public:
+        Semaphore( int initialCount = 0 ) {
+            sem = CreateSemaphore( NULL, initialCount, 0x7fffffff, NULL );
+        }
+        ~Semaphore() {
+            CloseHandle( sem );
+        }
+        void Post() {
+            ReleaseSemaphore( sem, 1, NULL );
+        }
+        void Wait() {
+            WaitForSingleObject( sem, INFINITE );
+        }
+        bool TryWait() {
+            return WaitForSingleObject( sem, 0 ) == WAIT_OBJECT_0;
+        }
+        // returns false if the timeout expired first
+        bool TimedWait( double seconds ) {
+            DWORD ms = seconds > 0.0 ? DWORD( seconds * 1000.0 + 0.5 ) : 0;
+            return WaitForSingleObject( sem, ms ) == WAIT_OBJECT_0;
+        }
+    };
+#else
+    // Apple has no pthread_condattr_setclock, so TimedWait there is still
+    // subject to wall clock changes.
+# if __APPLE__
+#  define R3_COND_MONOTONIC 0
+# else
+#  define R3_COND_MONOTONIC 1
+# endif
+    class Semaphore {
+        pthread_mutex_t mutex;
+        pthread_cond_t cond;
+        int count;
+    public:
+        Semaphore( int initialCount = 0 ) : count( initialCount ) {
+            pthread_mutex_init( &mutex, NULL );
+#if R3_COND_MONOTONIC
+            pthread_condattr_t attr;
+            pthread_condattr_init( &attr );
+            pthread_condattr_setclock( &attr, CLOCK_MONOTONIC );
+            pthread_cond_init( &cond, &attr );
+            pthread_condattr_destroy( &attr );
+#else
+            pthread_cond_init( &cond, NULL );
+#endif
+        }
+        // No destructor, like Mutex and Condition.  Service threads are still
+        // waiting on global semaphores when static destructors run at exit,
+        // and pthread_cond_destroy blocks on waiters.
+        void Post() {
+            pthread_mutex_lock( &mutex );
+            count++;
+            pthread_cond_signal( &cond );
+            pthread_mutex_unlock( &mutex );
+        }
+        void Wait() {
+            pthread_mutex_lock( &mutex );
+            while( count == 0 ) {
+                pthread_cond_wait( &cond, &mutex );
+            }
+            count--;
+            pthread_mutex_unlock( &mutex );
+        }
+        bool TryWait() {
+            pthread_mutex_lock( &mutex );
+            bool acquired = count > 0;
+            if( acquired ) {
+                count--;
+            }
+            pthread_mutex_unlock( &mutex );
+            return acquired;
+        }
+        // returns false if the timeout expired first
+        bool TimedWait( double seconds ) {
+            // the deadline is on the clock the condition was created with
+#if R3_COND_MONOTONIC
+            timespec now;
+            clock_gettime( CLOCK_MONOTONIC, &now );
+            double t = now.tv_sec + now.tv_nsec / 1000000000.0 + ( seconds > 0.0 ? seconds : 0.0 );
+#else
+            timeval now;
+            gettimeofday( &now, NULL );
+            double t = now.tv_sec + now.tv_usec / 1000000.0 + ( seconds > 0.0 ? seconds : 0.0 );
+#endif
+            timespec deadline;
+            deadline.tv_sec = time_t( t );
+            deadline.tv_nsec = long( ( t - deadline.tv_sec ) * 1000000000.0 );
+            pthread_mutex_lock( &mutex );
+            int err = 0;
+            while( count == 0 && err == 0 ) {
+                err = pthread_cond_timedwait( &cond, &mutex, &deadline );
+            }
+            bool acquired = count > 0;
+            if( acquired ) {
+                count--;
+            }
+            pthread_mutex_unlock( &mutex );
+            return acquired;
+        }
+    };
+#endif
 	
 	class Thread {
 		pthread_t threadId;
@@ -175,6 +296,46 @@ namespace r3 {
         }
 	};
 	
+	// Per-thread pointer.  It has no constructor so that a zero initialized
+	// static is usable during static initialization; the key is created on
+	// first use.  Only give it static storage duration.
+	template <typename T>
+	class ThreadLocalPtr {
+		volatile int state; // 0 = no key, 1 = creating, 2 = ready
+#if _WIN32
+		DWORD key;
+		void CreateKey() { key = TlsAlloc(); }
+		T * GetValue() const { return static_cast< T * >( TlsGetValue( key ) ); }
+		void SetValue( T * p ) { TlsSetValue( key, p ); }
+#else
+		pthread_key_t key;
+		void CreateKey() { pthread_key_create( &key, NULL ); }
+		T * GetValue() const { return static_cast< T * >( pthread_getspecific( key ) ); }
+		void SetValue( T * p ) { pthread_setspecific( key, p ); }
+#endif
+		void EnsureKey() {
+			if( AtomicLoad( &state ) == 2 ) {
+				return;
+			}
+			if( AtomicCompareAndSwap( &state, 0, 1 ) ) {
+				CreateKey();
+				AtomicStore( &state, 2 );
+			}
+			while( AtomicLoad( &state ) != 2 ) {
+				ThreadYield();
+			}
+		}
+	public:
+		T * Get() {
+			EnsureKey();
+			return GetValue();
+		}
+		void Set( T * p ) {
+			EnsureKey();
+			SetValue( p );
+		}
+	};
+	
 	class ScopedMutex {
 		Mutex * m;
 	public:
@@ -196,6 +357,17 @@ namespace r3 {
 			if( m ) m->Acquire( m->loc );
 		}
 	};
+	
+	// Job pool shared by everything that splits work across cores.  Its
+	// threads start on first use and stay around, like the other service
+	// threads.  RunJobs runs func on each of numJobs jobs, the first on the
+	// calling thread, and returns once all are done.  Calls from different
+	// threads take turns, and a job may not run jobs of its own.
+	const int MaxJobThreads = 16;
+	void RunJobs( void (*func)( void * ), void * jobs, int jobSize, int numJobs );
+	template< typename T > void RunJobs( T * jobs, int numJobs, void (*func)( void * ) ) {
+		RunJobs( func, jobs, (int)sizeof( T ), numJobs );
+	}
     
 }
 
@@ -43,6 +43,8 @@
 #ifndef __R3_TIME_H__
 #define __R3_TIME_H__
 
+#include "r3/common.h"
+
 #if _WIN32
 # ifndef WIN32_LEAN_AND_MEAN
 #  define WIN32_LEAN_AND_MEAN 1
@@ -62,9 +64,18 @@
 
 namespace r3 {
 
+	// Wall clock, in seconds since the epoch.  It jumps with clock
+	// adjustments and SetTimeOffset, so use it for timestamps that are
+	// persisted or shown to the user, never for measuring intervals.
 	void SetTimeOffset( double offset );
 	double GetTimeOffset();
 	
+	// Monotonic, from an arbitrary origin.  Use these for intervals.
+	uint64 GetMonotonicNanoseconds();
+	inline double GetMonotonicSeconds() {
+		return GetMonotonicNanoseconds() * 1e-9;
+	}
+	
 #if _WIN32
 	inline double GetTime() {
 		struct _timeb timebuffer;
@@ -88,17 +99,11 @@ namespace r3 {
 
 
 
-	inline float GetSeconds() {
-		static double tstartup;
-		double t = GetTime();
-		if ( tstartup == 0.0 ) {
-			tstartup = t;
-		}
-		return float( t - tstartup );
-	}
+	// Monotonic seconds since the first call.
+	float GetSeconds();
 	
 	inline void SleepMilliseconds( int i ) {
-#if __APPLE__ || ANDROID
+#if __APPLE__ || ANDROID || __linux__
 		usleep( i * 1000 );
 #elif _WIN32
 		Sleep( i );
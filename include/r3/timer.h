@@ -0,0 +1,71 @@
+/*
+ *  timer
+ *
+ */
+
+/* 
+ Copyright (c) 2013 Cass Everitt
+ All rights reserved.
+ 
+ Redistribution and use in source and binary forms, with or
+ without modification, are permitted provided that the following
+ conditions are met:
+ 
+ * Redistributions of source code must retain the above
+ copyright notice, this list of conditions and the following
+ disclaimer.
+ 
+ * Redistributions in binary form must reproduce the above
+ copyright notice, this list of conditions and the following
+ disclaimer in the documentation and/or other materials
+ provided with the distribution.
+ 
+ * The names of contributors to this software may not be used
+ to endorse or promote products derived from this software
+ without specific prior written permission. 
+ 
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+ POSSIBILITY OF SUCH DAMAGE. 
+ 
+ 
+ Cass Everitt
+ */
+
+#ifndef __R3_TIMER_H__
+#define __R3_TIMER_H__
+
+#include "r3/common.h"
+
+namespace r3 {
+	
+	void InitTimer();
+	void ShutdownTimer();
+	
+	typedef uint64 TimerId;
+	const TimerId InvalidTimerId = 0;
+	
+	// Called on the timer thread, with no locks held, so it may schedule or
+	// cancel timers itself.  Anything slow should be pushed to a work queue
+	// rather than done in place.
+	typedef void (*TimerFunc)( void * data );
+	
+	// Run func after delay seconds and then, if period is positive, every
+	// period seconds until cancelled.  Scheduling and cancelling are O(1).
+	TimerId ScheduleTimer( double delay, TimerFunc func, void * data, double period = 0.0 );
+	
+	// Returns false if the timer already fired (one-shot) or was cancelled.
+	bool CancelTimer( TimerId id );
+	
+}
+
+#endif // __R3_TIMER_H__
@@ -61,6 +61,10 @@ namespace r3 {
       
       ~Json() {}
       
+      // nodes are charged to the mem_json memory tag
+      static void * operator new( size_t sz );
+      static void operator delete( void * p );
+      
       Json & operator= ( const Json & rhs );
       
       Type GetType() const { return t; }
@@ -336,12 +340,16 @@ namespace r3 {
 
 #if UJSON_IMPLEMENTATION
 
+#include "r3/memory.h"
+
 #include <stdlib.h>
 #include <string.h>
 #include <sstream>
 
 using namespace r3::ujson;
 
+r3::MemoryTag mem_json( "json", "Budget in KB for JSON nodes, 0 for none." );
+
 namespace {
   
   std::string escape_string( const std::string & s ) {
@@ -757,6 +765,18 @@ namespace {
 namespace r3 {
   namespace ujson {
     
+    void * Json::operator new( size_t sz ) {
+      void * p = TrackedMalloc( mem_json, sz );
+      if( p == NULL ) {
+        throw std::bad_alloc();
+      }
+      return p;
+    }
+    
+    void Json::operator delete( void * p ) {
+      TrackedFree( p );
+    }
+    
     Json & Json::operator= ( const Json & rhs ) {
       if( this != &invalid_node ) {
         t = rhs.t;
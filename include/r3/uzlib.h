@@ -61,6 +61,7 @@ namespace r3 {
 #else // R3_UZLIB_IMPLEMENTATION
 
 #include <assert.h>
+#include <stdlib.h>
 #include <string.h>
 
 namespace {